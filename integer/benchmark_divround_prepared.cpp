@@ -0,0 +1,264 @@
+/**
+ * benchmark_divround_prepared.cpp
+ * Measures the throughput of
+ *     type divround<typename type>(const type dividend, const type divisor);
+ * against the prepared divisor forms
+ *     type divround_divisor<typename type>::apply(const type dividend) const;
+ *     void divround_divisor<typename type>::apply_batch(const type *dividend, type *result, const size_t length) const;
+ *     void divround_prepared_batch_X(const type *dividend, type *result, const size_t length, const divround_divisor_X *divisor);
+ * when one divisor is applied to an array of dividends.
+ *
+ * Throughput is printed in millions of elements per second. The divisor
+ * is read through a volatile so that the compiler cannot replace the
+ * hardware divide in divround<type> with a multiplication itself.
+ *
+ * As always, run this on the target hardware if performance is important.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "divround.hpp"
+#include "divround_prepared.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "divround_prepared.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/* Forwards to the C batch functions so that benchmark_type can call them. */
+void c_prepared_batch(const int8_t   *dividend, int8_t   *result, const size_t length, const int8_t   divisor) { divround_divisor_i8  d = divround_prepare_i8(divisor);  divround_prepared_batch_i8(dividend, result, length, &d); }
+void c_prepared_batch(const int16_t  *dividend, int16_t  *result, const size_t length, const int16_t  divisor) { divround_divisor_i16 d = divround_prepare_i16(divisor); divround_prepared_batch_i16(dividend, result, length, &d); }
+void c_prepared_batch(const int32_t  *dividend, int32_t  *result, const size_t length, const int32_t  divisor) { divround_divisor_i32 d = divround_prepare_i32(divisor); divround_prepared_batch_i32(dividend, result, length, &d); }
+void c_prepared_batch(const int64_t  *dividend, int64_t  *result, const size_t length, const int64_t  divisor) { divround_divisor_i64 d = divround_prepare_i64(divisor); divround_prepared_batch_i64(dividend, result, length, &d); }
+void c_prepared_batch(const uint8_t  *dividend, uint8_t  *result, const size_t length, const uint8_t  divisor) { divround_divisor_u8  d = divround_prepare_u8(divisor);  divround_prepared_batch_u8(dividend, result, length, &d); }
+void c_prepared_batch(const uint16_t *dividend, uint16_t *result, const size_t length, const uint16_t divisor) { divround_divisor_u16 d = divround_prepare_u16(divisor); divround_prepared_batch_u16(dividend, result, length, &d); }
+void c_prepared_batch(const uint32_t *dividend, uint32_t *result, const size_t length, const uint32_t divisor) { divround_divisor_u32 d = divround_prepare_u32(divisor); divround_prepared_batch_u32(dividend, result, length, &d); }
+void c_prepared_batch(const uint64_t *dividend, uint64_t *result, const size_t length, const uint64_t divisor) { divround_divisor_u64 d = divround_prepare_u64(divisor); divround_prepared_batch_u64(dividend, result, length, &d); }
+
+/**
+ * Each measurement repeats its operation until at least this many
+ * elements have been processed.
+ */
+const uint64_t elements_per_measurement = 1ull << 26;
+const size_t array_length = 4096u;
+
+/**
+ * Accumulates a value from every result array so that the compiler
+ * cannot discard the benchmarked work.
+ */
+uint64_t sink = 0u;
+
+/* The divisor is chosen at run time through this volatile. */
+volatile int divisor_seed = 7;
+
+/**
+ * Returns millions of elements processed per second.
+ */
+double mega_elements_per_second(const uint64_t elements, const std::chrono::high_resolution_clock::time_point start, const std::chrono::high_resolution_clock::time_point end) {
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  return static_cast<double>(elements) / seconds * 1.0e-6;
+}
+
+/**
+ * Benchmarks divround<type> and the prepared divisor forms for one type.
+ */
+template <typename type> void benchmark_type(const char *type_name, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<uint64_t> distribution;
+  std::vector<type> dividend(array_length);
+  std::vector<type> result(array_length);
+  for (type &value : dividend) value = static_cast<type>(distribution(rng));
+  const type divisor = static_cast<type>(divisor_seed * 11 - 4);
+  const uint64_t repetitions = elements_per_measurement / array_length;
+  const uint64_t elements = repetitions * array_length;
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < array_length; j++) result[j] = divround<type>(dividend[j], divisor);
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+  const double plain = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  const divround_divisor<type> prepared(divisor);
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < array_length; j++) result[j] = prepared.apply(dividend[j]);
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double apply = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    prepared.apply_batch(dividend.data(), result.data(), array_length);
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double apply_batch = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    c_prepared_batch(dividend.data(), result.data(), array_length, divisor);
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double c_batch = mega_elements_per_second(elements, start, end);
+
+  std::printf("%-9s %10.1f %10.1f %10.1f %10.1f %7.2fx\n", type_name, plain, apply, apply_batch, c_batch, apply_batch / plain);
+}
+
+int main() {
+  std::printf("Melem/s   divround      apply apply_batch  C batch  speedup\n");
+  std::mt19937_64 rng(0xD17D0D17ull);
+  benchmark_type<int8_t>("int8_t", rng);
+  benchmark_type<uint8_t>("uint8_t", rng);
+  benchmark_type<int16_t>("int16_t", rng);
+  benchmark_type<uint16_t>("uint16_t", rng);
+  benchmark_type<int32_t>("int32_t", rng);
+  benchmark_type<uint32_t>("uint32_t", rng);
+  benchmark_type<int64_t>("int64_t", rng);
+  benchmark_type<uint64_t>("uint64_t", rng);
+  std::printf("(ignore) %" PRIu64 "\n", sink);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
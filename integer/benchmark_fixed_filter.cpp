@@ -0,0 +1,284 @@
+/**
+ * benchmark_fixed_filter.cpp
+ * Measures the throughput of
+ *   void fir_filter<typename type>(const type *input, type *output, const size_t length, const type *taps, const size_t tap_count, const uint8_t shift);
+ *   void biquad_filter<typename type>(biquad *biquads, const size_t channels, const type *input, type *output, const size_t frames);
+ * from fixed_filter.hpp for int16_t and int32_t on the scalar and AVX2
+ * code paths, selected with cpu_features_limit().
+ *
+ * Throughput is printed in millions of output samples per second. The
+ * benchmark runs on one thread, so this is the rate of a single core;
+ * independent streams on other cores add to it.
+ *
+ * The FIR rows filter blocks of 4096 samples with 8, 32, and 128 taps.
+ * The biquad rows filter 4096 frames of one channel, which is limited by
+ * the latency of the feedback loop on every code path, and of as many
+ * interleaved channels as one AVX2 kernel handles (8 for int16_t, 4 for
+ * int32_t).
+ * As always, run it on the target hardware if performance is important.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "fixed_filter.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "cpu_features.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Each measurement repeats its operation until at least this many
+ * output samples have been produced.
+ */
+const uint64_t samples_per_measurement = 1ull << 25;
+const size_t block_length = 4096u;
+
+/**
+ * Accumulates a value from every output block so that the compiler
+ * cannot discard the benchmarked work.
+ */
+uint64_t sink = 0u;
+
+/**
+ * Returns millions of samples produced per second.
+ */
+double mega_samples_per_second(const uint64_t samples, const std::chrono::high_resolution_clock::time_point start, const std::chrono::high_resolution_clock::time_point end) {
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  return static_cast<double>(samples) / seconds * 1.0e-6;
+}
+
+struct code_path {
+  const char *name;
+  uint32_t required;
+  uint32_t mask;
+};
+
+const code_path code_paths[] = {
+  {"scalar", 0u, 0u},
+  {"AVX2", CPU_FEATURE_AVX2, CPU_FEATURE_ALL}
+};
+
+/* Returns random samples spanning the lower half of the range of type. */
+template <typename type> std::vector<type> random_samples(const size_t length, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<int64_t> distribution(static_cast<int64_t>(std::numeric_limits<type>::lowest()) / 2, static_cast<int64_t>(std::numeric_limits<type>::max()) / 2);
+  std::vector<type> samples(length);
+  for (type &sample : samples) sample = static_cast<type>(distribution(rng));
+  return samples;
+}
+
+template <typename type> void benchmark_fir(const char *type_name, const size_t tap_count, const uint32_t supported, std::mt19937_64 &rng) {
+  /* Taps summing to about 2^14 in magnitude, with shift 14 for unity gain. */
+  std::uniform_int_distribution<int64_t> tap_distribution(-(16384 / static_cast<int64_t>(tap_count)), 16384 / static_cast<int64_t>(tap_count));
+  std::vector<type> taps(tap_count);
+  for (type &tap : taps) tap = static_cast<type>(tap_distribution(rng));
+  const std::vector<type> input = random_samples<type>(tap_count - 1u + block_length, rng);
+  std::vector<type> output(block_length);
+  const uint64_t repetitions = samples_per_measurement / block_length;
+
+  std::printf("fir_filter<%s>    %3zu taps     ", type_name, tap_count);
+  double scalar_rate = 0.0;
+  for (const code_path &path : code_paths) {
+    if ((supported & path.required) != path.required) continue;
+    cpu_features_limit(path.mask);
+    const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (uint64_t rep = 0u; rep < repetitions; rep++) {
+      fir_filter<type>(input.data(), output.data(), block_length, taps.data(), tap_count, 14u);
+      sink += static_cast<uint64_t>(output[rep % block_length]);
+    }
+    const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+    const double rate = mega_samples_per_second(repetitions * block_length, start, end);
+    if (scalar_rate == 0.0) scalar_rate = rate;
+    std::printf("  %s %8.1f %5.2fx", path.name, rate, rate / scalar_rate);
+  }
+  cpu_features_limit(CPU_FEATURE_ALL);
+  std::printf("\n");
+}
+
+template <typename type> void benchmark_biquad(const char *type_name, const size_t channels, const uint32_t supported, std::mt19937_64 &rng) {
+  typedef typename fixed_filter_biquad<type>::type biquad;
+  /* A lowpass section with Q14 coefficients. */
+  const std::vector<biquad> prepared(channels, biquad_prepare<type>(1105, 2210, 1105, -18727, 6763, 14u));
+  const std::vector<type> input = random_samples<type>(channels * block_length, rng);
+  std::vector<type> output(channels * block_length);
+  const uint64_t repetitions = samples_per_measurement / (channels * block_length);
+
+  std::printf("biquad_filter<%s> %3zu channels ", type_name, channels);
+  double scalar_rate = 0.0;
+  for (const code_path &path : code_paths) {
+    if ((supported & path.required) != path.required) continue;
+    cpu_features_limit(path.mask);
+    std::vector<biquad> biquads = prepared;
+    const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (uint64_t rep = 0u; rep < repetitions; rep++) {
+      biquad_filter<type>(biquads.data(), channels, input.data(), output.data(), block_length);
+      sink += static_cast<uint64_t>(output[rep % output.size()]);
+    }
+    const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+    const double rate = mega_samples_per_second(repetitions * channels * block_length, start, end);
+    if (scalar_rate == 0.0) scalar_rate = rate;
+    std::printf("  %s %8.1f %5.2fx", path.name, rate, rate / scalar_rate);
+  }
+  cpu_features_limit(CPU_FEATURE_ALL);
+  std::printf("\n");
+}
+
+int main() {
+  const uint32_t supported = cpu_features();
+  std::printf("processor supports:%s\n", (supported & CPU_FEATURE_AVX2) ? " AVX2" : "");
+  std::printf("columns: filter, size, then Msamples/s on one core and speedup over scalar for each code path\n");
+
+  std::mt19937_64 rng(0xF117E2ull);
+  for (const size_t tap_count : {8u, 32u, 128u}) {
+    benchmark_fir<int16_t>("int16_t", tap_count, supported, rng);
+    benchmark_fir<int32_t>("int32_t", tap_count, supported, rng);
+  }
+  benchmark_biquad<int16_t>("int16_t", 1u, supported, rng);
+  benchmark_biquad<int16_t>("int16_t", 8u, supported, rng);
+  benchmark_biquad<int32_t>("int32_t", 1u, supported, rng);
+  benchmark_biquad<int32_t>("int32_t", 4u, supported, rng);
+
+  std::printf("(ignore) %" PRIu64 "\n", sink);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,300 @@
+/**
+ * benchmark_fixed_point.cpp
+ * Measures the throughput of fixed<int_bits, frac_bits, storage, overflow>
+ * arithmetic from fixed_point.hpp against the raw calls it lowers to,
+ * written by hand on the same data:
+ *     Q9.7 * Q1.15 -> Q9.7            static_cast<int16_t>(multshiftround<int32_t, 15>(num, mul))
+ *     the same, saturating            multshiftround_sat<int16_t, int16_t, 15>(num, mul, lower_bound, upper_bound)
+ *     Q17.15 -> Q9.7, saturating      shiftround<int32_t, 8>(num), saturate_value<int32_t>, static_cast<int16_t>
+ *     Q9.7 / Q9.7 -> Q9.7             static_cast<int16_t>(divround<int32_t>(dividend * 128, divisor))
+ *     Q32.32 * Q32.32 -> Q32.32       multshiftround_wide<int64_t, 32>(num, mul)
+ *     the same, saturating            multshiftround_sat<int64_t, int64_t, 32>(num, mul, lower_bound, upper_bound)
+ *
+ * Throughput is printed in millions of elements per second for each pair,
+ * the best of five alternating trials, with the ratio of the fixed
+ * throughput to the hand written throughput.
+ * A ratio near 1.00 means the class adds no overhead. With gcc 12 at -O3
+ * each fixed loop compiles to the same instructions as its hand written
+ * loop, so the ratio only strays from 1.00 through code alignment, which
+ * can move the data dependent rounding branches of either form by 10% to
+ * 20%. The results of both forms are compared, and any difference is
+ * reported. The second operand
+ * is read through a volatile so that the compiler cannot fold it into the
+ * loops.
+ *
+ * As always, run this on the target hardware if performance is important.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "fixed_point.hpp"
+
+typedef fixed<9, 7, int16_t> q9_7;
+typedef fixed<9, 7, int16_t, fixed_saturate> q9_7_sat;
+typedef fixed<1, 15, int16_t> q1_15;
+typedef fixed<17, 15, int32_t> q17_15;
+typedef fixed<32, 32, int64_t> q32_32;
+typedef fixed<32, 32, int64_t, fixed_saturate> q32_32_sat;
+
+/**
+ * Each measurement repeats its operation until at least this many
+ * elements have been processed.
+ */
+const uint64_t elements_per_measurement = 1ull << 26;
+const size_t array_length = 4096u;
+const uint64_t repetitions = elements_per_measurement / array_length;
+const uint64_t elements = repetitions * array_length;
+const unsigned trials = 5u;
+
+/**
+ * Accumulates a value from every result array so that the compiler cannot
+ * discard the benchmarked work.
+ */
+uint64_t sink = 0u;
+uint64_t mismatch_count = 0u;
+
+/* The second operands are chosen at run time through these volatiles. */
+volatile double gain_seed = 0.7071;
+volatile double divisor_seed = -3.3;
+volatile double wide_gain_seed = 1.000123;
+
+/**
+ * Returns millions of elements processed per second.
+ */
+double mega_elements_per_second(const std::chrono::high_resolution_clock::time_point start, const std::chrono::high_resolution_clock::time_point end) {
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  return static_cast<double>(elements) / seconds * 1.0e-6;
+}
+
+/**
+ * Times repeated calls of loop(num, result) on one array and returns
+ * millions of elements processed per second.
+ */
+template <typename in_type, typename out_type, typename loop_type> double time_loop(const std::vector<in_type> &num, std::vector<out_type> &result, loop_type loop) {
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    loop(num.data(), result.data());
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+  return mega_elements_per_second(start, end);
+}
+
+/**
+ * Times hand(num, result) and with_fixed(num, result) in alternation and
+ * prints the best throughput of each and their ratio. Taking the best of
+ * several alternating trials keeps frequency scaling and other programs
+ * from favoring whichever form runs first. Both must store the same raw
+ * results.
+ */
+template <typename in_type, typename out_type, typename hand_loop, typename fixed_loop>
+void benchmark_pair(const char *name, const std::vector<in_type> &num, hand_loop hand, fixed_loop with_fixed) {
+  std::vector<out_type> hand_result(array_length);
+  std::vector<out_type> fixed_result(array_length);
+  double hand_rate = 0.0;
+  double fixed_rate = 0.0;
+  for (unsigned trial = 0u; trial < trials; trial++) {
+    hand_rate = std::max(hand_rate, time_loop(num, hand_result, hand));
+    fixed_rate = std::max(fixed_rate, time_loop(num, fixed_result, with_fixed));
+  }
+
+  if (std::memcmp(hand_result.data(), fixed_result.data(), array_length * sizeof(out_type)) != 0) {
+    mismatch_count++;
+    std::printf("ERROR: %s, the fixed results differ from the hand written results.\n", name);
+  }
+  std::printf("%-34s %12.1f %12.1f %7.2fx\n", name, hand_rate, fixed_rate, fixed_rate / hand_rate);
+}
+
+int main() {
+  std::printf("Melem/s                            hand written        fixed   ratio\n");
+  std::mt19937_64 rng(0xF1BED901A7ull);
+  std::uniform_int_distribution<int64_t> distribution(std::numeric_limits<int64_t>::lowest(), std::numeric_limits<int64_t>::max());
+
+  std::vector<int16_t> temperatures(array_length);
+  std::vector<int32_t> wide_temperatures(array_length);
+  std::vector<int64_t> wide_values(array_length);
+  for (size_t j = 0u; j < array_length; j++) {
+    temperatures[j] = static_cast<int16_t>(distribution(rng));
+    wide_temperatures[j] = static_cast<int32_t>(distribution(rng) >> 36);
+    wide_values[j] = distribution(rng) >> 20;
+  }
+
+  const q1_15 gain = q1_15::from_double(gain_seed);
+  const q9_7 divisor = q9_7::from_double(divisor_seed);
+  const q32_32 wide_gain = q32_32::from_double(wide_gain_seed);
+  const int16_t gain_raw = gain.raw();
+  const int16_t divisor_raw = divisor.raw();
+  const int64_t wide_gain_raw = wide_gain.raw();
+
+  benchmark_pair<int16_t, int16_t>("Q9.7 * Q1.15", temperatures,
+    [=](const int16_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = static_cast<int16_t>(multshiftround<int32_t, 15>(num[j], gain_raw)); },
+    [=](const int16_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = (q9_7::from_raw(num[j]) * gain).raw(); });
+
+  benchmark_pair<int16_t, int16_t>("Q9.7 * Q1.15, saturating", temperatures,
+    [=](const int16_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = multshiftround_sat<int16_t, int16_t, 15>(num[j], gain_raw, std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::max()); },
+    [=](const int16_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = (q9_7_sat::from_raw(num[j]) * gain).raw(); });
+
+  benchmark_pair<int32_t, int16_t>("Q17.15 -> Q9.7, saturating", wide_temperatures,
+    [=](const int32_t *num, int16_t *result) {
+      for (size_t j = 0u; j < array_length; j++) {
+        int32_t value = shiftround<int32_t, 8>(num[j]);
+        saturate_value<int32_t>(value, std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::max());
+        result[j] = static_cast<int16_t>(value);
+      }
+    },
+    [=](const int32_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = fixed_cast<q9_7_sat>(q17_15::from_raw(num[j])).raw(); });
+
+  benchmark_pair<int16_t, int16_t>("Q9.7 / Q9.7", temperatures,
+    [=](const int16_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = static_cast<int16_t>(divround<int32_t>(static_cast<int32_t>(num[j]) * 128, static_cast<int32_t>(divisor_raw))); },
+    [=](const int16_t *num, int16_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = (q9_7::from_raw(num[j]) / divisor).raw(); });
+
+  benchmark_pair<int64_t, int64_t>("Q32.32 * Q32.32", wide_values,
+    [=](const int64_t *num, int64_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = multshiftround_wide<int64_t, 32>(num[j], wide_gain_raw); },
+    [=](const int64_t *num, int64_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = (q32_32::from_raw(num[j]) * wide_gain).raw(); });
+
+  benchmark_pair<int64_t, int64_t>("Q32.32 * Q32.32, saturating", wide_values,
+    [=](const int64_t *num, int64_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = multshiftround_sat<int64_t, int64_t, 32>(num[j], wide_gain_raw, std::numeric_limits<int64_t>::lowest(), std::numeric_limits<int64_t>::max()); },
+    [=](const int64_t *num, int64_t *result) { for (size_t j = 0u; j < array_length; j++) result[j] = (q32_32_sat::from_raw(num[j]) * wide_gain).raw(); });
+
+  std::printf("(ignore) %" PRIu64 "\n", sink);
+  return (mismatch_count == 0u) ? 0 : 1;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
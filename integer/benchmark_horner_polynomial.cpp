@@ -0,0 +1,285 @@
+/**
+ * benchmark_horner_polynomial.cpp
+ * Measures the throughput of
+ *     type horner_polynomial<typename type>::evaluate(const type x) const;
+ *     void horner_polynomial<typename type>::evaluate_batch(const type *x, type *result, const size_t length) const;
+ * against Horner's scheme in double precision on the same inputs, both
+ * with double results and with results rounded to type, for polynomials
+ * quantized by horner_quantize from horner_polynomial_design.hpp.
+ *
+ * Throughput is printed in millions of elements per second on one core.
+ * The coefficients are read through a volatile so that, as in a program
+ * that loads its calibration at run time, the compiler cannot fold them
+ * into the loops. The error bound of each quantized polynomial, in least
+ * significant bits of the result, is printed beside it.
+ *
+ * As always, run this on the target hardware if performance is important.
+ * Targets without a floating point unit will favor the integer forms by
+ * far more than a desktop processor does.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <cmath>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "horner_polynomial.hpp"
+#include "horner_polynomial_design.hpp"
+
+/**
+ * Each measurement repeats its operation until at least this many
+ * elements have been processed.
+ */
+const uint64_t elements_per_measurement = 1ull << 25;
+const size_t array_length = 4096u;
+
+/**
+ * Accumulates a value from every result array so that the compiler cannot
+ * discard the benchmarked work.
+ */
+uint64_t sink = 0u;
+double double_sink = 0.0;
+
+/* Scales every coefficient, so that they are only known at run time. */
+volatile double coefficient_scale = 1.0;
+
+/**
+ * Returns millions of elements processed per second.
+ */
+double mega_elements_per_second(const uint64_t elements, const std::chrono::high_resolution_clock::time_point start, const std::chrono::high_resolution_clock::time_point end) {
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  return static_cast<double>(elements) / seconds * 1.0e-6;
+}
+
+/**
+ * Benchmarks every form for one polynomial over an array of pseudorandom
+ * x on [x_min, x_max].
+ */
+template <typename type> void benchmark_polynomial(const char *description, const std::vector<double> &real_coefficients, const int64_t x_min, const int64_t x_max, std::mt19937_64 &rng) {
+  std::vector<pow2_rational> exact_coefficients;
+  std::vector<double> coefficients;
+  for (const double coefficient : real_coefficients) {
+    exact_coefficients.push_back(pow2_rational(coefficient));
+    coefficients.push_back(coefficient * coefficient_scale);
+  }
+  const horner_design<type> design = horner_quantize<type>(exact_coefficients, pow2_int(x_min), pow2_int(x_max));
+  if (!design.found) {
+    std::printf("%-28s not quantized\n", description);
+    return;
+  }
+  const horner_polynomial<type> polynomial = design.polynomial();
+
+  std::uniform_int_distribution<int64_t> distribution(x_min, x_max);
+  std::vector<type> x(array_length);
+  std::vector<type> result(array_length);
+  std::vector<double> double_result(array_length);
+  for (type &value : x) value = static_cast<type>(distribution(rng));
+  const uint64_t repetitions = elements_per_measurement / array_length;
+  const uint64_t elements = repetitions * array_length;
+  const size_t degree = coefficients.size() - 1u;
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < array_length; j++) {
+      const double value = static_cast<double>(x[j]);
+      double acc = coefficients[degree];
+      for (size_t k = degree; k-- > 0u;) acc = acc * value + coefficients[k];
+      double_result[j] = acc;
+    }
+    double_sink += double_result[rep % array_length];
+  }
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+  const double plain_double = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < array_length; j++) {
+      const double value = static_cast<double>(x[j]);
+      double acc = coefficients[degree];
+      for (size_t k = degree; k-- > 0u;) acc = acc * value + coefficients[k];
+      result[j] = static_cast<type>(std::llround(acc));
+    }
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double rounded_double = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < array_length; j++) result[j] = polynomial(x[j]);
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double evaluate = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    polynomial.evaluate_batch(x.data(), result.data(), array_length);
+    sink += static_cast<uint64_t>(result[rep % array_length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double evaluate_batch = mega_elements_per_second(elements, start, end);
+
+  std::printf("%-28s %8.3f %10.1f %12.1f %10.1f %10.1f %7.2fx\n", description, static_cast<double>(design.worst_error), plain_double, rounded_double, evaluate, evaluate_batch, evaluate_batch / rounded_double);
+}
+
+int main() {
+  std::printf("Melem/s                      bound/LSB     double double+round   evaluate      batch  speedup\n");
+  std::mt19937_64 rng(0x4D0E7B3Eull);
+
+  /* Hundredths of a degree Celsius from 12-bit ADC counts. */
+  const std::vector<double> calibration = {-4012.5, 4.71875, -1.3701e-3, 2.2105e-7};
+  benchmark_polynomial<int32_t>("int32_t cubic, 12-bit x", calibration, 0, 4095, rng);
+  benchmark_polynomial<int64_t>("int64_t cubic, 12-bit x", calibration, 0, 4095, rng);
+
+  /* A gain and offset correction with a small square term. */
+  const std::vector<double> quadratic = {-1.5, 0.98046875, 2.4e-4};
+  benchmark_polynomial<int16_t>("int16_t quadratic, 8-bit x", quadratic, 0, 255, rng);
+  benchmark_polynomial<int32_t>("int32_t quadratic, 8-bit x", quadratic, 0, 255, rng);
+
+  /* A fifth order curve fit over 16-bit inputs. */
+  const std::vector<double> quintic = {150.0, 0.75, -2.5e-5, 3.1e-10, -1.7e-15, 4.0e-21};
+  benchmark_polynomial<int32_t>("int32_t quintic, 16-bit x", quintic, 0, 65535, rng);
+  benchmark_polynomial<int64_t>("int64_t quintic, 16-bit x", quintic, 0, 65535, rng);
+
+  /* A cubic over 32-bit inputs. */
+  const std::vector<double> wide = {1.0e6, 0.5, 3.0e-11, -2.0e-21};
+  benchmark_polynomial<int64_t>("int64_t cubic, 32-bit x", wide, -2147483647ll, 2147483647ll, rng);
+
+  std::printf("(ignore) %" PRIu64 " %g\n", sink, double_sink);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,416 @@
+/**
+ * benchmark_intmath.cpp
+ * Measures the latency and throughput of the scalar kernels
+ *     saturate_value   C saturate_value_X and C++ saturate_value<type>
+ *     divround         C divround_X and C++ divround<type>
+ *     shiftround       _run: C shiftround_X and C++ shiftround<type>(num, shift)
+ *                      _comp: C shiftround_X_3 and C++ shiftround<type, 3>(num)
+ *     multshiftround   _run: C multshiftround_X and C++ multshiftround<type>(num, mul, shift)
+ *                      _comp: C multshiftround_X_3 and C++ multshiftround<type, 3>(num, mul)
+ * for int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, and
+ * uint64_t, and prints one machine-readable row per measurement.
+ *
+ * Each kernel is measured two ways:
+ *   latency     a dependent chain, where the low bit of each result is
+ *               mixed into the next argument, so every call waits for the
+ *               one before it.
+ *   throughput  an independent stream over an array of arguments, which
+ *               the compiler may unroll or vectorize as it would in real
+ *               code.
+ * Both are reported in nanoseconds per call and millions of calls per
+ * second.
+ *
+ * The mask mode of the _run kernels is chosen at compile time, so the
+ * makefiles build this file twice:
+ *   benchmark_intmath_array_masks     -DARRAY_MASKS, linked against _run
+ *                                     objects built with ARRAY_MASKS
+ *   benchmark_intmath_computed_masks  -DCOMPUTED_MASKS, linked against _run
+ *                                     objects built with COMPUTED_MASKS
+ * and the masks column of every row says which one produced it. The
+ * benchmark target in makefile-unix and makefile-nmake runs both and
+ * writes benchmark_intmath.csv. The C objects are built with the same
+ * link-time optimization as the rest of the makefile, so the C kernels
+ * may be inlined just as the C++ templates are. The shift, mul, divisor,
+ * and bounds are read from volatiles so that they are not constants in
+ * the _run kernels; the _comp kernels use a shift of 3, the same as the
+ * runtime shift, to show what a compile-time shift gains.
+ *
+ * Usage: benchmark_intmath [--csv | --json] [--no-header] [--calls N]
+ *   --csv        comma separated values with a header row (default)
+ *   --json       a JSON array of objects with the same fields
+ *   --no-header  omit the CSV header row, for appending to an existing file
+ *   --calls N    calls per measurement (default 4194304)
+ *
+ * As always, run this on the target hardware if performance is important.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "run_masks_type.h"
+#include "saturate_value.hpp"
+#include "divround.hpp"
+#include "shiftround_run.hpp"
+#include "shiftround_comp.hpp"
+#include "multshiftround_run.hpp"
+#include "multshiftround_comp.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "saturate_value.h"
+    #include "divround.h"
+    #include "shiftround_run.h"
+    #include "shiftround_comp.h"
+    #include "multshiftround_run.h"
+    #include "multshiftround_comp.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Overloads that forward to the C functions so that the generic benchmark
+ * routines below can call them.
+ */
+void c_saturate_value(int8_t   *value, const int8_t   lower_bound, const int8_t   upper_bound) { saturate_value_i8(value, lower_bound, upper_bound); }
+void c_saturate_value(int16_t  *value, const int16_t  lower_bound, const int16_t  upper_bound) { saturate_value_i16(value, lower_bound, upper_bound); }
+void c_saturate_value(int32_t  *value, const int32_t  lower_bound, const int32_t  upper_bound) { saturate_value_i32(value, lower_bound, upper_bound); }
+void c_saturate_value(int64_t  *value, const int64_t  lower_bound, const int64_t  upper_bound) { saturate_value_i64(value, lower_bound, upper_bound); }
+void c_saturate_value(uint8_t  *value, const uint8_t  lower_bound, const uint8_t  upper_bound) { saturate_value_u8(value, lower_bound, upper_bound); }
+void c_saturate_value(uint16_t *value, const uint16_t lower_bound, const uint16_t upper_bound) { saturate_value_u16(value, lower_bound, upper_bound); }
+void c_saturate_value(uint32_t *value, const uint32_t lower_bound, const uint32_t upper_bound) { saturate_value_u32(value, lower_bound, upper_bound); }
+void c_saturate_value(uint64_t *value, const uint64_t lower_bound, const uint64_t upper_bound) { saturate_value_u64(value, lower_bound, upper_bound); }
+
+int8_t   c_divround(const int8_t   dividend, const int8_t   divisor) { return divround_i8(dividend, divisor); }
+int16_t  c_divround(const int16_t  dividend, const int16_t  divisor) { return divround_i16(dividend, divisor); }
+int32_t  c_divround(const int32_t  dividend, const int32_t  divisor) { return divround_i32(dividend, divisor); }
+int64_t  c_divround(const int64_t  dividend, const int64_t  divisor) { return divround_i64(dividend, divisor); }
+uint8_t  c_divround(const uint8_t  dividend, const uint8_t  divisor) { return divround_u8(dividend, divisor); }
+uint16_t c_divround(const uint16_t dividend, const uint16_t divisor) { return divround_u16(dividend, divisor); }
+uint32_t c_divround(const uint32_t dividend, const uint32_t divisor) { return divround_u32(dividend, divisor); }
+uint64_t c_divround(const uint64_t dividend, const uint64_t divisor) { return divround_u64(dividend, divisor); }
+
+int8_t   c_shiftround(const int8_t   num, const uint8_t shift) { return shiftround_i8(num, shift); }
+int16_t  c_shiftround(const int16_t  num, const uint8_t shift) { return shiftround_i16(num, shift); }
+int32_t  c_shiftround(const int32_t  num, const uint8_t shift) { return shiftround_i32(num, shift); }
+int64_t  c_shiftround(const int64_t  num, const uint8_t shift) { return shiftround_i64(num, shift); }
+uint8_t  c_shiftround(const uint8_t  num, const uint8_t shift) { return shiftround_u8(num, shift); }
+uint16_t c_shiftround(const uint16_t num, const uint8_t shift) { return shiftround_u16(num, shift); }
+uint32_t c_shiftround(const uint32_t num, const uint8_t shift) { return shiftround_u32(num, shift); }
+uint64_t c_shiftround(const uint64_t num, const uint8_t shift) { return shiftround_u64(num, shift); }
+
+int8_t   c_shiftround_comp(const int8_t   num) { return shiftround_i8_3(num); }
+int16_t  c_shiftround_comp(const int16_t  num) { return shiftround_i16_3(num); }
+int32_t  c_shiftround_comp(const int32_t  num) { return shiftround_i32_3(num); }
+int64_t  c_shiftround_comp(const int64_t  num) { return shiftround_i64_3(num); }
+uint8_t  c_shiftround_comp(const uint8_t  num) { return shiftround_u8_3(num); }
+uint16_t c_shiftround_comp(const uint16_t num) { return shiftround_u16_3(num); }
+uint32_t c_shiftround_comp(const uint32_t num) { return shiftround_u32_3(num); }
+uint64_t c_shiftround_comp(const uint64_t num) { return shiftround_u64_3(num); }
+
+int8_t   c_multshiftround(const int8_t   num, const int8_t   mul, const uint8_t shift) { return multshiftround_i8(num, mul, shift); }
+int16_t  c_multshiftround(const int16_t  num, const int16_t  mul, const uint8_t shift) { return multshiftround_i16(num, mul, shift); }
+int32_t  c_multshiftround(const int32_t  num, const int32_t  mul, const uint8_t shift) { return multshiftround_i32(num, mul, shift); }
+int64_t  c_multshiftround(const int64_t  num, const int64_t  mul, const uint8_t shift) { return multshiftround_i64(num, mul, shift); }
+uint8_t  c_multshiftround(const uint8_t  num, const uint8_t  mul, const uint8_t shift) { return multshiftround_u8(num, mul, shift); }
+uint16_t c_multshiftround(const uint16_t num, const uint16_t mul, const uint8_t shift) { return multshiftround_u16(num, mul, shift); }
+uint32_t c_multshiftround(const uint32_t num, const uint32_t mul, const uint8_t shift) { return multshiftround_u32(num, mul, shift); }
+uint64_t c_multshiftround(const uint64_t num, const uint64_t mul, const uint8_t shift) { return multshiftround_u64(num, mul, shift); }
+
+int8_t   c_multshiftround_comp(const int8_t   num, const int8_t   mul) { return multshiftround_i8_3(num, mul); }
+int16_t  c_multshiftround_comp(const int16_t  num, const int16_t  mul) { return multshiftround_i16_3(num, mul); }
+int32_t  c_multshiftround_comp(const int32_t  num, const int32_t  mul) { return multshiftround_i32_3(num, mul); }
+int64_t  c_multshiftround_comp(const int64_t  num, const int64_t  mul) { return multshiftround_i64_3(num, mul); }
+uint8_t  c_multshiftround_comp(const uint8_t  num, const uint8_t  mul) { return multshiftround_u8_3(num, mul); }
+uint16_t c_multshiftround_comp(const uint16_t num, const uint16_t mul) { return multshiftround_u16_3(num, mul); }
+uint32_t c_multshiftround_comp(const uint32_t num, const uint32_t mul) { return multshiftround_u32_3(num, mul); }
+uint64_t c_multshiftround_comp(const uint64_t num, const uint64_t mul) { return multshiftround_u64_3(num, mul); }
+
+#ifdef ARRAY_MASKS
+  const char *const masks_name = "array";
+#else
+  const char *const masks_name = "computed";
+#endif
+
+/* Length of the argument arrays. Must be a power of two. */
+const size_t input_length = 4096u;
+
+/* The shift used by the _comp kernels, and the default runtime shift. */
+const uint8_t comp_shift = 3u;
+
+/**
+ * Arguments hidden from the optimizer so that the _run kernels cannot be
+ * specialized on constant values.
+ */
+volatile uint8_t benchmark_shift = comp_shift;
+volatile int benchmark_mul = 5;
+volatile int benchmark_divisor = 7;
+
+/**
+ * Accumulates a value from every measurement so that the compiler cannot
+ * discard the benchmarked work.
+ */
+uint64_t sink = 0u;
+
+/**
+ * Output format and length of each measurement.
+ */
+struct benchmark_options {
+  bool json;
+  bool header;
+  uint64_t calls;
+};
+
+/* True until the first row has been printed. */
+bool first_row = true;
+
+/**
+ * Prints one measurement as a CSV row or JSON object.
+ */
+void print_row(const benchmark_options &options, const char *kernel, const char *api, const char *variant, const char *type_name, const char *mode, const double ns_per_call) {
+  const double million_calls_per_second = 1.0e3 / ns_per_call;
+  if (options.json) {
+    std::printf("%s  {\"masks\": \"%s\", \"kernel\": \"%s\", \"api\": \"%s\", \"variant\": \"%s\", \"type\": \"%s\", \"mode\": \"%s\", \"ns_per_call\": %.4f, \"million_calls_per_second\": %.2f}",
+                first_row ? "[\n" : ",\n", masks_name, kernel, api, variant, type_name, mode, ns_per_call, million_calls_per_second);
+  } else {
+    std::printf("%s,%s,%s,%s,%s,%s,%.4f,%.2f\n", masks_name, kernel, api, variant, type_name, mode, ns_per_call, million_calls_per_second);
+  }
+  first_row = false;
+}
+
+/**
+ * Returns nanoseconds per call for calls calls between start and end.
+ */
+double nanoseconds_per_call(const uint64_t calls, const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end) {
+  return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(calls);
+}
+
+/**
+ * Measures one kernel, a callable taking and returning type, as a
+ * dependent chain and as an independent stream over input.
+ */
+template <typename type, typename kernel_function> void measure(const benchmark_options &options, const char *kernel, const char *api, const char *variant, const char *type_name, const std::vector<type> &input, const kernel_function function) {
+  /* Latency: the next argument depends on the low bit of the last result. */
+  type value = static_cast<type>(0);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (uint64_t j = 0u; j < options.calls; j++) {
+    value = function(static_cast<type>(input[j & (input_length - 1u)] ^ (value & static_cast<type>(1))));
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  sink += static_cast<uint64_t>(value);
+  print_row(options, kernel, api, variant, type_name, "latency", nanoseconds_per_call(options.calls, start, end));
+
+  /* Throughput: every call is independent of the others. */
+  std::vector<type> result(input_length);
+  const uint64_t repetitions = (options.calls + input_length - 1u) / input_length;
+  start = std::chrono::steady_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < input_length; j++) result[j] = function(input[j]);
+    sink += static_cast<uint64_t>(result[rep & (input_length - 1u)]);
+  }
+  end = std::chrono::steady_clock::now();
+  print_row(options, kernel, api, variant, type_name, "throughput", nanoseconds_per_call(repetitions * input_length, start, end));
+}
+
+/**
+ * Measures every kernel for one type. The multshiftround arguments are
+ * limited to half the width of type so that num * mul cannot overflow.
+ */
+template <typename type> void benchmark_type(const benchmark_options &options, const char *type_name, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<uint64_t> distribution;
+  std::vector<type> input(input_length);
+  std::vector<type> narrow_input(input_length);
+  for (size_t j = 0u; j < input_length; j++) {
+    input[j] = static_cast<type>(distribution(rng));
+    narrow_input[j] = static_cast<type>(input[j] / static_cast<type>(static_cast<uint64_t>(1) << (4u * sizeof(type))));
+  }
+
+  const uint8_t shift = benchmark_shift;
+  const type mul = static_cast<type>(benchmark_mul);
+  const type divisor = static_cast<type>(benchmark_divisor);
+  /* About half of the arguments lie outside [lower_bound, upper_bound]. */
+  const type lower_bound = static_cast<type>(std::numeric_limits<type>::lowest() / 2 + std::numeric_limits<type>::max() / 4);
+  const type upper_bound = static_cast<type>(std::numeric_limits<type>::max() / 2 + std::numeric_limits<type>::max() / 4);
+
+  measure<type>(options, "saturate_value", "c", "run", type_name, input, [=](type value) { c_saturate_value(&value, lower_bound, upper_bound); return value; });
+  measure<type>(options, "saturate_value", "cpp", "run", type_name, input, [=](type value) { saturate_value<type>(value, lower_bound, upper_bound); return value; });
+  measure<type>(options, "divround", "c", "run", type_name, input, [=](const type dividend) { return c_divround(dividend, divisor); });
+  measure<type>(options, "divround", "cpp", "run", type_name, input, [=](const type dividend) { return divround<type>(dividend, divisor); });
+  measure<type>(options, "shiftround", "c", "run", type_name, input, [=](const type num) { return c_shiftround(num, shift); });
+  measure<type>(options, "shiftround", "cpp", "run", type_name, input, [=](const type num) { return shiftround<type>(num, shift); });
+  measure<type>(options, "shiftround", "c", "comp", type_name, input, [=](const type num) { return c_shiftround_comp(num); });
+  measure<type>(options, "shiftround", "cpp", "comp", type_name, input, [=](const type num) { return shiftround<type, comp_shift>(num); });
+  measure<type>(options, "multshiftround", "c", "run", type_name, narrow_input, [=](const type num) { return c_multshiftround(num, mul, shift); });
+  measure<type>(options, "multshiftround", "cpp", "run", type_name, narrow_input, [=](const type num) { return multshiftround<type>(num, mul, shift); });
+  measure<type>(options, "multshiftround", "c", "comp", type_name, narrow_input, [=](const type num) { return c_multshiftround_comp(num, mul); });
+  measure<type>(options, "multshiftround", "cpp", "comp", type_name, narrow_input, [=](const type num) { return multshiftround<type, comp_shift>(num, mul); });
+}
+
+int main(int argc, char **argv) {
+  benchmark_options options = {false, true, 1ull << 22};
+  for (int arg = 1; arg < argc; arg++) {
+    if (std::strcmp(argv[arg], "--json") == 0) options.json = true;
+    else if (std::strcmp(argv[arg], "--csv") == 0) options.json = false;
+    else if (std::strcmp(argv[arg], "--no-header") == 0) options.header = false;
+    else if (std::strcmp(argv[arg], "--calls") == 0 && arg + 1 < argc && std::strtoull(argv[arg + 1], nullptr, 10) > 0u) options.calls = std::strtoull(argv[++arg], nullptr, 10);
+    else {
+      std::fprintf(stderr, "usage: %s [--csv | --json] [--no-header] [--calls N]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (!options.json && options.header) std::printf("masks,kernel,api,variant,type,mode,ns_per_call,million_calls_per_second\n");
+
+  std::mt19937_64 rng(0xBE4C4BE4C4ull);
+  benchmark_type<int8_t>(options, "int8_t", rng);
+  benchmark_type<int16_t>(options, "int16_t", rng);
+  benchmark_type<int32_t>(options, "int32_t", rng);
+  benchmark_type<int64_t>(options, "int64_t", rng);
+  benchmark_type<uint8_t>(options, "uint8_t", rng);
+  benchmark_type<uint16_t>(options, "uint16_t", rng);
+  benchmark_type<uint32_t>(options, "uint32_t", rng);
+  benchmark_type<uint64_t>(options, "uint64_t", rng);
+
+  if (options.json) std::printf("%s]\n", first_row ? "[" : "\n");
+  std::fprintf(stderr, "(ignore) %" PRIu64 "\n", sink);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,293 @@
+/**
+ * benchmark_multshiftround_shiftround_batch.cpp
+ * Measures the throughput of the array (batch) functions
+ *     void shiftround_batch<typename type>(const type *num, type *result, const size_t length, const uint8_t shift);
+ *     void multshiftround_batch<typename type>(const type *num, type *result, const size_t length, const type mul, const uint8_t shift);
+ * against a plain loop over the scalar functions
+ *     type shiftround<typename type>(const type num, const uint8_t shift);
+ *     type multshiftround<typename type>(const type num, const type mul, const uint8_t shift);
+ * for every supported type.
+ *
+ * Throughput is printed in millions of elements per second for an
+ * array small enough to stay in the L1 cache and for one too large to
+ * fit in a typical L2 cache.
+ *
+ * cpu_features_limit() is used to repeat the measurements for each of
+ * the scalar, SSE2, SSE4.1, AVX2, and AVX-512 code paths that the
+ * processor supports. As always, run it on the target hardware if
+ * performance is important.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "multshiftround_run.hpp"
+#include "shiftround_run.hpp"
+#include "multshiftround_shiftround_batch.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "cpu_features.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Each measurement repeats its operation until at least this many
+ * elements have been processed.
+ */
+const uint64_t elements_per_measurement = 1ull << 27;
+
+/**
+ * Accumulates a value from every result array so that the compiler
+ * cannot discard the benchmarked work.
+ */
+uint64_t sink = 0u;
+
+/**
+ * The mul and shift arguments are read through volatiles so that the
+ * compiler cannot specialize the scalar loops on constant values.
+ */
+volatile uint8_t shift_divisor = 2u;
+volatile uint8_t mul_divisor = 3u;
+
+/**
+ * Returns millions of elements processed per second.
+ */
+double mega_elements_per_second(const uint64_t elements, const std::chrono::high_resolution_clock::time_point start, const std::chrono::high_resolution_clock::time_point end) {
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  return static_cast<double>(elements) / seconds * 1.0e-6;
+}
+
+/**
+ * Benchmarks the batch and scalar forms of shiftround and multshiftround
+ * for one type over an array of the given length.
+ */
+template <typename type> void benchmark_type(const char *type_name, const size_t length, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<uint64_t> distribution;
+  std::vector<type> num(length);
+  std::vector<type> result(length);
+  for (type &value : num) value = static_cast<type>(distribution(rng));
+  const type mul = static_cast<type>(std::numeric_limits<type>::max() / mul_divisor);
+  const uint8_t shift = static_cast<uint8_t>(std::numeric_limits<type>::digits / shift_divisor);
+  const uint64_t repetitions = elements_per_measurement / length;
+  const uint64_t elements = repetitions * length;
+
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < length; j++) result[j] = shiftround<type>(num[j], shift);
+    sink += static_cast<uint64_t>(result[rep % length]);
+  }
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+  const double scalar_shiftround = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    shiftround_batch<type>(num.data(), result.data(), length, shift);
+    sink += static_cast<uint64_t>(result[rep % length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double batch_shiftround = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    for (size_t j = 0u; j < length; j++) result[j] = multshiftround<type>(num[j], mul, shift);
+    sink += static_cast<uint64_t>(result[rep % length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double scalar_multshiftround = mega_elements_per_second(elements, start, end);
+
+  start = std::chrono::high_resolution_clock::now();
+  for (uint64_t rep = 0u; rep < repetitions; rep++) {
+    multshiftround_batch<type>(num.data(), result.data(), length, mul, shift);
+    sink += static_cast<uint64_t>(result[rep % length]);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  const double batch_multshiftround = mega_elements_per_second(elements, start, end);
+
+  std::printf("%-9s %9zu  shiftround %8.1f %8.1f %5.2fx   multshiftround %8.1f %8.1f %5.2fx\n",
+              type_name, length,
+              scalar_shiftround, batch_shiftround, batch_shiftround / scalar_shiftround,
+              scalar_multshiftround, batch_multshiftround, batch_multshiftround / scalar_multshiftround);
+}
+
+int main() {
+  struct code_path {
+    const char *name;
+    uint32_t required;
+    uint32_t mask;
+  };
+  const code_path code_paths[] = {
+    {"scalar", 0u, 0u},
+    {"SSE2", CPU_FEATURE_SSE2, CPU_FEATURE_SSE2},
+    {"SSE4.1", CPU_FEATURE_SSE4_1, CPU_FEATURE_SSE2 | CPU_FEATURE_SSE4_1},
+    {"AVX2", CPU_FEATURE_AVX2, CPU_FEATURE_SSE2 | CPU_FEATURE_SSE4_1 | CPU_FEATURE_AVX2},
+    {"AVX-512", CPU_FEATURE_AVX512, CPU_FEATURE_ALL}
+  };
+  const uint32_t supported = cpu_features();
+  std::printf("columns: type, array length, then scalar Melem/s, batch Melem/s, and speedup for each function\n");
+
+  for (const code_path &path : code_paths) {
+    if ((supported & path.required) != path.required) {
+      std::printf("\nSkipping %s code path: not supported by this processor\n", path.name);
+      continue;
+    }
+
+    cpu_features_limit(path.mask);
+    std::printf("\n%s code path\n", path.name);
+    std::mt19937_64 rng(0x5EED5EEDull);
+    const size_t lengths[] = {1024u, 1u << 22};
+    for (size_t length : lengths) {
+      benchmark_type<int8_t>("int8_t", length, rng);
+      benchmark_type<uint8_t>("uint8_t", length, rng);
+      benchmark_type<int16_t>("int16_t", length, rng);
+      benchmark_type<uint16_t>("uint16_t", length, rng);
+      benchmark_type<int32_t>("int32_t", length, rng);
+      benchmark_type<uint32_t>("uint32_t", length, rng);
+      benchmark_type<int64_t>("int64_t", length, rng);
+      benchmark_type<uint64_t>("uint64_t", length, rng);
+    }
+  }
+  cpu_features_limit(CPU_FEATURE_ALL);
+
+  std::printf("(ignore) %" PRIu64 "\n", sink);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
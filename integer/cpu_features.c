@@ -0,0 +1,264 @@
+/**
+ * cpu_features.c
+ * Defines
+ *   uint32_t cpu_features(void);
+ *   void cpu_features_limit(const uint32_t mask);
+ * which report the x86 vector instruction sets that both the processor
+ * and the operating system support. See cpu_features.h for details.
+ *
+ * AVX2 and AVX-512 are reported only when XGETBV shows that the
+ * operating system saves the YMM and ZMM registers on context switches.
+ *
+ * The cached result is written without synchronization. Concurrent
+ * first calls from several threads all compute and store the same
+ * value, so the race is benign on x86.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef CPU_FEATURES_C_
+#define CPU_FEATURES_C_
+
+#include "cpu_features.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #include <cpuid.h>
+  #define CPU_FEATURES_X86
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+  #define CPU_FEATURES_X86
+#endif
+
+/* Set once the processor has been queried. */
+static volatile uint32_t detected_valid = 0u;
+static volatile uint32_t detected_features = 0u;
+static volatile uint32_t feature_mask = CPU_FEATURE_ALL;
+
+#ifdef CPU_FEATURES_X86
+/**
+ * Stores EAX, EBX, ECX, and EDX from CPUID(leaf, subleaf) into regs[0..3].
+ */
+static inline void cpuid(const uint32_t leaf, const uint32_t subleaf, uint32_t regs[4]) {
+  #if defined(_MSC_VER)
+    int msvc_regs[4];
+    __cpuidex(msvc_regs, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)msvc_regs[0];
+    regs[1] = (uint32_t)msvc_regs[1];
+    regs[2] = (uint32_t)msvc_regs[2];
+    regs[3] = (uint32_t)msvc_regs[3];
+  #else
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+    regs[0] = eax;
+    regs[1] = ebx;
+    regs[2] = ecx;
+    regs[3] = edx;
+  #endif
+}
+
+/**
+ * Returns extended control register XCR0. Only valid when CPUID reports
+ * OSXSAVE.
+ */
+static inline uint64_t read_xcr0(void) {
+  #if defined(_MSC_VER)
+    return (uint64_t)_xgetbv(0);
+  #else
+    uint32_t eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0u));
+    return ((uint64_t)edx << 32) | eax;
+  #endif
+}
+
+/**
+ * Queries the processor and operating system.
+ */
+static inline uint32_t detect_features(void) {
+  uint32_t regs[4];
+  uint32_t features = 0u;
+  uint32_t max_leaf;
+  uint64_t xcr0 = 0u;
+  int ymm_enabled;
+  int zmm_enabled;
+
+  cpuid(0u, 0u, regs);
+  max_leaf = regs[0];
+  if (max_leaf < 1u) return 0u;
+
+  cpuid(1u, 0u, regs);
+  if (regs[3] & (1u << 26)) features |= CPU_FEATURE_SSE2;
+  if (regs[2] & (1u << 19)) features |= CPU_FEATURE_SSE4_1;
+  if (regs[2] & (1u << 27)) xcr0 = read_xcr0();
+
+  /* XCR0 bits 1 and 2: XMM and YMM state. Bits 5 to 7: opmask and ZMM state. */
+  ymm_enabled = (regs[2] & (1u << 28)) && (xcr0 & 0x06u) == 0x06u;
+  zmm_enabled = ymm_enabled && (xcr0 & 0xE0u) == 0xE0u;
+
+  if (max_leaf >= 7u) {
+    cpuid(7u, 0u, regs);
+    if (ymm_enabled && (regs[1] & (1u << 5))) features |= CPU_FEATURE_AVX2;
+    /* EBX bit 16: AVX512F, bit 17: AVX512DQ, bit 30: AVX512BW. */
+    if (zmm_enabled && (regs[1] & (1u << 16)) && (regs[1] & (1u << 17)) && (regs[1] & (1u << 30))) {
+      features |= CPU_FEATURE_AVX512;
+    }
+  }
+
+  return features;
+}
+#endif /* #ifdef CPU_FEATURES_X86 */
+
+/**
+ * Returns the CPU_FEATURE_* flags supported by the processor and the
+ * operating system, restricted by the last call to cpu_features_limit.
+ */
+INTMATH_API uint32_t cpu_features(void) {
+  if (!detected_valid) {
+    #ifdef CPU_FEATURES_X86
+      detected_features = detect_features();
+    #else
+      detected_features = 0u;
+    #endif
+    detected_valid = 1u;
+  }
+  return detected_features & feature_mask;
+}
+
+/**
+ * Restricts the features reported by cpu_features() to those in mask.
+ */
+INTMATH_API void cpu_features_limit(const uint32_t mask) {
+  feature_mask = mask;
+}
+
+#endif /* #ifndef CPU_FEATURES_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -18,13 +18,16 @@
  * end of this file. If not, see http ://creativecommons.org/publicdomain/zero/1.0/
  */
 
+#ifndef DETECT_PRODUCT_OVERFLOW_C_
+#define DETECT_PRODUCT_OVERFLOW_C_
+
 #include "detect_product_overflow.h"
 
 /**
  * Returns true if the product a * b would overflow the range
  * of a uin64_t and false otherwise.
  */
-bool detect_product_overflow_u64(const uint64_t a, const uint64_t b) {
+INTMATH_API bool detect_product_overflow_u64(const uint64_t a, const uint64_t b) {
   /**
    * a * b = 2^64 * (a_hi * b_hi) + 
    *         2^32 * (a_hi * b_lo + a_lo * b_hi) +
@@ -64,7 +67,7 @@ bool detect_product_overflow_u64(const uint64_t a, const uint64_t b) {
  * Returns a uint64_t representation of the absolute value of
  * the input argument a.
  */
-static uint64_t i64_to_u64_abs(const int64_t a) {
+static inline uint64_t i64_to_u64_abs(const int64_t a) {
   if (a == INT64_MIN) return 1ull << 63;
   if (a < 0ll) return (uint64_t)(-a);
   return (uint64_t)(a);
@@ -74,7 +77,7 @@ static uint64_t i64_to_u64_abs(const int64_t a) {
  * Returns true if the product a * b would overflow or
  * underflow the range of an in64_t and false otherwise.
  */
-bool detect_product_overflow_i64(const int64_t a, const int64_t b) {
+INTMATH_API bool detect_product_overflow_i64(const int64_t a, const int64_t b) {
   bool product_negative = ((a < 0ll) & (b > 0ll)) | ((a > 0ll) & (b < 0ll));
   uint64_t a_abs = i64_to_u64_abs(a);
   uint64_t b_abs = i64_to_u64_abs(b);
@@ -107,19 +110,29 @@ bool detect_product_overflow_i64(const int64_t a, const int64_t b) {
   /* Now we know that mid_prod_1 + mid_prod_2 <= UINT64_MAX. */
   uint64_t mid_prod = mid_prod_1 + mid_prod_2;
 
+  /**
+   * a_lo * b_lo alone may exceed the limit (e.g. 3037000500 * 3037000500),
+   * so it is checked before the subtraction that would wrap.
+   */
+  uint64_t lo_prod = a_lo * b_lo;
+
   if (product_negative) {
     if (mid_prod > (1ull << 31)) return true;
-    /* Now we know that 2^32 * mid_prod <= 2^63. */
-    if ((1ull << 63) - a_lo * b_lo < mid_prod << 32) return true;
+    if (lo_prod > (1ull << 63)) return true;
+    /* Now we know that 2^32 * mid_prod <= 2^63 and a_lo * b_lo <= 2^63. */
+    if ((1ull << 63) - lo_prod < mid_prod << 32) return true;
   } else {
     if (mid_prod >= (1ull << 31)) return true;
-    /* Now we know that 2^32 * mid_prod < INT64_MAX. */
-    if ((uint64_t)INT64_MAX - a_lo * b_lo < mid_prod << 32) return true;
+    if (lo_prod > (uint64_t)INT64_MAX) return true;
+    /* Now we know that 2^32 * mid_prod < INT64_MAX and a_lo * b_lo <= INT64_MAX. */
+    if ((uint64_t)INT64_MAX - lo_prod < mid_prod << 32) return true;
   }
   
   return false;
 }
 
+#endif /* #ifndef DETECT_PRODUCT_OVERFLOW_C_ */
+
 /*
 Creative Commons Legal Code
 
@@ -21,19 +21,24 @@
 #define DETECT_PRODUCT_OVERFLOW_H_
 
 #include "inttypes.h"
+#include "intmath_inline.h"
 #include "stdbool.h"
 
 /**
  * Returns true if the product a * b would overflow the range
  * of a uin64_t and false otherwise.
  */
-bool detect_product_overflow_u64(const uint64_t a, const uint64_t b);
+INTMATH_API bool detect_product_overflow_u64(const uint64_t a, const uint64_t b);
 
 /**
  * Returns true if the product a * b would overflow or
  * underflow the range of an in64_t and false otherwise.
  */
-bool detect_product_overflow_i64(const int64_t a, const int64_t b);
+INTMATH_API bool detect_product_overflow_i64(const int64_t a, const int64_t b);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "detect_product_overflow.c"
+#endif
 
 #endif /* #ifndef DETECT_PRODUCT_OVERFLOW_H_ */
 
@@ -27,6 +27,10 @@
  * overflow will be enabled. This requires the availability of stderr and
  * fprintf() on the target system and is most appropriate for testing purposes.
  * 
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -37,10 +41,15 @@
  * end of this file. If not, see http ://creativecommons.org/publicdomain/zero/1.0/
  */
 
+#ifndef DIVROUND_C_
+#define DIVROUND_C_
+
 #include "divround.h"
 
 #ifdef DEBUG_INTMATH
   #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
 #endif
 
 /********************************************************************************
@@ -51,13 +60,19 @@
  * Returns ROUND(dividend / divisor). divisor must never be 0.
  * divisor must not be -1 when dividend is -128 (-2^7).
  */
-int8_t divround_i8(const int8_t dividend, const int8_t divisor) {
+INTMATH_API int8_t divround_i8(const int8_t dividend, const int8_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == (int8_t)0)
       fprintf(stderr, "ERROR: divround_i8(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
     
     if (dividend == INT8_MIN && divisor == (int8_t)-1)
       fprintf(stderr, "ERROR: divround_i8(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i8", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i8", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == (int8_t)0) return dividend;
@@ -88,10 +103,13 @@ int8_t divround_i8(const int8_t dividend, const int8_t divisor) {
 }
 
 /* Returns ROUND(dividend / divisor). divisor must not be 0. */
-uint8_t divround_u8(const uint8_t dividend, const uint8_t divisor) {
+INTMATH_API uint8_t divround_u8(const uint8_t dividend, const uint8_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == (uint8_t)0)
       fprintf(stderr, "ERROR: divround_u8(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u8", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == (uint8_t)0) return dividend;
@@ -113,13 +131,19 @@ uint8_t divround_u8(const uint8_t dividend, const uint8_t divisor) {
  * Returns ROUND(dividend / divisor). divisor must never be 0.
  * divisor must not be -1 when dividend is -32768 (-2^15).
  */
-int16_t divround_i16(const int16_t dividend, const int16_t divisor) {
+INTMATH_API int16_t divround_i16(const int16_t dividend, const int16_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == (int16_t)0)
       fprintf(stderr, "ERROR: divround_i16(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
     
     if (dividend == INT16_MIN && divisor == (int16_t)-1)
       fprintf(stderr, "ERROR: divround_i16(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i16", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i16", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == (int16_t)0) return dividend;
@@ -150,10 +174,13 @@ int16_t divround_i16(const int16_t dividend, const int16_t divisor) {
 }
 
 /* Returns ROUND(dividend / divisor). divisor must not be 0. */
-uint16_t divround_u16(const uint16_t dividend, const uint16_t divisor) {
+INTMATH_API uint16_t divround_u16(const uint16_t dividend, const uint16_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == (uint16_t)0)
       fprintf(stderr, "ERROR: divround_u16(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u16", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == (uint16_t)0) return dividend;
@@ -175,13 +202,19 @@ uint16_t divround_u16(const uint16_t dividend, const uint16_t divisor) {
  * Returns ROUND(dividend / divisor). divisor must never be 0.
  * divisor must not be -1 when dividend is -2147483648 (-2^31).
  */
-int32_t divround_i32(const int32_t dividend, const int32_t divisor) {
+INTMATH_API int32_t divround_i32(const int32_t dividend, const int32_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == 0)
       fprintf(stderr, "ERROR: divround_i32(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
     
     if (dividend == INT32_MIN && divisor == -1)
       fprintf(stderr, "ERROR: divround_i32(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i32", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i32", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == 0) return dividend;
@@ -212,10 +245,13 @@ int32_t divround_i32(const int32_t dividend, const int32_t divisor) {
 }
 
 /* Returns ROUND(dividend / divisor). divisor must not be 0. */
-uint32_t divround_u32(const uint32_t dividend, const uint32_t divisor) {
+INTMATH_API uint32_t divround_u32(const uint32_t dividend, const uint32_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == 0u)
       fprintf(stderr, "ERROR: divround_u32(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0u)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u32", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == 0u) return dividend;
@@ -237,13 +273,19 @@ uint32_t divround_u32(const uint32_t dividend, const uint32_t divisor) {
  * Returns ROUND(dividend / divisor). divisor must never be 0.
  * divisor must not be -1 when dividend is -9223372036854775808 (-2^63).
  */
-int64_t divround_i64(const int64_t dividend, const int64_t divisor) {
+INTMATH_API int64_t divround_i64(const int64_t dividend, const int64_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == 0ll)
       fprintf(stderr, "ERROR: divround_i64(%" PRIi64 ", %" PRIi64 ") divisor argument must not be 0.\n", dividend, divisor);
     
     if (dividend == INT64_MIN && divisor == -1ll)
       fprintf(stderr, "ERROR: divround_i64(%" PRIi64 ", %" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", dividend, divisor, INT64_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ll)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i64", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i64", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == 0ll) return dividend;
@@ -274,10 +316,13 @@ int64_t divround_i64(const int64_t dividend, const int64_t divisor) {
 }
 
 /* Returns ROUND(dividend / divisor). divisor must not be 0. */
-uint64_t divround_u64(const uint64_t dividend, const uint64_t divisor) {
+INTMATH_API uint64_t divround_u64(const uint64_t dividend, const uint64_t divisor) {
   #ifdef DEBUG_INTMATH
     if (divisor == 0ull)
       fprintf(stderr, "ERROR: divround_u64(%" PRIu64 ", %" PRIu64 ") divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u64", (uint64_t)dividend, (uint64_t)divisor, 0u);
   #endif
 
   if (divisor == 0ull) return dividend;
@@ -291,6 +336,8 @@ uint64_t divround_u64(const uint64_t dividend, const uint64_t divisor) {
   return quotient;
 }
 
+#endif /* #ifndef DIVROUND_C_ */
+
 /*
 Creative Commons Legal Code
 
@@ -35,34 +35,39 @@
 #define DIVROUND_H_
 
 #include "inttypes.h"
+#include "intmath_inline.h"
 
 /********************************************************************************
  ********                  int8_t and uint8_t functions                  ********
  ********************************************************************************/
 
-int8_t divround_i8(const int8_t dividend, const int8_t divisor);
-uint8_t divround_u8(const uint8_t dividend, const uint8_t divisor);
+INTMATH_API int8_t divround_i8(const int8_t dividend, const int8_t divisor);
+INTMATH_API uint8_t divround_u8(const uint8_t dividend, const uint8_t divisor);
 
 /********************************************************************************
  ********                 int16_t and uint16_t functions                 ********
  ********************************************************************************/
 
-int16_t divround_i16(const int16_t dividend, const int16_t divisor);
-uint16_t divround_u16(const uint16_t dividend, const uint16_t divisor);
+INTMATH_API int16_t divround_i16(const int16_t dividend, const int16_t divisor);
+INTMATH_API uint16_t divround_u16(const uint16_t dividend, const uint16_t divisor);
 
 /********************************************************************************
  ********                 int32_t and uint32_t functions                 ********
  ********************************************************************************/
 
-int32_t divround_i32(const int32_t dividend, const int32_t divisor);
-uint32_t divround_u32(const uint32_t dividend, const uint32_t divisor);
+INTMATH_API int32_t divround_i32(const int32_t dividend, const int32_t divisor);
+INTMATH_API uint32_t divround_u32(const uint32_t dividend, const uint32_t divisor);
 
 /********************************************************************************
  ********                 int64_t and uint64_t functions                 ********
  ********************************************************************************/
 
-int64_t divround_i64(const int64_t dividend, const int64_t divisor);
-uint64_t divround_u64(const uint64_t dividend, const uint64_t divisor);
+INTMATH_API int64_t divround_i64(const int64_t dividend, const int64_t divisor);
+INTMATH_API uint64_t divround_u64(const uint64_t dividend, const uint64_t divisor);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "divround.c"
+#endif
 
 #endif /* #ifndef DIVROUND_H_ */
 
@@ -4,6 +4,9 @@
  *     type divround<typename type>(const type dividend, const type divisor);
  * which returns the value ROUND(dividend / divisor).
  *
+ * divround<type, rounding>(dividend, divisor) rounds as selected by one of
+ * the tags in rounding_policy.hpp instead, e.g. round_floor.
+ *
  * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
  * uint64_t, or any type equivalent to these.
  *
@@ -27,6 +30,10 @@
  * overflow will be enabled. This requires the availability of stderr and
  * fprintf() on the target system and is most appropriate for testing purposes.
  *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -41,9 +48,19 @@
 
 #include <cinttypes>
 #include <limits>
+#include "rounding_policy.hpp"
 
 #ifdef DEBUG_INTMATH
   #include <cstdio>
+#elif defined(DIAGNOSE_INTMATH)
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
 #endif
 
 /* Allows static_assert message in divround primary template to compile. */
@@ -72,6 +89,12 @@ template <> inline int8_t divround<int8_t>(const int8_t dividend, const int8_t d
     
     if (dividend == std::numeric_limits<int8_t>::min() && divisor == static_cast<int8_t>(-1))
       std::fprintf(stderr, "ERROR: divround<int8_t>(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, std::numeric_limits<int8_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == static_cast<int8_t>(0))
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<int8_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
+    
+    if (dividend == std::numeric_limits<int8_t>::min() && divisor == static_cast<int8_t>(-1))
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround<int8_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == static_cast<int8_t>(0)) return dividend;
@@ -107,6 +130,9 @@ template <> inline uint8_t divround<uint8_t>(const uint8_t dividend, const uint8
   #ifdef DEBUG_INTMATH
     if (divisor == static_cast<uint8_t>(0))
       std::fprintf(stderr, "ERROR: divround<uint8_t>(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == static_cast<uint8_t>(0))
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<uint8_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == static_cast<uint8_t>(0)) return dividend;
@@ -135,6 +161,12 @@ template <> inline int16_t divround<int16_t>(const int16_t dividend, const int16
     
     if (dividend == std::numeric_limits<int16_t>::min() && divisor == static_cast<int16_t>(-1))
       std::fprintf(stderr, "ERROR: divround<int16_t>(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, std::numeric_limits<int16_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == static_cast<int16_t>(0))
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<int16_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
+    
+    if (dividend == std::numeric_limits<int16_t>::min() && divisor == static_cast<int16_t>(-1))
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround<int16_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == static_cast<int16_t>(0)) return dividend;
@@ -170,6 +202,9 @@ template <> inline uint16_t divround<uint16_t>(const uint16_t dividend, const ui
   #ifdef DEBUG_INTMATH
     if (divisor == static_cast<uint16_t>(0))
       std::fprintf(stderr, "ERROR: divround<uint16_t>(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == static_cast<uint16_t>(0))
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<uint16_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == static_cast<uint16_t>(0)) return dividend;
@@ -198,6 +233,12 @@ template <> inline int32_t divround<int32_t>(const int32_t dividend, const int32
     
     if (dividend == std::numeric_limits<int32_t>::min() && divisor == -1)
       std::fprintf(stderr, "ERROR: divround<int32_t>(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, std::numeric_limits<int32_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<int32_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
+    
+    if (dividend == std::numeric_limits<int32_t>::min() && divisor == -1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround<int32_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == 0) return dividend;
@@ -233,6 +274,9 @@ template <> inline uint32_t divround<uint32_t>(const uint32_t dividend, const ui
   #ifdef DEBUG_INTMATH
     if (divisor == 0)
       std::fprintf(stderr, "ERROR: divround<uint32_t>(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<uint32_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == 0) return dividend;
@@ -261,6 +305,12 @@ template <> inline int64_t divround<int64_t>(const int64_t dividend, const int64
     
     if (dividend == std::numeric_limits<int64_t>::min() && divisor == -1ll)
       std::fprintf(stderr, "ERROR: divround<int64_t>(%" PRIi64 ", %" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", dividend, divisor, std::numeric_limits<int64_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ll)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<int64_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
+    
+    if (dividend == std::numeric_limits<int64_t>::min() && divisor == -1ll)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround<int64_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == 0ll) return dividend;
@@ -296,6 +346,9 @@ template <> inline uint64_t divround<uint64_t>(const uint64_t dividend, const ui
   #ifdef DEBUG_INTMATH
     if (divisor == 0ull)
       std::fprintf(stderr, "ERROR: divround<uint64_t>(%" PRIu64 ", %" PRIu64 ") divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround<uint64_t>", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
   #endif
 
   if (divisor == 0ull) return dividend;
@@ -309,6 +362,53 @@ template <> inline uint64_t divround<uint64_t>(const uint64_t dividend, const ui
   return quotient;
 }
 
+/********************************************************************************
+ ********                   rounding policy overloads                    ********
+ ********************************************************************************/
+
+/* round_half_away is the divround<type> specialization above. */
+template <typename type> inline type divround_policy(const type dividend, const type divisor, round_half_away) {
+  return divround<type>(dividend, divisor);
+}
+
+/**
+ * Checks and protects divisor as the divround<type> specializations do and
+ * applies the rounding step from rounding_policy.hpp.
+ */
+template <typename type, typename rounding> inline type divround_policy(const type dividend, const type divisor, rounding) {
+  #ifdef DEBUG_INTMATH
+    char dividend_text[24];
+    char divisor_text[24];
+    if (divisor == static_cast<type>(0))
+      std::fprintf(stderr, "ERROR: %s(%s, %s) divisor argument must not be 0.\n", rounding_policy_name<ROUNDING_POLICY_DIVROUND, type, rounding>(), rounding_policy_text<type>(dividend, dividend_text), rounding_policy_text<type>(divisor, divisor_text));
+
+    if (std::is_signed<type>::value && dividend == std::numeric_limits<type>::lowest() && divisor == static_cast<type>(-1))
+      std::fprintf(stderr, "ERROR: %s(%s, %s) divisor must not be -1 when dividend is %s.\n", rounding_policy_name<ROUNDING_POLICY_DIVROUND, type, rounding>(), rounding_policy_text<type>(dividend, dividend_text), rounding_policy_text<type>(divisor, divisor_text), dividend_text);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == static_cast<type>(0))
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, rounding_policy_name<ROUNDING_POLICY_DIVROUND, type, rounding>(), static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
+
+    if (std::is_signed<type>::value && dividend == std::numeric_limits<type>::lowest() && divisor == static_cast<type>(-1))
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, rounding_policy_name<ROUNDING_POLICY_DIVROUND, type, rounding>(), static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), 0u);
+  #endif
+
+  if (divisor == static_cast<type>(0)) return dividend;
+  if (std::is_signed<type>::value && dividend == std::numeric_limits<type>::lowest() && divisor == static_cast<type>(-1))
+    return std::numeric_limits<type>::max();
+
+  return rounding_policy_divide<type>(dividend, divisor, rounding());
+}
+
+/**
+ * Returns dividend / divisor rounded as selected by rounding, one of the
+ * tags in rounding_policy.hpp. divisor must not be 0, and must not be -1
+ * when dividend is the most negative value of type.
+ */
+template <typename type, typename rounding> inline type divround(const type dividend, const type divisor) {
+  static_assert(is_rounding_policy<rounding>::value, "type divround<type, rounding>(const type dividend, const type divisor); rounding must be a tag from rounding_policy.hpp.");
+  return divround_policy<type>(dividend, divisor, rounding());
+}
+
 #endif /* #ifndef DIVROUND_HPP_ */
 
 /*
@@ -0,0 +1,374 @@
+/**
+ * divround_array.c
+ * Defines functions of the form
+ *     void divround_array_X(const type *dividends, const size_t n, const type divisor, type *out);
+ * which store ROUND(dividends[j] / divisor) into out[j] for each index j on
+ * [0, n-1]. X is a type abbreviation.
+ *
+ * Divisors often come from configuration and are frequently powers of two.
+ * ROUND(n / 2^k) is exactly shiftround_X(n, k), and because divround
+ * rounds half away from zero, ROUND(n / -2^k) is exactly -shiftround_X(n, k).
+ * These functions test divisor once per call and, when it has one of these
+ * forms, process the whole array with shiftround_batch_X, which picks
+ * SSE2, AVX2, or AVX-512 at run time with cpu_features(). Every other divisor,
+ * and the few power-of-two divisors outside the shift range of
+ * shiftround_batch_X (-2^(N-1) for N-bit signed types, and -1), fall back
+ * to calling divround_X on each element. The results are therefore
+ * identical to those of divround_X.
+ *
+ * multshiftround_shiftround_batch.c, cpu_features.c, and divround.c are
+ * required.
+ *
+ * If divround.c is compiled with DEBUG_INTMATH or DIAGNOSE_INTMATH
+ * defined, 0 divisors and -2^(N-1) / -1 are reported by divround_X as usual.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef DIVROUND_ARRAY_C_
+#define DIVROUND_ARRAY_C_
+
+#include "divround_array.h"
+#include "divround.h"
+#include "multshiftround_shiftround_batch.h"
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/**
+ * Returns k if value is 2^k. Returns 8, which is not a valid shift, if
+ * value is 0 or not a power of two.
+ */
+static inline uint8_t divround_array_log2_u8(uint8_t value) {
+  uint8_t k = 0u;
+  if (value == (uint8_t)0 || (value & (uint8_t)(value - (uint8_t)1)) != (uint8_t)0) return (uint8_t)8;
+  while (value > (uint8_t)1) {
+    value = (uint8_t)(value >> 1);
+    k++;
+  }
+  return k;
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_i8(const int8_t *dividends, const size_t n, const int8_t divisor, int8_t *out) {
+  const uint8_t magnitude = (divisor < (int8_t)0) ? (uint8_t)((uint8_t)0 - (uint8_t)divisor) : (uint8_t)divisor;
+  const uint8_t shift = divround_array_log2_u8(magnitude);
+  size_t j;
+
+  /**
+   * shiftround_batch_i8 accepts shifts up to 6, so -2^7 stays on the
+   * divround_i8 path, as does -1, which needs the overflow check.
+   */
+  if (divisor == (int8_t)-1 || shift > (uint8_t)6) {
+    for (j = 0u; j < n; j++) out[j] = divround_i8(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_i8(dividends, out, n, shift);
+  if (divisor < (int8_t)0) {
+    for (j = 0u; j < n; j++) out[j] = (int8_t)-out[j];
+  }
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_u8(const uint8_t *dividends, const size_t n, const uint8_t divisor, uint8_t *out) {
+  const uint8_t shift = divround_array_log2_u8(divisor);
+  size_t j;
+
+  if (shift > (uint8_t)7) {
+    for (j = 0u; j < n; j++) out[j] = divround_u8(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_u8(dividends, out, n, shift);
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns k if value is 2^k. Returns 16, which is not a valid shift, if
+ * value is 0 or not a power of two.
+ */
+static inline uint8_t divround_array_log2_u16(uint16_t value) {
+  uint8_t k = 0u;
+  if (value == (uint16_t)0 || (value & (uint16_t)(value - (uint16_t)1)) != (uint16_t)0) return (uint8_t)16;
+  while (value > (uint16_t)1) {
+    value = (uint16_t)(value >> 1);
+    k++;
+  }
+  return k;
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_i16(const int16_t *dividends, const size_t n, const int16_t divisor, int16_t *out) {
+  const uint16_t magnitude = (divisor < (int16_t)0) ? (uint16_t)((uint16_t)0 - (uint16_t)divisor) : (uint16_t)divisor;
+  const uint8_t shift = divround_array_log2_u16(magnitude);
+  size_t j;
+
+  /**
+   * shiftround_batch_i16 accepts shifts up to 14, so -2^15 stays on the
+   * divround_i16 path, as does -1, which needs the overflow check.
+   */
+  if (divisor == (int16_t)-1 || shift > (uint8_t)14) {
+    for (j = 0u; j < n; j++) out[j] = divround_i16(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_i16(dividends, out, n, shift);
+  if (divisor < (int16_t)0) {
+    for (j = 0u; j < n; j++) out[j] = (int16_t)-out[j];
+  }
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_u16(const uint16_t *dividends, const size_t n, const uint16_t divisor, uint16_t *out) {
+  const uint8_t shift = divround_array_log2_u16(divisor);
+  size_t j;
+
+  if (shift > (uint8_t)15) {
+    for (j = 0u; j < n; j++) out[j] = divround_u16(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_u16(dividends, out, n, shift);
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns k if value is 2^k. Returns 32, which is not a valid shift, if
+ * value is 0 or not a power of two.
+ */
+static inline uint8_t divround_array_log2_u32(uint32_t value) {
+  uint8_t k = 0u;
+  if (value == (uint32_t)0 || (value & (uint32_t)(value - 1u)) != (uint32_t)0) return (uint8_t)32;
+  while (value > 1u) {
+    value = (uint32_t)(value >> 1);
+    k++;
+  }
+  return k;
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_i32(const int32_t *dividends, const size_t n, const int32_t divisor, int32_t *out) {
+  const uint32_t magnitude = (divisor < 0) ? (uint32_t)(0u - (uint32_t)divisor) : (uint32_t)divisor;
+  const uint8_t shift = divround_array_log2_u32(magnitude);
+  size_t j;
+
+  /**
+   * shiftround_batch_i32 accepts shifts up to 30, so -2^31 stays on the
+   * divround_i32 path, as does -1, which needs the overflow check.
+   */
+  if (divisor == -1 || shift > (uint8_t)30) {
+    for (j = 0u; j < n; j++) out[j] = divround_i32(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_i32(dividends, out, n, shift);
+  if (divisor < 0) {
+    for (j = 0u; j < n; j++) out[j] = -out[j];
+  }
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_u32(const uint32_t *dividends, const size_t n, const uint32_t divisor, uint32_t *out) {
+  const uint8_t shift = divround_array_log2_u32(divisor);
+  size_t j;
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < n; j++) out[j] = divround_u32(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_u32(dividends, out, n, shift);
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns k if value is 2^k. Returns 64, which is not a valid shift, if
+ * value is 0 or not a power of two.
+ */
+static inline uint8_t divround_array_log2_u64(uint64_t value) {
+  uint8_t k = 0u;
+  if (value == (uint64_t)0 || (value & (uint64_t)(value - 1ull)) != (uint64_t)0) return (uint8_t)64;
+  while (value > 1ull) {
+    value = (uint64_t)(value >> 1);
+    k++;
+  }
+  return k;
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_i64(const int64_t *dividends, const size_t n, const int64_t divisor, int64_t *out) {
+  const uint64_t magnitude = (divisor < 0ll) ? (uint64_t)(0ull - (uint64_t)divisor) : (uint64_t)divisor;
+  const uint8_t shift = divround_array_log2_u64(magnitude);
+  size_t j;
+
+  /**
+   * shiftround_batch_i64 accepts shifts up to 62, so -2^63 stays on the
+   * divround_i64 path, as does -1, which needs the overflow check.
+   */
+  if (divisor == -1ll || shift > (uint8_t)62) {
+    for (j = 0u; j < n; j++) out[j] = divround_i64(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_i64(dividends, out, n, shift);
+  if (divisor < 0ll) {
+    for (j = 0u; j < n; j++) out[j] = -out[j];
+  }
+}
+
+/* Stores ROUND(dividends[j] / divisor) into out[j] for j on [0, n-1]. */
+INTMATH_API void divround_array_u64(const uint64_t *dividends, const size_t n, const uint64_t divisor, uint64_t *out) {
+  const uint8_t shift = divround_array_log2_u64(divisor);
+  size_t j;
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < n; j++) out[j] = divround_u64(dividends[j], divisor);
+    return;
+  }
+
+  shiftround_batch_u64(dividends, out, n, shift);
+}
+
+#endif /* #ifndef DIVROUND_ARRAY_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
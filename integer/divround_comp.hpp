@@ -0,0 +1,291 @@
+/**
+ * divround_comp.hpp
+ * Specifies the templated function
+ *     type divround<typename type, type divisor>(const type dividend);
+ * which returns the value ROUND(dividend / divisor) without using the
+ * division operator. The _comp in divround_comp.hpp indicates that the
+ * divisor argument must be known at compile time.
+ *
+ * The results are identical to those of divround<type>(dividend, divisor)
+ * in divround.hpp.
+ *
+ * An optional third template argument selects another rounding mode from
+ * rounding_policy.hpp, e.g. divround<int32_t, 10, round_half_even>(dividend).
+ * Those use the division operator on the constant divisor, which compilers
+ * already turn into a multiplication, and match divround<type, rounding>.
+ *
+ * If divisor is a power of two, or the negative of a power of two,
+ * shiftround<type, shift> from shiftround_comp.hpp is used. Otherwise, the
+ * reciprocal of divisor is computed at compile time by the constexpr
+ * constructor of divround_divisor<type> in divround_prepared.hpp, and the
+ * division becomes a multiplication, a few shifts, and a rounding test on
+ * the remainder. shiftround_comp.hpp, divround_prepared.hpp, and
+ * wide_product.h are therefore required.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
+ * uint64_t, or any type equivalent to these.
+ *
+ * divisor must not be 0. This is checked at compile time.
+ *
+ * For signed types, the most negative number must not be divided by -1.
+ * Explicitly, the following must be avoided:
+ * int8_t:  divround<int8_t, -1>(-128)                    or   -2^7 / -1
+ * int16_t: divround<int16_t, -1>(-32768)                 or   -2^15 / -1
+ * int32_t: divround<int32_t, -1>(-2147483648)            or   -2^31 / -1
+ * int64_t: divround<int64_t, -1>(-9223372036854775808)   or   -2^63 / -1
+ * The most positive representable number for each type is returned in these
+ * cases.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, a check for numerical overflow will be
+ * enabled. This requires the availability of stderr and fprintf() on the
+ * target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef DIVROUND_COMP_HPP_
+#define DIVROUND_COMP_HPP_
+
+#include <cinttypes>
+#include <limits>
+#include "shiftround_comp.hpp"
+#include "divround_prepared.hpp"
+
+#ifdef DEBUG_INTMATH
+  #include <cstdio>
+#elif defined(DIAGNOSE_INTMATH)
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
+#endif
+
+/**
+ * Returns shift if the magnitude of divisor is 2^shift and
+ * shiftround<type, shift> is defined. Returns 0 otherwise, including for
+ * divisors of 1 and -1 and for the most negative value of a signed type.
+ */
+template <typename type> constexpr uint8_t divround_comp_shift(const type divisor) {
+  typedef typename divround_divisor_traits<type>::utype utype;
+  const utype magnitude = divround_divisor_traits<type>::is_negative(divisor) ? static_cast<utype>(static_cast<utype>(0) - static_cast<utype>(divisor)) : static_cast<utype>(divisor);
+  if (magnitude < static_cast<utype>(2) || (magnitude & static_cast<utype>(magnitude - static_cast<utype>(1))) != static_cast<utype>(0)) return 0u;
+
+  uint8_t shift = 0u;
+  while ((static_cast<utype>(1) << shift) != magnitude) shift++;
+
+  /* shiftround<type, shift> for signed types stops at two less than the word length. */
+  if (shift >= std::numeric_limits<type>::digits) return 0u;
+  return shift;
+}
+
+/**
+ * divround_comp_impl<type, divisor, shift>::apply(dividend) returns
+ * ROUND(dividend / divisor). This primary template handles divisors whose
+ * magnitude is 2^shift with shift > 0.
+ */
+template <typename type, type divisor, uint8_t shift = divround_comp_shift<type>(divisor)> struct divround_comp_impl {
+  static type apply(const type dividend) {
+    const type rounded = shiftround<type, shift>(dividend);
+    if (divround_divisor_traits<type>::is_negative(divisor)) return static_cast<type>(static_cast<type>(0) - rounded);
+    return rounded;
+  }
+};
+
+/**
+ * This partial specialization handles divisors of 1 and -1 and divisors
+ * that are not powers of two.
+ */
+template <typename type, type divisor> struct divround_comp_impl<type, divisor, 0u> {
+  static type apply(const type dividend) {
+    if (divisor == static_cast<type>(1)) return dividend;
+
+    if (std::numeric_limits<type>::is_signed && divisor == static_cast<type>(-1)) {
+      #ifdef DEBUG_INTMATH
+        if (dividend == std::numeric_limits<type>::min())
+          std::fprintf(stderr, "ERROR: divround<%s, -1>(%" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", divround_divisor_traits<type>::name(), static_cast<int64_t>(dividend), static_cast<int64_t>(std::numeric_limits<type>::min()));
+      #elif defined(DIAGNOSE_INTMATH)
+        if (dividend == std::numeric_limits<type>::min())
+          intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround<type, -1>", static_cast<uint64_t>(dividend), 0u, 0u);
+      #endif
+
+      if (dividend == std::numeric_limits<type>::min()) return std::numeric_limits<type>::max();
+      return static_cast<type>(static_cast<type>(0) - dividend);
+    }
+
+    constexpr divround_divisor<type> prepared(divisor);
+    return prepared.apply(dividend);
+  }
+};
+
+/* round_half_away is divround_comp_impl. */
+template <typename type, type divisor> inline type divround_comp_policy(const type dividend, round_half_away) {
+  return divround_comp_impl<type, divisor>::apply(dividend);
+}
+
+/**
+ * The other policies round the quotient with rounding_policy.hpp. Division
+ * by 1 or -1 is exact under every policy, so it keeps the checks and the
+ * overflow protection of divround_comp_impl.
+ */
+template <typename type, type divisor, typename rounding> inline type divround_comp_policy(const type dividend, rounding) {
+  if (divisor == static_cast<type>(1) || (std::numeric_limits<type>::is_signed && divisor == static_cast<type>(-1)))
+    return divround_comp_impl<type, divisor>::apply(dividend);
+  return rounding_policy_divide<type>(dividend, divisor, rounding());
+}
+
+/**
+ * Returns ROUND(dividend / divisor), or dividend / divisor rounded as
+ * selected by rounding, one of the tags in rounding_policy.hpp.
+ * divisor must not be 0.
+ * divisor must not be -1 when dividend is the most negative value of type.
+ */
+template <typename type, type divisor, typename rounding = round_half_away> inline type divround(const type dividend) {
+  static_assert(divisor != static_cast<type>(0), "type divround<type, divisor>(const type dividend); divisor must not be 0.");
+  static_assert(is_rounding_policy<rounding>::value, "type divround<type, divisor, rounding>(const type dividend); rounding must be a tag from rounding_policy.hpp.");
+  return divround_comp_policy<type, divisor>(dividend, rounding());
+}
+
+#endif /* #ifndef DIVROUND_COMP_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,440 @@
+/**
+ * divround_narrow.c
+ * Defines functions of the form
+ *     narrow divround_narrow_X(const wide dividend, const narrow divisor);
+ * which return ROUND(dividend / divisor) for a dividend twice as wide as
+ * the divisor and the result. X is the abbreviation of the narrow type.
+ * See divround_narrow.h for the supported pairs.
+ *
+ * Widening the divisor and calling divround_X on the wide type costs a
+ * full-width divide. For int64_t / int32_t that is a 64-bit divide, which
+ * is several times slower than a 32-bit divide on most x86 processors,
+ * and on 32-bit targets it is a library call. x86 can divide a 64-bit
+ * EDX:EAX by a 32-bit divisor with one div r32 instruction, but only when
+ * the quotient fits in 32 bits; otherwise the instruction faults.
+ *
+ * These functions work on the magnitudes of the arguments. The quotient
+ * magnitude fits in N bits exactly when the high N bits of the 2N-bit
+ * dividend magnitude are less than the divisor magnitude. That test is
+ * made first, so an out-of-range quotient saturates without dividing, and
+ * an in-range one is computed with a 2N / N divide: div r32 through
+ * inline assembly under gcc and clang, _udiv64 under MSVC 2019 and later,
+ * and plain C elsewhere. The 16 / 8 and 32 / 16 pairs use a C divide on
+ * the promoted int, which is already a narrow hardware divide. The
+ * magnitude is rounded up when the remainder is at least half the
+ * divisor, and the sign is applied last.
+ *
+ * A 0 divisor is treated as 1. A rounded quotient outside the range of
+ * the narrow type saturates to its most negative or most positive value.
+ *
+ * If you #define DEBUG_INTMATH, 0 divisors and saturated quotients will
+ * be reported. This requires the availability of stderr and fprintf() on
+ * the target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Correct operation for negative signed arguments requires that the
+ * representation of signed integers be 2's complement.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef DIVROUND_NARROW_C_
+#define DIVROUND_NARROW_C_
+
+#include "divround_narrow.h"
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1920) && (defined(_M_X64) || defined(_M_IX86))
+  #include <immintrin.h>
+#endif
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+#endif
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/* Returns ROUND(dividend / divisor), saturated to the range of int8_t. */
+INTMATH_API int8_t divround_narrow_i8(const int16_t dividend, const int8_t divisor) {
+  const int negative = (dividend < (int16_t)0) != (divisor < (int8_t)0);
+  const uint16_t abs_dividend = (dividend < (int16_t)0) ? (uint16_t)((uint16_t)0 - (uint16_t)dividend) : (uint16_t)dividend;
+  uint8_t abs_divisor = (divisor < (int8_t)0) ? (uint8_t)((uint8_t)0 - (uint8_t)divisor) : (uint8_t)divisor;
+  const uint8_t limit = negative ? (uint8_t)0x80 : (uint8_t)0x7F;
+  uint8_t quotient;
+  uint8_t remainder;
+
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int8_t)0)
+      fprintf(stderr, "ERROR: divround_narrow_i8(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_narrow_i8", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (abs_divisor == (uint8_t)0) abs_divisor = (uint8_t)1;
+
+  /* The quotient magnitude is below 2^8 exactly when this holds. */
+  if ((uint8_t)(abs_dividend >> 8) < abs_divisor) {
+    quotient = (uint8_t)(abs_dividend / abs_divisor);
+    remainder = (uint8_t)(abs_dividend % abs_divisor);
+    if (quotient <= limit) {
+      quotient = (uint8_t)(quotient + (remainder >= (uint8_t)(abs_divisor - remainder)));
+      if (quotient <= limit) return negative ? (int8_t)((uint8_t)0 - quotient) : (int8_t)quotient;
+    }
+  }
+
+  #ifdef DEBUG_INTMATH
+    fprintf(stderr, "ERROR: divround_narrow_i8(%i, %i), the rounded quotient does not fit in int8_t.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "divround_narrow_i8", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  return negative ? INT8_MIN : INT8_MAX;
+}
+
+/* Returns ROUND(dividend / divisor), saturated to the range of uint8_t. */
+INTMATH_API uint8_t divround_narrow_u8(const uint16_t dividend, const uint8_t divisor) {
+  uint8_t nonzero_divisor = divisor;
+  uint8_t quotient;
+  uint8_t remainder;
+  uint8_t round_up;
+
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint8_t)0)
+      fprintf(stderr, "ERROR: divround_narrow_u8(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_narrow_u8", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (nonzero_divisor == (uint8_t)0) nonzero_divisor = (uint8_t)1;
+
+  /* The quotient magnitude is below 2^8 exactly when this holds. */
+  if ((uint8_t)(dividend >> 8) < nonzero_divisor) {
+    quotient = (uint8_t)(dividend / nonzero_divisor);
+    remainder = (uint8_t)(dividend % nonzero_divisor);
+    round_up = (uint8_t)(remainder >= (uint8_t)(nonzero_divisor - remainder));
+    if (quotient != UINT8_MAX || round_up == (uint8_t)0) return (uint8_t)(quotient + round_up);
+  }
+
+  #ifdef DEBUG_INTMATH
+    fprintf(stderr, "ERROR: divround_narrow_u8(%u, %u), the rounded quotient does not fit in uint8_t.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "divround_narrow_u8", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  return UINT8_MAX;
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/* Returns ROUND(dividend / divisor), saturated to the range of int16_t. */
+INTMATH_API int16_t divround_narrow_i16(const int32_t dividend, const int16_t divisor) {
+  const int negative = (dividend < 0) != (divisor < (int16_t)0);
+  const uint32_t abs_dividend = (dividend < 0) ? (uint32_t)(0u - (uint32_t)dividend) : (uint32_t)dividend;
+  uint16_t abs_divisor = (divisor < (int16_t)0) ? (uint16_t)((uint16_t)0 - (uint16_t)divisor) : (uint16_t)divisor;
+  const uint16_t limit = negative ? (uint16_t)0x8000 : (uint16_t)0x7FFF;
+  uint16_t quotient;
+  uint16_t remainder;
+
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int16_t)0)
+      fprintf(stderr, "ERROR: divround_narrow_i16(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_narrow_i16", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (abs_divisor == (uint16_t)0) abs_divisor = (uint16_t)1;
+
+  /* The quotient magnitude is below 2^16 exactly when this holds. */
+  if ((uint16_t)(abs_dividend >> 16) < abs_divisor) {
+    quotient = (uint16_t)(abs_dividend / abs_divisor);
+    remainder = (uint16_t)(abs_dividend % abs_divisor);
+    if (quotient <= limit) {
+      quotient = (uint16_t)(quotient + (remainder >= (uint16_t)(abs_divisor - remainder)));
+      if (quotient <= limit) return negative ? (int16_t)((uint16_t)0 - quotient) : (int16_t)quotient;
+    }
+  }
+
+  #ifdef DEBUG_INTMATH
+    fprintf(stderr, "ERROR: divround_narrow_i16(%i, %i), the rounded quotient does not fit in int16_t.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "divround_narrow_i16", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  return negative ? INT16_MIN : INT16_MAX;
+}
+
+/* Returns ROUND(dividend / divisor), saturated to the range of uint16_t. */
+INTMATH_API uint16_t divround_narrow_u16(const uint32_t dividend, const uint16_t divisor) {
+  uint16_t nonzero_divisor = divisor;
+  uint16_t quotient;
+  uint16_t remainder;
+  uint16_t round_up;
+
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint16_t)0)
+      fprintf(stderr, "ERROR: divround_narrow_u16(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_narrow_u16", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (nonzero_divisor == (uint16_t)0) nonzero_divisor = (uint16_t)1;
+
+  /* The quotient magnitude is below 2^16 exactly when this holds. */
+  if ((uint16_t)(dividend >> 16) < nonzero_divisor) {
+    quotient = (uint16_t)(dividend / nonzero_divisor);
+    remainder = (uint16_t)(dividend % nonzero_divisor);
+    round_up = (uint16_t)(remainder >= (uint16_t)(nonzero_divisor - remainder));
+    if (quotient != UINT16_MAX || round_up == (uint16_t)0) return (uint16_t)(quotient + round_up);
+  }
+
+  #ifdef DEBUG_INTMATH
+    fprintf(stderr, "ERROR: divround_narrow_u16(%u, %u), the rounded quotient does not fit in uint16_t.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "divround_narrow_u16", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  return UINT16_MAX;
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the 32-bit quotient of dividend / divisor and stores the
+ * remainder in *remainder. dividend >> 32 must be less than divisor so
+ * that the quotient fits in 32 bits.
+ *
+ * A C compiler cannot know that the quotient fits, so dividend / divisor
+ * becomes a full 64-bit divide (or a __udivdi3 call on 32-bit x86). Where
+ * the compiler allows it, this issues x86 div r32 on EDX:EAX directly.
+ */
+static inline uint32_t divround_narrow_div_u64_u32(const uint64_t dividend, const uint32_t divisor, uint32_t *remainder) {
+  #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    uint32_t quotient;
+    uint32_t rem;
+    __asm__("divl %4" : "=a"(quotient), "=d"(rem) : "a"((uint32_t)dividend), "d"((uint32_t)(dividend >> 32)), "rm"(divisor) : "cc");
+    *remainder = rem;
+    return quotient;
+  #elif defined(_MSC_VER) && (_MSC_VER >= 1920) && (defined(_M_X64) || defined(_M_IX86))
+    return _udiv64(dividend, divisor, remainder);
+  #else
+    *remainder = (uint32_t)(dividend % divisor);
+    return (uint32_t)(dividend / divisor);
+  #endif
+}
+
+/* Returns ROUND(dividend / divisor), saturated to the range of int32_t. */
+INTMATH_API int32_t divround_narrow_i32(const int64_t dividend, const int32_t divisor) {
+  const int negative = (dividend < 0ll) != (divisor < 0);
+  const uint64_t abs_dividend = (dividend < 0ll) ? (uint64_t)(0ull - (uint64_t)dividend) : (uint64_t)dividend;
+  uint32_t abs_divisor = (divisor < 0) ? (uint32_t)(0u - (uint32_t)divisor) : (uint32_t)divisor;
+  const uint32_t limit = negative ? 0x80000000u : 0x7FFFFFFFu;
+  uint32_t quotient;
+  uint32_t remainder;
+
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0)
+      fprintf(stderr, "ERROR: divround_narrow_i32(%" PRIi64 ", %i) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_narrow_i32", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (abs_divisor == 0u) abs_divisor = 1u;
+
+  /* The quotient magnitude is below 2^32 exactly when this holds. */
+  if ((uint32_t)(abs_dividend >> 32) < abs_divisor) {
+    quotient = divround_narrow_div_u64_u32(abs_dividend, abs_divisor, &remainder);
+    if (quotient <= limit) {
+      quotient += (uint32_t)(remainder >= abs_divisor - remainder);
+      if (quotient <= limit) return negative ? (int32_t)(0u - quotient) : (int32_t)quotient;
+    }
+  }
+
+  #ifdef DEBUG_INTMATH
+    fprintf(stderr, "ERROR: divround_narrow_i32(%" PRIi64 ", %i), the rounded quotient does not fit in int32_t.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "divround_narrow_i32", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  return negative ? INT32_MIN : INT32_MAX;
+}
+
+/* Returns ROUND(dividend / divisor), saturated to the range of uint32_t. */
+INTMATH_API uint32_t divround_narrow_u32(const uint64_t dividend, const uint32_t divisor) {
+  uint32_t nonzero_divisor = divisor;
+  uint32_t quotient;
+  uint32_t remainder;
+  uint32_t round_up;
+
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0u)
+      fprintf(stderr, "ERROR: divround_narrow_u32(%" PRIu64 ", %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0u)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_narrow_u32", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (nonzero_divisor == 0u) nonzero_divisor = 1u;
+
+  /* The quotient magnitude is below 2^32 exactly when this holds. */
+  if ((uint32_t)(dividend >> 32) < nonzero_divisor) {
+    quotient = divround_narrow_div_u64_u32(dividend, nonzero_divisor, &remainder);
+    round_up = (uint32_t)(remainder >= nonzero_divisor - remainder);
+    if (quotient != UINT32_MAX || round_up == 0u) return (uint32_t)(quotient + round_up);
+  }
+
+  #ifdef DEBUG_INTMATH
+    fprintf(stderr, "ERROR: divround_narrow_u32(%" PRIu64 ", %u), the rounded quotient does not fit in uint32_t.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "divround_narrow_u32", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  return UINT32_MAX;
+}
+
+#endif /* #ifndef DIVROUND_NARROW_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
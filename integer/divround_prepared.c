@@ -0,0 +1,664 @@
+/**
+ * divround_prepared.c
+ * Defines functions of the form
+ *     divround_divisor_X divround_prepare_X(const type divisor);
+ *     type divround_prepared_X(const type dividend, const divround_divisor_X *divisor);
+ *     void divround_prepared_batch_X(const type *dividend, type *result, const size_t length, const divround_divisor_X *divisor);
+ * which return or store ROUND(dividend / divisor) for a divisor that is
+ * prepared once and reused. X is a type abbreviation.
+ *
+ * The truncated quotient of the magnitudes is found with the round-up
+ * method of Granlund and Montgomery, "Division by Invariant Integers using
+ * Multiplication", 1994, Figure 4.1. For an N-bit magnitude d with
+ * l = ceil(log2(d)),
+ *     magic  = floor(2^N * (2^l - d) / d) + 1
+ *     t      = (magic * n) >> N
+ *     q      = (t + ((n - t) >> shift1)) >> shift2
+ * where shift1 = min(l, 1) and shift2 = max(l - 1, 0). This is exact for
+ * every N-bit n and 1 <= d < 2^N and never overflows N bits.
+ *
+ * The remainder n - q * d is then compared against ceil(d / 2) to round
+ * half away from zero, which is the same test divround_X makes. Signed
+ * dividends and divisors are handled through their magnitudes, and the
+ * sign is applied last. A 0 divisor is prepared as 1 so that the dividend
+ * is returned, and -2^(N-1) / -1 saturates to the most positive value, both
+ * as in divround_X.
+ *
+ * If you #define DEBUG_INTMATH, checks for division by 0 and for numerical
+ * overflow will be enabled. This requires the availability of stderr and
+ * fprintf() on the target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef DIVROUND_PREPARED_C_
+#define DIVROUND_PREPARED_C_
+
+#include "divround_prepared.h"
+#include "wide_product.h"
+#include "stdbool.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+#endif
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_i8 and divround_prepared_batch_i8.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_i8.
+ */
+INTMATH_API divround_divisor_i8 divround_prepare_i8(const int8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int8_t)0)
+      fprintf(stderr, "ERROR: divround_prepare_i8(%i) divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_i8", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_i8 prepared;
+  uint8_t log2_ceil = 0u;
+  prepared.divisor = divisor;
+  if (divisor == (int8_t)0) prepared.abs_divisor = (uint8_t)1;
+  else if (divisor < (int8_t)0) prepared.abs_divisor = (uint8_t)((uint8_t)0 - (uint8_t)divisor);
+  else prepared.abs_divisor = (uint8_t)divisor;
+  prepared.half = (uint8_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & (uint8_t)1));
+
+  while (log2_ceil < 8u && ((uint16_t)1 << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  prepared.magic = (uint8_t)(((((uint16_t)1 << log2_ceil) - prepared.abs_divisor) << 8) / prepared.abs_divisor + (uint8_t)1);
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_i8. The result equals divround_i8(dividend, divisor).
+ */
+INTMATH_API int8_t divround_prepared_i8(const int8_t dividend, const divround_divisor_i8 *divisor) {
+  #ifdef DEBUG_INTMATH
+    if (dividend == INT8_MIN && divisor->divisor == (int8_t)-1)
+      fprintf(stderr, "ERROR: divround_prepared_i8(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor->divisor, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (dividend == INT8_MIN && divisor->divisor == (int8_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_prepared_i8", (uint64_t)dividend, (uint64_t)divisor->divisor, 0u);
+  #endif
+
+  bool negative = (dividend < (int8_t)0) != (divisor->divisor < (int8_t)0);
+  uint8_t abs_dividend = (dividend < (int8_t)0) ? (uint8_t)((uint8_t)0 - (uint8_t)dividend) : (uint8_t)dividend;
+  uint8_t t = (uint8_t)(((uint16_t)divisor->magic * abs_dividend) >> 8);
+  uint8_t quotient = (uint8_t)((t + (uint8_t)((uint8_t)(abs_dividend - t) >> divisor->shift1)) >> divisor->shift2);
+  uint8_t remainder = (uint8_t)(abs_dividend - quotient * divisor->abs_divisor);
+  quotient += (uint8_t)(remainder >= divisor->half);
+
+  if (negative) return (int8_t)(uint8_t)((uint8_t)0 - quotient);
+  if (quotient > (uint8_t)INT8_MAX) return INT8_MAX;
+  return (int8_t)quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_i8(const int8_t *dividend, int8_t *result, const size_t length, const divround_divisor_i8 *divisor) {
+  const divround_divisor_i8 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_i8(dividend[j], &prepared);
+}
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_u8 and divround_prepared_batch_u8.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_u8.
+ */
+INTMATH_API divround_divisor_u8 divround_prepare_u8(const uint8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint8_t)0)
+      fprintf(stderr, "ERROR: divround_prepare_u8(%u) divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_u8", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_u8 prepared;
+  uint8_t log2_ceil = 0u;
+  prepared.divisor = divisor;
+  prepared.abs_divisor = (divisor == (uint8_t)0) ? (uint8_t)1 : divisor;
+  prepared.half = (uint8_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & (uint8_t)1));
+
+  while (log2_ceil < 8u && ((uint16_t)1 << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  prepared.magic = (uint8_t)(((((uint16_t)1 << log2_ceil) - prepared.abs_divisor) << 8) / prepared.abs_divisor + (uint8_t)1);
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_u8. The result equals divround_u8(dividend, divisor).
+ */
+INTMATH_API uint8_t divround_prepared_u8(const uint8_t dividend, const divround_divisor_u8 *divisor) {
+  const uint8_t abs_dividend = dividend;
+  uint8_t t = (uint8_t)(((uint16_t)divisor->magic * abs_dividend) >> 8);
+  uint8_t quotient = (uint8_t)((t + (uint8_t)((uint8_t)(abs_dividend - t) >> divisor->shift1)) >> divisor->shift2);
+  uint8_t remainder = (uint8_t)(abs_dividend - quotient * divisor->abs_divisor);
+  quotient += (uint8_t)(remainder >= divisor->half);
+  return quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_u8(const uint8_t *dividend, uint8_t *result, const size_t length, const divround_divisor_u8 *divisor) {
+  const divround_divisor_u8 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_u8(dividend[j], &prepared);
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_i16 and divround_prepared_batch_i16.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_i16.
+ */
+INTMATH_API divround_divisor_i16 divround_prepare_i16(const int16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int16_t)0)
+      fprintf(stderr, "ERROR: divround_prepare_i16(%i) divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_i16", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_i16 prepared;
+  uint8_t log2_ceil = 0u;
+  prepared.divisor = divisor;
+  if (divisor == (int16_t)0) prepared.abs_divisor = (uint16_t)1;
+  else if (divisor < (int16_t)0) prepared.abs_divisor = (uint16_t)((uint16_t)0 - (uint16_t)divisor);
+  else prepared.abs_divisor = (uint16_t)divisor;
+  prepared.half = (uint16_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & (uint16_t)1));
+
+  while (log2_ceil < 16u && ((uint32_t)1 << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  prepared.magic = (uint16_t)(((((uint32_t)1 << log2_ceil) - prepared.abs_divisor) << 16) / prepared.abs_divisor + (uint16_t)1);
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_i16. The result equals divround_i16(dividend, divisor).
+ */
+INTMATH_API int16_t divround_prepared_i16(const int16_t dividend, const divround_divisor_i16 *divisor) {
+  #ifdef DEBUG_INTMATH
+    if (dividend == INT16_MIN && divisor->divisor == (int16_t)-1)
+      fprintf(stderr, "ERROR: divround_prepared_i16(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor->divisor, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (dividend == INT16_MIN && divisor->divisor == (int16_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_prepared_i16", (uint64_t)dividend, (uint64_t)divisor->divisor, 0u);
+  #endif
+
+  bool negative = (dividend < (int16_t)0) != (divisor->divisor < (int16_t)0);
+  uint16_t abs_dividend = (dividend < (int16_t)0) ? (uint16_t)((uint16_t)0 - (uint16_t)dividend) : (uint16_t)dividend;
+  uint16_t t = (uint16_t)(((uint32_t)divisor->magic * abs_dividend) >> 16);
+  uint16_t quotient = (uint16_t)((t + (uint16_t)((uint16_t)(abs_dividend - t) >> divisor->shift1)) >> divisor->shift2);
+  uint16_t remainder = (uint16_t)(abs_dividend - quotient * divisor->abs_divisor);
+  quotient += (uint16_t)(remainder >= divisor->half);
+
+  if (negative) return (int16_t)(uint16_t)((uint16_t)0 - quotient);
+  if (quotient > (uint16_t)INT16_MAX) return INT16_MAX;
+  return (int16_t)quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_i16(const int16_t *dividend, int16_t *result, const size_t length, const divround_divisor_i16 *divisor) {
+  const divround_divisor_i16 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_i16(dividend[j], &prepared);
+}
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_u16 and divround_prepared_batch_u16.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_u16.
+ */
+INTMATH_API divround_divisor_u16 divround_prepare_u16(const uint16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint16_t)0)
+      fprintf(stderr, "ERROR: divround_prepare_u16(%u) divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_u16", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_u16 prepared;
+  uint8_t log2_ceil = 0u;
+  prepared.divisor = divisor;
+  prepared.abs_divisor = (divisor == (uint16_t)0) ? (uint16_t)1 : divisor;
+  prepared.half = (uint16_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & (uint16_t)1));
+
+  while (log2_ceil < 16u && ((uint32_t)1 << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  prepared.magic = (uint16_t)(((((uint32_t)1 << log2_ceil) - prepared.abs_divisor) << 16) / prepared.abs_divisor + (uint16_t)1);
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_u16. The result equals divround_u16(dividend, divisor).
+ */
+INTMATH_API uint16_t divround_prepared_u16(const uint16_t dividend, const divround_divisor_u16 *divisor) {
+  const uint16_t abs_dividend = dividend;
+  uint16_t t = (uint16_t)(((uint32_t)divisor->magic * abs_dividend) >> 16);
+  uint16_t quotient = (uint16_t)((t + (uint16_t)((uint16_t)(abs_dividend - t) >> divisor->shift1)) >> divisor->shift2);
+  uint16_t remainder = (uint16_t)(abs_dividend - quotient * divisor->abs_divisor);
+  quotient += (uint16_t)(remainder >= divisor->half);
+  return quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_u16(const uint16_t *dividend, uint16_t *result, const size_t length, const divround_divisor_u16 *divisor) {
+  const divround_divisor_u16 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_u16(dividend[j], &prepared);
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_i32 and divround_prepared_batch_i32.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_i32.
+ */
+INTMATH_API divround_divisor_i32 divround_prepare_i32(const int32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0)
+      fprintf(stderr, "ERROR: divround_prepare_i32(%i) divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_i32", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_i32 prepared;
+  uint8_t log2_ceil = 0u;
+  prepared.divisor = divisor;
+  if (divisor == 0) prepared.abs_divisor = 1u;
+  else if (divisor < 0) prepared.abs_divisor = (uint32_t)(0u - (uint32_t)divisor);
+  else prepared.abs_divisor = (uint32_t)divisor;
+  prepared.half = (uint32_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & 1u));
+
+  while (log2_ceil < 32u && ((uint64_t)1 << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  prepared.magic = (uint32_t)(((((uint64_t)1 << log2_ceil) - prepared.abs_divisor) << 32) / prepared.abs_divisor + 1u);
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_i32. The result equals divround_i32(dividend, divisor).
+ */
+INTMATH_API int32_t divround_prepared_i32(const int32_t dividend, const divround_divisor_i32 *divisor) {
+  #ifdef DEBUG_INTMATH
+    if (dividend == INT32_MIN && divisor->divisor == -1)
+      fprintf(stderr, "ERROR: divround_prepared_i32(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor->divisor, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (dividend == INT32_MIN && divisor->divisor == -1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_prepared_i32", (uint64_t)dividend, (uint64_t)divisor->divisor, 0u);
+  #endif
+
+  bool negative = (dividend < 0) != (divisor->divisor < 0);
+  uint32_t abs_dividend = (dividend < 0) ? (uint32_t)(0u - (uint32_t)dividend) : (uint32_t)dividend;
+  uint32_t t = (uint32_t)(((uint64_t)divisor->magic * abs_dividend) >> 32);
+  uint32_t quotient = (t + ((abs_dividend - t) >> divisor->shift1)) >> divisor->shift2;
+  uint32_t remainder = abs_dividend - quotient * divisor->abs_divisor;
+  quotient += (uint32_t)(remainder >= divisor->half);
+
+  if (negative) return (int32_t)(0u - quotient);
+  if (quotient > (uint32_t)INT32_MAX) return INT32_MAX;
+  return (int32_t)quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_i32(const int32_t *dividend, int32_t *result, const size_t length, const divround_divisor_i32 *divisor) {
+  const divround_divisor_i32 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_i32(dividend[j], &prepared);
+}
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_u32 and divround_prepared_batch_u32.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_u32.
+ */
+INTMATH_API divround_divisor_u32 divround_prepare_u32(const uint32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0u)
+      fprintf(stderr, "ERROR: divround_prepare_u32(%u) divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0u)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_u32", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_u32 prepared;
+  uint8_t log2_ceil = 0u;
+  prepared.divisor = divisor;
+  prepared.abs_divisor = (divisor == 0u) ? 1u : divisor;
+  prepared.half = (uint32_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & 1u));
+
+  while (log2_ceil < 32u && ((uint64_t)1 << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  prepared.magic = (uint32_t)(((((uint64_t)1 << log2_ceil) - prepared.abs_divisor) << 32) / prepared.abs_divisor + 1u);
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_u32. The result equals divround_u32(dividend, divisor).
+ */
+INTMATH_API uint32_t divround_prepared_u32(const uint32_t dividend, const divround_divisor_u32 *divisor) {
+  const uint32_t abs_dividend = dividend;
+  uint32_t t = (uint32_t)(((uint64_t)divisor->magic * abs_dividend) >> 32);
+  uint32_t quotient = (t + ((abs_dividend - t) >> divisor->shift1)) >> divisor->shift2;
+  uint32_t remainder = abs_dividend - quotient * divisor->abs_divisor;
+  quotient += (uint32_t)(remainder >= divisor->half);
+  return quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_u32(const uint32_t *dividend, uint32_t *result, const size_t length, const divround_divisor_u32 *divisor) {
+  const divround_divisor_u32 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_u32(dividend[j], &prepared);
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_i64 and divround_prepared_batch_i64.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_i64.
+ */
+INTMATH_API divround_divisor_i64 divround_prepare_i64(const int64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ll)
+      fprintf(stderr, "ERROR: divround_prepare_i64(%" PRIi64 ") divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ll)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_i64", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_i64 prepared;
+  uint8_t log2_ceil = 0u;
+  uint64_t pow2_minus_divisor;
+  uint64_t remainder;
+  prepared.divisor = divisor;
+  if (divisor == 0ll) prepared.abs_divisor = 1ull;
+  else if (divisor < 0ll) prepared.abs_divisor = (uint64_t)(0ull - (uint64_t)divisor);
+  else prepared.abs_divisor = (uint64_t)divisor;
+  prepared.half = (uint64_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & 1ull));
+
+  while (log2_ceil < 64u && (1ull << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  pow2_minus_divisor = ((log2_ceil < 64u) ? (1ull << log2_ceil) : 0ull) - prepared.abs_divisor;
+  prepared.magic = wide_div_u128_u64(pow2_minus_divisor, 0ull, prepared.abs_divisor, &remainder) + 1ull;
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_i64. The result equals divround_i64(dividend, divisor).
+ */
+INTMATH_API int64_t divround_prepared_i64(const int64_t dividend, const divround_divisor_i64 *divisor) {
+  #ifdef DEBUG_INTMATH
+    if (dividend == INT64_MIN && divisor->divisor == -1ll)
+      fprintf(stderr, "ERROR: divround_prepared_i64(%" PRIi64 ", %" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", dividend, divisor->divisor, INT64_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (dividend == INT64_MIN && divisor->divisor == -1ll)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_prepared_i64", (uint64_t)dividend, (uint64_t)divisor->divisor, 0u);
+  #endif
+
+  bool negative = (dividend < 0ll) != (divisor->divisor < 0ll);
+  uint64_t abs_dividend = (dividend < 0ll) ? (uint64_t)(0ull - (uint64_t)dividend) : (uint64_t)dividend;
+  uint64_t t = wide_mulhi_u64(divisor->magic, abs_dividend);
+  uint64_t quotient = (t + ((abs_dividend - t) >> divisor->shift1)) >> divisor->shift2;
+  uint64_t remainder = abs_dividend - quotient * divisor->abs_divisor;
+  quotient += (uint64_t)(remainder >= divisor->half);
+
+  if (negative) return (int64_t)(0ull - quotient);
+  if (quotient > (uint64_t)INT64_MAX) return INT64_MAX;
+  return (int64_t)quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_i64(const int64_t *dividend, int64_t *result, const size_t length, const divround_divisor_i64 *divisor) {
+  const divround_divisor_i64 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_i64(dividend[j], &prepared);
+}
+/**
+ * Returns the precomputed reciprocal of divisor for use with
+ * divround_prepared_u64 and divround_prepared_batch_u64.
+ * divisor must not be 0. A 0 divisor is prepared so that the dividend is
+ * returned, as in divround_u64.
+ */
+INTMATH_API divround_divisor_u64 divround_prepare_u64(const uint64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ull)
+      fprintf(stderr, "ERROR: divround_prepare_u64(%" PRIu64 ") divisor argument must not be 0.\n", divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_prepare_u64", (uint64_t)divisor, 0u, 0u);
+  #endif
+
+  divround_divisor_u64 prepared;
+  uint8_t log2_ceil = 0u;
+  uint64_t pow2_minus_divisor;
+  uint64_t remainder;
+  prepared.divisor = divisor;
+  prepared.abs_divisor = (divisor == 0ull) ? 1ull : divisor;
+  prepared.half = (uint64_t)((prepared.abs_divisor >> 1) + (prepared.abs_divisor & 1ull));
+
+  while (log2_ceil < 64u && (1ull << log2_ceil) < prepared.abs_divisor) log2_ceil++;
+  pow2_minus_divisor = ((log2_ceil < 64u) ? (1ull << log2_ceil) : 0ull) - prepared.abs_divisor;
+  prepared.magic = wide_div_u128_u64(pow2_minus_divisor, 0ull, prepared.abs_divisor, &remainder) + 1ull;
+  prepared.shift1 = (log2_ceil > 0u) ? 1u : 0u;
+  prepared.shift2 = (log2_ceil > 0u) ? (uint8_t)(log2_ceil - 1u) : 0u;
+  return prepared;
+}
+
+/**
+ * Returns ROUND(dividend / divisor) for the divisor passed to
+ * divround_prepare_u64. The result equals divround_u64(dividend, divisor).
+ */
+INTMATH_API uint64_t divround_prepared_u64(const uint64_t dividend, const divround_divisor_u64 *divisor) {
+  const uint64_t abs_dividend = dividend;
+  uint64_t t = wide_mulhi_u64(divisor->magic, abs_dividend);
+  uint64_t quotient = (t + ((abs_dividend - t) >> divisor->shift1)) >> divisor->shift2;
+  uint64_t remainder = abs_dividend - quotient * divisor->abs_divisor;
+  quotient += (uint64_t)(remainder >= divisor->half);
+  return quotient;
+}
+
+/**
+ * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+ * [0, length - 1]. dividend and result may point to the same array.
+ */
+INTMATH_API void divround_prepared_batch_u64(const uint64_t *dividend, uint64_t *result, const size_t length, const divround_divisor_u64 *divisor) {
+  const divround_divisor_u64 prepared = *divisor;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = divround_prepared_u64(dividend[j], &prepared);
+}
+
+#endif /* #ifndef DIVROUND_PREPARED_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,333 @@
+/**
+ * divround_prepared.h
+ * Declares functions of the form
+ *     divround_divisor_X divround_prepare_X(const type divisor);
+ *     type divround_prepared_X(const type dividend, const divround_divisor_X *divisor);
+ *     void divround_prepared_batch_X(const type *dividend, type *result, const size_t length, const divround_divisor_X *divisor);
+ * where X is a type abbreviation.
+ *
+ * divround_prepare_X computes a fixed-point reciprocal of divisor once.
+ * divround_prepared_X then returns ROUND(dividend / divisor) with a
+ * multiplication instead of a hardware divide, and divround_prepared_batch_X
+ * does the same for every element of an array. The results are identical
+ * to those of divround_X in divround.c for every dividend and divisor,
+ * including the special cases below. This is worthwhile when one divisor
+ * is used for many dividends.
+ *
+ * These functions are implemented for int8_t, int16_t, int32_t, int64_t,
+ * uint8_t, uint16_t, uint32_t, and uint64_t.
+ *
+ * divisor must not be 0. dividend is returned in this case.
+ *
+ * For signed types, the most negative number must not be divided by -1.
+ * Explicitly, the following must be avoided:
+ * int8_t:  -128 / -1                   or   -2^7 / -1
+ * int16_t: -32768 / -1                 or   -2^15 / -1
+ * int32_t: -2147483648 / -1            or   -2^31 / -1
+ * int64_t: -9223372036854775808 / -1   or   -2^63 / -1
+ * The most positive representable number for each type is returned in these
+ * cases.
+ *
+ * Correct operation for negative signed arguments requires that the
+ * representation of signed integers be 2's complement.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef DIVROUND_PREPARED_H_
+#define DIVROUND_PREPARED_H_
+
+#include "inttypes.h"
+#include "intmath_inline.h"
+#include "stddef.h"
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/**
+ * Precomputed reciprocal of a int8_t divisor. Create it with
+ * divround_prepare_i8. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  int8_t divisor;
+  uint8_t abs_divisor;
+  uint8_t half;
+  uint8_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_i8;
+
+INTMATH_API divround_divisor_i8 divround_prepare_i8(const int8_t divisor);
+INTMATH_API int8_t divround_prepared_i8(const int8_t dividend, const divround_divisor_i8 *divisor);
+INTMATH_API void divround_prepared_batch_i8(const int8_t *dividend, int8_t *result, const size_t length, const divround_divisor_i8 *divisor);
+
+/**
+ * Precomputed reciprocal of a uint8_t divisor. Create it with
+ * divround_prepare_u8. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  uint8_t divisor;
+  uint8_t abs_divisor;
+  uint8_t half;
+  uint8_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_u8;
+
+INTMATH_API divround_divisor_u8 divround_prepare_u8(const uint8_t divisor);
+INTMATH_API uint8_t divround_prepared_u8(const uint8_t dividend, const divround_divisor_u8 *divisor);
+INTMATH_API void divround_prepared_batch_u8(const uint8_t *dividend, uint8_t *result, const size_t length, const divround_divisor_u8 *divisor);
+
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Precomputed reciprocal of a int16_t divisor. Create it with
+ * divround_prepare_i16. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  int16_t divisor;
+  uint16_t abs_divisor;
+  uint16_t half;
+  uint16_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_i16;
+
+INTMATH_API divround_divisor_i16 divround_prepare_i16(const int16_t divisor);
+INTMATH_API int16_t divround_prepared_i16(const int16_t dividend, const divround_divisor_i16 *divisor);
+INTMATH_API void divround_prepared_batch_i16(const int16_t *dividend, int16_t *result, const size_t length, const divround_divisor_i16 *divisor);
+
+/**
+ * Precomputed reciprocal of a uint16_t divisor. Create it with
+ * divround_prepare_u16. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  uint16_t divisor;
+  uint16_t abs_divisor;
+  uint16_t half;
+  uint16_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_u16;
+
+INTMATH_API divround_divisor_u16 divround_prepare_u16(const uint16_t divisor);
+INTMATH_API uint16_t divround_prepared_u16(const uint16_t dividend, const divround_divisor_u16 *divisor);
+INTMATH_API void divround_prepared_batch_u16(const uint16_t *dividend, uint16_t *result, const size_t length, const divround_divisor_u16 *divisor);
+
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Precomputed reciprocal of a int32_t divisor. Create it with
+ * divround_prepare_i32. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  int32_t divisor;
+  uint32_t abs_divisor;
+  uint32_t half;
+  uint32_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_i32;
+
+INTMATH_API divround_divisor_i32 divround_prepare_i32(const int32_t divisor);
+INTMATH_API int32_t divround_prepared_i32(const int32_t dividend, const divround_divisor_i32 *divisor);
+INTMATH_API void divround_prepared_batch_i32(const int32_t *dividend, int32_t *result, const size_t length, const divround_divisor_i32 *divisor);
+
+/**
+ * Precomputed reciprocal of a uint32_t divisor. Create it with
+ * divround_prepare_u32. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  uint32_t divisor;
+  uint32_t abs_divisor;
+  uint32_t half;
+  uint32_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_u32;
+
+INTMATH_API divround_divisor_u32 divround_prepare_u32(const uint32_t divisor);
+INTMATH_API uint32_t divround_prepared_u32(const uint32_t dividend, const divround_divisor_u32 *divisor);
+INTMATH_API void divround_prepared_batch_u32(const uint32_t *dividend, uint32_t *result, const size_t length, const divround_divisor_u32 *divisor);
+
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Precomputed reciprocal of a int64_t divisor. Create it with
+ * divround_prepare_i64. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  int64_t divisor;
+  uint64_t abs_divisor;
+  uint64_t half;
+  uint64_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_i64;
+
+INTMATH_API divround_divisor_i64 divround_prepare_i64(const int64_t divisor);
+INTMATH_API int64_t divround_prepared_i64(const int64_t dividend, const divround_divisor_i64 *divisor);
+INTMATH_API void divround_prepared_batch_i64(const int64_t *dividend, int64_t *result, const size_t length, const divround_divisor_i64 *divisor);
+
+/**
+ * Precomputed reciprocal of a uint64_t divisor. Create it with
+ * divround_prepare_u64. The fields are internal to divround_prepared.c.
+ */
+typedef struct {
+  uint64_t divisor;
+  uint64_t abs_divisor;
+  uint64_t half;
+  uint64_t magic;
+  uint8_t shift1;
+  uint8_t shift2;
+} divround_divisor_u64;
+
+INTMATH_API divround_divisor_u64 divround_prepare_u64(const uint64_t divisor);
+INTMATH_API uint64_t divround_prepared_u64(const uint64_t dividend, const divround_divisor_u64 *divisor);
+INTMATH_API void divround_prepared_batch_u64(const uint64_t *dividend, uint64_t *result, const size_t length, const divround_divisor_u64 *divisor);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "divround_prepared.c"
+#endif
+
+#endif /* #ifndef DIVROUND_PREPARED_H_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
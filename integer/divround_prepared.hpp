@@ -0,0 +1,455 @@
+/**
+ * divround_prepared.hpp
+ * Specifies the class template
+ *     divround_divisor<typename type>
+ * whose constructor computes a fixed-point reciprocal of a divisor once
+ * and whose members
+ *     type apply(const type dividend) const;
+ *     type operator()(const type dividend) const;
+ *     void apply_batch(const type *dividend, type *result, const size_t length) const;
+ *     void apply_batch(type *values, const size_t length) const;
+ * return or store ROUND(dividend / divisor) with a multiplication instead
+ * of a hardware divide. The results are identical to those of
+ * divround<type>(dividend, divisor) in divround.hpp for every dividend and
+ * divisor, including the special cases below. This is worthwhile when one
+ * divisor is used for many dividends.
+ *
+ * The algorithm is described in divround_prepared.c.
+ * Unlike multshiftround_shiftround_batch.hpp, this header does not require
+ * divround_prepared.c; it only requires wide_product.h.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
+ * uint64_t, or any type equivalent to these.
+ *
+ * divisor must not be 0. dividend is returned in this case.
+ *
+ * For signed types, the most negative number must not be divided by -1.
+ * Explicitly, the following must be avoided:
+ * int8_t:  -128 / -1                   or   -2^7 / -1
+ * int16_t: -32768 / -1                 or   -2^15 / -1
+ * int32_t: -2147483648 / -1            or   -2^31 / -1
+ * int64_t: -9223372036854775808 / -1   or   -2^63 / -1
+ * The most positive representable number for each type is returned in these
+ * cases.
+ *
+ * Correct operation for negative signed arguments requires that the
+ * representation of signed integers be 2's complement.
+ *
+ * If you #define DEBUG_INTMATH, checks for division by 0 and for numerical
+ * overflow will be enabled. This requires the availability of stderr and
+ * fprintf() on the target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef DIVROUND_PREPARED_HPP_
+#define DIVROUND_PREPARED_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <limits>
+#include "wide_product.h"
+
+#ifdef DEBUG_INTMATH
+  #include <cstdio>
+#elif defined(DIAGNOSE_INTMATH)
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
+#endif
+
+/* Allows static_assert message in divround_divisor_traits primary template to compile. */
+template <typename type> static bool always_false_divround_divisor(void) { return false; }
+
+/**
+ * divround_divisor_traits<type> supplies the per-type arithmetic that
+ * divround_divisor<type> needs:
+ *     utype:  the unsigned type of the same width as type.
+ *     name(): the name of type for debug messages.
+ *     is_negative(value): value < 0, without a warning for unsigned types.
+ *     mulhi(a, b): the high half of the double-width product a * b.
+ *     magic(abs_divisor, log2_ceil): floor(2^N * (2^log2_ceil - abs_divisor) / abs_divisor) + 1.
+ *
+ * This primary template is a catch-all for presently unimplemented
+ * template arguments.
+ */
+template <typename type> struct divround_divisor_traits {
+  static_assert(always_false_divround_divisor<type>(), "divround_divisor<type> is not defined for the specified type.");
+};
+
+/********************************************************************************
+ ********          int8_t and uint8_t template specializations           ********
+ ********************************************************************************/
+
+template <> struct divround_divisor_traits<int8_t> {
+  typedef uint8_t utype;
+  static constexpr const char *name(void) { return "int8_t"; }
+  static constexpr bool is_negative(const int8_t value) { return value < static_cast<int8_t>(0); }
+  static uint8_t mulhi(const uint8_t a, const uint8_t b) {
+    return static_cast<uint8_t>((static_cast<uint16_t>(a) * b) >> 8);
+  }
+  static constexpr uint8_t magic(const uint8_t abs_divisor, const uint8_t log2_ceil) {
+    return static_cast<uint8_t>((((static_cast<uint16_t>(1) << log2_ceil) - abs_divisor) << 8) / abs_divisor + 1u);
+  }
+};
+
+template <> struct divround_divisor_traits<uint8_t> {
+  typedef uint8_t utype;
+  static constexpr const char *name(void) { return "uint8_t"; }
+  static constexpr bool is_negative(const uint8_t) { return false; }
+  static uint8_t mulhi(const uint8_t a, const uint8_t b) {
+    return static_cast<uint8_t>((static_cast<uint16_t>(a) * b) >> 8);
+  }
+  static constexpr uint8_t magic(const uint8_t abs_divisor, const uint8_t log2_ceil) {
+    return static_cast<uint8_t>((((static_cast<uint16_t>(1) << log2_ceil) - abs_divisor) << 8) / abs_divisor + 1u);
+  }
+};
+
+/********************************************************************************
+ ********         int16_t and uint16_t template specializations          ********
+ ********************************************************************************/
+
+template <> struct divround_divisor_traits<int16_t> {
+  typedef uint16_t utype;
+  static constexpr const char *name(void) { return "int16_t"; }
+  static constexpr bool is_negative(const int16_t value) { return value < static_cast<int16_t>(0); }
+  static uint16_t mulhi(const uint16_t a, const uint16_t b) {
+    return static_cast<uint16_t>((static_cast<uint32_t>(a) * b) >> 16);
+  }
+  static constexpr uint16_t magic(const uint16_t abs_divisor, const uint8_t log2_ceil) {
+    return static_cast<uint16_t>((((static_cast<uint32_t>(1) << log2_ceil) - abs_divisor) << 16) / abs_divisor + 1u);
+  }
+};
+
+template <> struct divround_divisor_traits<uint16_t> {
+  typedef uint16_t utype;
+  static constexpr const char *name(void) { return "uint16_t"; }
+  static constexpr bool is_negative(const uint16_t) { return false; }
+  static uint16_t mulhi(const uint16_t a, const uint16_t b) {
+    return static_cast<uint16_t>((static_cast<uint32_t>(a) * b) >> 16);
+  }
+  static constexpr uint16_t magic(const uint16_t abs_divisor, const uint8_t log2_ceil) {
+    return static_cast<uint16_t>((((static_cast<uint32_t>(1) << log2_ceil) - abs_divisor) << 16) / abs_divisor + 1u);
+  }
+};
+
+/********************************************************************************
+ ********         int32_t and uint32_t template specializations          ********
+ ********************************************************************************/
+
+template <> struct divround_divisor_traits<int32_t> {
+  typedef uint32_t utype;
+  static constexpr const char *name(void) { return "int32_t"; }
+  static constexpr bool is_negative(const int32_t value) { return value < static_cast<int32_t>(0); }
+  static uint32_t mulhi(const uint32_t a, const uint32_t b) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 32);
+  }
+  static constexpr uint32_t magic(const uint32_t abs_divisor, const uint8_t log2_ceil) {
+    return static_cast<uint32_t>((((static_cast<uint64_t>(1) << log2_ceil) - abs_divisor) << 32) / abs_divisor + 1u);
+  }
+};
+
+template <> struct divround_divisor_traits<uint32_t> {
+  typedef uint32_t utype;
+  static constexpr const char *name(void) { return "uint32_t"; }
+  static constexpr bool is_negative(const uint32_t) { return false; }
+  static uint32_t mulhi(const uint32_t a, const uint32_t b) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 32);
+  }
+  static constexpr uint32_t magic(const uint32_t abs_divisor, const uint8_t log2_ceil) {
+    return static_cast<uint32_t>((((static_cast<uint64_t>(1) << log2_ceil) - abs_divisor) << 32) / abs_divisor + 1u);
+  }
+};
+
+/********************************************************************************
+ ********         int64_t and uint64_t template specializations          ********
+ ********************************************************************************/
+
+template <> struct divround_divisor_traits<int64_t> {
+  typedef uint64_t utype;
+  static constexpr const char *name(void) { return "int64_t"; }
+  static constexpr bool is_negative(const int64_t value) { return value < static_cast<int64_t>(0); }
+  static uint64_t mulhi(const uint64_t a, const uint64_t b) {
+    return wide_mulhi_u64(a, b);
+  }
+  static constexpr uint64_t magic(const uint64_t abs_divisor, const uint8_t log2_ceil) {
+    /**
+     * wide_div_u128_u64 cannot be used in a constant expression, so the
+     * 128-bit dividend (2^log2_ceil - abs_divisor) * 2^64 is divided here
+     * one quotient bit at a time.
+     */
+    uint64_t remainder = ((log2_ceil < 64u) ? (1ull << log2_ceil) : 0ull) - abs_divisor;
+    uint64_t quotient = 0ull;
+    for (int bit = 0; bit < 64; bit++) {
+      const uint64_t carry = remainder >> 63;
+      remainder <<= 1;
+      quotient <<= 1;
+      if (carry || remainder >= abs_divisor) {
+        remainder -= abs_divisor;
+        quotient |= 1ull;
+      }
+    }
+    return quotient + 1ull;
+  }
+};
+
+template <> struct divround_divisor_traits<uint64_t> {
+  typedef uint64_t utype;
+  static constexpr const char *name(void) { return "uint64_t"; }
+  static constexpr bool is_negative(const uint64_t) { return false; }
+  static uint64_t mulhi(const uint64_t a, const uint64_t b) {
+    return wide_mulhi_u64(a, b);
+  }
+  static constexpr uint64_t magic(const uint64_t abs_divisor, const uint8_t log2_ceil) {
+    /**
+     * wide_div_u128_u64 cannot be used in a constant expression, so the
+     * 128-bit dividend (2^log2_ceil - abs_divisor) * 2^64 is divided here
+     * one quotient bit at a time.
+     */
+    uint64_t remainder = ((log2_ceil < 64u) ? (1ull << log2_ceil) : 0ull) - abs_divisor;
+    uint64_t quotient = 0ull;
+    for (int bit = 0; bit < 64; bit++) {
+      const uint64_t carry = remainder >> 63;
+      remainder <<= 1;
+      quotient <<= 1;
+      if (carry || remainder >= abs_divisor) {
+        remainder -= abs_divisor;
+        quotient |= 1ull;
+      }
+    }
+    return quotient + 1ull;
+  }
+};
+
+/********************************************************************************
+ ********                        divround_divisor                        ********
+ ********************************************************************************/
+
+template <typename type> class divround_divisor {
+public:
+  typedef typename divround_divisor_traits<type>::utype utype;
+
+  /**
+   * Precomputes the reciprocal of divisor. divisor must not be 0.
+   * A 0 divisor is prepared so that apply returns the dividend,
+   * as divround<type> does. The constructor is constexpr so that a
+   * divisor known at compile time is prepared at compile time; see
+   * divround_comp.hpp.
+   */
+  explicit constexpr divround_divisor(const type divisor)
+    : divisor_(divisor), abs_divisor_(0u), half_(0u), magic_(0u), shift1_(0u), shift2_(0u) {
+    #ifdef DEBUG_INTMATH
+      if (divisor == static_cast<type>(0))
+        std::fprintf(stderr, "ERROR: divround_divisor<%s>(0) divisor argument must not be 0.\n", divround_divisor_traits<type>::name());
+    #elif defined(DIAGNOSE_INTMATH)
+      if (divisor == static_cast<type>(0))
+        intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_divisor<type>", 0u, 0u, 0u);
+    #endif
+
+    if (divisor == static_cast<type>(0)) abs_divisor_ = static_cast<utype>(1);
+    else if (divround_divisor_traits<type>::is_negative(divisor)) abs_divisor_ = static_cast<utype>(static_cast<utype>(0) - static_cast<utype>(divisor));
+    else abs_divisor_ = static_cast<utype>(divisor);
+    half_ = static_cast<utype>((abs_divisor_ >> 1) + (abs_divisor_ & static_cast<utype>(1)));
+
+    uint8_t log2_ceil = 0u;
+    while (log2_ceil < std::numeric_limits<utype>::digits && (static_cast<utype>(1) << log2_ceil) < abs_divisor_) log2_ceil++;
+    magic_ = divround_divisor_traits<type>::magic(abs_divisor_, log2_ceil);
+    shift1_ = (log2_ceil > 0u) ? 1u : 0u;
+    shift2_ = (log2_ceil > 0u) ? static_cast<uint8_t>(log2_ceil - 1u) : 0u;
+  }
+
+  /* Returns the divisor passed to the constructor. */
+  constexpr type divisor(void) const { return divisor_; }
+
+  /**
+   * Returns ROUND(dividend / divisor). The result equals
+   * divround<type>(dividend, divisor).
+   */
+  type apply(const type dividend) const {
+    #ifdef DEBUG_INTMATH
+      if (std::numeric_limits<type>::is_signed && dividend == std::numeric_limits<type>::min() && divisor_ == static_cast<type>(-1))
+        std::fprintf(stderr, "ERROR: divround_divisor<%s>(-1).apply(%" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", divround_divisor_traits<type>::name(), static_cast<int64_t>(dividend), static_cast<int64_t>(std::numeric_limits<type>::min()));
+    #elif defined(DIAGNOSE_INTMATH)
+      if (std::numeric_limits<type>::is_signed && dividend == std::numeric_limits<type>::min() && divisor_ == static_cast<type>(-1))
+        intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_divisor<type>::apply", static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor_), 0u);
+    #endif
+
+    const bool negative_dividend = divround_divisor_traits<type>::is_negative(dividend);
+    const bool negative = negative_dividend != divround_divisor_traits<type>::is_negative(divisor_);
+    const utype abs_dividend = negative_dividend ? static_cast<utype>(static_cast<utype>(0) - static_cast<utype>(dividend)) : static_cast<utype>(dividend);
+    const utype t = divround_divisor_traits<type>::mulhi(magic_, abs_dividend);
+    utype quotient = static_cast<utype>((t + static_cast<utype>(static_cast<utype>(abs_dividend - t) >> shift1_)) >> shift2_);
+    const utype remainder = static_cast<utype>(abs_dividend - quotient * abs_divisor_);
+    quotient = static_cast<utype>(quotient + static_cast<utype>(remainder >= half_));
+
+    if (negative) return static_cast<type>(static_cast<utype>(static_cast<utype>(0) - quotient));
+    if (quotient > static_cast<utype>(std::numeric_limits<type>::max())) return std::numeric_limits<type>::max();
+    return static_cast<type>(quotient);
+  }
+
+  /* Same as apply(dividend). */
+  type operator()(const type dividend) const { return apply(dividend); }
+
+  /**
+   * Stores ROUND(dividend[j] / divisor) into result[j] for j on
+   * [0, length - 1]. dividend and result may point to the same array.
+   */
+  void apply_batch(const type *dividend, type *result, const size_t length) const {
+    const divround_divisor<type> prepared(*this);
+    for (size_t j = 0u; j < length; j++) result[j] = prepared.apply(dividend[j]);
+  }
+
+  /* Replaces values[j] with ROUND(values[j] / divisor) for j on [0, length - 1]. */
+  void apply_batch(type *values, const size_t length) const {
+    apply_batch(values, values, length);
+  }
+
+private:
+  type divisor_;
+  utype abs_divisor_;
+  utype half_;
+  utype magic_;
+  uint8_t shift1_;
+  uint8_t shift2_;
+};
+
+#endif /* #ifndef DIVROUND_PREPARED_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
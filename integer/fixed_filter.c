@@ -0,0 +1,687 @@
+/**
+ * fixed_filter.c
+ * Defines the fixed-point filter functions
+ *   void fir_filter_X(const type *input, type *output, const size_t length, const type *taps, const size_t tap_count, const uint8_t shift);
+ *   biquad_X biquad_prepare_X(const type b0, const type b1, const type b2, const type a1, const type a2, const uint8_t shift);
+ *   void biquad_filter_X(biquad_X *biquads, const size_t channels, const type *input, type *output, const size_t frames);
+ * for int16_t and int32_t. See fixed_filter.h for what they compute.
+ *
+ * The int16_t kernels widen samples to 32-bit lanes and multiply them with
+ * vpmaddwd against coefficients whose upper 16 bits are zero, which forms
+ * the exact 32-bit product in one instruction. The int32_t kernels widen
+ * samples to 64-bit lanes and multiply them with vpmuldq. Rounding is the
+ * branch-free form that shiftround_run.c uses with BRANCHLESS_ROUNDING,
+ * and the 64-bit arithmetic right shift that AVX2 lacks is made from a
+ * logical shift of the one's complement of negative sums.
+ *
+ * The AVX2 kernels are picked at run time with cpu_features() from
+ * cpu_features.c, as saturate_values.c does. Elements or channels that do
+ * not fill a whole vector, processors without AVX2, and other targets use
+ * the scalar loops, which wrap the accumulator in unsigned arithmetic so
+ * that their results match the vector kernels bit for bit.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef FIXED_FILTER_C_
+#define FIXED_FILTER_C_
+
+#include "fixed_filter.h"
+#include "cpu_features.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+#endif
+
+/**
+ * GCC and Clang only emit vector instructions in functions carrying the
+ * matching target attribute when the instruction set is not enabled on
+ * the command line. MSVC allows any intrinsic in any function.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define FIXED_FILTER_X86
+  #define FIXED_FILTER_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #define FIXED_FILTER_X86
+  #define FIXED_FILTER_TARGET_AVX2
+#endif
+
+#ifdef FIXED_FILTER_X86
+  #include "immintrin.h"
+#endif
+
+/********************************************************************************
+ ********                         scalar kernels                         ********
+ ********************************************************************************/
+
+/**
+ * Return ROUND(sum / 2^shift) saturated to the output type. sum is the
+ * accumulator held unsigned so that it wraps without undefined behavior.
+ * low_mask is 2^shift - 1, half is 2^(shift-1), and nonzero is 1, or all
+ * three are 0 when shift is 0.
+ */
+static inline int32_t fixed_filter_round_i16(const uint32_t sum, const uint8_t shift, const uint32_t low_mask, const uint32_t half, const uint32_t nonzero) {
+  int32_t rounded = ((int32_t)sum >> shift) + (int32_t)(((sum & low_mask) + half - ((sum >> 31) & nonzero)) >> shift);
+  if (rounded > (int32_t)INT16_MAX) rounded = (int32_t)INT16_MAX;
+  if (rounded < (int32_t)INT16_MIN) rounded = (int32_t)INT16_MIN;
+  return rounded;
+}
+
+static inline int64_t fixed_filter_round_i32(const uint64_t sum, const uint8_t shift, const uint64_t low_mask, const uint64_t half, const uint64_t nonzero) {
+  int64_t rounded = ((int64_t)sum >> shift) + (int64_t)(((sum & low_mask) + half - ((sum >> 63) & nonzero)) >> shift);
+  if (rounded > (int64_t)INT32_MAX) rounded = (int64_t)INT32_MAX;
+  if (rounded < (int64_t)INT32_MIN) rounded = (int64_t)INT32_MIN;
+  return rounded;
+}
+
+static inline void fir_filter_i16_scalar(const int16_t *input, int16_t *output, const size_t length, const int16_t *taps, const size_t tap_count, const uint8_t shift) {
+  const uint32_t low_mask = (uint32_t)(((uint32_t)1u << shift) - 1u);
+  const uint32_t half = low_mask - (low_mask >> 1);
+  const uint32_t nonzero = (uint32_t)(shift != 0u);
+  size_t j;
+  size_t k;
+
+  for (j = 0u; j < length; j++) {
+    uint32_t sum = 0u;
+    for (k = 0u; k < tap_count; k++)
+      sum += (uint32_t)((int32_t)taps[k] * (int32_t)input[j + (tap_count - 1u - k)]);
+    output[j] = (int16_t)fixed_filter_round_i16(sum, shift, low_mask, half, nonzero);
+  }
+}
+
+static inline void fir_filter_i32_scalar(const int32_t *input, int32_t *output, const size_t length, const int32_t *taps, const size_t tap_count, const uint8_t shift) {
+  const uint64_t low_mask = (uint64_t)(((uint64_t)1u << shift) - 1u);
+  const uint64_t half = low_mask - (low_mask >> 1);
+  const uint64_t nonzero = (uint64_t)(shift != 0u);
+  size_t j;
+  size_t k;
+
+  for (j = 0u; j < length; j++) {
+    uint64_t sum = 0u;
+    for (k = 0u; k < tap_count; k++)
+      sum += (uint64_t)((int64_t)taps[k] * (int64_t)input[j + (tap_count - 1u - k)]);
+    output[j] = (int32_t)fixed_filter_round_i32(sum, shift, low_mask, half, nonzero);
+  }
+}
+
+/* Filters the channel whose samples are input[0], input[stride], ... */
+static inline void biquad_filter_i16_scalar(biquad_i16 *biquad, const size_t stride, const int16_t *input, int16_t *output, const size_t frames) {
+  const int32_t b0 = biquad->b0;
+  const int32_t b1 = biquad->b1;
+  const int32_t b2 = biquad->b2;
+  const int32_t a1 = biquad->a1;
+  const int32_t a2 = biquad->a2;
+  const uint8_t shift = biquad->shift;
+  const uint32_t low_mask = (uint32_t)(((uint32_t)1u << shift) - 1u);
+  const uint32_t half = low_mask - (low_mask >> 1);
+  const uint32_t nonzero = (uint32_t)(shift != 0u);
+  int32_t x1 = biquad->x1;
+  int32_t x2 = biquad->x2;
+  int32_t y1 = biquad->y1;
+  int32_t y2 = biquad->y2;
+  size_t f;
+
+  for (f = 0u; f < frames; f++) {
+    const int32_t x0 = input[f * stride];
+    const uint32_t sum = (uint32_t)(b0 * x0) + (uint32_t)(b1 * x1) + (uint32_t)(b2 * x2) - (uint32_t)(a1 * y1) - (uint32_t)(a2 * y2);
+    const int32_t y0 = fixed_filter_round_i16(sum, shift, low_mask, half, nonzero);
+    output[f * stride] = (int16_t)y0;
+    x2 = x1;
+    x1 = x0;
+    y2 = y1;
+    y1 = y0;
+  }
+
+  biquad->x1 = (int16_t)x1;
+  biquad->x2 = (int16_t)x2;
+  biquad->y1 = (int16_t)y1;
+  biquad->y2 = (int16_t)y2;
+}
+
+static inline void biquad_filter_i32_scalar(biquad_i32 *biquad, const size_t stride, const int32_t *input, int32_t *output, const size_t frames) {
+  const int64_t b0 = biquad->b0;
+  const int64_t b1 = biquad->b1;
+  const int64_t b2 = biquad->b2;
+  const int64_t a1 = biquad->a1;
+  const int64_t a2 = biquad->a2;
+  const uint8_t shift = biquad->shift;
+  const uint64_t low_mask = (uint64_t)(((uint64_t)1u << shift) - 1u);
+  const uint64_t half = low_mask - (low_mask >> 1);
+  const uint64_t nonzero = (uint64_t)(shift != 0u);
+  int64_t x1 = biquad->x1;
+  int64_t x2 = biquad->x2;
+  int64_t y1 = biquad->y1;
+  int64_t y2 = biquad->y2;
+  size_t f;
+
+  for (f = 0u; f < frames; f++) {
+    const int64_t x0 = input[f * stride];
+    const uint64_t sum = (uint64_t)(b0 * x0) + (uint64_t)(b1 * x1) + (uint64_t)(b2 * x2) - (uint64_t)(a1 * y1) - (uint64_t)(a2 * y2);
+    const int64_t y0 = fixed_filter_round_i32(sum, shift, low_mask, half, nonzero);
+    output[f * stride] = (int32_t)y0;
+    x2 = x1;
+    x1 = x0;
+    y2 = y1;
+    y1 = y0;
+  }
+
+  biquad->x1 = (int32_t)x1;
+  biquad->x2 = (int32_t)x2;
+  biquad->y1 = (int32_t)y1;
+  biquad->y2 = (int32_t)y2;
+}
+
+#ifdef FIXED_FILTER_X86
+
+/********************************************************************************
+ ********                          AVX2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * Return ROUND(sum / 2^shifts) per lane, with the masks of
+ * fixed_filter_round_i16 and fixed_filter_round_i32 in each lane.
+ * The results are not yet saturated.
+ */
+FIXED_FILTER_TARGET_AVX2 static inline __m256i fixed_filter_round_i32x8_avx2(const __m256i sum, const __m256i shifts, const __m256i low_mask, const __m256i half, const __m256i nonzero) {
+  const __m256i negative = _mm256_and_si256(_mm256_srli_epi32(sum, 31), nonzero);
+  const __m256i round_up = _mm256_srlv_epi32(_mm256_sub_epi32(_mm256_add_epi32(_mm256_and_si256(sum, low_mask), half), negative), shifts);
+  return _mm256_add_epi32(_mm256_srav_epi32(sum, shifts), round_up);
+}
+
+FIXED_FILTER_TARGET_AVX2 static inline __m256i fixed_filter_round_i64x4_avx2(const __m256i sum, const __m256i shifts, const __m256i low_mask, const __m256i half, const __m256i nonzero) {
+  const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), sum);
+  const __m256i truncated = _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(sum, sign), shifts), sign);
+  const __m256i round_up = _mm256_srlv_epi64(_mm256_sub_epi64(_mm256_add_epi64(_mm256_and_si256(sum, low_mask), half), _mm256_and_si256(sign, nonzero)), shifts);
+  return _mm256_add_epi64(truncated, round_up);
+}
+
+/* Saturates each 64-bit lane to the range of int32_t. */
+FIXED_FILTER_TARGET_AVX2 static inline __m256i fixed_filter_saturate_i64x4_avx2(__m256i value) {
+  const __m256i max = _mm256_set1_epi64x((int64_t)INT32_MAX);
+  const __m256i min = _mm256_set1_epi64x((int64_t)INT32_MIN);
+  value = _mm256_blendv_epi8(value, max, _mm256_cmpgt_epi64(value, max));
+  return _mm256_blendv_epi8(value, min, _mm256_cmpgt_epi64(min, value));
+}
+
+FIXED_FILTER_TARGET_AVX2 static inline void fir_filter_i16_avx2(const int16_t *input, int16_t *output, const size_t length, const int16_t *taps, const size_t tap_count, const uint8_t shift) {
+  const uint32_t low_mask_scalar = (uint32_t)(((uint32_t)1u << shift) - 1u);
+  const __m256i shifts = _mm256_set1_epi32((int32_t)shift);
+  const __m256i low_mask = _mm256_set1_epi32((int32_t)low_mask_scalar);
+  const __m256i half = _mm256_set1_epi32((int32_t)(low_mask_scalar - (low_mask_scalar >> 1)));
+  const __m256i nonzero = _mm256_set1_epi32((int32_t)(shift != 0u));
+  size_t j;
+  size_t k;
+
+  for (j = 0u; j + 16u <= length; j += 16u) {
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+    for (k = 0u; k < tap_count; k++) {
+      const int16_t *samples = input + j + (tap_count - 1u - k);
+      const __m256i tap = _mm256_set1_epi32((int32_t)(uint16_t)taps[k]);
+      sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)samples)), tap));
+      sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(samples + 8))), tap));
+    }
+    sum0 = fixed_filter_round_i32x8_avx2(sum0, shifts, low_mask, half, nonzero);
+    sum1 = fixed_filter_round_i32x8_avx2(sum1, shifts, low_mask, half, nonzero);
+    _mm256_storeu_si256((__m256i *)(output + j), _mm256_permute4x64_epi64(_mm256_packs_epi32(sum0, sum1), 0xD8));
+  }
+
+  fir_filter_i16_scalar(input + j, output + j, length - j, taps, tap_count, shift);
+}
+
+FIXED_FILTER_TARGET_AVX2 static inline void fir_filter_i32_avx2(const int32_t *input, int32_t *output, const size_t length, const int32_t *taps, const size_t tap_count, const uint8_t shift) {
+  const uint64_t low_mask_scalar = (uint64_t)(((uint64_t)1u << shift) - 1u);
+  const __m256i shifts = _mm256_set1_epi64x((int64_t)shift);
+  const __m256i low_mask = _mm256_set1_epi64x((int64_t)low_mask_scalar);
+  const __m256i half = _mm256_set1_epi64x((int64_t)(low_mask_scalar - (low_mask_scalar >> 1)));
+  const __m256i nonzero = _mm256_set1_epi64x((int64_t)(shift != 0u));
+  const __m256i even_lanes = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  size_t j;
+  size_t k;
+
+  for (j = 0u; j + 8u <= length; j += 8u) {
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+    for (k = 0u; k < tap_count; k++) {
+      const int32_t *samples = input + j + (tap_count - 1u - k);
+      const __m256i tap = _mm256_set1_epi64x((int64_t)taps[k]);
+      sum0 = _mm256_add_epi64(sum0, _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)samples)), tap));
+      sum1 = _mm256_add_epi64(sum1, _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(samples + 4))), tap));
+    }
+    sum0 = _mm256_permutevar8x32_epi32(fixed_filter_saturate_i64x4_avx2(fixed_filter_round_i64x4_avx2(sum0, shifts, low_mask, half, nonzero)), even_lanes);
+    sum1 = _mm256_permutevar8x32_epi32(fixed_filter_saturate_i64x4_avx2(fixed_filter_round_i64x4_avx2(sum1, shifts, low_mask, half, nonzero)), even_lanes);
+    _mm256_storeu_si256((__m256i *)(output + j), _mm256_permute2x128_si256(sum0, sum1, 0x20));
+  }
+
+  fir_filter_i32_scalar(input + j, output + j, length - j, taps, tap_count, shift);
+}
+
+/**
+ * Filters the 8 channels biquads[0..7], whose samples in frame f start at
+ * input[f * channels].
+ */
+FIXED_FILTER_TARGET_AVX2 static inline void biquad_filter_i16_avx2(biquad_i16 *biquads, const size_t channels, const int16_t *input, int16_t *output, const size_t frames) {
+  int32_t lanes[13][8];
+  size_t lane;
+  size_t f;
+
+  for (lane = 0u; lane < 8u; lane++) {
+    const uint32_t low_mask = (uint32_t)(((uint32_t)1u << biquads[lane].shift) - 1u);
+    /* Zero upper halves make vpmaddwd form a single 16 x 16-bit product. */
+    lanes[0][lane] = (int32_t)(uint16_t)biquads[lane].b0;
+    lanes[1][lane] = (int32_t)(uint16_t)biquads[lane].b1;
+    lanes[2][lane] = (int32_t)(uint16_t)biquads[lane].b2;
+    lanes[3][lane] = (int32_t)(uint16_t)biquads[lane].a1;
+    lanes[4][lane] = (int32_t)(uint16_t)biquads[lane].a2;
+    lanes[5][lane] = (int32_t)biquads[lane].shift;
+    lanes[6][lane] = (int32_t)low_mask;
+    lanes[7][lane] = (int32_t)(low_mask - (low_mask >> 1));
+    lanes[8][lane] = (int32_t)(biquads[lane].shift != 0u);
+    lanes[9][lane] = biquads[lane].x1;
+    lanes[10][lane] = biquads[lane].x2;
+    lanes[11][lane] = biquads[lane].y1;
+    lanes[12][lane] = biquads[lane].y2;
+  }
+
+  {
+    const __m256i b0 = _mm256_loadu_si256((const __m256i *)lanes[0]);
+    const __m256i b1 = _mm256_loadu_si256((const __m256i *)lanes[1]);
+    const __m256i b2 = _mm256_loadu_si256((const __m256i *)lanes[2]);
+    const __m256i a1 = _mm256_loadu_si256((const __m256i *)lanes[3]);
+    const __m256i a2 = _mm256_loadu_si256((const __m256i *)lanes[4]);
+    const __m256i shifts = _mm256_loadu_si256((const __m256i *)lanes[5]);
+    const __m256i low_mask = _mm256_loadu_si256((const __m256i *)lanes[6]);
+    const __m256i half = _mm256_loadu_si256((const __m256i *)lanes[7]);
+    const __m256i nonzero = _mm256_loadu_si256((const __m256i *)lanes[8]);
+    const __m256i max = _mm256_set1_epi32((int32_t)INT16_MAX);
+    const __m256i min = _mm256_set1_epi32((int32_t)INT16_MIN);
+    __m256i x1 = _mm256_loadu_si256((const __m256i *)lanes[9]);
+    __m256i x2 = _mm256_loadu_si256((const __m256i *)lanes[10]);
+    __m256i y1 = _mm256_loadu_si256((const __m256i *)lanes[11]);
+    __m256i y2 = _mm256_loadu_si256((const __m256i *)lanes[12]);
+
+    for (f = 0u; f < frames; f++) {
+      const __m256i x0 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(input + f * channels)));
+      __m256i sum = _mm256_add_epi32(_mm256_madd_epi16(x0, b0), _mm256_madd_epi16(x1, b1));
+      __m256i y0;
+      sum = _mm256_add_epi32(sum, _mm256_madd_epi16(x2, b2));
+      sum = _mm256_sub_epi32(sum, _mm256_madd_epi16(y1, a1));
+      sum = _mm256_sub_epi32(sum, _mm256_madd_epi16(y2, a2));
+      y0 = fixed_filter_round_i32x8_avx2(sum, shifts, low_mask, half, nonzero);
+      y0 = _mm256_max_epi32(_mm256_min_epi32(y0, max), min);
+      _mm_storeu_si128((__m128i *)(output + f * channels), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(y0, y0), 0xD8)));
+      x2 = x1;
+      x1 = x0;
+      y2 = y1;
+      y1 = y0;
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes[9], x1);
+    _mm256_storeu_si256((__m256i *)lanes[10], x2);
+    _mm256_storeu_si256((__m256i *)lanes[11], y1);
+    _mm256_storeu_si256((__m256i *)lanes[12], y2);
+  }
+
+  for (lane = 0u; lane < 8u; lane++) {
+    biquads[lane].x1 = (int16_t)lanes[9][lane];
+    biquads[lane].x2 = (int16_t)lanes[10][lane];
+    biquads[lane].y1 = (int16_t)lanes[11][lane];
+    biquads[lane].y2 = (int16_t)lanes[12][lane];
+  }
+}
+
+/**
+ * Filters the 4 channels biquads[0..3], whose samples in frame f start at
+ * input[f * channels].
+ */
+FIXED_FILTER_TARGET_AVX2 static inline void biquad_filter_i32_avx2(biquad_i32 *biquads, const size_t channels, const int32_t *input, int32_t *output, const size_t frames) {
+  int64_t lanes[13][4];
+  size_t lane;
+  size_t f;
+
+  for (lane = 0u; lane < 4u; lane++) {
+    const uint64_t low_mask = (uint64_t)(((uint64_t)1u << biquads[lane].shift) - 1u);
+    lanes[0][lane] = biquads[lane].b0;
+    lanes[1][lane] = biquads[lane].b1;
+    lanes[2][lane] = biquads[lane].b2;
+    lanes[3][lane] = biquads[lane].a1;
+    lanes[4][lane] = biquads[lane].a2;
+    lanes[5][lane] = (int64_t)biquads[lane].shift;
+    lanes[6][lane] = (int64_t)low_mask;
+    lanes[7][lane] = (int64_t)(low_mask - (low_mask >> 1));
+    lanes[8][lane] = (int64_t)(biquads[lane].shift != 0u);
+    lanes[9][lane] = biquads[lane].x1;
+    lanes[10][lane] = biquads[lane].x2;
+    lanes[11][lane] = biquads[lane].y1;
+    lanes[12][lane] = biquads[lane].y2;
+  }
+
+  {
+    const __m256i b0 = _mm256_loadu_si256((const __m256i *)lanes[0]);
+    const __m256i b1 = _mm256_loadu_si256((const __m256i *)lanes[1]);
+    const __m256i b2 = _mm256_loadu_si256((const __m256i *)lanes[2]);
+    const __m256i a1 = _mm256_loadu_si256((const __m256i *)lanes[3]);
+    const __m256i a2 = _mm256_loadu_si256((const __m256i *)lanes[4]);
+    const __m256i shifts = _mm256_loadu_si256((const __m256i *)lanes[5]);
+    const __m256i low_mask = _mm256_loadu_si256((const __m256i *)lanes[6]);
+    const __m256i half = _mm256_loadu_si256((const __m256i *)lanes[7]);
+    const __m256i nonzero = _mm256_loadu_si256((const __m256i *)lanes[8]);
+    const __m256i even_lanes = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    __m256i x1 = _mm256_loadu_si256((const __m256i *)lanes[9]);
+    __m256i x2 = _mm256_loadu_si256((const __m256i *)lanes[10]);
+    __m256i y1 = _mm256_loadu_si256((const __m256i *)lanes[11]);
+    __m256i y2 = _mm256_loadu_si256((const __m256i *)lanes[12]);
+
+    for (f = 0u; f < frames; f++) {
+      const __m256i x0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(input + f * channels)));
+      __m256i sum = _mm256_add_epi64(_mm256_mul_epi32(x0, b0), _mm256_mul_epi32(x1, b1));
+      __m256i y0;
+      sum = _mm256_add_epi64(sum, _mm256_mul_epi32(x2, b2));
+      sum = _mm256_sub_epi64(sum, _mm256_mul_epi32(y1, a1));
+      sum = _mm256_sub_epi64(sum, _mm256_mul_epi32(y2, a2));
+      y0 = fixed_filter_saturate_i64x4_avx2(fixed_filter_round_i64x4_avx2(sum, shifts, low_mask, half, nonzero));
+      _mm_storeu_si128((__m128i *)(output + f * channels), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(y0, even_lanes)));
+      x2 = x1;
+      x1 = x0;
+      y2 = y1;
+      y1 = y0;
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes[9], x1);
+    _mm256_storeu_si256((__m256i *)lanes[10], x2);
+    _mm256_storeu_si256((__m256i *)lanes[11], y1);
+    _mm256_storeu_si256((__m256i *)lanes[12], y2);
+  }
+
+  for (lane = 0u; lane < 4u; lane++) {
+    biquads[lane].x1 = (int32_t)lanes[9][lane];
+    biquads[lane].x2 = (int32_t)lanes[10][lane];
+    biquads[lane].y1 = (int32_t)lanes[11][lane];
+    biquads[lane].y2 = (int32_t)lanes[12][lane];
+  }
+}
+
+#endif /* #ifdef FIXED_FILTER_X86 */
+
+/********************************************************************************
+ ********                       int16_t functions                        ********
+ ********************************************************************************/
+
+INTMATH_API void fir_filter_i16(const int16_t *input, int16_t *output, const size_t length, const int16_t *taps, const size_t tap_count, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: fir_filter_i16(input, output, length, taps, tap_count, %u), shift = %u is invalid; it must be on the range [0,30].\n", shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "fir_filter_i16", (uint64_t)length, (uint64_t)tap_count, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    size_t j;
+    for (j = 0u; j < length; j++) output[j] = 0;
+    return;
+  }
+
+  #ifdef FIXED_FILTER_X86
+    if (cpu_features() & CPU_FEATURE_AVX2) {
+      fir_filter_i16_avx2(input, output, length, taps, tap_count, shift);
+      return;
+    }
+  #endif
+  fir_filter_i16_scalar(input, output, length, taps, tap_count, shift);
+}
+
+INTMATH_API biquad_i16 biquad_prepare_i16(const int16_t b0, const int16_t b1, const int16_t b2, const int16_t a1, const int16_t a2, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: biquad_prepare_i16(%i, %i, %i, %i, %i, %u), shift = %u is invalid; it must be on the range [0,30].\n", b0, b1, b2, a1, a2, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "biquad_prepare_i16", (uint64_t)b0, (uint64_t)a1, (uint64_t)shift);
+  #endif
+
+  biquad_i16 biquad;
+  if (shift > (uint8_t)30) {
+    biquad.b0 = 0;
+    biquad.b1 = 0;
+    biquad.b2 = 0;
+    biquad.a1 = 0;
+    biquad.a2 = 0;
+    biquad.shift = 0u;
+  }
+  else {
+    biquad.b0 = b0;
+    biquad.b1 = b1;
+    biquad.b2 = b2;
+    biquad.a1 = a1;
+    biquad.a2 = a2;
+    biquad.shift = shift;
+  }
+  biquad.x1 = 0;
+  biquad.x2 = 0;
+  biquad.y1 = 0;
+  biquad.y2 = 0;
+  return biquad;
+}
+
+INTMATH_API void biquad_filter_i16(biquad_i16 *biquads, const size_t channels, const int16_t *input, int16_t *output, const size_t frames) {
+  size_t channel = 0u;
+
+  #ifdef FIXED_FILTER_X86
+    if (cpu_features() & CPU_FEATURE_AVX2) {
+      for (; channel + 8u <= channels; channel += 8u)
+        biquad_filter_i16_avx2(biquads + channel, channels, input + channel, output + channel, frames);
+    }
+  #endif
+  for (; channel < channels; channel++)
+    biquad_filter_i16_scalar(biquads + channel, channels, input + channel, output + channel, frames);
+}
+
+/********************************************************************************
+ ********                       int32_t functions                        ********
+ ********************************************************************************/
+
+INTMATH_API void fir_filter_i32(const int32_t *input, int32_t *output, const size_t length, const int32_t *taps, const size_t tap_count, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: fir_filter_i32(input, output, length, taps, tap_count, %u), shift = %u is invalid; it must be on the range [0,62].\n", shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "fir_filter_i32", (uint64_t)length, (uint64_t)tap_count, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    size_t j;
+    for (j = 0u; j < length; j++) output[j] = 0;
+    return;
+  }
+
+  #ifdef FIXED_FILTER_X86
+    if (cpu_features() & CPU_FEATURE_AVX2) {
+      fir_filter_i32_avx2(input, output, length, taps, tap_count, shift);
+      return;
+    }
+  #endif
+  fir_filter_i32_scalar(input, output, length, taps, tap_count, shift);
+}
+
+INTMATH_API biquad_i32 biquad_prepare_i32(const int32_t b0, const int32_t b1, const int32_t b2, const int32_t a1, const int32_t a2, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: biquad_prepare_i32(%i, %i, %i, %i, %i, %u), shift = %u is invalid; it must be on the range [0,62].\n", b0, b1, b2, a1, a2, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "biquad_prepare_i32", (uint64_t)b0, (uint64_t)a1, (uint64_t)shift);
+  #endif
+
+  biquad_i32 biquad;
+  if (shift > (uint8_t)62) {
+    biquad.b0 = 0;
+    biquad.b1 = 0;
+    biquad.b2 = 0;
+    biquad.a1 = 0;
+    biquad.a2 = 0;
+    biquad.shift = 0u;
+  }
+  else {
+    biquad.b0 = b0;
+    biquad.b1 = b1;
+    biquad.b2 = b2;
+    biquad.a1 = a1;
+    biquad.a2 = a2;
+    biquad.shift = shift;
+  }
+  biquad.x1 = 0;
+  biquad.x2 = 0;
+  biquad.y1 = 0;
+  biquad.y2 = 0;
+  return biquad;
+}
+
+INTMATH_API void biquad_filter_i32(biquad_i32 *biquads, const size_t channels, const int32_t *input, int32_t *output, const size_t frames) {
+  size_t channel = 0u;
+
+  #ifdef FIXED_FILTER_X86
+    if (cpu_features() & CPU_FEATURE_AVX2) {
+      for (; channel + 4u <= channels; channel += 4u)
+        biquad_filter_i32_avx2(biquads + channel, channels, input + channel, output + channel, frames);
+    }
+  #endif
+  for (; channel < channels; channel++)
+    biquad_filter_i32_scalar(biquads + channel, channels, input + channel, output + channel, frames);
+}
+
+#endif /* #ifndef FIXED_FILTER_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,248 @@
+/**
+ * fixed_filter.h
+ * Declares the fixed-point filter functions
+ *   void fir_filter_X(const type *input, type *output, const size_t length, const type *taps, const size_t tap_count, const uint8_t shift);
+ *   biquad_X biquad_prepare_X(const type b0, const type b1, const type b2, const type a1, const type a2, const uint8_t shift);
+ *   void biquad_filter_X(biquad_X *biquads, const size_t channels, const type *input, type *output, const size_t frames);
+ * where X is a type abbreviation.
+ *
+ * fir_filter_X computes, for j on [0, length-1],
+ *   output[j] = ROUND(SUM_k(taps[k] * input[j + tap_count - 1 - k]) / 2^shift)
+ * so taps[0] multiplies the newest sample. input holds tap_count - 1
+ * samples of history followed by the length new samples. output may be the
+ * same array as input; the last tap_count - 1 elements of input are then
+ * left untouched and are the history for the next block.
+ *
+ * biquad_filter_X runs one Direct Form I biquad section per channel,
+ *   y[n] = ROUND((b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]) / 2^shift)
+ * over frames frames of channels interleaved channels, i.e. channel c of
+ * frame f is input[f * channels + c]. biquads[c] holds the coefficients and
+ * the x[n-1], x[n-2], y[n-1], and y[n-2] state of channel c and is updated
+ * in place, so a stream may be filtered one block at a time. output may be
+ * the same array as input. Create each biquad with biquad_prepare_X, which
+ * zeroes the state. Cascade sections by filtering the output again with
+ * the next set of biquads.
+ *
+ * ROUND rounds half away from zero, as shiftround does, and every output
+ * is saturated to the range of type. y[n-1] and y[n-2] are the saturated
+ * outputs.
+ *
+ * These functions are implemented for int16_t, with a 32-bit accumulator,
+ * and int32_t, with a 64-bit accumulator. shift may range from 0 to 30 for
+ * int16_t and from 0 to 62 for int32_t. fir_filter_X with an invalid shift
+ * writes 0 to every output, and a biquad prepared with an invalid shift
+ * outputs 0 for every input, as multshiftround_X does.
+ *
+ * The accumulator must not overflow. This is guaranteed when the sum of
+ * the magnitudes of the taps or coefficients is less than 2^16 for int16_t
+ * or 2^32 for int32_t. A sum that overflows wraps, identically on every
+ * code path. fixed_filter_design.hpp finds coefficients that meet this.
+ *
+ * On x86 processors with AVX2, fir_filter_X computes 16 (int16_t) or 8
+ * (int32_t) outputs at once, and biquad_filter_X filters 8 (int16_t) or 4
+ * (int32_t) channels at once. A single channel biquad is limited by the
+ * latency of its feedback loop and always runs the scalar code.
+ * The results are identical on every code path.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef FIXED_FILTER_H_
+#define FIXED_FILTER_H_
+
+#include "inttypes.h"
+#include "intmath_inline.h"
+#include "stddef.h"
+
+/********************************************************************************
+ ********                       int16_t functions                        ********
+ ********************************************************************************/
+
+/**
+ * Coefficients and state of one int16_t biquad section. Create it with
+ * biquad_prepare_i16. x1, x2, y1, and y2 are x[n-1], x[n-2], y[n-1],
+ * and y[n-2].
+ */
+typedef struct {
+  int16_t b0;
+  int16_t b1;
+  int16_t b2;
+  int16_t a1;
+  int16_t a2;
+  uint8_t shift;
+  int16_t x1;
+  int16_t x2;
+  int16_t y1;
+  int16_t y2;
+} biquad_i16;
+
+INTMATH_API void fir_filter_i16(const int16_t *input, int16_t *output, const size_t length, const int16_t *taps, const size_t tap_count, const uint8_t shift);
+INTMATH_API biquad_i16 biquad_prepare_i16(const int16_t b0, const int16_t b1, const int16_t b2, const int16_t a1, const int16_t a2, const uint8_t shift);
+INTMATH_API void biquad_filter_i16(biquad_i16 *biquads, const size_t channels, const int16_t *input, int16_t *output, const size_t frames);
+
+/********************************************************************************
+ ********                       int32_t functions                        ********
+ ********************************************************************************/
+
+/**
+ * Coefficients and state of one int32_t biquad section. Create it with
+ * biquad_prepare_i32. x1, x2, y1, and y2 are x[n-1], x[n-2], y[n-1],
+ * and y[n-2].
+ */
+typedef struct {
+  int32_t b0;
+  int32_t b1;
+  int32_t b2;
+  int32_t a1;
+  int32_t a2;
+  uint8_t shift;
+  int32_t x1;
+  int32_t x2;
+  int32_t y1;
+  int32_t y2;
+} biquad_i32;
+
+INTMATH_API void fir_filter_i32(const int32_t *input, int32_t *output, const size_t length, const int32_t *taps, const size_t tap_count, const uint8_t shift);
+INTMATH_API biquad_i32 biquad_prepare_i32(const int32_t b0, const int32_t b1, const int32_t b2, const int32_t a1, const int32_t a2, const uint8_t shift);
+INTMATH_API void biquad_filter_i32(biquad_i32 *biquads, const size_t channels, const int32_t *input, int32_t *output, const size_t frames);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "fixed_filter.c"
+#endif
+
+#endif /* #ifndef FIXED_FILTER_H_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,283 @@
+/**
+ * fixed_filter_design.hpp
+ * Specifies the templated function
+ *     fixed_filter_coefficients<type> fixed_filter_quantize<typename type>(const std::vector<pow2_rational> &coefficients, const pow2_int &sample_min, const pow2_int &sample_max, const pow2_rational &max_error = pow2_rational(1, 2));
+ * which turns real filter coefficients into integers that share one
+ * shift, for fir_filter<type> and biquad_prepare<type> in fixed_filter.hpp.
+ * type may be int16_t or int32_t.
+ *
+ * Each integer coefficient is ROUND(coefficient * 2^shift), and shift is
+ * the smallest shift for which every coefficient times every sample on
+ * [sample_min, sample_max] is within max_error / n of the exact product,
+ * where n is the number of nonzero coefficients. The quantization error of
+ * each accumulated output is therefore below max_error, in units of the
+ * output's least significant bit, before the output itself is rounded.
+ * The per-coefficient search is pow2_rational_search from
+ * optimal_pow2_rational.hpp, given |coefficient| as the fraction, and the
+ * largest shift it finds is raised until every coefficient meets its
+ * share of max_error at that common shift.
+ *
+ * For a biquad, pass { b0, b1, b2, a1, a2 } for the transfer function
+ *     (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ * and a range that holds both the input and the output. Feedback
+ * coefficients near 2 leave little headroom in type, so a max_error of a
+ * few least significant bits, or samples narrower than type such as
+ * 12-bit ADC readings in int16_t, is typical.
+ *
+ * found is false when no shift up to the largest valid fir_filter shift
+ * (30 for int16_t, 62 for int32_t) meets max_error with every integer
+ * coefficient inside type. accumulator_fits is true when the sum of the
+ * integer coefficient magnitudes times the largest sample magnitude fits
+ * the 32- or 64-bit accumulator, so that no output can overflow it.
+ *
+ * Everything is computed exactly with the boost/multiprecision types that
+ * optimal_pow2_rational.hpp uses, so decimal coefficients such as 0.1 are
+ * used as written. pow2_rational_parse_number reads them from text.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef FIXED_FILTER_DESIGN_HPP_
+#define FIXED_FILTER_DESIGN_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+#include "optimal_pow2_rational.hpp"
+
+/* Allows static_assert message in fixed_filter_design_traits primary template to compile. */
+template <typename type> static bool always_false_fixed_filter_design(void) { return false; }
+
+/**
+ * fixed_filter_design_traits<type> supplies:
+ *     coefficient_type:  the pow2_int_type of type.
+ *     accumulator_type:  the pow2_int_type of the fir_filter accumulator.
+ *     max_shift:         the largest valid fir_filter shift.
+ *
+ * This primary template is a catch-all for presently unimplemented
+ * template arguments.
+ */
+template <typename type> struct fixed_filter_design_traits {
+  static_assert(always_false_fixed_filter_design<type>(), "fixed_filter_quantize<type> is not defined for the specified type.");
+};
+
+template <> struct fixed_filter_design_traits<int16_t> {
+  static constexpr pow2_int_type coefficient_type = POW2_INT16;
+  static constexpr pow2_int_type accumulator_type = POW2_INT32;
+  static constexpr uint8_t max_shift = 30u;
+};
+
+template <> struct fixed_filter_design_traits<int32_t> {
+  static constexpr pow2_int_type coefficient_type = POW2_INT32;
+  static constexpr pow2_int_type accumulator_type = POW2_INT64;
+  static constexpr uint8_t max_shift = 62u;
+};
+
+/* What fixed_filter_quantize found. values is empty when found is false. */
+template <typename type> struct fixed_filter_coefficients {
+  bool found;
+  uint8_t shift;
+  std::vector<type> values;
+  pow2_rational worst_error;  /* largest |SUM(value * sample) / 2^shift - SUM(coefficient * sample)| */
+  bool accumulator_fits;
+
+  fixed_filter_coefficients() : found(false), shift(0u), worst_error(0), accumulator_fits(false) {}
+};
+
+template <typename type> fixed_filter_coefficients<type> fixed_filter_quantize(const std::vector<pow2_rational> &coefficients, const pow2_int &sample_min, const pow2_int &sample_max, const pow2_rational &max_error = pow2_rational(1, 2)) {
+  typedef fixed_filter_design_traits<type> traits;
+  const pow2_int lowest = pow2_int_type_lowest(traits::coefficient_type);
+  const pow2_int highest = pow2_int_type_max(traits::coefficient_type);
+  const pow2_rational magnitude((abs(sample_min) > abs(sample_max)) ? pow2_int(abs(sample_min)) : pow2_int(abs(sample_max)));
+  fixed_filter_coefficients<type> result;
+
+  if (sample_min < lowest || sample_max > highest || sample_max < sample_min || max_error <= 0) return result;
+
+  size_t nonzero = 0u;
+  for (const pow2_rational &coefficient : coefficients)
+    if (coefficient != 0) nonzero++;
+  const pow2_rational share = (nonzero == 0u) ? max_error : pow2_rational(max_error / nonzero);
+
+  /* The common shift is at least the shift each coefficient needs alone. */
+  uint8_t shift = 0u;
+  for (const pow2_rational &coefficient : coefficients) {
+    if (coefficient == 0) continue;
+    const pow2_rational_spec spec(sample_min, sample_max, (coefficient < 0) ? pow2_rational(-coefficient) : coefficient, share);
+    if (pow2_rational_check(spec) != NULL) return result;
+    const pow2_rational_result alone = pow2_rational_search(spec);
+    if (!alone.found) return result;
+    if (alone.shift > shift) shift = alone.shift;
+  }
+
+  for (; shift <= traits::max_shift; shift++) {
+    std::vector<type> values;
+    pow2_rational worst_error(0);
+    pow2_int magnitude_sum(0);
+    bool meets_error = true;
+
+    for (const pow2_rational &coefficient : coefficients) {
+      const bool negative = coefficient < 0;
+      const pow2_rational coefficient_magnitude = negative ? pow2_rational(-coefficient) : coefficient;
+
+      /* ROUND(|coefficient| * 2^shift), rounding half up, as pow2_rational_search does. */
+      const pow2_int scaled = numerator(coefficient_magnitude) << shift;
+      const pow2_int den = denominator(coefficient_magnitude);
+      pow2_int mul = scaled / den;
+      if (2 * (scaled - mul * den) >= den) mul += 1;
+      const pow2_int value = negative ? pow2_int(-mul) : mul;
+
+      /* A larger shift only makes the value larger. */
+      if (value < lowest || value > highest) return result;
+
+      const pow2_rational difference = pow2_rational(mul, pow2_int(1) << shift) - coefficient_magnitude;
+      const pow2_rational error = magnitude * ((difference < 0) ? pow2_rational(-difference) : difference);
+      if (coefficient != 0 && error >= share) meets_error = false;
+      worst_error += error;
+      magnitude_sum += mul;
+      values.push_back(static_cast<type>(static_cast<int64_t>(value)));
+    }
+
+    if (!meets_error) continue;
+
+    result.found = true;
+    result.shift = shift;
+    result.values = values;
+    result.worst_error = worst_error;
+    result.accumulator_fits = pow2_rational(magnitude_sum) * magnitude <= pow2_rational(pow2_int_type_max(traits::accumulator_type));
+    return result;
+  }
+  return result;
+}
+
+#endif /* #ifndef FIXED_FILTER_DESIGN_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,626 @@
+/**
+ * fixed_point.hpp
+ * Specifies the class template
+ *     fixed<uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow = fixed_wrap, typename rounding = round_half_away>
+ * which holds a signed or unsigned Qint_bits.frac_bits fixed point value,
+ * i.e. raw() / 2^frac_bits, and the templated functions
+ *     result fixed_cast<typename result>(const fixed<...> value);
+ *     result fixed_mul<typename result>(const fixed<...> a, const fixed<...> b);
+ *     result fixed_div<typename result>(const fixed<...> a, const fixed<...> b);
+ * which rescale, multiply, and divide fixed values into the format of
+ * result. The operators * and / return the format of their left operand,
+ * and + and - take two values of the same format.
+ *
+ * Every shift and intermediate type is chosen at compile time from the
+ * formats involved, and each operation lowers to the call one would write
+ * by hand on the raw values:
+ *   fixed_cast   shiftround<type, shift> when fraction bits are dropped,
+ *                in the wider of the two storage types, or in the type of
+ *                twice that width when the shift needs it; a left shift
+ *                when fraction bits are added.
+ *   fixed_mul    multshiftround<wide, shift> on the product formed in the
+ *                type of twice the storage width, or multshiftround_sat
+ *                when saturating to round_half_away. 64-bit storage uses
+ *                multshiftround_wide and multshiftround_sat.
+ *   fixed_div    divround<storage> when the formats need no shift, else
+ *                divround<wide> on a dividend or divisor shifted left.
+ * The result is then narrowed to the result storage type, either keeping
+ * the low bits (fixed_wrap) or through saturate_value (fixed_saturate).
+ * benchmark_fixed_point.cpp compares each operation with the hand written
+ * call.
+ *
+ * storage may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t,
+ * uint32_t, or uint64_t. int_bits + frac_bits must equal the width of
+ * storage, and for signed storage int_bits counts the sign bit, so the
+ * Q9.7 temperatures produced by thermistor_interpolator are
+ * fixed<9, 7, int16_t>. All storage types in one operation must have the
+ * same signedness, and both factors of fixed_mul and fixed_div must have
+ * the same storage type.
+ *
+ * overflow is fixed_wrap or fixed_saturate. With fixed_wrap, a result that
+ * does not fit keeps its low bits, as the raw routines do. With
+ * fixed_saturate it is clamped to the range of the result storage type.
+ * rounding is one of the tags in rounding_policy.hpp. The overflow and
+ * rounding of the result format apply to each operation.
+ *
+ * A format combination that no kernel supports fails a static_assert:
+ * fixed_mul must not add fraction bits and fixed_cast must not add or
+ * drop so many that every value overflows or rounds to zero. With 64-bit
+ * storage, fixed_mul only rounds half away from zero, and fixed_div needs
+ * as many fraction bits in the dividend as in the divisor and result
+ * together, since there is no 128-bit divround.
+ *
+ * from_double() rounds half away from zero and saturates for either
+ * overflow policy, since converting an out of range double is undefined.
+ * It is constexpr, so constants may be written as
+ *     constexpr fixed<1, 15, int16_t> gain = fixed<1, 15, int16_t>::from_double(0.7071);
+ *
+ * Division by zero and quotient overflow behave as in divround. If you
+ * #define DEBUG_INTMATH or DIAGNOSE_INTMATH, the checks of the underlying
+ * routines report them, along with any other invalid argument.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef FIXED_POINT_HPP_
+#define FIXED_POINT_HPP_
+
+#include <cinttypes>
+#include <limits>
+#include <type_traits>
+#include "rounding_policy.hpp"
+#include "saturate_value.hpp"
+#include "shiftround_comp.hpp"
+#include "multshiftround_comp.hpp"
+#include "multshiftround_wide.hpp"
+#include "multshiftround_sat.hpp"
+#include "divround.hpp"
+
+/* Overflow policy tags. */
+struct fixed_wrap { static const char *name(void) { return "fixed_wrap"; } };
+struct fixed_saturate { static const char *name(void) { return "fixed_saturate"; } };
+
+template <typename overflow> struct is_fixed_overflow_policy : std::false_type {};
+template <> struct is_fixed_overflow_policy<fixed_wrap> : std::true_type {};
+template <> struct is_fixed_overflow_policy<fixed_saturate> : std::true_type {};
+
+/* Allows static_assert message in the fixed_storage_traits primary template to compile. */
+template <typename type> static bool always_false_fixed_storage(void) { return false; }
+
+/**
+ * fixed_storage_traits<storage>::wide_type has twice the width of storage
+ * and its signedness, so it holds the product of any two storage values.
+ * The 64-bit types have no such type; their wide_type is themselves and
+ * their products go through wide_product.h instead.
+ */
+template <typename storage> struct fixed_storage_traits {
+  static_assert(always_false_fixed_storage<storage>(), "fixed is not defined for the specified storage type.");
+};
+
+template <> struct fixed_storage_traits<int8_t>   { typedef int16_t  wide_type; };
+template <> struct fixed_storage_traits<uint8_t>  { typedef uint16_t wide_type; };
+template <> struct fixed_storage_traits<int16_t>  { typedef int32_t  wide_type; };
+template <> struct fixed_storage_traits<uint16_t> { typedef uint32_t wide_type; };
+template <> struct fixed_storage_traits<int32_t>  { typedef int64_t  wide_type; };
+template <> struct fixed_storage_traits<uint32_t> { typedef uint64_t wide_type; };
+template <> struct fixed_storage_traits<int64_t>  { typedef int64_t  wide_type; };
+template <> struct fixed_storage_traits<uint64_t> { typedef uint64_t wide_type; };
+
+/* The wider of two storage types of the same signedness. */
+template <typename type_a, typename type_b> struct fixed_wider {
+  typedef typename std::conditional<(sizeof(type_a) >= sizeof(type_b)), type_a, type_b>::type type;
+};
+
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow = fixed_wrap, typename rounding = round_half_away> class fixed;
+
+template <typename type> struct is_fixed : std::false_type {};
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding> struct is_fixed<fixed<int_bits, frac_bits, storage, overflow, rounding> > : std::true_type {};
+
+/********************************************************************************
+ ********                         raw helpers                            ********
+ ********************************************************************************/
+
+/* 2^exponent as a double. */
+constexpr double fixed_pow2(const int exponent) {
+  return (exponent == 0) ? 1.0 : 2.0 * fixed_pow2(exponent - 1);
+}
+
+/**
+ * Moves truncated, the integer part of scaled, one step away from zero
+ * when the fraction it dropped is at least one half. The subtraction is
+ * exact, so unlike adding 0.5 before truncating, this cannot round
+ * 0.49999999999999994 or an odd value above 2^52 the wrong way.
+ */
+template <typename storage> constexpr storage fixed_round_truncated(const double scaled, const storage truncated) {
+  return (scaled - static_cast<double>(truncated) >= 0.5) ? static_cast<storage>(truncated + 1)
+         : (scaled - static_cast<double>(truncated) <= -0.5) ? static_cast<storage>(truncated - 1) : truncated;
+}
+
+/* Returns ROUND(scaled) saturated to the range of storage, or 0 for NaN. */
+template <typename storage> constexpr storage fixed_round_double(const double scaled) {
+  return (scaled != scaled) ? static_cast<storage>(0)
+         : (scaled >= fixed_pow2(std::numeric_limits<storage>::digits) - 0.5) ? std::numeric_limits<storage>::max()
+         : (scaled <= static_cast<double>(std::numeric_limits<storage>::lowest()) - 0.5) ? std::numeric_limits<storage>::lowest()
+         : fixed_round_truncated<storage>(scaled, static_cast<storage>(scaled));
+}
+
+/* Returns value * 2^shift with the bits shifted out of type discarded, without the undefined left shift of a negative value. */
+template <typename type> constexpr type fixed_shift_left(const type value, const int shift) {
+  return static_cast<type>(static_cast<typename std::make_unsigned<type>::type>(value) << shift);
+}
+
+/* Clamps value to the range of result_type when value_type is wider. */
+template <typename result_type, typename value_type> inline void fixed_clamp(value_type &value, std::true_type /* narrowing */) {
+  saturate_value<value_type>(value, static_cast<value_type>(std::numeric_limits<result_type>::lowest()), static_cast<value_type>(std::numeric_limits<result_type>::max()));
+}
+
+template <typename result_type, typename value_type> inline void fixed_clamp(value_type &, std::false_type /* narrowing */) {}
+
+/* Converts value to result_type, which has the same signedness, keeping its low bits. */
+template <typename result_type, typename value_type> inline result_type fixed_narrow(const value_type value, fixed_wrap) {
+  return static_cast<result_type>(value);
+}
+
+/* Converts value to result_type, which has the same signedness, saturating it to the range of result_type. */
+template <typename result_type, typename value_type> inline result_type fixed_narrow(value_type value, fixed_saturate) {
+  fixed_clamp<result_type, value_type>(value, std::integral_constant<bool, (sizeof(value_type) > sizeof(result_type))>());
+  return static_cast<result_type>(value);
+}
+
+/********************************************************************************
+ ********                          fixed_cast                            ********
+ ********************************************************************************/
+
+/**
+ * Returns ROUND(raw / 2^shift) converted to result_storage. The shift is
+ * done in the wider of the two storage types, or in the type of twice that
+ * width when shiftround cannot shift the wider type that far.
+ */
+template <typename result_storage, int shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_rescale(const storage raw, std::integral_constant<int, 1> /* drops fraction bits */) {
+  typedef typename fixed_wider<storage, result_storage>::type big;
+  typedef typename std::conditional<(shift < std::numeric_limits<big>::digits), big, typename fixed_storage_traits<big>::wide_type>::type work;
+  static_assert(shift < std::numeric_limits<work>::digits, "fixed_cast cannot drop this many fraction bits from a 64-bit storage type.");
+  return fixed_narrow<result_storage>(shiftround<work, static_cast<uint8_t>(shift), rounding>(static_cast<work>(raw)), overflow());
+}
+
+template <typename result_storage, int shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_rescale(const storage raw, std::integral_constant<int, 0> /* same fraction bits */) {
+  typedef typename fixed_wider<storage, result_storage>::type big;
+  return fixed_narrow<result_storage>(static_cast<big>(raw), overflow());
+}
+
+/* Returns raw * 2^-shift with the bits that do not fit in result_storage discarded. */
+template <typename result_storage, int shift, typename storage>
+inline result_storage fixed_rescale_up(const storage raw, fixed_wrap) {
+  return fixed_shift_left<result_storage>(static_cast<result_storage>(raw), -shift);
+}
+
+/**
+ * Returns raw * 2^-shift saturated to the range of result_storage. raw is
+ * compared with the limits shifted right first, so the shift cannot
+ * overflow.
+ */
+template <typename result_storage, int shift, typename storage>
+inline result_storage fixed_rescale_up(const storage raw, fixed_saturate) {
+  typedef typename fixed_wider<storage, result_storage>::type big;
+  const big value = static_cast<big>(raw);
+  const big upper = static_cast<big>(static_cast<big>(std::numeric_limits<result_storage>::max()) >> -shift);
+  const big lower = static_cast<big>(static_cast<big>(std::numeric_limits<result_storage>::lowest()) >> -shift);
+  if (value > upper) return std::numeric_limits<result_storage>::max();
+  if (value < lower) return std::numeric_limits<result_storage>::lowest();
+  return static_cast<result_storage>(fixed_shift_left<big>(value, -shift));
+}
+
+template <typename result_storage, int shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_rescale(const storage raw, std::integral_constant<int, -1> /* adds fraction bits */) {
+  static_assert(-shift < std::numeric_limits<result_storage>::digits, "fixed_cast cannot add this many fraction bits; every nonzero value would overflow.");
+  return fixed_rescale_up<result_storage, shift>(raw, overflow());
+}
+
+/**
+ * Returns value in the format of result, rounded as selected by
+ * result::rounding_type when fraction bits are dropped and narrowed as
+ * selected by result::overflow_type.
+ */
+template <typename result, uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding>
+inline result fixed_cast(const fixed<int_bits, frac_bits, storage, overflow, rounding> value) {
+  static_assert(is_fixed<result>::value, "fixed_cast<result> requires result to be a fixed type.");
+  typedef typename result::storage_type result_storage;
+  static_assert(std::is_signed<storage>::value == std::is_signed<result_storage>::value, "fixed_cast requires storage types of the same signedness.");
+  const int shift = static_cast<int>(frac_bits) - static_cast<int>(result::fraction_bits);
+  return result::from_raw(fixed_rescale<result_storage, shift, typename result::overflow_type, typename result::rounding_type>(value.raw(), std::integral_constant<int, (shift > 0) - (shift < 0)>()));
+}
+
+/********************************************************************************
+ ********                          fixed_mul                             ********
+ ********************************************************************************/
+
+/**
+ * How fixed_mul forms its product:
+ *   FIXED_PRODUCT_WIDE:   multshiftround in the type of twice the storage
+ *                         width, which cannot overflow, then fixed_narrow.
+ *   FIXED_PRODUCT_SAT:    multshiftround_sat, which rounds and saturates a
+ *                         double width product in one step.
+ *   FIXED_PRODUCT_WIDE64: multshiftround_wide for 64-bit storage.
+ */
+enum fixed_product_path {FIXED_PRODUCT_WIDE, FIXED_PRODUCT_SAT, FIXED_PRODUCT_WIDE64};
+
+template <typename storage, typename result_storage, typename overflow, typename rounding> constexpr fixed_product_path fixed_product_select(void) {
+  return (sizeof(storage) == 8u) ? (std::is_same<overflow, fixed_saturate>::value ? FIXED_PRODUCT_SAT : FIXED_PRODUCT_WIDE64)
+         : (std::is_same<overflow, fixed_saturate>::value && std::is_same<rounding, round_half_away>::value && sizeof(result_storage) <= sizeof(storage))
+           ? FIXED_PRODUCT_SAT : FIXED_PRODUCT_WIDE;
+}
+
+/* Returns ROUND((a * b) / 2^shift), or a * b when shift is 0, in wide. */
+template <typename wide, uint8_t shift, typename rounding> inline wide fixed_wide_product(const wide a, const wide b, std::true_type /* shift != 0 */) {
+  static_assert(shift < std::numeric_limits<wide>::digits, "fixed_mul drops more fraction bits than multshiftround can shift the double width product.");
+  return multshiftround<wide, shift, rounding>(a, b);
+}
+
+template <typename wide, uint8_t shift, typename rounding> inline wide fixed_wide_product(const wide a, const wide b, std::false_type /* shift != 0 */) {
+  return static_cast<wide>(a * b);
+}
+
+template <typename result_storage, uint8_t shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_product(const storage a, const storage b, std::integral_constant<fixed_product_path, FIXED_PRODUCT_WIDE>) {
+  typedef typename fixed_storage_traits<storage>::wide_type wide;
+  return fixed_narrow<result_storage>(fixed_wide_product<wide, shift, rounding>(static_cast<wide>(a), static_cast<wide>(b), std::integral_constant<bool, (shift != 0u)>()), overflow());
+}
+
+template <typename result_storage, uint8_t shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_product(const storage a, const storage b, std::integral_constant<fixed_product_path, FIXED_PRODUCT_SAT>) {
+  static_assert(std::is_same<rounding, round_half_away>::value, "fixed_mul with 64-bit storage only supports round_half_away.");
+  return multshiftround_sat<storage, result_storage, shift>(a, b, std::numeric_limits<result_storage>::lowest(), std::numeric_limits<result_storage>::max());
+}
+
+template <typename result_storage, uint8_t shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_product(const storage a, const storage b, std::integral_constant<fixed_product_path, FIXED_PRODUCT_WIDE64>) {
+  static_assert(std::is_same<rounding, round_half_away>::value, "fixed_mul with 64-bit storage only supports round_half_away.");
+  return static_cast<result_storage>(multshiftround_wide<storage, shift>(a, b));
+}
+
+/**
+ * Returns a * b in the format of result, rounded as selected by
+ * result::rounding_type and narrowed as selected by result::overflow_type.
+ */
+template <typename result, uint8_t int_bits_a, uint8_t frac_bits_a, typename storage, typename overflow_a, typename rounding_a,
+          uint8_t int_bits_b, uint8_t frac_bits_b, typename storage_b, typename overflow_b, typename rounding_b>
+inline result fixed_mul(const fixed<int_bits_a, frac_bits_a, storage, overflow_a, rounding_a> a, const fixed<int_bits_b, frac_bits_b, storage_b, overflow_b, rounding_b> b) {
+  static_assert(is_fixed<result>::value, "fixed_mul<result> requires result to be a fixed type.");
+  typedef typename result::storage_type result_storage;
+  typedef typename result::overflow_type overflow;
+  typedef typename result::rounding_type rounding;
+  static_assert(std::is_same<storage, storage_b>::value, "fixed_mul requires both factors to have the same storage type.");
+  static_assert(std::is_signed<storage>::value == std::is_signed<result_storage>::value, "fixed_mul requires storage types of the same signedness.");
+  static_assert(frac_bits_a + frac_bits_b >= result::fraction_bits, "fixed_mul requires the result to have no more fraction bits than the two factors together.");
+  const uint8_t shift = static_cast<uint8_t>(frac_bits_a + frac_bits_b - result::fraction_bits);
+  return result::from_raw(fixed_product<result_storage, shift, overflow, rounding>(a.raw(), b.raw(), std::integral_constant<fixed_product_path, fixed_product_select<storage, result_storage, overflow, rounding>()>()));
+}
+
+/********************************************************************************
+ ********                          fixed_div                             ********
+ ********************************************************************************/
+
+/* Returns ROUND(a / b) when the formats need no shift. */
+template <typename result_storage, int shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_quotient(const storage a, const storage b, std::integral_constant<int, 0> /* no shift */) {
+  return fixed_narrow<result_storage>(divround<storage, rounding>(a, b), overflow());
+}
+
+/* Returns ROUND(a * 2^shift / b) in the double width type. */
+template <typename result_storage, int shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_quotient(const storage a, const storage b, std::integral_constant<int, 1> /* shift dividend */) {
+  typedef typename fixed_storage_traits<storage>::wide_type wide;
+  static_assert(sizeof(storage) < 8u, "fixed_div with 64-bit storage requires the dividend to have as many fraction bits as the divisor and result together.");
+  static_assert(shift <= 8 * static_cast<int>(sizeof(storage)), "fixed_div cannot shift the dividend this far in the double width type.");
+  return fixed_narrow<result_storage>(divround<wide, rounding>(fixed_shift_left<wide>(static_cast<wide>(a), shift), static_cast<wide>(b)), overflow());
+}
+
+/* Returns ROUND(a / (b * 2^-shift)) in the double width type. */
+template <typename result_storage, int shift, typename overflow, typename rounding, typename storage>
+inline result_storage fixed_quotient(const storage a, const storage b, std::integral_constant<int, -1> /* shift divisor */) {
+  typedef typename fixed_storage_traits<storage>::wide_type wide;
+  static_assert(sizeof(storage) < 8u, "fixed_div with 64-bit storage requires the dividend to have as many fraction bits as the divisor and result together.");
+  static_assert(-shift <= 8 * static_cast<int>(sizeof(storage)), "fixed_div cannot shift the divisor this far in the double width type.");
+  return fixed_narrow<result_storage>(divround<wide, rounding>(static_cast<wide>(a), fixed_shift_left<wide>(static_cast<wide>(b), -shift)), overflow());
+}
+
+/**
+ * Returns a / b in the format of result, rounded as selected by
+ * result::rounding_type and narrowed as selected by result::overflow_type.
+ */
+template <typename result, uint8_t int_bits_a, uint8_t frac_bits_a, typename storage, typename overflow_a, typename rounding_a,
+          uint8_t int_bits_b, uint8_t frac_bits_b, typename storage_b, typename overflow_b, typename rounding_b>
+inline result fixed_div(const fixed<int_bits_a, frac_bits_a, storage, overflow_a, rounding_a> a, const fixed<int_bits_b, frac_bits_b, storage_b, overflow_b, rounding_b> b) {
+  static_assert(is_fixed<result>::value, "fixed_div<result> requires result to be a fixed type.");
+  typedef typename result::storage_type result_storage;
+  static_assert(std::is_same<storage, storage_b>::value, "fixed_div requires the dividend and divisor to have the same storage type.");
+  static_assert(std::is_signed<storage>::value == std::is_signed<result_storage>::value, "fixed_div requires storage types of the same signedness.");
+  const int shift = static_cast<int>(result::fraction_bits) + static_cast<int>(frac_bits_b) - static_cast<int>(frac_bits_a);
+  return result::from_raw(fixed_quotient<result_storage, shift, typename result::overflow_type, typename result::rounding_type>(a.raw(), b.raw(), std::integral_constant<int, (shift > 0) - (shift < 0)>()));
+}
+
+/********************************************************************************
+ ********                     addition and negation                      ********
+ ********************************************************************************/
+
+template <typename storage> inline storage fixed_add(const storage a, const storage b, fixed_wrap) {
+  typedef typename std::make_unsigned<storage>::type utype;
+  return static_cast<storage>(static_cast<utype>(a) + static_cast<utype>(b));
+}
+
+template <typename storage> inline storage fixed_subtract(const storage a, const storage b, fixed_wrap) {
+  typedef typename std::make_unsigned<storage>::type utype;
+  return static_cast<storage>(static_cast<utype>(a) - static_cast<utype>(b));
+}
+
+/**
+ * The sum of two signed values overflows when both differ in sign from
+ * it, and the difference overflows when a differs in sign from both b
+ * and the difference. Either way the wrapped result has the wrong sign,
+ * and the saturated result takes the sign of a.
+ */
+template <typename storage> inline storage fixed_add_saturate(const storage a, const storage b, std::true_type /* is_signed */) {
+  const storage sum = fixed_add<storage>(a, b, fixed_wrap());
+  if (((a ^ sum) & (b ^ sum)) < 0) return (a < static_cast<storage>(0)) ? std::numeric_limits<storage>::lowest() : std::numeric_limits<storage>::max();
+  return sum;
+}
+
+template <typename storage> inline storage fixed_add_saturate(const storage a, const storage b, std::false_type /* is_signed */) {
+  const storage sum = fixed_add<storage>(a, b, fixed_wrap());
+  return (sum < a) ? std::numeric_limits<storage>::max() : sum;
+}
+
+template <typename storage> inline storage fixed_subtract_saturate(const storage a, const storage b, std::true_type /* is_signed */) {
+  const storage difference = fixed_subtract<storage>(a, b, fixed_wrap());
+  if (((a ^ b) & (a ^ difference)) < 0) return (a < static_cast<storage>(0)) ? std::numeric_limits<storage>::lowest() : std::numeric_limits<storage>::max();
+  return difference;
+}
+
+template <typename storage> inline storage fixed_subtract_saturate(const storage a, const storage b, std::false_type /* is_signed */) {
+  return (a < b) ? static_cast<storage>(0) : static_cast<storage>(a - b);
+}
+
+template <typename storage> inline storage fixed_add(const storage a, const storage b, fixed_saturate) {
+  return fixed_add_saturate<storage>(a, b, std::is_signed<storage>());
+}
+
+template <typename storage> inline storage fixed_subtract(const storage a, const storage b, fixed_saturate) {
+  return fixed_subtract_saturate<storage>(a, b, std::is_signed<storage>());
+}
+
+/* -lowest wraps to lowest with fixed_wrap and saturates to max with fixed_saturate. */
+template <typename storage> inline storage fixed_negate(const storage value, fixed_wrap) {
+  return fixed_subtract<storage>(static_cast<storage>(0), value, fixed_wrap());
+}
+
+template <typename storage> inline storage fixed_negate(const storage value, fixed_saturate) {
+  return fixed_subtract<storage>(static_cast<storage>(0), value, fixed_saturate());
+}
+
+/********************************************************************************
+ ********                            fixed                               ********
+ ********************************************************************************/
+
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding> class fixed {
+  static_assert(sizeof(typename fixed_storage_traits<storage>::wide_type) > 0u, "fixed is not defined for the specified storage type.");
+  static_assert(int_bits + frac_bits == 8 * static_cast<int>(sizeof(storage)), "fixed<int_bits, frac_bits, storage> requires int_bits + frac_bits to equal the width of storage.");
+  static_assert(!std::is_signed<storage>::value || int_bits >= 1u, "fixed<int_bits, frac_bits, storage> counts the sign bit of signed storage in int_bits, so int_bits must be at least 1.");
+  static_assert(is_fixed_overflow_policy<overflow>::value, "fixed<int_bits, frac_bits, storage, overflow> requires overflow to be fixed_wrap or fixed_saturate.");
+  static_assert(is_rounding_policy<rounding>::value, "fixed<int_bits, frac_bits, storage, overflow, rounding> requires rounding to be a tag from rounding_policy.hpp.");
+
+public:
+  typedef storage storage_type;
+  typedef overflow overflow_type;
+  typedef rounding rounding_type;
+  static constexpr uint8_t integer_bits = int_bits;
+  static constexpr uint8_t fraction_bits = frac_bits;
+
+  constexpr fixed(void) : raw_value(static_cast<storage>(0)) {}
+
+  /* The value raw / 2^frac_bits. */
+  static constexpr fixed from_raw(const storage raw) { return fixed(raw, raw_tag()); }
+
+  /* ROUND(value * 2^frac_bits), rounded half away from zero and saturated. */
+  static constexpr fixed from_double(const double value) { return fixed(fixed_round_double<storage>(value * fixed_pow2(frac_bits)), raw_tag()); }
+
+  /* value * 2^frac_bits, narrowed as selected by overflow. */
+  static fixed from_int(const storage value);
+
+  constexpr storage raw(void) const { return raw_value; }
+  constexpr double to_double(void) const { return static_cast<double>(raw_value) / fixed_pow2(frac_bits); }
+
+  /* ROUND(raw / 2^frac_bits), rounded as selected by rounding. */
+  storage to_int(void) const;
+
+  fixed operator+(const fixed rhs) const { return from_raw(fixed_add<storage>(raw_value, rhs.raw_value, overflow())); }
+  fixed operator-(const fixed rhs) const { return from_raw(fixed_subtract<storage>(raw_value, rhs.raw_value, overflow())); }
+  fixed operator-(void) const {
+    static_assert(std::is_signed<storage>::value, "fixed negation requires signed storage.");
+    return from_raw(fixed_negate<storage>(raw_value, overflow()));
+  }
+  fixed &operator+=(const fixed rhs) { return *this = *this + rhs; }
+  fixed &operator-=(const fixed rhs) { return *this = *this - rhs; }
+  template <typename other> fixed &operator*=(const other rhs) { return *this = fixed_mul<fixed>(*this, rhs); }
+  template <typename other> fixed &operator/=(const other rhs) { return *this = fixed_div<fixed>(*this, rhs); }
+
+private:
+  struct raw_tag {};
+  constexpr fixed(const storage raw, raw_tag) : raw_value(raw) {}
+  storage raw_value;
+};
+
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding>
+inline fixed<int_bits, frac_bits, storage, overflow, rounding> fixed<int_bits, frac_bits, storage, overflow, rounding>::from_int(const storage value) {
+  return fixed_cast<fixed>(fixed<8u * sizeof(storage), 0u, storage, overflow, rounding>::from_raw(value));
+}
+
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding>
+inline storage fixed<int_bits, frac_bits, storage, overflow, rounding>::to_int(void) const {
+  return fixed_cast<fixed<8u * sizeof(storage), 0u, storage, overflow, rounding> >(*this).raw();
+}
+
+/* a * b and a / b in the format of a. */
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding, typename other>
+inline fixed<int_bits, frac_bits, storage, overflow, rounding> operator*(const fixed<int_bits, frac_bits, storage, overflow, rounding> a, const other b) {
+  return fixed_mul<fixed<int_bits, frac_bits, storage, overflow, rounding> >(a, b);
+}
+
+template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding, typename other>
+inline fixed<int_bits, frac_bits, storage, overflow, rounding> operator/(const fixed<int_bits, frac_bits, storage, overflow, rounding> a, const other b) {
+  return fixed_div<fixed<int_bits, frac_bits, storage, overflow, rounding> >(a, b);
+}
+
+/* Values of one format compare by their raw values, whatever their policies. */
+#define FIXED_POINT_COMPARISON(op) \
+  template <uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow_a, typename rounding_a, typename overflow_b, typename rounding_b> \
+  constexpr bool operator op(const fixed<int_bits, frac_bits, storage, overflow_a, rounding_a> a, const fixed<int_bits, frac_bits, storage, overflow_b, rounding_b> b) { \
+    return a.raw() op b.raw(); \
+  }
+
+FIXED_POINT_COMPARISON(==)
+FIXED_POINT_COMPARISON(!=)
+FIXED_POINT_COMPARISON(<)
+FIXED_POINT_COMPARISON(<=)
+FIXED_POINT_COMPARISON(>)
+FIXED_POINT_COMPARISON(>=)
+
+#undef FIXED_POINT_COMPARISON
+
+#endif /* #ifndef FIXED_POINT_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,354 @@
+/**
+ * horner_polynomial.hpp
+ * Specifies the class template
+ *     horner_polynomial<typename type>
+ * whose constructor
+ *     horner_polynomial(const uint8_t degree, const type *coefficients, const uint8_t *shifts, const uint8_t output_shift);
+ * checks and prepares a polynomial of degree up to 8 in fixed point, and
+ * whose members
+ *     type evaluate(const type x) const;
+ *     type operator()(const type x) const;
+ *     void evaluate_batch(const type *x, type *result, const size_t length) const;
+ *     void evaluate_batch(type *values, const size_t length) const;
+ * evaluate it by Horner's scheme with integer arithmetic only:
+ *     acc = coefficients[degree]
+ *     acc = multshiftround<type>(x, acc, shifts[k]) + coefficients[k]  for k = degree - 1 down to 0
+ *     return shiftround<type>(acc, output_shift)
+ * Each stage has its own shift, so each partial sum carries as many
+ * fraction bits as fit in type. The results are identical to those of the
+ * calls above to multshiftround_run.hpp and shiftround_run.hpp, but, as in
+ * multshiftround_scaler.hpp, the rounding masks of every stage are
+ * computed once in the constructor.
+ *
+ * horner_polynomial_design.hpp chooses the coefficients and shifts for a
+ * polynomial with real coefficients and a range of x, and bounds the error
+ * of the result.
+ *
+ * evaluate_batch runs each Horner stage over a block of 64 values before
+ * the next, rather than all stages for one value at a time, so that the
+ * compiler can vectorize the stage loops.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, or any type equivalent to
+ * these. Unsigned types are not supported and are rejected by a
+ * static_assert: the coefficients of a real polynomial, and the partial
+ * sums between Horner stages, are in general negative somewhere on the
+ * range of x even when the result is not. Evaluate such a polynomial in
+ * the signed type of the same width or wider and convert the result, e.g.
+ * with saturate_value. Each shift and output_shift may range from 0 to two
+ * less than the word length of type. A polynomial constructed with a degree
+ * above 8 or an invalid shift returns 0 for every x, as multshiftround<type>
+ * does. The default constructed polynomial is the constant 0.
+ *
+ * Neither the product x * acc nor the sum with a coefficient may overflow
+ * type. horner_polynomial_design.hpp only returns coefficients for which
+ * they cannot over the given range of x.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid degree and shift
+ * arguments and for numerical overflow in each product x * acc will be
+ * enabled. This requires the availability of stderr and fprintf() on the
+ * target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef HORNER_POLYNOMIAL_HPP_
+#define HORNER_POLYNOMIAL_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <limits>
+#include "multshiftround_scaler.hpp"
+
+template <typename type> class horner_polynomial {
+public:
+  typedef multshiftround_scaler_traits<type> traits;
+  typedef typename traits::utype utype;
+
+  static_assert(std::numeric_limits<type>::is_signed, "horner_polynomial<type> requires a signed type (int8_t, int16_t, int32_t, or int64_t); unsigned types are not supported.");
+
+  /* The largest degree a polynomial may have. */
+  static constexpr uint8_t max_degree = 8u;
+
+  /* The number of values evaluate_batch carries through each stage at once. */
+  static constexpr size_t block_length = 64u;
+
+  /* The constant 0. */
+  horner_polynomial(void) : degree_(0u), output_shift_(0u) {
+    clear();
+  }
+
+  /**
+   * Prepares the polynomial with coefficients[0] through
+   * coefficients[degree], where coefficients[0] is the constant term, and
+   * stage shifts shifts[0] through shifts[degree - 1]. shifts may be NULL
+   * when degree is 0.
+   */
+  horner_polynomial(const uint8_t degree, const type *coefficients, const uint8_t *shifts, const uint8_t output_shift)
+    : degree_(0u), output_shift_(0u) {
+    clear();
+
+    bool valid = degree <= max_degree && output_shift <= traits::max_shift;
+    #ifdef DEBUG_INTMATH
+      if (degree > max_degree)
+        std::fprintf(stderr, "ERROR: horner_polynomial<%s>(%u, coefficients, shifts, %u), degree = %u is invalid; it must be on the range [0,%u].\n", traits::name(), degree, output_shift, degree, max_degree);
+      if (output_shift > traits::max_shift)
+        std::fprintf(stderr, "ERROR: horner_polynomial<%s>(%u, coefficients, shifts, %u), output_shift = %u is invalid; it must be on the range [0,%u].\n", traits::name(), degree, output_shift, output_shift, traits::max_shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      if (degree > max_degree || output_shift > traits::max_shift)
+        intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "horner_polynomial<type>", static_cast<uint64_t>(degree), 0u, static_cast<uint64_t>(output_shift));
+    #endif
+
+    for (uint8_t k = 0u; valid && k < degree; k++) {
+      if (shifts[k] > traits::max_shift) {
+        #ifdef DEBUG_INTMATH
+          std::fprintf(stderr, "ERROR: horner_polynomial<%s>(%u, coefficients, shifts, %u), shifts[%u] = %u is invalid; it must be on the range [0,%u].\n", traits::name(), degree, output_shift, k, shifts[k], traits::max_shift);
+        #elif defined(DIAGNOSE_INTMATH)
+          intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "horner_polynomial<type>", static_cast<uint64_t>(degree), static_cast<uint64_t>(k), static_cast<uint64_t>(shifts[k]));
+        #endif
+        valid = false;
+      }
+    }
+    if (!valid) return;
+
+    degree_ = degree;
+    output_shift_ = output_shift;
+    for (uint8_t k = 0u; k <= degree; k++) coefficients_[k] = coefficients[k];
+    for (uint8_t k = 0u; k < degree; k++) {
+      shifts_[k] = shifts[k];
+      half_[k] = (shifts[k] == 0u) ? static_cast<utype>(0) : static_cast<utype>(static_cast<utype>(1) << (shifts[k] - 1u));
+      low_mask_[k] = static_cast<utype>(static_cast<utype>(half_[k] << 1) - static_cast<utype>(1));
+    }
+    output_half_ = (output_shift == 0u) ? static_cast<utype>(0) : static_cast<utype>(static_cast<utype>(1) << (output_shift - 1u));
+    output_low_mask_ = static_cast<utype>(static_cast<utype>(output_half_ << 1) - static_cast<utype>(1));
+  }
+
+  /* Returns the degree, which is 0 for an invalid polynomial. */
+  uint8_t degree(void) const { return degree_; }
+
+  /* Returns coefficient k, for k on [0, degree()]. */
+  type coefficient(const uint8_t k) const { return coefficients_[k]; }
+
+  /* Returns the shift of stage k, for k on [0, degree() - 1]. */
+  uint8_t shift(const uint8_t k) const { return shifts_[k]; }
+
+  uint8_t output_shift(void) const { return output_shift_; }
+
+  /* Returns the polynomial evaluated at x. */
+  type evaluate(const type x) const {
+    type acc = coefficients_[degree_];
+    for (uint8_t k = degree_; k-- > 0u;) acc = stage(x, acc, coefficients_[k], shifts_[k], half_[k], low_mask_[k]);
+    return output(acc);
+  }
+
+  /* Same as evaluate(x). */
+  type operator()(const type x) const { return evaluate(x); }
+
+  /**
+   * Stores the polynomial evaluated at x[j] into result[j] for j on
+   * [0, length - 1]. x and result may point to the same array.
+   */
+  void evaluate_batch(const type *x, type *result, const size_t length) const {
+    type acc[block_length];
+
+    for (size_t start = 0u; start < length; start += block_length) {
+      const size_t count = (length - start < block_length) ? length - start : block_length;
+      const type *block_x = x + start;
+
+      for (size_t j = 0u; j < count; j++) acc[j] = coefficients_[degree_];
+      for (uint8_t k = degree_; k-- > 0u;) {
+        const type coefficient = coefficients_[k];
+        const uint8_t shift = shifts_[k];
+        const utype half = half_[k];
+        const utype low_mask = low_mask_[k];
+        for (size_t j = 0u; j < count; j++) acc[j] = stage(block_x[j], acc[j], coefficient, shift, half, low_mask);
+      }
+      for (size_t j = 0u; j < count; j++) result[start + j] = output(acc[j]);
+    }
+  }
+
+  /* Replaces values[j] with the polynomial evaluated at values[j] for j on [0, length - 1]. */
+  void evaluate_batch(type *values, const size_t length) const {
+    evaluate_batch(values, values, length);
+  }
+
+private:
+  /* Returns ROUND((x * acc) / 2^shift) + coefficient. */
+  static type stage(const type x, const type acc, const type coefficient, const uint8_t shift, const utype half, const utype low_mask) {
+    #ifdef DEBUG_INTMATH
+      if (traits::product_overflows(x, acc))
+        std::fprintf(stderr, "ERROR: horner_polynomial<%s>::evaluate(%" PRIi64 "), numerical overflow or underflow in the product x * %" PRIi64 ".\n", traits::name(), static_cast<int64_t>(x), static_cast<int64_t>(acc));
+    #elif defined(DIAGNOSE_INTMATH)
+      if (traits::product_overflows(x, acc))
+        intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "horner_polynomial<type>::evaluate", static_cast<uint64_t>(x), static_cast<uint64_t>(acc), static_cast<uint64_t>(shift));
+    #endif
+
+    const type prod = traits::product(x, acc);
+    return static_cast<type>((prod >> shift) + traits::round_up(prod, half, low_mask) + coefficient);
+  }
+
+  /* Returns ROUND(acc / 2^output_shift). */
+  type output(const type acc) const {
+    return static_cast<type>((acc >> output_shift_) + traits::round_up(acc, output_half_, output_low_mask_));
+  }
+
+  void clear(void) {
+    for (uint8_t k = 0u; k <= max_degree; k++) coefficients_[k] = static_cast<type>(0);
+    for (uint8_t k = 0u; k < max_degree; k++) {
+      shifts_[k] = 0u;
+      half_[k] = static_cast<utype>(0);
+      low_mask_[k] = static_cast<utype>(0);
+    }
+    output_half_ = static_cast<utype>(0);
+    output_low_mask_ = static_cast<utype>(0);
+  }
+
+  uint8_t degree_;
+  uint8_t output_shift_;
+  type coefficients_[max_degree + 1u];
+  uint8_t shifts_[max_degree];
+  utype half_[max_degree];
+  utype low_mask_[max_degree];
+  utype output_half_;
+  utype output_low_mask_;
+};
+
+#endif /* #ifndef HORNER_POLYNOMIAL_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
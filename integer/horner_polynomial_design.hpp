@@ -0,0 +1,330 @@
+/**
+ * horner_polynomial_design.hpp
+ * Specifies the templated function
+ *     horner_design<type> horner_quantize<typename type>(const std::vector<pow2_rational> &coefficients, const pow2_int &x_min, const pow2_int &x_max);
+ * which turns the real coefficients of a polynomial
+ *     p(x) = coefficients[0] + coefficients[1] x + ... + coefficients[n] x^n
+ * into the integer coefficients, stage shifts, and output shift of a
+ * horner_polynomial<type> from horner_polynomial.hpp that approximates p(x)
+ * for every integer x on [x_min, x_max], and bounds its error.
+ * type may be int8_t, int16_t, int32_t, or int64_t. Unsigned types are not
+ * supported, as for horner_polynomial<type>.
+ *
+ * Horner stage k holds coefficients[k] + x (coefficients[k+1] + x (...))
+ * scaled by 2^f[k], i.e. with f[k] fraction bits, and its integer
+ * coefficient is ROUND(coefficients[k] * 2^f[k]). The stage shifts are
+ * f[k+1] - f[k] and the output shift is f[0]. Working from the highest
+ * power down, each f[k] is the largest that keeps the stage value, and the
+ * product of x with it, inside type for every x in the range, where the
+ * magnitude of a stage is bounded by SUM_j(|coefficients[j]| |x|^(j-k))
+ * plus its error so far. When the next stage can not be reached with a
+ * valid shift, the fraction bits of the stage above are reduced. Stage 0
+ * instead takes the f[0] with the smallest error bound, since rounding the
+ * output costs up to 1/2 and an exact sum needs no rounding.
+ *
+ * The error bound follows the rounding of each stage through Horner's
+ * scheme: the error of stage k is at most the quantization error of its
+ * coefficient, plus 1/2 for the multshiftround when its shift is not 0,
+ * plus max|x| times the error of stage k + 1 divided by 2^shift. worst_error
+ * is the error of stage 0 over 2^f[0] plus 1/2 for the final shiftround,
+ * in units of the output's least significant bit, so that
+ *     |horner_polynomial<type>::evaluate(x) - p(x)| <= worst_error
+ * for every x on [x_min, x_max]. The bound is computed exactly and is
+ * usually within a factor of two of the observed error.
+ *
+ * Since each product x * stage is formed in type, a stage can carry at
+ * most as many fraction bits as type has bits to spare beyond x and the
+ * stage's integer part. int16_t therefore suits x of about 8 bits, and
+ * wider x wants int32_t or int64_t; compare the worst_error of each.
+ *
+ * coefficients are exact rationals, as in optimal_pow2_rational.hpp.
+ * A double converts to pow2_rational exactly, and pow2_rational_parse_number
+ * reads decimal text such as "1.5e-3". p(x) is in units of the output, so
+ * fold any scaling of the result into the coefficients.
+ *
+ * found is false when coefficients is empty or longer than
+ * horner_polynomial<type>::max_degree + 1, when [x_min, x_max] is not a
+ * range of type, or when some stage does not fit in type even with no
+ * fraction bits, i.e. p(x) itself, or the product of x with one of its
+ * inner Horner sums, overflows type.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef HORNER_POLYNOMIAL_DESIGN_HPP_
+#define HORNER_POLYNOMIAL_DESIGN_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+#include "optimal_pow2_rational.hpp"
+#include "horner_polynomial.hpp"
+
+/* Allows static_assert message in horner_design_traits primary template to compile. */
+template <typename type> static bool always_false_horner_design(void) { return false; }
+
+/**
+ * horner_design_traits<type>::int_type is the pow2_int_type of type.
+ *
+ * This primary template is a catch-all for presently unimplemented
+ * template arguments.
+ */
+template <typename type> struct horner_design_traits {
+  static_assert(always_false_horner_design<type>(), "horner_quantize<type> is only defined for int8_t, int16_t, int32_t, and int64_t; unsigned types are not supported.");
+};
+
+template <> struct horner_design_traits<int8_t>  { static constexpr pow2_int_type int_type = POW2_INT8; };
+template <> struct horner_design_traits<int16_t> { static constexpr pow2_int_type int_type = POW2_INT16; };
+template <> struct horner_design_traits<int32_t> { static constexpr pow2_int_type int_type = POW2_INT32; };
+template <> struct horner_design_traits<int64_t> { static constexpr pow2_int_type int_type = POW2_INT64; };
+
+/* What horner_quantize found. The vectors are empty when found is false. */
+template <typename type> struct horner_design {
+  bool found;
+  std::vector<type> coefficients;      /* coefficients[k] multiplies x^k */
+  std::vector<uint8_t> shifts;         /* shifts[k] is the shift of stage k, for k on [0, degree - 1] */
+  uint8_t output_shift;
+  std::vector<int> fraction_bits;      /* f[k] of each stage */
+  pow2_rational worst_error;           /* bound on |evaluate(x) - p(x)| over [x_min, x_max] */
+
+  horner_design() : found(false), output_shift(0u), worst_error(0) {}
+
+  /* The polynomial to evaluate, or the constant 0 when found is false. */
+  horner_polynomial<type> polynomial(void) const {
+    if (!found) return horner_polynomial<type>();
+    return horner_polynomial<type>(static_cast<uint8_t>(coefficients.size() - 1u), coefficients.data(), shifts.empty() ? NULL : shifts.data(), output_shift);
+  }
+};
+
+/* ROUND(value * 2^bits), rounding half away from zero. */
+inline pow2_int horner_round_scaled(const pow2_rational &value, const int bits) {
+  const bool negative = value < 0;
+  const pow2_rational magnitude = negative ? pow2_rational(-value) : value;
+  const pow2_int scaled = numerator(magnitude) << bits;
+  const pow2_int den = denominator(magnitude);
+  pow2_int rounded = scaled / den;
+  if (2 * (scaled - rounded * den) >= den) rounded += 1;
+  return negative ? pow2_int(-rounded) : rounded;
+}
+
+template <typename type> horner_design<type> horner_quantize(const std::vector<pow2_rational> &coefficients, const pow2_int &x_min, const pow2_int &x_max) {
+  const pow2_int_type int_type = horner_design_traits<type>::int_type;
+  const int max_shift = static_cast<int>(horner_polynomial<type>::traits::max_shift);
+  const pow2_int lowest = pow2_int_type_lowest(int_type);
+  const pow2_int highest = pow2_int_type_max(int_type);
+  horner_design<type> result;
+
+  if (coefficients.empty() || coefficients.size() > horner_polynomial<type>::max_degree + 1u) return result;
+  if (x_min < lowest || x_max > highest || x_max < x_min) return result;
+
+  const int degree = static_cast<int>(coefficients.size()) - 1;
+  const pow2_rational max_x((abs(x_min) > abs(x_max)) ? pow2_int(abs(x_min)) : pow2_int(abs(x_max)));
+  const pow2_rational limit(highest);
+
+  /* bound[k] = SUM_j(|coefficients[j]| max_x^(j-k)) >= |stage k| for every x. */
+  std::vector<pow2_rational> bound(degree + 1);
+  for (int k = degree; k >= 0; k--) {
+    const pow2_rational magnitude = (coefficients[k] < 0) ? pow2_rational(-coefficients[k]) : coefficients[k];
+    bound[k] = magnitude + ((k < degree) ? pow2_rational(max_x * bound[k + 1]) : pow2_rational(0));
+  }
+
+  /**
+   * Assigns fraction bits from the highest power down. cap[k] is the most
+   * that stage k may have; it is lowered when stage k - 1 can not follow.
+   */
+  std::vector<int> fraction_bits(degree + 1, 0);
+  std::vector<int> cap(degree + 1, (degree + 1) * max_shift);
+  std::vector<pow2_int> values(degree + 1);
+  std::vector<pow2_rational> error(degree + 1);
+  cap[0] = max_shift;
+
+  int k = degree;
+  while (k >= 0) {
+    const int above = (k < degree) ? fraction_bits[k + 1] : cap[k];
+    const int high = (cap[k] < above) ? cap[k] : above;
+    const int low = (k < degree && above > max_shift) ? above - max_shift : 0;
+    bool placed = false;
+    pow2_rational best_output_error(0);
+
+    for (int bits = high; bits >= low; bits--) {
+      const pow2_int value = horner_round_scaled(coefficients[k], bits);
+      if (value < lowest || value > highest) continue;
+
+      const pow2_rational difference = pow2_rational(value) - pow2_rational(coefficients[k]) * pow2_rational(pow2_int(1) << bits);
+      pow2_rational stage_error = (difference < 0) ? pow2_rational(-difference) : difference;
+      if (k < degree) {
+        const int shift = above - bits;
+        stage_error += max_x * error[k + 1] / pow2_rational(pow2_int(1) << shift);
+        if (shift > 0) stage_error += pow2_rational(1, 2);
+      }
+
+      /* Stage k must fit, and for k > 0 so must its product with x. */
+      const pow2_rational magnitude = bound[k] * pow2_rational(pow2_int(1) << bits) + stage_error;
+      if (magnitude > limit || (k > 0 && max_x * magnitude > limit)) continue;
+
+      /* Stage 0 takes whichever output shift gives the smallest final error. */
+      const pow2_rational output_error = stage_error / pow2_rational(pow2_int(1) << bits) + ((bits > 0) ? pow2_rational(1, 2) : pow2_rational(0));
+      if (k == 0 && placed && output_error >= best_output_error) continue;
+
+      fraction_bits[k] = bits;
+      values[k] = value;
+      error[k] = stage_error;
+      best_output_error = output_error;
+      placed = true;
+      if (k > 0) break;
+    }
+
+    if (placed) {
+      k--;
+    }
+    else if (k < degree && low > 0) {
+      /* Stage k + 1 has too many fraction bits to reach stage k. */
+      cap[k + 1] = fraction_bits[k + 1] - 1;
+      k++;
+    }
+    else {
+      return result;
+    }
+  }
+
+  result.found = true;
+  for (int j = 0; j <= degree; j++) result.coefficients.push_back(static_cast<type>(static_cast<int64_t>(values[j])));
+  for (int j = 0; j < degree; j++) result.shifts.push_back(static_cast<uint8_t>(fraction_bits[j + 1] - fraction_bits[j]));
+  result.output_shift = static_cast<uint8_t>(fraction_bits[0]);
+  result.fraction_bits = fraction_bits;
+  result.worst_error = error[0] / pow2_rational(pow2_int(1) << fraction_bits[0]) + ((fraction_bits[0] > 0) ? pow2_rational(1, 2) : pow2_rational(0));
+  return result;
+}
+
+#endif /* #ifndef HORNER_POLYNOMIAL_DESIGN_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,346 @@
+/**
+ * intmath_diagnostics.c
+ * Defines the event recorder used when the library is compiled with
+ * DIAGNOSE_INTMATH defined:
+ *   void intmath_diagnostics_record(const intmath_event event, const char *function, const uint64_t arg0, const uint64_t arg1, const uint64_t arg2);
+ * and the functions that read and reset what it records:
+ *   void intmath_thread_counters(intmath_counters *counters);
+ *   void intmath_reset_thread_counters(void);
+ *   void intmath_process_counters(intmath_counters *counters);
+ *   void intmath_reset_process_counters(void);
+ *   size_t intmath_ring_snapshot(intmath_event_record *records, const size_t max_records);
+ *   void intmath_reset_ring(void);
+ *   const char *intmath_event_name(const intmath_event event);
+ * See intmath_diagnostics.h for details.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include "intmath_diagnostics.h"
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+  #define INTMATH_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+  #define INTMATH_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+  #define INTMATH_THREAD_LOCAL __declspec(thread)
+#else
+  #define INTMATH_THREAD_LOCAL
+#endif
+
+/**
+ * Relaxed loads and stores are enough for the counters. The ring buffer
+ * sequence numbers use acquire and release ordering.
+ */
+#if defined(__GNUC__)
+  #define ATOMIC_ADD_U64(pointer, value) __atomic_fetch_add((pointer), (value), __ATOMIC_RELAXED)
+  #define ATOMIC_EXCHANGE_U64(pointer, value) __atomic_exchange_n((pointer), (value), __ATOMIC_RELAXED)
+  #define ATOMIC_LOAD_RELAXED(pointer) __atomic_load_n((pointer), __ATOMIC_RELAXED)
+  #define ATOMIC_LOAD_ACQUIRE(pointer) __atomic_load_n((pointer), __ATOMIC_ACQUIRE)
+  #define ATOMIC_STORE_RELAXED(pointer, value) __atomic_store_n((pointer), (value), __ATOMIC_RELAXED)
+  #define ATOMIC_STORE_RELEASE(pointer, value) __atomic_store_n((pointer), (value), __ATOMIC_RELEASE)
+  #define FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+  #define FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  /* x86 orders ordinary loads and stores strongly enough; only the compiler must be restrained. */
+  #include <intrin.h>
+  #define ATOMIC_ADD_U64(pointer, value) ((uint64_t)_InterlockedExchangeAdd64((volatile __int64 *)(pointer), (__int64)(value)))
+  #define ATOMIC_EXCHANGE_U64(pointer, value) ((uint64_t)_InterlockedExchange64((volatile __int64 *)(pointer), (__int64)(value)))
+  #define ATOMIC_LOAD_RELAXED(pointer) (*(pointer))
+  #define ATOMIC_LOAD_ACQUIRE(pointer) (*(pointer))
+  #define ATOMIC_STORE_RELAXED(pointer, value) (*(pointer) = (value))
+  #define ATOMIC_STORE_RELEASE(pointer, value) (_ReadWriteBarrier(), *(pointer) = (value))
+  #define FENCE_ACQUIRE() _ReadWriteBarrier()
+  #define FENCE_RELEASE() _ReadWriteBarrier()
+#else
+  #define ATOMIC_ADD_U64(pointer, value) ((*(pointer) += (value)) - (value))
+  #define ATOMIC_EXCHANGE_U64(pointer, value) exchange_u64((pointer), (value))
+  #define ATOMIC_LOAD_RELAXED(pointer) (*(pointer))
+  #define ATOMIC_LOAD_ACQUIRE(pointer) (*(pointer))
+  #define ATOMIC_STORE_RELAXED(pointer, value) (*(pointer) = (value))
+  #define ATOMIC_STORE_RELEASE(pointer, value) (*(pointer) = (value))
+  #define FENCE_ACQUIRE()
+  #define FENCE_RELEASE()
+
+  static uint64_t exchange_u64(uint64_t *pointer, const uint64_t value) {
+    uint64_t previous = *pointer;
+    *pointer = value;
+    return previous;
+  }
+#endif
+
+static INTMATH_THREAD_LOCAL uint64_t thread_events[INTMATH_EVENT_KINDS];
+static uint64_t process_events[INTMATH_EVENT_KINDS];
+
+#if INTMATH_RING_LENGTH > 0
+/**
+ * Every field is written with atomic stores so that a concurrent reader
+ * is never a data race. sequence is 0 while an entry is being written.
+ */
+typedef struct {
+  uint64_t sequence;
+  uint64_t event;
+  const char *function;
+  uint64_t args[3];
+} ring_entry;
+
+static ring_entry ring[INTMATH_RING_LENGTH];
+
+/* Number of entries ever claimed. The newest entry has sequence ring_head. */
+static uint64_t ring_head = 0u;
+
+/* Entries with a sequence at or below ring_reset_mark were cleared by intmath_reset_ring(). */
+static uint64_t ring_reset_mark = 0u;
+#endif
+
+/**
+ * Counts one event and stores it in the ring buffer.
+ */
+void intmath_diagnostics_record(const intmath_event event, const char *function, const uint64_t arg0, const uint64_t arg1, const uint64_t arg2) {
+  if ((unsigned int)event >= (unsigned int)INTMATH_EVENT_KINDS) return;
+  thread_events[event]++;
+  (void)ATOMIC_ADD_U64(&process_events[event], 1u);
+
+  #if INTMATH_RING_LENGTH > 0
+    const uint64_t sequence = ATOMIC_ADD_U64(&ring_head, 1u) + 1u;
+    ring_entry *entry = &ring[(sequence - 1u) % INTMATH_RING_LENGTH];
+    ATOMIC_STORE_RELAXED(&entry->sequence, 0u);
+    FENCE_RELEASE();
+    ATOMIC_STORE_RELAXED(&entry->event, (uint64_t)event);
+    ATOMIC_STORE_RELAXED(&entry->function, function);
+    ATOMIC_STORE_RELAXED(&entry->args[0], arg0);
+    ATOMIC_STORE_RELAXED(&entry->args[1], arg1);
+    ATOMIC_STORE_RELAXED(&entry->args[2], arg2);
+    ATOMIC_STORE_RELEASE(&entry->sequence, sequence);
+  #else
+    (void)function;
+    (void)arg0;
+    (void)arg1;
+    (void)arg2;
+  #endif
+}
+
+/**
+ * Copies the calling thread's event counts into *counters.
+ */
+void intmath_thread_counters(intmath_counters *counters) {
+  size_t j;
+  for (j = 0u; j < (size_t)INTMATH_EVENT_KINDS; j++) counters->events[j] = thread_events[j];
+}
+
+/**
+ * Sets the calling thread's event counts to 0. Other threads are unaffected.
+ */
+void intmath_reset_thread_counters(void) {
+  size_t j;
+  for (j = 0u; j < (size_t)INTMATH_EVENT_KINDS; j++) thread_events[j] = 0u;
+}
+
+/**
+ * Copies the event counts summed over all threads into *counters.
+ */
+void intmath_process_counters(intmath_counters *counters) {
+  size_t j;
+  for (j = 0u; j < (size_t)INTMATH_EVENT_KINDS; j++) counters->events[j] = ATOMIC_LOAD_RELAXED(&process_events[j]);
+}
+
+/**
+ * Sets the process-wide event counts to 0. Events recorded concurrently
+ * are either counted before the reset or after it, never lost twice.
+ */
+void intmath_reset_process_counters(void) {
+  size_t j;
+  for (j = 0u; j < (size_t)INTMATH_EVENT_KINDS; j++) (void)ATOMIC_EXCHANGE_U64(&process_events[j], 0u);
+}
+
+/**
+ * Copies up to max_records of the most recent ring buffer entries into
+ * records, oldest first, and returns the number copied. Entries being
+ * written or overwritten during the copy are skipped. Returns 0 if the
+ * ring buffer is disabled.
+ */
+size_t intmath_ring_snapshot(intmath_event_record *records, const size_t max_records) {
+  #if INTMATH_RING_LENGTH > 0
+    const uint64_t head = ATOMIC_LOAD_ACQUIRE(&ring_head);
+    uint64_t first = ATOMIC_LOAD_RELAXED(&ring_reset_mark);
+    uint64_t sequence;
+    size_t count = 0u;
+
+    if (head - first > (uint64_t)INTMATH_RING_LENGTH) first = head - (uint64_t)INTMATH_RING_LENGTH;
+    if (head - first > (uint64_t)max_records) first = head - (uint64_t)max_records;
+
+    for (sequence = first + 1u; sequence <= head; sequence++) {
+      const ring_entry *entry = &ring[(sequence - 1u) % INTMATH_RING_LENGTH];
+      intmath_event_record copy;
+      if (ATOMIC_LOAD_ACQUIRE(&entry->sequence) != sequence) continue;
+      copy.sequence = sequence;
+      copy.event = (intmath_event)ATOMIC_LOAD_RELAXED(&entry->event);
+      copy.function = ATOMIC_LOAD_RELAXED(&entry->function);
+      copy.args[0] = ATOMIC_LOAD_RELAXED(&entry->args[0]);
+      copy.args[1] = ATOMIC_LOAD_RELAXED(&entry->args[1]);
+      copy.args[2] = ATOMIC_LOAD_RELAXED(&entry->args[2]);
+      FENCE_ACQUIRE();
+      if (ATOMIC_LOAD_RELAXED(&entry->sequence) != sequence) continue;
+      records[count++] = copy;
+    }
+    return count;
+  #else
+    (void)records;
+    (void)max_records;
+    return 0u;
+  #endif
+}
+
+/**
+ * Hides every entry recorded so far from later snapshots.
+ */
+void intmath_reset_ring(void) {
+  #if INTMATH_RING_LENGTH > 0
+    ATOMIC_STORE_RELAXED(&ring_reset_mark, ATOMIC_LOAD_ACQUIRE(&ring_head));
+  #endif
+}
+
+/**
+ * Returns a short name for event, e.g. "invalid shift".
+ */
+const char *intmath_event_name(const intmath_event event) {
+  switch (event) {
+    case INTMATH_EVENT_INVALID_SHIFT: return "invalid shift";
+    case INTMATH_EVENT_PRODUCT_OVERFLOW: return "product overflow";
+    case INTMATH_EVENT_ZERO_DIVISOR: return "zero divisor";
+    case INTMATH_EVENT_QUOTIENT_OVERFLOW: return "quotient overflow";
+    case INTMATH_EVENT_RESULT_OVERFLOW: return "result overflow";
+    default: return "unknown event";
+  }
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,224 @@
+/**
+ * intmath_diagnostics.h
+ * Declares the event recorder used when the library is compiled with
+ * DIAGNOSE_INTMATH defined. This is a production alternative to
+ * DEBUG_INTMATH. It checks for the same invalid arguments and overflows,
+ * but instead of calling fprintf() it counts each event and keeps a short
+ * history of the offending arguments. An argument check that passes costs
+ * one well predicted branch.
+ *
+ * When a check fails, the kernel calls intmath_diagnostics_record(). That
+ * function:
+ * - increments the calling thread's counter for the event, a thread-local
+ *   increment with no synchronization,
+ * - atomically increments the process-wide counter for the event, and
+ * - stores the event, the function name, and up to three arguments in a
+ *   fixed-size lock-free ring buffer of INTMATH_RING_LENGTH entries
+ *   (default 256), unless INTMATH_RING_LENGTH is defined as 0 when
+ *   intmath_diagnostics.c is compiled.
+ * The kernel's return value is the same as without diagnostics. If both
+ * DEBUG_INTMATH and DIAGNOSE_INTMATH are defined, DEBUG_INTMATH takes
+ * precedence.
+ *
+ * Arguments are stored as uint64_t. Signed arguments are sign-extended,
+ * so casting an entry back to the kernel's argument type recovers the
+ * original value.
+ *
+ * The ring buffer is a best effort history. Entries are claimed with an
+ * atomic counter and published with a per-entry sequence number, so
+ * readers never block writers and never return a partially written entry.
+ * A snapshot taken while other threads are recording may miss the newest
+ * entries, and once more than INTMATH_RING_LENGTH events arrive the oldest
+ * entries are overwritten.
+ *
+ * The atomic operations use the gcc/clang __atomic builtins or the MSVC
+ * Interlocked intrinsics. On other compilers they fall back to plain loads
+ * and stores, which are only correct in single threaded programs.
+ *
+ * intmath_diagnostics.c must be compiled and linked separately even under
+ * INTMATH_HEADER_ONLY, so that all translation units share one set of
+ * process-wide counters and one ring buffer.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef INTMATH_DIAGNOSTICS_H_
+#define INTMATH_DIAGNOSTICS_H_
+
+#include "inttypes.h"
+#include "stddef.h"
+
+#ifndef INTMATH_RING_LENGTH
+  #define INTMATH_RING_LENGTH 256u
+#endif
+
+/* Marks the recorder as rarely called so compilers move the call off the hot path. */
+#if defined(__GNUC__)
+  #define INTMATH_DIAGNOSTICS_COLD __attribute__((cold, noinline))
+#else
+  #define INTMATH_DIAGNOSTICS_COLD
+#endif
+
+typedef enum {
+  INTMATH_EVENT_INVALID_SHIFT = 0,   /* shift argument out of range */
+  INTMATH_EVENT_PRODUCT_OVERFLOW,    /* num * mul does not fit in the type */
+  INTMATH_EVENT_ZERO_DIVISOR,        /* divisor of 0 */
+  INTMATH_EVENT_QUOTIENT_OVERFLOW,   /* most negative value divided by -1 */
+  INTMATH_EVENT_RESULT_OVERFLOW,     /* rounded result does not fit in the type */
+  INTMATH_EVENT_KINDS
+} intmath_event;
+
+/* Event counts indexed by intmath_event. */
+typedef struct {
+  uint64_t events[INTMATH_EVENT_KINDS];
+} intmath_counters;
+
+/* One ring buffer entry. */
+typedef struct {
+  uint64_t sequence;      /* 1 for the first event recorded by the process */
+  intmath_event event;
+  const char *function;   /* name of the kernel, e.g. "multshiftround_i32" */
+  uint64_t args[3];       /* kernel arguments in order; unused ones are 0 */
+} intmath_event_record;
+
+INTMATH_DIAGNOSTICS_COLD void intmath_diagnostics_record(const intmath_event event, const char *function, const uint64_t arg0, const uint64_t arg1, const uint64_t arg2);
+
+void intmath_thread_counters(intmath_counters *counters);
+void intmath_reset_thread_counters(void);
+void intmath_process_counters(intmath_counters *counters);
+void intmath_reset_process_counters(void);
+size_t intmath_ring_snapshot(intmath_event_record *records, const size_t max_records);
+void intmath_reset_ring(void);
+const char *intmath_event_name(const intmath_event event);
+
+#endif /* #ifndef INTMATH_DIAGNOSTICS_H_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
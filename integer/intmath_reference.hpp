@@ -0,0 +1,376 @@
+/**
+ * intmath_reference.hpp
+ * Specifies the templated reference functions
+ *     type reference_shiftround<typename type>(const type num, const uint8_t shift);
+ *     type reference_multshiftround<typename type>(const type num, const type mul, const uint8_t shift);
+ *     type reference_divround<typename type>(const type dividend, const type divisor);
+ * which return ROUND(num / 2^shift), ROUND((num * mul) / 2^shift), and
+ * ROUND(dividend / divisor) computed exactly with integer arithmetic.
+ * ROUND rounds half away from zero, matching shiftround, multshiftround,
+ * and divround.
+ *
+ * Each also takes an optional last argument, a rounding policy tag from
+ * rounding_policy.hpp, for the other rounding modes. Only the empty tag
+ * types are taken from that header.
+ *
+ * These exist so that the unit tests can check the 64-bit routines
+ * without extended precision floating point. Every computation is done
+ * on the magnitudes of the arguments: num * mul is formed at its full
+ * 128-bit width, the magnitude is rounded, and the sign is applied last.
+ * Nothing here shares code with the routines under test, including
+ * wide_product.h.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t,
+ * uint32_t, uint64_t, or any type equivalent to these.
+ *
+ * shift may range from 0 to 127. The result is exact whenever it fits in
+ * type. If it does not, the low bits of the exact result are returned.
+ * Overflow of the product num * mul in type is not an error here; the
+ * rounded result is still formed from the full product.
+ *
+ * divisor must not be 0.
+ *
+ * These are test helpers. They are correct before they are fast, though
+ * the 64-bit forms are still roughly 100 times faster than
+ * boost::multiprecision::cpp_bin_float.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef INTMATH_REFERENCE_HPP_
+#define INTMATH_REFERENCE_HPP_
+
+#include <cinttypes>
+#include <limits>
+#include <type_traits>
+#include "rounding_policy.hpp"
+
+/**
+ * A 128-bit unsigned magnitude held as two 64-bit halves.
+ */
+struct reference_u128 {
+  uint64_t hi;
+  uint64_t lo;
+};
+
+/**
+ * Returns the full 128-bit product a * b.
+ * The portable form is schoolbook multiplication on 32-bit halves.
+ */
+inline reference_u128 reference_mul_u64(const uint64_t a, const uint64_t b) {
+  reference_u128 prod;
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 wide = static_cast<unsigned __int128>(a) * static_cast<unsigned __int128>(b);
+  prod.hi = static_cast<uint64_t>(wide >> 64);
+  prod.lo = static_cast<uint64_t>(wide);
+#else
+  const uint64_t a_lo = a & 0xFFFFFFFFull;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xFFFFFFFFull;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t ll = a_lo * b_lo;
+  const uint64_t lh = a_lo * b_hi;
+  const uint64_t hl = a_hi * b_lo;
+  const uint64_t hh = a_hi * b_hi;
+  const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull);
+  prod.lo = (mid << 32) | (ll & 0xFFFFFFFFull);
+  prod.hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+  return prod;
+}
+
+/**
+ * Returns ROUND(mag / 2^shift) for shift on [0, 127], rounding half up.
+ * Since mag is a magnitude, half up is half away from zero.
+ */
+inline reference_u128 reference_shiftround_u128(const reference_u128 mag, const uint8_t shift) {
+  if (shift == 0u) return mag;
+
+  reference_u128 quotient;
+  bool half_bit;
+  if (shift < 64u) {
+    quotient.lo = (mag.lo >> shift) | (mag.hi << (64u - shift));
+    quotient.hi = mag.hi >> shift;
+    half_bit = ((mag.lo >> (shift - 1u)) & 1ull) != 0ull;
+  } else if (shift == 64u) {
+    quotient.lo = mag.hi;
+    quotient.hi = 0ull;
+    half_bit = (mag.lo >> 63) != 0ull;
+  } else {
+    quotient.lo = mag.hi >> (shift - 64u);
+    quotient.hi = 0ull;
+    half_bit = ((mag.hi >> (shift - 65u)) & 1ull) != 0ull;
+  }
+
+  if (half_bit) {
+    quotient.lo++;
+    if (quotient.lo == 0ull) quotient.hi++;
+  }
+  return quotient;
+}
+
+/**
+ * Returns |value| as a uint64_t. Exact for the lowest value of every
+ * signed type up to int64_t.
+ */
+template <typename type> inline uint64_t reference_magnitude(const type value) {
+  static_assert(std::is_integral<type>::value && sizeof(type) <= 8u, "reference functions require an integer type of at most 64 bits.");
+  if (value < static_cast<type>(0)) return 0ull - static_cast<uint64_t>(static_cast<int64_t>(value));
+  return static_cast<uint64_t>(value);
+}
+
+/**
+ * Applies a sign to a rounded magnitude and narrows it to type.
+ */
+template <typename type> inline type reference_apply_sign(const uint64_t magnitude, const bool negative) {
+  return static_cast<type>(negative ? 0ull - magnitude : magnitude);
+}
+
+/**
+ * Returns ROUND(num / 2^shift) exactly.
+ */
+template <typename type> inline type reference_shiftround(const type num, const uint8_t shift) {
+  reference_u128 mag;
+  mag.hi = 0ull;
+  mag.lo = reference_magnitude<type>(num);
+  return reference_apply_sign<type>(reference_shiftround_u128(mag, shift).lo, num < static_cast<type>(0));
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) exactly, with num * mul formed
+ * at 128-bit width.
+ */
+template <typename type> inline type reference_multshiftround(const type num, const type mul, const uint8_t shift) {
+  reference_u128 mag = reference_mul_u64(reference_magnitude<type>(num), reference_magnitude<type>(mul));
+  bool negative = (num < static_cast<type>(0)) != (mul < static_cast<type>(0));
+  return reference_apply_sign<type>(reference_shiftround_u128(mag, shift).lo, negative);
+}
+
+/**
+ * Returns ROUND(dividend / divisor) exactly.
+ * The quotient magnitude is rounded up when the remainder is at least
+ * half the divisor, written as remainder >= divisor - remainder so that
+ * it cannot overflow.
+ */
+template <typename type> inline type reference_divround(const type dividend, const type divisor) {
+  uint64_t dividend_mag = reference_magnitude<type>(dividend);
+  uint64_t divisor_mag = reference_magnitude<type>(divisor);
+  uint64_t quotient = dividend_mag / divisor_mag;
+  uint64_t remainder = dividend_mag - quotient * divisor_mag;
+  if (remainder >= divisor_mag - remainder) quotient++;
+  bool negative = (dividend < static_cast<type>(0)) != (divisor < static_cast<type>(0));
+  return reference_apply_sign<type>(quotient, negative);
+}
+
+/**
+ * The rounding decision for each policy, given how the discarded part of
+ * the exact result compares with half (versus_half < 0, = 0, or > 0),
+ * whether the discarded part is nonzero, whether the exact result is
+ * negative, and whether the truncated magnitude is odd.
+ */
+inline bool reference_rounds_up(const int versus_half, const bool, const bool, const bool, round_half_away) { return versus_half >= 0; }
+inline bool reference_rounds_up(const int versus_half, const bool, const bool, const bool odd, round_half_even) { return versus_half > 0 || (versus_half == 0 && odd); }
+inline bool reference_rounds_up(const int, const bool inexact, const bool negative, const bool, round_floor) { return inexact && negative; }
+inline bool reference_rounds_up(const int, const bool, const bool, const bool, round_trunc) { return false; }
+
+/**
+ * Returns mag / 2^shift for shift on [0, 127], with the magnitude rounded
+ * as rounding requires for an exact result of the given sign.
+ */
+template <typename rounding> inline reference_u128 reference_shift_u128(const reference_u128 mag, const uint8_t shift, const bool negative, rounding) {
+  if (shift == 0u) return mag;
+
+  reference_u128 quotient;
+  bool half_bit;
+  bool low_bits;
+  if (shift < 64u) {
+    quotient.lo = (mag.lo >> shift) | (mag.hi << (64u - shift));
+    quotient.hi = mag.hi >> shift;
+    half_bit = ((mag.lo >> (shift - 1u)) & 1ull) != 0ull;
+    low_bits = (mag.lo & ((1ull << (shift - 1u)) - 1ull)) != 0ull;
+  } else if (shift == 64u) {
+    quotient.lo = mag.hi;
+    quotient.hi = 0ull;
+    half_bit = (mag.lo >> 63) != 0ull;
+    low_bits = (mag.lo & 0x7FFFFFFFFFFFFFFFull) != 0ull;
+  } else {
+    quotient.lo = mag.hi >> (shift - 64u);
+    quotient.hi = 0ull;
+    half_bit = ((mag.hi >> (shift - 65u)) & 1ull) != 0ull;
+    low_bits = mag.lo != 0ull || (mag.hi & ((1ull << (shift - 65u)) - 1ull)) != 0ull;
+  }
+
+  const int versus_half = half_bit ? (low_bits ? 1 : 0) : -1;
+  if (reference_rounds_up(versus_half, half_bit || low_bits, negative, (quotient.lo & 1ull) != 0ull, rounding())) {
+    quotient.lo++;
+    if (quotient.lo == 0ull) quotient.hi++;
+  }
+  return quotient;
+}
+
+/* Returns num / 2^shift rounded as rounding requires, exactly. */
+template <typename type, typename rounding> inline type reference_shiftround(const type num, const uint8_t shift, rounding) {
+  reference_u128 mag;
+  mag.hi = 0ull;
+  mag.lo = reference_magnitude<type>(num);
+  const bool negative = num < static_cast<type>(0);
+  return reference_apply_sign<type>(reference_shift_u128(mag, shift, negative, rounding()).lo, negative);
+}
+
+/**
+ * Returns (num * mul) / 2^shift rounded as rounding requires, exactly,
+ * with num * mul formed at 128-bit width.
+ */
+template <typename type, typename rounding> inline type reference_multshiftround(const type num, const type mul, const uint8_t shift, rounding) {
+  reference_u128 mag = reference_mul_u64(reference_magnitude<type>(num), reference_magnitude<type>(mul));
+  const bool negative = (num < static_cast<type>(0)) != (mul < static_cast<type>(0));
+  return reference_apply_sign<type>(reference_shift_u128(mag, shift, negative, rounding()).lo, negative);
+}
+
+/**
+ * Returns dividend / divisor rounded as rounding requires, exactly. The
+ * remainder is compared with half the divisor as remainder against
+ * divisor - remainder so that it cannot overflow.
+ */
+template <typename type, typename rounding> inline type reference_divround(const type dividend, const type divisor, rounding) {
+  const uint64_t dividend_mag = reference_magnitude<type>(dividend);
+  const uint64_t divisor_mag = reference_magnitude<type>(divisor);
+  uint64_t quotient = dividend_mag / divisor_mag;
+  const uint64_t remainder = dividend_mag - quotient * divisor_mag;
+  const int versus_half = (remainder < divisor_mag - remainder) ? -1 : (remainder == divisor_mag - remainder ? 0 : 1);
+  const bool negative = (dividend < static_cast<type>(0)) != (divisor < static_cast<type>(0));
+  if (reference_rounds_up(versus_half, remainder != 0ull, negative, (quotient & 1ull) != 0ull, rounding())) quotient++;
+  return reference_apply_sign<type>(quotient, negative);
+}
+
+#endif /* #ifndef INTMATH_REFERENCE_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
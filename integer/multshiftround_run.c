@@ -30,6 +30,14 @@
  * multshiftround routines additionally requires detect_product_overflow.c
  * and detect_product_overflow.h, which includes stdbool.h.
  * 
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * If you #define BRANCHLESS_ROUNDING, the rounding correction is computed
+ * from the mask arithmetically rather than by a test and branch. The
+ * results are identical; benchmark_branchless_rounding compares the two.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -40,6 +48,9 @@
  * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
  */
 
+#ifndef MULTSHIFTROUND_RUN_C_
+#define MULTSHIFTROUND_RUN_C_
+
 #include "multshiftround_run.h"
 #include "run_masks_type.h"
 
@@ -50,6 +61,9 @@
 #ifdef DEBUG_INTMATH
   #include "stdio.h"
   #include "detect_product_overflow.h" 
+#elif defined(DIAGNOSE_INTMATH)
+  #include "wide_product.h"
+  #include "intmath_diagnostics.h"
 #endif
 
 /********************************************************************************
@@ -57,7 +71,7 @@
  ********************************************************************************/
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,6]. */
-int8_t multshiftround_i8(const int8_t num, const int8_t mul, const uint8_t shift) {
+INTMATH_API int8_t multshiftround_i8(const int8_t num, const int8_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)6)
 	    fprintf(stderr, "ERROR: multshiftround_i8(%i, %i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, mul, shift, shift);
@@ -68,6 +82,16 @@ int8_t multshiftround_i8(const int8_t num, const int8_t mul, const uint8_t shift
 
     if (debug_product < (int16_t)INT8_MIN)
       fprintf(stderr, "ERROR: multshiftround_i8(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int16_t diagnose_product = (int16_t)num * (int16_t)mul;
+    if (diagnose_product > (int16_t)INT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int16_t)INT8_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)6) return (int8_t)0;
@@ -82,15 +106,19 @@ int8_t multshiftround_i8(const int8_t num, const int8_t mul, const uint8_t shift
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((prod & half_remainder) &&
-      (prod >= (int8_t)0 || (prod & ((half_remainder << 1) - (uint8_t)1)) != half_remainder))
-    return (prod >> shift) + (int8_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((((uint8_t)prod & ((half_remainder << 1) - (uint8_t)1)) + half_remainder - ((uint8_t)prod >> 7)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= (int8_t)0 || (prod & ((half_remainder << 1) - (uint8_t)1)) != half_remainder))
+      return (prod >> shift) + (int8_t)1;
 
-  return prod >> shift;
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,7]. */
-uint8_t multshiftround_u8(const uint8_t num, const uint8_t mul, const uint8_t shift) {
+INTMATH_API uint8_t multshiftround_u8(const uint8_t num, const uint8_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)7)
   	  fprintf(stderr, "ERROR: multshiftround_u8(%u, %u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, mul, shift, shift);
@@ -98,23 +126,34 @@ uint8_t multshiftround_u8(const uint8_t num, const uint8_t mul, const uint8_t sh
     uint16_t debug_product = (uint16_t)num * (uint16_t)mul;
     if (debug_product > (uint16_t)UINT8_MAX)
       fprintf(stderr, "ERROR: multshiftround_u8(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT8_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint16_t diagnose_product = (uint16_t)num * (uint16_t)mul;
+    if (diagnose_product > (uint16_t)UINT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)7) return (uint8_t)0;
   uint8_t prod = num * mul;
   if (shift == (uint8_t)0) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (prod & masks_8bit[shift])
-      return (prod >> shift) + (uint8_t)1;
-  #elif defined(COMPUTED_MASKS)
-    if (prod & (uint8_t)1 << (shift - (uint8_t)1))
-      return (prod >> shift) + (uint8_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - (uint8_t)1)) & (uint8_t)1);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_8bit[shift])
+        return (prod >> shift) + (uint8_t)1;
+    #elif defined(COMPUTED_MASKS)
+      if (prod & (uint8_t)1 << (shift - (uint8_t)1))
+        return (prod >> shift) + (uint8_t)1;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
 /********************************************************************************
@@ -122,7 +161,7 @@ uint8_t multshiftround_u8(const uint8_t num, const uint8_t mul, const uint8_t sh
  ********************************************************************************/
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,14]. */
-int16_t multshiftround_i16(const int16_t num, const int16_t mul, const uint8_t shift) {
+INTMATH_API int16_t multshiftround_i16(const int16_t num, const int16_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)14)
 	    fprintf(stderr, "ERROR: multshiftround_i16(%i, %i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, mul, shift, shift);
@@ -133,6 +172,16 @@ int16_t multshiftround_i16(const int16_t num, const int16_t mul, const uint8_t s
 
     if (debug_product < (int32_t)INT16_MIN)
       fprintf(stderr, "ERROR: multshiftround_i16(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int32_t diagnose_product = (int32_t)num * (int32_t)mul;
+    if (diagnose_product > (int32_t)INT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int32_t)INT16_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)14) return (int16_t)0;
@@ -147,15 +196,19 @@ int16_t multshiftround_i16(const int16_t num, const int16_t mul, const uint8_t s
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
   
-  if ((prod & half_remainder) &&
-      (prod >= (int16_t)0 || (prod & ((half_remainder << 1) - (uint16_t)1)) != half_remainder))
-    return (prod >> shift) + (int16_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((((uint16_t)prod & ((half_remainder << 1) - (uint16_t)1)) + half_remainder - ((uint16_t)prod >> 15)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= (int16_t)0 || (prod & ((half_remainder << 1) - (uint16_t)1)) != half_remainder))
+      return (prod >> shift) + (int16_t)1;
 
-  return prod >> shift;
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,15]. */
-uint16_t multshiftround_u16(const uint16_t num, const uint16_t mul, const uint8_t shift) {
+INTMATH_API uint16_t multshiftround_u16(const uint16_t num, const uint16_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)15)
   	  fprintf(stderr, "ERROR: multshiftround_u16(%u, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, mul, shift, shift);
@@ -163,23 +216,34 @@ uint16_t multshiftround_u16(const uint16_t num, const uint16_t mul, const uint8_
     uint32_t debug_product = (uint32_t)num * (uint32_t)mul;
     if (debug_product > (uint32_t)UINT16_MAX)
       fprintf(stderr, "ERROR: multshiftround_u16(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT16_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint32_t diagnose_product = (uint32_t)num * (uint32_t)mul;
+    if (diagnose_product > (uint32_t)UINT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)15) return (uint16_t)0;
   uint16_t prod = num * mul;
   if (shift == (uint8_t)0) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (prod & masks_16bit[shift])
-      return (prod >> shift) + (uint16_t)1;
-  #elif defined(COMPUTED_MASKS)
-    if (prod & (uint16_t)1 << (shift - (uint8_t)1))
-      return (prod >> shift) + (uint16_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - (uint8_t)1)) & (uint16_t)1);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_16bit[shift])
+        return (prod >> shift) + (uint16_t)1;
+    #elif defined(COMPUTED_MASKS)
+      if (prod & (uint16_t)1 << (shift - (uint8_t)1))
+        return (prod >> shift) + (uint16_t)1;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
 /********************************************************************************
@@ -187,7 +251,7 @@ uint16_t multshiftround_u16(const uint16_t num, const uint16_t mul, const uint8_
  ********************************************************************************/
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,30]. */
-int32_t multshiftround_i32(const int32_t num, const int32_t mul, const uint8_t shift) {
+INTMATH_API int32_t multshiftround_i32(const int32_t num, const int32_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)30)
 	    fprintf(stderr, "ERROR: multshiftround_i32(%i, %i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, shift);
@@ -198,6 +262,16 @@ int32_t multshiftround_i32(const int32_t num, const int32_t mul, const uint8_t s
 
     if (debug_product < (int64_t)INT32_MIN)
       fprintf(stderr, "ERROR: multshiftround_i32(%i, %i, %u), numerical underflow in the product %i * %i = %" PRIi64 " < %i.\n", num, mul, shift, num, mul, debug_product, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int64_t diagnose_product = (int64_t)num * (int64_t)mul;
+    if (diagnose_product > (int64_t)INT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int64_t)INT32_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)30) return 0;
@@ -212,15 +286,19 @@ int32_t multshiftround_i32(const int32_t num, const int32_t mul, const uint8_t s
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((prod & half_remainder) &&
-      (prod >= 0 || (prod & ((half_remainder << 1) - 1)) != half_remainder))
-    return (prod >> shift) + 1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + (int32_t)((((uint32_t)prod & ((half_remainder << 1) - 1u)) + half_remainder - ((uint32_t)prod >> 31)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= 0 || (prod & ((half_remainder << 1) - 1)) != half_remainder))
+      return (prod >> shift) + 1;
 
-  return prod >> shift;
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,31]. */
-uint32_t multshiftround_u32(const uint32_t num, const uint32_t mul, const uint8_t shift) {
+INTMATH_API uint32_t multshiftround_u32(const uint32_t num, const uint32_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)31)
 	    fprintf(stderr, "ERROR: multshiftround_u32(%u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, shift);
@@ -228,23 +306,34 @@ uint32_t multshiftround_u32(const uint32_t num, const uint32_t mul, const uint8_
     uint64_t debug_product = (uint64_t)num * (uint64_t)mul;
     if (debug_product > (uint64_t)UINT32_MAX)
       fprintf(stderr, "ERROR: multshiftround_u32(%u, %u, %u), numerical overflow in the product %u * %u = %" PRIu64 " > %u.\n", num, mul, shift, num, mul, debug_product, UINT32_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint64_t diagnose_product = (uint64_t)num * (uint64_t)mul;
+    if (diagnose_product > (uint64_t)UINT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)31) return 0u;
   uint32_t prod = num * mul;
   if (shift == (uint8_t)0) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (prod & masks_32bit[shift])
-      return (prod >> shift) + 1u;
-  #elif defined(COMPUTED_MASKS)
-    if (prod & 1u << (shift - (uint8_t)1))
-      return (prod >> shift) + 1u;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - (uint8_t)1)) & 1u);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_32bit[shift])
+        return (prod >> shift) + 1u;
+    #elif defined(COMPUTED_MASKS)
+      if (prod & 1u << (shift - (uint8_t)1))
+        return (prod >> shift) + 1u;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
 /********************************************************************************
@@ -252,13 +341,19 @@ uint32_t multshiftround_u32(const uint32_t num, const uint32_t mul, const uint8_
  ********************************************************************************/
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,62]. */
-int64_t multshiftround_i64(const int64_t num, const int64_t mul, const uint8_t shift) {
+INTMATH_API int64_t multshiftround_i64(const int64_t num, const int64_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)62)
 	    fprintf(stderr, "ERROR: multshiftround_i64(%" PRIi64 ", %" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, shift);
 
     if (detect_product_overflow_i64(num, mul))
       fprintf(stderr, "ERROR: multshiftround_i64(%" PRIi64 ", %" PRIi64 ", %u), numerical overflow or underflow in the product %" PRIi64 " * %" PRIi64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_i64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)62) return 0ll;
@@ -273,40 +368,56 @@ int64_t multshiftround_i64(const int64_t num, const int64_t mul, const uint8_t s
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((prod & half_remainder) &&
-      (prod >= 0ll || (prod & ((half_remainder << 1) - 1ll)) != half_remainder))
-    return (prod >> shift) + 1ll;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + (int64_t)((((uint64_t)prod & ((half_remainder << 1) - 1ull)) + half_remainder - ((uint64_t)prod >> 63)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= 0ll || (prod & ((half_remainder << 1) - 1ll)) != half_remainder))
+      return (prod >> shift) + 1ll;
 
-  return prod >> shift;
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,63]. */
-uint64_t multshiftround_u64(const uint64_t num, const uint64_t mul, const uint8_t shift) {
+INTMATH_API uint64_t multshiftround_u64(const uint64_t num, const uint64_t mul, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)63)
-	    fprintf(stderr, "ERROR: multshiftround<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, shift);
+	    fprintf(stderr, "ERROR: multshiftround_u64(%" PRIu64 ", %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, shift);
 
     if (detect_product_overflow_u64(num, mul))
-      fprintf(stderr, "ERROR: multshiftround<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u), numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, mul, shift, num, mul);
+      fprintf(stderr, "ERROR: multshiftround_u64(%" PRIu64 ", %" PRIu64 ", %u), numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_u64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
   #endif
 
   if (shift > (uint8_t)63) return 0ull;
   uint64_t prod = num * mul;
   if (shift == (uint8_t)0) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (prod & masks_64bit[shift])
-      return (prod >> shift) + 1ull;
-  #elif defined(COMPUTED_MASKS)
-    if (prod & 1ull << (shift - (uint8_t)1))
-      return (prod >> shift) + 1ull;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - (uint8_t)1)) & 1ull);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_64bit[shift])
+        return (prod >> shift) + 1ull;
+    #elif defined(COMPUTED_MASKS)
+      if (prod & 1ull << (shift - (uint8_t)1))
+        return (prod >> shift) + 1ull;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
+#endif /* #ifndef MULTSHIFTROUND_RUN_C_ */
+
 /*
 Creative Commons Legal Code
 
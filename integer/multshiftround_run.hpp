@@ -13,6 +13,9 @@
  * types. shift may range from 0 to two less than the word length of type for
  * signed types.
  *
+ * multshiftround<type, rounding>(num, mul, shift) rounds as selected by one
+ * of the tags in rounding_policy.hpp instead, e.g. round_half_even.
+ *
  * Correct operation for negative signed inputs requires two things:
  * 1. The representation of signed integers must be 2's complement.
  * 2. The compiler must encode right shifts on signed types as arithmetic
@@ -29,6 +32,13 @@
  * multshiftround routines additionally require detect_product_overflow.c
  * and detect_product_overflow.h, which includes stdbool.h.
  *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * #define BRANCHLESS_ROUNDING to compute the round_half_away correction
+ * arithmetically instead of with a test and branch, as in multshiftround_run.c.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -42,7 +52,10 @@
 #define MULTSHIFTROUND_RUN_HPP_
 
 #include <cinttypes>
+#include <limits>
+#include <type_traits>
 #include "run_masks_type.h"
+#include "rounding_policy.hpp"
 
 #ifdef ARRAY_MASKS
   #ifdef __cplusplus
@@ -66,6 +79,17 @@
   #ifdef __cplusplus
     }
   #endif
+#elif defined(DIAGNOSE_INTMATH)
+  #include <limits>
+  #include "wide_product.h"
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
 #endif
 
 /* Allows static_assert message in multshiftround primary template to compile. */
@@ -95,6 +119,16 @@ template <> inline int8_t multshiftround<int8_t>(const int8_t num, const int8_t
 
     if (debug_product < static_cast<int16_t>(std::numeric_limits<int8_t>::min()))
       std::fprintf(stderr, "ERROR: multshiftround<int8_t>(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, std::numeric_limits<int8_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(6))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<int8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    int16_t diagnose_product = static_cast<int16_t>(num) * static_cast<int16_t>(mul);
+    if (diagnose_product > static_cast<int16_t>(std::numeric_limits<int8_t>::max()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    if (diagnose_product < static_cast<int16_t>(std::numeric_limits<int8_t>::min()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(6)) return static_cast<int8_t>(0);
@@ -109,12 +143,16 @@ template <> inline int8_t multshiftround<int8_t>(const int8_t num, const int8_t
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((prod & half_remainder) &&
-      (prod >= static_cast<int8_t>(0) ||
-       (prod & ((half_remainder << 1) - static_cast<uint8_t>(1))) != half_remainder))
-    return (prod >> shift) + static_cast<int8_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + static_cast<int8_t>(((static_cast<uint8_t>(prod) & ((half_remainder << 1) - static_cast<uint8_t>(1))) + half_remainder - (static_cast<uint8_t>(prod) >> 7)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= static_cast<int8_t>(0) ||
+         (prod & ((half_remainder << 1) - static_cast<uint8_t>(1))) != half_remainder))
+      return (prod >> shift) + static_cast<int8_t>(1);
 
-  return prod >> shift;
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,7]. */
@@ -126,23 +164,34 @@ template <> inline uint8_t multshiftround<uint8_t>(const uint8_t num, const uint
     uint16_t debug_product = static_cast<uint16_t>(num) * static_cast<uint16_t>(mul);
     if (debug_product > static_cast<uint16_t>(std::numeric_limits<uint8_t>::max()))
       std::fprintf(stderr, "ERROR: multshiftround<uint8_t>(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, std::numeric_limits<uint8_t>::max());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(7))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<uint8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    uint16_t diagnose_product = static_cast<uint16_t>(num) * static_cast<uint16_t>(mul);
+    if (diagnose_product > static_cast<uint16_t>(std::numeric_limits<uint8_t>::max()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<uint8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(7)) return static_cast<uint8_t>(0);
   uint8_t prod = num * mul;
   if (shift == static_cast<uint8_t>(0)) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (prod & masks_8bit[shift])
-      return (prod >> shift) + static_cast<uint8_t>(1);
-  #elif defined(COMPUTED_MASKS)
-    if (prod & static_cast<uint8_t>(1) << (shift - static_cast<uint8_t>(1)))
-      return (prod >> shift) + static_cast<uint8_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - static_cast<uint8_t>(1))) & static_cast<uint8_t>(1));
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_8bit[shift])
+        return (prod >> shift) + static_cast<uint8_t>(1);
+    #elif defined(COMPUTED_MASKS)
+      if (prod & static_cast<uint8_t>(1) << (shift - static_cast<uint8_t>(1)))
+        return (prod >> shift) + static_cast<uint8_t>(1);
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
 /********************************************************************************
@@ -161,6 +210,16 @@ template <> inline int16_t multshiftround<int16_t>(const int16_t num, const int1
 
     if (debug_product < static_cast<int32_t>(std::numeric_limits<int16_t>::min()))
       std::fprintf(stderr, "ERROR: multshiftround<int16_t>(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, std::numeric_limits<int16_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(14))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<int16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    int32_t diagnose_product = static_cast<int32_t>(num) * static_cast<int32_t>(mul);
+    if (diagnose_product > static_cast<int32_t>(std::numeric_limits<int16_t>::max()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    if (diagnose_product < static_cast<int32_t>(std::numeric_limits<int16_t>::min()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(14)) return static_cast<int16_t>(0);
@@ -175,12 +234,16 @@ template <> inline int16_t multshiftround<int16_t>(const int16_t num, const int1
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((prod & half_remainder) &&
-      (prod >= static_cast<int16_t>(0) ||
-       (prod & ((half_remainder << 1) - static_cast<uint16_t>(1))) != half_remainder))
-    return (prod >> shift) + static_cast<int16_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + static_cast<int16_t>(((static_cast<uint16_t>(prod) & ((half_remainder << 1) - static_cast<uint16_t>(1))) + half_remainder - (static_cast<uint16_t>(prod) >> 15)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= static_cast<int16_t>(0) ||
+         (prod & ((half_remainder << 1) - static_cast<uint16_t>(1))) != half_remainder))
+      return (prod >> shift) + static_cast<int16_t>(1);
 
-  return prod >> shift;
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,15]. */
@@ -192,23 +255,34 @@ template <> inline uint16_t multshiftround<uint16_t>(const uint16_t num, const u
     uint32_t debug_product = static_cast<uint32_t>(num) * static_cast<uint32_t>(mul);
     if (debug_product > static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()))
       std::fprintf(stderr, "ERROR: multshiftround<uint16_t>(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, std::numeric_limits<uint16_t>::max());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(15))
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<uint16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    uint32_t diagnose_product = static_cast<uint32_t>(num) * static_cast<uint32_t>(mul);
+    if (diagnose_product > static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<uint16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(15)) return static_cast<uint16_t>(0);
   uint16_t prod = num * mul;
   if (shift == static_cast<uint8_t>(0)) return prod;
   
-  #ifdef ARRAY_MASKS
-    if (prod & masks_16bit[shift])
-      return (prod >> shift) + static_cast<uint16_t>(1);
-  #elif defined(COMPUTED_MASKS)
-    if (prod & static_cast<uint16_t>(1) << (shift - static_cast<uint8_t>(1)))
-      return (prod >> shift) + static_cast<uint16_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - static_cast<uint8_t>(1))) & static_cast<uint16_t>(1));
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_16bit[shift])
+        return (prod >> shift) + static_cast<uint16_t>(1);
+    #elif defined(COMPUTED_MASKS)
+      if (prod & static_cast<uint16_t>(1) << (shift - static_cast<uint8_t>(1)))
+        return (prod >> shift) + static_cast<uint16_t>(1);
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
 /********************************************************************************
@@ -227,6 +301,16 @@ template <> inline int32_t multshiftround<int32_t>(const int32_t num, const int3
 
     if (debug_product < static_cast<int64_t>(std::numeric_limits<int32_t>::min()))
       std::fprintf(stderr, "ERROR: multshiftround<int32_t>(%i, %i, %u), numerical underflow in the product %i * %i = %" PRIi64 " < %i.\n", num, mul, shift, num, mul, debug_product, std::numeric_limits<int32_t>::min());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(30))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<int32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    int64_t diagnose_product = static_cast<int64_t>(num) * static_cast<int64_t>(mul);
+    if (diagnose_product > static_cast<int64_t>(std::numeric_limits<int32_t>::max()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    if (diagnose_product < static_cast<int64_t>(std::numeric_limits<int32_t>::min()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(30)) return 0;
@@ -241,11 +325,15 @@ template <> inline int32_t multshiftround<int32_t>(const int32_t num, const int3
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
   
-  if ((prod & half_remainder) &&
-      (prod >= 0 || (prod & ((half_remainder << 1) - 1u)) != half_remainder))
-    return (prod >> shift) + 1;
-  
-  return prod >> shift;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + static_cast<int32_t>(((static_cast<uint32_t>(prod) & ((half_remainder << 1) - 1u)) + half_remainder - (static_cast<uint32_t>(prod) >> 31)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= 0 || (prod & ((half_remainder << 1) - 1u)) != half_remainder))
+      return (prod >> shift) + 1;
+
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,31]. */
@@ -257,23 +345,34 @@ template <> inline uint32_t multshiftround<uint32_t>(const uint32_t num, const u
     uint64_t debug_product = static_cast<uint64_t>(num) * static_cast<uint64_t>(mul);
     if (debug_product > static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()))
       std::fprintf(stderr, "ERROR: multshiftround<uint32_t>(%u, %u, %u), numerical overflow in the product %u * %u = %" PRIu64 " > %u.\n", num, mul, shift, num, mul, debug_product, std::numeric_limits<uint32_t>::max());
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(31))
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<uint32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    uint64_t diagnose_product = static_cast<uint64_t>(num) * static_cast<uint64_t>(mul);
+    if (diagnose_product > static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<uint32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(31)) return 0u;
   uint32_t prod = num * mul;
   if (shift == static_cast<uint8_t>(0)) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (prod & masks_32bit[shift])
-      return (prod >> shift) + 1u;
-  #elif defined(COMPUTED_MASKS)
-    if (prod & 1u << (shift - static_cast<uint8_t>(1)))
-      return (prod >> shift) + 1u;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - static_cast<uint8_t>(1))) & 1u);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_32bit[shift])
+        return (prod >> shift) + 1u;
+    #elif defined(COMPUTED_MASKS)
+      if (prod & 1u << (shift - static_cast<uint8_t>(1)))
+        return (prod >> shift) + 1u;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
   #endif
-
-  return prod >> shift;
 }
 
 /********************************************************************************
@@ -288,6 +387,12 @@ template <> inline int64_t multshiftround<int64_t>(const int64_t num, const int6
 
     if (detect_product_overflow_i64(num, mul))
       std::fprintf(stderr, "ERROR: multshiftround<int64_t>(%" PRIi64 ", %" PRIi64 ", %u), numerical overflow or underflow in the product %" PRIi64 " * %" PRIi64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(62))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<int64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    if (wide_mul_overflows_i64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(62)) return 0ll;
@@ -302,11 +407,15 @@ template <> inline int64_t multshiftround<int64_t>(const int64_t num, const int6
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((prod & half_remainder) &&
-      (prod >= 0ll || (prod & ((half_remainder << 1) - 1ull)) != half_remainder))
-    return (prod >> shift) + 1ll;
-  
-  return prod >> shift;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + static_cast<int64_t>(((static_cast<uint64_t>(prod) & ((half_remainder << 1) - 1ull)) + half_remainder - (static_cast<uint64_t>(prod) >> 63)) >> shift);
+  #else
+    if ((prod & half_remainder) &&
+        (prod >= 0ll || (prod & ((half_remainder << 1) - 1ull)) != half_remainder))
+      return (prod >> shift) + 1ll;
+
+    return prod >> shift;
+  #endif
 }
 
 /* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,63]. */
@@ -317,23 +426,105 @@ template <> inline uint64_t multshiftround<uint64_t>(const uint64_t num, const u
 
     if (detect_product_overflow_u64(num, mul))
       std::fprintf(stderr, "ERROR: multshiftround<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u), numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(63))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<uint64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    if (wide_mul_overflows_u64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<uint64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
   #endif
 
   if (shift > static_cast<uint8_t>(63)) return 0ull;
   uint64_t prod = num * mul;
   if (shift == static_cast<uint8_t>(0)) return prod;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_64bit[shift])
-      return (num >> shift) + 1ull;
-  #elif defined(COMPUTED_MASKS)
-    if (num & 1ull << (shift - static_cast<uint8_t>(1)))
-      return (num >> shift) + 1ull;
+  #ifdef BRANCHLESS_ROUNDING
+    return (prod >> shift) + ((prod >> (shift - static_cast<uint8_t>(1))) & 1ull);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (prod & masks_64bit[shift])
+        return (prod >> shift) + 1ull;
+    #elif defined(COMPUTED_MASKS)
+      if (prod & 1ull << (shift - static_cast<uint8_t>(1)))
+        return (prod >> shift) + 1ull;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return prod >> shift;
+  #endif
+}
+
+/********************************************************************************
+ ********                   rounding policy overloads                    ********
+ ********************************************************************************/
+
+#if defined(DEBUG_INTMATH) || defined(DIAGNOSE_INTMATH)
+/* True if num * mul does not fit in type. Narrower products are formed exactly in 64 bits. */
+template <typename type> inline bool multshiftround_run_overflows(const type num, const type mul) {
+  typedef typename std::conditional<std::is_signed<type>::value, int64_t, uint64_t>::type wide;
+  const wide product = static_cast<wide>(num) * static_cast<wide>(mul);
+  return product > static_cast<wide>(std::numeric_limits<type>::max()) || product < static_cast<wide>(std::numeric_limits<type>::lowest());
+}
+
+inline bool multshiftround_run_overflows(const int64_t num, const int64_t mul) {
+  #ifdef DEBUG_INTMATH
+    return detect_product_overflow_i64(num, mul);
+  #else
+    return wide_mul_overflows_i64(num, mul) != 0;
   #endif
+}
 
-  return prod >> shift;
+inline bool multshiftround_run_overflows(const uint64_t num, const uint64_t mul) {
+  #ifdef DEBUG_INTMATH
+    return detect_product_overflow_u64(num, mul);
+  #else
+    return wide_mul_overflows_u64(num, mul) != 0;
+  #endif
+}
+#endif
+
+/* round_half_away is the multshiftround<type> specialization above. */
+template <typename type> inline type multshiftround_run_policy(const type num, const type mul, const uint8_t shift, round_half_away) {
+  return multshiftround<type>(num, mul, shift);
+}
+
+/**
+ * Checks shift and the product as the multshiftround<type> specializations
+ * do and applies the rounding step from rounding_policy.hpp to the product.
+ * Only round_half_even needs the shift = 0 test.
+ */
+template <typename type, typename rounding> inline type multshiftround_run_policy(const type num, const type mul, const uint8_t shift, rounding) {
+  #ifdef DEBUG_INTMATH
+    char num_text[24];
+    char mul_text[24];
+    if (shift >= std::numeric_limits<type>::digits)
+      std::fprintf(stderr, "ERROR: %s(%s, %s, %u), shift = %u is invalid; it must be on the range [0,%i].\n", rounding_policy_name<ROUNDING_POLICY_MULTSHIFTROUND, type, rounding>(), rounding_policy_text<type>(num, num_text), rounding_policy_text<type>(mul, mul_text), shift, shift, std::numeric_limits<type>::digits - 1);
+
+    if (multshiftround_run_overflows(num, mul))
+      std::fprintf(stderr, "ERROR: %s(%s, %s, %u), numerical overflow or underflow in the product %s * %s.\n", rounding_policy_name<ROUNDING_POLICY_MULTSHIFTROUND, type, rounding>(), rounding_policy_text<type>(num, num_text), rounding_policy_text<type>(mul, mul_text), shift, num_text, mul_text);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift >= std::numeric_limits<type>::digits)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, rounding_policy_name<ROUNDING_POLICY_MULTSHIFTROUND, type, rounding>(), static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+
+    if (multshiftround_run_overflows(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, rounding_policy_name<ROUNDING_POLICY_MULTSHIFTROUND, type, rounding>(), static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  if (shift >= std::numeric_limits<type>::digits) return static_cast<type>(0);
+  const type prod = static_cast<type>(num * mul);
+  if (std::is_same<rounding, round_half_even>::value && shift == static_cast<uint8_t>(0)) return prod;
+  return rounding_policy_shift<type>(prod, shift, rounding());
+}
+
+/**
+ * Returns (num * mul) / 2^shift rounded as selected by rounding, one of the
+ * tags in rounding_policy.hpp. shift has the same range as in
+ * multshiftround<type>, and num * mul must not overflow.
+ */
+template <typename type, typename rounding> inline type multshiftround(const type num, const type mul, const uint8_t shift) {
+  static_assert(is_rounding_policy<rounding>::value, "type multshiftround<type, rounding>(const type num, const type mul, const uint8_t shift); rounding must be a tag from rounding_policy.hpp.");
+  return multshiftround_run_policy<type>(num, mul, shift, rounding());
 }
 
 #endif /* #ifndef MULTSHIFTROUND_RUN_HPP_ */
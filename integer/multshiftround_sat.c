@@ -0,0 +1,1951 @@
+/**
+ * multshiftround_sat.c
+ * Defines functions of the form
+ *   out_type multshiftround_sat_X_Y(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ *   void multshiftround_sat_batch_X_Y(const in_type *num, out_type *result, const size_t length, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ * which return or store ROUND((num * mul) / 2^shift) saturated to the range
+ * [lower_bound, upper_bound] without using the division operator. X is the
+ * abbreviation of in_type and Y the abbreviation of out_type. out_type has
+ * the same or a smaller width than in_type and either signedness.
+ *
+ * These fuse multshiftround and saturate_value. Calling multshiftround_X
+ * and then saturate_value_Y needs num * mul to fit in in_type and its
+ * result to fit in out_type, and the batch form would make a second pass
+ * over the buffer. Here the product is formed at twice the width of
+ * in_type (at 128 bits through wide_product.h for 64-bit in_types), rounded
+ * at that width, and compared against the bounds before it is narrowed,
+ * so no intermediate value can overflow. Any num and mul may be used.
+ *
+ * When out_type is unsigned and in_type signed, a result below 0 saturates
+ * to lower_bound. When out_type is signed and in_type unsigned, the result
+ * is at least 0, so a negative lower_bound acts as 0 and a negative
+ * upper_bound is always the result.
+ *
+ * The batch functions keep shift, mul, and the bounds fixed across the
+ * array so that compilers can vectorize the loops for 8, 16, and 32-bit
+ * in_types.
+ *
+ * shift may range from 0 to 2N-2 for N-bit signed in_types and from 0 to
+ * 2N-1 for N-bit unsigned in_types. 0 is returned or stored for invalid
+ * shift arguments.
+ *
+ * Rounding is half away from zero, as in the rest of this library.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments will be
+ * enabled. This requires the availability of stderr and fprintf() on the
+ * target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef MULTSHIFTROUND_SAT_C_
+#define MULTSHIFTROUND_SAT_C_
+
+#include "multshiftround_sat.h"
+#include "wide_product.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+#endif
+
+/********************************************************************************
+ ********                        internal helpers                        ********
+ ********************************************************************************/
+
+/**
+ * Returns ROUND(prod / 2^shift) for the full width product prod of two
+ * N-bit values. shift must be on the range [0,2N-2] for signed types and
+ * [0,2N-1] for unsigned types. Neither the product nor the rounding offset
+ * can overflow the 2N-bit type: a signed product has magnitude at most
+ * 2^(2N-2), and the unsigned form adds the rounding bit after shifting.
+ * prod >> (2N-1) is -1 for negative products and 0 otherwise, which moves
+ * ties away from zero without a comparison that would block vectorization.
+ */
+static inline int16_t multshiftround_sat_product_i8(const int8_t num, const int8_t mul, const uint8_t shift) {
+  int16_t prod = (int16_t)num * (int16_t)mul;
+  if (shift == (uint8_t)0) return prod;
+  return (int16_t)((prod + ((int16_t)1 << (shift - 1u)) + (prod >> 15)) >> shift);
+}
+
+static inline uint16_t multshiftround_sat_product_u8(const uint8_t num, const uint8_t mul, const uint8_t shift) {
+  uint16_t prod = (uint16_t)num * (uint16_t)mul;
+  if (shift == (uint8_t)0) return prod;
+  return (uint16_t)((prod >> shift) + ((prod >> (shift - 1u)) & 1u));
+}
+
+static inline int32_t multshiftround_sat_product_i16(const int16_t num, const int16_t mul, const uint8_t shift) {
+  int32_t prod = (int32_t)num * (int32_t)mul;
+  if (shift == (uint8_t)0) return prod;
+  return (int32_t)((prod + ((int32_t)1 << (shift - 1u)) + (prod >> 31)) >> shift);
+}
+
+static inline uint32_t multshiftround_sat_product_u16(const uint16_t num, const uint16_t mul, const uint8_t shift) {
+  uint32_t prod = (uint32_t)num * (uint32_t)mul;
+  if (shift == (uint8_t)0) return prod;
+  return (uint32_t)((prod >> shift) + ((prod >> (shift - 1u)) & 1u));
+}
+
+static inline int64_t multshiftround_sat_product_i32(const int32_t num, const int32_t mul, const uint8_t shift) {
+  int64_t prod = (int64_t)num * (int64_t)mul;
+  if (shift == (uint8_t)0) return prod;
+  return (int64_t)((prod + (1ll << (shift - 1u)) + (prod >> 63)) >> shift);
+}
+
+static inline uint64_t multshiftround_sat_product_u32(const uint32_t num, const uint32_t mul, const uint8_t shift) {
+  uint64_t prod = (uint64_t)num * (uint64_t)mul;
+  if (shift == (uint8_t)0) return prod;
+  return (uint64_t)((prod >> shift) + ((prod >> (shift - 1u)) & 1u));
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]
+ * with the product and rounding done at 128 bits by the helpers in
+ * wide_product.h. A rounded result that does not fit in 64 bits is past
+ * one bound or the other, as given by the sign of its high word.
+ */
+static inline int64_t multshiftround_sat_wide_i64(const int64_t num, const int64_t mul, const uint8_t shift, const int64_t lower_bound, const int64_t upper_bound) {
+  int64_t prod_hi;
+  uint64_t prod_lo = wide_mul_i64(num, mul, &prod_hi);
+  int64_t result_hi;
+  int64_t result = (int64_t)wide_shiftround_i128(prod_hi, prod_lo, shift, &result_hi);
+  if (result_hi != (result >> 63)) return result_hi < 0ll ? lower_bound : upper_bound;
+  if (result < lower_bound) return lower_bound;
+  if (result > upper_bound) return upper_bound;
+  return result;
+}
+
+static inline uint64_t multshiftround_sat_wide_u64(const uint64_t num, const uint64_t mul, const uint8_t shift, const uint64_t lower_bound, const uint64_t upper_bound) {
+  uint64_t prod_hi;
+  uint64_t prod_lo = wide_mul_u64(num, mul, &prod_hi);
+  uint64_t result_hi;
+  uint64_t result = wide_shiftround_u128(prod_hi, prod_lo, shift, &result_hi);
+  if (result_hi != 0ull) return upper_bound;
+  if (result < lower_bound) return lower_bound;
+  if (result > upper_bound) return upper_bound;
+  return result;
+}
+
+/**
+ * As multshiftround_sat_wide_i64, but with unsigned bounds, which need
+ * not fit in int64_t. The rounded result is compared against them only
+ * once its high word shows that it lies on [0, 2^64).
+ */
+static inline uint64_t multshiftround_sat_wide_i64_u64(const int64_t num, const int64_t mul, const uint8_t shift, const uint64_t lower_bound, const uint64_t upper_bound) {
+  int64_t prod_hi;
+  uint64_t prod_lo = wide_mul_i64(num, mul, &prod_hi);
+  int64_t result_hi;
+  uint64_t result = wide_shiftround_i128(prod_hi, prod_lo, shift, &result_hi);
+  if (result_hi < 0ll) return lower_bound;
+  if (result_hi > 0ll) return upper_bound;
+  if (result < lower_bound) return lower_bound;
+  if (result > upper_bound) return upper_bound;
+  return result;
+}
+
+/********************************************************************************
+ ********               int8_t and uint8_t input functions               ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,14]. */
+INTMATH_API int8_t multshiftround_sat_i8_i8(const int8_t num, const int8_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: multshiftround_sat_i8_i8(%i, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,14].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i8_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) return (int8_t)0;
+  int16_t rounded = multshiftround_sat_product_i8(num, mul, shift);
+  if (rounded < (int16_t)lower_bound) return lower_bound;
+  if (rounded > (int16_t)upper_bound) return upper_bound;
+  return (int8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,14]. */
+INTMATH_API void multshiftround_sat_batch_i8_i8(const int8_t *num, int8_t *result, const size_t length, const int8_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i8_i8(num, result, %lu, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,14].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i8_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int16_t rounded = multshiftround_sat_product_i8(num[j], mul, shift);
+    if (rounded < (int16_t)lower_bound) rounded = (int16_t)lower_bound;
+    if (rounded > (int16_t)upper_bound) rounded = (int16_t)upper_bound;
+    result[j] = (int8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,15]. */
+INTMATH_API uint8_t multshiftround_sat_u8_u8(const uint8_t num, const uint8_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: multshiftround_sat_u8_u8(%u, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u8_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint8_t)0;
+  uint16_t rounded = multshiftround_sat_product_u8(num, mul, shift);
+  if (rounded < (uint16_t)lower_bound) return lower_bound;
+  if (rounded > (uint16_t)upper_bound) return upper_bound;
+  return (uint8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,15]. */
+INTMATH_API void multshiftround_sat_batch_u8_u8(const uint8_t *num, uint8_t *result, const size_t length, const uint8_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u8_u8(num, result, %lu, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u8_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    uint16_t rounded = multshiftround_sat_product_u8(num[j], mul, shift);
+    if (rounded < (uint16_t)lower_bound) rounded = (uint16_t)lower_bound;
+    if (rounded > (uint16_t)upper_bound) rounded = (uint16_t)upper_bound;
+    result[j] = (uint8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,14]. */
+INTMATH_API uint8_t multshiftround_sat_i8_u8(const int8_t num, const int8_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: multshiftround_sat_i8_u8(%i, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i8_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) return (uint8_t)0;
+  int16_t rounded = multshiftround_sat_product_i8(num, mul, shift);
+  if (rounded < (int16_t)lower_bound) return lower_bound;
+  if (rounded > (int16_t)upper_bound) return upper_bound;
+  return (uint8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,14]. */
+INTMATH_API void multshiftround_sat_batch_i8_u8(const int8_t *num, uint8_t *result, const size_t length, const int8_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i8_u8(num, result, %lu, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,14].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i8_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int16_t rounded = multshiftround_sat_product_i8(num[j], mul, shift);
+    if (rounded < (int16_t)lower_bound) rounded = (int16_t)lower_bound;
+    if (rounded > (int16_t)upper_bound) rounded = (int16_t)upper_bound;
+    result[j] = (uint8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,15]. */
+INTMATH_API int8_t multshiftround_sat_u8_i8(const uint8_t num, const uint8_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: multshiftround_sat_u8_i8(%u, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,15].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u8_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) return (int8_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) return upper_bound;
+  uint16_t lower = (lower_bound < (int8_t)0) ? (uint16_t)0 : (uint16_t)lower_bound;
+  uint16_t rounded = multshiftround_sat_product_u8(num, mul, shift);
+  if (rounded < lower) return (int8_t)lower;
+  if (rounded > (uint16_t)upper_bound) return upper_bound;
+  return (int8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,15]. */
+INTMATH_API void multshiftround_sat_batch_u8_i8(const uint8_t *num, int8_t *result, const size_t length, const uint8_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u8_i8(num, result, %lu, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,15].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u8_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint16_t lower = (lower_bound < (int8_t)0) ? (uint16_t)0 : (uint16_t)lower_bound;
+  for (j = 0u; j < length; j++) {
+    uint16_t rounded = multshiftround_sat_product_u8(num[j], mul, shift);
+    if (rounded < lower) rounded = lower;
+    if (rounded > (uint16_t)upper_bound) rounded = (uint16_t)upper_bound;
+    result[j] = (int8_t)rounded;
+  }
+}
+
+/********************************************************************************
+ ********              int16_t and uint16_t input functions              ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,30]. */
+INTMATH_API int8_t multshiftround_sat_i16_i8(const int16_t num, const int16_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_i16_i8(%i, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i16_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return (int8_t)0;
+  int32_t rounded = multshiftround_sat_product_i16(num, mul, shift);
+  if (rounded < (int32_t)lower_bound) return lower_bound;
+  if (rounded > (int32_t)upper_bound) return upper_bound;
+  return (int8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,30]. */
+INTMATH_API void multshiftround_sat_batch_i16_i8(const int16_t *num, int8_t *result, const size_t length, const int16_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i16_i8(num, result, %lu, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,30].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i16_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int32_t rounded = multshiftround_sat_product_i16(num[j], mul, shift);
+    if (rounded < (int32_t)lower_bound) rounded = (int32_t)lower_bound;
+    if (rounded > (int32_t)upper_bound) rounded = (int32_t)upper_bound;
+    result[j] = (int8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,30]. */
+INTMATH_API int16_t multshiftround_sat_i16_i16(const int16_t num, const int16_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_i16_i16(%i, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i16_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return (int16_t)0;
+  int32_t rounded = multshiftround_sat_product_i16(num, mul, shift);
+  if (rounded < (int32_t)lower_bound) return lower_bound;
+  if (rounded > (int32_t)upper_bound) return upper_bound;
+  return (int16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,30]. */
+INTMATH_API void multshiftround_sat_batch_i16_i16(const int16_t *num, int16_t *result, const size_t length, const int16_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i16_i16(num, result, %lu, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,30].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i16_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int32_t rounded = multshiftround_sat_product_i16(num[j], mul, shift);
+    if (rounded < (int32_t)lower_bound) rounded = (int32_t)lower_bound;
+    if (rounded > (int32_t)upper_bound) rounded = (int32_t)upper_bound;
+    result[j] = (int16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,31]. */
+INTMATH_API uint8_t multshiftround_sat_u16_u8(const uint16_t num, const uint16_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_u16_u8(%u, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u16_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return (uint8_t)0;
+  uint32_t rounded = multshiftround_sat_product_u16(num, mul, shift);
+  if (rounded < (uint32_t)lower_bound) return lower_bound;
+  if (rounded > (uint32_t)upper_bound) return upper_bound;
+  return (uint8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,31]. */
+INTMATH_API void multshiftround_sat_batch_u16_u8(const uint16_t *num, uint8_t *result, const size_t length, const uint16_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u16_u8(num, result, %lu, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u16_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    uint32_t rounded = multshiftround_sat_product_u16(num[j], mul, shift);
+    if (rounded < (uint32_t)lower_bound) rounded = (uint32_t)lower_bound;
+    if (rounded > (uint32_t)upper_bound) rounded = (uint32_t)upper_bound;
+    result[j] = (uint8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,31]. */
+INTMATH_API uint16_t multshiftround_sat_u16_u16(const uint16_t num, const uint16_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_u16_u16(%u, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u16_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return (uint16_t)0;
+  uint32_t rounded = multshiftround_sat_product_u16(num, mul, shift);
+  if (rounded < (uint32_t)lower_bound) return lower_bound;
+  if (rounded > (uint32_t)upper_bound) return upper_bound;
+  return (uint16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,31]. */
+INTMATH_API void multshiftround_sat_batch_u16_u16(const uint16_t *num, uint16_t *result, const size_t length, const uint16_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u16_u16(num, result, %lu, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u16_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    uint32_t rounded = multshiftround_sat_product_u16(num[j], mul, shift);
+    if (rounded < (uint32_t)lower_bound) rounded = (uint32_t)lower_bound;
+    if (rounded > (uint32_t)upper_bound) rounded = (uint32_t)upper_bound;
+    result[j] = (uint16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,30]. */
+INTMATH_API uint8_t multshiftround_sat_i16_u8(const int16_t num, const int16_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_i16_u8(%i, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i16_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return (uint8_t)0;
+  int32_t rounded = multshiftround_sat_product_i16(num, mul, shift);
+  if (rounded < (int32_t)lower_bound) return lower_bound;
+  if (rounded > (int32_t)upper_bound) return upper_bound;
+  return (uint8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,30]. */
+INTMATH_API void multshiftround_sat_batch_i16_u8(const int16_t *num, uint8_t *result, const size_t length, const int16_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i16_u8(num, result, %lu, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,30].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i16_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int32_t rounded = multshiftround_sat_product_i16(num[j], mul, shift);
+    if (rounded < (int32_t)lower_bound) rounded = (int32_t)lower_bound;
+    if (rounded > (int32_t)upper_bound) rounded = (int32_t)upper_bound;
+    result[j] = (uint8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,30]. */
+INTMATH_API uint16_t multshiftround_sat_i16_u16(const int16_t num, const int16_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_i16_u16(%i, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i16_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return (uint16_t)0;
+  int32_t rounded = multshiftround_sat_product_i16(num, mul, shift);
+  if (rounded < (int32_t)lower_bound) return lower_bound;
+  if (rounded > (int32_t)upper_bound) return upper_bound;
+  return (uint16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,30]. */
+INTMATH_API void multshiftround_sat_batch_i16_u16(const int16_t *num, uint16_t *result, const size_t length, const int16_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i16_u16(num, result, %lu, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,30].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i16_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int32_t rounded = multshiftround_sat_product_i16(num[j], mul, shift);
+    if (rounded < (int32_t)lower_bound) rounded = (int32_t)lower_bound;
+    if (rounded > (int32_t)upper_bound) rounded = (int32_t)upper_bound;
+    result[j] = (uint16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,31]. */
+INTMATH_API int8_t multshiftround_sat_u16_i8(const uint16_t num, const uint16_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_u16_i8(%u, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u16_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return (int8_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) return upper_bound;
+  uint32_t lower = (lower_bound < (int8_t)0) ? (uint32_t)0 : (uint32_t)lower_bound;
+  uint32_t rounded = multshiftround_sat_product_u16(num, mul, shift);
+  if (rounded < lower) return (int8_t)lower;
+  if (rounded > (uint32_t)upper_bound) return upper_bound;
+  return (int8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,31]. */
+INTMATH_API void multshiftround_sat_batch_u16_i8(const uint16_t *num, int8_t *result, const size_t length, const uint16_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u16_i8(num, result, %lu, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,31].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u16_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint32_t lower = (lower_bound < (int8_t)0) ? (uint32_t)0 : (uint32_t)lower_bound;
+  for (j = 0u; j < length; j++) {
+    uint32_t rounded = multshiftround_sat_product_u16(num[j], mul, shift);
+    if (rounded < lower) rounded = lower;
+    if (rounded > (uint32_t)upper_bound) rounded = (uint32_t)upper_bound;
+    result[j] = (int8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,31]. */
+INTMATH_API int16_t multshiftround_sat_u16_i16(const uint16_t num, const uint16_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_u16_i16(%u, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u16_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return (int16_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int16_t)0) return upper_bound;
+  uint32_t lower = (lower_bound < (int16_t)0) ? (uint32_t)0 : (uint32_t)lower_bound;
+  uint32_t rounded = multshiftround_sat_product_u16(num, mul, shift);
+  if (rounded < lower) return (int16_t)lower;
+  if (rounded > (uint32_t)upper_bound) return upper_bound;
+  return (int16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,31]. */
+INTMATH_API void multshiftround_sat_batch_u16_i16(const uint16_t *num, int16_t *result, const size_t length, const uint16_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u16_i16(num, result, %lu, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,31].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u16_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int16_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint32_t lower = (lower_bound < (int16_t)0) ? (uint32_t)0 : (uint32_t)lower_bound;
+  for (j = 0u; j < length; j++) {
+    uint32_t rounded = multshiftround_sat_product_u16(num[j], mul, shift);
+    if (rounded < lower) rounded = lower;
+    if (rounded > (uint32_t)upper_bound) rounded = (uint32_t)upper_bound;
+    result[j] = (int16_t)rounded;
+  }
+}
+
+/********************************************************************************
+ ********              int32_t and uint32_t input functions              ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,62]. */
+INTMATH_API int8_t multshiftround_sat_i32_i8(const int32_t num, const int32_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_i32_i8(%i, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i32_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return (int8_t)0;
+  int64_t rounded = multshiftround_sat_product_i32(num, mul, shift);
+  if (rounded < (int64_t)lower_bound) return lower_bound;
+  if (rounded > (int64_t)upper_bound) return upper_bound;
+  return (int8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_sat_batch_i32_i8(const int32_t *num, int8_t *result, const size_t length, const int32_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i32_i8(num, result, %lu, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i32_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int64_t rounded = multshiftround_sat_product_i32(num[j], mul, shift);
+    if (rounded < (int64_t)lower_bound) rounded = (int64_t)lower_bound;
+    if (rounded > (int64_t)upper_bound) rounded = (int64_t)upper_bound;
+    result[j] = (int8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,62]. */
+INTMATH_API int16_t multshiftround_sat_i32_i16(const int32_t num, const int32_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_i32_i16(%i, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i32_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return (int16_t)0;
+  int64_t rounded = multshiftround_sat_product_i32(num, mul, shift);
+  if (rounded < (int64_t)lower_bound) return lower_bound;
+  if (rounded > (int64_t)upper_bound) return upper_bound;
+  return (int16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_sat_batch_i32_i16(const int32_t *num, int16_t *result, const size_t length, const int32_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i32_i16(num, result, %lu, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i32_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int64_t rounded = multshiftround_sat_product_i32(num[j], mul, shift);
+    if (rounded < (int64_t)lower_bound) rounded = (int64_t)lower_bound;
+    if (rounded > (int64_t)upper_bound) rounded = (int64_t)upper_bound;
+    result[j] = (int16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,62]. */
+INTMATH_API int32_t multshiftround_sat_i32_i32(const int32_t num, const int32_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_i32_i32(%i, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i32_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return 0;
+  int64_t rounded = multshiftround_sat_product_i32(num, mul, shift);
+  if (rounded < (int64_t)lower_bound) return lower_bound;
+  if (rounded > (int64_t)upper_bound) return upper_bound;
+  return (int32_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_sat_batch_i32_i32(const int32_t *num, int32_t *result, const size_t length, const int32_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i32_i32(num, result, %lu, %i, %u, %i, %i), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i32_i32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = 0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int64_t rounded = multshiftround_sat_product_i32(num[j], mul, shift);
+    if (rounded < (int64_t)lower_bound) rounded = (int64_t)lower_bound;
+    if (rounded > (int64_t)upper_bound) rounded = (int64_t)upper_bound;
+    result[j] = (int32_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,63]. */
+INTMATH_API uint8_t multshiftround_sat_u32_u8(const uint32_t num, const uint32_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_u32_u8(%u, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u32_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return (uint8_t)0;
+  uint64_t rounded = multshiftround_sat_product_u32(num, mul, shift);
+  if (rounded < (uint64_t)lower_bound) return lower_bound;
+  if (rounded > (uint64_t)upper_bound) return upper_bound;
+  return (uint8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_sat_batch_u32_u8(const uint32_t *num, uint8_t *result, const size_t length, const uint32_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u32_u8(num, result, %lu, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u32_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    uint64_t rounded = multshiftround_sat_product_u32(num[j], mul, shift);
+    if (rounded < (uint64_t)lower_bound) rounded = (uint64_t)lower_bound;
+    if (rounded > (uint64_t)upper_bound) rounded = (uint64_t)upper_bound;
+    result[j] = (uint8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,63]. */
+INTMATH_API uint16_t multshiftround_sat_u32_u16(const uint32_t num, const uint32_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_u32_u16(%u, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u32_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return (uint16_t)0;
+  uint64_t rounded = multshiftround_sat_product_u32(num, mul, shift);
+  if (rounded < (uint64_t)lower_bound) return lower_bound;
+  if (rounded > (uint64_t)upper_bound) return upper_bound;
+  return (uint16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_sat_batch_u32_u16(const uint32_t *num, uint16_t *result, const size_t length, const uint32_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u32_u16(num, result, %lu, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u32_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    uint64_t rounded = multshiftround_sat_product_u32(num[j], mul, shift);
+    if (rounded < (uint64_t)lower_bound) rounded = (uint64_t)lower_bound;
+    if (rounded > (uint64_t)upper_bound) rounded = (uint64_t)upper_bound;
+    result[j] = (uint16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,63]. */
+INTMATH_API uint32_t multshiftround_sat_u32_u32(const uint32_t num, const uint32_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_u32_u32(%u, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u32_u32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return 0u;
+  uint64_t rounded = multshiftround_sat_product_u32(num, mul, shift);
+  if (rounded < (uint64_t)lower_bound) return lower_bound;
+  if (rounded > (uint64_t)upper_bound) return upper_bound;
+  return (uint32_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_sat_batch_u32_u32(const uint32_t *num, uint32_t *result, const size_t length, const uint32_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u32_u32(num, result, %lu, %u, %u, %u, %u), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u32_u32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = 0u;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    uint64_t rounded = multshiftround_sat_product_u32(num[j], mul, shift);
+    if (rounded < (uint64_t)lower_bound) rounded = (uint64_t)lower_bound;
+    if (rounded > (uint64_t)upper_bound) rounded = (uint64_t)upper_bound;
+    result[j] = (uint32_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,62]. */
+INTMATH_API uint8_t multshiftround_sat_i32_u8(const int32_t num, const int32_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_i32_u8(%i, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i32_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return (uint8_t)0;
+  int64_t rounded = multshiftround_sat_product_i32(num, mul, shift);
+  if (rounded < (int64_t)lower_bound) return lower_bound;
+  if (rounded > (int64_t)upper_bound) return upper_bound;
+  return (uint8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_sat_batch_i32_u8(const int32_t *num, uint8_t *result, const size_t length, const int32_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i32_u8(num, result, %lu, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i32_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int64_t rounded = multshiftround_sat_product_i32(num[j], mul, shift);
+    if (rounded < (int64_t)lower_bound) rounded = (int64_t)lower_bound;
+    if (rounded > (int64_t)upper_bound) rounded = (int64_t)upper_bound;
+    result[j] = (uint8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,62]. */
+INTMATH_API uint16_t multshiftround_sat_i32_u16(const int32_t num, const int32_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_i32_u16(%i, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i32_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return (uint16_t)0;
+  int64_t rounded = multshiftround_sat_product_i32(num, mul, shift);
+  if (rounded < (int64_t)lower_bound) return lower_bound;
+  if (rounded > (int64_t)upper_bound) return upper_bound;
+  return (uint16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_sat_batch_i32_u16(const int32_t *num, uint16_t *result, const size_t length, const int32_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i32_u16(num, result, %lu, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i32_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int64_t rounded = multshiftround_sat_product_i32(num[j], mul, shift);
+    if (rounded < (int64_t)lower_bound) rounded = (int64_t)lower_bound;
+    if (rounded > (int64_t)upper_bound) rounded = (int64_t)upper_bound;
+    result[j] = (uint16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,62]. */
+INTMATH_API uint32_t multshiftround_sat_i32_u32(const int32_t num, const int32_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_i32_u32(%i, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i32_u32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return (uint32_t)0;
+  int64_t rounded = multshiftround_sat_product_i32(num, mul, shift);
+  if (rounded < (int64_t)lower_bound) return lower_bound;
+  if (rounded > (int64_t)upper_bound) return upper_bound;
+  return (uint32_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_sat_batch_i32_u32(const int32_t *num, uint32_t *result, const size_t length, const int32_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i32_u32(num, result, %lu, %i, %u, %u, %u), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i32_u32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = (uint32_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) {
+    int64_t rounded = multshiftround_sat_product_i32(num[j], mul, shift);
+    if (rounded < (int64_t)lower_bound) rounded = (int64_t)lower_bound;
+    if (rounded > (int64_t)upper_bound) rounded = (int64_t)upper_bound;
+    result[j] = (uint32_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,63]. */
+INTMATH_API int8_t multshiftround_sat_u32_i8(const uint32_t num, const uint32_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_u32_i8(%u, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u32_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return (int8_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) return upper_bound;
+  uint64_t lower = (lower_bound < (int8_t)0) ? (uint64_t)0 : (uint64_t)lower_bound;
+  uint64_t rounded = multshiftround_sat_product_u32(num, mul, shift);
+  if (rounded < lower) return (int8_t)lower;
+  if (rounded > (uint64_t)upper_bound) return upper_bound;
+  return (int8_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_sat_batch_u32_i8(const uint32_t *num, int8_t *result, const size_t length, const uint32_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u32_i8(num, result, %lu, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u32_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int8_t)0) ? (uint64_t)0 : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) {
+    uint64_t rounded = multshiftround_sat_product_u32(num[j], mul, shift);
+    if (rounded < lower) rounded = lower;
+    if (rounded > (uint64_t)upper_bound) rounded = (uint64_t)upper_bound;
+    result[j] = (int8_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,63]. */
+INTMATH_API int16_t multshiftround_sat_u32_i16(const uint32_t num, const uint32_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_u32_i16(%u, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u32_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return (int16_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int16_t)0) return upper_bound;
+  uint64_t lower = (lower_bound < (int16_t)0) ? (uint64_t)0 : (uint64_t)lower_bound;
+  uint64_t rounded = multshiftround_sat_product_u32(num, mul, shift);
+  if (rounded < lower) return (int16_t)lower;
+  if (rounded > (uint64_t)upper_bound) return upper_bound;
+  return (int16_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_sat_batch_u32_i16(const uint32_t *num, int16_t *result, const size_t length, const uint32_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u32_i16(num, result, %lu, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u32_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int16_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int16_t)0) ? (uint64_t)0 : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) {
+    uint64_t rounded = multshiftround_sat_product_u32(num[j], mul, shift);
+    if (rounded < lower) rounded = lower;
+    if (rounded > (uint64_t)upper_bound) rounded = (uint64_t)upper_bound;
+    result[j] = (int16_t)rounded;
+  }
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,63]. */
+INTMATH_API int32_t multshiftround_sat_u32_i32(const uint32_t num, const uint32_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_u32_i32(%u, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u32_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return (int32_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int32_t)0) return upper_bound;
+  uint64_t lower = (lower_bound < (int32_t)0) ? (uint64_t)0 : (uint64_t)lower_bound;
+  uint64_t rounded = multshiftround_sat_product_u32(num, mul, shift);
+  if (rounded < lower) return (int32_t)lower;
+  if (rounded > (uint64_t)upper_bound) return upper_bound;
+  return (int32_t)rounded;
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_sat_batch_u32_i32(const uint32_t *num, int32_t *result, const size_t length, const uint32_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u32_i32(num, result, %lu, %u, %u, %i, %i), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u32_i32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = (int32_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int32_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int32_t)0) ? (uint64_t)0 : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) {
+    uint64_t rounded = multshiftround_sat_product_u32(num[j], mul, shift);
+    if (rounded < lower) rounded = lower;
+    if (rounded > (uint64_t)upper_bound) rounded = (uint64_t)upper_bound;
+    result[j] = (int32_t)rounded;
+  }
+}
+
+/********************************************************************************
+ ********              int64_t and uint64_t input functions              ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API int8_t multshiftround_sat_i64_i8(const int64_t num, const int64_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_i8(%" PRIi64 ", %" PRIi64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return (int8_t)0;
+  return (int8_t)multshiftround_sat_wide_i64(num, mul, shift, (int64_t)lower_bound, (int64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_i8(const int64_t *num, int8_t *result, const size_t length, const int64_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_i8(num, result, %lu, %" PRIi64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (int8_t)multshiftround_sat_wide_i64(num[j], mul, shift, (int64_t)lower_bound, (int64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API int16_t multshiftround_sat_i64_i16(const int64_t num, const int64_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_i16(%" PRIi64 ", %" PRIi64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return (int16_t)0;
+  return (int16_t)multshiftround_sat_wide_i64(num, mul, shift, (int64_t)lower_bound, (int64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_i16(const int64_t *num, int16_t *result, const size_t length, const int64_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_i16(num, result, %lu, %" PRIi64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (int16_t)multshiftround_sat_wide_i64(num[j], mul, shift, (int64_t)lower_bound, (int64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API int32_t multshiftround_sat_i64_i32(const int64_t num, const int64_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_i32(%" PRIi64 ", %" PRIi64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return 0;
+  return (int32_t)multshiftround_sat_wide_i64(num, mul, shift, (int64_t)lower_bound, (int64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_i32(const int64_t *num, int32_t *result, const size_t length, const int64_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_i32(num, result, %lu, %" PRIi64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_i32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = 0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (int32_t)multshiftround_sat_wide_i64(num[j], mul, shift, (int64_t)lower_bound, (int64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API int64_t multshiftround_sat_i64_i64(const int64_t num, const int64_t mul, const uint8_t shift, const int64_t lower_bound, const int64_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_i64(%" PRIi64 ", %" PRIi64 ", %u, %" PRIi64 ", %" PRIi64 "), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_i64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return 0ll;
+  return multshiftround_sat_wide_i64(num, mul, shift, lower_bound, upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_i64(const int64_t *num, int64_t *result, const size_t length, const int64_t mul, const uint8_t shift, const int64_t lower_bound, const int64_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_i64(num, result, %lu, %" PRIi64 ", %u, %" PRIi64 ", %" PRIi64 "), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_i64", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = 0ll;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = multshiftround_sat_wide_i64(num[j], mul, shift, lower_bound, upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API uint8_t multshiftround_sat_u64_u8(const uint64_t num, const uint64_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_u8(%" PRIu64 ", %" PRIu64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return (uint8_t)0;
+  return (uint8_t)multshiftround_sat_wide_u64(num, mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_u8(const uint64_t *num, uint8_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_u8(num, result, %lu, %" PRIu64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (uint8_t)multshiftround_sat_wide_u64(num[j], mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API uint16_t multshiftround_sat_u64_u16(const uint64_t num, const uint64_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_u16(%" PRIu64 ", %" PRIu64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return (uint16_t)0;
+  return (uint16_t)multshiftround_sat_wide_u64(num, mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_u16(const uint64_t *num, uint16_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_u16(num, result, %lu, %" PRIu64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (uint16_t)multshiftround_sat_wide_u64(num[j], mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API uint32_t multshiftround_sat_u64_u32(const uint64_t num, const uint64_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_u32(%" PRIu64 ", %" PRIu64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_u32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return 0u;
+  return (uint32_t)multshiftround_sat_wide_u64(num, mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_u32(const uint64_t *num, uint32_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_u32(num, result, %lu, %" PRIu64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_u32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = 0u;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (uint32_t)multshiftround_sat_wide_u64(num[j], mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API uint64_t multshiftround_sat_u64_u64(const uint64_t num, const uint64_t mul, const uint8_t shift, const uint64_t lower_bound, const uint64_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_u64(%" PRIu64 ", %" PRIu64 ", %u, %" PRIu64 ", %" PRIu64 "), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_u64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return 0ull;
+  return multshiftround_sat_wide_u64(num, mul, shift, lower_bound, upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_u64(const uint64_t *num, uint64_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const uint64_t lower_bound, const uint64_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_u64(num, result, %lu, %" PRIu64 ", %u, %" PRIu64 ", %" PRIu64 "), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_u64", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = 0ull;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = multshiftround_sat_wide_u64(num[j], mul, shift, lower_bound, upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API uint8_t multshiftround_sat_i64_u8(const int64_t num, const int64_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_u8(%" PRIi64 ", %" PRIi64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_u8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return (uint8_t)0;
+  return (uint8_t)multshiftround_sat_wide_i64_u64(num, mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_u8(const int64_t *num, uint8_t *result, const size_t length, const int64_t mul, const uint8_t shift, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_u8(num, result, %lu, %" PRIi64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (uint8_t)multshiftround_sat_wide_i64_u64(num[j], mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API uint16_t multshiftround_sat_i64_u16(const int64_t num, const int64_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_u16(%" PRIi64 ", %" PRIi64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_u16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return (uint16_t)0;
+  return (uint16_t)multshiftround_sat_wide_i64_u64(num, mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_u16(const int64_t *num, uint16_t *result, const size_t length, const int64_t mul, const uint8_t shift, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_u16(num, result, %lu, %" PRIi64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (uint16_t)multshiftround_sat_wide_i64_u64(num[j], mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API uint32_t multshiftround_sat_i64_u32(const int64_t num, const int64_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_u32(%" PRIi64 ", %" PRIi64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_u32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return (uint32_t)0;
+  return (uint32_t)multshiftround_sat_wide_i64_u64(num, mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_u32(const int64_t *num, uint32_t *result, const size_t length, const int64_t mul, const uint8_t shift, const uint32_t lower_bound, const uint32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_u32(num, result, %lu, %" PRIi64 ", %u, %u, %u), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_u32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = (uint32_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = (uint32_t)multshiftround_sat_wide_i64_u64(num[j], mul, shift, (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,126]. */
+INTMATH_API uint64_t multshiftround_sat_i64_u64(const int64_t num, const int64_t mul, const uint8_t shift, const uint64_t lower_bound, const uint64_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_i64_u64(%" PRIi64 ", %" PRIi64 ", %u, %" PRIu64 ", %" PRIu64 "), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_i64_u64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) return (uint64_t)0;
+  return multshiftround_sat_wide_i64_u64(num, mul, shift, lower_bound, upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,126]. */
+INTMATH_API void multshiftround_sat_batch_i64_u64(const int64_t *num, uint64_t *result, const size_t length, const int64_t mul, const uint8_t shift, const uint64_t lower_bound, const uint64_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)126)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_i64_u64(num, result, %lu, %" PRIi64 ", %u, %" PRIu64 ", %" PRIu64 "), shift = %u is invalid; it must be on the range [0,126].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)126)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_i64_u64", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)126) {
+    for (j = 0u; j < length; j++) result[j] = (uint64_t)0;
+    return;
+  }
+
+  for (j = 0u; j < length; j++) result[j] = multshiftround_sat_wide_i64_u64(num[j], mul, shift, lower_bound, upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API int8_t multshiftround_sat_u64_i8(const uint64_t num, const uint64_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_i8(%" PRIu64 ", %" PRIu64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_i8", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return (int8_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) return upper_bound;
+  return (int8_t)multshiftround_sat_wide_u64(num, mul, shift, (lower_bound < (int8_t)0) ? 0ull : (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_i8(const uint64_t *num, int8_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_i8(num, result, %lu, %" PRIu64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int8_t)0) ? 0ull : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) result[j] = (int8_t)multshiftround_sat_wide_u64(num[j], mul, shift, lower, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API int16_t multshiftround_sat_u64_i16(const uint64_t num, const uint64_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_i16(%" PRIu64 ", %" PRIu64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_i16", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return (int16_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int16_t)0) return upper_bound;
+  return (int16_t)multshiftround_sat_wide_u64(num, mul, shift, (lower_bound < (int16_t)0) ? 0ull : (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_i16(const uint64_t *num, int16_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_i16(num, result, %lu, %" PRIu64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int16_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int16_t)0) ? 0ull : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) result[j] = (int16_t)multshiftround_sat_wide_u64(num[j], mul, shift, lower, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API int32_t multshiftround_sat_u64_i32(const uint64_t num, const uint64_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_i32(%" PRIu64 ", %" PRIu64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_i32", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return (int32_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int32_t)0) return upper_bound;
+  return (int32_t)multshiftround_sat_wide_u64(num, mul, shift, (lower_bound < (int32_t)0) ? 0ull : (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_i32(const uint64_t *num, int32_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const int32_t lower_bound, const int32_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_i32(num, result, %lu, %" PRIu64 ", %u, %i, %i), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_i32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = (int32_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int32_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int32_t)0) ? 0ull : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) result[j] = (int32_t)multshiftround_sat_wide_u64(num[j], mul, shift, lower, (uint64_t)upper_bound);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. shift must be on the range [0,127]. */
+INTMATH_API int64_t multshiftround_sat_u64_i64(const uint64_t num, const uint64_t mul, const uint8_t shift, const int64_t lower_bound, const int64_t upper_bound) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_u64_i64(%" PRIu64 ", %" PRIu64 ", %u, %" PRIi64 ", %" PRIi64 "), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_u64_i64", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) return (int64_t)0;
+  /* The result is at least 0, so a negative upper_bound is the result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int64_t)0) return upper_bound;
+  return (int64_t)multshiftround_sat_wide_u64(num, mul, shift, (lower_bound < (int64_t)0) ? 0ull : (uint64_t)lower_bound, (uint64_t)upper_bound);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound] into result[j]. shift must be on the range [0,127]. */
+INTMATH_API void multshiftround_sat_batch_u64_i64(const uint64_t *num, int64_t *result, const size_t length, const uint64_t mul, const uint8_t shift, const int64_t lower_bound, const int64_t upper_bound) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)127)
+      fprintf(stderr, "ERROR: multshiftround_sat_batch_u64_i64(num, result, %lu, %" PRIu64 ", %u, %" PRIi64 ", %" PRIi64 "), shift = %u is invalid; it must be on the range [0,127].\n", (unsigned long)length, mul, shift, lower_bound, upper_bound, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)127)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch_u64_i64", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)127) {
+    for (j = 0u; j < length; j++) result[j] = (int64_t)0;
+    return;
+  }
+
+  /* The results are at least 0, so a negative upper_bound is every result and a negative lower_bound acts as 0. */
+  if (upper_bound < (int64_t)0) {
+    for (j = 0u; j < length; j++) result[j] = upper_bound;
+    return;
+  }
+
+  uint64_t lower = (lower_bound < (int64_t)0) ? 0ull : (uint64_t)lower_bound;
+  for (j = 0u; j < length; j++) result[j] = (int64_t)multshiftround_sat_wide_u64(num[j], mul, shift, lower, (uint64_t)upper_bound);
+}
+
+#endif /* #ifndef MULTSHIFTROUND_SAT_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
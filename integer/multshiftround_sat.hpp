@@ -0,0 +1,483 @@
+/**
+ * multshiftround_sat.hpp
+ * Specifies the templated functions
+ *     out_type multshiftround_sat<typename in_type, typename out_type>(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ *     out_type multshiftround_sat<typename in_type, typename out_type, uint8_t shift>(const in_type num, const in_type mul, const out_type lower_bound, const out_type upper_bound);
+ *     void multshiftround_sat_batch<typename in_type, typename out_type>(const in_type *num, out_type *result, const size_t length, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ * which return or store ROUND((num * mul) / 2^shift) saturated to the range
+ * [lower_bound, upper_bound] without using the division operator. The first
+ * form takes the shift argument at run time, the second at compile time,
+ * and the third applies the first to an array in a single pass.
+ *
+ * These fuse multshiftround and saturate_value. The product is formed at
+ * twice the width of in_type (at 128 bits through wide_product.h for
+ * 64-bit in_types), rounded at that width, and compared against the
+ * bounds before it is narrowed to out_type, so no intermediate value can
+ * overflow. Any num and mul may be used.
+ *
+ * This header does not require multshiftround_sat.c; it only requires
+ * wide_product.h.
+ *
+ * in_type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t,
+ * uint32_t, uint64_t, or any type equivalent to these. out_type may be any
+ * of the same types with the same or a smaller width than in_type, of
+ * either signedness, e.g. multshiftround_sat<int32_t, uint16_t>. A signed
+ * result below 0 saturates to an unsigned lower_bound, and an unsigned
+ * result always saturates to a negative upper_bound.
+ *
+ * shift may range from 0 to 2N-2 for N-bit signed in_types and from 0 to
+ * 2N-1 for N-bit unsigned in_types. The runtime and batch forms return or
+ * store 0 for invalid shift arguments. The compile time form rejects them
+ * with a static_assert.
+ *
+ * To obtain sensical results, upper_bound must be greater than or equal to
+ * lower_bound.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments will be
+ * enabled. This requires the availability of stderr and fprintf() on the
+ * target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef MULTSHIFTROUND_SAT_HPP_
+#define MULTSHIFTROUND_SAT_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <limits>
+#include "wide_product.h"
+
+#ifdef DEBUG_INTMATH
+  #include <cstdio>
+#elif defined(DIAGNOSE_INTMATH)
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
+#endif
+
+/* Allows static_assert message in the multshiftround_sat_traits primary template to compile. */
+template <typename type> static bool always_false_multshiftround_sat(void) { return false; }
+
+/**
+ * multshiftround_sat_traits<in_type> needs:
+ *   max_shift:  the largest valid shift argument
+ *   bound_type: a type that holds every rounded result that can be
+ *               returned, which is the double width type except for
+ *               64-bit in_types
+ *   name():     the type name for debug messages
+ *   apply():    returns ROUND((num * mul) / 2^shift) saturated to
+ *               [lower_bound, upper_bound] for a valid shift
+ *
+ * The double width forms use the same rounding steps as the helpers in
+ * multshiftround_sat.c. A signed product of two N-bit values has
+ * magnitude at most 2^(2N-2), so adding the rounding offset cannot
+ * overflow, and the unsigned forms add the rounding bit after shifting.
+ * prod >> (2N-1) is -1 for negative products and 0 otherwise, which moves
+ * ties away from zero without a comparison that would block vectorization.
+ */
+template <typename in_type> struct multshiftround_sat_traits {
+  static_assert(always_false_multshiftround_sat<in_type>(), "multshiftround_sat is not defined for the specified in_type.");
+};
+
+/* Saturates a double width rounded value. */
+template <typename bound_type> inline bound_type multshiftround_sat_clamp(const bound_type rounded, const bound_type lower_bound, const bound_type upper_bound) {
+  if (rounded < lower_bound) return lower_bound;
+  if (rounded > upper_bound) return upper_bound;
+  return rounded;
+}
+
+/********************************************************************************
+ ********                      int8_t and uint8_t                        ********
+ ********************************************************************************/
+
+template <> struct multshiftround_sat_traits<int8_t> {
+  static constexpr uint8_t max_shift = 14u;
+  typedef int16_t bound_type;
+  static const char *name(void) { return "int8_t"; }
+  static inline bound_type apply(const int8_t num, const int8_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    const int16_t prod = static_cast<int16_t>(static_cast<int16_t>(num) * static_cast<int16_t>(mul));
+    if (shift == 0u) return multshiftround_sat_clamp<int16_t>(prod, lower_bound, upper_bound);
+    const int16_t rounded = static_cast<int16_t>((prod + (1 << (shift - 1u)) + (prod >> 15)) >> shift);
+    return multshiftround_sat_clamp<int16_t>(rounded, lower_bound, upper_bound);
+  }
+};
+
+template <> struct multshiftround_sat_traits<uint8_t> {
+  static constexpr uint8_t max_shift = 15u;
+  typedef uint16_t bound_type;
+  static const char *name(void) { return "uint8_t"; }
+  static inline bound_type apply(const uint8_t num, const uint8_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    const uint16_t prod = static_cast<uint16_t>(static_cast<uint16_t>(num) * static_cast<uint16_t>(mul));
+    if (shift == 0u) return multshiftround_sat_clamp<uint16_t>(prod, lower_bound, upper_bound);
+    const uint16_t rounded = static_cast<uint16_t>((prod >> shift) + ((prod >> (shift - 1u)) & 1u));
+    return multshiftround_sat_clamp<uint16_t>(rounded, lower_bound, upper_bound);
+  }
+};
+
+/********************************************************************************
+ ********                     int16_t and uint16_t                       ********
+ ********************************************************************************/
+
+template <> struct multshiftround_sat_traits<int16_t> {
+  static constexpr uint8_t max_shift = 30u;
+  typedef int32_t bound_type;
+  static const char *name(void) { return "int16_t"; }
+  static inline bound_type apply(const int16_t num, const int16_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    const int32_t prod = static_cast<int32_t>(num) * static_cast<int32_t>(mul);
+    if (shift == 0u) return multshiftround_sat_clamp<int32_t>(prod, lower_bound, upper_bound);
+    const int32_t rounded = (prod + (static_cast<int32_t>(1) << (shift - 1u)) + (prod >> 31)) >> shift;
+    return multshiftround_sat_clamp<int32_t>(rounded, lower_bound, upper_bound);
+  }
+};
+
+template <> struct multshiftround_sat_traits<uint16_t> {
+  static constexpr uint8_t max_shift = 31u;
+  typedef uint32_t bound_type;
+  static const char *name(void) { return "uint16_t"; }
+  static inline bound_type apply(const uint16_t num, const uint16_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    const uint32_t prod = static_cast<uint32_t>(num) * static_cast<uint32_t>(mul);
+    if (shift == 0u) return multshiftround_sat_clamp<uint32_t>(prod, lower_bound, upper_bound);
+    const uint32_t rounded = (prod >> shift) + ((prod >> (shift - 1u)) & 1u);
+    return multshiftround_sat_clamp<uint32_t>(rounded, lower_bound, upper_bound);
+  }
+};
+
+/********************************************************************************
+ ********                     int32_t and uint32_t                       ********
+ ********************************************************************************/
+
+template <> struct multshiftround_sat_traits<int32_t> {
+  static constexpr uint8_t max_shift = 62u;
+  typedef int64_t bound_type;
+  static const char *name(void) { return "int32_t"; }
+  static inline bound_type apply(const int32_t num, const int32_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    const int64_t prod = static_cast<int64_t>(num) * static_cast<int64_t>(mul);
+    if (shift == 0u) return multshiftround_sat_clamp<int64_t>(prod, lower_bound, upper_bound);
+    const int64_t rounded = (prod + (static_cast<int64_t>(1) << (shift - 1u)) + (prod >> 63)) >> shift;
+    return multshiftround_sat_clamp<int64_t>(rounded, lower_bound, upper_bound);
+  }
+};
+
+template <> struct multshiftround_sat_traits<uint32_t> {
+  static constexpr uint8_t max_shift = 63u;
+  typedef uint64_t bound_type;
+  static const char *name(void) { return "uint32_t"; }
+  static inline bound_type apply(const uint32_t num, const uint32_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    const uint64_t prod = static_cast<uint64_t>(num) * static_cast<uint64_t>(mul);
+    if (shift == 0u) return multshiftround_sat_clamp<uint64_t>(prod, lower_bound, upper_bound);
+    const uint64_t rounded = (prod >> shift) + ((prod >> (shift - 1u)) & 1u);
+    return multshiftround_sat_clamp<uint64_t>(rounded, lower_bound, upper_bound);
+  }
+};
+
+/********************************************************************************
+ ********                     int64_t and uint64_t                       ********
+ ********************************************************************************/
+
+/**
+ * The 128-bit rounded result is narrowed to 64 bits only after checking
+ * its high word. A result that does not fit is past one bound or the
+ * other, as given by the sign of the high word.
+ */
+template <> struct multshiftround_sat_traits<int64_t> {
+  static constexpr uint8_t max_shift = 126u;
+  typedef int64_t bound_type;
+  static const char *name(void) { return "int64_t"; }
+  static inline bound_type apply(const int64_t num, const int64_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    int64_t prod_hi;
+    const uint64_t prod_lo = wide_mul_i64(num, mul, &prod_hi);
+    int64_t result_hi;
+    const int64_t result = static_cast<int64_t>(wide_shiftround_i128(prod_hi, prod_lo, shift, &result_hi));
+    if (result_hi != (result >> 63)) return result_hi < 0ll ? lower_bound : upper_bound;
+    return multshiftround_sat_clamp<int64_t>(result, lower_bound, upper_bound);
+  }
+};
+
+template <> struct multshiftround_sat_traits<uint64_t> {
+  static constexpr uint8_t max_shift = 127u;
+  typedef uint64_t bound_type;
+  static const char *name(void) { return "uint64_t"; }
+  static inline bound_type apply(const uint64_t num, const uint64_t mul, const uint8_t shift, const bound_type lower_bound, const bound_type upper_bound) {
+    uint64_t prod_hi;
+    const uint64_t prod_lo = wide_mul_u64(num, mul, &prod_hi);
+    uint64_t result_hi;
+    const uint64_t result = wide_shiftround_u128(prod_hi, prod_lo, shift, &result_hi);
+    if (result_hi != 0ull) return upper_bound;
+    return multshiftround_sat_clamp<uint64_t>(result, lower_bound, upper_bound);
+  }
+};
+
+/********************************************************************************
+ ********                  out_type of either signedness                 ********
+ ********************************************************************************/
+
+/**
+ * multshiftround_sat_kernel<in_type, out_type>::apply() returns
+ * ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound] as
+ * an out_type for a valid shift.
+ *
+ * The primary template serves out_types with the signedness of in_type and
+ * unsigned out_types for signed in_types narrower than 64 bits. Every
+ * out_type bound is then a bound_type value: bound_type has the signedness
+ * of in_type, and for a signed in_type narrower than 64 bits it is twice
+ * the width of any unsigned out_type.
+ */
+template <typename in_type, typename out_type,
+          bool in_signed = std::numeric_limits<in_type>::is_signed,
+          bool out_signed = std::numeric_limits<out_type>::is_signed>
+struct multshiftround_sat_kernel {
+  typedef multshiftround_sat_traits<in_type> traits;
+  typedef typename traits::bound_type bound_type;
+  static inline out_type apply(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) {
+    return static_cast<out_type>(traits::apply(num, mul, shift, static_cast<bound_type>(lower_bound), static_cast<bound_type>(upper_bound)));
+  }
+};
+
+/**
+ * An unsigned in_type gives a result of at least 0. A negative lower_bound
+ * therefore acts as 0, and a negative upper_bound is always the result.
+ */
+template <typename in_type, typename out_type> struct multshiftround_sat_kernel<in_type, out_type, false, true> {
+  typedef multshiftround_sat_traits<in_type> traits;
+  typedef typename traits::bound_type bound_type;
+  static inline out_type apply(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) {
+    if (upper_bound < static_cast<out_type>(0)) return upper_bound;
+    const out_type lower = lower_bound < static_cast<out_type>(0) ? static_cast<out_type>(0) : lower_bound;
+    return static_cast<out_type>(traits::apply(num, mul, shift, static_cast<bound_type>(lower), static_cast<bound_type>(upper_bound)));
+  }
+};
+
+/**
+ * An unsigned bound need not fit in int64_t, so the 128-bit rounded result
+ * is compared against the bounds as uint64_t once its high word shows that
+ * it lies on [0, 2^64).
+ */
+template <typename out_type> struct multshiftround_sat_kernel<int64_t, out_type, true, false> {
+  static inline out_type apply(const int64_t num, const int64_t mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) {
+    int64_t prod_hi;
+    const uint64_t prod_lo = wide_mul_i64(num, mul, &prod_hi);
+    int64_t result_hi;
+    const uint64_t result = wide_shiftround_i128(prod_hi, prod_lo, shift, &result_hi);
+    if (result_hi < 0ll) return lower_bound;
+    if (result_hi > 0ll) return upper_bound;
+    return static_cast<out_type>(multshiftround_sat_clamp<uint64_t>(result, static_cast<uint64_t>(lower_bound), static_cast<uint64_t>(upper_bound)));
+  }
+};
+
+/********************************************************************************
+ ********                      multshiftround_sat                        ********
+ ********************************************************************************/
+
+/* Returns true if out_type is an integer type no wider than in_type. */
+template <typename in_type, typename out_type> constexpr bool multshiftround_sat_valid_types(void) {
+  return std::numeric_limits<out_type>::is_integer && sizeof(out_type) <= sizeof(in_type);
+}
+
+/* Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]. Returns 0 for an invalid shift. */
+template <typename in_type, typename out_type> inline out_type multshiftround_sat(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) {
+  static_assert(multshiftround_sat_valid_types<in_type, out_type>(), "multshiftround_sat<in_type, out_type> requires out_type to be no wider than in_type.");
+  typedef multshiftround_sat_traits<in_type> traits;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > traits::max_shift)
+      std::fprintf(stderr, "ERROR: multshiftround_sat<%s, %s>(num, mul, %u, lower_bound, upper_bound), shift = %u is invalid; it must be on the range [0,%u].\n", traits::name(), multshiftround_sat_traits<out_type>::name(), shift, shift, traits::max_shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > traits::max_shift)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat<in_type, out_type>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  if (shift > traits::max_shift) return static_cast<out_type>(0);
+  return multshiftround_sat_kernel<in_type, out_type>::apply(num, mul, shift, lower_bound, upper_bound);
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) saturated to [lower_bound, upper_bound]
+ * with shift known at compile time. After inlining, the shift == 0 test
+ * and the rounding offset fold away.
+ */
+template <typename in_type, typename out_type, uint8_t shift> inline out_type multshiftround_sat(const in_type num, const in_type mul, const out_type lower_bound, const out_type upper_bound) {
+  static_assert(multshiftround_sat_valid_types<in_type, out_type>(), "multshiftround_sat<in_type, out_type, shift> requires out_type to be no wider than in_type.");
+  typedef multshiftround_sat_traits<in_type> traits;
+  static_assert(shift <= traits::max_shift, "multshiftround_sat<in_type, out_type, shift> requires shift on the range [0,2N-2] for N-bit signed in_types and [0,2N-1] for N-bit unsigned in_types.");
+  return multshiftround_sat_kernel<in_type, out_type>::apply(num, mul, shift, lower_bound, upper_bound);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) saturated to [lower_bound, upper_bound]
+ * into result[j] for j on [0, length). Stores 0 for an invalid shift.
+ * num and result may be the same array when in_type and out_type are the
+ * same type.
+ */
+template <typename in_type, typename out_type> inline void multshiftround_sat_batch(const in_type *num, out_type *result, const size_t length, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) {
+  static_assert(multshiftround_sat_valid_types<in_type, out_type>(), "multshiftround_sat_batch<in_type, out_type> requires out_type to be no wider than in_type.");
+  typedef multshiftround_sat_traits<in_type> traits;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > traits::max_shift)
+      std::fprintf(stderr, "ERROR: multshiftround_sat_batch<%s, %s>(num, result, %lu, mul, %u, lower_bound, upper_bound), shift = %u is invalid; it must be on the range [0,%u].\n", traits::name(), multshiftround_sat_traits<out_type>::name(), static_cast<unsigned long>(length), shift, shift, traits::max_shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > traits::max_shift)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_sat_batch<in_type, out_type>", static_cast<uint64_t>(length), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  if (shift > traits::max_shift) {
+    for (size_t j = 0u; j < length; j++) result[j] = static_cast<out_type>(0);
+    return;
+  }
+
+  /* Separate loops let the compiler drop the shift == 0 test from each and vectorize them. */
+  typedef multshiftround_sat_kernel<in_type, out_type> kernel;
+  if (shift == 0u) {
+    for (size_t j = 0u; j < length; j++) result[j] = kernel::apply(num[j], mul, 0u, lower_bound, upper_bound);
+  }
+  else {
+    for (size_t j = 0u; j < length; j++) result[j] = kernel::apply(num[j], mul, shift, lower_bound, upper_bound);
+  }
+}
+
+#endif /* #ifndef MULTSHIFTROUND_SAT_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
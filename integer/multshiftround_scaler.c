@@ -0,0 +1,682 @@
+/**
+ * multshiftround_scaler.c
+ * Defines functions of the form
+ *     multshiftround_scaler_X multshiftround_prepare_X(const type mul, const uint8_t shift);
+ *     type multshiftround_prepared_X(const type num, const multshiftround_scaler_X *scaler);
+ *     void multshiftround_prepared_batch_X(const type *num, type *result, const size_t length, const multshiftround_scaler_X *scaler);
+ * which return or store ROUND((num * mul) / 2^shift) for a mul and shift
+ * that are prepared once and reused. X is a type abbreviation.
+ *
+ * multshiftround_X in multshiftround_run.c tests shift, loads or computes
+ * the half remainder mask 2^(shift-1), and branches on shift == 0 for every
+ * call. Here those steps happen once in multshiftround_prepare_X:
+ *     half     = 2^(shift-1), or 0 when shift is 0
+ *     low_mask = 2^shift - 1 (signed types only)
+ * With half = 0 the rounding test below is never true, so shift == 0 needs
+ * no branch, and an invalid shift is prepared as mul = 0 and shift = 0 so
+ * that 0 is returned without a test. The remaining rounding test is the
+ * same one multshiftround_X makes, written with & and | rather than && and
+ * || so that the batch loops compile without branches:
+ *     unsigned: (prod & half) != 0
+ *     signed:   (prod & half) != 0 and
+ *               (prod >= 0 or (prod & low_mask) != half)
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments and for
+ * numerical overflow in the product num * mul will be enabled. This
+ * requires the availability of stderr and fprintf() on the target system
+ * and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef MULTSHIFTROUND_SCALER_C_
+#define MULTSHIFTROUND_SCALER_C_
+
+#include "multshiftround_scaler.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+  #include "wide_product.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+  #include "wide_product.h"
+#endif
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_i8 and multshiftround_prepared_batch_i8.
+ * shift must be on the range [0,6]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_i8 does.
+ */
+INTMATH_API multshiftround_scaler_i8 multshiftround_prepare_i8(const int8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+      fprintf(stderr, "ERROR: multshiftround_prepare_i8(%i, %u), shift = %u is invalid; it must be on the range [0,6].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_i8", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_i8 scaler;
+  if (shift > (uint8_t)6) {
+    scaler.mul = (int8_t)0;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? (uint8_t)0 : (uint8_t)((uint8_t)1 << (scaler.shift - (uint8_t)1));
+  scaler.low_mask = (uint8_t)((uint8_t)(scaler.half << 1) - (uint8_t)1);
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_i8. The result equals multshiftround_i8(num, mul, shift).
+ */
+INTMATH_API int8_t multshiftround_prepared_i8(const int8_t num, const multshiftround_scaler_i8 *scaler) {
+  #ifdef DEBUG_INTMATH
+    int16_t debug_product = (int16_t)num * (int16_t)scaler->mul;
+    if (debug_product > (int16_t)INT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_prepared_i8(%i, &scaler) with mul = %i, numerical overflow in the product %i * %i = %i > %i.\n", num, scaler->mul, num, scaler->mul, debug_product, INT8_MAX);
+
+    if (debug_product < (int16_t)INT8_MIN)
+      fprintf(stderr, "ERROR: multshiftround_prepared_i8(%i, &scaler) with mul = %i, numerical underflow in the product %i * %i = %i < %i.\n", num, scaler->mul, num, scaler->mul, debug_product, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    int16_t diagnose_product = (int16_t)num * (int16_t)scaler->mul;
+    if (diagnose_product > (int16_t)INT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i8", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+
+    if (diagnose_product < (int16_t)INT8_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i8", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  int8_t prod = (int8_t)(num * scaler->mul);
+  int8_t round_up = (int8_t)(((prod & scaler->half) != 0) &
+                             ((prod >= (int8_t)0) | ((uint8_t)(prod & scaler->low_mask) != scaler->half)));
+  return (int8_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_i8(const int8_t *num, int8_t *result, const size_t length, const multshiftround_scaler_i8 *scaler) {
+  const multshiftround_scaler_i8 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_i8(num[j], &prepared);
+}
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_u8 and multshiftround_prepared_batch_u8.
+ * shift must be on the range [0,7]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_u8 does.
+ */
+INTMATH_API multshiftround_scaler_u8 multshiftround_prepare_u8(const uint8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+      fprintf(stderr, "ERROR: multshiftround_prepare_u8(%u, %u), shift = %u is invalid; it must be on the range [0,7].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_u8", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_u8 scaler;
+  if (shift > (uint8_t)7) {
+    scaler.mul = (uint8_t)0;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? (uint8_t)0 : (uint8_t)((uint8_t)1 << (scaler.shift - (uint8_t)1));
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_u8. The result equals multshiftround_u8(num, mul, shift).
+ */
+INTMATH_API uint8_t multshiftround_prepared_u8(const uint8_t num, const multshiftround_scaler_u8 *scaler) {
+  #ifdef DEBUG_INTMATH
+    uint16_t debug_product = (uint16_t)num * (uint16_t)scaler->mul;
+    if (debug_product > (uint16_t)UINT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_prepared_u8(%u, &scaler) with mul = %u, numerical overflow in the product %u * %u = %u > %u.\n", num, scaler->mul, num, scaler->mul, debug_product, UINT8_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    uint16_t diagnose_product = (uint16_t)num * (uint16_t)scaler->mul;
+    if (diagnose_product > (uint16_t)UINT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_u8", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  uint8_t prod = (uint8_t)(num * scaler->mul);
+  uint8_t round_up = (uint8_t)((prod & scaler->half) != (uint8_t)0);
+  return (uint8_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_u8(const uint8_t *num, uint8_t *result, const size_t length, const multshiftround_scaler_u8 *scaler) {
+  const multshiftround_scaler_u8 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_u8(num[j], &prepared);
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_i16 and multshiftround_prepared_batch_i16.
+ * shift must be on the range [0,14]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_i16 does.
+ */
+INTMATH_API multshiftround_scaler_i16 multshiftround_prepare_i16(const int16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: multshiftround_prepare_i16(%i, %u), shift = %u is invalid; it must be on the range [0,14].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_i16", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_i16 scaler;
+  if (shift > (uint8_t)14) {
+    scaler.mul = (int16_t)0;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? (uint16_t)0 : (uint16_t)((uint16_t)1 << (scaler.shift - (uint8_t)1));
+  scaler.low_mask = (uint16_t)((uint16_t)(scaler.half << 1) - (uint16_t)1);
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_i16. The result equals multshiftround_i16(num, mul, shift).
+ */
+INTMATH_API int16_t multshiftround_prepared_i16(const int16_t num, const multshiftround_scaler_i16 *scaler) {
+  #ifdef DEBUG_INTMATH
+    int32_t debug_product = (int32_t)num * (int32_t)scaler->mul;
+    if (debug_product > (int32_t)INT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_prepared_i16(%i, &scaler) with mul = %i, numerical overflow in the product %i * %i = %i > %i.\n", num, scaler->mul, num, scaler->mul, debug_product, INT16_MAX);
+
+    if (debug_product < (int32_t)INT16_MIN)
+      fprintf(stderr, "ERROR: multshiftround_prepared_i16(%i, &scaler) with mul = %i, numerical underflow in the product %i * %i = %i < %i.\n", num, scaler->mul, num, scaler->mul, debug_product, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    int32_t diagnose_product = (int32_t)num * (int32_t)scaler->mul;
+    if (diagnose_product > (int32_t)INT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i16", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+
+    if (diagnose_product < (int32_t)INT16_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i16", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  int16_t prod = (int16_t)((uint32_t)(uint16_t)num * (uint32_t)(uint16_t)scaler->mul);
+  int16_t round_up = (int16_t)(((prod & scaler->half) != 0) &
+                               ((prod >= (int16_t)0) | ((uint16_t)(prod & scaler->low_mask) != scaler->half)));
+  return (int16_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_i16(const int16_t *num, int16_t *result, const size_t length, const multshiftround_scaler_i16 *scaler) {
+  const multshiftround_scaler_i16 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_i16(num[j], &prepared);
+}
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_u16 and multshiftround_prepared_batch_u16.
+ * shift must be on the range [0,15]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_u16 does.
+ */
+INTMATH_API multshiftround_scaler_u16 multshiftround_prepare_u16(const uint16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: multshiftround_prepare_u16(%u, %u), shift = %u is invalid; it must be on the range [0,15].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_u16", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_u16 scaler;
+  if (shift > (uint8_t)15) {
+    scaler.mul = (uint16_t)0;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? (uint16_t)0 : (uint16_t)((uint16_t)1 << (scaler.shift - (uint8_t)1));
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_u16. The result equals multshiftround_u16(num, mul, shift).
+ */
+INTMATH_API uint16_t multshiftround_prepared_u16(const uint16_t num, const multshiftround_scaler_u16 *scaler) {
+  #ifdef DEBUG_INTMATH
+    uint32_t debug_product = (uint32_t)num * (uint32_t)scaler->mul;
+    if (debug_product > (uint32_t)UINT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_prepared_u16(%u, &scaler) with mul = %u, numerical overflow in the product %u * %u = %u > %u.\n", num, scaler->mul, num, scaler->mul, debug_product, UINT16_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    uint32_t diagnose_product = (uint32_t)num * (uint32_t)scaler->mul;
+    if (diagnose_product > (uint32_t)UINT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_u16", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  uint16_t prod = (uint16_t)((uint32_t)(uint16_t)num * (uint32_t)(uint16_t)scaler->mul);
+  uint16_t round_up = (uint16_t)((prod & scaler->half) != (uint16_t)0);
+  return (uint16_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_u16(const uint16_t *num, uint16_t *result, const size_t length, const multshiftround_scaler_u16 *scaler) {
+  const multshiftround_scaler_u16 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_u16(num[j], &prepared);
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_i32 and multshiftround_prepared_batch_i32.
+ * shift must be on the range [0,30]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_i32 does.
+ */
+INTMATH_API multshiftround_scaler_i32 multshiftround_prepare_i32(const int32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_prepare_i32(%i, %u), shift = %u is invalid; it must be on the range [0,30].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_i32", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_i32 scaler;
+  if (shift > (uint8_t)30) {
+    scaler.mul = 0;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? 0u : (uint32_t)(1u << (scaler.shift - (uint8_t)1));
+  scaler.low_mask = (uint32_t)((uint32_t)(scaler.half << 1) - 1u);
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_i32. The result equals multshiftround_i32(num, mul, shift).
+ */
+INTMATH_API int32_t multshiftround_prepared_i32(const int32_t num, const multshiftround_scaler_i32 *scaler) {
+  #ifdef DEBUG_INTMATH
+    int64_t debug_product = (int64_t)num * (int64_t)scaler->mul;
+    if (debug_product > (int64_t)INT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_prepared_i32(%i, &scaler) with mul = %i, numerical overflow in the product %i * %i = %" PRIi64 " > %i.\n", num, scaler->mul, num, scaler->mul, debug_product, INT32_MAX);
+
+    if (debug_product < (int64_t)INT32_MIN)
+      fprintf(stderr, "ERROR: multshiftround_prepared_i32(%i, &scaler) with mul = %i, numerical underflow in the product %i * %i = %" PRIi64 " < %i.\n", num, scaler->mul, num, scaler->mul, debug_product, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    int64_t diagnose_product = (int64_t)num * (int64_t)scaler->mul;
+    if (diagnose_product > (int64_t)INT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i32", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+
+    if (diagnose_product < (int64_t)INT32_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i32", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  int32_t prod = (int32_t)((uint32_t)num * (uint32_t)scaler->mul);
+  int32_t round_up = (int32_t)(((prod & scaler->half) != 0) &
+                               ((prod >= 0) | ((uint32_t)(prod & scaler->low_mask) != scaler->half)));
+  return (int32_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_i32(const int32_t *num, int32_t *result, const size_t length, const multshiftround_scaler_i32 *scaler) {
+  const multshiftround_scaler_i32 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_i32(num[j], &prepared);
+}
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_u32 and multshiftround_prepared_batch_u32.
+ * shift must be on the range [0,31]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_u32 does.
+ */
+INTMATH_API multshiftround_scaler_u32 multshiftround_prepare_u32(const uint32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_prepare_u32(%u, %u), shift = %u is invalid; it must be on the range [0,31].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_u32", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_u32 scaler;
+  if (shift > (uint8_t)31) {
+    scaler.mul = 0u;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? 0u : (uint32_t)(1u << (scaler.shift - (uint8_t)1));
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_u32. The result equals multshiftround_u32(num, mul, shift).
+ */
+INTMATH_API uint32_t multshiftround_prepared_u32(const uint32_t num, const multshiftround_scaler_u32 *scaler) {
+  #ifdef DEBUG_INTMATH
+    uint64_t debug_product = (uint64_t)num * (uint64_t)scaler->mul;
+    if (debug_product > (uint64_t)UINT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_prepared_u32(%u, &scaler) with mul = %u, numerical overflow in the product %u * %u = %" PRIu64 " > %u.\n", num, scaler->mul, num, scaler->mul, debug_product, UINT32_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    uint64_t diagnose_product = (uint64_t)num * (uint64_t)scaler->mul;
+    if (diagnose_product > (uint64_t)UINT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_u32", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  uint32_t prod = (uint32_t)((uint32_t)num * (uint32_t)scaler->mul);
+  uint32_t round_up = (uint32_t)((prod & scaler->half) != 0u);
+  return (uint32_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_u32(const uint32_t *num, uint32_t *result, const size_t length, const multshiftround_scaler_u32 *scaler) {
+  const multshiftround_scaler_u32 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_u32(num[j], &prepared);
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_i64 and multshiftround_prepared_batch_i64.
+ * shift must be on the range [0,62]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_i64 does.
+ */
+INTMATH_API multshiftround_scaler_i64 multshiftround_prepare_i64(const int64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_prepare_i64(%" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_i64", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_i64 scaler;
+  if (shift > (uint8_t)62) {
+    scaler.mul = 0ll;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? 0ull : (uint64_t)(1ull << (scaler.shift - (uint8_t)1));
+  scaler.low_mask = (uint64_t)((uint64_t)(scaler.half << 1) - 1ull);
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_i64. The result equals multshiftround_i64(num, mul, shift).
+ */
+INTMATH_API int64_t multshiftround_prepared_i64(const int64_t num, const multshiftround_scaler_i64 *scaler) {
+  #ifdef DEBUG_INTMATH
+    if (wide_mul_overflows_i64(num, scaler->mul))
+      fprintf(stderr, "ERROR: multshiftround_prepared_i64(%" PRIi64 ", &scaler) with mul = %" PRIi64 ", numerical overflow or underflow in the product %" PRIi64 " * %" PRIi64 ".\n", num, scaler->mul, num, scaler->mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (wide_mul_overflows_i64(num, scaler->mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_i64", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  int64_t prod = (int64_t)((uint64_t)num * (uint64_t)scaler->mul);
+  int64_t round_up = (int64_t)(((prod & scaler->half) != 0) &
+                               ((prod >= 0ll) | ((uint64_t)(prod & scaler->low_mask) != scaler->half)));
+  return (int64_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_i64(const int64_t *num, int64_t *result, const size_t length, const multshiftround_scaler_i64 *scaler) {
+  const multshiftround_scaler_i64 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_i64(num[j], &prepared);
+}
+
+/**
+ * Returns the scaler for ROUND((num * mul) / 2^shift) for use with
+ * multshiftround_prepared_u64 and multshiftround_prepared_batch_u64.
+ * shift must be on the range [0,63]. A scaler prepared with an invalid
+ * shift returns 0, as multshiftround_u64 does.
+ */
+INTMATH_API multshiftround_scaler_u64 multshiftround_prepare_u64(const uint64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_prepare_u64(%" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_prepare_u64", 0u, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  multshiftround_scaler_u64 scaler;
+  if (shift > (uint8_t)63) {
+    scaler.mul = 0ull;
+    scaler.shift = 0u;
+  }
+  else {
+    scaler.mul = mul;
+    scaler.shift = shift;
+  }
+  scaler.half = (scaler.shift == (uint8_t)0) ? 0ull : (uint64_t)(1ull << (scaler.shift - (uint8_t)1));
+  return scaler;
+}
+
+/**
+ * Returns ROUND((num * mul) / 2^shift) for the mul and shift passed to
+ * multshiftround_prepare_u64. The result equals multshiftround_u64(num, mul, shift).
+ */
+INTMATH_API uint64_t multshiftround_prepared_u64(const uint64_t num, const multshiftround_scaler_u64 *scaler) {
+  #ifdef DEBUG_INTMATH
+    if (wide_mul_overflows_u64(num, scaler->mul))
+      fprintf(stderr, "ERROR: multshiftround_prepared_u64(%" PRIu64 ", &scaler) with mul = %" PRIu64 ", numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, scaler->mul, num, scaler->mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (wide_mul_overflows_u64(num, scaler->mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_prepared_u64", (uint64_t)num, (uint64_t)scaler->mul, (uint64_t)scaler->shift);
+  #endif
+
+  uint64_t prod = (uint64_t)((uint64_t)num * (uint64_t)scaler->mul);
+  uint64_t round_up = (uint64_t)((prod & scaler->half) != 0ull);
+  return (uint64_t)((prod >> scaler->shift) + round_up);
+}
+
+/**
+ * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+ * [0, length - 1]. num and result may point to the same array.
+ */
+INTMATH_API void multshiftround_prepared_batch_u64(const uint64_t *num, uint64_t *result, const size_t length, const multshiftround_scaler_u64 *scaler) {
+  const multshiftround_scaler_u64 prepared = *scaler;
+  size_t j;
+  for (j = 0u; j < length; j++) result[j] = multshiftround_prepared_u64(num[j], &prepared);
+}
+
+#endif /* #ifndef MULTSHIFTROUND_SCALER_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
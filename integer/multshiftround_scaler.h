@@ -0,0 +1,310 @@
+/**
+ * multshiftround_scaler.h
+ * Declares functions of the form
+ *     multshiftround_scaler_X multshiftround_prepare_X(const type mul, const uint8_t shift);
+ *     type multshiftround_prepared_X(const type num, const multshiftround_scaler_X *scaler);
+ *     void multshiftround_prepared_batch_X(const type *num, type *result, const size_t length, const multshiftround_scaler_X *scaler);
+ * where X is a type abbreviation.
+ *
+ * multshiftround_prepare_X checks shift and computes the rounding masks for
+ * a fixed mul and shift once. multshiftround_prepared_X then returns
+ * ROUND((num * mul) / 2^shift) without a table lookup, a mask computation,
+ * or a shift range test, and multshiftround_prepared_batch_X does the same
+ * for every element of an array. The results are identical to those of
+ * multshiftround_X in multshiftround_run.c for every num, mul, and shift.
+ * This is worthwhile when mul and shift are only known at runtime, e.g.
+ * from a configuration file, but stay the same for many values of num.
+ *
+ * These functions are implemented for int8_t, int16_t, int32_t, int64_t,
+ * uint8_t, uint16_t, uint32_t, and uint64_t.
+ *
+ * shift may range from 0 to one less than the word length of type for
+ * unsigned types and from 0 to two less than the word length of type for
+ * signed types. A scaler prepared with an invalid shift returns 0 for
+ * every num, as multshiftround_X does.
+ *
+ * The product num * mul must not overflow type.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef MULTSHIFTROUND_SCALER_H_
+#define MULTSHIFTROUND_SCALER_H_
+
+#include "inttypes.h"
+#include "intmath_inline.h"
+#include "stddef.h"
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/**
+ * Precomputed mul, shift, and rounding masks for int8_t. Create it with
+ * multshiftround_prepare_i8. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  int8_t mul;
+  uint8_t shift;
+  uint8_t half;
+  uint8_t low_mask;
+} multshiftround_scaler_i8;
+
+INTMATH_API multshiftround_scaler_i8 multshiftround_prepare_i8(const int8_t mul, const uint8_t shift);
+INTMATH_API int8_t multshiftround_prepared_i8(const int8_t num, const multshiftround_scaler_i8 *scaler);
+INTMATH_API void multshiftround_prepared_batch_i8(const int8_t *num, int8_t *result, const size_t length, const multshiftround_scaler_i8 *scaler);
+
+/**
+ * Precomputed mul, shift, and rounding masks for uint8_t. Create it with
+ * multshiftround_prepare_u8. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  uint8_t mul;
+  uint8_t shift;
+  uint8_t half;
+} multshiftround_scaler_u8;
+
+INTMATH_API multshiftround_scaler_u8 multshiftround_prepare_u8(const uint8_t mul, const uint8_t shift);
+INTMATH_API uint8_t multshiftround_prepared_u8(const uint8_t num, const multshiftround_scaler_u8 *scaler);
+INTMATH_API void multshiftround_prepared_batch_u8(const uint8_t *num, uint8_t *result, const size_t length, const multshiftround_scaler_u8 *scaler);
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Precomputed mul, shift, and rounding masks for int16_t. Create it with
+ * multshiftround_prepare_i16. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  int16_t mul;
+  uint8_t shift;
+  uint16_t half;
+  uint16_t low_mask;
+} multshiftround_scaler_i16;
+
+INTMATH_API multshiftround_scaler_i16 multshiftround_prepare_i16(const int16_t mul, const uint8_t shift);
+INTMATH_API int16_t multshiftround_prepared_i16(const int16_t num, const multshiftround_scaler_i16 *scaler);
+INTMATH_API void multshiftround_prepared_batch_i16(const int16_t *num, int16_t *result, const size_t length, const multshiftround_scaler_i16 *scaler);
+
+/**
+ * Precomputed mul, shift, and rounding masks for uint16_t. Create it with
+ * multshiftround_prepare_u16. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  uint16_t mul;
+  uint8_t shift;
+  uint16_t half;
+} multshiftround_scaler_u16;
+
+INTMATH_API multshiftround_scaler_u16 multshiftround_prepare_u16(const uint16_t mul, const uint8_t shift);
+INTMATH_API uint16_t multshiftround_prepared_u16(const uint16_t num, const multshiftround_scaler_u16 *scaler);
+INTMATH_API void multshiftround_prepared_batch_u16(const uint16_t *num, uint16_t *result, const size_t length, const multshiftround_scaler_u16 *scaler);
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Precomputed mul, shift, and rounding masks for int32_t. Create it with
+ * multshiftround_prepare_i32. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  int32_t mul;
+  uint8_t shift;
+  uint32_t half;
+  uint32_t low_mask;
+} multshiftround_scaler_i32;
+
+INTMATH_API multshiftround_scaler_i32 multshiftround_prepare_i32(const int32_t mul, const uint8_t shift);
+INTMATH_API int32_t multshiftround_prepared_i32(const int32_t num, const multshiftround_scaler_i32 *scaler);
+INTMATH_API void multshiftround_prepared_batch_i32(const int32_t *num, int32_t *result, const size_t length, const multshiftround_scaler_i32 *scaler);
+
+/**
+ * Precomputed mul, shift, and rounding masks for uint32_t. Create it with
+ * multshiftround_prepare_u32. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  uint32_t mul;
+  uint8_t shift;
+  uint32_t half;
+} multshiftround_scaler_u32;
+
+INTMATH_API multshiftround_scaler_u32 multshiftround_prepare_u32(const uint32_t mul, const uint8_t shift);
+INTMATH_API uint32_t multshiftround_prepared_u32(const uint32_t num, const multshiftround_scaler_u32 *scaler);
+INTMATH_API void multshiftround_prepared_batch_u32(const uint32_t *num, uint32_t *result, const size_t length, const multshiftround_scaler_u32 *scaler);
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/**
+ * Precomputed mul, shift, and rounding masks for int64_t. Create it with
+ * multshiftround_prepare_i64. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  int64_t mul;
+  uint8_t shift;
+  uint64_t half;
+  uint64_t low_mask;
+} multshiftround_scaler_i64;
+
+INTMATH_API multshiftround_scaler_i64 multshiftround_prepare_i64(const int64_t mul, const uint8_t shift);
+INTMATH_API int64_t multshiftround_prepared_i64(const int64_t num, const multshiftround_scaler_i64 *scaler);
+INTMATH_API void multshiftround_prepared_batch_i64(const int64_t *num, int64_t *result, const size_t length, const multshiftround_scaler_i64 *scaler);
+
+/**
+ * Precomputed mul, shift, and rounding masks for uint64_t. Create it with
+ * multshiftround_prepare_u64. The fields are internal to multshiftround_scaler.c.
+ */
+typedef struct {
+  uint64_t mul;
+  uint8_t shift;
+  uint64_t half;
+} multshiftround_scaler_u64;
+
+INTMATH_API multshiftround_scaler_u64 multshiftround_prepare_u64(const uint64_t mul, const uint8_t shift);
+INTMATH_API uint64_t multshiftround_prepared_u64(const uint64_t num, const multshiftround_scaler_u64 *scaler);
+INTMATH_API void multshiftround_prepared_batch_u64(const uint64_t *num, uint64_t *result, const size_t length, const multshiftround_scaler_u64 *scaler);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "multshiftround_scaler.c"
+#endif
+
+#endif /* #ifndef MULTSHIFTROUND_SCALER_H_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,438 @@
+/**
+ * multshiftround_scaler.hpp
+ * Specifies the class template
+ *     multshiftround_scaler<typename type>
+ * whose constructor checks shift and computes the rounding masks for a fixed
+ * mul and shift once and whose members
+ *     type apply(const type num) const;
+ *     type operator()(const type num) const;
+ *     void apply_batch(const type *num, type *result, const size_t length) const;
+ *     void apply_batch(type *values, const size_t length) const;
+ * return or store ROUND((num * mul) / 2^shift). The results are identical to
+ * those of multshiftround<type>(num, mul, shift) in multshiftround_run.hpp
+ * for every num, mul, and shift, but no shift range test, mask lookup or
+ * computation, or shift == 0 branch is repeated per value. This is
+ * worthwhile when mul and shift are only known at runtime, e.g. from a
+ * configuration file, but stay the same for many values of num.
+ *
+ * The method is described in multshiftround_scaler.c. Unlike
+ * multshiftround_run.hpp, this header needs neither run_masks_type.h nor
+ * multshiftround_shiftround_masks.c.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
+ * uint64_t, or any type equivalent to these.
+ *
+ * shift may range from 0 to one less than the word length of type for
+ * unsigned types and from 0 to two less than the word length of type for
+ * signed types. A scaler constructed with an invalid shift returns 0 for
+ * every num, as multshiftround<type> does.
+ *
+ * The product num * mul must not overflow type.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments and for
+ * numerical overflow in the product num * mul will be enabled. This
+ * requires the availability of stderr and fprintf() on the target system
+ * and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef MULTSHIFTROUND_SCALER_HPP_
+#define MULTSHIFTROUND_SCALER_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <limits>
+
+#ifdef DEBUG_INTMATH
+  #include <cstdio>
+  #include "wide_product.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "wide_product.h"
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
+#endif
+
+/* Allows static_assert message in multshiftround_scaler_traits primary template to compile. */
+template <typename type> static bool always_false_multshiftround_scaler(void) { return false; }
+
+/**
+ * multshiftround_scaler_traits<type> supplies the per-type arithmetic that
+ * multshiftround_scaler<type> needs:
+ *     utype:        the unsigned type of the same width as type.
+ *     max_shift:    the largest valid shift argument.
+ *     name():       the name of type for debug messages.
+ *     product(a, b): a * b wrapped to the width of type, without the
+ *                   undefined behavior of signed or promoted overflow.
+ *     product_overflows(a, b): true if a * b does not fit in type.
+ *     round_up(prod, half, low_mask): 1 if prod / 2^shift rounds away from
+ *                   its truncated value, 0 otherwise.
+ *
+ * This primary template is a catch-all for presently unimplemented
+ * template arguments.
+ */
+template <typename type> struct multshiftround_scaler_traits {
+  static_assert(always_false_multshiftround_scaler<type>(), "multshiftround_scaler<type> is not defined for the specified type.");
+};
+
+/********************************************************************************
+ ********          int8_t and uint8_t template specializations           ********
+ ********************************************************************************/
+
+template <> struct multshiftround_scaler_traits<int8_t> {
+  typedef uint8_t utype;
+  static constexpr uint8_t max_shift = 6u;
+  static constexpr const char *name(void) { return "int8_t"; }
+  static int8_t product(const int8_t a, const int8_t b) { return static_cast<int8_t>(a * b); }
+  static bool product_overflows(const int8_t a, const int8_t b) {
+    const int16_t product = static_cast<int16_t>(a * b);
+    return product > std::numeric_limits<int8_t>::max() || product < std::numeric_limits<int8_t>::min();
+  }
+  static int8_t round_up(const int8_t prod, const uint8_t half, const uint8_t low_mask) {
+    return static_cast<int8_t>(((prod & half) != 0) & ((prod >= 0) | (static_cast<uint8_t>(prod & low_mask) != half)));
+  }
+};
+
+template <> struct multshiftround_scaler_traits<uint8_t> {
+  typedef uint8_t utype;
+  static constexpr uint8_t max_shift = 7u;
+  static constexpr const char *name(void) { return "uint8_t"; }
+  static uint8_t product(const uint8_t a, const uint8_t b) { return static_cast<uint8_t>(a * b); }
+  static bool product_overflows(const uint8_t a, const uint8_t b) {
+    return static_cast<uint16_t>(a * b) > std::numeric_limits<uint8_t>::max();
+  }
+  static uint8_t round_up(const uint8_t prod, const uint8_t half, const uint8_t) {
+    return static_cast<uint8_t>((prod & half) != 0);
+  }
+};
+
+/********************************************************************************
+ ********         int16_t and uint16_t template specializations          ********
+ ********************************************************************************/
+
+template <> struct multshiftround_scaler_traits<int16_t> {
+  typedef uint16_t utype;
+  static constexpr uint8_t max_shift = 14u;
+  static constexpr const char *name(void) { return "int16_t"; }
+  static int16_t product(const int16_t a, const int16_t b) {
+    return static_cast<int16_t>(static_cast<uint32_t>(static_cast<uint16_t>(a)) * static_cast<uint16_t>(b));
+  }
+  static bool product_overflows(const int16_t a, const int16_t b) {
+    const int32_t product = static_cast<int32_t>(a) * b;
+    return product > std::numeric_limits<int16_t>::max() || product < std::numeric_limits<int16_t>::min();
+  }
+  static int16_t round_up(const int16_t prod, const uint16_t half, const uint16_t low_mask) {
+    return static_cast<int16_t>(((prod & half) != 0) & ((prod >= 0) | (static_cast<uint16_t>(prod & low_mask) != half)));
+  }
+};
+
+template <> struct multshiftround_scaler_traits<uint16_t> {
+  typedef uint16_t utype;
+  static constexpr uint8_t max_shift = 15u;
+  static constexpr const char *name(void) { return "uint16_t"; }
+  static uint16_t product(const uint16_t a, const uint16_t b) {
+    return static_cast<uint16_t>(static_cast<uint32_t>(a) * b);
+  }
+  static bool product_overflows(const uint16_t a, const uint16_t b) {
+    return static_cast<uint32_t>(a) * b > std::numeric_limits<uint16_t>::max();
+  }
+  static uint16_t round_up(const uint16_t prod, const uint16_t half, const uint16_t) {
+    return static_cast<uint16_t>((prod & half) != 0);
+  }
+};
+
+/********************************************************************************
+ ********         int32_t and uint32_t template specializations          ********
+ ********************************************************************************/
+
+template <> struct multshiftround_scaler_traits<int32_t> {
+  typedef uint32_t utype;
+  static constexpr uint8_t max_shift = 30u;
+  static constexpr const char *name(void) { return "int32_t"; }
+  static int32_t product(const int32_t a, const int32_t b) {
+    return static_cast<int32_t>(static_cast<uint32_t>(a) * static_cast<uint32_t>(b));
+  }
+  static bool product_overflows(const int32_t a, const int32_t b) {
+    const int64_t product = static_cast<int64_t>(a) * b;
+    return product > std::numeric_limits<int32_t>::max() || product < std::numeric_limits<int32_t>::min();
+  }
+  static int32_t round_up(const int32_t prod, const uint32_t half, const uint32_t low_mask) {
+    return static_cast<int32_t>(((prod & half) != 0u) & ((prod >= 0) | ((prod & low_mask) != half)));
+  }
+};
+
+template <> struct multshiftround_scaler_traits<uint32_t> {
+  typedef uint32_t utype;
+  static constexpr uint8_t max_shift = 31u;
+  static constexpr const char *name(void) { return "uint32_t"; }
+  static uint32_t product(const uint32_t a, const uint32_t b) { return a * b; }
+  static bool product_overflows(const uint32_t a, const uint32_t b) {
+    return static_cast<uint64_t>(a) * b > std::numeric_limits<uint32_t>::max();
+  }
+  static uint32_t round_up(const uint32_t prod, const uint32_t half, const uint32_t) {
+    return static_cast<uint32_t>((prod & half) != 0u);
+  }
+};
+
+/********************************************************************************
+ ********         int64_t and uint64_t template specializations          ********
+ ********************************************************************************/
+
+template <> struct multshiftround_scaler_traits<int64_t> {
+  typedef uint64_t utype;
+  static constexpr uint8_t max_shift = 62u;
+  static constexpr const char *name(void) { return "int64_t"; }
+  static int64_t product(const int64_t a, const int64_t b) {
+    return static_cast<int64_t>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+  }
+  #if defined(DEBUG_INTMATH) || defined(DIAGNOSE_INTMATH)
+    static bool product_overflows(const int64_t a, const int64_t b) { return wide_mul_overflows_i64(a, b) != 0; }
+  #endif
+  static int64_t round_up(const int64_t prod, const uint64_t half, const uint64_t low_mask) {
+    return static_cast<int64_t>(((prod & half) != 0ull) & ((prod >= 0ll) | ((prod & low_mask) != half)));
+  }
+};
+
+template <> struct multshiftround_scaler_traits<uint64_t> {
+  typedef uint64_t utype;
+  static constexpr uint8_t max_shift = 63u;
+  static constexpr const char *name(void) { return "uint64_t"; }
+  static uint64_t product(const uint64_t a, const uint64_t b) { return a * b; }
+  #if defined(DEBUG_INTMATH) || defined(DIAGNOSE_INTMATH)
+    static bool product_overflows(const uint64_t a, const uint64_t b) { return wide_mul_overflows_u64(a, b) != 0; }
+  #endif
+  static uint64_t round_up(const uint64_t prod, const uint64_t half, const uint64_t) {
+    return static_cast<uint64_t>((prod & half) != 0ull);
+  }
+};
+
+/********************************************************************************
+ ********                      multshiftround_scaler                     ********
+ ********************************************************************************/
+
+template <typename type> class multshiftround_scaler {
+public:
+  typedef multshiftround_scaler_traits<type> traits;
+  typedef typename traits::utype utype;
+
+  /**
+   * Prepares ROUND((num * mul) / 2^shift). A scaler constructed with an
+   * invalid shift returns 0 for every num, as multshiftround<type> does.
+   */
+  multshiftround_scaler(const type mul, const uint8_t shift)
+    : mul_(mul), shift_(shift), prepared_mul_(mul), prepared_shift_(shift), half_(0u), low_mask_(0u) {
+    #ifdef DEBUG_INTMATH
+      if (shift > traits::max_shift)
+        std::fprintf(stderr, "ERROR: multshiftround_scaler<%s>(mul, %u), shift = %u is invalid; it must be on the range [0,%u].\n", traits::name(), shift, shift, traits::max_shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      if (shift > traits::max_shift)
+        intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_scaler<type>", 0u, static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+    #endif
+
+    if (shift > traits::max_shift) {
+      prepared_mul_ = static_cast<type>(0);
+      prepared_shift_ = 0u;
+    }
+    half_ = (prepared_shift_ == 0u) ? static_cast<utype>(0) : static_cast<utype>(static_cast<utype>(1) << (prepared_shift_ - 1u));
+    low_mask_ = static_cast<utype>(static_cast<utype>(half_ << 1) - static_cast<utype>(1));
+  }
+
+  /* Returns the mul passed to the constructor. */
+  type mul(void) const { return mul_; }
+
+  /* Returns the shift passed to the constructor. */
+  uint8_t shift(void) const { return shift_; }
+
+  /**
+   * Returns ROUND((num * mul) / 2^shift). The result equals
+   * multshiftround<type>(num, mul, shift).
+   */
+  type apply(const type num) const {
+    #ifdef DEBUG_INTMATH
+      if (traits::product_overflows(num, prepared_mul_)) {
+        if (std::numeric_limits<type>::is_signed)
+          std::fprintf(stderr, "ERROR: multshiftround_scaler<%s>(%" PRIi64 ", %u).apply(%" PRIi64 "), numerical overflow or underflow in the product.\n", traits::name(), static_cast<int64_t>(mul_), shift_, static_cast<int64_t>(num));
+        else
+          std::fprintf(stderr, "ERROR: multshiftround_scaler<%s>(%" PRIu64 ", %u).apply(%" PRIu64 "), numerical overflow in the product.\n", traits::name(), static_cast<uint64_t>(mul_), shift_, static_cast<uint64_t>(num));
+      }
+    #elif defined(DIAGNOSE_INTMATH)
+      if (traits::product_overflows(num, prepared_mul_))
+        intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_scaler<type>::apply", static_cast<uint64_t>(num), static_cast<uint64_t>(prepared_mul_), static_cast<uint64_t>(prepared_shift_));
+    #endif
+
+    const type prod = traits::product(num, prepared_mul_);
+    return static_cast<type>((prod >> prepared_shift_) + traits::round_up(prod, half_, low_mask_));
+  }
+
+  /* Same as apply(num). */
+  type operator()(const type num) const { return apply(num); }
+
+  /**
+   * Stores ROUND((num[j] * mul) / 2^shift) into result[j] for j on
+   * [0, length - 1]. num and result may point to the same array.
+   */
+  void apply_batch(const type *num, type *result, const size_t length) const {
+    const multshiftround_scaler<type> prepared(*this);
+    for (size_t j = 0u; j < length; j++) result[j] = prepared.apply(num[j]);
+  }
+
+  /* Replaces values[j] with ROUND((values[j] * mul) / 2^shift) for j on [0, length - 1]. */
+  void apply_batch(type *values, const size_t length) const {
+    apply_batch(values, values, length);
+  }
+
+private:
+  type mul_;
+  uint8_t shift_;
+  type prepared_mul_;
+  uint8_t prepared_shift_;
+  utype half_;
+  utype low_mask_;
+};
+
+#endif /* #ifndef MULTSHIFTROUND_SCALER_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,401 @@
+/**
+ * multshiftround_select.hpp
+ * Specifies the class template
+ *     multshiftround_select<int64_t range_min, int64_t range_max,
+ *                           uint64_t frac_num, uint64_t frac_den,
+ *                           uint64_t err_num = 1, uint64_t err_den = 2,
+ *                           typename rounding = round_half_away>
+ * which does at compile time what optimal_pow2_rational.cpp does at run
+ * time and then also picks the integer type. Its members are
+ *     static constexpr uint8_t shift;
+ *     typedef ... type;
+ *     static constexpr type mul;
+ *     static constexpr type apply(const type num);
+ * apply(num) returns multshiftround<type, shift, rounding>(num, mul), which
+ * approximates num * frac_num / frac_den.
+ *
+ * shift is the smallest shift on [1, 63] for which mul = ROUND(frac_num *
+ * 2^shift / frac_den) makes the unrounded product num * mul / 2^shift
+ * differ from num * frac_num / frac_den by less than err_num / err_den for
+ * every num on [range_min, range_max]. The default error of 1/2 is the
+ * criterion of optimal_pow2_rational. Since the error is linear in num,
+ * only the end of the range with the larger magnitude needs to be tested.
+ * All of this arithmetic is exact: the products are formed at 256-bit
+ * width in constexpr functions, so no floating point is involved.
+ *
+ * type is the narrowest of the 8-, 16-, 32-, and 64-bit types in which
+ * range_min, range_max, mul, and the products range_min * mul and
+ * range_max * mul all fit and for which shift is a valid multshiftround
+ * shift. It is unsigned if range_min >= 0 and signed otherwise. Since mul
+ * never decreases as shift grows, the smallest shift also gives the
+ * narrowest type; a larger shift would only buy accuracy beyond the
+ * requested error. Narrower intermediates take fewer instructions and
+ * pack more lanes into a vector register.
+ *
+ * A specification that no shift up to 63 satisfies, or whose products do
+ * not fit in int64_t or uint64_t, fails a static_assert. For the latter,
+ * see multshiftround_wide.hpp.
+ *
+ * Example: scaling a 12-bit ADC count on [0, 4095] by 3300/4095 to get
+ * millivolts to within 1/2 mV selects
+ *     multshiftround_select<0, 4095, 3300, 4095>::shift == 12,
+ *     multshiftround_select<0, 4095, 3300, 4095>::mul   == 3301,
+ *     multshiftround_select<0, 4095, 3300, 4095>::type  == uint32_t,
+ * since 4095 * 3301 overflows uint16_t.
+ *
+ * If you #define DEBUG_INTMATH, apply(num) prints an error message when num
+ * is outside [range_min, range_max], where the error bound and the overflow
+ * analysis no longer hold. This requires the availability of stderr and
+ * fprintf() on the target system and is most appropriate for testing
+ * purposes. multshiftround itself still checks the product.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, multshiftround records product
+ * overflows through intmath_diagnostics.c. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef MULTSHIFTROUND_SELECT_HPP_
+#define MULTSHIFTROUND_SELECT_HPP_
+
+#include <cinttypes>
+#include <limits>
+#include <type_traits>
+#include "rounding_policy.hpp"
+#include "multshiftround_comp.hpp"
+
+#ifdef DEBUG_INTMATH
+  #include <cstdio>
+#endif
+
+/**
+ * A 256-bit unsigned integer as eight 32-bit limbs, least significant
+ * first, for the exact constexpr arithmetic of the search. 32-bit limbs
+ * keep every limb product within uint64_t, so no compiler specific
+ * 128-bit type is needed.
+ */
+struct multshiftround_select_u256 {
+  uint32_t limb[8];
+};
+
+constexpr multshiftround_select_u256 multshiftround_select_from_u64(const uint64_t value) {
+  multshiftround_select_u256 result = {{static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32), 0u, 0u, 0u, 0u, 0u, 0u}};
+  return result;
+}
+
+/* Returns a * b, discarding any carry out of 256 bits. */
+constexpr multshiftround_select_u256 multshiftround_select_mul(const multshiftround_select_u256 a, const uint64_t b) {
+  multshiftround_select_u256 result = {{0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u}};
+  const uint32_t b_limb[2] = {static_cast<uint32_t>(b), static_cast<uint32_t>(b >> 32)};
+  for (unsigned j = 0u; j < 2u; j++) {
+    uint64_t carry = 0u;
+    for (unsigned k = 0u; j + k < 8u; k++) {
+      const uint64_t sum = static_cast<uint64_t>(a.limb[k]) * b_limb[j] + result.limb[j + k] + carry;
+      result.limb[j + k] = static_cast<uint32_t>(sum);
+      carry = sum >> 32;
+    }
+  }
+  return result;
+}
+
+/* Returns true if a < b. */
+constexpr bool multshiftround_select_less(const multshiftround_select_u256 a, const multshiftround_select_u256 b) {
+  for (unsigned k = 8u; k > 0u; k--) {
+    if (a.limb[k - 1u] != b.limb[k - 1u]) return a.limb[k - 1u] < b.limb[k - 1u];
+  }
+  return false;
+}
+
+/* Returns true if a fits in a uint64_t. */
+constexpr bool multshiftround_select_fits_u64(const multshiftround_select_u256 a) {
+  return (a.limb[2] | a.limb[3] | a.limb[4] | a.limb[5] | a.limb[6] | a.limb[7]) == 0u;
+}
+
+constexpr uint64_t multshiftround_select_low_u64(const multshiftround_select_u256 a) {
+  return (static_cast<uint64_t>(a.limb[1]) << 32) | a.limb[0];
+}
+
+/**
+ * The quotient and remainder of a 256-bit dividend and a nonzero 64-bit
+ * divisor, by restoring binary long division.
+ */
+struct multshiftround_select_division {
+  multshiftround_select_u256 quotient;
+  uint64_t remainder;
+};
+
+constexpr multshiftround_select_division multshiftround_select_divide(const multshiftround_select_u256 dividend, const uint64_t divisor) {
+  multshiftround_select_division result = {{{0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u}}, 0u};
+  for (unsigned bit = 256u; bit > 0u; bit--) {
+    const bool carry = (result.remainder >> 63) != 0u;
+    result.remainder = (result.remainder << 1) | ((dividend.limb[(bit - 1u) / 32u] >> ((bit - 1u) % 32u)) & 1u);
+    if (carry || result.remainder >= divisor) {
+      result.remainder -= divisor;
+      result.quotient.limb[(bit - 1u) / 32u] |= static_cast<uint32_t>(1u) << ((bit - 1u) % 32u);
+    }
+  }
+  return result;
+}
+
+/**
+ * The rational mul / 2^shift nearest frac_num / frac_den, and whether it
+ * meets the error bound for the largest input magnitude max_magnitude.
+ * valid is false if mul does not fit in a uint64_t.
+ */
+struct multshiftround_select_candidate {
+  uint64_t mul;
+  bool valid;
+  bool accurate;
+};
+
+constexpr multshiftround_select_candidate multshiftround_select_try(const uint64_t max_magnitude, const uint64_t frac_num, const uint64_t frac_den,
+                                                                    const uint64_t err_num, const uint64_t err_den, const uint8_t shift) {
+  const multshiftround_select_u256 scaled = multshiftround_select_mul(multshiftround_select_from_u64(frac_num), static_cast<uint64_t>(1) << shift);
+  const multshiftround_select_division division = multshiftround_select_divide(scaled, frac_den);
+
+  /* Round half up; the rounding error |mul * frac_den - frac_num * 2^shift| stays below frac_den. */
+  const bool round_up = division.remainder >= frac_den - division.remainder;
+  const uint64_t distance = round_up ? frac_den - division.remainder : division.remainder;
+  const bool valid = multshiftround_select_fits_u64(division.quotient) &&
+                     !(round_up && multshiftround_select_low_u64(division.quotient) == std::numeric_limits<uint64_t>::max());
+  const uint64_t mul = multshiftround_select_low_u64(division.quotient) + (round_up ? 1u : 0u);
+
+  /**
+   * |num * mul / 2^shift - num * frac_num / frac_den| < err_num / err_den
+   * <=> max_magnitude * distance * err_den < err_num * 2^shift * frac_den.
+   */
+  const multshiftround_select_u256 error = multshiftround_select_mul(multshiftround_select_mul(multshiftround_select_from_u64(max_magnitude), distance), err_den);
+  const multshiftround_select_u256 bound = multshiftround_select_mul(multshiftround_select_mul(multshiftround_select_from_u64(err_num), static_cast<uint64_t>(1) << shift), frac_den);
+
+  multshiftround_select_candidate candidate = {mul, valid, valid && multshiftround_select_less(error, bound)};
+  return candidate;
+}
+
+/* Returns the smallest shift on [1, 63] that meets the error bound, or 0 if there is none. */
+constexpr uint8_t multshiftround_select_shift(const uint64_t max_magnitude, const uint64_t frac_num, const uint64_t frac_den, const uint64_t err_num, const uint64_t err_den) {
+  for (uint8_t shift = 1u; shift <= 63u; shift++) {
+    const multshiftround_select_candidate candidate = multshiftround_select_try(max_magnitude, frac_num, frac_den, err_num, err_den, shift);
+    if (!candidate.valid) return 0u;
+    if (candidate.accurate) return shift;
+  }
+  return 0u;
+}
+
+/* Returns |value| as a uint64_t. Exact for the lowest int64_t. */
+constexpr uint64_t multshiftround_select_magnitude(const int64_t value) {
+  return (value < 0) ? static_cast<uint64_t>(0) - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+}
+
+/**
+ * True if range_min, range_max, mul, range_min * mul, and range_max * mul
+ * all fit in type and shift is a valid multshiftround<type, shift> shift.
+ */
+template <typename type> constexpr bool multshiftround_select_fits(const int64_t range_min, const int64_t range_max, const uint64_t mul, const uint8_t shift) {
+  return shift >= 1u && shift < std::numeric_limits<type>::digits &&
+         mul <= static_cast<uint64_t>(std::numeric_limits<type>::max()) &&
+         (range_min >= 0 || (std::is_signed<type>::value &&
+                             range_min >= static_cast<int64_t>(std::numeric_limits<type>::lowest()) &&
+                             !multshiftround_select_less(multshiftround_select_from_u64(multshiftround_select_magnitude(static_cast<int64_t>(std::numeric_limits<type>::lowest()))),
+                                                         multshiftround_select_mul(multshiftround_select_from_u64(multshiftround_select_magnitude(range_min)), mul)))) &&
+         (range_max <= 0 || (static_cast<uint64_t>(range_max) <= static_cast<uint64_t>(std::numeric_limits<type>::max()) &&
+                             !multshiftround_select_less(multshiftround_select_from_u64(static_cast<uint64_t>(std::numeric_limits<type>::max())),
+                                                         multshiftround_select_mul(multshiftround_select_from_u64(static_cast<uint64_t>(range_max)), mul))));
+}
+
+/**
+ * The narrowest of type8, type16, type32, and type64 for which
+ * multshiftround_select_fits holds, or type64 if none does.
+ */
+template <typename type8, typename type16, typename type32, typename type64, int64_t range_min, int64_t range_max, uint64_t mul, uint8_t shift>
+struct multshiftround_select_narrowest {
+  typedef typename std::conditional<multshiftround_select_fits<type8>(range_min, range_max, mul, shift), type8,
+          typename std::conditional<multshiftround_select_fits<type16>(range_min, range_max, mul, shift), type16,
+          typename std::conditional<multshiftround_select_fits<type32>(range_min, range_max, mul, shift), type32,
+          type64>::type>::type>::type type;
+};
+
+template <int64_t range_min, int64_t range_max, uint64_t frac_num, uint64_t frac_den,
+          uint64_t err_num = 1u, uint64_t err_den = 2u, typename rounding = round_half_away>
+struct multshiftround_select {
+  static_assert(range_min <= range_max, "multshiftround_select<range_min, range_max, ...> requires range_min <= range_max.");
+  static_assert(frac_den != 0u && err_den != 0u, "multshiftround_select<...> requires nonzero frac_den and err_den.");
+  static_assert(err_num != 0u, "multshiftround_select<...> requires a nonzero error bound err_num / err_den.");
+  static_assert(is_rounding_policy<rounding>::value, "multshiftround_select<..., rounding> rounding must be a tag from rounding_policy.hpp.");
+
+  static constexpr uint8_t shift = multshiftround_select_shift(
+    (multshiftround_select_magnitude(range_min) > multshiftround_select_magnitude(range_max)) ? multshiftround_select_magnitude(range_min) : multshiftround_select_magnitude(range_max),
+    frac_num, frac_den, err_num, err_den);
+  static_assert(shift != 0u, "multshiftround_select<...> found no mul / 2^shift with shift <= 63 that approximates frac_num / frac_den to within err_num / err_den on [range_min, range_max].");
+
+  static constexpr uint64_t mul_u64 = multshiftround_select_try(0u, frac_num, frac_den, 1u, 1u, (shift != 0u) ? shift : 1u).mul;
+
+  typedef typename multshiftround_select_narrowest<typename std::conditional<(range_min < 0), int8_t, uint8_t>::type,
+                                                   typename std::conditional<(range_min < 0), int16_t, uint16_t>::type,
+                                                   typename std::conditional<(range_min < 0), int32_t, uint32_t>::type,
+                                                   typename std::conditional<(range_min < 0), int64_t, uint64_t>::type,
+                                                   range_min, range_max, mul_u64, shift>::type type;
+  static_assert(shift == 0u || multshiftround_select_fits<type>(range_min, range_max, mul_u64, shift), "multshiftround_select<...> products range * mul do not fit in a 64-bit type; see multshiftround_wide.hpp.");
+
+  static constexpr type mul = static_cast<type>(mul_u64);
+
+  /* Returns multshiftround<type, shift, rounding>(num, mul). */
+  static constexpr type apply(const type num) {
+    #ifdef DEBUG_INTMATH
+      if (static_cast<int64_t>(num) < range_min || (num > static_cast<type>(0) && static_cast<uint64_t>(num) > static_cast<uint64_t>(range_max)))
+        multshiftround_select_report(num);
+    #endif
+    return multshiftround<type, shift, rounding>(num, mul);
+  }
+
+private:
+  #ifdef DEBUG_INTMATH
+    static void multshiftround_select_report(const type num) {
+      if (std::is_signed<type>::value)
+        std::fprintf(stderr, "ERROR: multshiftround_select<%" PRIi64 ", %" PRIi64 ", %" PRIu64 ", %" PRIu64 ">::apply(%" PRIi64 "), num is outside the range [%" PRIi64 ",%" PRIi64 "].\n", range_min, range_max, frac_num, frac_den, static_cast<int64_t>(num), range_min, range_max);
+      else
+        std::fprintf(stderr, "ERROR: multshiftround_select<%" PRIi64 ", %" PRIi64 ", %" PRIu64 ", %" PRIu64 ">::apply(%" PRIu64 "), num is outside the range [%" PRIi64 ",%" PRIi64 "].\n", range_min, range_max, frac_num, frac_den, static_cast<uint64_t>(num), range_min, range_max);
+    }
+  #endif
+};
+
+template <int64_t range_min, int64_t range_max, uint64_t frac_num, uint64_t frac_den, uint64_t err_num, uint64_t err_den, typename rounding>
+constexpr uint8_t multshiftround_select<range_min, range_max, frac_num, frac_den, err_num, err_den, rounding>::shift;
+
+template <int64_t range_min, int64_t range_max, uint64_t frac_num, uint64_t frac_den, uint64_t err_num, uint64_t err_den, typename rounding>
+constexpr uint64_t multshiftround_select<range_min, range_max, frac_num, frac_den, err_num, err_den, rounding>::mul_u64;
+
+template <int64_t range_min, int64_t range_max, uint64_t frac_num, uint64_t frac_den, uint64_t err_num, uint64_t err_den, typename rounding>
+constexpr typename multshiftround_select<range_min, range_max, frac_num, frac_den, err_num, err_den, rounding>::type
+multshiftround_select<range_min, range_max, frac_num, frac_den, err_num, err_den, rounding>::mul;
+
+#endif /* #ifndef MULTSHIFTROUND_SELECT_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
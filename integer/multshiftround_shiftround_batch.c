@@ -0,0 +1,1577 @@
+/**
+ * multshiftround_shiftround_batch.c
+ * Defines functions of the form
+ *     void shiftround_batch_X(const type *num, type *result, const size_t length, const uint8_t shift);
+ *     void multshiftround_batch_X(const type *num, type *result, const size_t length, const type mul, const uint8_t shift);
+ * where X is a type abbreviation. For each index j on [0, length-1], these
+ * functions store ROUND(num[j] / 2^shift) or ROUND((num[j] * mul) / 2^shift),
+ * respectively, into result[j] without using the division operator.
+ *
+ * The results are bit-identical to those of the shiftround_X and
+ * multshiftround_X functions in shiftround_run.c and multshiftround_run.c.
+ * The widest kernel the processor supports (AVX-512, AVX2, SSE4.1, or
+ * SSE2) is picked at run time with cpu_features() from cpu_features.c, so
+ * the file needs no instruction set flags on the compiler command line.
+ * SSE4.1 only adds pmulld to the 32-bit kernels. Elements left over after
+ * the last full vector, and every element on other targets, are processed
+ * by scalar code.
+ *
+ * The vector code rounds with the identity
+ *     ROUND(x / 2^shift) = (x >> shift) + bit (shift-1) of x
+ * minus one when x is negative and its low shift bits are exactly
+ * 2^(shift-1). This is the same rounding rule used in shiftround_run.c,
+ * evaluated with lane-wise masks instead of branches.
+ *
+ * SSE2 and AVX2 have no 8-bit shifts or multiplies, so 8-bit lanes are
+ * widened to 16 bits, processed, and packed back. The products of 8-bit
+ * lanes are wrapped back to 8 bits before rounding, exactly as the
+ * assignment type prod = num * mul; wraps in multshiftround_run.c.
+ *
+ * num and result may point to the same array for in-place operation.
+ *
+ * These functions are implemented for the types int8_t, int16_t, int32_t,
+ * int64_t, uint8_t, uint16_t, uint32_t, and uint64_t.
+ *
+ * shift ranges from 0 to one less than the the word length of the integer
+ * type for unsigned types. shift ranges from 0 to two less than the word
+ * length of the integer type for signed types. Every element of result is
+ * set to 0 for invalid shift arguments.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments will be
+ * enabled. This requires the availability of stderr and fprintf() on the
+ * target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef MULTSHIFTROUND_SHIFTROUND_BATCH_C_
+#define MULTSHIFTROUND_SHIFTROUND_BATCH_C_
+
+#include "multshiftround_shiftround_batch.h"
+#include "cpu_features.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+#endif
+
+/**
+ * GCC and Clang only emit vector instructions in functions carrying the
+ * matching target attribute when the instruction set is not enabled on
+ * the command line. MSVC allows any intrinsic in any function.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 __attribute__((target("sse2")))
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 __attribute__((target("avx2")))
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE4_1
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2
+  #define MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512
+#endif
+
+#ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+  #include "immintrin.h"
+#endif
+
+/********************************************************************************
+ ********                     scalar rounding helpers                    ********
+ ********************************************************************************/
+
+/**
+ * These helpers hold the COMPUTED_MASKS rounding logic from shiftround_run.c
+ * for shift values that are known to be valid and nonzero.
+ */
+
+static inline int8_t shiftround_scalar_i8(const int8_t num, const uint8_t shift) {
+  uint8_t half_remainder = (uint8_t)1 << (shift - (uint8_t)1);
+  if ((num & half_remainder) &&
+      (num >= (int8_t)0 || (num & ((half_remainder << 1) - (uint8_t)1)) != half_remainder))
+    return (num >> shift) + (int8_t)1;
+  return num >> shift;
+}
+
+static inline uint8_t shiftround_scalar_u8(const uint8_t num, const uint8_t shift) {
+  if (num & (uint8_t)1 << (shift - (uint8_t)1)) return (num >> shift) + (uint8_t)1;
+  return num >> shift;
+}
+
+static inline int16_t shiftround_scalar_i16(const int16_t num, const uint8_t shift) {
+  uint16_t half_remainder = (uint16_t)1 << (shift - (uint8_t)1);
+  if ((num & half_remainder) &&
+      (num >= (int16_t)0 || (num & ((half_remainder << 1) - (uint16_t)1)) != half_remainder))
+    return (num >> shift) + (int16_t)1;
+  return num >> shift;
+}
+
+static inline uint16_t shiftround_scalar_u16(const uint16_t num, const uint8_t shift) {
+  if (num & (uint16_t)1 << (shift - (uint8_t)1)) return (num >> shift) + (uint16_t)1;
+  return num >> shift;
+}
+
+static inline int32_t shiftround_scalar_i32(const int32_t num, const uint8_t shift) {
+  uint32_t half_remainder = 1u << (shift - (uint8_t)1);
+  if ((num & half_remainder) &&
+      (num >= 0 || (num & ((half_remainder << 1) - 1u)) != half_remainder))
+    return (num >> shift) + 1;
+  return num >> shift;
+}
+
+static inline uint32_t shiftround_scalar_u32(const uint32_t num, const uint8_t shift) {
+  if (num & 1u << (shift - (uint8_t)1)) return (num >> shift) + 1u;
+  return num >> shift;
+}
+
+static inline int64_t shiftround_scalar_i64(const int64_t num, const uint8_t shift) {
+  uint64_t half_remainder = 1ull << (shift - (uint8_t)1);
+  if ((num & half_remainder) &&
+      (num >= 0ll || (num & ((half_remainder << 1) - 1ull)) != half_remainder))
+    return (num >> shift) + 1ll;
+  return num >> shift;
+}
+
+static inline uint64_t shiftround_scalar_u64(const uint64_t num, const uint8_t shift) {
+  if (num & 1ull << (shift - (uint8_t)1)) return (num >> shift) + 1ull;
+  return num >> shift;
+}
+
+/********************************************************************************
+ ********                         scalar kernels                         ********
+ ********************************************************************************/
+
+/**
+ * Each kernel stores ROUND((num[j] * mul) / 2^shift) into result[j], or
+ * ROUND(num[j] / 2^shift) if multiply is 0. shift must be valid for the
+ * type and nonzero. These loops process the elements that do not fill a
+ * whole vector and are the whole implementation on processors without
+ * SSE2 and on non-x86 targets.
+ */
+static inline void batch_kernel_i8_scalar(const int8_t *num, int8_t *result, const size_t length,
+                                          const int8_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    int8_t prod = multiply ? (int8_t)(num[j] * mul) : num[j];
+    result[j] = shiftround_scalar_i8(prod, shift);
+  }
+}
+
+static inline void batch_kernel_u8_scalar(const uint8_t *num, uint8_t *result, const size_t length,
+                                          const uint8_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    uint8_t prod = multiply ? (uint8_t)(num[j] * mul) : num[j];
+    result[j] = shiftround_scalar_u8(prod, shift);
+  }
+}
+
+static inline void batch_kernel_i16_scalar(const int16_t *num, int16_t *result, const size_t length,
+                                           const int16_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    int16_t prod = multiply ? (int16_t)(num[j] * mul) : num[j];
+    result[j] = shiftround_scalar_i16(prod, shift);
+  }
+}
+
+static inline void batch_kernel_u16_scalar(const uint16_t *num, uint16_t *result, const size_t length,
+                                           const uint16_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    uint16_t prod = multiply ? (uint16_t)((uint32_t)num[j] * (uint32_t)mul) : num[j];
+    result[j] = shiftround_scalar_u16(prod, shift);
+  }
+}
+
+static inline void batch_kernel_i32_scalar(const int32_t *num, int32_t *result, const size_t length,
+                                           const int32_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    int32_t prod = multiply ? (int32_t)((uint32_t)num[j] * (uint32_t)mul) : num[j];
+    result[j] = shiftround_scalar_i32(prod, shift);
+  }
+}
+
+static inline void batch_kernel_u32_scalar(const uint32_t *num, uint32_t *result, const size_t length,
+                                           const uint32_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    uint32_t prod = multiply ? num[j] * mul : num[j];
+    result[j] = shiftround_scalar_u32(prod, shift);
+  }
+}
+
+static inline void batch_kernel_i64_scalar(const int64_t *num, int64_t *result, const size_t length,
+                                           const int64_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    int64_t prod = multiply ? (int64_t)((uint64_t)num[j] * (uint64_t)mul) : num[j];
+    result[j] = shiftround_scalar_i64(prod, shift);
+  }
+}
+
+static inline void batch_kernel_u64_scalar(const uint64_t *num, uint64_t *result, const size_t length,
+                                           const uint64_t mul, const uint8_t shift, const int multiply) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    uint64_t prod = multiply ? num[j] * mul : num[j];
+    result[j] = shiftround_scalar_u64(prod, shift);
+  }
+}
+
+#ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+
+/********************************************************************************
+ ********                      SSE2 vector helpers                       ********
+ ********************************************************************************/
+
+/* Low 32 bits of each 32-bit lane product. pmulld requires SSE4.1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i mullo_epi32_sse2(const __m128i a, const __m128i b) {
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/* Low 64 bits of each 64-bit lane product. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i mullo_epi64_sse2(const __m128i a, const __m128i b) {
+  __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+  return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+}
+
+/* All bits set in each 64-bit lane of x that is negative. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i sign_epi64_sse2(const __m128i x) {
+  return _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1));
+}
+
+/* All bits set in each 64-bit lane where a equals b. pcmpeqq requires SSE4.1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i cmpeq_epi64_sse2(const __m128i a, const __m128i b) {
+  __m128i eq32 = _mm_cmpeq_epi32(a, b);
+  return _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+/* ROUND(x / 2^shift) for signed 16-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i shiftround_epi16_sse2(const __m128i x, const __m128i shift, const __m128i shift_m1,
+                                                                                        const __m128i one, const __m128i half, const __m128i low_bits) {
+  __m128i quotient = _mm_sra_epi16(x, shift);
+  __m128i round_up = _mm_and_si128(_mm_srl_epi16(x, shift_m1), one);
+  __m128i neg_tie = _mm_and_si128(_mm_cmpgt_epi16(_mm_setzero_si128(), x),
+                                  _mm_cmpeq_epi16(_mm_and_si128(x, low_bits), half));
+  return _mm_add_epi16(quotient, _mm_andnot_si128(neg_tie, round_up));
+}
+
+/* ROUND(x / 2^shift) for unsigned 16-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i shiftround_epu16_sse2(const __m128i x, const __m128i shift, const __m128i shift_m1, const __m128i one) {
+  return _mm_add_epi16(_mm_srl_epi16(x, shift), _mm_and_si128(_mm_srl_epi16(x, shift_m1), one));
+}
+
+/* ROUND(x / 2^shift) for signed 32-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i shiftround_epi32_sse2(const __m128i x, const __m128i shift, const __m128i shift_m1,
+                                                                                        const __m128i one, const __m128i half, const __m128i low_bits) {
+  __m128i quotient = _mm_sra_epi32(x, shift);
+  __m128i round_up = _mm_and_si128(_mm_srl_epi32(x, shift_m1), one);
+  __m128i neg_tie = _mm_and_si128(_mm_cmpgt_epi32(_mm_setzero_si128(), x),
+                                  _mm_cmpeq_epi32(_mm_and_si128(x, low_bits), half));
+  return _mm_add_epi32(quotient, _mm_andnot_si128(neg_tie, round_up));
+}
+
+/* ROUND(x / 2^shift) for unsigned 32-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i shiftround_epu32_sse2(const __m128i x, const __m128i shift, const __m128i shift_m1, const __m128i one) {
+  return _mm_add_epi32(_mm_srl_epi32(x, shift), _mm_and_si128(_mm_srl_epi32(x, shift_m1), one));
+}
+
+/**
+ * ROUND(x / 2^shift) for signed 64-bit lanes. shift_m1 holds shift-1.
+ * SSE2 has no 64-bit arithmetic right shift, so it is built from a
+ * logical shift of x with its sign bits flipped.
+ */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i shiftround_epi64_sse2(const __m128i x, const __m128i shift, const __m128i shift_m1,
+                                                                                        const __m128i one, const __m128i half, const __m128i low_bits) {
+  __m128i sign = sign_epi64_sse2(x);
+  __m128i quotient = _mm_xor_si128(_mm_srl_epi64(_mm_xor_si128(x, sign), shift), sign);
+  __m128i round_up = _mm_and_si128(_mm_srl_epi64(x, shift_m1), one);
+  __m128i neg_tie = _mm_and_si128(sign, cmpeq_epi64_sse2(_mm_and_si128(x, low_bits), half));
+  return _mm_add_epi64(quotient, _mm_andnot_si128(neg_tie, round_up));
+}
+
+/* ROUND(x / 2^shift) for unsigned 64-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline __m128i shiftround_epu64_sse2(const __m128i x, const __m128i shift, const __m128i shift_m1, const __m128i one) {
+  return _mm_add_epi64(_mm_srl_epi64(x, shift), _mm_and_si128(_mm_srl_epi64(x, shift_m1), one));
+}
+
+/********************************************************************************
+ ********                      SSE2 and SSE4.1 kernels                   ********
+ ********************************************************************************/
+
+/**
+ * The 32-bit kernels are repeated for SSE4.1, whose pmulld replaces the
+ * two pmuludq and the shuffles of mullo_epi32_sse2.
+ */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_i8_sse2(const int8_t *num, int8_t *result, const size_t length,
+                                                                                    const int8_t mul, const uint8_t shift, const int multiply) {
+  const int16_t half_remainder = (int16_t)((uint16_t)1 << (shift - (uint8_t)1));
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi16(1);
+  const __m128i half = _mm_set1_epi16(half_remainder);
+  const __m128i low = _mm_set1_epi16((int16_t)((half_remainder << 1) - 1));
+  const __m128i vmul = _mm_set1_epi16(mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    __m128i x_lo = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+    __m128i x_hi = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+    if (multiply) {
+      x_lo = _mm_srai_epi16(_mm_slli_epi16(_mm_mullo_epi16(x_lo, vmul), 8), 8);
+      x_hi = _mm_srai_epi16(_mm_slli_epi16(_mm_mullo_epi16(x_hi, vmul), 8), 8);
+    }
+    x_lo = shiftround_epi16_sse2(x_lo, vshift, vshift_m1, one, half, low);
+    x_hi = shiftround_epi16_sse2(x_hi, vshift, vshift_m1, one, half, low);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packs_epi16(x_lo, x_hi));
+  }
+  batch_kernel_i8_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_u8_sse2(const uint8_t *num, uint8_t *result, const size_t length,
+                                                                                    const uint8_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi16(1);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i low_byte = _mm_set1_epi16(0x00FF);
+  const __m128i vmul = _mm_set1_epi16((int16_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    __m128i x_lo = _mm_unpacklo_epi8(x, zero);
+    __m128i x_hi = _mm_unpackhi_epi8(x, zero);
+    if (multiply) {
+      x_lo = _mm_and_si128(_mm_mullo_epi16(x_lo, vmul), low_byte);
+      x_hi = _mm_and_si128(_mm_mullo_epi16(x_hi, vmul), low_byte);
+    }
+    x_lo = shiftround_epu16_sse2(x_lo, vshift, vshift_m1, one);
+    x_hi = shiftround_epu16_sse2(x_hi, vshift, vshift_m1, one);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packus_epi16(x_lo, x_hi));
+  }
+  batch_kernel_u8_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_i16_sse2(const int16_t *num, int16_t *result, const size_t length,
+                                                                                     const int16_t mul, const uint8_t shift, const int multiply) {
+  const int16_t half_remainder = (int16_t)((uint16_t)1 << (shift - (uint8_t)1));
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi16(1);
+  const __m128i half = _mm_set1_epi16(half_remainder);
+  const __m128i low = _mm_set1_epi16((int16_t)((half_remainder << 1) - 1));
+  const __m128i vmul = _mm_set1_epi16(mul);
+  size_t j = 0u;
+  for (; length - j >= 8u; j += 8u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = _mm_mullo_epi16(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epi16_sse2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i16_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_u16_sse2(const uint16_t *num, uint16_t *result, const size_t length,
+                                                                                     const uint16_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi16(1);
+  const __m128i vmul = _mm_set1_epi16((int16_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 8u; j += 8u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = _mm_mullo_epi16(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epu16_sse2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u16_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_i32_sse2(const int32_t *num, int32_t *result, const size_t length,
+                                                                                     const int32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i half = _mm_set1_epi32((int32_t)(1u << (shift - (uint8_t)1)));
+  const __m128i low = _mm_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m128i vmul = _mm_set1_epi32(mul);
+  size_t j = 0u;
+  for (; length - j >= 4u; j += 4u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = mullo_epi32_sse2(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epi32_sse2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_u32_sse2(const uint32_t *num, uint32_t *result, const size_t length,
+                                                                                     const uint32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i vmul = _mm_set1_epi32((int32_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 4u; j += 4u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = mullo_epi32_sse2(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epu32_sse2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE4_1 static inline void batch_kernel_i32_sse4_1(const int32_t *num, int32_t *result, const size_t length,
+                                                                                         const int32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i half = _mm_set1_epi32((int32_t)(1u << (shift - (uint8_t)1)));
+  const __m128i low = _mm_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m128i vmul = _mm_set1_epi32(mul);
+  size_t j = 0u;
+  for (; length - j >= 4u; j += 4u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = _mm_mullo_epi32(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epi32_sse2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE4_1 static inline void batch_kernel_u32_sse4_1(const uint32_t *num, uint32_t *result, const size_t length,
+                                                                                         const uint32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i vmul = _mm_set1_epi32((int32_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 4u; j += 4u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = _mm_mullo_epi32(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epu32_sse2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_i64_sse2(const int64_t *num, int64_t *result, const size_t length,
+                                                                                     const int64_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi64x(1ll);
+  const __m128i half = _mm_set1_epi64x((int64_t)(1ull << (shift - (uint8_t)1)));
+  const __m128i low = _mm_set1_epi64x((int64_t)((1ull << shift) - 1ull));
+  const __m128i vmul = _mm_set1_epi64x(mul);
+  size_t j = 0u;
+  for (; length - j >= 2u; j += 2u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = mullo_epi64_sse2(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epi64_sse2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i64_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_SSE2 static inline void batch_kernel_u64_sse2(const uint64_t *num, uint64_t *result, const size_t length,
+                                                                                     const uint64_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m128i one = _mm_set1_epi64x(1ll);
+  const __m128i vmul = _mm_set1_epi64x((int64_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 2u; j += 2u) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(num + j));
+    if (multiply) x = mullo_epi64_sse2(x, vmul);
+    _mm_storeu_si128((__m128i *)(result + j), shiftround_epu64_sse2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u64_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+/********************************************************************************
+ ********                      AVX2 vector helpers                       ********
+ ********************************************************************************/
+
+/* Low 64 bits of each 64-bit lane product. vpmullq requires AVX-512DQ. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i mullo_epi64_avx2(const __m256i a, const __m256i b) {
+  __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                   _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+  return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
+
+/* ROUND(x / 2^shift) for signed 16-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i shiftround_epi16_avx2(const __m256i x, const __m128i shift, const __m128i shift_m1,
+                                                                                        const __m256i one, const __m256i half, const __m256i low_bits) {
+  __m256i quotient = _mm256_sra_epi16(x, shift);
+  __m256i round_up = _mm256_and_si256(_mm256_srl_epi16(x, shift_m1), one);
+  __m256i neg_tie = _mm256_and_si256(_mm256_cmpgt_epi16(_mm256_setzero_si256(), x),
+                                     _mm256_cmpeq_epi16(_mm256_and_si256(x, low_bits), half));
+  return _mm256_add_epi16(quotient, _mm256_andnot_si256(neg_tie, round_up));
+}
+
+/* ROUND(x / 2^shift) for unsigned 16-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i shiftround_epu16_avx2(const __m256i x, const __m128i shift, const __m128i shift_m1, const __m256i one) {
+  return _mm256_add_epi16(_mm256_srl_epi16(x, shift), _mm256_and_si256(_mm256_srl_epi16(x, shift_m1), one));
+}
+
+/* ROUND(x / 2^shift) for signed 32-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i shiftround_epi32_avx2(const __m256i x, const __m128i shift, const __m128i shift_m1,
+                                                                                        const __m256i one, const __m256i half, const __m256i low_bits) {
+  __m256i quotient = _mm256_sra_epi32(x, shift);
+  __m256i round_up = _mm256_and_si256(_mm256_srl_epi32(x, shift_m1), one);
+  __m256i neg_tie = _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), x),
+                                     _mm256_cmpeq_epi32(_mm256_and_si256(x, low_bits), half));
+  return _mm256_add_epi32(quotient, _mm256_andnot_si256(neg_tie, round_up));
+}
+
+/* ROUND(x / 2^shift) for unsigned 32-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i shiftround_epu32_avx2(const __m256i x, const __m128i shift, const __m128i shift_m1, const __m256i one) {
+  return _mm256_add_epi32(_mm256_srl_epi32(x, shift), _mm256_and_si256(_mm256_srl_epi32(x, shift_m1), one));
+}
+
+/**
+ * ROUND(x / 2^shift) for signed 64-bit lanes. shift_m1 holds shift-1.
+ * AVX2 has no 64-bit arithmetic right shift, so it is built from a
+ * logical shift of x with its sign bits flipped.
+ */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i shiftround_epi64_avx2(const __m256i x, const __m128i shift, const __m128i shift_m1,
+                                                                                        const __m256i one, const __m256i half, const __m256i low_bits) {
+  __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+  __m256i quotient = _mm256_xor_si256(_mm256_srl_epi64(_mm256_xor_si256(x, sign), shift), sign);
+  __m256i round_up = _mm256_and_si256(_mm256_srl_epi64(x, shift_m1), one);
+  __m256i neg_tie = _mm256_and_si256(sign, _mm256_cmpeq_epi64(_mm256_and_si256(x, low_bits), half));
+  return _mm256_add_epi64(quotient, _mm256_andnot_si256(neg_tie, round_up));
+}
+
+/* ROUND(x / 2^shift) for unsigned 64-bit lanes. shift_m1 holds shift-1. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline __m256i shiftround_epu64_avx2(const __m256i x, const __m128i shift, const __m128i shift_m1, const __m256i one) {
+  return _mm256_add_epi64(_mm256_srl_epi64(x, shift), _mm256_and_si256(_mm256_srl_epi64(x, shift_m1), one));
+}
+
+/********************************************************************************
+ ********                          AVX2 kernels                          ********
+ ********************************************************************************/
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_i8_avx2(const int8_t *num, int8_t *result, const size_t length,
+                                                                                    const int8_t mul, const uint8_t shift, const int multiply) {
+  const int16_t half_remainder = (int16_t)((uint16_t)1 << (shift - (uint8_t)1));
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i half = _mm256_set1_epi16(half_remainder);
+  const __m256i low = _mm256_set1_epi16((int16_t)((half_remainder << 1) - 1));
+  const __m256i vmul = _mm256_set1_epi16(mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m256i x = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(num + j)));
+    if (multiply) x = _mm256_srai_epi16(_mm256_slli_epi16(_mm256_mullo_epi16(x, vmul), 8), 8);
+    x = shiftround_epi16_avx2(x, vshift, vshift_m1, one, half, low);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packs_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+  }
+  batch_kernel_i8_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_u8_avx2(const uint8_t *num, uint8_t *result, const size_t length,
+                                                                                    const uint8_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i low_byte = _mm256_set1_epi16(0x00FF);
+  const __m256i vmul = _mm256_set1_epi16((int16_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m256i x = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(num + j)));
+    if (multiply) x = _mm256_and_si256(_mm256_mullo_epi16(x, vmul), low_byte);
+    x = shiftround_epu16_avx2(x, vshift, vshift_m1, one);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packus_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+  }
+  batch_kernel_u8_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_i16_avx2(const int16_t *num, int16_t *result, const size_t length,
+                                                                                     const int16_t mul, const uint8_t shift, const int multiply) {
+  const int16_t half_remainder = (int16_t)((uint16_t)1 << (shift - (uint8_t)1));
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i half = _mm256_set1_epi16(half_remainder);
+  const __m256i low = _mm256_set1_epi16((int16_t)((half_remainder << 1) - 1));
+  const __m256i vmul = _mm256_set1_epi16(mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(num + j));
+    if (multiply) x = _mm256_mullo_epi16(x, vmul);
+    _mm256_storeu_si256((__m256i *)(result + j), shiftround_epi16_avx2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i16_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_u16_avx2(const uint16_t *num, uint16_t *result, const size_t length,
+                                                                                     const uint16_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i vmul = _mm256_set1_epi16((int16_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(num + j));
+    if (multiply) x = _mm256_mullo_epi16(x, vmul);
+    _mm256_storeu_si256((__m256i *)(result + j), shiftround_epu16_avx2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u16_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_i32_avx2(const int32_t *num, int32_t *result, const size_t length,
+                                                                                     const int32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i half = _mm256_set1_epi32((int32_t)(1u << (shift - (uint8_t)1)));
+  const __m256i low = _mm256_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m256i vmul = _mm256_set1_epi32(mul);
+  size_t j = 0u;
+  for (; length - j >= 8u; j += 8u) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(num + j));
+    if (multiply) x = _mm256_mullo_epi32(x, vmul);
+    _mm256_storeu_si256((__m256i *)(result + j), shiftround_epi32_avx2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_u32_avx2(const uint32_t *num, uint32_t *result, const size_t length,
+                                                                                     const uint32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i vmul = _mm256_set1_epi32((int32_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 8u; j += 8u) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(num + j));
+    if (multiply) x = _mm256_mullo_epi32(x, vmul);
+    _mm256_storeu_si256((__m256i *)(result + j), shiftround_epu32_avx2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_i64_avx2(const int64_t *num, int64_t *result, const size_t length,
+                                                                                     const int64_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi64x(1ll);
+  const __m256i half = _mm256_set1_epi64x((int64_t)(1ull << (shift - (uint8_t)1)));
+  const __m256i low = _mm256_set1_epi64x((int64_t)((1ull << shift) - 1ull));
+  const __m256i vmul = _mm256_set1_epi64x(mul);
+  size_t j = 0u;
+  for (; length - j >= 4u; j += 4u) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(num + j));
+    if (multiply) x = mullo_epi64_avx2(x, vmul);
+    _mm256_storeu_si256((__m256i *)(result + j), shiftround_epi64_avx2(x, vshift, vshift_m1, one, half, low));
+  }
+  batch_kernel_i64_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX2 static inline void batch_kernel_u64_avx2(const uint64_t *num, uint64_t *result, const size_t length,
+                                                                                     const uint64_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m128i vshift_m1 = _mm_cvtsi32_si128((int)shift - 1);
+  const __m256i one = _mm256_set1_epi64x(1ll);
+  const __m256i vmul = _mm256_set1_epi64x((int64_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 4u; j += 4u) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(num + j));
+    if (multiply) x = mullo_epi64_avx2(x, vmul);
+    _mm256_storeu_si256((__m256i *)(result + j), shiftround_epu64_avx2(x, vshift, vshift_m1, one));
+  }
+  batch_kernel_u64_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+/********************************************************************************
+ ********                     AVX-512 vector helpers                     ********
+ ********************************************************************************/
+
+/* ROUND(x / 2^shift) for signed 16-bit lanes. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline __m512i shiftround_epi16_avx512(const __m512i x, const __m128i shift,
+                                                                                            const __m512i one, const __m512i half, const __m512i low_bits) {
+  __m512i quotient = _mm512_sra_epi16(x, shift);
+  __mmask32 neg_tie = _mm512_cmplt_epi16_mask(x, _mm512_setzero_si512()) &
+                      _mm512_cmpeq_epi16_mask(_mm512_and_si512(x, low_bits), half);
+  __mmask32 round_up = _mm512_test_epi16_mask(x, half) & ~neg_tie;
+  return _mm512_mask_add_epi16(quotient, round_up, quotient, one);
+}
+
+/* ROUND(x / 2^shift) for unsigned 16-bit lanes. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline __m512i shiftround_epu16_avx512(const __m512i x, const __m128i shift, const __m512i one, const __m512i half) {
+  __m512i quotient = _mm512_srl_epi16(x, shift);
+  return _mm512_mask_add_epi16(quotient, _mm512_test_epi16_mask(x, half), quotient, one);
+}
+
+/* ROUND(x / 2^shift) for signed 32-bit lanes. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline __m512i shiftround_epi32_avx512(const __m512i x, const __m128i shift,
+                                                                                            const __m512i one, const __m512i half, const __m512i low_bits) {
+  __m512i quotient = _mm512_sra_epi32(x, shift);
+  __mmask16 neg_tie = _mm512_cmplt_epi32_mask(x, _mm512_setzero_si512()) &
+                      _mm512_cmpeq_epi32_mask(_mm512_and_si512(x, low_bits), half);
+  __mmask16 round_up = _mm512_test_epi32_mask(x, half) & ~neg_tie;
+  return _mm512_mask_add_epi32(quotient, round_up, quotient, one);
+}
+
+/* ROUND(x / 2^shift) for unsigned 32-bit lanes. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline __m512i shiftround_epu32_avx512(const __m512i x, const __m128i shift, const __m512i one, const __m512i half) {
+  __m512i quotient = _mm512_srl_epi32(x, shift);
+  return _mm512_mask_add_epi32(quotient, _mm512_test_epi32_mask(x, half), quotient, one);
+}
+
+/* ROUND(x / 2^shift) for signed 64-bit lanes. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline __m512i shiftround_epi64_avx512(const __m512i x, const __m128i shift,
+                                                                                            const __m512i one, const __m512i half, const __m512i low_bits) {
+  __m512i quotient = _mm512_sra_epi64(x, shift);
+  __mmask8 neg_tie = _mm512_cmplt_epi64_mask(x, _mm512_setzero_si512()) &
+                     _mm512_cmpeq_epi64_mask(_mm512_and_si512(x, low_bits), half);
+  __mmask8 round_up = _mm512_test_epi64_mask(x, half) & ~neg_tie;
+  return _mm512_mask_add_epi64(quotient, round_up, quotient, one);
+}
+
+/* ROUND(x / 2^shift) for unsigned 64-bit lanes. */
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline __m512i shiftround_epu64_avx512(const __m512i x, const __m128i shift, const __m512i one, const __m512i half) {
+  __m512i quotient = _mm512_srl_epi64(x, shift);
+  return _mm512_mask_add_epi64(quotient, _mm512_test_epi64_mask(x, half), quotient, one);
+}
+
+/********************************************************************************
+ ********                         AVX-512 kernels                        ********
+ ********************************************************************************/
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_i8_avx512(const int8_t *num, int8_t *result, const size_t length,
+                                                                                        const int8_t mul, const uint8_t shift, const int multiply) {
+  const int16_t half_remainder = (int16_t)((uint16_t)1 << (shift - (uint8_t)1));
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi16(1);
+  const __m512i half = _mm512_set1_epi16(half_remainder);
+  const __m512i low = _mm512_set1_epi16((int16_t)((half_remainder << 1) - 1));
+  const __m512i vmul = _mm512_set1_epi16(mul);
+  size_t j = 0u;
+  for (; length - j >= 32u; j += 32u) {
+    __m512i x = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(num + j)));
+    if (multiply) x = _mm512_srai_epi16(_mm512_slli_epi16(_mm512_mullo_epi16(x, vmul), 8), 8);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtepi16_epi8(shiftround_epi16_avx512(x, vshift, one, half, low)));
+  }
+  batch_kernel_i8_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_u8_avx512(const uint8_t *num, uint8_t *result, const size_t length,
+                                                                                        const uint8_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi16(1);
+  const __m512i half = _mm512_set1_epi16((int16_t)((uint16_t)1 << (shift - (uint8_t)1)));
+  const __m512i low_byte = _mm512_set1_epi16(0x00FF);
+  const __m512i vmul = _mm512_set1_epi16((int16_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 32u; j += 32u) {
+    __m512i x = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)(num + j)));
+    if (multiply) x = _mm512_and_si512(_mm512_mullo_epi16(x, vmul), low_byte);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtepi16_epi8(shiftround_epu16_avx512(x, vshift, one, half)));
+  }
+  batch_kernel_u8_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_i16_avx512(const int16_t *num, int16_t *result, const size_t length,
+                                                                                         const int16_t mul, const uint8_t shift, const int multiply) {
+  const int16_t half_remainder = (int16_t)((uint16_t)1 << (shift - (uint8_t)1));
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi16(1);
+  const __m512i half = _mm512_set1_epi16(half_remainder);
+  const __m512i low = _mm512_set1_epi16((int16_t)((half_remainder << 1) - 1));
+  const __m512i vmul = _mm512_set1_epi16(mul);
+  size_t j = 0u;
+  for (; length - j >= 32u; j += 32u) {
+    __m512i x = _mm512_loadu_si512((const void *)(num + j));
+    if (multiply) x = _mm512_mullo_epi16(x, vmul);
+    _mm512_storeu_si512((void *)(result + j), shiftround_epi16_avx512(x, vshift, one, half, low));
+  }
+  batch_kernel_i16_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_u16_avx512(const uint16_t *num, uint16_t *result, const size_t length,
+                                                                                         const uint16_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi16(1);
+  const __m512i half = _mm512_set1_epi16((int16_t)((uint16_t)1 << (shift - (uint8_t)1)));
+  const __m512i vmul = _mm512_set1_epi16((int16_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 32u; j += 32u) {
+    __m512i x = _mm512_loadu_si512((const void *)(num + j));
+    if (multiply) x = _mm512_mullo_epi16(x, vmul);
+    _mm512_storeu_si512((void *)(result + j), shiftround_epu16_avx512(x, vshift, one, half));
+  }
+  batch_kernel_u16_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_i32_avx512(const int32_t *num, int32_t *result, const size_t length,
+                                                                                         const int32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i half = _mm512_set1_epi32((int32_t)(1u << (shift - (uint8_t)1)));
+  const __m512i low = _mm512_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m512i vmul = _mm512_set1_epi32(mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m512i x = _mm512_loadu_si512((const void *)(num + j));
+    if (multiply) x = _mm512_mullo_epi32(x, vmul);
+    _mm512_storeu_si512((void *)(result + j), shiftround_epi32_avx512(x, vshift, one, half, low));
+  }
+  batch_kernel_i32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_u32_avx512(const uint32_t *num, uint32_t *result, const size_t length,
+                                                                                         const uint32_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i half = _mm512_set1_epi32((int32_t)(1u << (shift - (uint8_t)1)));
+  const __m512i vmul = _mm512_set1_epi32((int32_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 16u; j += 16u) {
+    __m512i x = _mm512_loadu_si512((const void *)(num + j));
+    if (multiply) x = _mm512_mullo_epi32(x, vmul);
+    _mm512_storeu_si512((void *)(result + j), shiftround_epu32_avx512(x, vshift, one, half));
+  }
+  batch_kernel_u32_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_i64_avx512(const int64_t *num, int64_t *result, const size_t length,
+                                                                                         const int64_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi64(1ll);
+  const __m512i half = _mm512_set1_epi64((int64_t)(1ull << (shift - (uint8_t)1)));
+  const __m512i low = _mm512_set1_epi64((int64_t)((1ull << shift) - 1ull));
+  const __m512i vmul = _mm512_set1_epi64(mul);
+  size_t j = 0u;
+  for (; length - j >= 8u; j += 8u) {
+    __m512i x = _mm512_loadu_si512((const void *)(num + j));
+    if (multiply) x = _mm512_mullo_epi64(x, vmul);
+    _mm512_storeu_si512((void *)(result + j), shiftround_epi64_avx512(x, vshift, one, half, low));
+  }
+  batch_kernel_i64_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+MULTSHIFTROUND_SHIFTROUND_BATCH_TARGET_AVX512 static inline void batch_kernel_u64_avx512(const uint64_t *num, uint64_t *result, const size_t length,
+                                                                                         const uint64_t mul, const uint8_t shift, const int multiply) {
+  const __m128i vshift = _mm_cvtsi32_si128((int)shift);
+  const __m512i one = _mm512_set1_epi64(1ll);
+  const __m512i half = _mm512_set1_epi64((int64_t)(1ull << (shift - (uint8_t)1)));
+  const __m512i vmul = _mm512_set1_epi64((int64_t)mul);
+  size_t j = 0u;
+  for (; length - j >= 8u; j += 8u) {
+    __m512i x = _mm512_loadu_si512((const void *)(num + j));
+    if (multiply) x = _mm512_mullo_epi64(x, vmul);
+    _mm512_storeu_si512((void *)(result + j), shiftround_epu64_avx512(x, vshift, one, half));
+  }
+  batch_kernel_u64_scalar(num + j, result + j, length - j, mul, shift, multiply);
+}
+
+#endif /* #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86 */
+
+/********************************************************************************
+ ********                         kernel dispatch                        ********
+ ********************************************************************************/
+
+/**
+ * Each dispatcher runs the widest kernel that cpu_features() reports and
+ * falls back to the scalar kernel. shift must be valid for the type and
+ * nonzero.
+ */
+static void batch_kernel_i8(const int8_t *num, int8_t *result, const size_t length,
+                            const int8_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_i8_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_i8_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_i8_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_i8_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_u8(const uint8_t *num, uint8_t *result, const size_t length,
+                            const uint8_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_u8_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_u8_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_u8_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_u8_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_i16(const int16_t *num, int16_t *result, const size_t length,
+                             const int16_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_i16_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_i16_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_i16_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_i16_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_u16(const uint16_t *num, uint16_t *result, const size_t length,
+                             const uint16_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_u16_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_u16_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_u16_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_u16_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_i32(const int32_t *num, int32_t *result, const size_t length,
+                             const int32_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_i32_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_i32_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      batch_kernel_i32_sse4_1(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_i32_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_i32_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_u32(const uint32_t *num, uint32_t *result, const size_t length,
+                             const uint32_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_u32_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_u32_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      batch_kernel_u32_sse4_1(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_u32_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_u32_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_i64(const int64_t *num, int64_t *result, const size_t length,
+                             const int64_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_i64_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_i64_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_i64_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_i64_scalar(num, result, length, mul, shift, multiply);
+}
+
+static void batch_kernel_u64(const uint64_t *num, uint64_t *result, const size_t length,
+                             const uint64_t mul, const uint8_t shift, const int multiply) {
+  #ifdef MULTSHIFTROUND_SHIFTROUND_BATCH_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      batch_kernel_u64_avx512(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      batch_kernel_u64_avx2(num, result, length, mul, shift, multiply);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      batch_kernel_u64_sse2(num, result, length, mul, shift, multiply);
+      return;
+    }
+  #endif
+  batch_kernel_u64_scalar(num, result, length, mul, shift, multiply);
+}
+
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,6]. */
+INTMATH_API void shiftround_batch_i8(const int8_t *num, int8_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+      fprintf(stderr, "ERROR: shiftround_batch_i8(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,6].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_i8", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)6) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_i8(num, result, length, (int8_t)1, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,6]. */
+INTMATH_API void multshiftround_batch_i8(const int8_t *num, int8_t *result, const size_t length, const int8_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+      fprintf(stderr, "ERROR: multshiftround_batch_i8(num, result, %lu, %i, %u), shift = %u is invalid; it must be on the range [0,6].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_i8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)6) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = (int8_t)(num[j] * mul);
+    return;
+  }
+  batch_kernel_i8(num, result, length, mul, shift, 1);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,7]. */
+INTMATH_API void shiftround_batch_u8(const uint8_t *num, uint8_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+      fprintf(stderr, "ERROR: shiftround_batch_u8(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,7].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_u8", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)7) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_u8(num, result, length, (uint8_t)1, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,7]. */
+INTMATH_API void multshiftround_batch_u8(const uint8_t *num, uint8_t *result, const size_t length, const uint8_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+      fprintf(stderr, "ERROR: multshiftround_batch_u8(num, result, %lu, %u, %u), shift = %u is invalid; it must be on the range [0,7].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_u8", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)7) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)(num[j] * mul);
+    return;
+  }
+  batch_kernel_u8(num, result, length, mul, shift, 1);
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,14]. */
+INTMATH_API void shiftround_batch_i16(const int16_t *num, int16_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: shiftround_batch_i16(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,14].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_i16", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)14) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_i16(num, result, length, (int16_t)1, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,14]. */
+INTMATH_API void multshiftround_batch_i16(const int16_t *num, int16_t *result, const size_t length, const int16_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+      fprintf(stderr, "ERROR: multshiftround_batch_i16(num, result, %lu, %i, %u), shift = %u is invalid; it must be on the range [0,14].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_i16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = (int16_t)(num[j] * mul);
+    return;
+  }
+  batch_kernel_i16(num, result, length, mul, shift, 1);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,15]. */
+INTMATH_API void shiftround_batch_u16(const uint16_t *num, uint16_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: shiftround_batch_u16(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,15].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_u16", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)15) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_u16(num, result, length, (uint16_t)1, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,15]. */
+INTMATH_API void multshiftround_batch_u16(const uint16_t *num, uint16_t *result, const size_t length, const uint16_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+      fprintf(stderr, "ERROR: multshiftround_batch_u16(num, result, %lu, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_u16", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)((uint32_t)num[j] * (uint32_t)mul);
+    return;
+  }
+  batch_kernel_u16(num, result, length, mul, shift, 1);
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,30]. */
+INTMATH_API void shiftround_batch_i32(const int32_t *num, int32_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: shiftround_batch_i32(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,30].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_i32", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    for (j = 0u; j < length; j++) result[j] = 0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_i32(num, result, length, 1, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,30]. */
+INTMATH_API void multshiftround_batch_i32(const int32_t *num, int32_t *result, const size_t length, const int32_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+      fprintf(stderr, "ERROR: multshiftround_batch_i32(num, result, %lu, %i, %u), shift = %u is invalid; it must be on the range [0,30].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_i32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) {
+    for (j = 0u; j < length; j++) result[j] = 0;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = (int32_t)((uint32_t)num[j] * (uint32_t)mul);
+    return;
+  }
+  batch_kernel_i32(num, result, length, mul, shift, 1);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,31]. */
+INTMATH_API void shiftround_batch_u32(const uint32_t *num, uint32_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: shiftround_batch_u32(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,31].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_u32", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < length; j++) result[j] = 0u;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_u32(num, result, length, 1u, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,31]. */
+INTMATH_API void multshiftround_batch_u32(const uint32_t *num, uint32_t *result, const size_t length, const uint32_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+      fprintf(stderr, "ERROR: multshiftround_batch_u32(num, result, %lu, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_u32", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) {
+    for (j = 0u; j < length; j++) result[j] = 0u;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = num[j] * mul;
+    return;
+  }
+  batch_kernel_u32(num, result, length, mul, shift, 1);
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void shiftround_batch_i64(const int64_t *num, int64_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: shiftround_batch_i64(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_i64", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = 0ll;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_i64(num, result, length, 1ll, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,62]. */
+INTMATH_API void multshiftround_batch_i64(const int64_t *num, int64_t *result, const size_t length, const int64_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+      fprintf(stderr, "ERROR: multshiftround_batch_i64(num, result, %lu, %" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_i64", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) {
+    for (j = 0u; j < length; j++) result[j] = 0ll;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = (int64_t)((uint64_t)num[j] * (uint64_t)mul);
+    return;
+  }
+  batch_kernel_i64(num, result, length, mul, shift, 1);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void shiftround_batch_u64(const uint64_t *num, uint64_t *result, const size_t length, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: shiftround_batch_u64(num, result, %lu, %u), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_batch_u64", (uint64_t)length, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = 0ull;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    if (result != num) for (j = 0u; j < length; j++) result[j] = num[j];
+    return;
+  }
+  batch_kernel_u64(num, result, length, 1ull, shift, 0);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,63]. */
+INTMATH_API void multshiftround_batch_u64(const uint64_t *num, uint64_t *result, const size_t length, const uint64_t mul, const uint8_t shift) {
+  size_t j;
+
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+      fprintf(stderr, "ERROR: multshiftround_batch_u64(num, result, %lu, %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", (unsigned long)length, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_batch_u64", (uint64_t)length, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) {
+    for (j = 0u; j < length; j++) result[j] = 0ull;
+    return;
+  }
+  if (shift == (uint8_t)0) {
+    for (j = 0u; j < length; j++) result[j] = num[j] * mul;
+    return;
+  }
+  batch_kernel_u64(num, result, length, mul, shift, 1);
+}
+
+#endif /* #ifndef MULTSHIFTROUND_SHIFTROUND_BATCH_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
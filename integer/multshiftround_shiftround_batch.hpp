@@ -0,0 +1,377 @@
+/**
+ * multshiftround_shiftround_batch.hpp
+ * Specifies the templated functions
+ *     void shiftround_batch<typename type>(const type *num, type *result, const size_t length, const uint8_t shift);
+ *     void shiftround_batch<typename type>(type *values, const size_t length, const uint8_t shift);
+ *     OutputIt shiftround_batch<typename type>(InputIt first, InputIt last, OutputIt d_first, const uint8_t shift);
+ *     void shiftround_batch<typename type>(ForwardIt first, ForwardIt last, const uint8_t shift);
+ * and
+ *     void multshiftround_batch<typename type>(const type *num, type *result, const size_t length, const type mul, const uint8_t shift);
+ *     void multshiftround_batch<typename type>(type *values, const size_t length, const type mul, const uint8_t shift);
+ *     OutputIt multshiftround_batch<typename type>(InputIt first, InputIt last, OutputIt d_first, const type mul, const uint8_t shift);
+ *     void multshiftround_batch<typename type>(ForwardIt first, ForwardIt last, const type mul, const uint8_t shift);
+ * which apply ROUND(num / 2^shift) and ROUND((num * mul) / 2^shift),
+ * respectively, to every element of an array or iterator range without
+ * using the division operator. The forms without a separate result or
+ * d_first argument operate in place.
+ *
+ * The results are bit-identical to those of shiftround<type>(num, shift)
+ * in shiftround_run.hpp and multshiftround<type>(num, mul, shift) in
+ * multshiftround_run.hpp, including the return value of 0 for invalid
+ * shift arguments.
+ *
+ * The pointer forms call the C functions in multshiftround_shiftround_batch.c,
+ * which process the arrays with the widest vector instruction set that
+ * cpu_features() reports at run time. multshiftround_shiftround_batch.c,
+ * multshiftround_shiftround_batch.h, cpu_features.c, and cpu_features.h
+ * are therefore required. The iterator forms copy the range through a
+ * small stack buffer in chunks of batch_buffer_length elements and call
+ * the pointer forms on each chunk.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
+ * uint64_t, or any type equivalent to these.
+ *
+ * shift may range from 0 to one less than the the word length of type for unsigned
+ * types. shift may range from 0 to two less than the word length of type for
+ * signed types.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If multshiftround_shiftround_batch.c is compiled with DEBUG_INTMATH
+ * defined, checks for invalid shift arguments will be enabled.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef MULTSHIFTROUND_SHIFTROUND_BATCH_HPP_
+#define MULTSHIFTROUND_SHIFTROUND_BATCH_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <type_traits>
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "multshiftround_shiftround_batch.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Number of elements the iterator forms copy into a stack buffer and
+ * process with one call to the pointer forms.
+ */
+const size_t batch_buffer_length = 256u;
+
+/* Allows static_assert message in batch primary templates to compile. */
+template <typename type> static bool always_false_multshiftround_shiftround_batch(void) { return false; }
+
+/**
+ * These shiftround_batch and multshiftround_batch primary templates are
+ * catch-alls for presently unimplemented template arguments.
+ */
+template <typename type> void shiftround_batch(const type *num, type *result, const size_t length, const uint8_t shift) {
+  static_assert(always_false_multshiftround_shiftround_batch<type>(), "void shiftround_batch(const type *num, type *result, const size_t length, const uint8_t shift); is not defined for the specified type.");
+}
+
+template <typename type> void multshiftround_batch(const type *num, type *result, const size_t length, const type mul, const uint8_t shift) {
+  static_assert(always_false_multshiftround_shiftround_batch<type>(), "void multshiftround_batch(const type *num, type *result, const size_t length, const type mul, const uint8_t shift); is not defined for the specified type.");
+}
+
+/********************************************************************************
+ ********          int8_t and uint8_t template specializations           ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,6]. */
+template <> inline void shiftround_batch<int8_t>(const int8_t *num, int8_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_i8(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,6]. */
+template <> inline void multshiftround_batch<int8_t>(const int8_t *num, int8_t *result, const size_t length, const int8_t mul, const uint8_t shift) {
+  multshiftround_batch_i8(num, result, length, mul, shift);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,7]. */
+template <> inline void shiftround_batch<uint8_t>(const uint8_t *num, uint8_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_u8(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,7]. */
+template <> inline void multshiftround_batch<uint8_t>(const uint8_t *num, uint8_t *result, const size_t length, const uint8_t mul, const uint8_t shift) {
+  multshiftround_batch_u8(num, result, length, mul, shift);
+}
+
+/********************************************************************************
+ ********         int16_t and uint16_t template specializations          ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,14]. */
+template <> inline void shiftround_batch<int16_t>(const int16_t *num, int16_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_i16(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,14]. */
+template <> inline void multshiftround_batch<int16_t>(const int16_t *num, int16_t *result, const size_t length, const int16_t mul, const uint8_t shift) {
+  multshiftround_batch_i16(num, result, length, mul, shift);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,15]. */
+template <> inline void shiftround_batch<uint16_t>(const uint16_t *num, uint16_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_u16(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,15]. */
+template <> inline void multshiftround_batch<uint16_t>(const uint16_t *num, uint16_t *result, const size_t length, const uint16_t mul, const uint8_t shift) {
+  multshiftround_batch_u16(num, result, length, mul, shift);
+}
+
+/********************************************************************************
+ ********         int32_t and uint32_t template specializations          ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,30]. */
+template <> inline void shiftround_batch<int32_t>(const int32_t *num, int32_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_i32(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,30]. */
+template <> inline void multshiftround_batch<int32_t>(const int32_t *num, int32_t *result, const size_t length, const int32_t mul, const uint8_t shift) {
+  multshiftround_batch_i32(num, result, length, mul, shift);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,31]. */
+template <> inline void shiftround_batch<uint32_t>(const uint32_t *num, uint32_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_u32(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,31]. */
+template <> inline void multshiftround_batch<uint32_t>(const uint32_t *num, uint32_t *result, const size_t length, const uint32_t mul, const uint8_t shift) {
+  multshiftround_batch_u32(num, result, length, mul, shift);
+}
+
+/********************************************************************************
+ ********         int64_t and uint64_t template specializations          ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,62]. */
+template <> inline void shiftround_batch<int64_t>(const int64_t *num, int64_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_i64(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,62]. */
+template <> inline void multshiftround_batch<int64_t>(const int64_t *num, int64_t *result, const size_t length, const int64_t mul, const uint8_t shift) {
+  multshiftround_batch_i64(num, result, length, mul, shift);
+}
+
+/* Stores ROUND(num[j] / 2^shift) into result[j]. shift must be on the range [0,63]. */
+template <> inline void shiftround_batch<uint64_t>(const uint64_t *num, uint64_t *result, const size_t length, const uint8_t shift) {
+  shiftround_batch_u64(num, result, length, shift);
+}
+
+/* Stores ROUND((num[j] * mul) / 2^shift) into result[j]. shift must be on the range [0,63]. */
+template <> inline void multshiftround_batch<uint64_t>(const uint64_t *num, uint64_t *result, const size_t length, const uint64_t mul, const uint8_t shift) {
+  multshiftround_batch_u64(num, result, length, mul, shift);
+}
+
+/********************************************************************************
+ ********                 in-place and iterator range forms              ********
+ ********************************************************************************/
+
+/* Replaces values[j] with ROUND(values[j] / 2^shift). */
+template <typename type> inline void shiftround_batch(type *values, const size_t length, const uint8_t shift) {
+  shiftround_batch<type>(values, values, length, shift);
+}
+
+/* Replaces values[j] with ROUND((values[j] * mul) / 2^shift). */
+template <typename type> inline void multshiftround_batch(type *values, const size_t length, const type mul, const uint8_t shift) {
+  multshiftround_batch<type>(values, values, length, mul, shift);
+}
+
+/**
+ * Writes ROUND(*it / 2^shift) for every it in [first, last) to the range
+ * beginning at d_first. Returns the output iterator one past the last
+ * element written. The enable_if keeps calls to the pointer form with a
+ * non-const num argument from resolving here.
+ */
+template <typename type, typename InputIt, typename OutputIt,
+          typename std::enable_if<!std::is_integral<OutputIt>::value, int>::type = 0>
+inline OutputIt shiftround_batch(InputIt first, InputIt last, OutputIt d_first, const uint8_t shift) {
+  type buffer[batch_buffer_length];
+  while (first != last) {
+    size_t length = 0u;
+    for (; length < batch_buffer_length && first != last; ++first, ++length) buffer[length] = *first;
+    shiftround_batch<type>(buffer, buffer, length, shift);
+    for (size_t j = 0u; j < length; ++j, ++d_first) *d_first = buffer[j];
+  }
+  return d_first;
+}
+
+/**
+ * Writes ROUND((*it * mul) / 2^shift) for every it in [first, last) to the
+ * range beginning at d_first. Returns the output iterator one past the last
+ * element written.
+ */
+template <typename type, typename InputIt, typename OutputIt,
+          typename std::enable_if<!std::is_integral<OutputIt>::value, int>::type = 0>
+inline OutputIt multshiftround_batch(InputIt first, InputIt last, OutputIt d_first, const type mul, const uint8_t shift) {
+  type buffer[batch_buffer_length];
+  while (first != last) {
+    size_t length = 0u;
+    for (; length < batch_buffer_length && first != last; ++first, ++length) buffer[length] = *first;
+    multshiftround_batch<type>(buffer, buffer, length, mul, shift);
+    for (size_t j = 0u; j < length; ++j, ++d_first) *d_first = buffer[j];
+  }
+  return d_first;
+}
+
+/* Replaces every *it in [first, last) with ROUND(*it / 2^shift). */
+template <typename type, typename ForwardIt,
+          typename std::enable_if<!std::is_integral<ForwardIt>::value, int>::type = 0>
+inline void shiftround_batch(ForwardIt first, ForwardIt last, const uint8_t shift) {
+  shiftround_batch<type>(first, last, first, shift);
+}
+
+/* Replaces every *it in [first, last) with ROUND((*it * mul) / 2^shift). */
+template <typename type, typename ForwardIt,
+          typename std::enable_if<!std::is_integral<ForwardIt>::value, int>::type = 0>
+inline void multshiftround_batch(ForwardIt first, ForwardIt last, const type mul, const uint8_t shift) {
+  multshiftround_batch<type>(first, last, first, mul, shift);
+}
+
+#endif /* #ifndef MULTSHIFTROUND_SHIFTROUND_BATCH_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
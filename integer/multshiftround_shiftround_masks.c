@@ -17,21 +17,24 @@
  * end of this file. If not, see http ://creativecommons.org/publicdomain/zero/1.0/
  */
 
+#ifndef MULTSHIFTROUND_SHIFTROUND_MASKS_C_
+#define MULTSHIFTROUND_SHIFTROUND_MASKS_C_
+
 #include "multshiftround_shiftround_masks.h"
 
-const uint8_t masks_8bit[8] = {
+INTMATH_DATA const uint8_t masks_8bit[8] = {
   0x00u, 0x01u, 0x02u, 0x04u, 0x08u, 
          0x10u, 0x20u, 0x40u
 };
 
-const uint16_t masks_16bit[16] = {
+INTMATH_DATA const uint16_t masks_16bit[16] = {
   0x0000u, 0x0001u, 0x0002u, 0x0004u, 0x0008u,
            0x0010u, 0x0020u, 0x0040u, 0x0080u,
            0x0100u, 0x0200u, 0x0400u, 0x0800u,
            0x1000u, 0x2000u, 0x4000u
 };
 
-const uint32_t masks_32bit[32] = {
+INTMATH_DATA const uint32_t masks_32bit[32] = {
   0x00000000u, 0x00000001u, 0x00000002u, 0x00000004u, 0x00000008u,
                0x00000010u, 0x00000020u, 0x00000040u, 0x00000080u,
                0x00000100u, 0x00000200u, 0x00000400u, 0x00000800u,
@@ -42,7 +45,7 @@ const uint32_t masks_32bit[32] = {
                0x10000000u, 0x20000000u, 0x40000000u
 };
 
-const uint64_t masks_64bit[64] = { 
+INTMATH_DATA const uint64_t masks_64bit[64] = { 
   0x0000000000000000ull, 0x0000000000000001ull, 0x0000000000000002ull, 0x0000000000000004ull, 0x0000000000000008ull,
                          0x0000000000000010ull, 0x0000000000000020ull, 0x0000000000000040ull, 0x0000000000000080ull,
                          0x0000000000000100ull, 0x0000000000000200ull, 0x0000000000000400ull, 0x0000000000000800ull,
@@ -61,6 +64,8 @@ const uint64_t masks_64bit[64] = {
                          0x1000000000000000ull, 0x2000000000000000ull, 0x4000000000000000ull
 };
 
+#endif /* #ifndef MULTSHIFTROUND_SHIFTROUND_MASKS_C_ */
+
 /*
 Creative Commons Legal Code
 
@@ -20,11 +20,19 @@
 #define MULTSHIFTROUND_SHIFTROUND_MASKS_H_
 
 #include "inttypes.h"
-
-extern const uint8_t masks_8bit[8];
-extern const uint16_t masks_16bit[16];
-extern const uint32_t masks_32bit[32];
-extern const uint64_t masks_64bit[64];
+#include "intmath_inline.h"
+
+/* In header-only mode the tables are static and defined by the included .c file. */
+#ifndef INTMATH_HEADER_ONLY
+  extern const uint8_t masks_8bit[8];
+  extern const uint16_t masks_16bit[16];
+  extern const uint32_t masks_32bit[32];
+  extern const uint64_t masks_64bit[64];
+#endif
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "multshiftround_shiftround_masks.c"
+#endif
 
 #endif /* #ifndef MULTSHIFTROUND_SHIFTROUND_MASKS_H_ */
 
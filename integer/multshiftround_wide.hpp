@@ -0,0 +1,329 @@
+/**
+ * multshiftround_wide.hpp
+ * Specifies the templated functions
+ *     type multshiftround_wide<typename type>(const type num, const type mul, const uint8_t shift);
+ *     type multshiftround_wide<typename type, uint8_t shift>(const type num, const type mul);
+ * which return the value ROUND((num * mul) / 2^shift) without using the
+ * division operator. The first form takes the shift argument at run time
+ * and the second at compile time.
+ *
+ * Unlike multshiftround<type> in multshiftround_run.hpp and
+ * multshiftround_comp.hpp, the product num * mul is formed at its full
+ * 128-bit width with the helpers in wide_product.h, and the rounding rule
+ * is applied before the result is narrowed to 64 bits. This keeps 64-bit
+ * fixed point scale factors with large numerators on the integer path.
+ * Only the final result must fit in type. If it does not, the low 64 bits
+ * of the rounded result are returned.
+ *
+ * This header does not require multshiftround_wide.c; it only requires
+ * wide_product.h.
+ *
+ * type may be int64_t, uint64_t, or any type equivalent to these.
+ *
+ * shift may range from 0 to 127 for uint64_t and from 0 to 126 for int64_t.
+ * The runtime form returns 0 for invalid shift arguments. The compile time
+ * form rejects them with a static_assert.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments and for
+ * rounded results that do not fit in type will be enabled. This requires
+ * the availability of stderr and fprintf() on the target system and is most
+ * appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef MULTSHIFTROUND_WIDE_HPP_
+#define MULTSHIFTROUND_WIDE_HPP_
+
+#include <cinttypes>
+#include "wide_product.h"
+
+#ifdef DEBUG_INTMATH
+  #include <cstdio>
+#elif defined(DIAGNOSE_INTMATH)
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
+#endif
+
+/* Allows static_assert message in multshiftround_wide primary templates to compile. */
+template <typename type> static bool always_false_multshiftround_wide(void) { return false; }
+
+/**
+ * These multshiftround_wide primary templates are catch-alls for presently
+ * unimplemented template arguments.
+ */
+template <typename type> type multshiftround_wide(const type num, const type mul, const uint8_t shift) {
+  static_assert(always_false_multshiftround_wide<type>(), "type multshiftround_wide<type>(const type num, const type mul, const uint8_t shift) is not defined for the specified type.");
+}
+
+template <typename type, uint8_t shift> struct multshiftround_wide_comp {
+  static_assert(always_false_multshiftround_wide<type>(), "type multshiftround_wide<type, shift>(const type num, const type mul) is not defined for the specified type.");
+};
+
+/********************************************************************************
+ ********                int64_t template specializations                ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,126]. */
+template <> inline int64_t multshiftround_wide<int64_t>(const int64_t num, const int64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > static_cast<uint8_t>(126))
+      std::fprintf(stderr, "ERROR: multshiftround_wide<int64_t>(%" PRIi64 ", %" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,126].\n", num, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(126))
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_wide<int64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  if (shift > static_cast<uint8_t>(126)) return 0ll;
+
+  int64_t prod_hi;
+  const uint64_t prod_lo = wide_mul_i64(num, mul, &prod_hi);
+  int64_t result_hi;
+  const uint64_t result = wide_shiftround_i128(prod_hi, prod_lo, shift, &result_hi);
+
+  #ifdef DEBUG_INTMATH
+    if (result_hi != (static_cast<int64_t>(result) >> 63))
+      std::fprintf(stderr, "ERROR: multshiftround_wide<int64_t>(%" PRIi64 ", %" PRIi64 ", %u), the rounded result does not fit in int64_t.\n", num, mul, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (result_hi != (static_cast<int64_t>(result) >> 63))
+      intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "multshiftround_wide<int64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  return static_cast<int64_t>(result);
+}
+
+/**
+ * Holds the compile time shift form for int64_t. The shift argument is a
+ * constant, so the shift and mask selection in wide_shiftround_i128
+ * reduce to a few instructions after inlining.
+ */
+template <uint8_t shift> struct multshiftround_wide_comp<int64_t, shift> {
+  static_assert(shift <= 126u, "type multshiftround_wide<int64_t, shift>(const int64_t num, const int64_t mul) requires shift on the range [0,126].");
+
+  static inline int64_t apply(const int64_t num, const int64_t mul) {
+    int64_t prod_hi;
+    const uint64_t prod_lo = wide_mul_i64(num, mul, &prod_hi);
+    int64_t result_hi;
+    const uint64_t result = wide_shiftround_i128(prod_hi, prod_lo, shift, &result_hi);
+
+    #ifdef DEBUG_INTMATH
+      if (result_hi != (static_cast<int64_t>(result) >> 63))
+        std::fprintf(stderr, "ERROR: multshiftround_wide<int64_t, %u>(%" PRIi64 ", %" PRIi64 "), the rounded result does not fit in int64_t.\n", shift, num, mul);
+    #elif defined(DIAGNOSE_INTMATH)
+      if (result_hi != (static_cast<int64_t>(result) >> 63))
+        intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "multshiftround_wide<int64_t, shift>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+    #endif
+
+    return static_cast<int64_t>(result);
+  }
+};
+
+/********************************************************************************
+ ********               uint64_t template specializations                ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift). shift must be on the range [0,127]. */
+template <> inline uint64_t multshiftround_wide<uint64_t>(const uint64_t num, const uint64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > static_cast<uint8_t>(127))
+      std::fprintf(stderr, "ERROR: multshiftround_wide<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,127].\n", num, mul, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(127))
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_wide<uint64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  if (shift > static_cast<uint8_t>(127)) return 0ull;
+
+  uint64_t prod_hi;
+  const uint64_t prod_lo = wide_mul_u64(num, mul, &prod_hi);
+  uint64_t result_hi;
+  const uint64_t result = wide_shiftround_u128(prod_hi, prod_lo, shift, &result_hi);
+
+  #ifdef DEBUG_INTMATH
+    if (result_hi != 0ull)
+      std::fprintf(stderr, "ERROR: multshiftround_wide<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u), the rounded result does not fit in uint64_t.\n", num, mul, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (result_hi != 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "multshiftround_wide<uint64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+  #endif
+
+  return result;
+}
+
+/* Holds the compile time shift form for uint64_t. */
+template <uint8_t shift> struct multshiftround_wide_comp<uint64_t, shift> {
+  static_assert(shift <= 127u, "type multshiftround_wide<uint64_t, shift>(const uint64_t num, const uint64_t mul) requires shift on the range [0,127].");
+
+  static inline uint64_t apply(const uint64_t num, const uint64_t mul) {
+    uint64_t prod_hi;
+    const uint64_t prod_lo = wide_mul_u64(num, mul, &prod_hi);
+    uint64_t result_hi;
+    const uint64_t result = wide_shiftround_u128(prod_hi, prod_lo, shift, &result_hi);
+
+    #ifdef DEBUG_INTMATH
+      if (result_hi != 0ull)
+        std::fprintf(stderr, "ERROR: multshiftround_wide<uint64_t, %u>(%" PRIu64 ", %" PRIu64 "), the rounded result does not fit in uint64_t.\n", shift, num, mul);
+    #elif defined(DIAGNOSE_INTMATH)
+      if (result_hi != 0ull)
+        intmath_diagnostics_record(INTMATH_EVENT_RESULT_OVERFLOW, "multshiftround_wide<uint64_t, shift>", static_cast<uint64_t>(num), static_cast<uint64_t>(mul), static_cast<uint64_t>(shift));
+    #endif
+
+    return result;
+  }
+};
+
+/********************************************************************************
+ ********                    compile time shift form                     ********
+ ********************************************************************************/
+
+/* Returns ROUND((num * mul) / 2^shift) with shift known at compile time. */
+template <typename type, uint8_t shift> inline type multshiftround_wide(const type num, const type mul) {
+  return multshiftround_wide_comp<type, shift>::apply(num, mul);
+}
+
+#endif /* #ifndef MULTSHIFTROUND_WIDE_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -6,6 +6,9 @@
  * of multshiftround when multiplied by integers on a user-specified
  * range.
  *
+ * The search itself is in optimal_pow2_rational.hpp, and
+ * optimal_pow2_rational_batch.cpp processes files of fractions.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -18,13 +21,51 @@
 
 #include <cinttypes>
 #include <iostream>
-#include <limits>
 #include <string>
-#include <stdexcept>
-#include <boost/multiprecision/cpp_bin_float.hpp>
-#include <boost/math/special_functions/round.hpp>
+#include "optimal_pow2_rational.hpp"
 
-typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<80, boost::multiprecision::backends::digit_base_2, void, boost::int16_t, -16382, 16383>, boost::multiprecision::et_off> cpp_bin_float_80;
+/**
+ * Prints which integer types the internal product prod underflows or
+ * overflows, from the widest type it does not fit down.
+ */
+void print_product(const pow2_int &range_end, const pow2_int &mul, const pow2_int &prod)
+{
+  std::cout << " The internal product" << std::endl;
+  std::cout << "   " << range_end << " * " << mul << " = " << prod << std::endl;
+  if (prod == 0)
+  {
+    std::cout << "   will not underflow or overflow any integer type.\n" << std::endl;
+  }
+  else if (prod < 0)
+  {
+    static const pow2_int_type ladder[4] = {POW2_INT64, POW2_INT32, POW2_INT16, POW2_INT8};
+    for (unsigned j = 0u; j < 4u; j++)
+    {
+      if (prod < pow2_int_type_lowest(ladder[j]))
+      {
+        if (j == 0u) std::cout << "   will underflow an int64_t.\n" << std::endl;
+        else std::cout << "   will underflow an " << pow2_int_type_name(ladder[j]) << " but not an " << pow2_int_type_name(ladder[j - 1u]) << ".\n" << std::endl;
+        return;
+      }
+    }
+    std::cout << "   will not underflow an int8_t.\n" << std::endl;
+  }
+  else
+  {
+    static const pow2_int_type ladder[8] = {POW2_UINT64, POW2_INT64, POW2_UINT32, POW2_INT32, POW2_UINT16, POW2_INT16, POW2_UINT8, POW2_INT8};
+    for (unsigned j = 0u; j < 8u; j++)
+    {
+      if (prod > pow2_int_type_max(ladder[j]))
+      {
+        const char *article = pow2_int_type_is_signed(ladder[j]) ? "an " : "a ";
+        if (j == 0u) std::cout << "   will overflow a uint64_t.\n" << std::endl;
+        else std::cout << "   will overflow " << article << pow2_int_type_name(ladder[j]) << " but not " << (pow2_int_type_is_signed(ladder[j - 1u]) ? "an " : "a ") << pow2_int_type_name(ladder[j - 1u]) << ".\n" << std::endl;
+        return;
+      }
+    }
+    std::cout << "   will not overflow an int8_t.\n" << std::endl;
+  }
+}
 
 int main(int argc, char *argv[])
 {
@@ -36,233 +77,55 @@ int main(int argc, char *argv[])
     return 0;
   }
 
-  cpp_bin_float_80 range_min;
-  try { range_min = cpp_bin_float_80(argv[1]); }
-  catch (const std::runtime_error &e)
-  {
-    std::cout << " ERROR: range min argument could not be converted to an 80-bit mantissa float.\n" << std::endl;
-    return 0;
-  }
-  if ((range_min < cpp_bin_float_80(std::numeric_limits<int64_t>::lowest())) | 
-      (range_min > cpp_bin_float_80(std::numeric_limits<uint64_t>::max())))
-  {
-    std::cout << " ERROR: range min argument is outside the allowed range [-2^63,2^64-1]" << std::endl;
-    std::cout << "   which is [" << std::numeric_limits<int64_t>::lowest() << ", " << std::numeric_limits<uint64_t>::max() << "]\n" << std::endl;
-    return 0;
-  }
-  if (range_min != boost::math::round(range_min))
+  pow2_rational_spec spec;
+  if (!pow2_rational_parse_integer(argv[1], spec.range_min))
   {
     std::cout << " ERROR: range min argument must be an integer.\n" << std::endl;
     return 0;
   }
-
-  cpp_bin_float_80 range_max;
-  try { range_max = cpp_bin_float_80(argv[2]); }
-  catch (const std::runtime_error &e)
-  {
-    std::cout << " ERROR: range max argument could not be converted to an 80-bit mantissa float.\n" << std::endl;
-    return 0;
-  }
-  if ((range_max < cpp_bin_float_80(std::numeric_limits<int64_t>::lowest())) |
-      (range_max > cpp_bin_float_80(std::numeric_limits<uint64_t>::max())))
-  {
-    std::cout << " ERROR: range max argument is outside the allowed range [-2^63,2^64-1]" << std::endl;
-    std::cout << "   which is [" << std::numeric_limits<int64_t>::lowest() << ", " << std::numeric_limits<uint64_t>::max() << "]\n" << std::endl;
-    return 0;
-  }
-  if (range_max != boost::math::round(range_max))
+  if (!pow2_rational_parse_integer(argv[2], spec.range_max))
   {
     std::cout << " ERROR: range max argument must be an integer.\n" << std::endl;
     return 0;
   }
-
-  if (range_max < range_min)
+  if (!pow2_rational_parse_number(argv[3], spec.fraction))
   {
-    std::cout << " ERROR: range max must be greater than or equal to range min.\n" << std::endl;
+    std::cout << " ERROR: fraction argument could not be read as a decimal number or a ratio of two.\n" << std::endl;
     return 0;
   }
 
-  cpp_bin_float_80 fraction;
-  try { fraction = cpp_bin_float_80(argv[3]); }
-  catch (const std::runtime_error &e)
+  const char *problem = pow2_rational_check(spec);
+  if (problem != NULL)
   {
-    std::cout << " ERROR: fraction argument could not be converted to an 80-bit mantissa float.\n" << std::endl;
+    std::cout << " ERROR: " << problem << ".\n" << std::endl;
     return 0;
   }
-  if ((fraction < cpp_bin_float_80(0.0)) |
-      (fraction > cpp_bin_float_80(std::numeric_limits<uint64_t>::max())))
+
+  const pow2_rational_result result = pow2_rational_search(spec);
+  if (!result.found)
   {
-    std::cout << " ERROR: fraction argument is outside the allowed range [0.0,2.0^64-1.0]" << std::endl;
-    std::cout << "   which is [0.0, " << std::numeric_limits<uint64_t>::max() << ".0]\n" << std::endl;
+    std::cout << " No rational with base 2 denominator was found that" << std::endl;
+    std::cout << "   approximates fraction = " << pow2_rational_decimal(spec.fraction, 24u) << std::endl;
+    std::cout << "   to within roundoff when multiplied by numbers on the range" << std::endl;
+    std::cout << "   [" << spec.range_min << ", " << spec.range_max << "]" << std::endl;
+    std::cout << "   for denominators ranging from 2 to 2^63 inclusive.\n" << std::endl;
     return 0;
   }
 
-  for (int8_t shift = 1; shift <= 63; shift++)
-  {
-    cpp_bin_float_80 two_exp     = cpp_bin_float_80(1ull << shift);
-    cpp_bin_float_80 approx_mult = boost::math::round(fraction * two_exp);
-    cpp_bin_float_80 min_prod    = range_min * approx_mult;
-    cpp_bin_float_80 approx_min  = min_prod / two_exp;
-    cpp_bin_float_80 max_prod    = range_max * approx_mult;
-    cpp_bin_float_80 approx_max  = max_prod / two_exp;
-    cpp_bin_float_80 ratio_min   = range_min * fraction;
-    cpp_bin_float_80 ratio_max   = range_max * fraction;
-
-    if (boost::multiprecision::fabs(approx_min-ratio_min) < cpp_bin_float_80(0.5) &&
-        boost::multiprecision::fabs(approx_max-ratio_max) < cpp_bin_float_80(0.5))
-    {
-      std::cout << " The rational " << std::setprecision(24) << approx_mult << " / 2^" << static_cast<int16_t>(shift) << " = ";
-      std::cout << std::setprecision(24) << approx_mult / two_exp << std::endl;
-      std::cout << "   approximates fraction = " << std::setprecision(24) << fraction << std::endl;
-      std::cout << "   to within roundoff when multiplied by numbers on the range" << std::endl;
-      std::cout << "   [" << range_min << ", " << range_max << "].\n" << std::endl;
-
-      std::cout << " The internal product" << std::endl;
-      std::cout << "   " << range_min << " * " << approx_mult << " = " << std::setprecision(24) << min_prod << std::endl;
-      if (min_prod == cpp_bin_float_80(0.0))
-      {
-        std::cout << "   will not underflow or overflow any integer type.\n" << std::endl;
-      }
-      else if (min_prod < cpp_bin_float_80(0.0))
-      {
-        if (min_prod < cpp_bin_float_80(std::numeric_limits<int64_t>::lowest()))
-        {
-          std::cout << "   will underflow an int64_t.\n" << std::endl;
-        }
-        else if (min_prod < cpp_bin_float_80(std::numeric_limits<int32_t>::lowest()))
-        {
-          std::cout << "   will underflow an int32_t but not an int64_t.\n" << std::endl;
-        }
-        else if (min_prod < cpp_bin_float_80(std::numeric_limits<int16_t>::lowest()))
-        {
-          std::cout << "   will underflow an int16_t but not an int32_t.\n" << std::endl;
-        }
-        else if (min_prod < cpp_bin_float_80(std::numeric_limits<int8_t>::lowest()))
-        {
-          std::cout << "   will underflow an int8_t but not an int16_t.\n" << std::endl;
-        }
-        else
-        {
-          std::cout << "   will not underflow an int8_t.\n" << std::endl;
-        }
-      }
-      else if (min_prod > cpp_bin_float_80(0.0))
-      {
-        if (min_prod > cpp_bin_float_80(std::numeric_limits<uint64_t>::max()))
-        {
-          std::cout << "   will overflow a uint64_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<int64_t>::max()))
-        {
-          std::cout << "   will overflow an int64_t but not a uint64_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<uint32_t>::max()))
-        {
-          std::cout << "   will overflow a uint32_t but not an int64_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<int32_t>::max()))
-        {
-          std::cout << "   will overflow an int32_t but not a uint32_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<uint16_t>::max()))
-        {
-          std::cout << "   will overflow a uint16_t but not an int32_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<int16_t>::max()))
-        {
-          std::cout << "   will overflow an int16_t but not a uint16_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<uint8_t>::max()))
-        {
-          std::cout << "   will overflow a uint8_t but not an int16_t.\n" << std::endl;
-        }
-        else if (min_prod > cpp_bin_float_80(std::numeric_limits<int8_t>::max()))
-        {
-          std::cout << "   will overflow an int8_t but not a uint8_t.\n" << std::endl;
-        }
-        else
-        {
-          std::cout << "   will not overflow an int8_t.\n" << std::endl;
-        }
-      }
+  std::cout << " The rational " << result.mul << " / 2^" << static_cast<unsigned>(result.shift) << " = ";
+  std::cout << pow2_rational_decimal(result.approximation, 24u) << std::endl;
+  std::cout << "   approximates fraction = " << pow2_rational_decimal(spec.fraction, 24u) << std::endl;
+  std::cout << "   to within roundoff when multiplied by numbers on the range" << std::endl;
+  std::cout << "   [" << spec.range_min << ", " << spec.range_max << "]." << std::endl;
+  std::cout << "   The largest error before rounding is " << pow2_rational_decimal(result.worst_error, 6u) << ".\n" << std::endl;
 
-      std::cout << " The internal product" << std::endl;
-      std::cout << "   " << range_max << " * " << approx_mult << " = " << std::setprecision(24) << max_prod << std::endl;
-      if (max_prod == cpp_bin_float_80(0.0))
-      {
-        std::cout << "   will not underflow or overflow any integer type.\n" << std::endl;
-      }
-      else if (max_prod < cpp_bin_float_80(0.0))
-      {
-        if (max_prod < cpp_bin_float_80(std::numeric_limits<int64_t>::lowest()))
-        {
-          std::cout << "   will underflow an int64_t.\n" << std::endl;
-        }
-        else if (max_prod < cpp_bin_float_80(std::numeric_limits<int32_t>::lowest()))
-        {
-          std::cout << "   will underflow an int32_t but not an int64_t.\n" << std::endl;
-        }
-        else if (max_prod < cpp_bin_float_80(std::numeric_limits<int16_t>::lowest()))
-        {
-          std::cout << "   will underflow an int16_t but not an int32_t.\n" << std::endl;
-        }
-        else if (max_prod < cpp_bin_float_80(std::numeric_limits<int8_t>::lowest()))
-        {
-          std::cout << "   will underflow an int8_t but not an int16_t.\n" << std::endl;
-        }
-        else
-        {
-          std::cout << "   will not underflow an int8_t.\n" << std::endl;
-        }
-      }
-      else if (max_prod > cpp_bin_float_80(0.0))
-      {
-        if (max_prod > cpp_bin_float_80(std::numeric_limits<uint64_t>::max()))
-        {
-          std::cout << "   will overflow a uint64_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<int64_t>::max()))
-        {
-          std::cout << "   will overflow an int64_t but not a uint64_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<uint32_t>::max()))
-        {
-          std::cout << "   will overflow a uint32_t but not an int64_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<int32_t>::max()))
-        {
-          std::cout << "   will overflow an int32_t but not a uint32_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<uint16_t>::max()))
-        {
-          std::cout << "   will overflow a uint16_t but not an int32_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<int16_t>::max()))
-        {
-          std::cout << "   will overflow an int16_t but not a uint16_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<uint8_t>::max()))
-        {
-          std::cout << "   will overflow a uint8_t but not an int16_t.\n" << std::endl;
-        }
-        else if (max_prod > cpp_bin_float_80(std::numeric_limits<int8_t>::max()))
-        {
-          std::cout << "   will overflow an int8_t but not a uint8_t.\n" << std::endl;
-        }
-        else
-        {
-          std::cout << "   will not overflow an int8_t.\n" << std::endl;
-        }
-      }
-      return 0;
-    }
-  }
+  print_product(spec.range_min, result.mul, result.min_product);
+  print_product(spec.range_max, result.mul, result.max_product);
 
-  std::cout << " No rational with base 2 denominator was found that" << std::endl;
-  std::cout << "   approximates fraction = " << std::setprecision(24) << fraction << std::endl;
-  std::cout << "   to within roundoff when multiplied by numbers on the range" << std::endl;
-  std::cout << "   [" << range_min << ", " << range_max << "]" << std::endl;
-  std::cout << "   for denominators ranging from 2 to 2^63 inclusive.\n" << std::endl;
+  if (result.narrowest < POW2_INT_TYPES)
+    std::cout << " The narrowest type for multshiftround<type, " << static_cast<unsigned>(result.shift) << "> on this range is " << pow2_int_type_name(result.narrowest) << ".\n" << std::endl;
+  else
+    std::cout << " No 64-bit or narrower type holds these products; see multshiftround_wide.\n" << std::endl;
   return 0;
 }
 
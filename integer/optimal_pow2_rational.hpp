@@ -0,0 +1,407 @@
+/**
+ * optimal_pow2_rational.hpp
+ * Specifies the functions
+ *     const char *pow2_rational_check(const pow2_rational_spec &spec);
+ *     pow2_rational_result pow2_rational_search(const pow2_rational_spec &spec);
+ * which find the rational number of the form
+ *     mul / 2^shift
+ * with the smallest shift on [1, 63] that approximates spec.fraction to
+ * within spec.max_error when multiplied by every integer num on
+ * [spec.range_min, spec.range_max], i.e.
+ *     |num * mul / 2^shift - num * fraction| < max_error.
+ * max_error defaults to 1/2, the roundoff of multshiftround, which is the
+ * criterion optimal_pow2_rational.cpp has always used. Since the error is
+ * linear in num, it is largest at the end of the range with the larger
+ * magnitude, and only that end needs to be tested.
+ *
+ * Everything is exact: the range is held in cpp_int and the fraction and
+ * errors in cpp_rational from the vendored boost/multiprecision, so
+ * decimal fractions such as 0.1 are used as written rather than as their
+ * nearest binary float.
+ *
+ * The result holds mul, shift, the worst case error over the range, the
+ * products range_min * mul and range_max * mul, and for each of int8_t
+ * through uint64_t whether those products underflow and/or overflow it.
+ * narrowest is the narrowest type, unsigned if range_min >= 0 and signed
+ * otherwise, that holds the range, mul, and both products and for which
+ * shift is a valid multshiftround<type, shift> shift; it is the type that
+ * multshiftround_select.hpp picks for the same specification.
+ *
+ * The range must lie on [-2^63, 2^64-1] and the fraction on [0, 2^64-1],
+ * as before. pow2_rational_check returns an error message for a spec that
+ * violates this, and NULL otherwise; pow2_rational_search requires a spec
+ * that passes.
+ *
+ * pow2_rational_parse_number reads a decimal number with an optional
+ * fraction part and exponent ("3300", "0.80586", "1.5e-3") or a ratio of
+ * two such numbers ("3300/4095") into an exact cpp_rational.
+ * pow2_rational_decimal formats a cpp_rational with a given number of
+ * significant digits for output.
+ *
+ * optimal_pow2_rational.cpp is the interactive program for one fraction,
+ * and optimal_pow2_rational_batch.cpp processes files of them.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef OPTIMAL_POW2_RATIONAL_HPP_
+#define OPTIMAL_POW2_RATIONAL_HPP_
+
+#include <cinttypes>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+typedef boost::multiprecision::cpp_int pow2_int;
+typedef boost::multiprecision::cpp_rational pow2_rational;
+
+/* The integer types whose product ranges are classified, in order of width. */
+enum pow2_int_type {
+  POW2_INT8 = 0,
+  POW2_UINT8,
+  POW2_INT16,
+  POW2_UINT16,
+  POW2_INT32,
+  POW2_UINT32,
+  POW2_INT64,
+  POW2_UINT64,
+  POW2_INT_TYPES
+};
+
+/* Whether the products range_min * mul and range_max * mul fit in a type. */
+enum pow2_product_class {
+  POW2_PRODUCT_FITS = 0,
+  POW2_PRODUCT_UNDERFLOWS,
+  POW2_PRODUCT_OVERFLOWS,
+  POW2_PRODUCT_UNDERFLOWS_AND_OVERFLOWS
+};
+
+inline const char *pow2_int_type_name(const pow2_int_type type) {
+  static const char *const names[POW2_INT_TYPES + 1] = {"int8_t", "uint8_t", "int16_t", "uint16_t", "int32_t", "uint32_t", "int64_t", "uint64_t", "none"};
+  return names[(type < POW2_INT_TYPES) ? type : POW2_INT_TYPES];
+}
+
+inline const char *pow2_product_class_name(const pow2_product_class product_class) {
+  static const char *const names[4] = {"fits", "underflows", "overflows", "underflows and overflows"};
+  return names[product_class];
+}
+
+inline bool pow2_int_type_is_signed(const pow2_int_type type) { return (type % 2) == 0; }
+
+inline unsigned pow2_int_type_bits(const pow2_int_type type) { return 8u << (type / 2); }
+
+/* The lowest value of type. */
+inline pow2_int pow2_int_type_lowest(const pow2_int_type type) {
+  return pow2_int_type_is_signed(type) ? pow2_int(-(pow2_int(1) << (pow2_int_type_bits(type) - 1u))) : pow2_int(0);
+}
+
+/* The largest value of type. */
+inline pow2_int pow2_int_type_max(const pow2_int_type type) {
+  return (pow2_int(1) << (pow2_int_type_bits(type) - (pow2_int_type_is_signed(type) ? 1u : 0u))) - 1;
+}
+
+/* What to search for. */
+struct pow2_rational_spec {
+  pow2_int range_min;
+  pow2_int range_max;
+  pow2_rational fraction;
+  pow2_rational max_error;
+
+  pow2_rational_spec() : range_min(0), range_max(0), fraction(0), max_error(pow2_rational(1, 2)) {}
+  pow2_rational_spec(const pow2_int &range_min_, const pow2_int &range_max_, const pow2_rational &fraction_, const pow2_rational &max_error_ = pow2_rational(1, 2))
+    : range_min(range_min_), range_max(range_max_), fraction(fraction_), max_error(max_error_) {}
+};
+
+/**
+ * What was found. When found is false, no shift on [1, 63] meets
+ * max_error and the remaining members are zero, except that
+ * narrowest is POW2_INT_TYPES.
+ */
+struct pow2_rational_result {
+  bool found;
+  uint8_t shift;
+  pow2_int mul;
+  pow2_rational approximation;   /* mul / 2^shift */
+  pow2_rational worst_error;     /* largest |num * mul / 2^shift - num * fraction| on the range */
+  pow2_int min_product;          /* range_min * mul */
+  pow2_int max_product;          /* range_max * mul */
+  pow2_product_class product_class[POW2_INT_TYPES];
+  pow2_int_type narrowest;
+
+  pow2_rational_result() : found(false), shift(0u), mul(0), approximation(0), worst_error(0), min_product(0), max_product(0), narrowest(POW2_INT_TYPES) {
+    for (unsigned j = 0u; j < POW2_INT_TYPES; j++) product_class[j] = POW2_PRODUCT_FITS;
+  }
+};
+
+/**
+ * Returns NULL if spec may be searched, or else a message that says what is
+ * wrong with it.
+ */
+inline const char *pow2_rational_check(const pow2_rational_spec &spec) {
+  if (spec.range_min < pow2_int_type_lowest(POW2_INT64) || spec.range_min > pow2_int_type_max(POW2_UINT64))
+    return "range min is outside the allowed range [-2^63,2^64-1]";
+  if (spec.range_max < pow2_int_type_lowest(POW2_INT64) || spec.range_max > pow2_int_type_max(POW2_UINT64))
+    return "range max is outside the allowed range [-2^63,2^64-1]";
+  if (spec.range_max < spec.range_min)
+    return "range max must be greater than or equal to range min";
+  if (spec.fraction < 0 || spec.fraction > pow2_rational(pow2_int_type_max(POW2_UINT64)))
+    return "fraction is outside the allowed range [0.0,2.0^64-1.0]";
+  if (spec.max_error <= 0)
+    return "max error must be greater than 0";
+  return NULL;
+}
+
+/* Classifies [min_product, max_product] against the limits of type. */
+inline pow2_product_class pow2_rational_classify(const pow2_int &min_product, const pow2_int &max_product, const pow2_int_type type) {
+  const bool underflows = min_product < pow2_int_type_lowest(type);
+  const bool overflows = max_product > pow2_int_type_max(type);
+  return underflows ? (overflows ? POW2_PRODUCT_UNDERFLOWS_AND_OVERFLOWS : POW2_PRODUCT_UNDERFLOWS)
+                    : (overflows ? POW2_PRODUCT_OVERFLOWS : POW2_PRODUCT_FITS);
+}
+
+inline pow2_rational_result pow2_rational_search(const pow2_rational_spec &spec) {
+  pow2_rational_result result;
+  const pow2_int max_magnitude = (abs(spec.range_min) > abs(spec.range_max)) ? pow2_int(abs(spec.range_min)) : pow2_int(abs(spec.range_max));
+  const pow2_int num = numerator(spec.fraction);
+  const pow2_int den = denominator(spec.fraction);
+
+  for (uint8_t shift = 1u; shift <= 63u; shift++) {
+    /* mul = ROUND(fraction * 2^shift), rounding half up. */
+    const pow2_int scaled = num << shift;
+    pow2_int mul = scaled / den;
+    const pow2_int remainder = scaled - mul * den;
+    if (2 * remainder >= den) mul += 1;
+
+    const pow2_rational approximation(mul, pow2_int(1) << shift);
+    const pow2_rational difference = approximation - spec.fraction;
+    const pow2_rational worst_error = pow2_rational(max_magnitude) * ((difference < 0) ? pow2_rational(-difference) : difference);
+    if (worst_error >= spec.max_error) continue;
+
+    result.found = true;
+    result.shift = shift;
+    result.mul = mul;
+    result.approximation = approximation;
+    result.worst_error = worst_error;
+    result.min_product = spec.range_min * mul;
+    result.max_product = spec.range_max * mul;
+    for (unsigned j = 0u; j < POW2_INT_TYPES; j++)
+      result.product_class[j] = pow2_rational_classify(result.min_product, result.max_product, static_cast<pow2_int_type>(j));
+
+    for (unsigned j = (spec.range_min < 0) ? POW2_INT8 : POW2_UINT8; j < POW2_INT_TYPES; j += 2u) {
+      const pow2_int_type type = static_cast<pow2_int_type>(j);
+      if (result.product_class[j] == POW2_PRODUCT_FITS && shift < pow2_int_type_bits(type) - (pow2_int_type_is_signed(type) ? 1u : 0u) &&
+          mul <= pow2_int_type_max(type) && spec.range_min >= pow2_int_type_lowest(type) && spec.range_max <= pow2_int_type_max(type)) {
+        result.narrowest = type;
+        break;
+      }
+    }
+    return result;
+  }
+  return result;
+}
+
+/**
+ * Reads text into value. text is a decimal number with an optional sign,
+ * fraction part, and exponent, or a ratio of two such numbers separated by
+ * '/'. Surrounding whitespace is not allowed. Returns false if text is not
+ * of this form, the denominator of a ratio is zero, or an exponent has
+ * more than four digits.
+ */
+inline bool pow2_rational_parse_decimal(const std::string &text, pow2_rational &value) {
+  size_t pos = 0u;
+  bool negative = false;
+  if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) negative = (text[pos++] == '-');
+
+  pow2_int digits = 0;
+  long exponent = 0;
+  bool any_digit = false;
+  for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; pos++, any_digit = true)
+    digits = digits * 10 + (text[pos] - '0');
+  if (pos < text.size() && text[pos] == '.') {
+    for (pos++; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; pos++, any_digit = true, exponent--)
+      digits = digits * 10 + (text[pos] - '0');
+  }
+  if (!any_digit) return false;
+
+  if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E')) {
+    pos++;
+    bool exponent_negative = false;
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) exponent_negative = (text[pos++] == '-');
+    long written = 0;
+    unsigned exponent_digits = 0u;
+    for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; pos++, exponent_digits++)
+      written = written * 10 + (text[pos] - '0');
+    if (exponent_digits == 0u || exponent_digits > 4u) return false;
+    exponent += exponent_negative ? -written : written;
+  }
+  if (pos != text.size()) return false;
+
+  pow2_int scale = 1;
+  for (long j = 0; j < ((exponent < 0) ? -exponent : exponent); j++) scale *= 10;
+  value = (exponent < 0) ? pow2_rational(digits, scale) : pow2_rational(digits * scale);
+  if (negative) value = -value;
+  return true;
+}
+
+inline bool pow2_rational_parse_number(const std::string &text, pow2_rational &value) {
+  const size_t slash = text.find('/');
+  if (slash == std::string::npos) return pow2_rational_parse_decimal(text, value);
+
+  pow2_rational num, den;
+  if (!pow2_rational_parse_decimal(text.substr(0u, slash), num) || !pow2_rational_parse_decimal(text.substr(slash + 1u), den) || den == 0) return false;
+  value = num / den;
+  return true;
+}
+
+/* As pow2_rational_parse_number, but value must be an integer. */
+inline bool pow2_rational_parse_integer(const std::string &text, pow2_int &value) {
+  pow2_rational parsed;
+  if (!pow2_rational_parse_number(text, parsed) || denominator(parsed) != 1) return false;
+  value = numerator(parsed);
+  return true;
+}
+
+/**
+ * Formats value with the given number of significant digits, in
+ * scientific notation where that is shorter. The value is rounded from a
+ * 100 digit binary float, so digits up to about 90 are exact.
+ */
+inline std::string pow2_rational_decimal(const pow2_rational &value, const unsigned significant_digits) {
+  typedef boost::multiprecision::cpp_bin_float_100 decimal_float;
+  const decimal_float converted = decimal_float(numerator(value)) / decimal_float(denominator(value));
+  return converted.str(static_cast<std::streamsize>(significant_digits));
+}
+
+#endif /* #ifndef OPTIMAL_POW2_RATIONAL_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
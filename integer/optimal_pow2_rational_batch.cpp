@@ -0,0 +1,357 @@
+/**
+ * optimal_pow2_rational_batch.cpp
+ * Runs the search of optimal_pow2_rational.hpp for every line of a file
+ * and writes one CSV row or JSON object per line, so that tables of
+ * filter taps or calibration gains can be converted at build time.
+ *
+ * usage: optimal_pow2_rational_batch [--csv | --json] [--threads N]
+ *                                    [--error E] input_file
+ *
+ * Each line of input_file holds
+ *     range_min range_max fraction [max_error]
+ * separated by spaces, tabs, or commas. Numbers are decimal, with an
+ * optional fraction part and exponent, or ratios such as 3300/4095.
+ * max_error defaults to --error, which defaults to 1/2. Blank lines and
+ * lines whose first character other than whitespace is '#' are skipped.
+ * input_file may be - for stdin.
+ *
+ * The lines are searched in parallel on N threads (all hardware threads
+ * by default) and written in input order to stdout. Every output record
+ * has the input line number, the inputs as written, and a status of
+ * "found", "not found", or "error: <message>". Found records add mul,
+ * shift, mul / 2^shift, the worst case error before rounding, the
+ * products range_min * mul and range_max * mul, the narrowest type for
+ * multshiftround, and for each of int8_t through uint64_t whether the
+ * products fit, underflow, overflow, or both. Decimal values carry 17
+ * significant digits, and the worst case error is also given exactly as
+ * a ratio. In JSON the integers that may exceed 2^53 are strings.
+ *
+ * A summary goes to stderr. The exit status is 1 if the input could not be
+ * read or any line had an error, and 0 otherwise.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "optimal_pow2_rational.hpp"
+
+/* One line of input and the record written for it. */
+struct batch_line {
+  unsigned long line_number;
+  std::vector<std::string> fields;
+  std::string record;
+  enum { FOUND, NOT_FOUND, FAILED } status;
+};
+
+/* Splits text at spaces, tabs, and commas. */
+std::vector<std::string> split_fields(const std::string &text) {
+  std::vector<std::string> fields;
+  std::string field;
+  for (size_t j = 0u; j <= text.size(); j++) {
+    const char c = (j < text.size()) ? text[j] : ' ';
+    if (c == ' ' || c == '\t' || c == ',' || c == '\r') {
+      if (!field.empty()) fields.push_back(field);
+      field.clear();
+    }
+    else field.push_back(c);
+  }
+  return fields;
+}
+
+/* Quotes text for JSON. Input fields are the only free text, so only " and \ need escapes. */
+std::string json_string(const std::string &text) {
+  std::string quoted("\"");
+  for (size_t j = 0u; j < text.size(); j++) {
+    if (text[j] == '"' || text[j] == '\\') quoted.push_back('\\');
+    quoted.push_back(text[j]);
+  }
+  quoted.push_back('"');
+  return quoted;
+}
+
+/* Quotes text for CSV if it holds a comma or a quote. */
+std::string csv_string(const std::string &text) {
+  if (text.find_first_of(",\"") == std::string::npos) return text;
+  std::string quoted("\"");
+  for (size_t j = 0u; j < text.size(); j++) {
+    if (text[j] == '"') quoted.push_back('"');
+    quoted.push_back(text[j]);
+  }
+  quoted.push_back('"');
+  return quoted;
+}
+
+std::string exact_ratio(const pow2_rational &value) {
+  std::ostringstream text;
+  text << numerator(value);
+  if (denominator(value) != 1) text << "/" << denominator(value);
+  return text.str();
+}
+
+void csv_header(std::ostream &out) {
+  out << "line,range_min,range_max,fraction,max_error,status,mul,shift,approximation,worst_error,worst_error_exact,min_product,max_product,narrowest";
+  for (unsigned j = 0u; j < POW2_INT_TYPES; j++) out << "," << pow2_int_type_name(static_cast<pow2_int_type>(j));
+  out << "\n";
+}
+
+/* Parses, searches, and formats one line into line.record. */
+void process_line(batch_line &line, const std::string &default_error, const bool json) {
+  std::string problem;
+  pow2_rational_spec spec;
+  if (line.fields.size() < 3u || line.fields.size() > 4u) problem = "expected range_min range_max fraction [max_error]";
+  while (line.fields.size() < 3u) line.fields.push_back("");
+  if (line.fields.size() == 3u) line.fields.push_back(default_error);
+
+  if (problem.empty() && !pow2_rational_parse_integer(line.fields[0], spec.range_min)) problem = "range min must be an integer";
+  if (problem.empty() && !pow2_rational_parse_integer(line.fields[1], spec.range_max)) problem = "range max must be an integer";
+  if (problem.empty() && !pow2_rational_parse_number(line.fields[2], spec.fraction)) problem = "fraction could not be read";
+  if (problem.empty() && !pow2_rational_parse_number(line.fields[3], spec.max_error)) problem = "max error could not be read";
+  if (problem.empty() && pow2_rational_check(spec) != NULL) problem = pow2_rational_check(spec);
+
+  pow2_rational_result result;
+  if (problem.empty()) result = pow2_rational_search(spec);
+  line.status = !problem.empty() ? batch_line::FAILED : result.found ? batch_line::FOUND : batch_line::NOT_FOUND;
+  const std::string status = !problem.empty() ? "error: " + problem : result.found ? "found" : "not found";
+
+  std::ostringstream record;
+  if (json) {
+    record << "  {\"line\": " << line.line_number << ", \"range_min\": " << json_string(line.fields[0]) << ", \"range_max\": " << json_string(line.fields[1])
+           << ", \"fraction\": " << json_string(line.fields[2]) << ", \"max_error\": " << json_string(line.fields[3]) << ", \"status\": " << json_string(status);
+    if (result.found) {
+      record << ", \"mul\": \"" << result.mul << "\", \"shift\": " << static_cast<unsigned>(result.shift)
+             << ", \"approximation\": " << pow2_rational_decimal(result.approximation, 17u) << ", \"worst_error\": " << pow2_rational_decimal(result.worst_error, 17u)
+             << ", \"worst_error_exact\": \"" << exact_ratio(result.worst_error) << "\", \"min_product\": \"" << result.min_product << "\", \"max_product\": \"" << result.max_product
+             << "\", \"narrowest\": \"" << pow2_int_type_name(result.narrowest) << "\", \"products\": {";
+      for (unsigned j = 0u; j < POW2_INT_TYPES; j++)
+        record << (j ? ", " : "") << "\"" << pow2_int_type_name(static_cast<pow2_int_type>(j)) << "\": \"" << pow2_product_class_name(result.product_class[j]) << "\"";
+      record << "}";
+    }
+    record << "}";
+  }
+  else {
+    record << line.line_number << "," << csv_string(line.fields[0]) << "," << csv_string(line.fields[1]) << "," << csv_string(line.fields[2]) << "," << csv_string(line.fields[3]) << "," << csv_string(status);
+    if (result.found) {
+      record << "," << result.mul << "," << static_cast<unsigned>(result.shift) << "," << pow2_rational_decimal(result.approximation, 17u) << "," << pow2_rational_decimal(result.worst_error, 17u)
+             << "," << exact_ratio(result.worst_error) << "," << result.min_product << "," << result.max_product << "," << pow2_int_type_name(result.narrowest);
+      for (unsigned j = 0u; j < POW2_INT_TYPES; j++) record << "," << pow2_product_class_name(result.product_class[j]);
+    }
+    else {
+      for (unsigned j = 0u; j < 8u + POW2_INT_TYPES; j++) record << ",";
+    }
+  }
+  line.record = record.str();
+}
+
+int main(int argc, char *argv[]) {
+  bool json = false;
+  unsigned nThreads = 0u;
+  std::string default_error("1/2");
+  const char *input_path = NULL;
+  bool usage_error = false;
+
+  for (int j = 1; j < argc; j++) {
+    if (std::strcmp(argv[j], "--json") == 0) json = true;
+    else if (std::strcmp(argv[j], "--csv") == 0) json = false;
+    else if (std::strcmp(argv[j], "--threads") == 0 && j + 1 < argc) nThreads = static_cast<unsigned>(std::strtoul(argv[++j], NULL, 10));
+    else if (std::strcmp(argv[j], "--error") == 0 && j + 1 < argc) default_error = argv[++j];
+    else if (input_path == NULL && (argv[j][0] != '-' || argv[j][1] == '\0')) input_path = argv[j];
+    else usage_error = true;
+  }
+  pow2_rational parsed_error;
+  if (usage_error || input_path == NULL || !pow2_rational_parse_number(default_error, parsed_error)) {
+    std::cerr << "usage: optimal_pow2_rational_batch [--csv | --json] [--threads N] [--error E] input_file" << std::endl;
+    std::cerr << "  each line of input_file: range_min range_max fraction [max_error]" << std::endl;
+    return 1;
+  }
+
+  std::ifstream file;
+  if (std::strcmp(input_path, "-") != 0) {
+    file.open(input_path);
+    if (!file) {
+      std::cerr << "ERROR: could not open " << input_path << std::endl;
+      return 1;
+    }
+  }
+  std::istream &input = (std::strcmp(input_path, "-") != 0) ? static_cast<std::istream &>(file) : std::cin;
+
+  std::vector<batch_line> lines;
+  std::string text;
+  for (unsigned long line_number = 1u; std::getline(input, text); line_number++) {
+    const size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos || text[first] == '#') continue;
+    batch_line line;
+    line.line_number = line_number;
+    line.fields = split_fields(text);
+    line.status = batch_line::FAILED;
+    lines.push_back(line);
+  }
+
+  if (nThreads == 0u) nThreads = std::thread::hardware_concurrency();
+  if (nThreads == 0u) nThreads = 1u;
+  if (nThreads > lines.size()) nThreads = lines.size() ? static_cast<unsigned>(lines.size()) : 1u;
+
+  std::atomic<size_t> next(0u);
+  std::vector<std::thread> workers;
+  for (unsigned j = 0u; j < nThreads; j++) {
+    workers.push_back(std::thread([&lines, &next, &default_error, json]() {
+      for (size_t k = next++; k < lines.size(); k = next++) process_line(lines[k], default_error, json);
+    }));
+  }
+  for (size_t j = 0u; j < workers.size(); j++) workers[j].join();
+
+  uint64_t found = 0u, not_found = 0u, failed = 0u;
+  if (json) std::cout << "[\n";
+  else csv_header(std::cout);
+  for (size_t j = 0u; j < lines.size(); j++) {
+    std::cout << lines[j].record << ((json && j + 1u < lines.size()) ? ",\n" : "\n");
+    if (lines[j].status == batch_line::FOUND) found++;
+    else if (lines[j].status == batch_line::NOT_FOUND) not_found++;
+    else failed++;
+  }
+  if (json) std::cout << "]\n";
+  std::cout.flush();
+
+  std::cerr << lines.size() << " lines: " << found << " found, " << not_found << " not found, " << failed << " errors." << std::endl;
+  return (failed != 0u) ? 1 : 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
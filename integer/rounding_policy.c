@@ -0,0 +1,1767 @@
+/**
+ * rounding_policy.c
+ * Defines functions of the form
+ *     type shiftround_X_P(const type num, const uint8_t shift);
+ *     type multshiftround_X_P(const type num, const type mul, const uint8_t shift);
+ *     type divround_X_P(const type dividend, const type divisor);
+ * where X is a type abbreviation and P is even, floor, or trunc.
+ * See rounding_policy.h.
+ *
+ * Each function keeps the argument checks and protections of the round
+ * half away from zero function it shadows and changes only the final
+ * rounding step, which is branch free:
+ *     floor  The arithmetic right shift already rounds toward negative
+ *            infinity. For division, the truncated quotient is stepped
+ *            down when the remainder is nonzero and differs in sign from
+ *            the divisor.
+ *     trunc  Negative signed num has 2^shift - 1 added before the shift.
+ *            Integer division already truncates.
+ *     even   The floored shift is stepped up when the discarded bits
+ *            exceed half, or equal half and the floored result is odd.
+ *            For division, the remainder magnitude is compared against
+ *            divisor magnitude - remainder magnitude, which cannot
+ *            overflow, and the truncated quotient is stepped away from
+ *            zero on the same conditions.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef ROUNDING_POLICY_C_
+#define ROUNDING_POLICY_C_
+
+#include "rounding_policy.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+  #include "detect_product_overflow.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "wide_product.h"
+  #include "intmath_diagnostics.h"
+#endif
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,6]. */
+INTMATH_API int8_t shiftround_i8_even(const int8_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+	    fprintf(stderr, "ERROR: shiftround_i8_even(%i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i8_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)6) return (int8_t)0;
+  if (shift == (uint8_t)0) return num;
+
+  uint8_t half = (uint8_t)1 << (shift - (uint8_t)1);
+  uint8_t remainder = (uint8_t)num & (uint8_t)((half << 1) - (uint8_t)1);
+  int8_t quotient = num >> shift;
+  return quotient + (int8_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,6]. */
+INTMATH_API int8_t shiftround_i8_floor(const int8_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+	    fprintf(stderr, "ERROR: shiftround_i8_floor(%i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i8_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)6) return (int8_t)0;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,6]. */
+INTMATH_API int8_t shiftround_i8_trunc(const int8_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+	    fprintf(stderr, "ERROR: shiftround_i8_trunc(%i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i8_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)6) return (int8_t)0;
+
+  return (num + ((num >> 7) & (int8_t)(((uint8_t)1 << shift) - (uint8_t)1))) >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,6]. */
+INTMATH_API int8_t multshiftround_i8_even(const int8_t num, const int8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+	    fprintf(stderr, "ERROR: multshiftround_i8_even(%i, %i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, mul, shift, shift);
+
+    int16_t debug_product = (int16_t)num * (int16_t)mul;
+    if (debug_product > (int16_t)INT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i8_even(%i, %i, %u), numerical overflow in the product %i * %i = %i > %i.\n", num, mul, shift, num, mul, debug_product, INT8_MAX);
+
+    if (debug_product < (int16_t)INT8_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i8_even(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i8_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int16_t diagnose_product = (int16_t)num * (int16_t)mul;
+    if (diagnose_product > (int16_t)INT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int16_t)INT8_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)6) return (int8_t)0;
+  int8_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint8_t half = (uint8_t)1 << (shift - (uint8_t)1);
+  uint8_t remainder = (uint8_t)prod & (uint8_t)((half << 1) - (uint8_t)1);
+  int8_t quotient = prod >> shift;
+  return quotient + (int8_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,6]. */
+INTMATH_API int8_t multshiftround_i8_floor(const int8_t num, const int8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+	    fprintf(stderr, "ERROR: multshiftround_i8_floor(%i, %i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, mul, shift, shift);
+
+    int16_t debug_product = (int16_t)num * (int16_t)mul;
+    if (debug_product > (int16_t)INT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i8_floor(%i, %i, %u), numerical overflow in the product %i * %i = %i > %i.\n", num, mul, shift, num, mul, debug_product, INT8_MAX);
+
+    if (debug_product < (int16_t)INT8_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i8_floor(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i8_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int16_t diagnose_product = (int16_t)num * (int16_t)mul;
+    if (diagnose_product > (int16_t)INT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int16_t)INT8_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)6) return (int8_t)0;
+  int8_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,6]. */
+INTMATH_API int8_t multshiftround_i8_trunc(const int8_t num, const int8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)6)
+	    fprintf(stderr, "ERROR: multshiftround_i8_trunc(%i, %i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, mul, shift, shift);
+
+    int16_t debug_product = (int16_t)num * (int16_t)mul;
+    if (debug_product > (int16_t)INT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i8_trunc(%i, %i, %u), numerical overflow in the product %i * %i = %i > %i.\n", num, mul, shift, num, mul, debug_product, INT8_MAX);
+
+    if (debug_product < (int16_t)INT8_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i8_trunc(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i8_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int16_t diagnose_product = (int16_t)num * (int16_t)mul;
+    if (diagnose_product > (int16_t)INT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int16_t)INT8_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i8_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)6) return (int8_t)0;
+  int8_t prod = num * mul;
+
+  return (prod + ((prod >> 7) & (int8_t)(((uint8_t)1 << shift) - (uint8_t)1))) >> shift;
+}
+
+/**
+ * Returns dividend / divisor rounded half to even. divisor must never be 0.
+ * divisor must not be -1 when dividend is -128 (-2^7).
+ */
+INTMATH_API int8_t divround_i8_even(const int8_t dividend, const int8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int8_t)0)
+      fprintf(stderr, "ERROR: divround_i8_even(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      fprintf(stderr, "ERROR: divround_i8_even(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i8_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i8_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (int8_t)0) return dividend;
+  if (dividend == INT8_MIN && divisor == (int8_t)-1) return INT8_MAX;
+
+  int8_t quotient = dividend / divisor;
+  int8_t remainder = dividend - (quotient * divisor);
+  uint8_t remainder_sign = (uint8_t)(remainder >> 7);
+  uint8_t divisor_sign = (uint8_t)(divisor >> 7);
+  uint8_t remainder_mag = (uint8_t)(((uint8_t)remainder ^ remainder_sign) - remainder_sign);
+  uint8_t divisor_mag = (uint8_t)(((uint8_t)divisor ^ divisor_sign) - divisor_sign);
+  uint8_t excess = divisor_mag - remainder_mag;
+  int8_t round_up = (int8_t)((remainder_mag > excess) | ((remainder_mag == excess) & (quotient & 1)));
+  int8_t negative = (dividend ^ divisor) >> 7;
+  return quotient + ((round_up ^ negative) - negative);
+}
+
+/**
+ * Returns dividend / divisor rounded toward negative infinity. divisor must never be 0.
+ * divisor must not be -1 when dividend is -128 (-2^7).
+ */
+INTMATH_API int8_t divround_i8_floor(const int8_t dividend, const int8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int8_t)0)
+      fprintf(stderr, "ERROR: divround_i8_floor(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      fprintf(stderr, "ERROR: divround_i8_floor(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i8_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i8_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (int8_t)0) return dividend;
+  if (dividend == INT8_MIN && divisor == (int8_t)-1) return INT8_MAX;
+
+  int8_t quotient = dividend / divisor;
+  int8_t remainder = dividend - (quotient * divisor);
+  return quotient - (int8_t)((remainder != (int8_t)0) & ((remainder ^ divisor) < (int8_t)0));
+}
+
+/**
+ * Returns dividend / divisor rounded toward zero. divisor must never be 0.
+ * divisor must not be -1 when dividend is -128 (-2^7).
+ */
+INTMATH_API int8_t divround_i8_trunc(const int8_t dividend, const int8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int8_t)0)
+      fprintf(stderr, "ERROR: divround_i8_trunc(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      fprintf(stderr, "ERROR: divround_i8_trunc(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT8_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i8_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT8_MIN && divisor == (int8_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i8_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (int8_t)0) return dividend;
+  if (dividend == INT8_MIN && divisor == (int8_t)-1) return INT8_MAX;
+
+  return dividend / divisor;
+}
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,7]. */
+INTMATH_API uint8_t shiftround_u8_even(const uint8_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+	    fprintf(stderr, "ERROR: shiftround_u8_even(%u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u8_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)7) return (uint8_t)0;
+  if (shift == (uint8_t)0) return num;
+
+  uint8_t half = (uint8_t)1 << (shift - (uint8_t)1);
+  uint8_t remainder = (uint8_t)num & (uint8_t)((half << 1) - (uint8_t)1);
+  uint8_t quotient = num >> shift;
+  return quotient + (uint8_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,7]. */
+INTMATH_API uint8_t shiftround_u8_floor(const uint8_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+	    fprintf(stderr, "ERROR: shiftround_u8_floor(%u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u8_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)7) return (uint8_t)0;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,7]. */
+INTMATH_API uint8_t shiftround_u8_trunc(const uint8_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+	    fprintf(stderr, "ERROR: shiftround_u8_trunc(%u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u8_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)7) return (uint8_t)0;
+
+  return num >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,7]. */
+INTMATH_API uint8_t multshiftround_u8_even(const uint8_t num, const uint8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+  	  fprintf(stderr, "ERROR: multshiftround_u8_even(%u, %u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, mul, shift, shift);
+
+    uint16_t debug_product = (uint16_t)num * (uint16_t)mul;
+    if (debug_product > (uint16_t)UINT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u8_even(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT8_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u8_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint16_t diagnose_product = (uint16_t)num * (uint16_t)mul;
+    if (diagnose_product > (uint16_t)UINT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u8_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)7) return (uint8_t)0;
+  uint8_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint8_t half = (uint8_t)1 << (shift - (uint8_t)1);
+  uint8_t remainder = (uint8_t)prod & (uint8_t)((half << 1) - (uint8_t)1);
+  uint8_t quotient = prod >> shift;
+  return quotient + (uint8_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,7]. */
+INTMATH_API uint8_t multshiftround_u8_floor(const uint8_t num, const uint8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+  	  fprintf(stderr, "ERROR: multshiftround_u8_floor(%u, %u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, mul, shift, shift);
+
+    uint16_t debug_product = (uint16_t)num * (uint16_t)mul;
+    if (debug_product > (uint16_t)UINT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u8_floor(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT8_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u8_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint16_t diagnose_product = (uint16_t)num * (uint16_t)mul;
+    if (diagnose_product > (uint16_t)UINT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u8_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)7) return (uint8_t)0;
+  uint8_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,7]. */
+INTMATH_API uint8_t multshiftround_u8_trunc(const uint8_t num, const uint8_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)7)
+  	  fprintf(stderr, "ERROR: multshiftround_u8_trunc(%u, %u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, mul, shift, shift);
+
+    uint16_t debug_product = (uint16_t)num * (uint16_t)mul;
+    if (debug_product > (uint16_t)UINT8_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u8_trunc(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT8_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u8_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint16_t diagnose_product = (uint16_t)num * (uint16_t)mul;
+    if (diagnose_product > (uint16_t)UINT8_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u8_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)7) return (uint8_t)0;
+  uint8_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns dividend / divisor rounded half to even. divisor must not be 0. */
+INTMATH_API uint8_t divround_u8_even(const uint8_t dividend, const uint8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint8_t)0)
+      fprintf(stderr, "ERROR: divround_u8_even(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u8_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (uint8_t)0) return dividend;
+
+  uint8_t quotient = dividend / divisor;
+  uint8_t remainder = dividend - (quotient * divisor);
+  uint8_t excess = divisor - remainder;
+  return quotient + (uint8_t)((remainder > excess) | ((remainder == excess) & (quotient & 1)));
+}
+
+/* Returns dividend / divisor rounded toward negative infinity. divisor must not be 0. */
+INTMATH_API uint8_t divround_u8_floor(const uint8_t dividend, const uint8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint8_t)0)
+      fprintf(stderr, "ERROR: divround_u8_floor(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u8_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (uint8_t)0) return dividend;
+
+  return dividend / divisor;
+}
+
+/* Returns dividend / divisor rounded toward zero. divisor must not be 0. */
+INTMATH_API uint8_t divround_u8_trunc(const uint8_t dividend, const uint8_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint8_t)0)
+      fprintf(stderr, "ERROR: divround_u8_trunc(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint8_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u8_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (uint8_t)0) return dividend;
+
+  return dividend / divisor;
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,14]. */
+INTMATH_API int16_t shiftround_i16_even(const int16_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+	    fprintf(stderr, "ERROR: shiftround_i16_even(%i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i16_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)14) return (int16_t)0;
+  if (shift == (uint8_t)0) return num;
+
+  uint16_t half = (uint16_t)1 << (shift - (uint8_t)1);
+  uint16_t remainder = (uint16_t)num & (uint16_t)((half << 1) - (uint16_t)1);
+  int16_t quotient = num >> shift;
+  return quotient + (int16_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,14]. */
+INTMATH_API int16_t shiftround_i16_floor(const int16_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+	    fprintf(stderr, "ERROR: shiftround_i16_floor(%i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i16_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)14) return (int16_t)0;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,14]. */
+INTMATH_API int16_t shiftround_i16_trunc(const int16_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+	    fprintf(stderr, "ERROR: shiftround_i16_trunc(%i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i16_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)14) return (int16_t)0;
+
+  return (num + ((num >> 15) & (int16_t)(((uint16_t)1 << shift) - (uint16_t)1))) >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,14]. */
+INTMATH_API int16_t multshiftround_i16_even(const int16_t num, const int16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+	    fprintf(stderr, "ERROR: multshiftround_i16_even(%i, %i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, mul, shift, shift);
+
+    int32_t debug_product = (int32_t)num * (int32_t)mul;
+    if (debug_product > (int32_t)INT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i16_even(%i, %i, %u), numerical overflow in the product %i * %i = %i > %i.\n", num, mul, shift, num, mul, debug_product, INT16_MAX);
+
+    if (debug_product < (int32_t)INT16_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i16_even(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i16_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int32_t diagnose_product = (int32_t)num * (int32_t)mul;
+    if (diagnose_product > (int32_t)INT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int32_t)INT16_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) return (int16_t)0;
+  int16_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint16_t half = (uint16_t)1 << (shift - (uint8_t)1);
+  uint16_t remainder = (uint16_t)prod & (uint16_t)((half << 1) - (uint16_t)1);
+  int16_t quotient = prod >> shift;
+  return quotient + (int16_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,14]. */
+INTMATH_API int16_t multshiftround_i16_floor(const int16_t num, const int16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+	    fprintf(stderr, "ERROR: multshiftround_i16_floor(%i, %i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, mul, shift, shift);
+
+    int32_t debug_product = (int32_t)num * (int32_t)mul;
+    if (debug_product > (int32_t)INT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i16_floor(%i, %i, %u), numerical overflow in the product %i * %i = %i > %i.\n", num, mul, shift, num, mul, debug_product, INT16_MAX);
+
+    if (debug_product < (int32_t)INT16_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i16_floor(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i16_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int32_t diagnose_product = (int32_t)num * (int32_t)mul;
+    if (diagnose_product > (int32_t)INT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int32_t)INT16_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) return (int16_t)0;
+  int16_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,14]. */
+INTMATH_API int16_t multshiftround_i16_trunc(const int16_t num, const int16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)14)
+	    fprintf(stderr, "ERROR: multshiftround_i16_trunc(%i, %i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, mul, shift, shift);
+
+    int32_t debug_product = (int32_t)num * (int32_t)mul;
+    if (debug_product > (int32_t)INT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i16_trunc(%i, %i, %u), numerical overflow in the product %i * %i = %i > %i.\n", num, mul, shift, num, mul, debug_product, INT16_MAX);
+
+    if (debug_product < (int32_t)INT16_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i16_trunc(%i, %i, %u), numerical underflow in the product %i * %i = %i < %i.\n", num, mul, shift, num, mul, debug_product, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i16_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int32_t diagnose_product = (int32_t)num * (int32_t)mul;
+    if (diagnose_product > (int32_t)INT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int32_t)INT16_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i16_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)14) return (int16_t)0;
+  int16_t prod = num * mul;
+
+  return (prod + ((prod >> 15) & (int16_t)(((uint16_t)1 << shift) - (uint16_t)1))) >> shift;
+}
+
+/**
+ * Returns dividend / divisor rounded half to even. divisor must never be 0.
+ * divisor must not be -1 when dividend is -32768 (-2^15).
+ */
+INTMATH_API int16_t divround_i16_even(const int16_t dividend, const int16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int16_t)0)
+      fprintf(stderr, "ERROR: divround_i16_even(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      fprintf(stderr, "ERROR: divround_i16_even(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i16_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i16_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (int16_t)0) return dividend;
+  if (dividend == INT16_MIN && divisor == (int16_t)-1) return INT16_MAX;
+
+  int16_t quotient = dividend / divisor;
+  int16_t remainder = dividend - (quotient * divisor);
+  uint16_t remainder_sign = (uint16_t)(remainder >> 15);
+  uint16_t divisor_sign = (uint16_t)(divisor >> 15);
+  uint16_t remainder_mag = (uint16_t)(((uint16_t)remainder ^ remainder_sign) - remainder_sign);
+  uint16_t divisor_mag = (uint16_t)(((uint16_t)divisor ^ divisor_sign) - divisor_sign);
+  uint16_t excess = divisor_mag - remainder_mag;
+  int16_t round_up = (int16_t)((remainder_mag > excess) | ((remainder_mag == excess) & (quotient & 1)));
+  int16_t negative = (dividend ^ divisor) >> 15;
+  return quotient + ((round_up ^ negative) - negative);
+}
+
+/**
+ * Returns dividend / divisor rounded toward negative infinity. divisor must never be 0.
+ * divisor must not be -1 when dividend is -32768 (-2^15).
+ */
+INTMATH_API int16_t divround_i16_floor(const int16_t dividend, const int16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int16_t)0)
+      fprintf(stderr, "ERROR: divround_i16_floor(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      fprintf(stderr, "ERROR: divround_i16_floor(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i16_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i16_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (int16_t)0) return dividend;
+  if (dividend == INT16_MIN && divisor == (int16_t)-1) return INT16_MAX;
+
+  int16_t quotient = dividend / divisor;
+  int16_t remainder = dividend - (quotient * divisor);
+  return quotient - (int16_t)((remainder != (int16_t)0) & ((remainder ^ divisor) < (int16_t)0));
+}
+
+/**
+ * Returns dividend / divisor rounded toward zero. divisor must never be 0.
+ * divisor must not be -1 when dividend is -32768 (-2^15).
+ */
+INTMATH_API int16_t divround_i16_trunc(const int16_t dividend, const int16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (int16_t)0)
+      fprintf(stderr, "ERROR: divround_i16_trunc(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      fprintf(stderr, "ERROR: divround_i16_trunc(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT16_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (int16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i16_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT16_MIN && divisor == (int16_t)-1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i16_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (int16_t)0) return dividend;
+  if (dividend == INT16_MIN && divisor == (int16_t)-1) return INT16_MAX;
+
+  return dividend / divisor;
+}
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,15]. */
+INTMATH_API uint16_t shiftround_u16_even(const uint16_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+	    fprintf(stderr, "ERROR: shiftround_u16_even(%u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u16_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint16_t)0;
+  if (shift == (uint8_t)0) return num;
+
+  uint16_t half = (uint16_t)1 << (shift - (uint8_t)1);
+  uint16_t remainder = (uint16_t)num & (uint16_t)((half << 1) - (uint16_t)1);
+  uint16_t quotient = num >> shift;
+  return quotient + (uint16_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,15]. */
+INTMATH_API uint16_t shiftround_u16_floor(const uint16_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+	    fprintf(stderr, "ERROR: shiftround_u16_floor(%u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u16_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint16_t)0;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,15]. */
+INTMATH_API uint16_t shiftround_u16_trunc(const uint16_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+	    fprintf(stderr, "ERROR: shiftround_u16_trunc(%u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u16_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint16_t)0;
+
+  return num >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,15]. */
+INTMATH_API uint16_t multshiftround_u16_even(const uint16_t num, const uint16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+  	  fprintf(stderr, "ERROR: multshiftround_u16_even(%u, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, mul, shift, shift);
+
+    uint32_t debug_product = (uint32_t)num * (uint32_t)mul;
+    if (debug_product > (uint32_t)UINT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u16_even(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT16_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u16_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint32_t diagnose_product = (uint32_t)num * (uint32_t)mul;
+    if (diagnose_product > (uint32_t)UINT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u16_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint16_t)0;
+  uint16_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint16_t half = (uint16_t)1 << (shift - (uint8_t)1);
+  uint16_t remainder = (uint16_t)prod & (uint16_t)((half << 1) - (uint16_t)1);
+  uint16_t quotient = prod >> shift;
+  return quotient + (uint16_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,15]. */
+INTMATH_API uint16_t multshiftround_u16_floor(const uint16_t num, const uint16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+  	  fprintf(stderr, "ERROR: multshiftround_u16_floor(%u, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, mul, shift, shift);
+
+    uint32_t debug_product = (uint32_t)num * (uint32_t)mul;
+    if (debug_product > (uint32_t)UINT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u16_floor(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT16_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u16_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint32_t diagnose_product = (uint32_t)num * (uint32_t)mul;
+    if (diagnose_product > (uint32_t)UINT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u16_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint16_t)0;
+  uint16_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,15]. */
+INTMATH_API uint16_t multshiftround_u16_trunc(const uint16_t num, const uint16_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)15)
+  	  fprintf(stderr, "ERROR: multshiftround_u16_trunc(%u, %u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, mul, shift, shift);
+
+    uint32_t debug_product = (uint32_t)num * (uint32_t)mul;
+    if (debug_product > (uint32_t)UINT16_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u16_trunc(%u, %u, %u), numerical overflow in the product %u * %u = %u > %u.\n", num, mul, shift, num, mul, debug_product, UINT16_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+  	  intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u16_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint32_t diagnose_product = (uint32_t)num * (uint32_t)mul;
+    if (diagnose_product > (uint32_t)UINT16_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u16_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)15) return (uint16_t)0;
+  uint16_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns dividend / divisor rounded half to even. divisor must not be 0. */
+INTMATH_API uint16_t divround_u16_even(const uint16_t dividend, const uint16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint16_t)0)
+      fprintf(stderr, "ERROR: divround_u16_even(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u16_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (uint16_t)0) return dividend;
+
+  uint16_t quotient = dividend / divisor;
+  uint16_t remainder = dividend - (quotient * divisor);
+  uint16_t excess = divisor - remainder;
+  return quotient + (uint16_t)((remainder > excess) | ((remainder == excess) & (quotient & 1)));
+}
+
+/* Returns dividend / divisor rounded toward negative infinity. divisor must not be 0. */
+INTMATH_API uint16_t divround_u16_floor(const uint16_t dividend, const uint16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint16_t)0)
+      fprintf(stderr, "ERROR: divround_u16_floor(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u16_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (uint16_t)0) return dividend;
+
+  return dividend / divisor;
+}
+
+/* Returns dividend / divisor rounded toward zero. divisor must not be 0. */
+INTMATH_API uint16_t divround_u16_trunc(const uint16_t dividend, const uint16_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == (uint16_t)0)
+      fprintf(stderr, "ERROR: divround_u16_trunc(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == (uint16_t)0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u16_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == (uint16_t)0) return dividend;
+
+  return dividend / divisor;
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,30]. */
+INTMATH_API int32_t shiftround_i32_even(const int32_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+	    fprintf(stderr, "ERROR: shiftround_i32_even(%i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i32_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)30) return 0;
+  if (shift == (uint8_t)0) return num;
+
+  uint32_t half = 1u << (shift - (uint8_t)1);
+  uint32_t remainder = (uint32_t)num & (uint32_t)((half << 1) - 1u);
+  int32_t quotient = num >> shift;
+  return quotient + (int32_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,30]. */
+INTMATH_API int32_t shiftround_i32_floor(const int32_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+	    fprintf(stderr, "ERROR: shiftround_i32_floor(%i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i32_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)30) return 0;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,30]. */
+INTMATH_API int32_t shiftround_i32_trunc(const int32_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+	    fprintf(stderr, "ERROR: shiftround_i32_trunc(%i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i32_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)30) return 0;
+
+  return (num + ((num >> 31) & (int32_t)((1u << shift) - 1u))) >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,30]. */
+INTMATH_API int32_t multshiftround_i32_even(const int32_t num, const int32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+	    fprintf(stderr, "ERROR: multshiftround_i32_even(%i, %i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, shift);
+
+    int64_t debug_product = (int64_t)num * (int64_t)mul;
+    if (debug_product > (int64_t)INT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i32_even(%i, %i, %u), numerical overflow in the product %i * %i = %" PRIi64 " > %i.\n", num, mul, shift, num, mul, debug_product, INT32_MAX);
+
+    if (debug_product < (int64_t)INT32_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i32_even(%i, %i, %u), numerical underflow in the product %i * %i = %" PRIi64 " < %i.\n", num, mul, shift, num, mul, debug_product, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i32_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int64_t diagnose_product = (int64_t)num * (int64_t)mul;
+    if (diagnose_product > (int64_t)INT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int64_t)INT32_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return 0;
+  int32_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint32_t half = 1u << (shift - (uint8_t)1);
+  uint32_t remainder = (uint32_t)prod & (uint32_t)((half << 1) - 1u);
+  int32_t quotient = prod >> shift;
+  return quotient + (int32_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,30]. */
+INTMATH_API int32_t multshiftround_i32_floor(const int32_t num, const int32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+	    fprintf(stderr, "ERROR: multshiftround_i32_floor(%i, %i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, shift);
+
+    int64_t debug_product = (int64_t)num * (int64_t)mul;
+    if (debug_product > (int64_t)INT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i32_floor(%i, %i, %u), numerical overflow in the product %i * %i = %" PRIi64 " > %i.\n", num, mul, shift, num, mul, debug_product, INT32_MAX);
+
+    if (debug_product < (int64_t)INT32_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i32_floor(%i, %i, %u), numerical underflow in the product %i * %i = %" PRIi64 " < %i.\n", num, mul, shift, num, mul, debug_product, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i32_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int64_t diagnose_product = (int64_t)num * (int64_t)mul;
+    if (diagnose_product > (int64_t)INT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int64_t)INT32_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return 0;
+  int32_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,30]. */
+INTMATH_API int32_t multshiftround_i32_trunc(const int32_t num, const int32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)30)
+	    fprintf(stderr, "ERROR: multshiftround_i32_trunc(%i, %i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, mul, shift, shift);
+
+    int64_t debug_product = (int64_t)num * (int64_t)mul;
+    if (debug_product > (int64_t)INT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_i32_trunc(%i, %i, %u), numerical overflow in the product %i * %i = %" PRIi64 " > %i.\n", num, mul, shift, num, mul, debug_product, INT32_MAX);
+
+    if (debug_product < (int64_t)INT32_MIN)
+      fprintf(stderr, "ERROR: multshiftround_i32_trunc(%i, %i, %u), numerical underflow in the product %i * %i = %" PRIi64 " < %i.\n", num, mul, shift, num, mul, debug_product, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i32_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    int64_t diagnose_product = (int64_t)num * (int64_t)mul;
+    if (diagnose_product > (int64_t)INT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (diagnose_product < (int64_t)INT32_MIN)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i32_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)30) return 0;
+  int32_t prod = num * mul;
+
+  return (prod + ((prod >> 31) & (int32_t)((1u << shift) - 1u))) >> shift;
+}
+
+/**
+ * Returns dividend / divisor rounded half to even. divisor must never be 0.
+ * divisor must not be -1 when dividend is -2147483648 (-2^31).
+ */
+INTMATH_API int32_t divround_i32_even(const int32_t dividend, const int32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0)
+      fprintf(stderr, "ERROR: divround_i32_even(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      fprintf(stderr, "ERROR: divround_i32_even(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i32_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i32_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0) return dividend;
+  if (dividend == INT32_MIN && divisor == -1) return INT32_MAX;
+
+  int32_t quotient = dividend / divisor;
+  int32_t remainder = dividend - (quotient * divisor);
+  uint32_t remainder_sign = (uint32_t)(remainder >> 31);
+  uint32_t divisor_sign = (uint32_t)(divisor >> 31);
+  uint32_t remainder_mag = (uint32_t)(((uint32_t)remainder ^ remainder_sign) - remainder_sign);
+  uint32_t divisor_mag = (uint32_t)(((uint32_t)divisor ^ divisor_sign) - divisor_sign);
+  uint32_t excess = divisor_mag - remainder_mag;
+  int32_t round_up = (int32_t)((remainder_mag > excess) | ((remainder_mag == excess) & (quotient & 1)));
+  int32_t negative = (dividend ^ divisor) >> 31;
+  return quotient + ((round_up ^ negative) - negative);
+}
+
+/**
+ * Returns dividend / divisor rounded toward negative infinity. divisor must never be 0.
+ * divisor must not be -1 when dividend is -2147483648 (-2^31).
+ */
+INTMATH_API int32_t divround_i32_floor(const int32_t dividend, const int32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0)
+      fprintf(stderr, "ERROR: divround_i32_floor(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      fprintf(stderr, "ERROR: divround_i32_floor(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i32_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i32_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0) return dividend;
+  if (dividend == INT32_MIN && divisor == -1) return INT32_MAX;
+
+  int32_t quotient = dividend / divisor;
+  int32_t remainder = dividend - (quotient * divisor);
+  return quotient - (int32_t)((remainder != 0) & ((remainder ^ divisor) < 0));
+}
+
+/**
+ * Returns dividend / divisor rounded toward zero. divisor must never be 0.
+ * divisor must not be -1 when dividend is -2147483648 (-2^31).
+ */
+INTMATH_API int32_t divround_i32_trunc(const int32_t dividend, const int32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0)
+      fprintf(stderr, "ERROR: divround_i32_trunc(%i, %i) divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      fprintf(stderr, "ERROR: divround_i32_trunc(%i, %i) divisor must not be -1 when dividend is %i.\n", dividend, divisor, INT32_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i32_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT32_MIN && divisor == -1)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i32_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0) return dividend;
+  if (dividend == INT32_MIN && divisor == -1) return INT32_MAX;
+
+  return dividend / divisor;
+}
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,31]. */
+INTMATH_API uint32_t shiftround_u32_even(const uint32_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+	    fprintf(stderr, "ERROR: shiftround_u32_even(%u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u32_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)31) return 0u;
+  if (shift == (uint8_t)0) return num;
+
+  uint32_t half = 1u << (shift - (uint8_t)1);
+  uint32_t remainder = (uint32_t)num & (uint32_t)((half << 1) - 1u);
+  uint32_t quotient = num >> shift;
+  return quotient + (uint32_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,31]. */
+INTMATH_API uint32_t shiftround_u32_floor(const uint32_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+	    fprintf(stderr, "ERROR: shiftround_u32_floor(%u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u32_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)31) return 0u;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,31]. */
+INTMATH_API uint32_t shiftround_u32_trunc(const uint32_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+	    fprintf(stderr, "ERROR: shiftround_u32_trunc(%u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u32_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)31) return 0u;
+
+  return num >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,31]. */
+INTMATH_API uint32_t multshiftround_u32_even(const uint32_t num, const uint32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+	    fprintf(stderr, "ERROR: multshiftround_u32_even(%u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, shift);
+
+    uint64_t debug_product = (uint64_t)num * (uint64_t)mul;
+    if (debug_product > (uint64_t)UINT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u32_even(%u, %u, %u), numerical overflow in the product %u * %u = %" PRIu64 " > %u.\n", num, mul, shift, num, mul, debug_product, UINT32_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u32_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint64_t diagnose_product = (uint64_t)num * (uint64_t)mul;
+    if (diagnose_product > (uint64_t)UINT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u32_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return 0u;
+  uint32_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint32_t half = 1u << (shift - (uint8_t)1);
+  uint32_t remainder = (uint32_t)prod & (uint32_t)((half << 1) - 1u);
+  uint32_t quotient = prod >> shift;
+  return quotient + (uint32_t)((remainder > half) | ((remainder == half) & (quotient & 1)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,31]. */
+INTMATH_API uint32_t multshiftround_u32_floor(const uint32_t num, const uint32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+	    fprintf(stderr, "ERROR: multshiftround_u32_floor(%u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, shift);
+
+    uint64_t debug_product = (uint64_t)num * (uint64_t)mul;
+    if (debug_product > (uint64_t)UINT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u32_floor(%u, %u, %u), numerical overflow in the product %u * %u = %" PRIu64 " > %u.\n", num, mul, shift, num, mul, debug_product, UINT32_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u32_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint64_t diagnose_product = (uint64_t)num * (uint64_t)mul;
+    if (diagnose_product > (uint64_t)UINT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u32_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return 0u;
+  uint32_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,31]. */
+INTMATH_API uint32_t multshiftround_u32_trunc(const uint32_t num, const uint32_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)31)
+	    fprintf(stderr, "ERROR: multshiftround_u32_trunc(%u, %u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, mul, shift, shift);
+
+    uint64_t debug_product = (uint64_t)num * (uint64_t)mul;
+    if (debug_product > (uint64_t)UINT32_MAX)
+      fprintf(stderr, "ERROR: multshiftround_u32_trunc(%u, %u, %u), numerical overflow in the product %u * %u = %" PRIu64 " > %u.\n", num, mul, shift, num, mul, debug_product, UINT32_MAX);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u32_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    uint64_t diagnose_product = (uint64_t)num * (uint64_t)mul;
+    if (diagnose_product > (uint64_t)UINT32_MAX)
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u32_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)31) return 0u;
+  uint32_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns dividend / divisor rounded half to even. divisor must not be 0. */
+INTMATH_API uint32_t divround_u32_even(const uint32_t dividend, const uint32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0u)
+      fprintf(stderr, "ERROR: divround_u32_even(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0u)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u32_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0u) return dividend;
+
+  uint32_t quotient = dividend / divisor;
+  uint32_t remainder = dividend - (quotient * divisor);
+  uint32_t excess = divisor - remainder;
+  return quotient + (uint32_t)((remainder > excess) | ((remainder == excess) & (quotient & 1u)));
+}
+
+/* Returns dividend / divisor rounded toward negative infinity. divisor must not be 0. */
+INTMATH_API uint32_t divround_u32_floor(const uint32_t dividend, const uint32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0u)
+      fprintf(stderr, "ERROR: divround_u32_floor(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0u)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u32_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0u) return dividend;
+
+  return dividend / divisor;
+}
+
+/* Returns dividend / divisor rounded toward zero. divisor must not be 0. */
+INTMATH_API uint32_t divround_u32_trunc(const uint32_t dividend, const uint32_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0u)
+      fprintf(stderr, "ERROR: divround_u32_trunc(%u, %u) divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0u)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u32_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0u) return dividend;
+
+  return dividend / divisor;
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,62]. */
+INTMATH_API int64_t shiftround_i64_even(const int64_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+	    fprintf(stderr, "ERROR: shiftround_i64_even(%" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i64_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)62) return 0ll;
+  if (shift == (uint8_t)0) return num;
+
+  uint64_t half = 1ull << (shift - (uint8_t)1);
+  uint64_t remainder = (uint64_t)num & (uint64_t)((half << 1) - 1ull);
+  int64_t quotient = num >> shift;
+  return quotient + (int64_t)((remainder > half) | ((remainder == half) & (quotient & 1ll)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,62]. */
+INTMATH_API int64_t shiftround_i64_floor(const int64_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+	    fprintf(stderr, "ERROR: shiftround_i64_floor(%" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i64_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)62) return 0ll;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,62]. */
+INTMATH_API int64_t shiftround_i64_trunc(const int64_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+	    fprintf(stderr, "ERROR: shiftround_i64_trunc(%" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i64_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)62) return 0ll;
+
+  return (num + ((num >> 63) & (int64_t)((1ull << shift) - 1ull))) >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,62]. */
+INTMATH_API int64_t multshiftround_i64_even(const int64_t num, const int64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+	    fprintf(stderr, "ERROR: multshiftround_i64_even(%" PRIi64 ", %" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, shift);
+
+    if (detect_product_overflow_i64(num, mul))
+      fprintf(stderr, "ERROR: multshiftround_i64_even(%" PRIi64 ", %" PRIi64 ", %u), numerical overflow or underflow in the product %" PRIi64 " * %" PRIi64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i64_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_i64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i64_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return 0ll;
+  int64_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint64_t half = 1ull << (shift - (uint8_t)1);
+  uint64_t remainder = (uint64_t)prod & (uint64_t)((half << 1) - 1ull);
+  int64_t quotient = prod >> shift;
+  return quotient + (int64_t)((remainder > half) | ((remainder == half) & (quotient & 1ll)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,62]. */
+INTMATH_API int64_t multshiftround_i64_floor(const int64_t num, const int64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+	    fprintf(stderr, "ERROR: multshiftround_i64_floor(%" PRIi64 ", %" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, shift);
+
+    if (detect_product_overflow_i64(num, mul))
+      fprintf(stderr, "ERROR: multshiftround_i64_floor(%" PRIi64 ", %" PRIi64 ", %u), numerical overflow or underflow in the product %" PRIi64 " * %" PRIi64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i64_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_i64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i64_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return 0ll;
+  int64_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,62]. */
+INTMATH_API int64_t multshiftround_i64_trunc(const int64_t num, const int64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)62)
+	    fprintf(stderr, "ERROR: multshiftround_i64_trunc(%" PRIi64 ", %" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, mul, shift, shift);
+
+    if (detect_product_overflow_i64(num, mul))
+      fprintf(stderr, "ERROR: multshiftround_i64_trunc(%" PRIi64 ", %" PRIi64 ", %u), numerical overflow or underflow in the product %" PRIi64 " * %" PRIi64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_i64_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_i64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i64_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)62) return 0ll;
+  int64_t prod = num * mul;
+
+  return (prod + ((prod >> 63) & (int64_t)((1ull << shift) - 1ull))) >> shift;
+}
+
+/**
+ * Returns dividend / divisor rounded half to even. divisor must never be 0.
+ * divisor must not be -1 when dividend is -9223372036854775808 (-2^63).
+ */
+INTMATH_API int64_t divround_i64_even(const int64_t dividend, const int64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ll)
+      fprintf(stderr, "ERROR: divround_i64_even(%" PRIi64 ", %" PRIi64 ") divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      fprintf(stderr, "ERROR: divround_i64_even(%" PRIi64 ", %" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", dividend, divisor, INT64_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ll)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i64_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i64_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0ll) return dividend;
+  if (dividend == INT64_MIN && divisor == -1ll) return INT64_MAX;
+
+  int64_t quotient = dividend / divisor;
+  int64_t remainder = dividend - (quotient * divisor);
+  uint64_t remainder_sign = (uint64_t)(remainder >> 63);
+  uint64_t divisor_sign = (uint64_t)(divisor >> 63);
+  uint64_t remainder_mag = (uint64_t)(((uint64_t)remainder ^ remainder_sign) - remainder_sign);
+  uint64_t divisor_mag = (uint64_t)(((uint64_t)divisor ^ divisor_sign) - divisor_sign);
+  uint64_t excess = divisor_mag - remainder_mag;
+  int64_t round_up = (int64_t)((remainder_mag > excess) | ((remainder_mag == excess) & (quotient & 1ll)));
+  int64_t negative = (dividend ^ divisor) >> 63;
+  return quotient + ((round_up ^ negative) - negative);
+}
+
+/**
+ * Returns dividend / divisor rounded toward negative infinity. divisor must never be 0.
+ * divisor must not be -1 when dividend is -9223372036854775808 (-2^63).
+ */
+INTMATH_API int64_t divround_i64_floor(const int64_t dividend, const int64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ll)
+      fprintf(stderr, "ERROR: divround_i64_floor(%" PRIi64 ", %" PRIi64 ") divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      fprintf(stderr, "ERROR: divround_i64_floor(%" PRIi64 ", %" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", dividend, divisor, INT64_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ll)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i64_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i64_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0ll) return dividend;
+  if (dividend == INT64_MIN && divisor == -1ll) return INT64_MAX;
+
+  int64_t quotient = dividend / divisor;
+  int64_t remainder = dividend - (quotient * divisor);
+  return quotient - (int64_t)((remainder != 0ll) & ((remainder ^ divisor) < 0ll));
+}
+
+/**
+ * Returns dividend / divisor rounded toward zero. divisor must never be 0.
+ * divisor must not be -1 when dividend is -9223372036854775808 (-2^63).
+ */
+INTMATH_API int64_t divround_i64_trunc(const int64_t dividend, const int64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ll)
+      fprintf(stderr, "ERROR: divround_i64_trunc(%" PRIi64 ", %" PRIi64 ") divisor argument must not be 0.\n", dividend, divisor);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      fprintf(stderr, "ERROR: divround_i64_trunc(%" PRIi64 ", %" PRIi64 ") divisor must not be -1 when dividend is %" PRIi64 ".\n", dividend, divisor, INT64_MIN);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ll)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_i64_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+    
+    if (dividend == INT64_MIN && divisor == -1ll)
+      intmath_diagnostics_record(INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i64_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0ll) return dividend;
+  if (dividend == INT64_MIN && divisor == -1ll) return INT64_MAX;
+
+  return dividend / divisor;
+}
+
+/* Returns num / 2^shift rounded half to even. shift must be on the range [0,63]. */
+INTMATH_API uint64_t shiftround_u64_even(const uint64_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+	    fprintf(stderr, "ERROR: shiftround_u64_even(%" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u64_even", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)63) return 0ull;
+  if (shift == (uint8_t)0) return num;
+
+  uint64_t half = 1ull << (shift - (uint8_t)1);
+  uint64_t remainder = (uint64_t)num & (uint64_t)((half << 1) - 1ull);
+  uint64_t quotient = num >> shift;
+  return quotient + (uint64_t)((remainder > half) | ((remainder == half) & (quotient & 1ull)));
+}
+
+/* Returns num / 2^shift rounded toward negative infinity. shift must be on the range [0,63]. */
+INTMATH_API uint64_t shiftround_u64_floor(const uint64_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+	    fprintf(stderr, "ERROR: shiftround_u64_floor(%" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u64_floor", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)63) return 0ull;
+
+  return num >> shift;
+}
+
+/* Returns num / 2^shift rounded toward zero. shift must be on the range [0,63]. */
+INTMATH_API uint64_t shiftround_u64_trunc(const uint64_t num, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+	    fprintf(stderr, "ERROR: shiftround_u64_trunc(%" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u64_trunc", (uint64_t)num, (uint64_t)shift, 0u);
+  #endif
+
+  if (shift > (uint8_t)63) return 0ull;
+
+  return num >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded half to even. shift must be on the range [0,63]. */
+INTMATH_API uint64_t multshiftround_u64_even(const uint64_t num, const uint64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+	    fprintf(stderr, "ERROR: multshiftround_u64_even(%" PRIu64 ", %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, shift);
+
+    if (detect_product_overflow_u64(num, mul))
+      fprintf(stderr, "ERROR: multshiftround_u64_even(%" PRIu64 ", %" PRIu64 ", %u), numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u64_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_u64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u64_even", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return 0ull;
+  uint64_t prod = num * mul;
+  if (shift == (uint8_t)0) return prod;
+
+  uint64_t half = 1ull << (shift - (uint8_t)1);
+  uint64_t remainder = (uint64_t)prod & (uint64_t)((half << 1) - 1ull);
+  uint64_t quotient = prod >> shift;
+  return quotient + (uint64_t)((remainder > half) | ((remainder == half) & (quotient & 1ull)));
+}
+
+/* Returns (num * mul) / 2^shift rounded toward negative infinity. shift must be on the range [0,63]. */
+INTMATH_API uint64_t multshiftround_u64_floor(const uint64_t num, const uint64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+	    fprintf(stderr, "ERROR: multshiftround_u64_floor(%" PRIu64 ", %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, shift);
+
+    if (detect_product_overflow_u64(num, mul))
+      fprintf(stderr, "ERROR: multshiftround_u64_floor(%" PRIu64 ", %" PRIu64 ", %u), numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u64_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_u64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u64_floor", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return 0ull;
+  uint64_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns (num * mul) / 2^shift rounded toward zero. shift must be on the range [0,63]. */
+INTMATH_API uint64_t multshiftround_u64_trunc(const uint64_t num, const uint64_t mul, const uint8_t shift) {
+  #ifdef DEBUG_INTMATH
+    if (shift > (uint8_t)63)
+	    fprintf(stderr, "ERROR: multshiftround_u64_trunc(%" PRIu64 ", %" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, mul, shift, shift);
+
+    if (detect_product_overflow_u64(num, mul))
+      fprintf(stderr, "ERROR: multshiftround_u64_trunc(%" PRIu64 ", %" PRIu64 ", %u), numerical overflow in the product %" PRIu64 " * %" PRIu64 ".\n", num, mul, shift, num, mul);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u64_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+
+    if (wide_mul_overflows_u64(num, mul))
+      intmath_diagnostics_record(INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u64_trunc", (uint64_t)num, (uint64_t)mul, (uint64_t)shift);
+  #endif
+
+  if (shift > (uint8_t)63) return 0ull;
+  uint64_t prod = num * mul;
+
+  return prod >> shift;
+}
+
+/* Returns dividend / divisor rounded half to even. divisor must not be 0. */
+INTMATH_API uint64_t divround_u64_even(const uint64_t dividend, const uint64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ull)
+      fprintf(stderr, "ERROR: divround_u64_even(%" PRIu64 ", %" PRIu64 ") divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u64_even", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0ull) return dividend;
+
+  uint64_t quotient = dividend / divisor;
+  uint64_t remainder = dividend - (quotient * divisor);
+  uint64_t excess = divisor - remainder;
+  return quotient + (uint64_t)((remainder > excess) | ((remainder == excess) & (quotient & 1ull)));
+}
+
+/* Returns dividend / divisor rounded toward negative infinity. divisor must not be 0. */
+INTMATH_API uint64_t divround_u64_floor(const uint64_t dividend, const uint64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ull)
+      fprintf(stderr, "ERROR: divround_u64_floor(%" PRIu64 ", %" PRIu64 ") divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u64_floor", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0ull) return dividend;
+
+  return dividend / divisor;
+}
+
+/* Returns dividend / divisor rounded toward zero. divisor must not be 0. */
+INTMATH_API uint64_t divround_u64_trunc(const uint64_t dividend, const uint64_t divisor) {
+  #ifdef DEBUG_INTMATH
+    if (divisor == 0ull)
+      fprintf(stderr, "ERROR: divround_u64_trunc(%" PRIu64 ", %" PRIu64 ") divisor argument must not be 0.\n", dividend, divisor);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (divisor == 0ull)
+      intmath_diagnostics_record(INTMATH_EVENT_ZERO_DIVISOR, "divround_u64_trunc", (uint64_t)dividend, (uint64_t)divisor, 0u);
+  #endif
+
+  if (divisor == 0ull) return dividend;
+
+  return dividend / divisor;
+}
+
+#endif /* #ifndef ROUNDING_POLICY_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,315 @@
+/**
+ * rounding_policy.hpp
+ * Specifies the rounding policy tags
+ *     round_half_away   rounds to the nearest integer and ties away from
+ *                       zero, as std::round() does (the default)
+ *     round_half_even   rounds to the nearest integer and ties to the even
+ *                       one (unbiased, for long accumulations)
+ *     round_floor       rounds toward negative infinity
+ *     round_trunc       rounds toward zero
+ * which may be given as the rounding template argument of
+ *     type shiftround<typename type, typename rounding>(const type num, const uint8_t shift);
+ *     type multshiftround<typename type, typename rounding>(const type num, const type mul, const uint8_t shift);
+ *     type divround<typename type, typename rounding>(const type dividend, const type divisor);
+ *     constexpr type shiftround<typename type, uint8_t shift, typename rounding>(const type num);
+ *     constexpr type multshiftround<typename type, uint8_t shift, typename rounding>(const type num, const type mul);
+ *     type divround<typename type, type divisor, typename rounding>(const type dividend);
+ * in shiftround_run.hpp, multshiftround_run.hpp, divround.hpp,
+ * shiftround_comp.hpp, multshiftround_comp.hpp, and divround_comp.hpp, e.g.
+ *     shiftround<int32_t, round_half_even>(accumulator, 15);
+ *     multshiftround<int16_t, 14, round_floor>(num, gain);
+ * round_half_away selects the original routines, so passing it, or
+ * leaving it out where it is the default, changes nothing.
+ *
+ * This header also holds the constexpr rounding steps shared by the other
+ * policies. They are branch free. For unsigned types round_floor and
+ * round_trunc are the same operation.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef ROUNDING_POLICY_HPP_
+#define ROUNDING_POLICY_HPP_
+
+#include <cinttypes>
+#include <limits>
+#include <type_traits>
+
+#if defined(DEBUG_INTMATH) || defined(DIAGNOSE_INTMATH)
+  #include <cstdio>
+#endif
+
+struct round_half_away { static const char *name(void) { return "round_half_away"; } };
+struct round_half_even { static const char *name(void) { return "round_half_even"; } };
+struct round_floor { static const char *name(void) { return "round_floor"; } };
+struct round_trunc { static const char *name(void) { return "round_trunc"; } };
+
+/* True for the four rounding policy tags above. */
+template <typename rounding> struct is_rounding_policy {
+  static constexpr bool value = std::is_same<rounding, round_half_away>::value || std::is_same<rounding, round_half_even>::value ||
+                                std::is_same<rounding, round_floor>::value || std::is_same<rounding, round_trunc>::value;
+};
+
+/********************************************************************************
+ ********              num / 2^shift, for 1 <= shift < digits            ********
+ ********************************************************************************/
+
+/* The arithmetic right shift already rounds toward negative infinity. */
+template <typename type> constexpr type rounding_policy_shift(const type num, const uint8_t shift, round_floor) {
+  return static_cast<type>(num >> shift);
+}
+
+/* Negative num has 2^shift - 1 added first so that the shift rounds toward zero. */
+template <typename type> constexpr type rounding_policy_shift_trunc(const type num, const uint8_t shift, std::true_type /* is_signed */) {
+  typedef typename std::make_unsigned<type>::type utype;
+  return static_cast<type>(static_cast<type>(num + static_cast<type>((num >> std::numeric_limits<type>::digits) &
+                                                                     static_cast<type>(static_cast<utype>(static_cast<utype>(1) << shift) - 1u))) >> shift);
+}
+
+template <typename type> constexpr type rounding_policy_shift_trunc(const type num, const uint8_t shift, std::false_type /* is_signed */) {
+  return static_cast<type>(num >> shift);
+}
+
+template <typename type> constexpr type rounding_policy_shift(const type num, const uint8_t shift, round_trunc) {
+  return rounding_policy_shift_trunc<type>(num, shift, std::is_signed<type>());
+}
+
+/**
+ * The floored result is stepped up when the discarded bits exceed half, or
+ * equal half and the floored result is odd.
+ */
+template <typename type> constexpr type rounding_policy_shift(const type num, const uint8_t shift, round_half_even) {
+  typedef typename std::make_unsigned<type>::type utype;
+  const utype half = static_cast<utype>(static_cast<utype>(1) << (shift - 1u));
+  const utype remainder = static_cast<utype>(static_cast<utype>(num) & static_cast<utype>((half << 1) - 1u));
+  const type quotient = static_cast<type>(num >> shift);
+  return static_cast<type>(quotient + static_cast<type>((remainder > half) | ((remainder == half) & static_cast<bool>(quotient & 1))));
+}
+
+/********************************************************************************
+ ********       dividend / divisor, for divisor != 0 and no overflow     ********
+ ********************************************************************************/
+
+/* Integer division already truncates. */
+template <typename type> constexpr type rounding_policy_divide(const type dividend, const type divisor, round_trunc) {
+  return static_cast<type>(dividend / divisor);
+}
+
+/* The truncated quotient is stepped down when the remainder is nonzero and differs in sign from the divisor. */
+template <typename type> constexpr type rounding_policy_divide_floor(const type dividend, const type divisor, std::true_type /* is_signed */) {
+  const type quotient = static_cast<type>(dividend / divisor);
+  const type remainder = static_cast<type>(dividend - static_cast<type>(quotient * divisor));
+  return static_cast<type>(quotient - static_cast<type>((remainder != static_cast<type>(0)) & ((remainder ^ divisor) < static_cast<type>(0))));
+}
+
+template <typename type> constexpr type rounding_policy_divide_floor(const type dividend, const type divisor, std::false_type /* is_signed */) {
+  return static_cast<type>(dividend / divisor);
+}
+
+template <typename type> constexpr type rounding_policy_divide(const type dividend, const type divisor, round_floor) {
+  return rounding_policy_divide_floor<type>(dividend, divisor, std::is_signed<type>());
+}
+
+/**
+ * The remainder magnitude is compared against divisor magnitude - remainder
+ * magnitude, which cannot overflow, and the truncated quotient is stepped
+ * away from zero when the remainder is larger, or equal and the truncated
+ * quotient is odd.
+ */
+template <typename type> constexpr type rounding_policy_divide_even(const type dividend, const type divisor, std::true_type /* is_signed */) {
+  typedef typename std::make_unsigned<type>::type utype;
+  const type quotient = static_cast<type>(dividend / divisor);
+  const type remainder = static_cast<type>(dividend - static_cast<type>(quotient * divisor));
+  const utype remainder_sign = static_cast<utype>(remainder >> std::numeric_limits<type>::digits);
+  const utype divisor_sign = static_cast<utype>(divisor >> std::numeric_limits<type>::digits);
+  const utype remainder_mag = static_cast<utype>((static_cast<utype>(remainder) ^ remainder_sign) - remainder_sign);
+  const utype divisor_mag = static_cast<utype>((static_cast<utype>(divisor) ^ divisor_sign) - divisor_sign);
+  const utype excess = static_cast<utype>(divisor_mag - remainder_mag);
+  const type round_up = static_cast<type>((remainder_mag > excess) | ((remainder_mag == excess) & static_cast<bool>(quotient & 1)));
+  const type negative = static_cast<type>((dividend ^ divisor) >> std::numeric_limits<type>::digits);
+  return static_cast<type>(quotient + static_cast<type>((round_up ^ negative) - negative));
+}
+
+template <typename type> constexpr type rounding_policy_divide_even(const type dividend, const type divisor, std::false_type /* is_signed */) {
+  const type quotient = static_cast<type>(dividend / divisor);
+  const type remainder = static_cast<type>(dividend - static_cast<type>(quotient * divisor));
+  const type excess = static_cast<type>(divisor - remainder);
+  return static_cast<type>(quotient + static_cast<type>((remainder > excess) | ((remainder == excess) & static_cast<bool>(quotient & 1u))));
+}
+
+template <typename type> constexpr type rounding_policy_divide(const type dividend, const type divisor, round_half_even) {
+  return rounding_policy_divide_even<type>(dividend, divisor, std::is_signed<type>());
+}
+
+/********************************************************************************
+ ********                debug and diagnostic message text               ********
+ ********************************************************************************/
+
+#if defined(DEBUG_INTMATH) || defined(DIAGNOSE_INTMATH)
+enum rounding_policy_function { ROUNDING_POLICY_SHIFTROUND, ROUNDING_POLICY_MULTSHIFTROUND, ROUNDING_POLICY_DIVROUND };
+
+/**
+ * Returns e.g. "shiftround<int16_t, round_half_even>". The diagnostics
+ * ring keeps the pointer, so the text lives in a function local static.
+ */
+template <rounding_policy_function function, typename type, typename rounding> const char *rounding_policy_name(void) {
+  struct name_text {
+    char text[48];
+    name_text() {
+      const char *type_name = std::is_signed<type>::value
+                              ? (sizeof(type) == 1u ? "int8_t" : sizeof(type) == 2u ? "int16_t" : sizeof(type) == 4u ? "int32_t" : "int64_t")
+                              : (sizeof(type) == 1u ? "uint8_t" : sizeof(type) == 2u ? "uint16_t" : sizeof(type) == 4u ? "uint32_t" : "uint64_t");
+      const char *function_name = function == ROUNDING_POLICY_SHIFTROUND ? "shiftround" : function == ROUNDING_POLICY_MULTSHIFTROUND ? "multshiftround" : "divround";
+      std::snprintf(text, sizeof(text), "%s<%s, %s>", function_name, type_name, rounding::name());
+    }
+  };
+  static const name_text name;
+  return name.text;
+}
+#endif
+
+#ifdef DEBUG_INTMATH
+/* Prints value into text as a signed or unsigned decimal and returns text. */
+template <typename type> const char *rounding_policy_text(const type value, char (&text)[24]) {
+  if (std::is_signed<type>::value) std::snprintf(text, sizeof(text), "%" PRIi64, static_cast<int64_t>(value));
+  else std::snprintf(text, sizeof(text), "%" PRIu64, static_cast<uint64_t>(value));
+  return text;
+}
+#endif
+
+#endif /* #ifndef ROUNDING_POLICY_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
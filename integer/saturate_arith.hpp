@@ -0,0 +1,426 @@
+/**
+ * saturate_arith.hpp
+ * Specifies the templated functions
+ *   type saturate_add<typename type>(const type a, const type b);
+ *   type saturate_sub<typename type>(const type a, const type b);
+ *   type saturate_mul<typename type>(const type a, const type b);
+ *   type saturate_neg<typename type>(const type a);
+ *   type saturate_abs<typename type>(const type a);
+ * which return a + b, a - b, a * b, -a, and |a| clamped to the range of
+ * type instead of wrapping around.
+ *
+ * type may be int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
+ * uint64_t, or any type equivalent to these. For unsigned types
+ * saturate_neg always returns 0 and saturate_abs returns a.
+ *
+ * The arithmetic is the same as in saturate_arith.c; see there for how
+ * overflow is detected.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef SATURATE_ARITH_HPP_
+#define SATURATE_ARITH_HPP_
+
+#include <cinttypes>
+#include "wide_product.h"
+
+/* Allows static_assert message in the saturate_arith primary templates to compile. */
+template <typename type> static bool always_false_saturate_arith(void) { return false; }
+
+/**
+ * These primary templates are catch-alls for presently unimplemented
+ * template arguments.
+ */
+template <typename type> type saturate_add(const type a, const type b) {
+  static_assert(always_false_saturate_arith<type>(), "type saturate_add(const type a, const type b); is not defined for the specified type.");
+  return a;
+}
+
+template <typename type> type saturate_sub(const type a, const type b) {
+  static_assert(always_false_saturate_arith<type>(), "type saturate_sub(const type a, const type b); is not defined for the specified type.");
+  return a;
+}
+
+template <typename type> type saturate_mul(const type a, const type b) {
+  static_assert(always_false_saturate_arith<type>(), "type saturate_mul(const type a, const type b); is not defined for the specified type.");
+  return a;
+}
+
+template <typename type> type saturate_neg(const type a) {
+  static_assert(always_false_saturate_arith<type>(), "type saturate_neg(const type a); is not defined for the specified type.");
+  return a;
+}
+
+template <typename type> type saturate_abs(const type a) {
+  static_assert(always_false_saturate_arith<type>(), "type saturate_abs(const type a); is not defined for the specified type.");
+  return a;
+}
+
+/********************************************************************************
+ ********           int8_t and uint8_t template specializations          ********
+ ********************************************************************************/
+
+template <> inline int8_t saturate_add<int8_t>(const int8_t a, const int8_t b) {
+  int32_t sum = static_cast<int32_t>(a) + static_cast<int32_t>(b);
+  if (sum > static_cast<int32_t>(INT8_MAX)) sum = static_cast<int32_t>(INT8_MAX);
+  if (sum < static_cast<int32_t>(INT8_MIN)) sum = static_cast<int32_t>(INT8_MIN);
+  return static_cast<int8_t>(sum);
+}
+
+template <> inline int8_t saturate_sub<int8_t>(const int8_t a, const int8_t b) {
+  int32_t difference = static_cast<int32_t>(a) - static_cast<int32_t>(b);
+  if (difference > static_cast<int32_t>(INT8_MAX)) difference = static_cast<int32_t>(INT8_MAX);
+  if (difference < static_cast<int32_t>(INT8_MIN)) difference = static_cast<int32_t>(INT8_MIN);
+  return static_cast<int8_t>(difference);
+}
+
+template <> inline int8_t saturate_mul<int8_t>(const int8_t a, const int8_t b) {
+  const int32_t product = static_cast<int32_t>(a) * static_cast<int32_t>(b);
+  if (product > static_cast<int32_t>(INT8_MAX)) return static_cast<int8_t>(INT8_MAX);
+  if (product < static_cast<int32_t>(INT8_MIN)) return static_cast<int8_t>(INT8_MIN);
+  return static_cast<int8_t>(product);
+}
+
+template <> inline int8_t saturate_neg<int8_t>(const int8_t a) {
+  return static_cast<int8_t>(0u - static_cast<uint8_t>(a) - static_cast<uint8_t>(a == INT8_MIN));
+}
+
+template <> inline int8_t saturate_abs<int8_t>(const int8_t a) {
+  const uint8_t sign = static_cast<uint8_t>(0u - (a < static_cast<int8_t>(0)));
+  const uint8_t magnitude = static_cast<uint8_t>((static_cast<uint8_t>(a) ^ sign) - sign);
+  return static_cast<int8_t>(magnitude - (magnitude >> 7));
+}
+
+template <> inline uint8_t saturate_add<uint8_t>(const uint8_t a, const uint8_t b) {
+  const uint8_t sum = static_cast<uint8_t>(a + b);
+  return static_cast<uint8_t>(sum | static_cast<uint8_t>(0u - (sum < a)));
+}
+
+template <> inline uint8_t saturate_sub<uint8_t>(const uint8_t a, const uint8_t b) {
+  const uint8_t difference = static_cast<uint8_t>(a - b);
+  return static_cast<uint8_t>(difference & static_cast<uint8_t>(0u - (difference <= a)));
+}
+
+template <> inline uint8_t saturate_mul<uint8_t>(const uint8_t a, const uint8_t b) {
+  const uint32_t product = static_cast<uint32_t>(a) * static_cast<uint32_t>(b);
+  if (product > static_cast<uint32_t>(UINT8_MAX)) return static_cast<uint8_t>(UINT8_MAX);
+  return static_cast<uint8_t>(product);
+}
+
+template <> inline uint8_t saturate_neg<uint8_t>(const uint8_t a) {
+  static_cast<void>(a);
+  return static_cast<uint8_t>(0);
+}
+
+template <> inline uint8_t saturate_abs<uint8_t>(const uint8_t a) {
+  return a;
+}
+
+/********************************************************************************
+ ********          int16_t and uint16_t template specializations         ********
+ ********************************************************************************/
+
+template <> inline int16_t saturate_add<int16_t>(const int16_t a, const int16_t b) {
+  int32_t sum = static_cast<int32_t>(a) + static_cast<int32_t>(b);
+  if (sum > static_cast<int32_t>(INT16_MAX)) sum = static_cast<int32_t>(INT16_MAX);
+  if (sum < static_cast<int32_t>(INT16_MIN)) sum = static_cast<int32_t>(INT16_MIN);
+  return static_cast<int16_t>(sum);
+}
+
+template <> inline int16_t saturate_sub<int16_t>(const int16_t a, const int16_t b) {
+  int32_t difference = static_cast<int32_t>(a) - static_cast<int32_t>(b);
+  if (difference > static_cast<int32_t>(INT16_MAX)) difference = static_cast<int32_t>(INT16_MAX);
+  if (difference < static_cast<int32_t>(INT16_MIN)) difference = static_cast<int32_t>(INT16_MIN);
+  return static_cast<int16_t>(difference);
+}
+
+template <> inline int16_t saturate_mul<int16_t>(const int16_t a, const int16_t b) {
+  const int32_t product = static_cast<int32_t>(a) * static_cast<int32_t>(b);
+  if (product > static_cast<int32_t>(INT16_MAX)) return static_cast<int16_t>(INT16_MAX);
+  if (product < static_cast<int32_t>(INT16_MIN)) return static_cast<int16_t>(INT16_MIN);
+  return static_cast<int16_t>(product);
+}
+
+template <> inline int16_t saturate_neg<int16_t>(const int16_t a) {
+  return static_cast<int16_t>(0u - static_cast<uint16_t>(a) - static_cast<uint16_t>(a == INT16_MIN));
+}
+
+template <> inline int16_t saturate_abs<int16_t>(const int16_t a) {
+  const uint16_t sign = static_cast<uint16_t>(0u - (a < static_cast<int16_t>(0)));
+  const uint16_t magnitude = static_cast<uint16_t>((static_cast<uint16_t>(a) ^ sign) - sign);
+  return static_cast<int16_t>(magnitude - (magnitude >> 15));
+}
+
+template <> inline uint16_t saturate_add<uint16_t>(const uint16_t a, const uint16_t b) {
+  const uint16_t sum = static_cast<uint16_t>(a + b);
+  return static_cast<uint16_t>(sum | static_cast<uint16_t>(0u - (sum < a)));
+}
+
+template <> inline uint16_t saturate_sub<uint16_t>(const uint16_t a, const uint16_t b) {
+  const uint16_t difference = static_cast<uint16_t>(a - b);
+  return static_cast<uint16_t>(difference & static_cast<uint16_t>(0u - (difference <= a)));
+}
+
+template <> inline uint16_t saturate_mul<uint16_t>(const uint16_t a, const uint16_t b) {
+  const uint32_t product = static_cast<uint32_t>(a) * static_cast<uint32_t>(b);
+  if (product > static_cast<uint32_t>(UINT16_MAX)) return static_cast<uint16_t>(UINT16_MAX);
+  return static_cast<uint16_t>(product);
+}
+
+template <> inline uint16_t saturate_neg<uint16_t>(const uint16_t a) {
+  static_cast<void>(a);
+  return static_cast<uint16_t>(0);
+}
+
+template <> inline uint16_t saturate_abs<uint16_t>(const uint16_t a) {
+  return a;
+}
+
+/********************************************************************************
+ ********          int32_t and uint32_t template specializations         ********
+ ********************************************************************************/
+
+template <> inline int32_t saturate_add<int32_t>(const int32_t a, const int32_t b) {
+  int64_t sum = static_cast<int64_t>(a) + static_cast<int64_t>(b);
+  if (sum > static_cast<int64_t>(INT32_MAX)) sum = static_cast<int64_t>(INT32_MAX);
+  if (sum < static_cast<int64_t>(INT32_MIN)) sum = static_cast<int64_t>(INT32_MIN);
+  return static_cast<int32_t>(sum);
+}
+
+template <> inline int32_t saturate_sub<int32_t>(const int32_t a, const int32_t b) {
+  int64_t difference = static_cast<int64_t>(a) - static_cast<int64_t>(b);
+  if (difference > static_cast<int64_t>(INT32_MAX)) difference = static_cast<int64_t>(INT32_MAX);
+  if (difference < static_cast<int64_t>(INT32_MIN)) difference = static_cast<int64_t>(INT32_MIN);
+  return static_cast<int32_t>(difference);
+}
+
+template <> inline int32_t saturate_mul<int32_t>(const int32_t a, const int32_t b) {
+  const int64_t product = static_cast<int64_t>(a) * static_cast<int64_t>(b);
+  if (product > static_cast<int64_t>(INT32_MAX)) return INT32_MAX;
+  if (product < static_cast<int64_t>(INT32_MIN)) return INT32_MIN;
+  return static_cast<int32_t>(product);
+}
+
+template <> inline int32_t saturate_neg<int32_t>(const int32_t a) {
+  return static_cast<int32_t>(0u - static_cast<uint32_t>(a) - static_cast<uint32_t>(a == INT32_MIN));
+}
+
+template <> inline int32_t saturate_abs<int32_t>(const int32_t a) {
+  const uint32_t sign = static_cast<uint32_t>(0u - (a < 0));
+  const uint32_t magnitude = static_cast<uint32_t>((static_cast<uint32_t>(a) ^ sign) - sign);
+  return static_cast<int32_t>(magnitude - (magnitude >> 31));
+}
+
+template <> inline uint32_t saturate_add<uint32_t>(const uint32_t a, const uint32_t b) {
+  const uint32_t sum = static_cast<uint32_t>(a + b);
+  return static_cast<uint32_t>(sum | static_cast<uint32_t>(0u - (sum < a)));
+}
+
+template <> inline uint32_t saturate_sub<uint32_t>(const uint32_t a, const uint32_t b) {
+  const uint32_t difference = static_cast<uint32_t>(a - b);
+  return static_cast<uint32_t>(difference & static_cast<uint32_t>(0u - (difference <= a)));
+}
+
+template <> inline uint32_t saturate_mul<uint32_t>(const uint32_t a, const uint32_t b) {
+  const uint64_t product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+  if (product > static_cast<uint64_t>(UINT32_MAX)) return UINT32_MAX;
+  return static_cast<uint32_t>(product);
+}
+
+template <> inline uint32_t saturate_neg<uint32_t>(const uint32_t a) {
+  static_cast<void>(a);
+  return 0u;
+}
+
+template <> inline uint32_t saturate_abs<uint32_t>(const uint32_t a) {
+  return a;
+}
+
+/********************************************************************************
+ ********          int64_t and uint64_t template specializations         ********
+ ********************************************************************************/
+
+template <> inline int64_t saturate_add<int64_t>(const int64_t a, const int64_t b) {
+  const uint64_t sum = static_cast<uint64_t>(a) + static_cast<uint64_t>(b);
+  if (static_cast<int64_t>((sum ^ static_cast<uint64_t>(a)) & (sum ^ static_cast<uint64_t>(b))) < 0ll) return static_cast<int64_t>((static_cast<uint64_t>(a) >> 63) + static_cast<uint64_t>(INT64_MAX));
+  return static_cast<int64_t>(sum);
+}
+
+template <> inline int64_t saturate_sub<int64_t>(const int64_t a, const int64_t b) {
+  const uint64_t difference = static_cast<uint64_t>(a) - static_cast<uint64_t>(b);
+  if (static_cast<int64_t>((static_cast<uint64_t>(a) ^ static_cast<uint64_t>(b)) & (static_cast<uint64_t>(a) ^ difference)) < 0ll) return static_cast<int64_t>((static_cast<uint64_t>(a) >> 63) + static_cast<uint64_t>(INT64_MAX));
+  return static_cast<int64_t>(difference);
+}
+
+template <> inline int64_t saturate_mul<int64_t>(const int64_t a, const int64_t b) {
+  if (wide_mul_overflows_i64(a, b)) return ((a < 0ll) != (b < 0ll)) ? INT64_MIN : INT64_MAX;
+  return static_cast<int64_t>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+}
+
+template <> inline int64_t saturate_neg<int64_t>(const int64_t a) {
+  return static_cast<int64_t>(0ull - static_cast<uint64_t>(a) - static_cast<uint64_t>(a == INT64_MIN));
+}
+
+template <> inline int64_t saturate_abs<int64_t>(const int64_t a) {
+  const uint64_t sign = static_cast<uint64_t>(0ull - (a < 0ll));
+  const uint64_t magnitude = static_cast<uint64_t>((static_cast<uint64_t>(a) ^ sign) - sign);
+  return static_cast<int64_t>(magnitude - (magnitude >> 63));
+}
+
+template <> inline uint64_t saturate_add<uint64_t>(const uint64_t a, const uint64_t b) {
+  const uint64_t sum = static_cast<uint64_t>(a + b);
+  return static_cast<uint64_t>(sum | static_cast<uint64_t>(0ull - (sum < a)));
+}
+
+template <> inline uint64_t saturate_sub<uint64_t>(const uint64_t a, const uint64_t b) {
+  const uint64_t difference = static_cast<uint64_t>(a - b);
+  return static_cast<uint64_t>(difference & static_cast<uint64_t>(0ull - (difference <= a)));
+}
+
+template <> inline uint64_t saturate_mul<uint64_t>(const uint64_t a, const uint64_t b) {
+  if (wide_mul_overflows_u64(a, b)) return UINT64_MAX;
+  return a * b;
+}
+
+template <> inline uint64_t saturate_neg<uint64_t>(const uint64_t a) {
+  static_cast<void>(a);
+  return 0ull;
+}
+
+template <> inline uint64_t saturate_abs<uint64_t>(const uint64_t a) {
+  return a;
+}
+
+#endif /* #ifndef SATURATE_ARITH_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
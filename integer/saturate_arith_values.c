@@ -0,0 +1,1245 @@
+/**
+ * saturate_arith_values.c
+ * Defines functions of the form
+ *   void saturate_add_values_X(type *values, const type *operands, const size_t length);
+ *   void saturate_sub_values_X(type *values, const type *operands, const size_t length);
+ *   void saturate_neg_values_X(type *values, const size_t length);
+ *   void saturate_abs_values_X(type *values, const size_t length);
+ * which replace every element of values[0..length-1] with
+ * values[j] + operands[j], values[j] - operands[j], -values[j], or
+ * |values[j]|, clamped to the range of the type. X is a type abbreviation.
+ * Accumulating a frame into a running sum, or mixing two channels, thus
+ * takes one pass with no widening.
+ *
+ * These functions are implemented for int8_t, int16_t, int32_t, int64_t,
+ * uint8_t, uint16_t, uint32_t, and uint64_t.
+ *
+ * The 8- and 16-bit functions hold SSE2, AVX2, and AVX-512 kernels built
+ * on the packed saturating instructions (paddsb, paddusw, psubsw, psubusb,
+ * and so on) and pick the widest one the processor supports at run time
+ * with cpu_features() from cpu_features.c, as saturate_values.c does. x86
+ * has no packed saturating instructions for 32- and 64-bit elements, so
+ * those types use branch-free scalar loops. Other targets always use the
+ * scalar loops.
+ *
+ * The results are identical to calling the functions in saturate_arith.c
+ * on each element. values and operands may be the same array, but must
+ * not otherwise overlap.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef SATURATE_ARITH_VALUES_C_
+#define SATURATE_ARITH_VALUES_C_
+
+#include "saturate_arith_values.h"
+#include "cpu_features.h"
+
+/**
+ * GCC and Clang only emit vector instructions in functions carrying the
+ * matching target attribute when the instruction set is not enabled on
+ * the command line. MSVC allows any intrinsic in any function.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define SATURATE_ARITH_VALUES_X86
+  #define SATURATE_ARITH_VALUES_TARGET_SSE2 __attribute__((target("sse2")))
+  #define SATURATE_ARITH_VALUES_TARGET_AVX2 __attribute__((target("avx2")))
+  #define SATURATE_ARITH_VALUES_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #define SATURATE_ARITH_VALUES_X86
+  #define SATURATE_ARITH_VALUES_TARGET_SSE2
+  #define SATURATE_ARITH_VALUES_TARGET_AVX2
+  #define SATURATE_ARITH_VALUES_TARGET_AVX512
+#endif
+
+#ifdef SATURATE_ARITH_VALUES_X86
+  #include "immintrin.h"
+#endif
+
+/********************************************************************************
+ ********                         scalar kernels                         ********
+ ********************************************************************************/
+
+/**
+ * These hold the logic of saturate_arith.c. The loops process the
+ * elements that do not fill a whole vector, are the whole implementation
+ * for the 32- and 64-bit types, and are the only code path on processors
+ * without SSE2 and on non-x86 targets. They are free of branches on the
+ * data, so the compiler may vectorize them.
+ */
+static inline int8_t saturate_add_values_i8_element(const int8_t a, const int8_t b) {
+  int32_t sum = (int32_t)a + (int32_t)b;
+  if (sum > (int32_t)INT8_MAX) sum = (int32_t)INT8_MAX;
+  if (sum < (int32_t)INT8_MIN) sum = (int32_t)INT8_MIN;
+  return (int8_t)sum;
+}
+
+static inline int8_t saturate_sub_values_i8_element(const int8_t a, const int8_t b) {
+  int32_t difference = (int32_t)a - (int32_t)b;
+  if (difference > (int32_t)INT8_MAX) difference = (int32_t)INT8_MAX;
+  if (difference < (int32_t)INT8_MIN) difference = (int32_t)INT8_MIN;
+  return (int8_t)difference;
+}
+
+static inline int8_t saturate_neg_values_i8_element(const int8_t a) {
+  return (int8_t)(0u - (uint8_t)a - (uint8_t)(a == INT8_MIN));
+}
+
+static inline int8_t saturate_abs_values_i8_element(const int8_t a) {
+  const uint8_t sign = (uint8_t)(0u - (a < (int8_t)0));
+  const uint8_t magnitude = (uint8_t)(((uint8_t)a ^ sign) - sign);
+  return (int8_t)(magnitude - (magnitude >> 7));
+}
+
+static inline uint8_t saturate_add_values_u8_element(const uint8_t a, const uint8_t b) {
+  const uint8_t sum = (uint8_t)(a + b);
+  return (uint8_t)(sum | (uint8_t)(0u - (sum < a)));
+}
+
+static inline uint8_t saturate_sub_values_u8_element(const uint8_t a, const uint8_t b) {
+  const uint8_t difference = (uint8_t)(a - b);
+  return (uint8_t)(difference & (uint8_t)(0u - (difference <= a)));
+}
+
+static inline int16_t saturate_add_values_i16_element(const int16_t a, const int16_t b) {
+  int32_t sum = (int32_t)a + (int32_t)b;
+  if (sum > (int32_t)INT16_MAX) sum = (int32_t)INT16_MAX;
+  if (sum < (int32_t)INT16_MIN) sum = (int32_t)INT16_MIN;
+  return (int16_t)sum;
+}
+
+static inline int16_t saturate_sub_values_i16_element(const int16_t a, const int16_t b) {
+  int32_t difference = (int32_t)a - (int32_t)b;
+  if (difference > (int32_t)INT16_MAX) difference = (int32_t)INT16_MAX;
+  if (difference < (int32_t)INT16_MIN) difference = (int32_t)INT16_MIN;
+  return (int16_t)difference;
+}
+
+static inline int16_t saturate_neg_values_i16_element(const int16_t a) {
+  return (int16_t)(0u - (uint16_t)a - (uint16_t)(a == INT16_MIN));
+}
+
+static inline int16_t saturate_abs_values_i16_element(const int16_t a) {
+  const uint16_t sign = (uint16_t)(0u - (a < (int16_t)0));
+  const uint16_t magnitude = (uint16_t)(((uint16_t)a ^ sign) - sign);
+  return (int16_t)(magnitude - (magnitude >> 15));
+}
+
+static inline uint16_t saturate_add_values_u16_element(const uint16_t a, const uint16_t b) {
+  const uint16_t sum = (uint16_t)(a + b);
+  return (uint16_t)(sum | (uint16_t)(0u - (sum < a)));
+}
+
+static inline uint16_t saturate_sub_values_u16_element(const uint16_t a, const uint16_t b) {
+  const uint16_t difference = (uint16_t)(a - b);
+  return (uint16_t)(difference & (uint16_t)(0u - (difference <= a)));
+}
+
+static inline int32_t saturate_add_values_i32_element(const int32_t a, const int32_t b) {
+  int64_t sum = (int64_t)a + (int64_t)b;
+  if (sum > (int64_t)INT32_MAX) sum = (int64_t)INT32_MAX;
+  if (sum < (int64_t)INT32_MIN) sum = (int64_t)INT32_MIN;
+  return (int32_t)sum;
+}
+
+static inline int32_t saturate_sub_values_i32_element(const int32_t a, const int32_t b) {
+  int64_t difference = (int64_t)a - (int64_t)b;
+  if (difference > (int64_t)INT32_MAX) difference = (int64_t)INT32_MAX;
+  if (difference < (int64_t)INT32_MIN) difference = (int64_t)INT32_MIN;
+  return (int32_t)difference;
+}
+
+static inline int32_t saturate_neg_values_i32_element(const int32_t a) {
+  return (int32_t)(0u - (uint32_t)a - (uint32_t)(a == INT32_MIN));
+}
+
+static inline int32_t saturate_abs_values_i32_element(const int32_t a) {
+  const uint32_t sign = (uint32_t)(0u - (a < 0));
+  const uint32_t magnitude = (uint32_t)(((uint32_t)a ^ sign) - sign);
+  return (int32_t)(magnitude - (magnitude >> 31));
+}
+
+static inline uint32_t saturate_add_values_u32_element(const uint32_t a, const uint32_t b) {
+  const uint32_t sum = (uint32_t)(a + b);
+  return (uint32_t)(sum | (uint32_t)(0u - (sum < a)));
+}
+
+static inline uint32_t saturate_sub_values_u32_element(const uint32_t a, const uint32_t b) {
+  const uint32_t difference = (uint32_t)(a - b);
+  return (uint32_t)(difference & (uint32_t)(0u - (difference <= a)));
+}
+
+static inline int64_t saturate_add_values_i64_element(const int64_t a, const int64_t b) {
+  const uint64_t sum = (uint64_t)a + (uint64_t)b;
+  if ((int64_t)((sum ^ (uint64_t)a) & (sum ^ (uint64_t)b)) < 0ll) return (int64_t)(((uint64_t)a >> 63) + (uint64_t)INT64_MAX);
+  return (int64_t)sum;
+}
+
+static inline int64_t saturate_sub_values_i64_element(const int64_t a, const int64_t b) {
+  const uint64_t difference = (uint64_t)a - (uint64_t)b;
+  if ((int64_t)(((uint64_t)a ^ (uint64_t)b) & ((uint64_t)a ^ difference)) < 0ll) return (int64_t)(((uint64_t)a >> 63) + (uint64_t)INT64_MAX);
+  return (int64_t)difference;
+}
+
+static inline int64_t saturate_neg_values_i64_element(const int64_t a) {
+  return (int64_t)(0ull - (uint64_t)a - (uint64_t)(a == INT64_MIN));
+}
+
+static inline int64_t saturate_abs_values_i64_element(const int64_t a) {
+  const uint64_t sign = (uint64_t)(0ull - (a < 0ll));
+  const uint64_t magnitude = (uint64_t)(((uint64_t)a ^ sign) - sign);
+  return (int64_t)(magnitude - (magnitude >> 63));
+}
+
+static inline uint64_t saturate_add_values_u64_element(const uint64_t a, const uint64_t b) {
+  const uint64_t sum = (uint64_t)(a + b);
+  return (uint64_t)(sum | (uint64_t)(0ull - (sum < a)));
+}
+
+static inline uint64_t saturate_sub_values_u64_element(const uint64_t a, const uint64_t b) {
+  const uint64_t difference = (uint64_t)(a - b);
+  return (uint64_t)(difference & (uint64_t)(0ull - (difference <= a)));
+}
+
+static inline void saturate_add_values_i8_scalar(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_i8_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_i8_scalar(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_i8_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_i8_scalar(int8_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_neg_values_i8_element(values[j]);
+}
+
+static inline void saturate_abs_values_i8_scalar(int8_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_abs_values_i8_element(values[j]);
+}
+
+static inline void saturate_add_values_u8_scalar(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_u8_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_u8_scalar(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_u8_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_u8_scalar(uint8_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = (uint8_t)0;
+}
+
+static inline void saturate_abs_values_u8_scalar(uint8_t *values, const size_t length) {
+  (void)values;
+  (void)length;
+}
+
+static inline void saturate_add_values_i16_scalar(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_i16_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_i16_scalar(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_i16_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_i16_scalar(int16_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_neg_values_i16_element(values[j]);
+}
+
+static inline void saturate_abs_values_i16_scalar(int16_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_abs_values_i16_element(values[j]);
+}
+
+static inline void saturate_add_values_u16_scalar(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_u16_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_u16_scalar(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_u16_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_u16_scalar(uint16_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = (uint16_t)0;
+}
+
+static inline void saturate_abs_values_u16_scalar(uint16_t *values, const size_t length) {
+  (void)values;
+  (void)length;
+}
+
+static inline void saturate_add_values_i32_scalar(int32_t *values, const int32_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_i32_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_i32_scalar(int32_t *values, const int32_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_i32_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_i32_scalar(int32_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_neg_values_i32_element(values[j]);
+}
+
+static inline void saturate_abs_values_i32_scalar(int32_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_abs_values_i32_element(values[j]);
+}
+
+static inline void saturate_add_values_u32_scalar(uint32_t *values, const uint32_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_u32_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_u32_scalar(uint32_t *values, const uint32_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_u32_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_u32_scalar(uint32_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = 0u;
+}
+
+static inline void saturate_abs_values_u32_scalar(uint32_t *values, const size_t length) {
+  (void)values;
+  (void)length;
+}
+
+static inline void saturate_add_values_i64_scalar(int64_t *values, const int64_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_i64_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_i64_scalar(int64_t *values, const int64_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_i64_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_i64_scalar(int64_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_neg_values_i64_element(values[j]);
+}
+
+static inline void saturate_abs_values_i64_scalar(int64_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_abs_values_i64_element(values[j]);
+}
+
+static inline void saturate_add_values_u64_scalar(uint64_t *values, const uint64_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_add_values_u64_element(values[j], operands[j]);
+}
+
+static inline void saturate_sub_values_u64_scalar(uint64_t *values, const uint64_t *operands, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = saturate_sub_values_u64_element(values[j], operands[j]);
+}
+
+static inline void saturate_neg_values_u64_scalar(uint64_t *values, const size_t length) {
+  size_t j;
+  for (j = 0u; j < length; j++) values[j] = 0ull;
+}
+
+static inline void saturate_abs_values_u64_scalar(uint64_t *values, const size_t length) {
+  (void)values;
+  (void)length;
+}
+
+#ifdef SATURATE_ARITH_VALUES_X86
+
+/********************************************************************************
+ ********                          SSE2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * SSE2 has packed saturating add and subtract for the 8- and 16-bit
+ * types: paddsb, paddusb, paddsw, paddusw, and the matching psubs and
+ * psubus forms. Negation is a saturating subtract from zero. |a| is the
+ * larger of a and its saturated negation; SSE2 lacks pmaxsb, so int8_t
+ * selects with pcmpgtb instead.
+ */
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_add_values_i8_sse2(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_adds_epi8(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_add_values_i8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_sub_values_i8_sse2(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_subs_epi8(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_sub_values_i8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_neg_values_i8_sse2(int8_t *values, const size_t length) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_subs_epi8(zero, v);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_neg_values_i8_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_abs_values_i8_sse2(int8_t *values, const size_t length) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i negative = _mm_cmpgt_epi8(zero, v);
+    v = _mm_or_si128(_mm_and_si128(negative, _mm_subs_epi8(zero, v)), _mm_andnot_si128(negative, v));
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_abs_values_i8_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_add_values_u8_sse2(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_adds_epu8(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_add_values_u8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_sub_values_u8_sse2(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_subs_epu8(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_sub_values_u8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_add_values_i16_sse2(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_adds_epi16(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_add_values_i16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_sub_values_i16_sse2(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_subs_epi16(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_sub_values_i16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_neg_values_i16_sse2(int16_t *values, const size_t length) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_subs_epi16(zero, v);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_neg_values_i16_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_abs_values_i16_sse2(int16_t *values, const size_t length) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_max_epi16(v, _mm_subs_epi16(zero, v));
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_abs_values_i16_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_add_values_u16_sse2(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_adds_epu16(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_add_values_u16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_SSE2 static inline void saturate_sub_values_u16_sse2(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    const __m128i w = _mm_loadu_si128((const __m128i *)(operands + j));
+    v = _mm_subs_epu16(v, w);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_sub_values_u16_scalar(values + j, operands + j, length - j);
+}
+
+/********************************************************************************
+ ********                          AVX2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * AVX2 widens the same instructions to 256 bits and adds vpmaxsb.
+ */
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_add_values_i8_avx2(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_adds_epi8(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_add_values_i8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_sub_values_i8_avx2(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_subs_epi8(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_sub_values_i8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_neg_values_i8_avx2(int8_t *values, const size_t length) {
+  const __m256i zero = _mm256_setzero_si256();
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_subs_epi8(zero, v);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_neg_values_i8_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_abs_values_i8_avx2(int8_t *values, const size_t length) {
+  const __m256i zero = _mm256_setzero_si256();
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_max_epi8(v, _mm256_subs_epi8(zero, v));
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_abs_values_i8_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_add_values_u8_avx2(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_adds_epu8(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_add_values_u8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_sub_values_u8_avx2(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_subs_epu8(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_sub_values_u8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_add_values_i16_avx2(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_adds_epi16(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_add_values_i16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_sub_values_i16_avx2(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_subs_epi16(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_sub_values_i16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_neg_values_i16_avx2(int16_t *values, const size_t length) {
+  const __m256i zero = _mm256_setzero_si256();
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_subs_epi16(zero, v);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_neg_values_i16_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_abs_values_i16_avx2(int16_t *values, const size_t length) {
+  const __m256i zero = _mm256_setzero_si256();
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_max_epi16(v, _mm256_subs_epi16(zero, v));
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_abs_values_i16_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_add_values_u16_avx2(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_adds_epu16(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_add_values_u16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX2 static inline void saturate_sub_values_u16_avx2(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(operands + j));
+    v = _mm256_subs_epu16(v, w);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_sub_values_u16_scalar(values + j, operands + j, length - j);
+}
+
+/********************************************************************************
+ ********                         AVX-512 kernels                        ********
+ ********************************************************************************/
+
+/**
+ * AVX-512 BW widens the same instructions to 512 bits.
+ */
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_add_values_i8_avx512(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_adds_epi8(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_add_values_i8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_sub_values_i8_avx512(int8_t *values, const int8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_subs_epi8(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_sub_values_i8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_neg_values_i8_avx512(int8_t *values, const size_t length) {
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_subs_epi8(zero, v);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_neg_values_i8_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_abs_values_i8_avx512(int8_t *values, const size_t length) {
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_max_epi8(v, _mm512_subs_epi8(zero, v));
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_abs_values_i8_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_add_values_u8_avx512(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_adds_epu8(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_add_values_u8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_sub_values_u8_avx512(uint8_t *values, const uint8_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_subs_epu8(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_sub_values_u8_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_add_values_i16_avx512(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_adds_epi16(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_add_values_i16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_sub_values_i16_avx512(int16_t *values, const int16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_subs_epi16(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_sub_values_i16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_neg_values_i16_avx512(int16_t *values, const size_t length) {
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_subs_epi16(zero, v);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_neg_values_i16_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_abs_values_i16_avx512(int16_t *values, const size_t length) {
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_max_epi16(v, _mm512_subs_epi16(zero, v));
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_abs_values_i16_scalar(values + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_add_values_u16_avx512(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_adds_epu16(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_add_values_u16_scalar(values + j, operands + j, length - j);
+}
+
+SATURATE_ARITH_VALUES_TARGET_AVX512 static inline void saturate_sub_values_u16_avx512(uint16_t *values, const uint16_t *operands, const size_t length) {
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    const __m512i w = _mm512_loadu_si512((const void *)(operands + j));
+    v = _mm512_subs_epu16(v, w);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_sub_values_u16_scalar(values + j, operands + j, length - j);
+}
+
+#endif /* #ifdef SATURATE_ARITH_VALUES_X86 */
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_add_values_i8(int8_t *values, const int8_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_add_values_i8_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_add_values_i8_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_add_values_i8_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_add_values_i8_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_i8(int8_t *values, const int8_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_sub_values_i8_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_sub_values_i8_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_sub_values_i8_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_sub_values_i8_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_i8(int8_t *values, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_neg_values_i8_avx512(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_neg_values_i8_avx2(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_neg_values_i8_sse2(values, length);
+      return;
+    }
+  #endif
+  saturate_neg_values_i8_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_i8(int8_t *values, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_abs_values_i8_avx512(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_abs_values_i8_avx2(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_abs_values_i8_sse2(values, length);
+      return;
+    }
+  #endif
+  saturate_abs_values_i8_scalar(values, length);
+}
+
+INTMATH_API void saturate_add_values_u8(uint8_t *values, const uint8_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_add_values_u8_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_add_values_u8_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_add_values_u8_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_add_values_u8_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_u8(uint8_t *values, const uint8_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_sub_values_u8_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_sub_values_u8_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_sub_values_u8_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_sub_values_u8_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_u8(uint8_t *values, const size_t length) {
+  saturate_neg_values_u8_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_u8(uint8_t *values, const size_t length) {
+  saturate_abs_values_u8_scalar(values, length);
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_add_values_i16(int16_t *values, const int16_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_add_values_i16_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_add_values_i16_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_add_values_i16_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_add_values_i16_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_i16(int16_t *values, const int16_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_sub_values_i16_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_sub_values_i16_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_sub_values_i16_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_sub_values_i16_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_i16(int16_t *values, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_neg_values_i16_avx512(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_neg_values_i16_avx2(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_neg_values_i16_sse2(values, length);
+      return;
+    }
+  #endif
+  saturate_neg_values_i16_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_i16(int16_t *values, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_abs_values_i16_avx512(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_abs_values_i16_avx2(values, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_abs_values_i16_sse2(values, length);
+      return;
+    }
+  #endif
+  saturate_abs_values_i16_scalar(values, length);
+}
+
+INTMATH_API void saturate_add_values_u16(uint16_t *values, const uint16_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_add_values_u16_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_add_values_u16_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_add_values_u16_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_add_values_u16_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_u16(uint16_t *values, const uint16_t *operands, const size_t length) {
+  #ifdef SATURATE_ARITH_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_sub_values_u16_avx512(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_sub_values_u16_avx2(values, operands, length);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_sub_values_u16_sse2(values, operands, length);
+      return;
+    }
+  #endif
+  saturate_sub_values_u16_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_u16(uint16_t *values, const size_t length) {
+  saturate_neg_values_u16_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_u16(uint16_t *values, const size_t length) {
+  saturate_abs_values_u16_scalar(values, length);
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_add_values_i32(int32_t *values, const int32_t *operands, const size_t length) {
+  saturate_add_values_i32_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_i32(int32_t *values, const int32_t *operands, const size_t length) {
+  saturate_sub_values_i32_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_i32(int32_t *values, const size_t length) {
+  saturate_neg_values_i32_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_i32(int32_t *values, const size_t length) {
+  saturate_abs_values_i32_scalar(values, length);
+}
+
+INTMATH_API void saturate_add_values_u32(uint32_t *values, const uint32_t *operands, const size_t length) {
+  saturate_add_values_u32_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_u32(uint32_t *values, const uint32_t *operands, const size_t length) {
+  saturate_sub_values_u32_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_u32(uint32_t *values, const size_t length) {
+  saturate_neg_values_u32_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_u32(uint32_t *values, const size_t length) {
+  saturate_abs_values_u32_scalar(values, length);
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_add_values_i64(int64_t *values, const int64_t *operands, const size_t length) {
+  saturate_add_values_i64_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_i64(int64_t *values, const int64_t *operands, const size_t length) {
+  saturate_sub_values_i64_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_i64(int64_t *values, const size_t length) {
+  saturate_neg_values_i64_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_i64(int64_t *values, const size_t length) {
+  saturate_abs_values_i64_scalar(values, length);
+}
+
+INTMATH_API void saturate_add_values_u64(uint64_t *values, const uint64_t *operands, const size_t length) {
+  saturate_add_values_u64_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_sub_values_u64(uint64_t *values, const uint64_t *operands, const size_t length) {
+  saturate_sub_values_u64_scalar(values, operands, length);
+}
+
+INTMATH_API void saturate_neg_values_u64(uint64_t *values, const size_t length) {
+  saturate_neg_values_u64_scalar(values, length);
+}
+
+INTMATH_API void saturate_abs_values_u64(uint64_t *values, const size_t length) {
+  saturate_abs_values_u64_scalar(values, length);
+}
+
+#endif /* #ifndef SATURATE_ARITH_VALUES_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -24,34 +24,39 @@
 #define SATURATE_VALUE_H_
 
 #include "inttypes.h"
+#include "intmath_inline.h"
 
 /********************************************************************************
  ********                  int8_t and uint8_t functions                  ********
  ********************************************************************************/
 
-void saturate_value_i8(int8_t *value, const int8_t lower_bound, const int8_t upper_bound);
-void saturate_value_u8(uint8_t *value, const uint8_t lower_bound, const uint8_t upper_bound);
+INTMATH_API void saturate_value_i8(int8_t *value, const int8_t lower_bound, const int8_t upper_bound);
+INTMATH_API void saturate_value_u8(uint8_t *value, const uint8_t lower_bound, const uint8_t upper_bound);
 
 /********************************************************************************
  ********                 int16_t and uint16_t functions                 ********
  ********************************************************************************/
 
-void saturate_value_i16(int16_t *value, const int16_t lower_bound, const int16_t upper_bound);
-void saturate_value_u16(uint16_t *value, const uint16_t lower_bound, const uint16_t upper_bound);
+INTMATH_API void saturate_value_i16(int16_t *value, const int16_t lower_bound, const int16_t upper_bound);
+INTMATH_API void saturate_value_u16(uint16_t *value, const uint16_t lower_bound, const uint16_t upper_bound);
 
 /********************************************************************************
  ********                 int32_t and uint32_t functions                 ********
  ********************************************************************************/
 
-void saturate_value_i32(int32_t *value, const int32_t lower_bound, const int32_t upper_bound);
-void saturate_value_u32(uint32_t *value, const uint32_t lower_bound, const uint32_t upper_bound);
+INTMATH_API void saturate_value_i32(int32_t *value, const int32_t lower_bound, const int32_t upper_bound);
+INTMATH_API void saturate_value_u32(uint32_t *value, const uint32_t lower_bound, const uint32_t upper_bound);
 
 /********************************************************************************
  ********                 int64_t and uint64_t functions                 ********
  ********************************************************************************/
 
-void saturate_value_i64(int64_t *value, const int64_t lower_bound, const int64_t upper_bound);
-void saturate_value_u64(uint64_t *value, const uint64_t lower_bound, const uint64_t upper_bound);
+INTMATH_API void saturate_value_i64(int64_t *value, const int64_t lower_bound, const int64_t upper_bound);
+INTMATH_API void saturate_value_u64(uint64_t *value, const uint64_t lower_bound, const uint64_t upper_bound);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "saturate_value.c"
+#endif
 
 #endif /* #ifndef SATURATE_VALUE_H_ */
 
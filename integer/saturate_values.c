@@ -0,0 +1,804 @@
+/**
+ * saturate_values.c
+ * Defines functions of the form
+ *   void saturate_values_X(type *values, const size_t length, const type lower_bound, const type upper_bound);
+ * which modify every element of values[0..length-1] (if necessary) so that
+ * it lies on the range [lower_bound, upper_bound]. X is a type abbreviation.
+ *
+ * These functions are implemented for int8_t, int16_t, int32_t, int64_t,
+ * uint8_t, uint16_t, uint32_t, and uint64_t.
+ *
+ * Each function holds SSE2, SSE4.1, AVX2, and AVX-512 kernels built on
+ * the packed min and max instructions (pminsb, pminuw, pminsd, vpminsq,
+ * and so on) and picks the widest one the processor supports at run
+ * time with cpu_features() from cpu_features.c. The file therefore needs
+ * no instruction set flags on the compiler command line, and the
+ * resulting executable runs on any x86 processor. Where an instruction
+ * set lacks a min or max instruction for a type, the kernel builds one
+ * from signed compares and a sign-bit bias. 64-bit types fall back to
+ * the scalar loop below AVX2. Other targets always use the scalar loop.
+ *
+ * The results are identical to calling saturate_value_X from
+ * saturate_value.c on each element, including when lower_bound is
+ * greater than upper_bound (every element then becomes upper_bound).
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#ifndef SATURATE_VALUES_C_
+#define SATURATE_VALUES_C_
+
+#include "saturate_values.h"
+#include "cpu_features.h"
+
+/**
+ * GCC and Clang only emit vector instructions in functions carrying the
+ * matching target attribute when the instruction set is not enabled on
+ * the command line. MSVC allows any intrinsic in any function.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define SATURATE_VALUES_X86
+  #define SATURATE_VALUES_TARGET_SSE2 __attribute__((target("sse2")))
+  #define SATURATE_VALUES_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+  #define SATURATE_VALUES_TARGET_AVX2 __attribute__((target("avx2")))
+  #define SATURATE_VALUES_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #define SATURATE_VALUES_X86
+  #define SATURATE_VALUES_TARGET_SSE2
+  #define SATURATE_VALUES_TARGET_SSE4_1
+  #define SATURATE_VALUES_TARGET_AVX2
+  #define SATURATE_VALUES_TARGET_AVX512
+#endif
+
+#ifdef SATURATE_VALUES_X86
+  #include "immintrin.h"
+#endif
+
+/********************************************************************************
+ ********                         scalar kernels                         ********
+ ********************************************************************************/
+
+/**
+ * These loops hold the logic of saturate_value.c. They process the
+ * elements that do not fill a whole vector and are the whole
+ * implementation on processors without SSE2 and on non-x86 targets.
+ */
+static inline void saturate_values_i8_scalar(int8_t *values, const size_t length, const int8_t lower_bound, const int8_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_u8_scalar(uint8_t *values, const size_t length, const uint8_t lower_bound, const uint8_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_i16_scalar(int16_t *values, const size_t length, const int16_t lower_bound, const int16_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_u16_scalar(uint16_t *values, const size_t length, const uint16_t lower_bound, const uint16_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_i32_scalar(int32_t *values, const size_t length, const int32_t lower_bound, const int32_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_u32_scalar(uint32_t *values, const size_t length, const uint32_t lower_bound, const uint32_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_i64_scalar(int64_t *values, const size_t length, const int64_t lower_bound, const int64_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+static inline void saturate_values_u64_scalar(uint64_t *values, const size_t length, const uint64_t lower_bound, const uint64_t upper_bound) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    if (values[j] < lower_bound) values[j] = lower_bound;
+    if (values[j] > upper_bound) values[j] = upper_bound;
+  }
+}
+
+#ifdef SATURATE_VALUES_X86
+
+/********************************************************************************
+ ********                          SSE2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * SSE2 only has pminub/pmaxub and pminsw/pmaxsw. int8_t and uint16_t
+ * flip the sign bit to reuse those, and the 32-bit types select between
+ * the value and the bound with pcmpgtd. SSE2 has no 64-bit compare, so
+ * the 64-bit types have no SSE2 kernel.
+ */
+SATURATE_VALUES_TARGET_SSE2 static inline void saturate_values_i8_sse2(int8_t *values, const size_t length, const int8_t lower_bound, const int8_t upper_bound) {
+  const __m128i bias = _mm_set1_epi8((int8_t)0x80u);
+  const __m128i lower = _mm_xor_si128(_mm_set1_epi8((int8_t)lower_bound), bias);
+  const __m128i upper = _mm_xor_si128(_mm_set1_epi8((int8_t)upper_bound), bias);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(values + j)), bias);
+    v = _mm_min_epu8(_mm_max_epu8(v, lower), upper);
+    v = _mm_xor_si128(v, bias);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_i8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE2 static inline void saturate_values_u8_sse2(uint8_t *values, const size_t length, const uint8_t lower_bound, const uint8_t upper_bound) {
+  const __m128i lower = _mm_set1_epi8((int8_t)lower_bound);
+  const __m128i upper = _mm_set1_epi8((int8_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_min_epu8(_mm_max_epu8(v, lower), upper);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_u8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE2 static inline void saturate_values_i16_sse2(int16_t *values, const size_t length, const int16_t lower_bound, const int16_t upper_bound) {
+  const __m128i lower = _mm_set1_epi16((int16_t)lower_bound);
+  const __m128i upper = _mm_set1_epi16((int16_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_min_epi16(_mm_max_epi16(v, lower), upper);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_i16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE2 static inline void saturate_values_u16_sse2(uint16_t *values, const size_t length, const uint16_t lower_bound, const uint16_t upper_bound) {
+  const __m128i bias = _mm_set1_epi16((int16_t)0x8000u);
+  const __m128i lower = _mm_xor_si128(_mm_set1_epi16((int16_t)lower_bound), bias);
+  const __m128i upper = _mm_xor_si128(_mm_set1_epi16((int16_t)upper_bound), bias);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(values + j)), bias);
+    v = _mm_min_epi16(_mm_max_epi16(v, lower), upper);
+    v = _mm_xor_si128(v, bias);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_u16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE2 static inline void saturate_values_i32_sse2(int32_t *values, const size_t length, const int32_t lower_bound, const int32_t upper_bound) {
+  const __m128i lower = _mm_set1_epi32((int32_t)lower_bound);
+  const __m128i upper = _mm_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 4u <= length; j += 4u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    __m128i select = _mm_cmpgt_epi32(lower, v);
+    v = _mm_or_si128(_mm_and_si128(select, lower), _mm_andnot_si128(select, v));
+    select = _mm_cmpgt_epi32(v, upper);
+    v = _mm_or_si128(_mm_and_si128(select, upper), _mm_andnot_si128(select, v));
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_i32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE2 static inline void saturate_values_u32_sse2(uint32_t *values, const size_t length, const uint32_t lower_bound, const uint32_t upper_bound) {
+  const __m128i bias = _mm_set1_epi32((int32_t)0x80000000u);
+  const __m128i lower = _mm_xor_si128(_mm_set1_epi32((int32_t)lower_bound), bias);
+  const __m128i upper = _mm_xor_si128(_mm_set1_epi32((int32_t)upper_bound), bias);
+  size_t j = 0u;
+  for (; j + 4u <= length; j += 4u) {
+    __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(values + j)), bias);
+    __m128i select = _mm_cmpgt_epi32(lower, v);
+    v = _mm_or_si128(_mm_and_si128(select, lower), _mm_andnot_si128(select, v));
+    select = _mm_cmpgt_epi32(v, upper);
+    v = _mm_or_si128(_mm_and_si128(select, upper), _mm_andnot_si128(select, v));
+    v = _mm_xor_si128(v, bias);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_u32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+/********************************************************************************
+ ********                         SSE4.1 kernels                         ********
+ ********************************************************************************/
+
+/**
+ * SSE4.1 adds pminsb, pminuw, pminsd, and pminud with their max
+ * counterparts. uint8_t and int16_t keep using their SSE2 kernels.
+ */
+SATURATE_VALUES_TARGET_SSE4_1 static inline void saturate_values_i8_sse4_1(int8_t *values, const size_t length, const int8_t lower_bound, const int8_t upper_bound) {
+  const __m128i lower = _mm_set1_epi8((int8_t)lower_bound);
+  const __m128i upper = _mm_set1_epi8((int8_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_min_epi8(_mm_max_epi8(v, lower), upper);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_i8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE4_1 static inline void saturate_values_u16_sse4_1(uint16_t *values, const size_t length, const uint16_t lower_bound, const uint16_t upper_bound) {
+  const __m128i lower = _mm_set1_epi16((int16_t)lower_bound);
+  const __m128i upper = _mm_set1_epi16((int16_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_min_epu16(_mm_max_epu16(v, lower), upper);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_u16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE4_1 static inline void saturate_values_i32_sse4_1(int32_t *values, const size_t length, const int32_t lower_bound, const int32_t upper_bound) {
+  const __m128i lower = _mm_set1_epi32((int32_t)lower_bound);
+  const __m128i upper = _mm_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 4u <= length; j += 4u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_min_epi32(_mm_max_epi32(v, lower), upper);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_i32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_SSE4_1 static inline void saturate_values_u32_sse4_1(uint32_t *values, const size_t length, const uint32_t lower_bound, const uint32_t upper_bound) {
+  const __m128i lower = _mm_set1_epi32((int32_t)lower_bound);
+  const __m128i upper = _mm_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 4u <= length; j += 4u) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(values + j));
+    v = _mm_min_epu32(_mm_max_epu32(v, lower), upper);
+    _mm_storeu_si128((__m128i *)(values + j), v);
+  }
+  saturate_values_u32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+/********************************************************************************
+ ********                          AVX2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * AVX2 has 256-bit min and max for every 8-, 16-, and 32-bit type. The
+ * 64-bit types select with vpcmpgtq and vpblendvb; uint64_t flips the
+ * sign bit first.
+ */
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_i8_avx2(int8_t *values, const size_t length, const int8_t lower_bound, const int8_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi8((int8_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi8((int8_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_min_epi8(_mm256_max_epi8(v, lower), upper);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_i8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_u8_avx2(uint8_t *values, const size_t length, const uint8_t lower_bound, const uint8_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi8((int8_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi8((int8_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_min_epu8(_mm256_max_epu8(v, lower), upper);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_u8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_i16_avx2(int16_t *values, const size_t length, const int16_t lower_bound, const int16_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi16((int16_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi16((int16_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_min_epi16(_mm256_max_epi16(v, lower), upper);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_i16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_u16_avx2(uint16_t *values, const size_t length, const uint16_t lower_bound, const uint16_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi16((int16_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi16((int16_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_min_epu16(_mm256_max_epu16(v, lower), upper);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_u16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_i32_avx2(int32_t *values, const size_t length, const int32_t lower_bound, const int32_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi32((int32_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_min_epi32(_mm256_max_epi32(v, lower), upper);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_i32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_u32_avx2(uint32_t *values, const size_t length, const uint32_t lower_bound, const uint32_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi32((int32_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_min_epu32(_mm256_max_epu32(v, lower), upper);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_u32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_i64_avx2(int64_t *values, const size_t length, const int64_t lower_bound, const int64_t upper_bound) {
+  const __m256i lower = _mm256_set1_epi64x((int64_t)lower_bound);
+  const __m256i upper = _mm256_set1_epi64x((int64_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 4u <= length; j += 4u) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(values + j));
+    v = _mm256_blendv_epi8(v, lower, _mm256_cmpgt_epi64(lower, v));
+    v = _mm256_blendv_epi8(v, upper, _mm256_cmpgt_epi64(v, upper));
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_i64_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX2 static inline void saturate_values_u64_avx2(uint64_t *values, const size_t length, const uint64_t lower_bound, const uint64_t upper_bound) {
+  const __m256i bias = _mm256_set1_epi64x((int64_t)0x8000000000000000ull);
+  const __m256i lower = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)lower_bound), bias);
+  const __m256i upper = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)upper_bound), bias);
+  size_t j = 0u;
+  for (; j + 4u <= length; j += 4u) {
+    __m256i v = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(values + j)), bias);
+    v = _mm256_blendv_epi8(v, lower, _mm256_cmpgt_epi64(lower, v));
+    v = _mm256_blendv_epi8(v, upper, _mm256_cmpgt_epi64(v, upper));
+    v = _mm256_xor_si256(v, bias);
+    _mm256_storeu_si256((__m256i *)(values + j), v);
+  }
+  saturate_values_u64_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+/********************************************************************************
+ ********                        AVX-512 kernels                         ********
+ ********************************************************************************/
+
+/**
+ * AVX-512 BW covers the 8- and 16-bit types and AVX-512 F covers the
+ * 32- and 64-bit types, including vpminsq and vpminuq.
+ */
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_i8_avx512(int8_t *values, const size_t length, const int8_t lower_bound, const int8_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi8((int8_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi8((int8_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epi8(_mm512_max_epi8(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_i8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_u8_avx512(uint8_t *values, const size_t length, const uint8_t lower_bound, const uint8_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi8((int8_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi8((int8_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 64u <= length; j += 64u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epu8(_mm512_max_epu8(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_u8_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_i16_avx512(int16_t *values, const size_t length, const int16_t lower_bound, const int16_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi16((int16_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi16((int16_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epi16(_mm512_max_epi16(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_i16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_u16_avx512(uint16_t *values, const size_t length, const uint16_t lower_bound, const uint16_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi16((int16_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi16((int16_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epu16(_mm512_max_epu16(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_u16_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_i32_avx512(int32_t *values, const size_t length, const int32_t lower_bound, const int32_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi32((int32_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epi32(_mm512_max_epi32(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_i32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_u32_avx512(uint32_t *values, const size_t length, const uint32_t lower_bound, const uint32_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi32((int32_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi32((int32_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epu32(_mm512_max_epu32(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_u32_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_i64_avx512(int64_t *values, const size_t length, const int64_t lower_bound, const int64_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi64((int64_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi64((int64_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epi64(_mm512_max_epi64(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_i64_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+SATURATE_VALUES_TARGET_AVX512 static inline void saturate_values_u64_avx512(uint64_t *values, const size_t length, const uint64_t lower_bound, const uint64_t upper_bound) {
+  const __m512i lower = _mm512_set1_epi64((int64_t)lower_bound);
+  const __m512i upper = _mm512_set1_epi64((int64_t)upper_bound);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    __m512i v = _mm512_loadu_si512((const void *)(values + j));
+    v = _mm512_min_epu64(_mm512_max_epu64(v, lower), upper);
+    _mm512_storeu_si512((void *)(values + j), v);
+  }
+  saturate_values_u64_scalar(values + j, length - j, lower_bound, upper_bound);
+}
+
+#endif /* #ifdef SATURATE_VALUES_X86 */
+
+/********************************************************************************
+ ********                  int8_t and uint8_t functions                  ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_values_i8(int8_t *values, const size_t length, const int8_t lower_bound, const int8_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_i8_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_i8_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      saturate_values_i8_sse4_1(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_values_i8_sse2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_i8_scalar(values, length, lower_bound, upper_bound);
+}
+
+INTMATH_API void saturate_values_u8(uint8_t *values, const size_t length, const uint8_t lower_bound, const uint8_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_u8_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_u8_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_values_u8_sse2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_u8_scalar(values, length, lower_bound, upper_bound);
+}
+
+/********************************************************************************
+ ********                 int16_t and uint16_t functions                 ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_values_i16(int16_t *values, const size_t length, const int16_t lower_bound, const int16_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_i16_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_i16_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_values_i16_sse2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_i16_scalar(values, length, lower_bound, upper_bound);
+}
+
+INTMATH_API void saturate_values_u16(uint16_t *values, const size_t length, const uint16_t lower_bound, const uint16_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_u16_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_u16_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      saturate_values_u16_sse4_1(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_values_u16_sse2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_u16_scalar(values, length, lower_bound, upper_bound);
+}
+
+/********************************************************************************
+ ********                 int32_t and uint32_t functions                 ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_values_i32(int32_t *values, const size_t length, const int32_t lower_bound, const int32_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_i32_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_i32_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      saturate_values_i32_sse4_1(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_values_i32_sse2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_i32_scalar(values, length, lower_bound, upper_bound);
+}
+
+INTMATH_API void saturate_values_u32(uint32_t *values, const size_t length, const uint32_t lower_bound, const uint32_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_u32_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_u32_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      saturate_values_u32_sse4_1(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      saturate_values_u32_sse2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_u32_scalar(values, length, lower_bound, upper_bound);
+}
+
+/********************************************************************************
+ ********                 int64_t and uint64_t functions                 ********
+ ********************************************************************************/
+
+INTMATH_API void saturate_values_i64(int64_t *values, const size_t length, const int64_t lower_bound, const int64_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_i64_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_i64_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_i64_scalar(values, length, lower_bound, upper_bound);
+}
+
+INTMATH_API void saturate_values_u64(uint64_t *values, const size_t length, const uint64_t lower_bound, const uint64_t upper_bound) {
+  #ifdef SATURATE_VALUES_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      saturate_values_u64_avx512(values, length, lower_bound, upper_bound);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      saturate_values_u64_avx2(values, length, lower_bound, upper_bound);
+      return;
+    }
+  #endif
+  saturate_values_u64_scalar(values, length, lower_bound, upper_bound);
+}
+
+#endif /* #ifndef SATURATE_VALUES_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -32,274 +32,279 @@
 #define SHIFTROUND_COMP_H_
 
 #include "inttypes.h"
+#include "intmath_inline.h"
 
 /********************************************************************************
  ********                        int8_t functions                        ********
  ********************************************************************************/
 
-int8_t shiftround_i8_1(const int8_t num);
-int8_t shiftround_i8_2(const int8_t num);
-int8_t shiftround_i8_3(const int8_t num);
-int8_t shiftround_i8_4(const int8_t num);
-int8_t shiftround_i8_5(const int8_t num);
-int8_t shiftround_i8_6(const int8_t num);
+INTMATH_API int8_t shiftround_i8_1(const int8_t num);
+INTMATH_API int8_t shiftround_i8_2(const int8_t num);
+INTMATH_API int8_t shiftround_i8_3(const int8_t num);
+INTMATH_API int8_t shiftround_i8_4(const int8_t num);
+INTMATH_API int8_t shiftround_i8_5(const int8_t num);
+INTMATH_API int8_t shiftround_i8_6(const int8_t num);
 
 /********************************************************************************
  ********                       int16_t functions                        ********
  ********************************************************************************/
 
-int16_t shiftround_i16_1(const int16_t num);
-int16_t shiftround_i16_2(const int16_t num);
-int16_t shiftround_i16_3(const int16_t num);
-int16_t shiftround_i16_4(const int16_t num);
-int16_t shiftround_i16_5(const int16_t num);
-int16_t shiftround_i16_6(const int16_t num);
-int16_t shiftround_i16_7(const int16_t num);
-int16_t shiftround_i16_8(const int16_t num);
-int16_t shiftround_i16_9(const int16_t num);
-int16_t shiftround_i16_10(const int16_t num);
-int16_t shiftround_i16_11(const int16_t num);
-int16_t shiftround_i16_12(const int16_t num);
-int16_t shiftround_i16_13(const int16_t num);
-int16_t shiftround_i16_14(const int16_t num);
+INTMATH_API int16_t shiftround_i16_1(const int16_t num);
+INTMATH_API int16_t shiftround_i16_2(const int16_t num);
+INTMATH_API int16_t shiftround_i16_3(const int16_t num);
+INTMATH_API int16_t shiftround_i16_4(const int16_t num);
+INTMATH_API int16_t shiftround_i16_5(const int16_t num);
+INTMATH_API int16_t shiftround_i16_6(const int16_t num);
+INTMATH_API int16_t shiftround_i16_7(const int16_t num);
+INTMATH_API int16_t shiftround_i16_8(const int16_t num);
+INTMATH_API int16_t shiftround_i16_9(const int16_t num);
+INTMATH_API int16_t shiftround_i16_10(const int16_t num);
+INTMATH_API int16_t shiftround_i16_11(const int16_t num);
+INTMATH_API int16_t shiftround_i16_12(const int16_t num);
+INTMATH_API int16_t shiftround_i16_13(const int16_t num);
+INTMATH_API int16_t shiftround_i16_14(const int16_t num);
 
 /********************************************************************************
  ********                       int32_t functions                        ********
  ********************************************************************************/
 
-int32_t shiftround_i32_1(const int32_t num);
-int32_t shiftround_i32_2(const int32_t num);
-int32_t shiftround_i32_3(const int32_t num);
-int32_t shiftround_i32_4(const int32_t num);
-int32_t shiftround_i32_5(const int32_t num);
-int32_t shiftround_i32_6(const int32_t num);
-int32_t shiftround_i32_7(const int32_t num);
-int32_t shiftround_i32_8(const int32_t num);
-int32_t shiftround_i32_9(const int32_t num);
-int32_t shiftround_i32_10(const int32_t num);
-int32_t shiftround_i32_11(const int32_t num);
-int32_t shiftround_i32_12(const int32_t num);
-int32_t shiftround_i32_13(const int32_t num);
-int32_t shiftround_i32_14(const int32_t num);
-int32_t shiftround_i32_15(const int32_t num);
-int32_t shiftround_i32_16(const int32_t num);
-int32_t shiftround_i32_17(const int32_t num);
-int32_t shiftround_i32_18(const int32_t num);
-int32_t shiftround_i32_19(const int32_t num);
-int32_t shiftround_i32_20(const int32_t num);
-int32_t shiftround_i32_21(const int32_t num);
-int32_t shiftround_i32_22(const int32_t num);
-int32_t shiftround_i32_23(const int32_t num);
-int32_t shiftround_i32_24(const int32_t num);
-int32_t shiftround_i32_25(const int32_t num);
-int32_t shiftround_i32_26(const int32_t num);
-int32_t shiftround_i32_27(const int32_t num);
-int32_t shiftround_i32_28(const int32_t num);
-int32_t shiftround_i32_29(const int32_t num);
-int32_t shiftround_i32_30(const int32_t num);
+INTMATH_API int32_t shiftround_i32_1(const int32_t num);
+INTMATH_API int32_t shiftround_i32_2(const int32_t num);
+INTMATH_API int32_t shiftround_i32_3(const int32_t num);
+INTMATH_API int32_t shiftround_i32_4(const int32_t num);
+INTMATH_API int32_t shiftround_i32_5(const int32_t num);
+INTMATH_API int32_t shiftround_i32_6(const int32_t num);
+INTMATH_API int32_t shiftround_i32_7(const int32_t num);
+INTMATH_API int32_t shiftround_i32_8(const int32_t num);
+INTMATH_API int32_t shiftround_i32_9(const int32_t num);
+INTMATH_API int32_t shiftround_i32_10(const int32_t num);
+INTMATH_API int32_t shiftround_i32_11(const int32_t num);
+INTMATH_API int32_t shiftround_i32_12(const int32_t num);
+INTMATH_API int32_t shiftround_i32_13(const int32_t num);
+INTMATH_API int32_t shiftround_i32_14(const int32_t num);
+INTMATH_API int32_t shiftround_i32_15(const int32_t num);
+INTMATH_API int32_t shiftround_i32_16(const int32_t num);
+INTMATH_API int32_t shiftround_i32_17(const int32_t num);
+INTMATH_API int32_t shiftround_i32_18(const int32_t num);
+INTMATH_API int32_t shiftround_i32_19(const int32_t num);
+INTMATH_API int32_t shiftround_i32_20(const int32_t num);
+INTMATH_API int32_t shiftround_i32_21(const int32_t num);
+INTMATH_API int32_t shiftround_i32_22(const int32_t num);
+INTMATH_API int32_t shiftround_i32_23(const int32_t num);
+INTMATH_API int32_t shiftround_i32_24(const int32_t num);
+INTMATH_API int32_t shiftround_i32_25(const int32_t num);
+INTMATH_API int32_t shiftround_i32_26(const int32_t num);
+INTMATH_API int32_t shiftround_i32_27(const int32_t num);
+INTMATH_API int32_t shiftround_i32_28(const int32_t num);
+INTMATH_API int32_t shiftround_i32_29(const int32_t num);
+INTMATH_API int32_t shiftround_i32_30(const int32_t num);
 
 /********************************************************************************
  ********                       int64_t functions                        ********
  ********************************************************************************/
 
-int64_t shiftround_i64_1(const int64_t num);
-int64_t shiftround_i64_2(const int64_t num);
-int64_t shiftround_i64_3(const int64_t num);
-int64_t shiftround_i64_4(const int64_t num);
-int64_t shiftround_i64_5(const int64_t num);
-int64_t shiftround_i64_6(const int64_t num);
-int64_t shiftround_i64_7(const int64_t num);
-int64_t shiftround_i64_8(const int64_t num);
-int64_t shiftround_i64_9(const int64_t num);
-int64_t shiftround_i64_10(const int64_t num);
-int64_t shiftround_i64_11(const int64_t num);
-int64_t shiftround_i64_12(const int64_t num);
-int64_t shiftround_i64_13(const int64_t num);
-int64_t shiftround_i64_14(const int64_t num);
-int64_t shiftround_i64_15(const int64_t num);
-int64_t shiftround_i64_16(const int64_t num);
-int64_t shiftround_i64_17(const int64_t num);
-int64_t shiftround_i64_18(const int64_t num);
-int64_t shiftround_i64_19(const int64_t num);
-int64_t shiftround_i64_20(const int64_t num);
-int64_t shiftround_i64_21(const int64_t num);
-int64_t shiftround_i64_22(const int64_t num);
-int64_t shiftround_i64_23(const int64_t num);
-int64_t shiftround_i64_24(const int64_t num);
-int64_t shiftround_i64_25(const int64_t num);
-int64_t shiftround_i64_26(const int64_t num);
-int64_t shiftround_i64_27(const int64_t num);
-int64_t shiftround_i64_28(const int64_t num);
-int64_t shiftround_i64_29(const int64_t num);
-int64_t shiftround_i64_30(const int64_t num);
-int64_t shiftround_i64_31(const int64_t num);
-int64_t shiftround_i64_32(const int64_t num);
-int64_t shiftround_i64_33(const int64_t num);
-int64_t shiftround_i64_34(const int64_t num);
-int64_t shiftround_i64_35(const int64_t num);
-int64_t shiftround_i64_36(const int64_t num);
-int64_t shiftround_i64_37(const int64_t num);
-int64_t shiftround_i64_38(const int64_t num);
-int64_t shiftround_i64_39(const int64_t num);
-int64_t shiftround_i64_40(const int64_t num);
-int64_t shiftround_i64_41(const int64_t num);
-int64_t shiftround_i64_42(const int64_t num);
-int64_t shiftround_i64_43(const int64_t num);
-int64_t shiftround_i64_44(const int64_t num);
-int64_t shiftround_i64_45(const int64_t num);
-int64_t shiftround_i64_46(const int64_t num);
-int64_t shiftround_i64_47(const int64_t num);
-int64_t shiftround_i64_48(const int64_t num);
-int64_t shiftround_i64_49(const int64_t num);
-int64_t shiftround_i64_50(const int64_t num);
-int64_t shiftround_i64_51(const int64_t num);
-int64_t shiftround_i64_52(const int64_t num);
-int64_t shiftround_i64_53(const int64_t num);
-int64_t shiftround_i64_54(const int64_t num);
-int64_t shiftround_i64_55(const int64_t num);
-int64_t shiftround_i64_56(const int64_t num);
-int64_t shiftround_i64_57(const int64_t num);
-int64_t shiftround_i64_58(const int64_t num);
-int64_t shiftround_i64_59(const int64_t num);
-int64_t shiftround_i64_60(const int64_t num);
-int64_t shiftround_i64_61(const int64_t num);
-int64_t shiftround_i64_62(const int64_t num);
+INTMATH_API int64_t shiftround_i64_1(const int64_t num);
+INTMATH_API int64_t shiftround_i64_2(const int64_t num);
+INTMATH_API int64_t shiftround_i64_3(const int64_t num);
+INTMATH_API int64_t shiftround_i64_4(const int64_t num);
+INTMATH_API int64_t shiftround_i64_5(const int64_t num);
+INTMATH_API int64_t shiftround_i64_6(const int64_t num);
+INTMATH_API int64_t shiftround_i64_7(const int64_t num);
+INTMATH_API int64_t shiftround_i64_8(const int64_t num);
+INTMATH_API int64_t shiftround_i64_9(const int64_t num);
+INTMATH_API int64_t shiftround_i64_10(const int64_t num);
+INTMATH_API int64_t shiftround_i64_11(const int64_t num);
+INTMATH_API int64_t shiftround_i64_12(const int64_t num);
+INTMATH_API int64_t shiftround_i64_13(const int64_t num);
+INTMATH_API int64_t shiftround_i64_14(const int64_t num);
+INTMATH_API int64_t shiftround_i64_15(const int64_t num);
+INTMATH_API int64_t shiftround_i64_16(const int64_t num);
+INTMATH_API int64_t shiftround_i64_17(const int64_t num);
+INTMATH_API int64_t shiftround_i64_18(const int64_t num);
+INTMATH_API int64_t shiftround_i64_19(const int64_t num);
+INTMATH_API int64_t shiftround_i64_20(const int64_t num);
+INTMATH_API int64_t shiftround_i64_21(const int64_t num);
+INTMATH_API int64_t shiftround_i64_22(const int64_t num);
+INTMATH_API int64_t shiftround_i64_23(const int64_t num);
+INTMATH_API int64_t shiftround_i64_24(const int64_t num);
+INTMATH_API int64_t shiftround_i64_25(const int64_t num);
+INTMATH_API int64_t shiftround_i64_26(const int64_t num);
+INTMATH_API int64_t shiftround_i64_27(const int64_t num);
+INTMATH_API int64_t shiftround_i64_28(const int64_t num);
+INTMATH_API int64_t shiftround_i64_29(const int64_t num);
+INTMATH_API int64_t shiftround_i64_30(const int64_t num);
+INTMATH_API int64_t shiftround_i64_31(const int64_t num);
+INTMATH_API int64_t shiftround_i64_32(const int64_t num);
+INTMATH_API int64_t shiftround_i64_33(const int64_t num);
+INTMATH_API int64_t shiftround_i64_34(const int64_t num);
+INTMATH_API int64_t shiftround_i64_35(const int64_t num);
+INTMATH_API int64_t shiftround_i64_36(const int64_t num);
+INTMATH_API int64_t shiftround_i64_37(const int64_t num);
+INTMATH_API int64_t shiftround_i64_38(const int64_t num);
+INTMATH_API int64_t shiftround_i64_39(const int64_t num);
+INTMATH_API int64_t shiftround_i64_40(const int64_t num);
+INTMATH_API int64_t shiftround_i64_41(const int64_t num);
+INTMATH_API int64_t shiftround_i64_42(const int64_t num);
+INTMATH_API int64_t shiftround_i64_43(const int64_t num);
+INTMATH_API int64_t shiftround_i64_44(const int64_t num);
+INTMATH_API int64_t shiftround_i64_45(const int64_t num);
+INTMATH_API int64_t shiftround_i64_46(const int64_t num);
+INTMATH_API int64_t shiftround_i64_47(const int64_t num);
+INTMATH_API int64_t shiftround_i64_48(const int64_t num);
+INTMATH_API int64_t shiftround_i64_49(const int64_t num);
+INTMATH_API int64_t shiftround_i64_50(const int64_t num);
+INTMATH_API int64_t shiftround_i64_51(const int64_t num);
+INTMATH_API int64_t shiftround_i64_52(const int64_t num);
+INTMATH_API int64_t shiftround_i64_53(const int64_t num);
+INTMATH_API int64_t shiftround_i64_54(const int64_t num);
+INTMATH_API int64_t shiftround_i64_55(const int64_t num);
+INTMATH_API int64_t shiftround_i64_56(const int64_t num);
+INTMATH_API int64_t shiftround_i64_57(const int64_t num);
+INTMATH_API int64_t shiftround_i64_58(const int64_t num);
+INTMATH_API int64_t shiftround_i64_59(const int64_t num);
+INTMATH_API int64_t shiftround_i64_60(const int64_t num);
+INTMATH_API int64_t shiftround_i64_61(const int64_t num);
+INTMATH_API int64_t shiftround_i64_62(const int64_t num);
 
 /********************************************************************************
  ********                       uint8_t functions                        ********
  ********************************************************************************/
 
-uint8_t shiftround_u8_1(const uint8_t num);
-uint8_t shiftround_u8_2(const uint8_t num);
-uint8_t shiftround_u8_3(const uint8_t num);
-uint8_t shiftround_u8_4(const uint8_t num);
-uint8_t shiftround_u8_5(const uint8_t num);
-uint8_t shiftround_u8_6(const uint8_t num);
-uint8_t shiftround_u8_7(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_1(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_2(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_3(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_4(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_5(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_6(const uint8_t num);
+INTMATH_API uint8_t shiftround_u8_7(const uint8_t num);
 
 /********************************************************************************
  ********                       uint16_t functions                       ********
  ********************************************************************************/
 
-uint16_t shiftround_u16_1(const uint16_t num);
-uint16_t shiftround_u16_2(const uint16_t num);
-uint16_t shiftround_u16_3(const uint16_t num);
-uint16_t shiftround_u16_4(const uint16_t num);
-uint16_t shiftround_u16_5(const uint16_t num);
-uint16_t shiftround_u16_6(const uint16_t num);
-uint16_t shiftround_u16_7(const uint16_t num);
-uint16_t shiftround_u16_8(const uint16_t num);
-uint16_t shiftround_u16_9(const uint16_t num);
-uint16_t shiftround_u16_10(const uint16_t num);
-uint16_t shiftround_u16_11(const uint16_t num);
-uint16_t shiftround_u16_12(const uint16_t num);
-uint16_t shiftround_u16_13(const uint16_t num);
-uint16_t shiftround_u16_14(const uint16_t num);
-uint16_t shiftround_u16_15(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_1(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_2(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_3(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_4(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_5(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_6(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_7(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_8(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_9(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_10(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_11(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_12(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_13(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_14(const uint16_t num);
+INTMATH_API uint16_t shiftround_u16_15(const uint16_t num);
 
 /********************************************************************************
  ********                       uint32_t functions                       ********
  ********************************************************************************/
 
-uint32_t shiftround_u32_1(const uint32_t num);
-uint32_t shiftround_u32_2(const uint32_t num);
-uint32_t shiftround_u32_3(const uint32_t num);
-uint32_t shiftround_u32_4(const uint32_t num);
-uint32_t shiftround_u32_5(const uint32_t num);
-uint32_t shiftround_u32_6(const uint32_t num);
-uint32_t shiftround_u32_7(const uint32_t num);
-uint32_t shiftround_u32_8(const uint32_t num);
-uint32_t shiftround_u32_9(const uint32_t num);
-uint32_t shiftround_u32_10(const uint32_t num);
-uint32_t shiftround_u32_11(const uint32_t num);
-uint32_t shiftround_u32_12(const uint32_t num);
-uint32_t shiftround_u32_13(const uint32_t num);
-uint32_t shiftround_u32_14(const uint32_t num);
-uint32_t shiftround_u32_15(const uint32_t num);
-uint32_t shiftround_u32_16(const uint32_t num);
-uint32_t shiftround_u32_17(const uint32_t num);
-uint32_t shiftround_u32_18(const uint32_t num);
-uint32_t shiftround_u32_19(const uint32_t num);
-uint32_t shiftround_u32_20(const uint32_t num);
-uint32_t shiftround_u32_21(const uint32_t num);
-uint32_t shiftround_u32_22(const uint32_t num);
-uint32_t shiftround_u32_23(const uint32_t num);
-uint32_t shiftround_u32_24(const uint32_t num);
-uint32_t shiftround_u32_25(const uint32_t num);
-uint32_t shiftround_u32_26(const uint32_t num);
-uint32_t shiftround_u32_27(const uint32_t num);
-uint32_t shiftround_u32_28(const uint32_t num);
-uint32_t shiftround_u32_29(const uint32_t num);
-uint32_t shiftround_u32_30(const uint32_t num);
-uint32_t shiftround_u32_31(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_1(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_2(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_3(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_4(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_5(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_6(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_7(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_8(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_9(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_10(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_11(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_12(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_13(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_14(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_15(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_16(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_17(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_18(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_19(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_20(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_21(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_22(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_23(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_24(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_25(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_26(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_27(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_28(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_29(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_30(const uint32_t num);
+INTMATH_API uint32_t shiftround_u32_31(const uint32_t num);
 
 /********************************************************************************
  ********                       uint64_t functions                       ********
  ********************************************************************************/
 
-uint64_t shiftround_u64_1(const uint64_t num);
-uint64_t shiftround_u64_2(const uint64_t num);
-uint64_t shiftround_u64_3(const uint64_t num);
-uint64_t shiftround_u64_4(const uint64_t num);
-uint64_t shiftround_u64_5(const uint64_t num);
-uint64_t shiftround_u64_6(const uint64_t num);
-uint64_t shiftround_u64_7(const uint64_t num);
-uint64_t shiftround_u64_8(const uint64_t num);
-uint64_t shiftround_u64_9(const uint64_t num);
-uint64_t shiftround_u64_10(const uint64_t num);
-uint64_t shiftround_u64_11(const uint64_t num);
-uint64_t shiftround_u64_12(const uint64_t num);
-uint64_t shiftround_u64_13(const uint64_t num);
-uint64_t shiftround_u64_14(const uint64_t num);
-uint64_t shiftround_u64_15(const uint64_t num);
-uint64_t shiftround_u64_16(const uint64_t num);
-uint64_t shiftround_u64_17(const uint64_t num);
-uint64_t shiftround_u64_18(const uint64_t num);
-uint64_t shiftround_u64_19(const uint64_t num);
-uint64_t shiftround_u64_20(const uint64_t num);
-uint64_t shiftround_u64_21(const uint64_t num);
-uint64_t shiftround_u64_22(const uint64_t num);
-uint64_t shiftround_u64_23(const uint64_t num);
-uint64_t shiftround_u64_24(const uint64_t num);
-uint64_t shiftround_u64_25(const uint64_t num);
-uint64_t shiftround_u64_26(const uint64_t num);
-uint64_t shiftround_u64_27(const uint64_t num);
-uint64_t shiftround_u64_28(const uint64_t num);
-uint64_t shiftround_u64_29(const uint64_t num);
-uint64_t shiftround_u64_30(const uint64_t num);
-uint64_t shiftround_u64_31(const uint64_t num);
-uint64_t shiftround_u64_32(const uint64_t num);
-uint64_t shiftround_u64_33(const uint64_t num);
-uint64_t shiftround_u64_34(const uint64_t num);
-uint64_t shiftround_u64_35(const uint64_t num);
-uint64_t shiftround_u64_36(const uint64_t num);
-uint64_t shiftround_u64_37(const uint64_t num);
-uint64_t shiftround_u64_38(const uint64_t num);
-uint64_t shiftround_u64_39(const uint64_t num);
-uint64_t shiftround_u64_40(const uint64_t num);
-uint64_t shiftround_u64_41(const uint64_t num);
-uint64_t shiftround_u64_42(const uint64_t num);
-uint64_t shiftround_u64_43(const uint64_t num);
-uint64_t shiftround_u64_44(const uint64_t num);
-uint64_t shiftround_u64_45(const uint64_t num);
-uint64_t shiftround_u64_46(const uint64_t num);
-uint64_t shiftround_u64_47(const uint64_t num);
-uint64_t shiftround_u64_48(const uint64_t num);
-uint64_t shiftround_u64_49(const uint64_t num);
-uint64_t shiftround_u64_50(const uint64_t num);
-uint64_t shiftround_u64_51(const uint64_t num);
-uint64_t shiftround_u64_52(const uint64_t num);
-uint64_t shiftround_u64_53(const uint64_t num);
-uint64_t shiftround_u64_54(const uint64_t num);
-uint64_t shiftround_u64_55(const uint64_t num);
-uint64_t shiftround_u64_56(const uint64_t num);
-uint64_t shiftround_u64_57(const uint64_t num);
-uint64_t shiftround_u64_58(const uint64_t num);
-uint64_t shiftround_u64_59(const uint64_t num);
-uint64_t shiftround_u64_60(const uint64_t num);
-uint64_t shiftround_u64_61(const uint64_t num);
-uint64_t shiftround_u64_62(const uint64_t num);
-uint64_t shiftround_u64_63(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_1(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_2(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_3(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_4(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_5(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_6(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_7(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_8(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_9(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_10(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_11(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_12(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_13(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_14(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_15(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_16(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_17(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_18(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_19(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_20(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_21(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_22(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_23(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_24(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_25(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_26(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_27(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_28(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_29(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_30(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_31(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_32(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_33(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_34(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_35(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_36(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_37(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_38(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_39(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_40(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_41(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_42(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_43(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_44(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_45(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_46(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_47(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_48(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_49(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_50(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_51(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_52(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_53(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_54(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_55(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_56(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_57(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_58(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_59(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_60(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_61(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_62(const uint64_t num);
+INTMATH_API uint64_t shiftround_u64_63(const uint64_t num);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "shiftround_comp.c"
+#endif
 
 #endif /* #ifndef SHIFTROUND_COMP_H_ */
 
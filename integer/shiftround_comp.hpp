@@ -1,7 +1,7 @@
 /**
  * shiftround_comp.hpp
  * Specifies the templated function
- *     type shiftround<typename type, int8_t shift>(const type num);
+ *     constexpr type shiftround<typename type, uint8_t shift>(const type num);
  * which returns the value ROUND(num / 2^shift) without using the division
  * operator. The _comp in shiftround_comp.hpp indicates that the shift
  * argument must be known at compile time.
@@ -11,13 +11,26 @@
  *
  * shift may range from 1 to one less than the the word length of type for unsigned
  * types. shift may range from 1 to two less than the word length of type for
- * signed types.
+ * signed types. Any other type or shift fails to compile.
+ *
+ * A single template covers every type and shift. The masks that the hand
+ * written specializations used to spell out are computed from type and shift
+ * at compile time, so each instantiation compiles to the same code as before.
+ * shiftround is constexpr and may be used in constant expressions, for
+ * example to fill a table at compile time.
+ *
+ * An optional third template argument selects another rounding mode from
+ * rounding_policy.hpp, e.g. shiftround<int32_t, 15, round_half_even>(num).
+ * It defaults to round_half_away, which is ROUND().
  *
  * Correct operation for negative signed inputs requires two things:
  * 1. The representation of signed integers must be 2's complement.
  * 2. The compiler must encode right shifts on signed types as arithmetic
  *    right shifts rather than logical right shifts.
  *
+ * #define BRANCHLESS_ROUNDING to compute the round_half_away correction
+ * arithmetically instead of with a conditional, as in shiftround_comp.c.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -31,1416 +44,81 @@
 #define SHIFTROUND_COMP_HPP_
 
 #include <cinttypes>
-
-/* Allows static_assert message in shiftround primary template to compile. */
-template <typename type> static bool always_false_shiftround_comp(void) { return false; }
+#include <limits>
+#include <type_traits>
+#include "rounding_policy.hpp"
 
 /**
- * This shiftround primary template is a catch-all for invalid and/or presently
- * unimplemented template arguments.
+ * True for the integer types of 8 to 64 bits and the shifts
+ * 1 <= shift <= (word length - 1) for unsigned types and
+ * 1 <= shift <= (word length - 2) for signed types.
  */
-template <typename type, uint8_t shift> type shiftround(const type num) {
-  static_assert(always_false_shiftround_comp<type>(), "type shiftround<type,shift>(const type num); is not defined for the specified type and/or shift value.");
-}
-
-/********************************************************************************
- ********                int8_t template specializations                 ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline int8_t shiftround<int8_t, 1>(const int8_t num) {
-  if ((num & static_cast<uint8_t>(0x81)) == static_cast<int8_t>(0x01)) return (num >> 1) + static_cast<int8_t>(1);
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline int8_t shiftround<int8_t, 2>(const int8_t num) {
-  if ((num & static_cast<int8_t>(0x02)) && ((num & static_cast<uint8_t>(0x83)) != static_cast<uint8_t>(0x82))) return (num >> 2) + static_cast<int8_t>(1);
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline int8_t shiftround<int8_t, 3>(const int8_t num) {
-  if ((num & static_cast<int8_t>(0x04)) && ((num & static_cast<uint8_t>(0x87)) != static_cast<uint8_t>(0x84))) return (num >> 3) + static_cast<int8_t>(1);
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline int8_t shiftround<int8_t, 4>(const int8_t num) {
-  if ((num & static_cast<int8_t>(0x08)) && ((num & static_cast<uint8_t>(0x8F)) != static_cast<uint8_t>(0x88))) return (num >> 4) + static_cast<int8_t>(1);
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline int8_t shiftround<int8_t, 5>(const int8_t num) {
-  if ((num & static_cast<int8_t>(0x10)) && ((num & static_cast<uint8_t>(0x9F)) != static_cast<uint8_t>(0x90))) return (num >> 5) + static_cast<int8_t>(1);
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline int8_t shiftround<int8_t, 6>(const int8_t num) {
-  if ((num & static_cast<int8_t>(0x20)) && ((num & static_cast<uint8_t>(0xBF)) != static_cast<uint8_t>(0xA0))) return (num >> 6) + static_cast<int8_t>(1);
-  return num >> 6;
-}
-
-/********************************************************************************
- ********                int16_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline int16_t shiftround<int16_t, 1>(const int16_t num) {
-  if ((num & static_cast<uint16_t>(0x8001)) == static_cast<int16_t>(0x0001)) return (num >> 1) + static_cast<int16_t>(1);
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline int16_t shiftround<int16_t, 2>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0002)) && ((num & static_cast<uint16_t>(0x8003)) != static_cast<uint16_t>(0x8002))) return (num >> 2) + static_cast<int16_t>(1);
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline int16_t shiftround<int16_t, 3>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0004)) && ((num & static_cast<uint16_t>(0x8007)) != static_cast<uint16_t>(0x8004))) return (num >> 3) + static_cast<int16_t>(1);
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline int16_t shiftround<int16_t, 4>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0008)) && ((num & static_cast<uint16_t>(0x800F)) != static_cast<uint16_t>(0x8008))) return (num >> 4) + static_cast<int16_t>(1);
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline int16_t shiftround<int16_t, 5>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0010)) && ((num & static_cast<uint16_t>(0x801F)) != static_cast<uint16_t>(0x8010))) return (num >> 5) + static_cast<int16_t>(1);
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline int16_t shiftround<int16_t, 6>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0020)) && ((num & static_cast<uint16_t>(0x803F)) != static_cast<uint16_t>(0x8020))) return (num >> 6) + static_cast<int16_t>(1);
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline int16_t shiftround<int16_t, 7>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0040)) && ((num & static_cast<uint16_t>(0x807F)) != static_cast<uint16_t>(0x8040))) return (num >> 7) + static_cast<int16_t>(1);
-  return num >> 7;
-}
-
-/* Returns ROUND(num / 2^8) */
-template <> inline int16_t shiftround<int16_t, 8>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0080)) && ((num & static_cast<uint16_t>(0x80FF)) != static_cast<uint16_t>(0x8080))) return (num >> 8) + static_cast<int16_t>(1);
-  return num >> 8;
-}
-
-/* Returns ROUND(num / 2^9) */
-template <> inline int16_t shiftround<int16_t, 9>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0100)) && ((num & static_cast<uint16_t>(0x81FF)) != static_cast<uint16_t>(0x8100))) return (num >> 9) + static_cast<int16_t>(1);
-  return num >> 9;
-}
-
-/* Returns ROUND(num / 2^10) */
-template <> inline int16_t shiftround<int16_t, 10>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0200)) && ((num & static_cast<uint16_t>(0x83FF)) != static_cast<uint16_t>(0x8200))) return (num >> 10) + static_cast<int16_t>(1);
-  return num >> 10;
-}
-
-/* Returns ROUND(num / 2^11) */
-template <> inline int16_t shiftround<int16_t, 11>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0400)) && ((num & static_cast<uint16_t>(0x87FF)) != static_cast<uint16_t>(0x8400))) return (num >> 11) + static_cast<int16_t>(1);
-  return num >> 11;
-}
-
-/* Returns ROUND(num / 2^12) */
-template <> inline int16_t shiftround<int16_t, 12>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x0800)) && ((num & static_cast<uint16_t>(0x8FFF)) != static_cast<uint16_t>(0x8800))) return (num >> 12) + static_cast<int16_t>(1);
-  return num >> 12;
-}
-
-/* Returns ROUND(num / 2^13) */
-template <> inline int16_t shiftround<int16_t, 13>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x1000)) && ((num & static_cast<uint16_t>(0x9FFF)) != static_cast<uint16_t>(0x9000))) return (num >> 13) + static_cast<int16_t>(1);
-  return num >> 13;
-}
-
-/* Returns ROUND(num / 2^14) */
-template <> inline int16_t shiftround<int16_t, 14>(const int16_t num) {
-  if ((num & static_cast<int16_t>(0x2000)) && ((num & static_cast<uint16_t>(0xBFFF)) != static_cast<uint16_t>(0xA000))) return (num >> 14) + static_cast<int16_t>(1);
-  return num >> 14;
-}
-
-/********************************************************************************
- ********                int32_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline int32_t shiftround<int32_t, 1>(const int32_t num) {
-  if ((num & 0x80000001u) == 0x00000001) return (num >> 1) + 1;
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline int32_t shiftround<int32_t, 2>(const int32_t num) {
-  if ((num & 0x00000002) && ((num & 0x80000003u) != 0x80000002u)) return (num >> 2) + 1;
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline int32_t shiftround<int32_t, 3>(const int32_t num) {
-  if ((num & 0x00000004) && ((num & 0x80000007u) != 0x80000004u)) return (num >> 3) + 1;
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline int32_t shiftround<int32_t, 4>(const int32_t num) {
-  if ((num & 0x00000008) && ((num & 0x8000000Fu) != 0x80000008u)) return (num >> 4) + 1;
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline int32_t shiftround<int32_t, 5>(const int32_t num) {
-  if ((num & 0x00000010) && ((num & 0x8000001Fu) != 0x80000010u)) return (num >> 5) + 1;
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline int32_t shiftround<int32_t, 6>(const int32_t num) {
-  if ((num & 0x00000020) && ((num & 0x8000003Fu) != 0x80000020u)) return (num >> 6) + 1;
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline int32_t shiftround<int32_t, 7>(const int32_t num) {
-  if ((num & 0x00000040) && ((num & 0x8000007Fu) != 0x80000040u)) return (num >> 7) + 1;
-  return num >> 7;
-}
-
-/* Returns ROUND(num / 2^8) */
-template <> inline int32_t shiftround<int32_t, 8>(const int32_t num) {
-  if ((num & 0x00000080) && ((num & 0x800000FFu) != 0x80000080u)) return (num >> 8) + 1;
-  return num >> 8;
-}
-
-/* Returns ROUND(num / 2^9) */
-template <> inline int32_t shiftround<int32_t, 9>(const int32_t num) {
-  if ((num & 0x00000100) && ((num & 0x800001FFu) != 0x80000100u)) return (num >> 9) + 1;
-  return num >> 9;
-}
-
-/* Returns ROUND(num / 2^10) */
-template <> inline int32_t shiftround<int32_t, 10>(const int32_t num) {
-  if ((num & 0x00000200) && ((num & 0x800003FFu) != 0x80000200u)) return (num >> 10) + 1;
-  return num >> 10;
-}
-
-/* Returns ROUND(num / 2^11) */
-template <> inline int32_t shiftround<int32_t, 11>(const int32_t num) {
-  if ((num & 0x00000400) && ((num & 0x800007FFu) != 0x80000400u)) return (num >> 11) + 1;
-  return num >> 11;
-}
-
-/* Returns ROUND(num / 2^12) */
-template <> inline int32_t shiftround<int32_t, 12>(const int32_t num) {
-  if ((num & 0x00000800) && ((num & 0x80000FFFu) != 0x80000800u)) return (num >> 12) + 1;
-  return num >> 12;
-}
-
-/* Returns ROUND(num / 2^13) */
-template <> inline int32_t shiftround<int32_t, 13>(const int32_t num) {
-  if ((num & 0x00001000) && ((num & 0x80001FFFu) != 0x80001000u)) return (num >> 13) + 1;
-  return num >> 13;
-}
-
-/* Returns ROUND(num / 2^14) */
-template <> inline int32_t shiftround<int32_t, 14>(const int32_t num) {
-  if ((num & 0x00002000) && ((num & 0x80003FFFu) != 0x80002000u)) return (num >> 14) + 1;
-  return num >> 14;
-}
-
-/* Returns ROUND(num / 2^15) */
-template <> inline int32_t shiftround<int32_t, 15>(const int32_t num) {
-  if ((num & 0x00004000) && ((num & 0x80007FFFu) != 0x80004000u)) return (num >> 15) + 1;
-  return num >> 15;
-}
-
-/* Returns ROUND(num / 2^16) */
-template <> inline int32_t shiftround<int32_t, 16>(const int32_t num) {
-  if ((num & 0x00008000) && ((num & 0x8000FFFFu) != 0x80008000u)) return (num >> 16) + 1;
-  return num >> 16;
-}
-
-/* Returns ROUND(num / 2^17) */
-template <> inline int32_t shiftround<int32_t, 17>(const int32_t num) {
-  if ((num & 0x00010000) && ((num & 0x8001FFFFu) != 0x80010000u)) return (num >> 17) + 1;
-  return num >> 17;
-}
-
-/* Returns ROUND(num / 2^18) */
-template <> inline int32_t shiftround<int32_t, 18>(const int32_t num) {
-  if ((num & 0x00020000) && ((num & 0x8003FFFFu) != 0x80020000u)) return (num >> 18) + 1;
-  return num >> 18;
-}
-
-/* Returns ROUND(num / 2^19) */
-template <> inline int32_t shiftround<int32_t, 19>(const int32_t num) {
-  if ((num & 0x00040000) && ((num & 0x8007FFFFu) != 0x80040000u)) return (num >> 19) + 1;
-  return num >> 19;
-}
-
-/* Returns ROUND(num / 2^20) */
-template <> inline int32_t shiftround<int32_t, 20>(const int32_t num) {
-  if ((num & 0x00080000) && ((num & 0x800FFFFFu) != 0x80080000u)) return (num >> 20) + 1;
-  return num >> 20;
-}
-
-/* Returns ROUND(num / 2^21) */
-template <> inline int32_t shiftround<int32_t, 21>(const int32_t num) {
-  if ((num & 0x00100000) && ((num & 0x801FFFFFu) != 0x80100000u)) return (num >> 21) + 1;
-  return num >> 21;
-}
-
-/* Returns ROUND(num / 2^22) */
-template <> inline int32_t shiftround<int32_t, 22>(const int32_t num) {
-  if ((num & 0x00200000) && ((num & 0x803FFFFFu) != 0x80200000u)) return (num >> 22) + 1;
-  return num >> 22;
-}
-
-/* Returns ROUND(num / 2^23) */
-template <> inline int32_t shiftround<int32_t, 23>(const int32_t num) {
-  if ((num & 0x00400000) && ((num & 0x807FFFFFu) != 0x80400000u)) return (num >> 23) + 1;
-  return num >> 23;
-}
-
-/* Returns ROUND(num / 2^24) */
-template <> inline int32_t shiftround<int32_t, 24>(const int32_t num) {
-  if ((num & 0x00800000) && ((num & 0x80FFFFFFu) != 0x80800000u)) return (num >> 24) + 1;
-  return num >> 24;
-}
-
-/* Returns ROUND(num / 2^25) */
-template <> inline int32_t shiftround<int32_t, 25>(const int32_t num) {
-  if ((num & 0x01000000) && ((num & 0x81FFFFFFu) != 0x81000000u)) return (num >> 25) + 1;
-  return num >> 25;
-}
-
-/* Returns ROUND(num / 2^26) */
-template <> inline int32_t shiftround<int32_t, 26>(const int32_t num) {
-  if ((num & 0x02000000) && ((num & 0x83FFFFFFu) != 0x82000000u)) return (num >> 26) + 1;
-  return num >> 26;
-}
-
-/* Returns ROUND(num / 2^27) */
-template <> inline int32_t shiftround<int32_t, 27>(const int32_t num) {
-  if ((num & 0x04000000) && ((num & 0x87FFFFFFu) != 0x84000000u)) return (num >> 27) + 1;
-  return num >> 27;
-}
-
-/* Returns ROUND(num / 2^28) */
-template <> inline int32_t shiftround<int32_t, 28>(const int32_t num) {
-  if ((num & 0x08000000) && ((num & 0x8FFFFFFFu) != 0x88000000u)) return (num >> 28) + 1;
-  return num >> 28;
-}
-
-/* Returns ROUND(num / 2^29) */
-template <> inline int32_t shiftround<int32_t, 29>(const int32_t num) {
-  if ((num & 0x10000000) && ((num & 0x9FFFFFFFu) != 0x90000000u)) return (num >> 29) + 1;
-  return num >> 29;
-}
-
-/* Returns ROUND(num / 2^30) */
-template <> inline int32_t shiftround<int32_t, 30>(const int32_t num) {
-  if ((num & 0x20000000) && ((num & 0xBFFFFFFFu) != 0xA0000000u)) return (num >> 30) + 1;
-  return num >> 30;
-}
-
-/********************************************************************************
- ********                int64_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline int64_t shiftround<int64_t, 1>(const int64_t num) {
-  if ((num & 0x8000000000000001ull) == 0x0000000000000001ull) return (num >> 1) + 1ll;
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline int64_t shiftround<int64_t, 2>(const int64_t num) {
-  if ((num & 0x0000000000000002ll) && ((num & 0x8000000000000003ull) != 0x8000000000000002ull)) return (num >> 2) + 1ll;
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline int64_t shiftround<int64_t, 3>(const int64_t num) {
-  if ((num & 0x0000000000000004ll) && ((num & 0x8000000000000007ull) != 0x8000000000000004ull)) return (num >> 3) + 1ll;
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline int64_t shiftround<int64_t, 4>(const int64_t num) {
-  if ((num & 0x0000000000000008ll) && ((num & 0x800000000000000Full) != 0x8000000000000008ull)) return (num >> 4) + 1ll;
-  return num >> 4;
+template <typename type, uint8_t shift> constexpr bool shiftround_comp_valid(void) {
+  return std::is_integral<type>::value && !std::is_same<type, bool>::value && sizeof(type) <= 8u &&
+         shift >= 1u && shift < std::numeric_limits<type>::digits;
 }
 
-/* Returns ROUND(num / 2^5) */
-template <> inline int64_t shiftround<int64_t, 5>(const int64_t num) {
-  if ((num & 0x0000000000000010ll) && ((num & 0x800000000000001Full) != 0x8000000000000010ull)) return (num >> 5) + 1ll;
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline int64_t shiftround<int64_t, 6>(const int64_t num) {
-  if ((num & 0x0000000000000020ll) && ((num & 0x800000000000003Full) != 0x8000000000000020ull)) return (num >> 6) + 1ll;
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline int64_t shiftround<int64_t, 7>(const int64_t num) {
-  if ((num & 0x0000000000000040ll) && ((num & 0x800000000000007Full) != 0x8000000000000040ull)) return (num >> 7) + 1ll;
-  return num >> 7;
-}
-
-/* Returns ROUND(num / 2^8) */
-template <> inline int64_t shiftround<int64_t, 8>(const int64_t num) {
-  if ((num & 0x0000000000000080ll) && ((num & 0x80000000000000FFull) != 0x8000000000000080ull)) return (num >> 8) + 1ll;
-  return num >> 8;
-}
-
-/* Returns ROUND(num / 2^9) */
-template <> inline int64_t shiftround<int64_t, 9>(const int64_t num) {
-  if ((num & 0x0000000000000100ll) && ((num & 0x80000000000001FFull) != 0x8000000000000100ull)) return (num >> 9) + 1ll;
-  return num >> 9;
-}
-
-/* Returns ROUND(num / 2^10) */
-template <> inline int64_t shiftround<int64_t, 10>(const int64_t num) {
-  if ((num & 0x0000000000000200ll) && ((num & 0x80000000000003FFull) != 0x8000000000000200ull)) return (num >> 10) + 1ll;
-  return num >> 10;
-}
-
-/* Returns ROUND(num / 2^11) */
-template <> inline int64_t shiftround<int64_t, 11>(const int64_t num) {
-  if ((num & 0x0000000000000400ll) && ((num & 0x80000000000007FFull) != 0x8000000000000400ull)) return (num >> 11) + 1ll;
-  return num >> 11;
-}
-
-/* Returns ROUND(num / 2^12) */
-template <> inline int64_t shiftround<int64_t, 12>(const int64_t num) {
-  if ((num & 0x0000000000000800ll) && ((num & 0x8000000000000FFFull) != 0x8000000000000800ull)) return (num >> 12) + 1ll;
-  return num >> 12;
-}
-
-/* Returns ROUND(num / 2^13) */
-template <> inline int64_t shiftround<int64_t, 13>(const int64_t num) {
-  if ((num & 0x0000000000001000ll) && ((num & 0x8000000000001FFFull) != 0x8000000000001000ull)) return (num >> 13) + 1ll;
-  return num >> 13;
-}
-
-/* Returns ROUND(num / 2^14) */
-template <> inline int64_t shiftround<int64_t, 14>(const int64_t num) {
-  if ((num & 0x0000000000002000ll) && ((num & 0x8000000000003FFFull) != 0x8000000000002000ull)) return (num >> 14) + 1ll;
-  return num >> 14;
-}
-
-/* Returns ROUND(num / 2^15) */
-template <> inline int64_t shiftround<int64_t, 15>(const int64_t num) {
-  if ((num & 0x0000000000004000ll) && ((num & 0x8000000000007FFFull) != 0x8000000000004000ull)) return (num >> 15) + 1ll;
-  return num >> 15;
-}
-
-/* Returns ROUND(num / 2^16) */
-template <> inline int64_t shiftround<int64_t, 16>(const int64_t num) {
-  if ((num & 0x0000000000008000ll) && ((num & 0x800000000000FFFFull) != 0x8000000000008000ull)) return (num >> 16) + 1ll;
-  return num >> 16;
-}
-
-/* Returns ROUND(num / 2^17) */
-template <> inline int64_t shiftround<int64_t, 17>(const int64_t num) {
-  if ((num & 0x0000000000010000ll) && ((num & 0x800000000001FFFFull) != 0x8000000000010000ull)) return (num >> 17) + 1ll;
-  return num >> 17;
-}
-
-/* Returns ROUND(num / 2^18) */
-template <> inline int64_t shiftround<int64_t, 18>(const int64_t num) {
-  if ((num & 0x0000000000020000ll) && ((num & 0x800000000003FFFFull) != 0x8000000000020000ull)) return (num >> 18) + 1ll;
-  return num >> 18;
-}
-
-/* Returns ROUND(num / 2^19) */
-template <> inline int64_t shiftround<int64_t, 19>(const int64_t num) {
-  if ((num & 0x0000000000040000ll) && ((num & 0x800000000007FFFFull) != 0x8000000000040000ull)) return (num >> 19) + 1ll;
-  return num >> 19;
-}
-
-/* Returns ROUND(num / 2^20) */
-template <> inline int64_t shiftround<int64_t, 20>(const int64_t num) {
-  if ((num & 0x0000000000080000ll) && ((num & 0x80000000000FFFFFull) != 0x8000000000080000ull)) return (num >> 20) + 1ll;
-  return num >> 20;
-}
-
-/* Returns ROUND(num / 2^21) */
-template <> inline int64_t shiftround<int64_t, 21>(const int64_t num) {
-  if ((num & 0x0000000000100000ll) && ((num & 0x80000000001FFFFFull) != 0x8000000000100000ull)) return (num >> 21) + 1ll;
-  return num >> 21;
-}
-
-/* Returns ROUND(num / 2^22) */
-template <> inline int64_t shiftround<int64_t, 22>(const int64_t num) {
-  if ((num & 0x0000000000200000ll) && ((num & 0x80000000003FFFFFull) != 0x8000000000200000ull)) return (num >> 22) + 1ll;
-  return num >> 22;
-}
-
-/* Returns ROUND(num / 2^23) */
-template <> inline int64_t shiftround<int64_t, 23>(const int64_t num) {
-  if ((num & 0x0000000000400000ll) && ((num & 0x80000000007FFFFFull) != 0x8000000000400000ull)) return (num >> 23) + 1ll;
-  return num >> 23;
-}
-
-/* Returns ROUND(num / 2^24) */
-template <> inline int64_t shiftround<int64_t, 24>(const int64_t num) {
-  if ((num & 0x0000000000800000ll) && ((num & 0x8000000000FFFFFFull) != 0x8000000000800000ull)) return (num >> 24) + 1ll;
-  return num >> 24;
-}
-
-/* Returns ROUND(num / 2^25) */
-template <> inline int64_t shiftround<int64_t, 25>(const int64_t num) {
-  if ((num & 0x0000000001000000ll) && ((num & 0x8000000001FFFFFFull) != 0x8000000001000000ull)) return (num >> 25) + 1ll;
-  return num >> 25;
-}
-
-/* Returns ROUND(num / 2^26) */
-template <> inline int64_t shiftround<int64_t, 26>(const int64_t num) {
-  if ((num & 0x0000000002000000ll) && ((num & 0x8000000003FFFFFFull) != 0x8000000002000000ull)) return (num >> 26) + 1ll;
-  return num >> 26;
-}
-
-/* Returns ROUND(num / 2^27) */
-template <> inline int64_t shiftround<int64_t, 27>(const int64_t num) {
-  if ((num & 0x0000000004000000ll) && ((num & 0x8000000007FFFFFFull) != 0x8000000004000000ull)) return (num >> 27) + 1ll;
-  return num >> 27;
-}
-
-/* Returns ROUND(num / 2^28) */
-template <> inline int64_t shiftround<int64_t, 28>(const int64_t num) {
-  if ((num & 0x0000000008000000ll) && ((num & 0x800000000FFFFFFFull) != 0x8000000008000000ull)) return (num >> 28) + 1ll;
-  return num >> 28;
-}
-
-/* Returns ROUND(num / 2^29) */
-template <> inline int64_t shiftround<int64_t, 29>(const int64_t num) {
-  if ((num & 0x0000000010000000ll) && ((num & 0x800000001FFFFFFFull) != 0x8000000010000000ull)) return (num >> 29) + 1ll;
-  return num >> 29;
-}
-
-/* Returns ROUND(num / 2^30) */
-template <> inline int64_t shiftround<int64_t, 30>(const int64_t num) {
-  if ((num & 0x0000000020000000ll) && ((num & 0x800000003FFFFFFFull) != 0x8000000020000000ull)) return (num >> 30) + 1ll;
-  return num >> 30;
-}
-
-/* Returns ROUND(num / 2^31) */
-template <> inline int64_t shiftround<int64_t, 31>(const int64_t num) {
-  if ((num & 0x0000000040000000ll) && ((num & 0x800000007FFFFFFFull) != 0x8000000040000000ull)) return (num >> 31) + 1ll;
-  return num >> 31;
-}
-
-/* Returns ROUND(num / 2^32) */
-template <> inline int64_t shiftround<int64_t, 32>(const int64_t num) {
-  if ((num & 0x0000000080000000ll) && ((num & 0x80000000FFFFFFFFull) != 0x8000000080000000ull)) return (num >> 32) + 1ll;
-  return num >> 32;
-}
-
-/* Returns ROUND(num / 2^33) */
-template <> inline int64_t shiftround<int64_t, 33>(const int64_t num) {
-  if ((num & 0x0000000100000000ll) && ((num & 0x80000001FFFFFFFFull) != 0x8000000100000000ull)) return (num >> 33) + 1ll;
-  return num >> 33;
-}
-
-/* Returns ROUND(num / 2^34) */
-template <> inline int64_t shiftround<int64_t, 34>(const int64_t num) {
-  if ((num & 0x0000000200000000ll) && ((num & 0x80000003FFFFFFFFull) != 0x8000000200000000ull)) return (num >> 34) + 1ll;
-  return num >> 34;
-}
-
-/* Returns ROUND(num / 2^35) */
-template <> inline int64_t shiftround<int64_t, 35>(const int64_t num) {
-  if ((num & 0x0000000400000000ll) && ((num & 0x80000007FFFFFFFFull) != 0x8000000400000000ull)) return (num >> 35) + 1ll;
-  return num >> 35;
-}
-
-/* Returns ROUND(num / 2^36) */
-template <> inline int64_t shiftround<int64_t, 36>(const int64_t num) {
-  if ((num & 0x0000000800000000ll) && ((num & 0x8000000FFFFFFFFFull) != 0x8000000800000000ull)) return (num >> 36) + 1ll;
-  return num >> 36;
-}
-
-/* Returns ROUND(num / 2^37) */
-template <> inline int64_t shiftround<int64_t, 37>(const int64_t num) {
-  if ((num & 0x0000001000000000ll) && ((num & 0x8000001FFFFFFFFFull) != 0x8000001000000000ull)) return (num >> 37) + 1ll;
-  return num >> 37;
-}
-
-/* Returns ROUND(num / 2^38) */
-template <> inline int64_t shiftround<int64_t, 38>(const int64_t num) {
-  if ((num & 0x0000002000000000ll) && ((num & 0x8000003FFFFFFFFFull) != 0x8000002000000000ull)) return (num >> 38) + 1ll;
-  return num >> 38;
-}
-
-/* Returns ROUND(num / 2^39) */
-template <> inline int64_t shiftround<int64_t, 39>(const int64_t num) {
-  if ((num & 0x0000004000000000ll) && ((num & 0x8000007FFFFFFFFFull) != 0x8000004000000000ull)) return (num >> 39) + 1ll;
-  return num >> 39;
-}
-
-/* Returns ROUND(num / 2^40) */
-template <> inline int64_t shiftround<int64_t, 40>(const int64_t num) {
-  if ((num & 0x0000008000000000ll) && ((num & 0x800000FFFFFFFFFFull) != 0x8000008000000000ull)) return (num >> 40) + 1ll;
-  return num >> 40;
-}
-
-/* Returns ROUND(num / 2^41) */
-template <> inline int64_t shiftround<int64_t, 41>(const int64_t num) {
-  if ((num & 0x0000010000000000ll) && ((num & 0x800001FFFFFFFFFFull) != 0x8000010000000000ull)) return (num >> 41) + 1ll;
-  return num >> 41;
-}
-
-/* Returns ROUND(num / 2^42) */
-template <> inline int64_t shiftround<int64_t, 42>(const int64_t num) {
-  if ((num & 0x0000020000000000ll) && ((num & 0x800003FFFFFFFFFFull) != 0x8000020000000000ull)) return (num >> 42) + 1ll;
-  return num >> 42;
-}
-
-/* Returns ROUND(num / 2^43) */
-template <> inline int64_t shiftround<int64_t, 43>(const int64_t num) {
-  if ((num & 0x0000040000000000ll) && ((num & 0x800007FFFFFFFFFFull) != 0x8000040000000000ull)) return (num >> 43) + 1ll;
-  return num >> 43;
-}
-
-/* Returns ROUND(num / 2^44) */
-template <> inline int64_t shiftround<int64_t, 44>(const int64_t num) {
-  if ((num & 0x0000080000000000ll) && ((num & 0x80000FFFFFFFFFFFull) != 0x8000080000000000ull)) return (num >> 44) + 1ll;
-  return num >> 44;
-}
-
-/* Returns ROUND(num / 2^45) */
-template <> inline int64_t shiftround<int64_t, 45>(const int64_t num) {
-  if ((num & 0x0000100000000000ll) && ((num & 0x80001FFFFFFFFFFFull) != 0x8000100000000000ull)) return (num >> 45) + 1ll;
-  return num >> 45;
-}
-
-/* Returns ROUND(num / 2^46) */
-template <> inline int64_t shiftround<int64_t, 46>(const int64_t num) {
-  if ((num & 0x0000200000000000ll) && ((num & 0x80003FFFFFFFFFFFull) != 0x8000200000000000ull)) return (num >> 46) + 1ll;
-  return num >> 46;
-}
-
-/* Returns ROUND(num / 2^47) */
-template <> inline int64_t shiftround<int64_t, 47>(const int64_t num) {
-  if ((num & 0x0000400000000000ll) && ((num & 0x80007FFFFFFFFFFFull) != 0x8000400000000000ull)) return (num >> 47) + 1ll;
-  return num >> 47;
-}
-
-/* Returns ROUND(num / 2^48) */
-template <> inline int64_t shiftround<int64_t, 48>(const int64_t num) {
-  if ((num & 0x0000800000000000ll) && ((num & 0x8000FFFFFFFFFFFFull) != 0x8000800000000000ull)) return (num >> 48) + 1ll;
-  return num >> 48;
-}
-
-/* Returns ROUND(num / 2^49) */
-template <> inline int64_t shiftround<int64_t, 49>(const int64_t num) {
-  if ((num & 0x0001000000000000ll) && ((num & 0x8001FFFFFFFFFFFFull) != 0x8001000000000000ull)) return (num >> 49) + 1ll;
-  return num >> 49;
-}
-
-/* Returns ROUND(num / 2^50) */
-template <> inline int64_t shiftround<int64_t, 50>(const int64_t num) {
-  if ((num & 0x0002000000000000ll) && ((num & 0x8003FFFFFFFFFFFFull) != 0x8002000000000000ull)) return (num >> 50) + 1ll;
-  return num >> 50;
-}
-
-/* Returns ROUND(num / 2^51) */
-template <> inline int64_t shiftround<int64_t, 51>(const int64_t num) {
-  if ((num & 0x0004000000000000ll) && ((num & 0x8007FFFFFFFFFFFFull) != 0x8004000000000000ull)) return (num >> 51) + 1ll;
-  return num >> 51;
-}
-
-/* Returns ROUND(num / 2^52) */
-template <> inline int64_t shiftround<int64_t, 52>(const int64_t num) {
-  if ((num & 0x0008000000000000ll) && ((num & 0x800FFFFFFFFFFFFFull) != 0x8008000000000000ull)) return (num >> 52) + 1ll;
-  return num >> 52;
-}
-
-/* Returns ROUND(num / 2^53) */
-template <> inline int64_t shiftround<int64_t, 53>(const int64_t num) {
-  if ((num & 0x0010000000000000ll) && ((num & 0x801FFFFFFFFFFFFFull) != 0x8010000000000000ull)) return (num >> 53) + 1ll;
-  return num >> 53;
-}
-
-/* Returns ROUND(num / 2^54) */
-template <> inline int64_t shiftround<int64_t, 54>(const int64_t num) {
-  if ((num & 0x0020000000000000ll) && ((num & 0x803FFFFFFFFFFFFFull) != 0x8020000000000000ull)) return (num >> 54) + 1ll;
-  return num >> 54;
-}
-
-/* Returns ROUND(num / 2^55) */
-template <> inline int64_t shiftround<int64_t, 55>(const int64_t num) {
-  if ((num & 0x0040000000000000ll) && ((num & 0x807FFFFFFFFFFFFFull) != 0x8040000000000000ull)) return (num >> 55) + 1ll;
-  return num >> 55;
-}
-
-/* Returns ROUND(num / 2^56) */
-template <> inline int64_t shiftround<int64_t, 56>(const int64_t num) {
-  if ((num & 0x0080000000000000ll) && ((num & 0x80FFFFFFFFFFFFFFull) != 0x8080000000000000ull)) return (num >> 56) + 1ll;
-  return num >> 56;
-}
-
-/* Returns ROUND(num / 2^57) */
-template <> inline int64_t shiftround<int64_t, 57>(const int64_t num) {
-  if ((num & 0x0100000000000000ll) && ((num & 0x81FFFFFFFFFFFFFFull) != 0x8100000000000000ull)) return (num >> 57) + 1ll;
-  return num >> 57;
-}
-
-/* Returns ROUND(num / 2^58) */
-template <> inline int64_t shiftround<int64_t, 58>(const int64_t num) {
-  if ((num & 0x0200000000000000ll) && ((num & 0x83FFFFFFFFFFFFFFull) != 0x8200000000000000ull)) return (num >> 58) + 1ll;
-  return num >> 58;
-}
-
-/* Returns ROUND(num / 2^59) */
-template <> inline int64_t shiftround<int64_t, 59>(const int64_t num) {
-  if ((num & 0x0400000000000000ll) && ((num & 0x87FFFFFFFFFFFFFFull) != 0x8400000000000000ull)) return (num >> 59) + 1ll;
-  return num >> 59;
-}
-
-/* Returns ROUND(num / 2^60) */
-template <> inline int64_t shiftround<int64_t, 60>(const int64_t num) {
-  if ((num & 0x0800000000000000ll) && ((num & 0x8FFFFFFFFFFFFFFFull) != 0x8800000000000000ull)) return (num >> 60) + 1ll;
-  return num >> 60;
-}
-
-/* Returns ROUND(num / 2^61) */
-template <> inline int64_t shiftround<int64_t, 61>(const int64_t num) {
-  if ((num & 0x1000000000000000ll) && ((num & 0x9FFFFFFFFFFFFFFFull) != 0x9000000000000000ull)) return (num >> 61) + 1ll;
-  return num >> 61;
-}
-
-/* Returns ROUND(num / 2^62) */
-template <> inline int64_t shiftround<int64_t, 62>(const int64_t num) {
-  if ((num & 0x2000000000000000ll) && ((num & 0xBFFFFFFFFFFFFFFFull) != 0xA000000000000000ull)) return (num >> 62) + 1ll;
-  return num >> 62;
-}
-
-/********************************************************************************
- ********                uint8_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline uint8_t shiftround<uint8_t, 1>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x01)) return (num >> 1) + static_cast<uint8_t>(1);
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline uint8_t shiftround<uint8_t, 2>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x02)) return (num >> 2) + static_cast<uint8_t>(1);
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline uint8_t shiftround<uint8_t, 3>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x04)) return (num >> 3) + static_cast<uint8_t>(1);
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline uint8_t shiftround<uint8_t, 4>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x08)) return (num >> 4) + static_cast<uint8_t>(1);
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline uint8_t shiftround<uint8_t, 5>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x10)) return (num >> 5) + static_cast<uint8_t>(1);
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline uint8_t shiftround<uint8_t, 6>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x20)) return (num >> 6) + static_cast<uint8_t>(1);
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline uint8_t shiftround<uint8_t, 7>(const uint8_t num) {
-  if (num & static_cast<uint8_t>(0x40)) return (num >> 7) + static_cast<uint8_t>(1);
-  return num >> 7;
-}
-
-/********************************************************************************
- ********               uint16_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline uint16_t shiftround<uint16_t, 1>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0001)) return (num >> 1) + static_cast<uint16_t>(1);
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline uint16_t shiftround<uint16_t, 2>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0002)) return (num >> 2) + static_cast<uint16_t>(1);
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline uint16_t shiftround<uint16_t, 3>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0004)) return (num >> 3) + static_cast<uint16_t>(1);
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline uint16_t shiftround<uint16_t, 4>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0008)) return (num >> 4) + static_cast<uint16_t>(1);
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline uint16_t shiftround<uint16_t, 5>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0010)) return (num >> 5) + static_cast<uint16_t>(1);
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline uint16_t shiftround<uint16_t, 6>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0020)) return (num >> 6) + static_cast<uint16_t>(1);
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline uint16_t shiftround<uint16_t, 7>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0040)) return (num >> 7) + static_cast<uint16_t>(1);
-  return num >> 7;
-}
-
-/* Returns ROUND(num / 2^8) */
-template <> inline uint16_t shiftround<uint16_t, 8>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0080)) return (num >> 8) + static_cast<uint16_t>(1);
-  return num >> 8;
-}
-
-/* Returns ROUND(num / 2^9) */
-template <> inline uint16_t shiftround<uint16_t, 9>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0100)) return (num >> 9) + static_cast<uint16_t>(1);
-  return num >> 9;
-}
-
-/* Returns ROUND(num / 2^10) */
-template <> inline uint16_t shiftround<uint16_t, 10>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0200)) return (num >> 10) + static_cast<uint16_t>(1);
-  return num >> 10;
-}
-
-/* Returns ROUND(num / 2^11) */
-template <> inline uint16_t shiftround<uint16_t, 11>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0400)) return (num >> 11) + static_cast<uint16_t>(1);
-  return num >> 11;
-}
-
-/* Returns ROUND(num / 2^12) */
-template <> inline uint16_t shiftround<uint16_t, 12>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x0800)) return (num >> 12) + static_cast<uint16_t>(1);
-  return num >> 12;
-}
-
-/* Returns ROUND(num / 2^13) */
-template <> inline uint16_t shiftround<uint16_t, 13>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x1000)) return (num >> 13) + static_cast<uint16_t>(1);
-  return num >> 13;
-}
-
-/* Returns ROUND(num / 2^14) */
-template <> inline uint16_t shiftround<uint16_t, 14>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x2000)) return (num >> 14) + static_cast<uint16_t>(1);
-  return num >> 14;
-}
-
-/* Returns ROUND(num / 2^15) */
-template <> inline uint16_t shiftround<uint16_t, 15>(const uint16_t num) {
-  if (num & static_cast<uint16_t>(0x4000)) return (num >> 15) + static_cast<uint16_t>(1);
-  return num >> 15;
-}
-
-/********************************************************************************
- ********               uint32_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline uint32_t shiftround<uint32_t, 1>(const uint32_t num) {
-  if (num & 0x00000001u) return (num >> 1) + 1u;
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline uint32_t shiftround<uint32_t, 2>(const uint32_t num) {
-  if (num & 0x00000002u) return (num >> 2) + 1u;
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline uint32_t shiftround<uint32_t, 3>(const uint32_t num) {
-  if (num & 0x00000004u) return (num >> 3) + 1u;
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline uint32_t shiftround<uint32_t, 4>(const uint32_t num) {
-  if (num & 0x00000008u) return (num >> 4) + 1u;
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline uint32_t shiftround<uint32_t, 5>(const uint32_t num) {
-  if (num & 0x00000010u) return (num >> 5) + 1u;
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline uint32_t shiftround<uint32_t, 6>(const uint32_t num) {
-  if (num & 0x00000020u) return (num >> 6) + 1u;
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline uint32_t shiftround<uint32_t, 7>(const uint32_t num) {
-  if (num & 0x00000040u) return (num >> 7) + 1u;
-  return num >> 7;
-}
-
-/* Returns ROUND(num / 2^8) */
-template <> inline uint32_t shiftround<uint32_t, 8>(const uint32_t num) {
-  if (num & 0x00000080u) return (num >> 8) + 1u;
-  return num >> 8;
-}
-
-/* Returns ROUND(num / 2^9) */
-template <> inline uint32_t shiftround<uint32_t, 9>(const uint32_t num) {
-  if (num & 0x00000100u) return (num >> 9) + 1u;
-  return num >> 9;
-}
-
-/* Returns ROUND(num / 2^10) */
-template <> inline uint32_t shiftround<uint32_t, 10>(const uint32_t num) {
-  if (num & 0x00000200u) return (num >> 10) + 1u;
-  return num >> 10;
-}
-
-/* Returns ROUND(num / 2^11) */
-template <> inline uint32_t shiftround<uint32_t, 11>(const uint32_t num) {
-  if (num & 0x00000400u) return (num >> 11) + 1u;
-  return num >> 11;
-}
-
-/* Returns ROUND(num / 2^12) */
-template <> inline uint32_t shiftround<uint32_t, 12>(const uint32_t num) {
-  if (num & 0x00000800u) return (num >> 12) + 1u;
-  return num >> 12;
-}
-
-/* Returns ROUND(num / 2^13) */
-template <> inline uint32_t shiftround<uint32_t, 13>(const uint32_t num) {
-  if (num & 0x00001000u) return (num >> 13) + 1u;
-  return num >> 13;
-}
-
-/* Returns ROUND(num / 2^14) */
-template <> inline uint32_t shiftround<uint32_t, 14>(const uint32_t num) {
-  if (num & 0x00002000u) return (num >> 14) + 1u;
-  return num >> 14;
-}
-
-/* Returns ROUND(num / 2^15) */
-template <> inline uint32_t shiftround<uint32_t, 15>(const uint32_t num) {
-  if (num & 0x00004000u) return (num >> 15) + 1u;
-  return num >> 15;
-}
-
-/* Returns ROUND(num / 2^16) */
-template <> inline uint32_t shiftround<uint32_t, 16>(const uint32_t num) {
-  if (num & 0x00008000u) return (num >> 16) + 1u;
-  return num >> 16;
-}
-
-/* Returns ROUND(num / 2^17) */
-template <> inline uint32_t shiftround<uint32_t, 17>(const uint32_t num) {
-  if (num & 0x00010000u) return (num >> 17) + 1u;
-  return num >> 17;
-}
-
-/* Returns ROUND(num / 2^18) */
-template <> inline uint32_t shiftround<uint32_t, 18>(const uint32_t num) {
-  if (num & 0x00020000u) return (num >> 18) + 1u;
-  return num >> 18;
-}
-
-/* Returns ROUND(num / 2^19) */
-template <> inline uint32_t shiftround<uint32_t, 19>(const uint32_t num) {
-  if (num & 0x00040000u) return (num >> 19) + 1u;
-  return num >> 19;
-}
-
-/* Returns ROUND(num / 2^20) */
-template <> inline uint32_t shiftround<uint32_t, 20>(const uint32_t num) {
-  if (num & 0x00080000u) return (num >> 20) + 1u;
-  return num >> 20;
-}
-
-/* Returns ROUND(num / 2^21) */
-template <> inline uint32_t shiftround<uint32_t, 21>(const uint32_t num) {
-  if (num & 0x00100000u) return (num >> 21) + 1u;
-  return num >> 21;
-}
-
-/* Returns ROUND(num / 2^22) */
-template <> inline uint32_t shiftround<uint32_t, 22>(const uint32_t num) {
-  if (num & 0x00200000u) return (num >> 22) + 1u;
-  return num >> 22;
-}
-
-/* Returns ROUND(num / 2^23) */
-template <> inline uint32_t shiftround<uint32_t, 23>(const uint32_t num) {
-  if (num & 0x00400000u) return (num >> 23) + 1u;
-  return num >> 23;
-}
-
-/* Returns ROUND(num / 2^24) */
-template <> inline uint32_t shiftround<uint32_t, 24>(const uint32_t num) {
-  if (num & 0x00800000u) return (num >> 24) + 1u;
-  return num >> 24;
-}
-
-/* Returns ROUND(num / 2^25) */
-template <> inline uint32_t shiftround<uint32_t, 25>(const uint32_t num) {
-  if (num & 0x01000000u) return (num >> 25) + 1u;
-  return num >> 25;
-}
-
-/* Returns ROUND(num / 2^26) */
-template <> inline uint32_t shiftround<uint32_t, 26>(const uint32_t num) {
-  if (num & 0x02000000u) return (num >> 26) + 1u;
-  return num >> 26;
-}
-
-/* Returns ROUND(num / 2^27) */
-template <> inline uint32_t shiftround<uint32_t, 27>(const uint32_t num) {
-  if (num & 0x04000000u) return (num >> 27) + 1u;
-  return num >> 27;
-}
-
-/* Returns ROUND(num / 2^28) */
-template <> inline uint32_t shiftround<uint32_t, 28>(const uint32_t num) {
-  if (num & 0x08000000u) return (num >> 28) + 1u;
-  return num >> 28;
-}
-
-/* Returns ROUND(num / 2^29) */
-template <> inline uint32_t shiftround<uint32_t, 29>(const uint32_t num) {
-  if (num & 0x10000000u) return (num >> 29) + 1u;
-  return num >> 29;
-}
-
-/* Returns ROUND(num / 2^30) */
-template <> inline uint32_t shiftround<uint32_t, 30>(const uint32_t num) {
-  if (num & 0x20000000u) return (num >> 30) + 1u;
-  return num >> 30;
-}
-
-/* Returns ROUND(num / 2^31) */
-template <> inline uint32_t shiftround<uint32_t, 31>(const uint32_t num) {
-  if (num & 0x40000000u) return (num >> 31) + 1u;
-  return num >> 31;
-}
-
-/********************************************************************************
- ********                uint64_t template specializations                ********
- ********************************************************************************/
-
-/* Returns ROUND(num / 2^1) */
-template <> inline uint64_t shiftround<uint64_t, 1>(const uint64_t num) {
-  if (num & 0x0000000000000001ull) return (num >> 1) + 1ull;
-  return num >> 1;
-}
-
-/* Returns ROUND(num / 2^2) */
-template <> inline uint64_t shiftround<uint64_t, 2>(const uint64_t num) {
-  if (num & 0x0000000000000002ull) return (num >> 2) + 1ull;
-  return num >> 2;
-}
-
-/* Returns ROUND(num / 2^3) */
-template <> inline uint64_t shiftround<uint64_t, 3>(const uint64_t num) {
-  if (num & 0x0000000000000004ull) return (num >> 3) + 1ull;
-  return num >> 3;
-}
-
-/* Returns ROUND(num / 2^4) */
-template <> inline uint64_t shiftround<uint64_t, 4>(const uint64_t num) {
-  if (num & 0x0000000000000008ull) return (num >> 4) + 1ull;
-  return num >> 4;
-}
-
-/* Returns ROUND(num / 2^5) */
-template <> inline uint64_t shiftround<uint64_t, 5>(const uint64_t num) {
-  if (num & 0x0000000000000010ull) return (num >> 5) + 1ull;
-  return num >> 5;
-}
-
-/* Returns ROUND(num / 2^6) */
-template <> inline uint64_t shiftround<uint64_t, 6>(const uint64_t num) {
-  if (num & 0x0000000000000020ull) return (num >> 6) + 1ull;
-  return num >> 6;
-}
-
-/* Returns ROUND(num / 2^7) */
-template <> inline uint64_t shiftround<uint64_t, 7>(const uint64_t num) {
-  if (num & 0x0000000000000040ull) return (num >> 7) + 1ull;
-  return num >> 7;
-}
-
-/* Returns ROUND(num / 2^8) */
-template <> inline uint64_t shiftround<uint64_t, 8>(const uint64_t num) {
-  if (num & 0x0000000000000080ull) return (num >> 8) + 1ull;
-  return num >> 8;
-}
-
-/* Returns ROUND(num / 2^9) */
-template <> inline uint64_t shiftround<uint64_t, 9>(const uint64_t num) {
-  if (num & 0x0000000000000100ull) return (num >> 9) + 1ull;
-  return num >> 9;
-}
-
-/* Returns ROUND(num / 2^10) */
-template <> inline uint64_t shiftround<uint64_t, 10>(const uint64_t num) {
-  if (num & 0x0000000000000200ull) return (num >> 10) + 1ull;
-  return num >> 10;
-}
-
-/* Returns ROUND(num / 2^11) */
-template <> inline uint64_t shiftround<uint64_t, 11>(const uint64_t num) {
-  if (num & 0x0000000000000400ull) return (num >> 11) + 1ull;
-  return num >> 11;
-}
-
-/* Returns ROUND(num / 2^12) */
-template <> inline uint64_t shiftround<uint64_t, 12>(const uint64_t num) {
-  if (num & 0x0000000000000800ull) return (num >> 12) + 1ull;
-  return num >> 12;
-}
-
-/* Returns ROUND(num / 2^13) */
-template <> inline uint64_t shiftround<uint64_t, 13>(const uint64_t num) {
-  if (num & 0x0000000000001000ull) return (num >> 13) + 1ull;
-  return num >> 13;
-}
-
-/* Returns ROUND(num / 2^14) */
-template <> inline uint64_t shiftround<uint64_t, 14>(const uint64_t num) {
-  if (num & 0x0000000000002000ull) return (num >> 14) + 1ull;
-  return num >> 14;
-}
-
-/* Returns ROUND(num / 2^15) */
-template <> inline uint64_t shiftround<uint64_t, 15>(const uint64_t num) {
-  if (num & 0x0000000000004000ull) return (num >> 15) + 1ull;
-  return num >> 15;
-}
-
-/* Returns ROUND(num / 2^16) */
-template <> inline uint64_t shiftround<uint64_t, 16>(const uint64_t num) {
-  if (num & 0x0000000000008000ull) return (num >> 16) + 1ull;
-  return num >> 16;
-}
-
-/* Returns ROUND(num / 2^17) */
-template <> inline uint64_t shiftround<uint64_t, 17>(const uint64_t num) {
-  if (num & 0x0000000000010000ull) return (num >> 17) + 1ull;
-  return num >> 17;
-}
-
-/* Returns ROUND(num / 2^18) */
-template <> inline uint64_t shiftround<uint64_t, 18>(const uint64_t num) {
-  if (num & 0x0000000000020000ull) return (num >> 18) + 1ull;
-  return num >> 18;
-}
-
-/* Returns ROUND(num / 2^19) */
-template <> inline uint64_t shiftround<uint64_t, 19>(const uint64_t num) {
-  if (num & 0x0000000000040000ull) return (num >> 19) + 1ull;
-  return num >> 19;
-}
-
-/* Returns ROUND(num / 2^20) */
-template <> inline uint64_t shiftround<uint64_t, 20>(const uint64_t num) {
-  if (num & 0x0000000000080000ull) return (num >> 20) + 1ull;
-  return num >> 20;
-}
-
-/* Returns ROUND(num / 2^21) */
-template <> inline uint64_t shiftround<uint64_t, 21>(const uint64_t num) {
-  if (num & 0x0000000000100000ull) return (num >> 21) + 1ull;
-  return num >> 21;
-}
-
-/* Returns ROUND(num / 2^22) */
-template <> inline uint64_t shiftround<uint64_t, 22>(const uint64_t num) {
-  if (num & 0x0000000000200000ull) return (num >> 22) + 1ull;
-  return num >> 22;
-}
-
-/* Returns ROUND(num / 2^23) */
-template <> inline uint64_t shiftround<uint64_t, 23>(const uint64_t num) {
-  if (num & 0x0000000000400000ull) return (num >> 23) + 1ull;
-  return num >> 23;
-}
-
-/* Returns ROUND(num / 2^24) */
-template <> inline uint64_t shiftround<uint64_t, 24>(const uint64_t num) {
-  if (num & 0x0000000000800000ull) return (num >> 24) + 1ull;
-  return num >> 24;
-}
-
-/* Returns ROUND(num / 2^25) */
-template <> inline uint64_t shiftround<uint64_t, 25>(const uint64_t num) {
-  if (num & 0x0000000001000000ull) return (num >> 25) + 1ull;
-  return num >> 25;
-}
-
-/* Returns ROUND(num / 2^26) */
-template <> inline uint64_t shiftround<uint64_t, 26>(const uint64_t num) {
-  if (num & 0x0000000002000000ull) return (num >> 26) + 1ull;
-  return num >> 26;
-}
-
-/* Returns ROUND(num / 2^27) */
-template <> inline uint64_t shiftround<uint64_t, 27>(const uint64_t num) {
-  if (num & 0x0000000004000000ull) return (num >> 27) + 1ull;
-  return num >> 27;
-}
-
-/* Returns ROUND(num / 2^28) */
-template <> inline uint64_t shiftround<uint64_t, 28>(const uint64_t num) {
-  if (num & 0x0000000008000000ull) return (num >> 28) + 1ull;
-  return num >> 28;
-}
-
-/* Returns ROUND(num / 2^29) */
-template <> inline uint64_t shiftround<uint64_t, 29>(const uint64_t num) {
-  if (num & 0x0000000010000000ull) return (num >> 29) + 1ull;
-  return num >> 29;
-}
-
-/* Returns ROUND(num / 2^30) */
-template <> inline uint64_t shiftround<uint64_t, 30>(const uint64_t num) {
-  if (num & 0x0000000020000000ull) return (num >> 30) + 1ull;
-  return num >> 30;
-}
-
-/* Returns ROUND(num / 2^31) */
-template <> inline uint64_t shiftround<uint64_t, 31>(const uint64_t num) {
-  if (num & 0x0000000040000000ull) return (num >> 31) + 1ull;
-  return num >> 31;
-}
-
-/* Returns ROUND(num / 2^32) */
-template <> inline uint64_t shiftround<uint64_t, 32>(const uint64_t num) {
-  if (num & 0x0000000080000000ull) return (num >> 32) + 1ull;
-  return num >> 32;
-}
-
-/* Returns ROUND(num / 2^33) */
-template <> inline uint64_t shiftround<uint64_t, 33>(const uint64_t num) {
-  if (num & 0x0000000100000000ull) return (num >> 33) + 1ull;
-  return num >> 33;
-}
-
-/* Returns ROUND(num / 2^34) */
-template <> inline uint64_t shiftround<uint64_t, 34>(const uint64_t num) {
-  if (num & 0x0000000200000000ull) return (num >> 34) + 1ull;
-  return num >> 34;
-}
-
-/* Returns ROUND(num / 2^35) */
-template <> inline uint64_t shiftround<uint64_t, 35>(const uint64_t num) {
-  if (num & 0x0000000400000000ull) return (num >> 35) + 1ull;
-  return num >> 35;
-}
-
-/* Returns ROUND(num / 2^36) */
-template <> inline uint64_t shiftround<uint64_t, 36>(const uint64_t num) {
-  if (num & 0x0000000800000000ull) return (num >> 36) + 1ull;
-  return num >> 36;
-}
-
-/* Returns ROUND(num / 2^37) */
-template <> inline uint64_t shiftround<uint64_t, 37>(const uint64_t num) {
-  if (num & 0x0000001000000000ull) return (num >> 37) + 1ull;
-  return num >> 37;
-}
-
-/* Returns ROUND(num / 2^38) */
-template <> inline uint64_t shiftround<uint64_t, 38>(const uint64_t num) {
-  if (num & 0x0000002000000000ull) return (num >> 38) + 1ull;
-  return num >> 38;
-}
-
-/* Returns ROUND(num / 2^39) */
-template <> inline uint64_t shiftround<uint64_t, 39>(const uint64_t num) {
-  if (num & 0x0000004000000000ull) return (num >> 39) + 1ull;
-  return num >> 39;
-}
-
-/* Returns ROUND(num / 2^40) */
-template <> inline uint64_t shiftround<uint64_t, 40>(const uint64_t num) {
-  if (num & 0x0000008000000000ull) return (num >> 40) + 1ull;
-  return num >> 40;
-}
-
-/* Returns ROUND(num / 2^41) */
-template <> inline uint64_t shiftround<uint64_t, 41>(const uint64_t num) {
-  if (num & 0x0000010000000000ull) return (num >> 41) + 1ull;
-  return num >> 41;
-}
-
-/* Returns ROUND(num / 2^42) */
-template <> inline uint64_t shiftround<uint64_t, 42>(const uint64_t num) {
-  if (num & 0x0000020000000000ull) return (num >> 42) + 1ull;
-  return num >> 42;
-}
-
-/* Returns ROUND(num / 2^43) */
-template <> inline uint64_t shiftround<uint64_t, 43>(const uint64_t num) {
-  if (num & 0x0000040000000000ull) return (num >> 43) + 1ull;
-  return num >> 43;
-}
-
-/* Returns ROUND(num / 2^44) */
-template <> inline uint64_t shiftround<uint64_t, 44>(const uint64_t num) {
-  if (num & 0x0000080000000000ull) return (num >> 44) + 1ull;
-  return num >> 44;
-}
-
-/* Returns ROUND(num / 2^45) */
-template <> inline uint64_t shiftround<uint64_t, 45>(const uint64_t num) {
-  if (num & 0x0000100000000000ull) return (num >> 45) + 1ull;
-  return num >> 45;
-}
-
-/* Returns ROUND(num / 2^46) */
-template <> inline uint64_t shiftround<uint64_t, 46>(const uint64_t num) {
-  if (num & 0x0000200000000000ull) return (num >> 46) + 1ull;
-  return num >> 46;
-}
-
-/* Returns ROUND(num / 2^47) */
-template <> inline uint64_t shiftround<uint64_t, 47>(const uint64_t num) {
-  if (num & 0x0000400000000000ull) return (num >> 47) + 1ull;
-  return num >> 47;
-}
-
-/* Returns ROUND(num / 2^48) */
-template <> inline uint64_t shiftround<uint64_t, 48>(const uint64_t num) {
-  if (num & 0x0000800000000000ull) return (num >> 48) + 1ull;
-  return num >> 48;
-}
-
-/* Returns ROUND(num / 2^49) */
-template <> inline uint64_t shiftround<uint64_t, 49>(const uint64_t num) {
-  if (num & 0x0001000000000000ull) return (num >> 49) + 1ull;
-  return num >> 49;
-}
-
-/* Returns ROUND(num / 2^50) */
-template <> inline uint64_t shiftround<uint64_t, 50>(const uint64_t num) {
-  if (num & 0x0002000000000000ull) return (num >> 50) + 1ull;
-  return num >> 50;
-}
-
-/* Returns ROUND(num / 2^51) */
-template <> inline uint64_t shiftround<uint64_t, 51>(const uint64_t num) {
-  if (num & 0x0004000000000000ull) return (num >> 51) + 1ull;
-  return num >> 51;
-}
-
-/* Returns ROUND(num / 2^52) */
-template <> inline uint64_t shiftround<uint64_t, 52>(const uint64_t num) {
-  if (num & 0x0008000000000000ull) return (num >> 52) + 1ull;
-  return num >> 52;
-}
-
-/* Returns ROUND(num / 2^53) */
-template <> inline uint64_t shiftround<uint64_t, 53>(const uint64_t num) {
-  if (num & 0x0010000000000000ull) return (num >> 53) + 1ull;
-  return num >> 53;
-}
-
-/* Returns ROUND(num / 2^54) */
-template <> inline uint64_t shiftround<uint64_t, 54>(const uint64_t num) {
-  if (num & 0x0020000000000000ull) return (num >> 54) + 1ull;
-  return num >> 54;
-}
-
-/* Returns ROUND(num / 2^55) */
-template <> inline uint64_t shiftround<uint64_t, 55>(const uint64_t num) {
-  if (num & 0x0040000000000000ull) return (num >> 55) + 1ull;
-  return num >> 55;
-}
-
-/* Returns ROUND(num / 2^56) */
-template <> inline uint64_t shiftround<uint64_t, 56>(const uint64_t num) {
-  if (num & 0x0080000000000000ull) return (num >> 56) + 1ull;
-  return num >> 56;
-}
-
-/* Returns ROUND(num / 2^57) */
-template <> inline uint64_t shiftround<uint64_t, 57>(const uint64_t num) {
-  if (num & 0x0100000000000000ull) return (num >> 57) + 1ull;
-  return num >> 57;
+#ifdef BRANCHLESS_ROUNDING
+/**
+ * Signed types, BRANCHLESS_ROUNDING: the low shift bits of num plus half,
+ * less one when num is negative, carry into bit shift exactly when num
+ * rounds up. The sum is never negative and never leaves utype, so the
+ * correction is added without a compare or branch.
+ */
+template <typename type, uint8_t shift> constexpr type shiftround_comp_round(const type num, std::true_type /* is_signed */) {
+  typedef typename std::make_unsigned<type>::type utype;
+  return static_cast<type>((num >> shift) +
+         static_cast<type>(((static_cast<utype>(num) & ((static_cast<utype>(1) << shift) - 1u)) + (static_cast<utype>(1) << (shift - 1u)) -
+                            (static_cast<utype>(num) >> std::numeric_limits<type>::digits)) >> shift));
 }
 
-/* Returns ROUND(num / 2^58) */
-template <> inline uint64_t shiftround<uint64_t, 58>(const uint64_t num) {
-  if (num & 0x0200000000000000ull) return (num >> 58) + 1ull;
-  return num >> 58;
+/* Unsigned types, BRANCHLESS_ROUNDING: add the bit below the result. */
+template <typename type, uint8_t shift> constexpr type shiftround_comp_round(const type num, std::false_type /* is_signed */) {
+  return static_cast<type>((num >> shift) + ((num >> (shift - 1u)) & static_cast<type>(1)));
 }
-
-/* Returns ROUND(num / 2^59) */
-template <> inline uint64_t shiftround<uint64_t, 59>(const uint64_t num) {
-  if (num & 0x0400000000000000ull) return (num >> 59) + 1ull;
-  return num >> 59;
+#else
+/**
+ * Signed types: round up when the bit below the result is set, unless num
+ * is negative and every lower bit is clear (an exact negative half, which
+ * the arithmetic right shift already rounds away from zero). For shift = 1
+ * the two tests fold into one. sign_half and sign_mask are unsigned so that
+ * 32-bit and 64-bit num compare as unsigned while 8-bit and 16-bit num are
+ * promoted to int, as in the hand written routines this replaced.
+ */
+template <typename type, uint8_t shift> constexpr type shiftround_comp_round(const type num, std::true_type /* is_signed */) {
+  typedef typename std::make_unsigned<type>::type utype;
+  return (shift == 1u)
+         ? (((num & static_cast<utype>((static_cast<utype>(1) << std::numeric_limits<type>::digits) | 1u)) == static_cast<type>(1))
+            ? static_cast<type>((num >> shift) + static_cast<type>(1)) : static_cast<type>(num >> shift))
+         : (((num & static_cast<type>(static_cast<utype>(1) << (shift - 1u))) &&
+             ((num & static_cast<utype>((static_cast<utype>(1) << std::numeric_limits<type>::digits) | ((static_cast<utype>(1) << shift) - 1u))) !=
+              static_cast<utype>((static_cast<utype>(1) << std::numeric_limits<type>::digits) | (static_cast<utype>(1) << (shift - 1u)))))
+            ? static_cast<type>((num >> shift) + static_cast<type>(1)) : static_cast<type>(num >> shift));
 }
 
-/* Returns ROUND(num / 2^60) */
-template <> inline uint64_t shiftround<uint64_t, 60>(const uint64_t num) {
-  if (num & 0x0800000000000000ull) return (num >> 60) + 1ull;
-  return num >> 60;
+/* Unsigned types: round up when the bit below the result is set. */
+template <typename type, uint8_t shift> constexpr type shiftround_comp_round(const type num, std::false_type /* is_signed */) {
+  return (num & (static_cast<type>(1) << (shift - 1u))) ? static_cast<type>((num >> shift) + static_cast<type>(1)) : static_cast<type>(num >> shift);
 }
+#endif /* #ifdef BRANCHLESS_ROUNDING */
 
-/* Returns ROUND(num / 2^61) */
-template <> inline uint64_t shiftround<uint64_t, 61>(const uint64_t num) {
-  if (num & 0x1000000000000000ull) return (num >> 61) + 1ull;
-  return num >> 61;
+/* round_half_away is shiftround_comp_round; the other policies use rounding_policy.hpp. */
+template <typename type, uint8_t shift> constexpr type shiftround_comp_policy(const type num, round_half_away) {
+  return shiftround_comp_round<type, shift>(num, std::is_signed<type>());
 }
 
-/* Returns ROUND(num / 2^62) */
-template <> inline uint64_t shiftround<uint64_t, 62>(const uint64_t num) {
-  if (num & 0x2000000000000000ull) return (num >> 62) + 1ull;
-  return num >> 62;
+template <typename type, uint8_t shift, typename rounding> constexpr type shiftround_comp_policy(const type num, rounding) {
+  return rounding_policy_shift<type>(num, shift, rounding());
 }
 
-/* Returns ROUND(num / 2^63) */
-template <> inline uint64_t shiftround<uint64_t, 63>(const uint64_t num) {
-  if (num & 0x4000000000000000ull) return (num >> 63) + 1ull;
-  return num >> 63;
+/**
+ * Returns ROUND(num / 2^shift), or num / 2^shift rounded as selected by
+ * rounding, one of the tags in rounding_policy.hpp.
+ */
+template <typename type, uint8_t shift, typename rounding = round_half_away> constexpr type shiftround(const type num) {
+  static_assert(shiftround_comp_valid<type, shift>(), "type shiftround<type,shift>(const type num); is not defined for the specified type and/or shift value.");
+  static_assert(is_rounding_policy<rounding>::value, "type shiftround<type,shift,rounding>(const type num); rounding must be a tag from rounding_policy.hpp.");
+  return shiftround_comp_policy<type, (shiftround_comp_valid<type, shift>() ? shift : 1u)>(num, rounding());
 }
 
 #endif /* #ifndef SHIFTROUND_COMP_HPP_ */
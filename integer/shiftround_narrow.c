@@ -0,0 +1,1220 @@
+/**
+ * shiftround_narrow.c
+ * Defines functions of the form
+ *   void shiftround_narrow_sat_X_Y(const from_type *num, const size_t length, const uint8_t shift, to_type *result);
+ * which store ROUND(num[j] / 2^shift), saturated to the range of to_type,
+ * into result[j] for j on [0, length - 1]. X and Y are the type
+ * abbreviations of from_type and to_type, and to_type is half as wide as
+ * from_type.
+ *
+ * Each function rounds with the branchless form of shiftround_X from
+ * shiftround_run.c in every lane and then narrows with a saturating pack
+ * (packsswb, packuswb, packssdw, packusdw) or, with AVX-512, a saturating
+ * down-conversion (vpmovswb, vpmovuswb, vpmovsdw, vpmovusdw, vpmovsqd,
+ * vpmovusqd). An unsigned from_type narrowed to a signed to_type is first
+ * limited to the maximum of to_type with an unsigned minimum, since the
+ * signed packs would read it as signed. The widest kernel the processor
+ * supports is picked at run time with cpu_features() from cpu_features.c,
+ * so the file needs no instruction set flags on the compiler command
+ * line. Below AVX-512 the 64-bit types use the scalar loop, since there
+ * is neither a 64-bit arithmetic right shift, a 64-bit unsigned minimum,
+ * nor a 64-bit pack before it. Other targets always use the scalar loop.
+ *
+ * The rounding masks are computed from shift, so neither ARRAY_MASKS nor
+ * COMPUTED_MASKS applies to this file.
+ *
+ * If you #define DEBUG_INTMATH, checks for invalid shift arguments will be
+ * enabled. This requires the availability of stderr and fprintf() on the
+ * target system and is most appropriate for testing purposes.
+ *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * Correct operation for negative signed inputs requires two things:
+ * 1. The representation of signed integers must be 2's complement.
+ * 2. The compiler must encode right shifts on signed types as arithmetic
+ *    right shifts rather than logical right shifts.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef SHIFTROUND_NARROW_C_
+#define SHIFTROUND_NARROW_C_
+
+#include "shiftround_narrow.h"
+#include "cpu_features.h"
+
+#ifdef DEBUG_INTMATH
+  #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
+#endif
+
+/**
+ * GCC and Clang only emit vector instructions in functions carrying the
+ * matching target attribute when the instruction set is not enabled on
+ * the command line. MSVC allows any intrinsic in any function.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define SHIFTROUND_NARROW_X86
+  #define SHIFTROUND_NARROW_TARGET_SSE2 __attribute__((target("sse2")))
+  #define SHIFTROUND_NARROW_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+  #define SHIFTROUND_NARROW_TARGET_AVX2 __attribute__((target("avx2")))
+  #define SHIFTROUND_NARROW_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #define SHIFTROUND_NARROW_X86
+  #define SHIFTROUND_NARROW_TARGET_SSE2
+  #define SHIFTROUND_NARROW_TARGET_SSE4_1
+  #define SHIFTROUND_NARROW_TARGET_AVX2
+  #define SHIFTROUND_NARROW_TARGET_AVX512
+#endif
+
+#ifdef SHIFTROUND_NARROW_X86
+  #include "immintrin.h"
+#endif
+
+/********************************************************************************
+ ********                         scalar kernels                         ********
+ ********************************************************************************/
+
+/**
+ * These helpers are the BRANCHLESS_ROUNDING form of shiftround_X with the
+ * masks computed from shift. The low shift bits plus half a step, less 1
+ * for a negative num, carry into bit shift exactly when num must round
+ * away from zero. round_negative keeps that 1 out when shift is 0.
+ * The 16-bit results are returned in 32 bits so the callers compare
+ * without integer promotion surprises.
+ */
+static inline int32_t shiftround_narrow_round_i16(const int16_t num, const uint8_t shift) {
+  const uint16_t low_mask = (uint16_t)(((uint32_t)1 << shift) - 1u);
+  const uint16_t half = (uint16_t)(((uint32_t)1 << shift) >> 1);
+  const uint16_t round_negative = (shift != (uint8_t)0) ? (uint16_t)1 : (uint16_t)0;
+  const uint16_t carry = (uint16_t)(((uint16_t)num & low_mask) + half - (((uint16_t)num >> 15) & round_negative));
+  return (int32_t)(num >> shift) + (int32_t)(carry >> shift);
+}
+
+static inline uint32_t shiftround_narrow_round_u16(const uint16_t num, const uint8_t shift) {
+  const uint16_t low_mask = (uint16_t)(((uint32_t)1 << shift) - 1u);
+  const uint16_t half = (uint16_t)(((uint32_t)1 << shift) >> 1);
+  const uint16_t carry = (uint16_t)((num & low_mask) + half);
+  return (uint32_t)(num >> shift) + (uint32_t)(carry >> shift);
+}
+
+static inline int32_t shiftround_narrow_round_i32(const int32_t num, const uint8_t shift) {
+  const uint32_t low_mask = ((uint32_t)1 << shift) - 1u;
+  const uint32_t half = ((uint32_t)1 << shift) >> 1;
+  const uint32_t round_negative = (shift != (uint8_t)0) ? 1u : 0u;
+  const uint32_t carry = ((uint32_t)num & low_mask) + half - (((uint32_t)num >> 31) & round_negative);
+  return (num >> shift) + (int32_t)(carry >> shift);
+}
+
+static inline uint32_t shiftround_narrow_round_u32(const uint32_t num, const uint8_t shift) {
+  const uint32_t low_mask = ((uint32_t)1 << shift) - 1u;
+  const uint32_t half = ((uint32_t)1 << shift) >> 1;
+  return (num >> shift) + (((num & low_mask) + half) >> shift);
+}
+
+static inline int64_t shiftround_narrow_round_i64(const int64_t num, const uint8_t shift) {
+  const uint64_t low_mask = (1ull << shift) - 1ull;
+  const uint64_t half = (1ull << shift) >> 1;
+  const uint64_t round_negative = (shift != (uint8_t)0) ? 1ull : 0ull;
+  const uint64_t carry = ((uint64_t)num & low_mask) + half - (((uint64_t)num >> 63) & round_negative);
+  return (num >> shift) + (int64_t)(carry >> shift);
+}
+
+static inline uint64_t shiftround_narrow_round_u64(const uint64_t num, const uint8_t shift) {
+  const uint64_t low_mask = (1ull << shift) - 1ull;
+  const uint64_t half = (1ull << shift) >> 1;
+  return (num >> shift) + (((num & low_mask) + half) >> shift);
+}
+
+/**
+ * These loops process the elements that do not fill a whole vector and
+ * are the whole implementation on processors without SSE2 and on
+ * non-x86 targets.
+ */
+static inline void shiftround_narrow_sat_i16_i8_scalar(const int16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const int32_t rounded = shiftround_narrow_round_i16(num[j], shift);
+    result[j] = (rounded < INT8_MIN) ? (int8_t)INT8_MIN : ((rounded > INT8_MAX) ? (int8_t)INT8_MAX : (int8_t)rounded);
+  }
+}
+
+static inline void shiftround_narrow_sat_i16_u8_scalar(const int16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const int32_t rounded = shiftround_narrow_round_i16(num[j], shift);
+    result[j] = (rounded < 0) ? (uint8_t)0 : ((rounded > UINT8_MAX) ? (uint8_t)UINT8_MAX : (uint8_t)rounded);
+  }
+}
+
+static inline void shiftround_narrow_sat_u16_u8_scalar(const uint16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const uint32_t rounded = shiftround_narrow_round_u16(num[j], shift);
+    result[j] = (rounded > UINT8_MAX) ? (uint8_t)UINT8_MAX : (uint8_t)rounded;
+  }
+}
+
+static inline void shiftround_narrow_sat_u16_i8_scalar(const uint16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const uint32_t rounded = shiftround_narrow_round_u16(num[j], shift);
+    result[j] = (rounded > INT8_MAX) ? (int8_t)INT8_MAX : (int8_t)rounded;
+  }
+}
+
+static inline void shiftround_narrow_sat_i32_i16_scalar(const int32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const int32_t rounded = shiftround_narrow_round_i32(num[j], shift);
+    result[j] = (rounded < INT16_MIN) ? (int16_t)INT16_MIN : ((rounded > INT16_MAX) ? (int16_t)INT16_MAX : (int16_t)rounded);
+  }
+}
+
+static inline void shiftround_narrow_sat_i32_u16_scalar(const int32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const int32_t rounded = shiftround_narrow_round_i32(num[j], shift);
+    result[j] = (rounded < 0) ? (uint16_t)0 : ((rounded > UINT16_MAX) ? (uint16_t)UINT16_MAX : (uint16_t)rounded);
+  }
+}
+
+static inline void shiftround_narrow_sat_u32_u16_scalar(const uint32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const uint32_t rounded = shiftround_narrow_round_u32(num[j], shift);
+    result[j] = (rounded > UINT16_MAX) ? (uint16_t)UINT16_MAX : (uint16_t)rounded;
+  }
+}
+
+static inline void shiftround_narrow_sat_u32_i16_scalar(const uint32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const uint32_t rounded = shiftround_narrow_round_u32(num[j], shift);
+    result[j] = (rounded > INT16_MAX) ? (int16_t)INT16_MAX : (int16_t)rounded;
+  }
+}
+
+static inline void shiftround_narrow_sat_i64_i32_scalar(const int64_t *num, const size_t length, const uint8_t shift, int32_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const int64_t rounded = shiftround_narrow_round_i64(num[j], shift);
+    result[j] = (rounded < INT32_MIN) ? (int32_t)INT32_MIN : ((rounded > INT32_MAX) ? (int32_t)INT32_MAX : (int32_t)rounded);
+  }
+}
+
+static inline void shiftround_narrow_sat_i64_u32_scalar(const int64_t *num, const size_t length, const uint8_t shift, uint32_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const int64_t rounded = shiftround_narrow_round_i64(num[j], shift);
+    result[j] = (rounded < 0) ? (uint32_t)0 : ((rounded > (int64_t)UINT32_MAX) ? (uint32_t)UINT32_MAX : (uint32_t)rounded);
+  }
+}
+
+static inline void shiftround_narrow_sat_u64_u32_scalar(const uint64_t *num, const size_t length, const uint8_t shift, uint32_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const uint64_t rounded = shiftround_narrow_round_u64(num[j], shift);
+    result[j] = (rounded > UINT32_MAX) ? (uint32_t)UINT32_MAX : (uint32_t)rounded;
+  }
+}
+
+static inline void shiftround_narrow_sat_u64_i32_scalar(const uint64_t *num, const size_t length, const uint8_t shift, int32_t *result) {
+  size_t j;
+  for (j = 0u; j < length; j++) {
+    const uint64_t rounded = shiftround_narrow_round_u64(num[j], shift);
+    result[j] = (rounded > INT32_MAX) ? (int32_t)INT32_MAX : (int32_t)rounded;
+  }
+}
+
+#ifdef SHIFTROUND_NARROW_X86
+
+/********************************************************************************
+ ********                          SSE2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * The vector helpers repeat the scalar rounding in every lane. The shift
+ * count sits in the low quadword of count as psraw, psrlw, and friends
+ * expect, and round_negative is all ones when shift is nonzero. Adding
+ * the arithmetically shifted sign bit (0 or -1) subtracts 1 for negative
+ * lanes. packsswb and packssdw saturate signed lanes, packuswb saturates
+ * signed lanes to unsigned bytes, and uint16_t lanes are first limited to
+ * 255 or 127 with a saturating subtract, since SSE2 has no pminuw. SSE2
+ * has no packusdw or pminud either, so the pairs from 32 bits to uint16_t
+ * and from uint32_t start at SSE4.1.
+ */
+SHIFTROUND_NARROW_TARGET_SSE2 static inline __m128i shiftround_narrow_round_epi16_sse2(const __m128i x, const __m128i count, const __m128i low_mask, const __m128i half, const __m128i round_negative) {
+  const __m128i negative = _mm_and_si128(_mm_srai_epi16(x, 15), round_negative);
+  const __m128i carry = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(x, low_mask), half), negative);
+  return _mm_add_epi16(_mm_sra_epi16(x, count), _mm_srl_epi16(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline __m128i shiftround_narrow_round_epu16_sse2(const __m128i x, const __m128i count, const __m128i low_mask, const __m128i half) {
+  const __m128i carry = _mm_add_epi16(_mm_and_si128(x, low_mask), half);
+  return _mm_add_epi16(_mm_srl_epi16(x, count), _mm_srl_epi16(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline __m128i shiftround_narrow_round_epi32_sse2(const __m128i x, const __m128i count, const __m128i low_mask, const __m128i half, const __m128i round_negative) {
+  const __m128i negative = _mm_and_si128(_mm_srai_epi32(x, 31), round_negative);
+  const __m128i carry = _mm_add_epi32(_mm_add_epi32(_mm_and_si128(x, low_mask), half), negative);
+  return _mm_add_epi32(_mm_sra_epi32(x, count), _mm_srl_epi32(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline __m128i shiftround_narrow_round_epu32_sse2(const __m128i x, const __m128i count, const __m128i low_mask, const __m128i half) {
+  const __m128i carry = _mm_add_epi32(_mm_and_si128(x, low_mask), half);
+  return _mm_add_epi32(_mm_srl_epi32(x, count), _mm_srl_epi32(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline void shiftround_narrow_sat_i16_i8_sse2(const int16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m128i round_negative = _mm_set1_epi16((shift != (uint8_t)0) ? (int16_t)-1 : (int16_t)0);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m128i a = shiftround_narrow_round_epi16_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half, round_negative);
+    const __m128i b = shiftround_narrow_round_epi16_sse2(_mm_loadu_si128((const __m128i *)(num + j + 8u)), count, low_mask, half, round_negative);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packs_epi16(a, b));
+  }
+  shiftround_narrow_sat_i16_i8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline void shiftround_narrow_sat_i16_u8_sse2(const int16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m128i round_negative = _mm_set1_epi16((shift != (uint8_t)0) ? (int16_t)-1 : (int16_t)0);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m128i a = shiftround_narrow_round_epi16_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half, round_negative);
+    const __m128i b = shiftround_narrow_round_epi16_sse2(_mm_loadu_si128((const __m128i *)(num + j + 8u)), count, low_mask, half, round_negative);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packus_epi16(a, b));
+  }
+  shiftround_narrow_sat_i16_u8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline void shiftround_narrow_sat_u16_u8_sse2(const uint16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m128i max = _mm_set1_epi16((int16_t)UINT8_MAX);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i a = shiftround_narrow_round_epu16_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half);
+    __m128i b = shiftround_narrow_round_epu16_sse2(_mm_loadu_si128((const __m128i *)(num + j + 8u)), count, low_mask, half);
+    a = _mm_sub_epi16(a, _mm_subs_epu16(a, max));
+    b = _mm_sub_epi16(b, _mm_subs_epu16(b, max));
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packus_epi16(a, b));
+  }
+  shiftround_narrow_sat_u16_u8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline void shiftround_narrow_sat_u16_i8_sse2(const uint16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m128i max = _mm_set1_epi16((int16_t)INT8_MAX);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    __m128i a = shiftround_narrow_round_epu16_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half);
+    __m128i b = shiftround_narrow_round_epu16_sse2(_mm_loadu_si128((const __m128i *)(num + j + 8u)), count, low_mask, half);
+    a = _mm_sub_epi16(a, _mm_subs_epu16(a, max));
+    b = _mm_sub_epi16(b, _mm_subs_epu16(b, max));
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packs_epi16(a, b));
+  }
+  shiftround_narrow_sat_u16_i8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_SSE2 static inline void shiftround_narrow_sat_i32_i16_sse2(const int32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m128i round_negative = _mm_set1_epi32((shift != (uint8_t)0) ? -1 : 0);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m128i a = shiftround_narrow_round_epi32_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half, round_negative);
+    const __m128i b = shiftround_narrow_round_epi32_sse2(_mm_loadu_si128((const __m128i *)(num + j + 4u)), count, low_mask, half, round_negative);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packs_epi32(a, b));
+  }
+  shiftround_narrow_sat_i32_i16_scalar(num + j, length - j, shift, result + j);
+}
+
+/********************************************************************************
+ ********                         SSE4.1 kernels                         ********
+ ********************************************************************************/
+
+/**
+ * SSE4.1 adds packusdw for the 32-bit to uint16_t pairs and pminud for
+ * the uint32_t pairs. uint32_t lanes are first limited to 65535 or 32767,
+ * so the pack sees them as nonnegative.
+ */
+SHIFTROUND_NARROW_TARGET_SSE4_1 static inline void shiftround_narrow_sat_i32_u16_sse4_1(const int32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m128i round_negative = _mm_set1_epi32((shift != (uint8_t)0) ? -1 : 0);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m128i a = shiftround_narrow_round_epi32_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half, round_negative);
+    const __m128i b = shiftround_narrow_round_epi32_sse2(_mm_loadu_si128((const __m128i *)(num + j + 4u)), count, low_mask, half, round_negative);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packus_epi32(a, b));
+  }
+  shiftround_narrow_sat_i32_u16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_SSE4_1 static inline void shiftround_narrow_sat_u32_u16_sse4_1(const uint32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m128i max = _mm_set1_epi32((int32_t)UINT16_MAX);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m128i a = shiftround_narrow_round_epu32_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half);
+    const __m128i b = shiftround_narrow_round_epu32_sse2(_mm_loadu_si128((const __m128i *)(num + j + 4u)), count, low_mask, half);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packus_epi32(_mm_min_epu32(a, max), _mm_min_epu32(b, max)));
+  }
+  shiftround_narrow_sat_u32_u16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_SSE4_1 static inline void shiftround_narrow_sat_u32_i16_sse4_1(const uint32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m128i low_mask = _mm_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m128i half = _mm_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m128i max = _mm_set1_epi32((int32_t)INT16_MAX);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m128i a = shiftround_narrow_round_epu32_sse2(_mm_loadu_si128((const __m128i *)(num + j)), count, low_mask, half);
+    const __m128i b = shiftround_narrow_round_epu32_sse2(_mm_loadu_si128((const __m128i *)(num + j + 4u)), count, low_mask, half);
+    _mm_storeu_si128((__m128i *)(result + j), _mm_packs_epi32(_mm_min_epu32(a, max), _mm_min_epu32(b, max)));
+  }
+  shiftround_narrow_sat_u32_i16_scalar(num + j, length - j, shift, result + j);
+}
+
+/********************************************************************************
+ ********                          AVX2 kernels                          ********
+ ********************************************************************************/
+
+/**
+ * The 256-bit packs work within each 128-bit lane, so vpermq with 0xD8
+ * puts the packed quadwords back in element order.
+ */
+SHIFTROUND_NARROW_TARGET_AVX2 static inline __m256i shiftround_narrow_round_epi16_avx2(const __m256i x, const __m128i count, const __m256i low_mask, const __m256i half, const __m256i round_negative) {
+  const __m256i negative = _mm256_and_si256(_mm256_srai_epi16(x, 15), round_negative);
+  const __m256i carry = _mm256_add_epi16(_mm256_add_epi16(_mm256_and_si256(x, low_mask), half), negative);
+  return _mm256_add_epi16(_mm256_sra_epi16(x, count), _mm256_srl_epi16(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline __m256i shiftround_narrow_round_epu16_avx2(const __m256i x, const __m128i count, const __m256i low_mask, const __m256i half) {
+  const __m256i carry = _mm256_add_epi16(_mm256_and_si256(x, low_mask), half);
+  return _mm256_add_epi16(_mm256_srl_epi16(x, count), _mm256_srl_epi16(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline __m256i shiftround_narrow_round_epi32_avx2(const __m256i x, const __m128i count, const __m256i low_mask, const __m256i half, const __m256i round_negative) {
+  const __m256i negative = _mm256_and_si256(_mm256_srai_epi32(x, 31), round_negative);
+  const __m256i carry = _mm256_add_epi32(_mm256_add_epi32(_mm256_and_si256(x, low_mask), half), negative);
+  return _mm256_add_epi32(_mm256_sra_epi32(x, count), _mm256_srl_epi32(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline __m256i shiftround_narrow_round_epu32_avx2(const __m256i x, const __m128i count, const __m256i low_mask, const __m256i half) {
+  const __m256i carry = _mm256_add_epi32(_mm256_and_si256(x, low_mask), half);
+  return _mm256_add_epi32(_mm256_srl_epi32(x, count), _mm256_srl_epi32(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_i16_i8_avx2(const int16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m256i round_negative = _mm256_set1_epi16((shift != (uint8_t)0) ? (int16_t)-1 : (int16_t)0);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m256i a = shiftround_narrow_round_epi16_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half, round_negative);
+    const __m256i b = shiftround_narrow_round_epi16_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 16u)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xD8));
+  }
+  shiftround_narrow_sat_i16_i8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_i16_u8_avx2(const int16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m256i round_negative = _mm256_set1_epi16((shift != (uint8_t)0) ? (int16_t)-1 : (int16_t)0);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m256i a = shiftround_narrow_round_epi16_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half, round_negative);
+    const __m256i b = shiftround_narrow_round_epi16_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 16u)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+  }
+  shiftround_narrow_sat_i16_u8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_u16_u8_avx2(const uint16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m256i max = _mm256_set1_epi16((int16_t)UINT8_MAX);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m256i a = shiftround_narrow_round_epu16_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half);
+    const __m256i b = shiftround_narrow_round_epu16_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 16u)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_min_epu16(a, max), _mm256_min_epu16(b, max)), 0xD8));
+  }
+  shiftround_narrow_sat_u16_u8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_u16_i8_avx2(const uint16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m256i max = _mm256_set1_epi16((int16_t)INT8_MAX);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m256i a = shiftround_narrow_round_epu16_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half);
+    const __m256i b = shiftround_narrow_round_epu16_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 16u)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packs_epi16(_mm256_min_epu16(a, max), _mm256_min_epu16(b, max)), 0xD8));
+  }
+  shiftround_narrow_sat_u16_i8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_i32_i16_avx2(const int32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m256i round_negative = _mm256_set1_epi32((shift != (uint8_t)0) ? -1 : 0);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m256i a = shiftround_narrow_round_epi32_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half, round_negative);
+    const __m256i b = shiftround_narrow_round_epi32_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 8u)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8));
+  }
+  shiftround_narrow_sat_i32_i16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_i32_u16_avx2(const int32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m256i round_negative = _mm256_set1_epi32((shift != (uint8_t)0) ? -1 : 0);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m256i a = shiftround_narrow_round_epi32_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half, round_negative);
+    const __m256i b = shiftround_narrow_round_epi32_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 8u)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8));
+  }
+  shiftround_narrow_sat_i32_u16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_u32_u16_avx2(const uint32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m256i max = _mm256_set1_epi32((int32_t)UINT16_MAX);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m256i a = shiftround_narrow_round_epu32_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half);
+    const __m256i b = shiftround_narrow_round_epu32_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 8u)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_min_epu32(a, max), _mm256_min_epu32(b, max)), 0xD8));
+  }
+  shiftround_narrow_sat_u32_u16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX2 static inline void shiftround_narrow_sat_u32_i16_avx2(const uint32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m256i low_mask = _mm256_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m256i half = _mm256_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m256i max = _mm256_set1_epi32((int32_t)INT16_MAX);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m256i a = shiftround_narrow_round_epu32_avx2(_mm256_loadu_si256((const __m256i *)(num + j)), count, low_mask, half);
+    const __m256i b = shiftround_narrow_round_epu32_avx2(_mm256_loadu_si256((const __m256i *)(num + j + 8u)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_min_epu32(a, max), _mm256_min_epu32(b, max)), 0xD8));
+  }
+  shiftround_narrow_sat_u32_i16_scalar(num + j, length - j, shift, result + j);
+}
+
+/********************************************************************************
+ ********                        AVX-512 kernels                         ********
+ ********************************************************************************/
+
+/**
+ * AVX-512 F and BW narrow a whole register with the saturating
+ * down-conversions, and AVX-512 F adds vpsraq for the 64-bit types. The
+ * unsigned conversions read their input as unsigned, so signed lanes are
+ * first limited below by 0. The signed conversions read their input as
+ * signed, so unsigned lanes narrowed to a signed type are first limited
+ * above by its maximum with vpminuw, vpminud, or vpminuq.
+ */
+SHIFTROUND_NARROW_TARGET_AVX512 static inline __m512i shiftround_narrow_round_epi16_avx512(const __m512i x, const __m128i count, const __m512i low_mask, const __m512i half, const __m512i round_negative) {
+  const __m512i negative = _mm512_and_si512(_mm512_srai_epi16(x, 15), round_negative);
+  const __m512i carry = _mm512_add_epi16(_mm512_add_epi16(_mm512_and_si512(x, low_mask), half), negative);
+  return _mm512_add_epi16(_mm512_sra_epi16(x, count), _mm512_srl_epi16(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline __m512i shiftround_narrow_round_epu16_avx512(const __m512i x, const __m128i count, const __m512i low_mask, const __m512i half) {
+  const __m512i carry = _mm512_add_epi16(_mm512_and_si512(x, low_mask), half);
+  return _mm512_add_epi16(_mm512_srl_epi16(x, count), _mm512_srl_epi16(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline __m512i shiftround_narrow_round_epi32_avx512(const __m512i x, const __m128i count, const __m512i low_mask, const __m512i half, const __m512i round_negative) {
+  const __m512i negative = _mm512_and_si512(_mm512_srai_epi32(x, 31), round_negative);
+  const __m512i carry = _mm512_add_epi32(_mm512_add_epi32(_mm512_and_si512(x, low_mask), half), negative);
+  return _mm512_add_epi32(_mm512_sra_epi32(x, count), _mm512_srl_epi32(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline __m512i shiftround_narrow_round_epu32_avx512(const __m512i x, const __m128i count, const __m512i low_mask, const __m512i half) {
+  const __m512i carry = _mm512_add_epi32(_mm512_and_si512(x, low_mask), half);
+  return _mm512_add_epi32(_mm512_srl_epi32(x, count), _mm512_srl_epi32(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline __m512i shiftround_narrow_round_epi64_avx512(const __m512i x, const __m128i count, const __m512i low_mask, const __m512i half, const __m512i round_negative) {
+  const __m512i negative = _mm512_and_si512(_mm512_srai_epi64(x, 63), round_negative);
+  const __m512i carry = _mm512_add_epi64(_mm512_add_epi64(_mm512_and_si512(x, low_mask), half), negative);
+  return _mm512_add_epi64(_mm512_sra_epi64(x, count), _mm512_srl_epi64(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline __m512i shiftround_narrow_round_epu64_avx512(const __m512i x, const __m128i count, const __m512i low_mask, const __m512i half) {
+  const __m512i carry = _mm512_add_epi64(_mm512_and_si512(x, low_mask), half);
+  return _mm512_add_epi64(_mm512_srl_epi64(x, count), _mm512_srl_epi64(carry, count));
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_i16_i8_avx512(const int16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m512i round_negative = _mm512_set1_epi16((shift != (uint8_t)0) ? (int16_t)-1 : (int16_t)0);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m512i a = shiftround_narrow_round_epi16_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtsepi16_epi8(a));
+  }
+  shiftround_narrow_sat_i16_i8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_i16_u8_avx512(const int16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m512i round_negative = _mm512_set1_epi16((shift != (uint8_t)0) ? (int16_t)-1 : (int16_t)0);
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m512i a = shiftround_narrow_round_epi16_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtusepi16_epi8(_mm512_max_epi16(a, zero)));
+  }
+  shiftround_narrow_sat_i16_u8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_u16_u8_avx512(const uint16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi16((int16_t)((1u << shift) >> 1));
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m512i a = shiftround_narrow_round_epu16_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtusepi16_epi8(a));
+  }
+  shiftround_narrow_sat_u16_u8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_u16_i8_avx512(const uint16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi16((int16_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi16((int16_t)((1u << shift) >> 1));
+  const __m512i max = _mm512_set1_epi16((int16_t)INT8_MAX);
+  size_t j = 0u;
+  for (; j + 32u <= length; j += 32u) {
+    const __m512i a = shiftround_narrow_round_epu16_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtsepi16_epi8(_mm512_min_epu16(a, max)));
+  }
+  shiftround_narrow_sat_u16_i8_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_i32_i16_avx512(const int32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m512i round_negative = _mm512_set1_epi32((shift != (uint8_t)0) ? -1 : 0);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m512i a = shiftround_narrow_round_epi32_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtsepi32_epi16(a));
+  }
+  shiftround_narrow_sat_i32_i16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_i32_u16_avx512(const int32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m512i round_negative = _mm512_set1_epi32((shift != (uint8_t)0) ? -1 : 0);
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m512i a = shiftround_narrow_round_epi32_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtusepi32_epi16(_mm512_max_epi32(a, zero)));
+  }
+  shiftround_narrow_sat_i32_u16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_u32_u16_avx512(const uint32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi32((int32_t)((1u << shift) >> 1));
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m512i a = shiftround_narrow_round_epu32_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtusepi32_epi16(a));
+  }
+  shiftround_narrow_sat_u32_u16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_u32_i16_avx512(const uint32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi32((int32_t)((1u << shift) - 1u));
+  const __m512i half = _mm512_set1_epi32((int32_t)((1u << shift) >> 1));
+  const __m512i max = _mm512_set1_epi32((int32_t)INT16_MAX);
+  size_t j = 0u;
+  for (; j + 16u <= length; j += 16u) {
+    const __m512i a = shiftround_narrow_round_epu32_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtsepi32_epi16(_mm512_min_epu32(a, max)));
+  }
+  shiftround_narrow_sat_u32_i16_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_i64_i32_avx512(const int64_t *num, const size_t length, const uint8_t shift, int32_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi64((int64_t)((1ull << shift) - 1ull));
+  const __m512i half = _mm512_set1_epi64((int64_t)((1ull << shift) >> 1));
+  const __m512i round_negative = _mm512_set1_epi64((shift != (uint8_t)0) ? -1ll : 0ll);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m512i a = shiftround_narrow_round_epi64_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtsepi64_epi32(a));
+  }
+  shiftround_narrow_sat_i64_i32_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_i64_u32_avx512(const int64_t *num, const size_t length, const uint8_t shift, uint32_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi64((int64_t)((1ull << shift) - 1ull));
+  const __m512i half = _mm512_set1_epi64((int64_t)((1ull << shift) >> 1));
+  const __m512i round_negative = _mm512_set1_epi64((shift != (uint8_t)0) ? -1ll : 0ll);
+  const __m512i zero = _mm512_setzero_si512();
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m512i a = shiftround_narrow_round_epi64_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half, round_negative);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtusepi64_epi32(_mm512_max_epi64(a, zero)));
+  }
+  shiftround_narrow_sat_i64_u32_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_u64_u32_avx512(const uint64_t *num, const size_t length, const uint8_t shift, uint32_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi64((int64_t)((1ull << shift) - 1ull));
+  const __m512i half = _mm512_set1_epi64((int64_t)((1ull << shift) >> 1));
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m512i a = shiftround_narrow_round_epu64_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtusepi64_epi32(a));
+  }
+  shiftround_narrow_sat_u64_u32_scalar(num + j, length - j, shift, result + j);
+}
+
+SHIFTROUND_NARROW_TARGET_AVX512 static inline void shiftround_narrow_sat_u64_i32_avx512(const uint64_t *num, const size_t length, const uint8_t shift, int32_t *result) {
+  const __m128i count = _mm_cvtsi32_si128((int)shift);
+  const __m512i low_mask = _mm512_set1_epi64((int64_t)((1ull << shift) - 1ull));
+  const __m512i half = _mm512_set1_epi64((int64_t)((1ull << shift) >> 1));
+  const __m512i max = _mm512_set1_epi64((int64_t)INT32_MAX);
+  size_t j = 0u;
+  for (; j + 8u <= length; j += 8u) {
+    const __m512i a = shiftround_narrow_round_epu64_avx512(_mm512_loadu_si512((const void *)(num + j)), count, low_mask, half);
+    _mm256_storeu_si256((__m256i *)(result + j), _mm512_cvtsepi64_epi32(_mm512_min_epu64(a, max)));
+  }
+  shiftround_narrow_sat_u64_i32_scalar(num + j, length - j, shift, result + j);
+}
+
+#endif /* #ifdef SHIFTROUND_NARROW_X86 */
+
+/********************************************************************************
+ ********                   16-bit to 8-bit functions                    ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) saturated to int8_t. shift must be on the range [0,14]. */
+INTMATH_API void shiftround_narrow_sat_i16_i8(const int16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  if (shift > (uint8_t)14) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_i16_i8(num, length, %u, result), shift = %u is invalid; it must be on the range [0,14].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_i16_i8", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_i16_i8_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_i16_i8_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      shiftround_narrow_sat_i16_i8_sse2(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_i16_i8_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to uint8_t. shift must be on the range [0,14]. */
+INTMATH_API void shiftround_narrow_sat_i16_u8(const int16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  if (shift > (uint8_t)14) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_i16_u8(num, length, %u, result), shift = %u is invalid; it must be on the range [0,14].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_i16_u8", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_i16_u8_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_i16_u8_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      shiftround_narrow_sat_i16_u8_sse2(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_i16_u8_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to uint8_t. shift must be on the range [0,15]. */
+INTMATH_API void shiftround_narrow_sat_u16_u8(const uint16_t *num, const size_t length, const uint8_t shift, uint8_t *result) {
+  if (shift > (uint8_t)15) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_u16_u8(num, length, %u, result), shift = %u is invalid; it must be on the range [0,15].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_u16_u8", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (uint8_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_u16_u8_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_u16_u8_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      shiftround_narrow_sat_u16_u8_sse2(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_u16_u8_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to int8_t. shift must be on the range [0,15]. */
+INTMATH_API void shiftround_narrow_sat_u16_i8(const uint16_t *num, const size_t length, const uint8_t shift, int8_t *result) {
+  if (shift > (uint8_t)15) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_u16_i8(num, length, %u, result), shift = %u is invalid; it must be on the range [0,15].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_u16_i8", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (int8_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_u16_i8_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_u16_i8_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      shiftround_narrow_sat_u16_i8_sse2(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_u16_i8_scalar(num, length, shift, result);
+}
+
+/********************************************************************************
+ ********                   32-bit to 16-bit functions                   ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) saturated to int16_t. shift must be on the range [0,30]. */
+INTMATH_API void shiftround_narrow_sat_i32_i16(const int32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  if (shift > (uint8_t)30) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_i32_i16(num, length, %u, result), shift = %u is invalid; it must be on the range [0,30].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_i32_i16", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_i32_i16_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_i32_i16_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+      shiftround_narrow_sat_i32_i16_sse2(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_i32_i16_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to uint16_t. shift must be on the range [0,30]. */
+INTMATH_API void shiftround_narrow_sat_i32_u16(const int32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  if (shift > (uint8_t)30) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_i32_u16(num, length, %u, result), shift = %u is invalid; it must be on the range [0,30].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_i32_u16", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_i32_u16_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_i32_u16_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      shiftround_narrow_sat_i32_u16_sse4_1(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_i32_u16_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to uint16_t. shift must be on the range [0,31]. */
+INTMATH_API void shiftround_narrow_sat_u32_u16(const uint32_t *num, const size_t length, const uint8_t shift, uint16_t *result) {
+  if (shift > (uint8_t)31) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_u32_u16(num, length, %u, result), shift = %u is invalid; it must be on the range [0,31].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_u32_u16", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (uint16_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_u32_u16_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_u32_u16_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      shiftround_narrow_sat_u32_u16_sse4_1(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_u32_u16_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to int16_t. shift must be on the range [0,31]. */
+INTMATH_API void shiftround_narrow_sat_u32_i16(const uint32_t *num, const size_t length, const uint8_t shift, int16_t *result) {
+  if (shift > (uint8_t)31) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_u32_i16(num, length, %u, result), shift = %u is invalid; it must be on the range [0,31].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_u32_i16", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (int16_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    const uint32_t features = cpu_features();
+    if (features & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_u32_i16_avx512(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_AVX2) {
+      shiftround_narrow_sat_u32_i16_avx2(num, length, shift, result);
+      return;
+    }
+    else if (features & CPU_FEATURE_SSE4_1) {
+      shiftround_narrow_sat_u32_i16_sse4_1(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_u32_i16_scalar(num, length, shift, result);
+}
+
+/********************************************************************************
+ ********                   64-bit to 32-bit functions                   ********
+ ********************************************************************************/
+
+/* Stores ROUND(num[j] / 2^shift) saturated to int32_t. shift must be on the range [0,62]. */
+INTMATH_API void shiftround_narrow_sat_i64_i32(const int64_t *num, const size_t length, const uint8_t shift, int32_t *result) {
+  if (shift > (uint8_t)62) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_i64_i32(num, length, %u, result), shift = %u is invalid; it must be on the range [0,62].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_i64_i32", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (int32_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    if (cpu_features() & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_i64_i32_avx512(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_i64_i32_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to uint32_t. shift must be on the range [0,62]. */
+INTMATH_API void shiftround_narrow_sat_i64_u32(const int64_t *num, const size_t length, const uint8_t shift, uint32_t *result) {
+  if (shift > (uint8_t)62) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_i64_u32(num, length, %u, result), shift = %u is invalid; it must be on the range [0,62].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_i64_u32", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (uint32_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    if (cpu_features() & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_i64_u32_avx512(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_i64_u32_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to uint32_t. shift must be on the range [0,63]. */
+INTMATH_API void shiftround_narrow_sat_u64_u32(const uint64_t *num, const size_t length, const uint8_t shift, uint32_t *result) {
+  if (shift > (uint8_t)63) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_u64_u32(num, length, %u, result), shift = %u is invalid; it must be on the range [0,63].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_u64_u32", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (uint32_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    if (cpu_features() & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_u64_u32_avx512(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_u64_u32_scalar(num, length, shift, result);
+}
+
+/* Stores ROUND(num[j] / 2^shift) saturated to int32_t. shift must be on the range [0,63]. */
+INTMATH_API void shiftround_narrow_sat_u64_i32(const uint64_t *num, const size_t length, const uint8_t shift, int32_t *result) {
+  if (shift > (uint8_t)63) {
+    size_t j;
+    #ifdef DEBUG_INTMATH
+      fprintf(stderr, "ERROR: shiftround_narrow_sat_u64_i32(num, length, %u, result), shift = %u is invalid; it must be on the range [0,63].\n", shift, shift);
+    #elif defined(DIAGNOSE_INTMATH)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_narrow_sat_u64_i32", (uint64_t)length, (uint64_t)shift, 0u);
+    #endif
+    for (j = 0u; j < length; j++) result[j] = (int32_t)0;
+    return;
+  }
+
+  #ifdef SHIFTROUND_NARROW_X86
+    if (cpu_features() & CPU_FEATURE_AVX512) {
+      shiftround_narrow_sat_u64_i32_avx512(num, length, shift, result);
+      return;
+    }
+  #endif
+  shiftround_narrow_sat_u64_i32_scalar(num, length, shift, result);
+}
+
+#endif /* #ifndef SHIFTROUND_NARROW_C_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -23,6 +23,14 @@
  * enabled. This requires the availability of stderr and fprintf() on the
  * target system and is most appropriate for testing purposes.
  *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * If you #define BRANCHLESS_ROUNDING, the rounding correction is computed
+ * from the mask arithmetically rather than by a test and branch. The
+ * results are identical; benchmark_branchless_rounding compares the two.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -33,6 +41,9 @@
  * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
  */
 
+#ifndef SHIFTROUND_RUN_C_
+#define SHIFTROUND_RUN_C_
+
 #include "shiftround_run.h"
 #include "run_masks_type.h"
 
@@ -42,6 +53,8 @@
 
 #ifdef DEBUG_INTMATH
   #include "stdio.h"
+#elif defined(DIAGNOSE_INTMATH)
+  #include "intmath_diagnostics.h"
 #endif
 
 /********************************************************************************
@@ -49,10 +62,13 @@
  ********************************************************************************/
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,6]. */
-int8_t shiftround_i8(const int8_t num, const uint8_t shift) {
+INTMATH_API int8_t shiftround_i8(const int8_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)6)
 	    fprintf(stderr, "ERROR: shiftround_i8(%i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)6)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i8", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)6) return (int8_t)0;
@@ -66,34 +82,45 @@ int8_t shiftround_i8(const int8_t num, const uint8_t shift) {
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((num & half_remainder) &&
-      (num >= (int8_t)0 || (num & ((half_remainder << 1) - (uint8_t)1)) != half_remainder))
-    return (num >> shift) + (int8_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((((uint8_t)num & ((half_remainder << 1) - (uint8_t)1)) + half_remainder - ((uint8_t)num >> 7)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= (int8_t)0 || (num & ((half_remainder << 1) - (uint8_t)1)) != half_remainder))
+      return (num >> shift) + (int8_t)1;
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,7]. */
-uint8_t shiftround_u8(const uint8_t num, const uint8_t shift) {
+INTMATH_API uint8_t shiftround_u8(const uint8_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)7)
 	    fprintf(stderr, "ERROR: shiftround_u8(%u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)7)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u8", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)7) return (uint8_t)0;
   if (shift == (uint8_t)0) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_8bit[shift])
-      return (num >> shift) + (uint8_t)1;
-  #elif defined(COMPUTED_MASKS)
-    if (num & (uint8_t)1 << (shift - (uint8_t)1))
-      return (num >> shift) + (uint8_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - (uint8_t)1)) & (uint8_t)1);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_8bit[shift])
+        return (num >> shift) + (uint8_t)1;
+    #elif defined(COMPUTED_MASKS)
+      if (num & (uint8_t)1 << (shift - (uint8_t)1))
+        return (num >> shift) + (uint8_t)1;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-
-  return num >> shift;
 }
 
 /********************************************************************************
@@ -101,10 +128,13 @@ uint8_t shiftround_u8(const uint8_t num, const uint8_t shift) {
  ********************************************************************************/
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,14]. */
-int16_t shiftround_i16(const int16_t num, const uint8_t shift) {
+INTMATH_API int16_t shiftround_i16(const int16_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)14)
 	    fprintf(stderr, "ERROR: shiftround_i16(%i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)14)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i16", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)14) return (int16_t)0;
@@ -118,34 +148,45 @@ int16_t shiftround_i16(const int16_t num, const uint8_t shift) {
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
   
-  if ((num & half_remainder) &&
-      (num >= (int16_t)0 || (num & ((half_remainder << 1) - (uint16_t)1)) != half_remainder))
-    return (num >> shift) + (int16_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((((uint16_t)num & ((half_remainder << 1) - (uint16_t)1)) + half_remainder - ((uint16_t)num >> 15)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= (int16_t)0 || (num & ((half_remainder << 1) - (uint16_t)1)) != half_remainder))
+      return (num >> shift) + (int16_t)1;
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,15]. */
-uint16_t shiftround_u16(const uint16_t num, const uint8_t shift) {
+INTMATH_API uint16_t shiftround_u16(const uint16_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)15)
 	    fprintf(stderr, "ERROR: shiftround_u16(%u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)15)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u16", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)15) return (uint16_t)0;
   if (shift == (uint8_t)0) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_16bit[shift])
-      return (num >> shift) + (uint16_t)1;
-  #elif defined(COMPUTED_MASKS)
-    if (num & (uint16_t)1 << (shift - (uint8_t)1))
-      return (num >> shift) + (uint16_t)1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - (uint8_t)1)) & (uint16_t)1);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_16bit[shift])
+        return (num >> shift) + (uint16_t)1;
+    #elif defined(COMPUTED_MASKS)
+      if (num & (uint16_t)1 << (shift - (uint8_t)1))
+        return (num >> shift) + (uint16_t)1;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-
-  return num >> shift;
 }
 
 /********************************************************************************
@@ -153,10 +194,13 @@ uint16_t shiftround_u16(const uint16_t num, const uint8_t shift) {
  ********************************************************************************/
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,30]. */
-int32_t shiftround_i32(const int32_t num, const uint8_t shift) {
+INTMATH_API int32_t shiftround_i32(const int32_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)30)
 	    fprintf(stderr, "ERROR: shiftround_i32(%i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)30)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i32", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)30) return 0;
@@ -170,34 +214,45 @@ int32_t shiftround_i32(const int32_t num, const uint8_t shift) {
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((num & half_remainder) &&
-      (num >= 0 || (num & ((half_remainder << 1) - 1)) != half_remainder))
-    return (num >> shift) + 1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + (int32_t)((((uint32_t)num & ((half_remainder << 1) - 1u)) + half_remainder - ((uint32_t)num >> 31)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= 0 || (num & ((half_remainder << 1) - 1)) != half_remainder))
+      return (num >> shift) + 1;
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,31]. */
-uint32_t shiftround_u32(const uint32_t num, const uint8_t shift) {
+INTMATH_API uint32_t shiftround_u32(const uint32_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)31)
 	    fprintf(stderr, "ERROR: shiftround_u32(%u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)31)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u32", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)31) return 0;
   if (shift == (uint8_t)0) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_32bit[shift])
-      return (num >> shift) + 1u;
-  #elif defined(COMPUTED_MASKS)
-    if (num & 1u << (shift - (uint8_t)1))
-      return (num >> shift) + 1u;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - (uint8_t)1)) & 1u);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_32bit[shift])
+        return (num >> shift) + 1u;
+    #elif defined(COMPUTED_MASKS)
+      if (num & 1u << (shift - (uint8_t)1))
+        return (num >> shift) + 1u;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-
-  return num >> shift;
 }
 
 /********************************************************************************
@@ -205,10 +260,13 @@ uint32_t shiftround_u32(const uint32_t num, const uint8_t shift) {
  ********************************************************************************/
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,62]. */
-int64_t shiftround_i64(const int64_t num, const uint8_t shift) {
+INTMATH_API int64_t shiftround_i64(const int64_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)62)
 	    fprintf(stderr, "ERROR: shiftround_i64(%" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)62)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_i64", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)62) return 0ll;
@@ -222,36 +280,49 @@ int64_t shiftround_i64(const int64_t num, const uint8_t shift) {
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((num & half_remainder) &&
-      (num >= 0ll || (num & ((half_remainder << 1) - 1ll)) != half_remainder))
-    return (num >> shift) + 1ll;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + (int64_t)((((uint64_t)num & ((half_remainder << 1) - 1ull)) + half_remainder - ((uint64_t)num >> 63)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= 0ll || (num & ((half_remainder << 1) - 1ll)) != half_remainder))
+      return (num >> shift) + 1ll;
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,63]. */
-uint64_t shiftround_u64(const uint64_t num, const uint8_t shift) {
+INTMATH_API uint64_t shiftround_u64(const uint64_t num, const uint8_t shift) {
   #ifdef DEBUG_INTMATH
     if (shift > (uint8_t)63)
 	    fprintf(stderr, "ERROR: shiftround_u64(%" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > (uint8_t)63)
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround_u64", (uint64_t)num, (uint64_t)shift, 0u);
   #endif
 
   if (shift > (uint8_t)63) return 0ull;
   if (shift == (uint8_t)0) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_64bit[shift])
-      return (num >> shift) + 1ull;
-  #elif defined(COMPUTED_MASKS)
-    if (num & 1ull << (shift - (uint8_t)1))
-      return (num >> shift) + 1ull;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - (uint8_t)1)) & 1ull);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_64bit[shift])
+        return (num >> shift) + 1ull;
+    #elif defined(COMPUTED_MASKS)
+      if (num & 1ull << (shift - (uint8_t)1))
+        return (num >> shift) + 1ull;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-
-  return num >> shift;
 }
 
+#endif /* #ifndef SHIFTROUND_RUN_C_ */
+
 /*
 Creative Commons Legal Code
 
@@ -36,34 +36,39 @@
 #define SHIFTROUND_RUN_H_
 
 #include "inttypes.h"
+#include "intmath_inline.h"
 
 /********************************************************************************
  ********                  int8_t and uint8_t functions                  ********
  ********************************************************************************/
 
-int8_t shiftround_i8(const int8_t num, const uint8_t shift);
-uint8_t shiftround_u8(const uint8_t num, const uint8_t shift);
+INTMATH_API int8_t shiftround_i8(const int8_t num, const uint8_t shift);
+INTMATH_API uint8_t shiftround_u8(const uint8_t num, const uint8_t shift);
 
 /********************************************************************************
  ********                 int16_t and uint16_t functions                 ********
  ********************************************************************************/
 
-int16_t shiftround_i16(const int16_t num, const uint8_t shift);
-uint16_t shiftround_u16(const uint16_t num, const uint8_t shift);
+INTMATH_API int16_t shiftround_i16(const int16_t num, const uint8_t shift);
+INTMATH_API uint16_t shiftround_u16(const uint16_t num, const uint8_t shift);
 
 /********************************************************************************
  ********                 int32_t and uint32_t functions                 ********
  ********************************************************************************/
 
-int32_t shiftround_i32(const int32_t num, const uint8_t shift);
-uint32_t shiftround_u32(const uint32_t num, const uint8_t shift);
+INTMATH_API int32_t shiftround_i32(const int32_t num, const uint8_t shift);
+INTMATH_API uint32_t shiftround_u32(const uint32_t num, const uint8_t shift);
 
 /********************************************************************************
  ********                 int64_t and uint64_t functions                 ********
  ********************************************************************************/
 
-int64_t shiftround_i64(const int64_t num, const uint8_t shift);
-uint64_t shiftround_u64(const uint64_t num, const uint8_t shift);
+INTMATH_API int64_t shiftround_i64(const int64_t num, const uint8_t shift);
+INTMATH_API uint64_t shiftround_u64(const uint64_t num, const uint8_t shift);
+
+#ifdef INTMATH_HEADER_ONLY
+  #include "shiftround_run.c"
+#endif
 
 #endif /* #ifndef SHIFTROUND_RUN_H_ */
 
@@ -13,6 +13,9 @@
  * types. shift may range from 0 to two less than the word length of type for
  * signed types.
  *
+ * shiftround<type, rounding>(num, shift) rounds as selected by one of the
+ * tags in rounding_policy.hpp instead, e.g. round_half_even.
+ *
  * Correct operation for negative signed inputs requires two things:
  * 1. The representation of signed integers must be 2's complement.
  * 2. The compiler must encode right shifts on signed types as arithmetic
@@ -22,6 +25,13 @@
  * enabled. This requires the availability of stderr and fprintf() on the
  * target system and is most appropriate for testing purposes.
  *
+ * If you #define DIAGNOSE_INTMATH instead, the same checks count each
+ * failure and record its arguments through intmath_diagnostics.c rather
+ * than printing. See intmath_diagnostics.h.
+ *
+ * #define BRANCHLESS_ROUNDING to compute the round_half_away correction
+ * arithmetically instead of with a test and branch, as in shiftround_run.c.
+ *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
  *
@@ -35,7 +45,9 @@
 #define SHIFTROUND_RUN_HPP_
 
 #include <cinttypes>
+#include <limits>
 #include "run_masks_type.h"
+#include "rounding_policy.hpp"
 
 #ifdef ARRAY_MASKS
   #ifdef __cplusplus
@@ -50,6 +62,15 @@
 
 #ifdef DEBUG_INTMATH
   #include <cstdio>
+#elif defined(DIAGNOSE_INTMATH)
+  #ifdef __cplusplus
+    extern "C"
+    {
+  #endif
+	  #include "intmath_diagnostics.h"
+  #ifdef __cplusplus
+    }
+  #endif
 #endif
 
 /* Allows static_assert message in shiftround primary template to compile. */
@@ -72,6 +93,9 @@ template <> inline int8_t shiftround<int8_t>(const int8_t num, const uint8_t shi
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(6))
 	    std::fprintf(stderr, "ERROR: shiftround<int8_t>(%i, %u), shift = %u is invalid; it must be on the range [0,6].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(6))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<int8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(6)) return static_cast<int8_t>(0);
@@ -85,12 +109,16 @@ template <> inline int8_t shiftround<int8_t>(const int8_t num, const uint8_t shi
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((num & half_remainder) &&
-      (num >= static_cast<int8_t>(0) ||
-       (num & ((half_remainder << 1) - static_cast<uint8_t>(1))) != half_remainder))
-    return (num >> shift) + static_cast<int8_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + static_cast<int8_t>(((static_cast<uint8_t>(num) & ((half_remainder << 1) - static_cast<uint8_t>(1))) + half_remainder - (static_cast<uint8_t>(num) >> 7)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= static_cast<int8_t>(0) ||
+         (num & ((half_remainder << 1) - static_cast<uint8_t>(1))) != half_remainder))
+      return (num >> shift) + static_cast<int8_t>(1);
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,7]. */
@@ -98,22 +126,29 @@ template <> inline uint8_t shiftround<uint8_t>(const uint8_t num, const uint8_t
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(7))
 	    std::fprintf(stderr, "ERROR: shiftround<uint8_t>(%u, %u), shift = %u is invalid; it must be on the range [0,7].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(7))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<uint8_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(7)) return static_cast<uint8_t>(0);
   if (shift == static_cast<uint8_t>(0)) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_8bit[shift])
-      return (num >> shift) + static_cast<uint8_t>(1);
-  #elif defined(COMPUTED_MASKS)
-    if (num & static_cast<uint8_t>(1) << (shift - static_cast<uint8_t>(1)))
-      return (num >> shift) + static_cast<uint8_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - static_cast<uint8_t>(1))) & static_cast<uint8_t>(1));
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_8bit[shift])
+        return (num >> shift) + static_cast<uint8_t>(1);
+    #elif defined(COMPUTED_MASKS)
+      if (num & static_cast<uint8_t>(1) << (shift - static_cast<uint8_t>(1)))
+        return (num >> shift) + static_cast<uint8_t>(1);
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-  
-  return num >> shift;
 }
 
 /********************************************************************************
@@ -125,6 +160,9 @@ template <> inline int16_t shiftround<int16_t>(const int16_t num, const uint8_t
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(14))
 	    std::fprintf(stderr, "ERROR: shiftround<int16_t>(%i, %u), shift = %u is invalid; it must be on the range [0,14].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(14))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<int16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(14)) return static_cast<int16_t>(0);
@@ -138,12 +176,16 @@ template <> inline int16_t shiftround<int16_t>(const int16_t num, const uint8_t
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((num & half_remainder) &&
-      (num >= static_cast<int16_t>(0) ||
-       (num & ((half_remainder << 1) - static_cast<uint16_t>(1))) != half_remainder))
-    return (num >> shift) + static_cast<int16_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + static_cast<int16_t>(((static_cast<uint16_t>(num) & ((half_remainder << 1) - static_cast<uint16_t>(1))) + half_remainder - (static_cast<uint16_t>(num) >> 15)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= static_cast<int16_t>(0) ||
+         (num & ((half_remainder << 1) - static_cast<uint16_t>(1))) != half_remainder))
+      return (num >> shift) + static_cast<int16_t>(1);
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,15]. */
@@ -151,22 +193,29 @@ template <> inline uint16_t shiftround<uint16_t>(const uint16_t num, const uint8
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(15))
 	    std::fprintf(stderr, "ERROR: shiftround<uint16_t>(%u, %u), shift = %u is invalid; it must be on the range [0,15].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(15))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<uint16_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(15)) return static_cast<uint16_t>(0);
   if (shift == static_cast<uint8_t>(0)) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_16bit[shift])
-      return (num >> shift) + static_cast<uint16_t>(1);
-  #elif defined(COMPUTED_MASKS)
-    if (num & static_cast<uint16_t>(1) << (shift - static_cast<uint8_t>(1)))
-      return (num >> shift) + static_cast<uint16_t>(1);
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - static_cast<uint8_t>(1))) & static_cast<uint16_t>(1));
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_16bit[shift])
+        return (num >> shift) + static_cast<uint16_t>(1);
+    #elif defined(COMPUTED_MASKS)
+      if (num & static_cast<uint16_t>(1) << (shift - static_cast<uint8_t>(1)))
+        return (num >> shift) + static_cast<uint16_t>(1);
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-
-  return num >> shift;
 }
 
 /********************************************************************************
@@ -178,6 +227,9 @@ template <> inline int32_t shiftround<int32_t>(const int32_t num, const uint8_t
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(30))
 	    std::fprintf(stderr, "ERROR: shiftround<int32_t>(%i, %u), shift = %u is invalid; it must be on the range [0,30].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(30))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<int32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(30)) return 0;
@@ -191,11 +243,15 @@ template <> inline int32_t shiftround<int32_t>(const int32_t num, const uint8_t
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
   
-  if ((num & half_remainder) &&
-      (num >= 0 || (num & ((half_remainder << 1) - 1u)) != half_remainder))
-    return (num >> shift) + 1;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + static_cast<int32_t>(((static_cast<uint32_t>(num) & ((half_remainder << 1) - 1u)) + half_remainder - (static_cast<uint32_t>(num) >> 31)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= 0 || (num & ((half_remainder << 1) - 1u)) != half_remainder))
+      return (num >> shift) + 1;
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,31]. */
@@ -203,22 +259,29 @@ template <> inline uint32_t shiftround<uint32_t>(const uint32_t num, const uint8
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(31))
 	    std::fprintf(stderr, "ERROR: shiftround<uint32_t>(%u, %u), shift = %u is invalid; it must be on the range [0,31].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(31))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<uint32_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(31)) return 0u;
   if (shift == static_cast<uint8_t>(0)) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_32bit[shift])
-      return (num >> shift) + 1u;
-  #elif defined(COMPUTED_MASKS)
-    if (num & 1u << (shift - static_cast<uint8_t>(1)))
-      return (num >> shift) + 1u;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - static_cast<uint8_t>(1))) & 1u);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_32bit[shift])
+        return (num >> shift) + 1u;
+    #elif defined(COMPUTED_MASKS)
+      if (num & 1u << (shift - static_cast<uint8_t>(1)))
+        return (num >> shift) + 1u;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
   #endif
-
-  return num >> shift;
 }
 
 /********************************************************************************
@@ -230,6 +293,9 @@ template <> inline int64_t shiftround<int64_t>(const int64_t num, const uint8_t
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(62))
 	    std::fprintf(stderr, "ERROR: shiftround<int64_t>(%" PRIi64 ", %u), shift = %u is invalid; it must be on the range [0,62].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(62))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "shiftround<int64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(62)) return 0ll;
@@ -243,11 +309,15 @@ template <> inline int64_t shiftround<int64_t>(const int64_t num, const uint8_t
     #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
   #endif
 
-  if ((num & half_remainder) &&
-      (num >= 0ll || (num & ((half_remainder << 1) - 1ull)) != half_remainder))
-    return (num >> shift) + 1ll;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + static_cast<int64_t>(((static_cast<uint64_t>(num) & ((half_remainder << 1) - 1ull)) + half_remainder - (static_cast<uint64_t>(num) >> 63)) >> shift);
+  #else
+    if ((num & half_remainder) &&
+        (num >= 0ll || (num & ((half_remainder << 1) - 1ull)) != half_remainder))
+      return (num >> shift) + 1ll;
 
-  return num >> shift;
+    return num >> shift;
+  #endif
 }
 
 /* Returns ROUND(num / 2^shift). shift must be on the range [0,63]. */
@@ -255,22 +325,68 @@ template <> inline uint64_t shiftround<uint64_t>(const uint64_t num, const uint8
   #ifdef DEBUG_INTMATH
     if (shift > static_cast<uint8_t>(63))
 	    std::fprintf(stderr, "ERROR: multshiftround<uint64_t>(%" PRIu64 ", %u), shift = %u is invalid; it must be on the range [0,63].\n", num, shift, shift);
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift > static_cast<uint8_t>(63))
+	    intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, "multshiftround<uint64_t>", static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
   if (shift > static_cast<uint8_t>(63)) return 0ull;
   if (shift == static_cast<uint8_t>(0)) return num;
 
-  #ifdef ARRAY_MASKS
-    if (num & masks_64bit[shift])
-      return (num >> shift) + 1ull;
-  #elif defined(COMPUTED_MASKS)
-    if (num & 1ull << (shift - static_cast<uint8_t>(1)))
-      return (num >> shift) + 1ull;
+  #ifdef BRANCHLESS_ROUNDING
+    return (num >> shift) + ((num >> (shift - static_cast<uint8_t>(1))) & 1ull);
   #else
-    #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #ifdef ARRAY_MASKS
+      if (num & masks_64bit[shift])
+        return (num >> shift) + 1ull;
+    #elif defined(COMPUTED_MASKS)
+      if (num & 1ull << (shift - static_cast<uint8_t>(1)))
+        return (num >> shift) + 1ull;
+    #else
+      #error "Exactly one of ARRAY_MASKS or COMPUTED_MASKS must be defined."
+    #endif
+
+    return num >> shift;
+  #endif
+}
+
+/********************************************************************************
+ ********                   rounding policy overloads                    ********
+ ********************************************************************************/
+
+/* round_half_away is the shiftround<type> specialization above. */
+template <typename type> inline type shiftround_run_policy(const type num, const uint8_t shift, round_half_away) {
+  return shiftround<type>(num, shift);
+}
+
+/**
+ * Checks shift as the shiftround<type> specializations do and applies the
+ * rounding step from rounding_policy.hpp. Only round_half_even needs the
+ * shift = 0 test.
+ */
+template <typename type, typename rounding> inline type shiftround_run_policy(const type num, const uint8_t shift, rounding) {
+  #ifdef DEBUG_INTMATH
+    if (shift >= std::numeric_limits<type>::digits) {
+      char num_text[24];
+      std::fprintf(stderr, "ERROR: %s(%s, %u), shift = %u is invalid; it must be on the range [0,%i].\n", rounding_policy_name<ROUNDING_POLICY_SHIFTROUND, type, rounding>(), rounding_policy_text<type>(num, num_text), shift, shift, std::numeric_limits<type>::digits - 1);
+    }
+  #elif defined(DIAGNOSE_INTMATH)
+    if (shift >= std::numeric_limits<type>::digits)
+      intmath_diagnostics_record(INTMATH_EVENT_INVALID_SHIFT, rounding_policy_name<ROUNDING_POLICY_SHIFTROUND, type, rounding>(), static_cast<uint64_t>(num), static_cast<uint64_t>(shift), 0u);
   #endif
 
-  return num >> shift;
+  if (shift >= std::numeric_limits<type>::digits) return static_cast<type>(0);
+  if (std::is_same<rounding, round_half_even>::value && shift == static_cast<uint8_t>(0)) return num;
+  return rounding_policy_shift<type>(num, shift, rounding());
+}
+
+/**
+ * Returns num / 2^shift rounded as selected by rounding, one of the tags in
+ * rounding_policy.hpp. shift has the same range as in shiftround<type>.
+ */
+template <typename type, typename rounding> inline type shiftround(const type num, const uint8_t shift) {
+  static_assert(is_rounding_policy<rounding>::value, "type shiftround<type, rounding>(const type num, const uint8_t shift); rounding must be a tag from rounding_policy.hpp.");
+  return shiftround_run_policy<type>(num, shift, rounding());
 }
 
 #endif /* #ifndef SHIFTROUND_RUN_HPP_ */
@@ -394,6 +394,18 @@ int main() {
   std::fflush(stderr);
   std::printf("\n");
 
+  std::printf("multshiftround<int64_t>(-3037000500, 3037000500, 62):\n  ");
+  std::fflush(stdout);
+  multshiftround<int64_t>(-3037000500ll,3037000500ll,62);
+  std::fflush(stderr);
+  std::printf("\n");
+
+  std::printf("multshiftround<int64_t>(3037000500, 3037000500, 62):\n  ");
+  std::fflush(stdout);
+  multshiftround<int64_t>(3037000500ll,3037000500ll,62);
+  std::fflush(stderr);
+  std::printf("\n");
+
   std::printf("multshiftround<uint64_t>(0, 0, 64):\n  ");
   std::fflush(stdout);
   multshiftround<uint64_t>(0ull,0ull,64);
@@ -514,6 +526,18 @@ int main() {
   std::fflush(stderr);
   std::printf("\n");
 
+  std::printf("multshiftround_i64(-3037000500, 3037000500, 62):\n  ");
+  std::fflush(stdout);
+  multshiftround_i64(-3037000500ll,3037000500ll,62);
+  std::fflush(stderr);
+  std::printf("\n");
+
+  std::printf("multshiftround_i64(3037000500, 3037000500, 62):\n  ");
+  std::fflush(stdout);
+  multshiftround_i64(3037000500ll,3037000500ll,62);
+  std::fflush(stderr);
+  std::printf("\n");
+
   std::printf("multshiftround_u64(0, 0, 64):\n  ");
   std::fflush(stdout);
   multshiftround_u64(0ull,0ull,64);
@@ -18,17 +18,44 @@
  * Approximately 2^36 tests are conducted on each function.
  *
  * Tests divround_i64 and divround<int64_t> for all valid combinations
- * of dividend and divisor on the ranges
+ * of dividend on the ranges
+ * [-9223372036854775808, -9223372036853727232],
+ * [-1048576, 1048576], and
+ * [9223372036853727231, 9223372036854775807]
+ * and divisor on the ranges
  * [-9223372036854775808, -9223372036854710272],
  * [-65536, 65536], and
  * [9223372036854710271, 9223372036854775807].
- * Approximately 2^36 tests are conducted on each function.
+ * Approximately 2^40 tests are conducted on each function.
  *
  * Tests divround_u64 and divround<uint64_t> for all valid combinations
- * of dividend and divisor on the ranges
+ * of dividend on the ranges
+ * [0, 2097152] and
+ * [18446744073707454463, 18446744073709551615]
+ * and divisor on the ranges
  * [1, 131072] and
  * [18446744073709420543, 18446744073709551615].
- * Approximately 2^36 tests are conducted on each function.
+ * Approximately 2^40 tests are conducted on each function.
+ *
+ * The 64-bit results are checked against the exact integer reference
+ * functions in intmath_reference.hpp.
+ *
+ * The 16-bit, 32-bit, and 64-bit tests run as chunked dividend ranges on
+ * the work-stealing pool in test_pool.hpp.
+ *
+ * Tests the compile time divisor function divround<type, divisor> from
+ * divround_comp.hpp against divround<type> for every dividend and every
+ * nonzero divisor of int8_t and uint8_t, for every dividend and a
+ * representative set of divisors of int16_t and uint16_t, and for the
+ * dividend ranges above and a representative set of divisors of the
+ * 32-bit and 64-bit types.
+ *
+ * Tests divround_array<type> from divround_array.hpp, and through it the
+ * divround_array_X functions, against divround<type> on the same dividends:
+ * every dividend of the 8-bit and 16-bit types and the dividend ranges
+ * above for the 32-bit and 64-bit types. The divisors are every power of
+ * two 2^k, 2^k - 1, 2^k + 1, and, for signed types, their negatives. Each
+ * divisor is tested once out of place and once in place.
  *
  * Written in 2018 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
@@ -40,13 +67,14 @@
  * end of this file. If not, see http ://creativecommons.org/publicdomain/zero/1.0/
  */
 
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <cstdio>
 #include <limits>
-#include <thread>
 #include <mutex>
 #include <vector>
+#include <utility>
 #ifdef __cplusplus
   extern "C"
   {
@@ -56,10 +84,10 @@
   }
 #endif
 #include "divround.hpp"
-#include <boost/multiprecision/cpp_bin_float.hpp>
-#include <boost/math/special_functions/round.hpp>
-
-typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<80, boost::multiprecision::backends::digit_base_2, void, boost::int16_t, -16382, 16383>, boost::multiprecision::et_off> cpp_bin_float_80;
+#include "divround_comp.hpp"
+#include "divround_array.hpp"
+#include "intmath_reference.hpp"
+#include "test_pool.hpp"
 
 /**
  * Mutex for stdout when running multithreaded.
@@ -385,14 +413,14 @@ void test_divround_i64_c(int64_t dividend_start, int64_t dividend_end) {
       /* Don't divide by 0. */
       if (divisor == 0ll) divisor = 1ll;
       int64_t dr = divround_i64(dividend_i64, divisor);
-      int64_t dbl_dr = boost::math::round(cpp_bin_float_80(dividend_i64) / cpp_bin_float_80(divisor)).convert_to<int64_t>();
-      if (dr != dbl_dr) {
+      int64_t ref_dr = reference_divround<int64_t>(dividend_i64, divisor);
+      if (dr != ref_dr) {
         int64_t quotient = dividend_i64 / divisor;
         int64_t remainder = dividend_i64 - (quotient * divisor);
         int64_t div_half = divisor >> 1;
         if ((divisor & 0x8000000000000001ull) == 1ll) div_half++;
         std::lock_guard<std::mutex> print_lock(print_mutex);
-        std::printf("\nERROR: ROUND(%" PRIi64 " / %" PRIi64 ") = %" PRIi64 ", but divround_i64 returns %" PRIi64 "\n  remainder = %" PRIi64 ", div_half = %" PRIi64 "\n\n", dividend_i64, divisor, dbl_dr, dr, remainder, div_half);
+        std::printf("\nERROR: ROUND(%" PRIi64 " / %" PRIi64 ") = %" PRIi64 ", but divround_i64 returns %" PRIi64 "\n  remainder = %" PRIi64 ", div_half = %" PRIi64 "\n\n", dividend_i64, divisor, ref_dr, dr, remainder, div_half);
       }
       if (divisor == std::numeric_limits<int64_t>::lowest() + (1 << 16)) divisor = -(1 << 16);
       else if (divisor == (1 << 16)) divisor = std::numeric_limits<int64_t>::max() - (1 << 16);
@@ -427,14 +455,14 @@ void test_divround_i64_cpp(int64_t dividend_start, int64_t dividend_end) {
       /* Don't divide by 0. */
       if (divisor == 0ll) divisor = 1ll;
       int64_t dr = divround<int64_t>(dividend_i64, divisor);
-      int64_t dbl_dr = boost::math::round(cpp_bin_float_80(dividend_i64) / cpp_bin_float_80(divisor)).convert_to<int64_t>();
-      if (dr != dbl_dr) {
+      int64_t ref_dr = reference_divround<int64_t>(dividend_i64, divisor);
+      if (dr != ref_dr) {
         int64_t quotient = dividend_i64 / divisor;
         int64_t remainder = dividend_i64 - (quotient * divisor);
         int64_t div_half = divisor >> 1;
         if ((divisor & 0x8000000000000001ull) == 1ll) div_half++;
         std::lock_guard<std::mutex> print_lock(print_mutex);
-        std::printf("\nERROR: ROUND(%" PRIi64 " / %" PRIi64 ") = %" PRIi64 ", but divround<int64_t> returns %" PRIi64 "\n  remainder = %" PRIi64 ", div_half = %" PRIi64 "\n\n", dividend_i64, divisor, dbl_dr, dr, remainder, div_half);
+        std::printf("\nERROR: ROUND(%" PRIi64 " / %" PRIi64 ") = %" PRIi64 ", but divround<int64_t> returns %" PRIi64 "\n  remainder = %" PRIi64 ", div_half = %" PRIi64 "\n\n", dividend_i64, divisor, ref_dr, dr, remainder, div_half);
       }
       if (divisor == std::numeric_limits<int64_t>::lowest() + (1 << 16)) divisor = -(1 << 16);
       else if (divisor == (1 << 16)) divisor = std::numeric_limits<int64_t>::max() - (1 << 16);
@@ -464,14 +492,14 @@ void test_divround_u64_c(uint64_t dividend_start, uint64_t dividend_end) {
     uint64_t divisor = 1ull;
     while (true) {
       uint64_t dr = divround_u64(dividend_u64, divisor);
-      uint64_t dbl_dr = boost::math::round(cpp_bin_float_80(dividend_u64) / cpp_bin_float_80(divisor)).convert_to<uint64_t>();
-      if (dr != dbl_dr) {
+      uint64_t ref_dr = reference_divround<uint64_t>(dividend_u64, divisor);
+      if (dr != ref_dr) {
         uint64_t quotient = dividend_u64 / divisor;
         uint64_t remainder = dividend_u64 - (quotient * divisor);
         uint64_t div_half = divisor >> 1;
         if (divisor & 0x0000000000000001ull) div_half++;
         std::lock_guard<std::mutex> print_lock(print_mutex);
-        std::printf("\nERROR: ROUND(%" PRIu64 " / %" PRIu64 ") = %" PRIu64 ", but divround_u64 returns %" PRIu64 "\n  remainder = %" PRIu64 ", div_half = %" PRIu64 "\n\n", dividend_u64, divisor, dbl_dr, dr, remainder, div_half);
+        std::printf("\nERROR: ROUND(%" PRIu64 " / %" PRIu64 ") = %" PRIu64 ", but divround_u64 returns %" PRIu64 "\n  remainder = %" PRIu64 ", div_half = %" PRIu64 "\n\n", dividend_u64, divisor, ref_dr, dr, remainder, div_half);
       }
       if (divisor == (1ull << 17)) divisor = std::numeric_limits<uint64_t>::max() - (1ull << 17);
       else if (divisor == std::numeric_limits<uint64_t>::max()) break;
@@ -500,14 +528,14 @@ void test_divround_u64_cpp(uint64_t dividend_start, uint64_t dividend_end) {
     uint64_t divisor = 1ull;
     while (true) {
       uint64_t dr = divround<uint64_t>(dividend_u64, divisor);
-      uint64_t dbl_dr = boost::math::round(cpp_bin_float_80(dividend_u64) / cpp_bin_float_80(divisor)).convert_to<uint64_t>();
-      if (dr != dbl_dr) {
+      uint64_t ref_dr = reference_divround<uint64_t>(dividend_u64, divisor);
+      if (dr != ref_dr) {
         uint64_t quotient = dividend_u64 / divisor;
         uint64_t remainder = dividend_u64 - (quotient * divisor);
         uint64_t div_half = divisor >> 1;
         if (divisor & 0x0000000000000001ull) div_half++;
         std::lock_guard<std::mutex> print_lock(print_mutex);
-        std::printf("\nERROR: ROUND(%" PRIu64 " / %" PRIu64 ") = %" PRIu64 ", but divround<uint64_t> returns %" PRIu64 "\n  remainder = %" PRIu64 ", div_half = %" PRIu64 "\n\n", dividend_u64, divisor, dbl_dr, dr, remainder, div_half);
+        std::printf("\nERROR: ROUND(%" PRIu64 " / %" PRIu64 ") = %" PRIu64 ", but divround<uint64_t> returns %" PRIu64 "\n  remainder = %" PRIu64 ", div_half = %" PRIu64 "\n\n", dividend_u64, divisor, ref_dr, dr, remainder, div_half);
       }
       if (divisor == (1ull << 17)) divisor = std::numeric_limits<uint64_t>::max() - (1ull << 17);
       else if (divisor == std::numeric_limits<uint64_t>::max()) break;
@@ -518,6 +546,174 @@ void test_divround_u64_cpp(uint64_t dividend_start, uint64_t dividend_end) {
   }
 }
 
+/**
+ * Prints a mismatch between divround<type, divisor>(dividend) and
+ * divround<type>(dividend, divisor).
+ */
+template <typename type> void report_divround_comp_error(const char *type_name, const type dividend, const type divisor, const type comp_result, const type run_result) {
+  std::lock_guard<std::mutex> print_lock(print_mutex);
+  if (std::numeric_limits<type>::is_signed) {
+    std::printf("\nERROR: divround<%s, %" PRIi64 ">(%" PRIi64 ") returns %" PRIi64 ", but divround<%s> returns %" PRIi64 "\n\n", type_name,
+                static_cast<int64_t>(divisor), static_cast<int64_t>(dividend), static_cast<int64_t>(comp_result), type_name, static_cast<int64_t>(run_result));
+  } else {
+    std::printf("\nERROR: divround<%s, %" PRIu64 ">(%" PRIu64 ") returns %" PRIu64 ", but divround<%s> returns %" PRIu64 "\n\n", type_name,
+                static_cast<uint64_t>(divisor), static_cast<uint64_t>(dividend), static_cast<uint64_t>(comp_result), type_name, static_cast<uint64_t>(run_result));
+  }
+}
+
+/**
+ * Prints a mismatch between divround_array<type> and divround<type>.
+ * For the in place check only the divisor is meaningful.
+ */
+template <typename type> void report_divround_array_error(const char *type_name, const char *mode, const type dividend, const type divisor, const type array_result, const type run_result) {
+  std::lock_guard<std::mutex> print_lock(print_mutex);
+  if (mode[0] != '\0') {
+    std::printf("\nERROR: divround_array<%s>(..., %" PRIi64 ", ...)%s differs from the out of place results\n\n", type_name, static_cast<int64_t>(divisor), mode);
+  } else if (std::numeric_limits<type>::is_signed) {
+    std::printf("\nERROR: divround_array<%s> gives %" PRIi64 " for %" PRIi64 " / %" PRIi64 ", but divround<%s> returns %" PRIi64 "\n\n", type_name,
+                static_cast<int64_t>(array_result), static_cast<int64_t>(dividend), static_cast<int64_t>(divisor), type_name, static_cast<int64_t>(run_result));
+  } else {
+    std::printf("\nERROR: divround_array<%s> gives %" PRIu64 " for %" PRIu64 " / %" PRIu64 ", but divround<%s> returns %" PRIu64 "\n\n", type_name,
+                static_cast<uint64_t>(array_result), static_cast<uint64_t>(dividend), static_cast<uint64_t>(divisor), type_name, static_cast<uint64_t>(run_result));
+  }
+}
+
+/**
+ * Test c++ style divround<type, divisor> with compile time divisor for
+ * each of the divisors in the template parameter pack and dividend on
+ * [dividend_start, dividend_end]. Results are compared against
+ * divround<type>, which is tested against double precision ROUND() above.
+ * The most negative dividend is skipped for a divisor of -1 here and
+ * tested separately.
+ */
+template <typename type, type... divisors> void test_divround_comp(const char *type_name, const type dividend_start, const type dividend_end) {
+  typedef type (*divround_comp_function)(const type);
+  const type divisor_list[] = {divisors...};
+  const divround_comp_function function_list[] = {&divround<type, divisors>...};
+
+  for (size_t jDivisor = 0u; jDivisor < sizeof(divisor_list) / sizeof(divisor_list[0]); jDivisor++) {
+    const type divisor = divisor_list[jDivisor];
+    type dividend = dividend_start;
+    while (true) {
+      if (!(std::numeric_limits<type>::is_signed && dividend == std::numeric_limits<type>::lowest() && divisor == static_cast<type>(-1))) {
+        type comp_result = function_list[jDivisor](dividend);
+        type run_result = divround<type>(dividend, divisor);
+        if (comp_result != run_result) report_divround_comp_error<type>(type_name, dividend, divisor, comp_result, run_result);
+      }
+      if (dividend == dividend_end) break;
+      dividend++;
+    }
+  }
+}
+
+/**
+ * Returns the nonzero value of type at position index in ascending order.
+ */
+template <typename type> constexpr type divround_comp_test_divisor(const int index) {
+  return static_cast<type>(static_cast<int64_t>(std::numeric_limits<type>::lowest()) + index +
+                           ((static_cast<int64_t>(std::numeric_limits<type>::lowest()) + index >= 0) ? 1 : 0));
+}
+
+/**
+ * Test c++ style divround<type, divisor> for every nonzero divisor
+ * of an 8-bit type and every dividend.
+ */
+template <typename type, int... indices> void test_divround_comp_all_divisors(const char *type_name, std::integer_sequence<int, indices...>) {
+  test_divround_comp<type, divround_comp_test_divisor<type>(indices)...>(type_name, std::numeric_limits<type>::lowest(), std::numeric_limits<type>::max());
+}
+
+/**
+ * Appends every value on [first, last] to values.
+ */
+template <typename type> void append_range(std::vector<type> &values, const type first, const type last) {
+  type value = first;
+  while (true) {
+    values.push_back(value);
+    if (value == last) break;
+    value++;
+  }
+}
+
+/**
+ * Returns 2^k, 2^k - 1, and 2^k + 1 for every power of two of type, and
+ * for signed types their negatives and the most negative value, without
+ * 0 or duplicates.
+ */
+template <typename type> std::vector<type> divround_array_test_divisors(void) {
+  std::vector<type> divisors;
+  for (int k = 0; k < std::numeric_limits<type>::digits; k++) {
+    const uint64_t power = 1ull << k;
+    const uint64_t candidates[] = {power - 1ull, power, power + 1ull};
+    for (const uint64_t candidate : candidates) {
+      if (candidate == 0ull || candidate > static_cast<uint64_t>(std::numeric_limits<type>::max())) continue;
+      const type divisor = static_cast<type>(candidate);
+      if (std::find(divisors.begin(), divisors.end(), divisor) == divisors.end()) divisors.push_back(divisor);
+      if (std::numeric_limits<type>::is_signed && std::find(divisors.begin(), divisors.end(), static_cast<type>(0ull - candidate)) == divisors.end()) {
+        divisors.push_back(static_cast<type>(0ull - candidate));
+      }
+    }
+  }
+  /* 2^N - 1 for N value bits, whose power of two does not fit in type. */
+  divisors.push_back(std::numeric_limits<type>::max());
+  if (std::numeric_limits<type>::is_signed) {
+    divisors.push_back(static_cast<type>(-std::numeric_limits<type>::max()));
+    divisors.push_back(std::numeric_limits<type>::lowest());
+  }
+  return divisors;
+}
+
+/**
+ * Test divround_array<type> for divisors[first, last) against
+ * divround<type>, which is tested against ROUND() above. The most
+ * negative dividend is skipped for a divisor of -1 so that the debug code
+ * stays quiet.
+ */
+template <typename type> void test_divround_array(const char *type_name, const std::vector<type> &dividends, const std::vector<type> &divisors, const uint64_t first, const uint64_t last) {
+  std::vector<type> inputs;
+  std::vector<type> results;
+  for (uint64_t jDivisor = first; jDivisor < last; jDivisor++) {
+    const type divisor = divisors[jDivisor];
+    inputs = dividends;
+    if (std::numeric_limits<type>::is_signed && divisor == static_cast<type>(-1)) {
+      inputs.erase(std::remove(inputs.begin(), inputs.end(), std::numeric_limits<type>::lowest()), inputs.end());
+    }
+    results.assign(inputs.size(), static_cast<type>(0));
+    divround_array<type>(inputs.data(), inputs.size(), divisor, results.data());
+    for (size_t j = 0u; j < inputs.size(); j++) {
+      const type expected = divround<type>(inputs[j], divisor);
+      if (results[j] != expected) {
+        report_divround_array_error<type>(type_name, "", inputs[j], divisor, results[j], expected);
+        break;
+      }
+    }
+    /* In place; results already holds the expected quotients. */
+    divround_array<type>(inputs.data(), inputs.size(), divisor, inputs.data());
+    if (inputs != results) report_divround_array_error<type>(type_name, " in place", divisor, divisor, static_cast<type>(0), static_cast<type>(0));
+  }
+}
+
+/**
+ * Adds a pool job that runs test_divround_array over every divisor in
+ * divisors, one divisor per chunk. dividends and divisors must outlive
+ * test_pool::run().
+ */
+template <typename type> void add_divround_array_job(test_pool &pool, const char *name, const char *type_name, const std::vector<type> &dividends, const std::vector<type> &divisors) {
+  pool.add_job(name, divisors.size(), 1ull, [type_name, &dividends, &divisors](uint64_t first, uint64_t last) {
+    test_divround_array<type>(type_name, dividends, divisors, first, last);
+  });
+}
+
+/**
+ * Adds a pool job that runs test over the dividends
+ * [dividend_start, dividend_start + nDividends - 1]. Each chunk covers
+ * 256 dividends, and each dividend is tested against many divisors.
+ */
+template <typename type> void add_dividend_job(test_pool &pool, const char *name, void (*test)(type, type), const type dividend_start, const uint64_t nDividends) {
+  pool.add_job(name, nDividends, 256ull, [test, dividend_start](uint64_t first, uint64_t last) {
+    test(static_cast<type>(static_cast<uint64_t>(dividend_start) + first), static_cast<type>(static_cast<uint64_t>(dividend_start) + (last - 1ull)));
+  });
+}
+
 int main() {
   std::printf("\nTesting divround_i8\n");
   int8_t dividend_i8 = std::numeric_limits<int8_t>::lowest();
@@ -610,537 +806,134 @@ int main() {
     if (dividend_u8 == std::numeric_limits<uint8_t>::max()) break;
     dividend_u8++;
   }
+  std::printf("Testing divround<int8_t, divisor>\n");
+  test_divround_comp_all_divisors<int8_t>("int8_t", std::make_integer_sequence<int, 255>());
+  std::printf("Testing divround<uint8_t, divisor>\n");
+  test_divround_comp_all_divisors<uint8_t>("uint8_t", std::make_integer_sequence<int, 255>());
+
+  std::printf("Testing divround<int16_t, divisor>\n");
+  test_divround_comp<int16_t, -32768, -32767, -16385, -16384, -16383, -10000, -4096, -1000, -257, -256, -255, -100, -10, -7, -3, -2, -1,
+                     1, 2, 3, 5, 7, 10, 100, 255, 256, 257, 1000, 3000, 4096, 10000, 16383, 16384, 16385, 32766, 32767>
+                    ("int16_t", std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::max());
+  std::printf("Testing divround<uint16_t, divisor>\n");
+  test_divround_comp<uint16_t, 1u, 2u, 3u, 5u, 7u, 10u, 100u, 255u, 256u, 257u, 1000u, 3000u, 4096u, 10000u, 16383u, 16384u, 16385u,
+                     32767u, 32768u, 32769u, 40000u, 65534u, 65535u>
+                    ("uint16_t", std::numeric_limits<uint16_t>::lowest(), std::numeric_limits<uint16_t>::max());
+
+  std::printf("Testing divround<int32_t, divisor>\n");
+  test_divround_comp<int32_t, INT32_MIN, INT32_MIN + 1, -1073741824, -1000000007, -65536, -1000, -7, -3, -2, -1,
+                     1, 2, 3, 7, 1000, 65536, 1000000007, 1073741824, INT32_MAX - 1, INT32_MAX>
+                    ("int32_t", std::numeric_limits<int32_t>::lowest(), std::numeric_limits<int32_t>::lowest() + 65536);
+  test_divround_comp<int32_t, INT32_MIN, -1000000007, -1000, -7, -3, -2, -1, 1, 2, 3, 7, 1000, 1000000007, INT32_MAX>
+                    ("int32_t", -65536, 65536);
+  test_divround_comp<int32_t, INT32_MIN, -1000000007, -1000, -7, -3, -2, -1, 1, 2, 3, 7, 1000, 1000000007, INT32_MAX>
+                    ("int32_t", std::numeric_limits<int32_t>::max() - 65536, std::numeric_limits<int32_t>::max());
+  std::printf("Testing divround<uint32_t, divisor>\n");
+  test_divround_comp<uint32_t, 1u, 2u, 3u, 7u, 1000u, 65536u, 1000000007u, 2147483648u, 3000000000u, UINT32_MAX - 1u, UINT32_MAX>
+                    ("uint32_t", 0u, 131072u);
+  test_divround_comp<uint32_t, 1u, 2u, 3u, 7u, 1000u, 65536u, 1000000007u, 2147483648u, 3000000000u, UINT32_MAX - 1u, UINT32_MAX>
+                    ("uint32_t", std::numeric_limits<uint32_t>::max() - 131072u, std::numeric_limits<uint32_t>::max());
+
+  std::printf("Testing divround<int64_t, divisor>\n");
+  test_divround_comp<int64_t, INT64_MIN, INT64_MIN + 1ll, -4611686018427387904ll, -1000000000000000003ll, -4294967296ll, -1000ll, -7ll, -3ll, -2ll, -1ll,
+                     1ll, 2ll, 3ll, 7ll, 1000ll, 4294967296ll, 1000000000000000003ll, 4611686018427387904ll, INT64_MAX - 1ll, INT64_MAX>
+                    ("int64_t", std::numeric_limits<int64_t>::lowest(), std::numeric_limits<int64_t>::lowest() + 65536ll);
+  test_divround_comp<int64_t, INT64_MIN, -1000000000000000003ll, -1000ll, -7ll, -3ll, -2ll, -1ll, 1ll, 2ll, 3ll, 7ll, 1000ll, 1000000000000000003ll, INT64_MAX>
+                    ("int64_t", -65536ll, 65536ll);
+  test_divround_comp<int64_t, INT64_MIN, -1000000000000000003ll, -1000ll, -7ll, -3ll, -2ll, -1ll, 1ll, 2ll, 3ll, 7ll, 1000ll, 1000000000000000003ll, INT64_MAX>
+                    ("int64_t", std::numeric_limits<int64_t>::max() - 65536ll, std::numeric_limits<int64_t>::max());
+  std::printf("Testing divround<uint64_t, divisor>\n");
+  test_divround_comp<uint64_t, 1ull, 2ull, 3ull, 7ull, 1000ull, 4294967296ull, 1000000000000000003ull, 9223372036854775808ull, 12345678901234567890ull, UINT64_MAX - 1ull, UINT64_MAX>
+                    ("uint64_t", 0ull, 131072ull);
+  test_divround_comp<uint64_t, 1ull, 2ull, 3ull, 7ull, 1000ull, 4294967296ull, 1000000000000000003ull, 9223372036854775808ull, 12345678901234567890ull, UINT64_MAX - 1ull, UINT64_MAX>
+                    ("uint64_t", std::numeric_limits<uint64_t>::max() - 131072ull, std::numeric_limits<uint64_t>::max());
+
+  std::printf("Testing divround<type, -1> with the most negative dividend\n");
+  std::printf("The next four lines should be ERROR messages from the debug code.\n");
+  if (divround<int8_t, -1>(std::numeric_limits<int8_t>::lowest()) != std::numeric_limits<int8_t>::max())
+    std::printf("\nERROR: divround<int8_t, -1>(%i) should return %i\n\n", std::numeric_limits<int8_t>::lowest(), std::numeric_limits<int8_t>::max());
+  if (divround<int16_t, -1>(std::numeric_limits<int16_t>::lowest()) != std::numeric_limits<int16_t>::max())
+    std::printf("\nERROR: divround<int16_t, -1>(%i) should return %i\n\n", std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::max());
+  if (divround<int32_t, -1>(std::numeric_limits<int32_t>::lowest()) != std::numeric_limits<int32_t>::max())
+    std::printf("\nERROR: divround<int32_t, -1>(%i) should return %i\n\n", std::numeric_limits<int32_t>::lowest(), std::numeric_limits<int32_t>::max());
+  if (divround<int64_t, -1>(std::numeric_limits<int64_t>::lowest()) != std::numeric_limits<int64_t>::max())
+    std::printf("\nERROR: divround<int64_t, -1>(%" PRIi64 ") should return %" PRIi64 "\n\n", std::numeric_limits<int64_t>::lowest(), std::numeric_limits<int64_t>::max());
   
   /**
-   * Use one thread if only one hardware thread is available. Otherwise, use
-   * one less than the number of available hardware threads.
-   */
-  uint32_t nThreads = std::thread::hardware_concurrency();
-  if (nThreads <= 2u) nThreads = 1u;
-  else nThreads--;
-
-  /**
-   * Store all threads in vThreads.
-   */
-  std::vector<std::thread> vThreads(nThreads);
-
-  std::printf("\nStarting multithreaded tests with %u threads.\n\n", nThreads);
-
-  std::printf("Testing divround_i16\n"); 
-  /**
-   * Test dividends on the range [-2^15, 2^15-1] multithreaded
-   */
-  {
-    int32_t dividend_start = static_cast<int32_t>(std::numeric_limits<int16_t>::lowest());
-    uint32_t nDividends = (1u << 16);
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i16_c, static_cast<int16_t>(thread_dividend_start), static_cast<int16_t>(thread_dividend_end)));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround<int16_t>\n");
-  /**
-   * Test dividends on the range [-2^15, 2^15-1] multithreaded
-   */
-  {
-    int32_t dividend_start = static_cast<int32_t>(std::numeric_limits<int16_t>::lowest());
-    uint32_t nDividends = (1u << 16);
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i16_cpp, static_cast<int16_t>(thread_dividend_start), static_cast<int16_t>(thread_dividend_end)));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround_u16\n");
-  /**
-   * Test dividends on the range [0, 2^16-1] multithreaded
-   */
-  {
-    uint32_t dividend_start = static_cast<uint32_t>(std::numeric_limits<uint16_t>::lowest());
-    uint32_t nDividends = (1u << 16);
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    uint32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint32_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u16_c, static_cast<uint16_t>(thread_dividend_start), static_cast<uint16_t>(thread_dividend_end)));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround<uint16_t>\n");
-  /**
-   * Test dividends on the range [0, 2^16-1] multithreaded
-   */
-  {
-    uint32_t dividend_start = static_cast<uint32_t>(std::numeric_limits<uint16_t>::lowest());
-    uint32_t nDividends = (1u << 16);
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    uint32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint32_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u16_cpp, static_cast<uint16_t>(thread_dividend_start), static_cast<uint16_t>(thread_dividend_end)));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround_i32\n");
-  /**
-   * Test dividends on the range [-2^31, -2^31+2^16] multithreaded
-   */
-  {
-    int32_t dividend_start = std::numeric_limits<int32_t>::lowest();
-    uint32_t nDividends = (1u << 16) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i32_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [-2^16, 2^16] multithreaded
-   */
-  {
-    int32_t dividend_start = -(1 << 16);
-    uint32_t nDividends = (1u << 17) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i32_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^31-2^16-1, 2^31-1] multithreaded
-   */
-  {
-    int32_t dividend_start = std::numeric_limits<int32_t>::max() - (1 << 16);
-    uint32_t nDividends = (1u << 16) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i32_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround<int32_t>\n");
-  /**
-   * Test dividends on the range [-2^31, -2^31+2^16] multithreaded
+   * Queue every multithreaded test as pool jobs of chunked dividend
+   * ranges, then run them all on every hardware thread.
    */
-  {
-    int32_t dividend_start = std::numeric_limits<int32_t>::lowest();
-    uint32_t nDividends = (1u << 16) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i32_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [-2^16, 2^16] multithreaded
-   */
-  {
-    int32_t dividend_start = -(1 << 16);
-    uint32_t nDividends = (1u << 17) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i32_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^31-2^16-1, 2^31-1] multithreaded
-   */
-  {
-    int32_t dividend_start = std::numeric_limits<int32_t>::max() - (1 << 16);
-    uint32_t nDividends = (1u << 16) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    int32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int32_t thread_dividend_end = thread_dividend_start + static_cast<int32_t>(nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i32_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround_u32\n");
-  /**
-   * Test dividends on the range [0, 2^17] multithreaded
-   */
-  {
-    uint32_t dividend_start = std::numeric_limits<uint32_t>::lowest();
-    uint32_t nDividends = (1u << 17) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    uint32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint32_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u32_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1u;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^32-2^17-1, 2^32-1] multithreaded
-   */
-  {
-    uint32_t dividend_start = std::numeric_limits<uint32_t>::max() - (1u << 17);
-    uint32_t nDividends = (1u << 17) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    uint32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint32_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u32_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1u;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround<uint32_t>\n");
-  /**
-   * Test dividends on the range [0, 2^17] multithreaded
-   */
-  {
-    uint32_t dividend_start = std::numeric_limits<uint32_t>::lowest();
-    uint32_t nDividends = (1u << 17) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    uint32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint32_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u32_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1u;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^32-2^17-1, 2^32-1] multithreaded
-   */
-  {
-    uint32_t dividend_start = std::numeric_limits<uint32_t>::max() - (1u << 17);
-    uint32_t nDividends = (1u << 17) + 1u;
-    uint32_t nDividends_per_thread = nDividends / nThreads;
-    uint32_t nDividends_remaining = nDividends % nThreads;
-    uint32_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint32_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1u);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u32_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1u;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround_i64\n");
-  /**
-   * Test dividends on the range [-2^63, -2^63+2^16] multithreaded
-   */
-  {
-    int64_t dividend_start = std::numeric_limits<int64_t>::lowest();
-    uint64_t nDividends = (1ull << 16) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    int64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int64_t thread_dividend_end = thread_dividend_start + static_cast<int64_t>(nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i64_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ll;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [-2^16, 2^16] multithreaded
-   */
-  {
-    int64_t dividend_start = -(1ll << 16);
-    uint64_t nDividends = (1ull << 17) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    int64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int64_t thread_dividend_end = thread_dividend_start + static_cast<int64_t>(nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i64_c, thread_dividend_start,thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ll;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^63-2^16-1, 2^63-1] multithreaded
-   */
-  {
-    int64_t dividend_start = std::numeric_limits<int64_t>::max() - (1ll << 16);
-    uint64_t nDividends = (1ull << 16) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    int64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int64_t thread_dividend_end = thread_dividend_start + static_cast<int64_t>(nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i64_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ll;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround<int64_t>\n");
-    /**
-   * Test dividends on the range [-2^63, -2^63+2^16] multithreaded
-   */
-  {
-    int64_t dividend_start = std::numeric_limits<int64_t>::lowest();
-    uint64_t nDividends = (1ull << 16) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    int64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int64_t thread_dividend_end = thread_dividend_start + static_cast<int64_t>(nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i64_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ll;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [-2^16, 2^16] multithreaded
-   */
-  {
-    int64_t dividend_start = -(1ll << 16);
-    uint64_t nDividends = (1ull << 17) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    int64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int64_t thread_dividend_end = thread_dividend_start + static_cast<int64_t>(nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i64_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ll;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^63-2^16-1, 2^63-1] multithreaded
-   */
-  {
-    int64_t dividend_start = std::numeric_limits<int64_t>::max() - (1ll << 16);
-    uint64_t nDividends = (1ull << 16) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    int64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      int64_t thread_dividend_end = thread_dividend_start + static_cast<int64_t>(nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_i64_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ll;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround_u64\n");
-  /**
-   * Test dividends on the range [0, 2^17] multithreaded
-   */
-  {
-    uint64_t dividend_start = std::numeric_limits<uint64_t>::lowest();
-    uint64_t nDividends = (1ull << 17) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    uint64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint64_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u64_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ull;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^64-2^17-1, 2^64-1] multithreaded
-   */
-  {
-    uint64_t dividend_start = std::numeric_limits<uint64_t>::max() - (1ull << 17);
-    uint64_t nDividends = (1ull << 17) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    uint64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint64_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u64_c, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ull;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  std::printf("Testing divround<uint64_t>\n");
-  /**
-   * Test dividends on the range [0, 2^17] multithreaded
-   */
-  {
-    uint64_t dividend_start = std::numeric_limits<uint64_t>::lowest();
-    uint64_t nDividends = (1ull << 17) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    uint64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint64_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u64_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ull;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
-
-  /**
-   * Test dividends on the range [2^64-2^17-1, 2^64-1] multithreaded
-   */
-  {
-    uint64_t dividend_start = std::numeric_limits<uint64_t>::max() - (1ull << 17);
-    uint64_t nDividends = (1ull << 17) + 1ull;
-    uint64_t nDividends_per_thread = nDividends / nThreads;
-    uint64_t nDividends_remaining = nDividends % nThreads;
-    uint64_t thread_dividend_start = dividend_start;
-    for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-      uint64_t thread_dividend_end = thread_dividend_start + (nDividends_per_thread-1ull);
-      if (jThread < nDividends_remaining) thread_dividend_end++;
-      vThreads.at(jThread) = std::move(std::thread(test_divround_u64_cpp, thread_dividend_start, thread_dividend_end));
-      thread_dividend_start = thread_dividend_end+1ull;
-    }
-  }
-
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    vThreads.at(jThread).join();
-  }
+  test_pool pool(print_mutex);
+  std::printf("\nStarting multithreaded tests with %u threads.\n\n", pool.threads());
+
+  add_dividend_job<int16_t>(pool, "divround_i16 dividends [-2^15, 2^15-1]", test_divround_i16_c, std::numeric_limits<int16_t>::lowest(), 1ull << 16);
+  add_dividend_job<int16_t>(pool, "divround<int16_t> dividends [-2^15, 2^15-1]", test_divround_i16_cpp, std::numeric_limits<int16_t>::lowest(), 1ull << 16);
+  add_dividend_job<uint16_t>(pool, "divround_u16 dividends [0, 2^16-1]", test_divround_u16_c, std::numeric_limits<uint16_t>::lowest(), 1ull << 16);
+  add_dividend_job<uint16_t>(pool, "divround<uint16_t> dividends [0, 2^16-1]", test_divround_u16_cpp, std::numeric_limits<uint16_t>::lowest(), 1ull << 16);
+  add_dividend_job<int32_t>(pool, "divround_i32 dividends [-2^31, -2^31+2^16]", test_divround_i32_c, std::numeric_limits<int32_t>::lowest(), (1ull << 16) + 1ull);
+  add_dividend_job<int32_t>(pool, "divround_i32 dividends [-2^16, 2^16]", test_divround_i32_c, -(1 << 16), (1ull << 17) + 1ull);
+  add_dividend_job<int32_t>(pool, "divround_i32 dividends [2^31-2^16-1, 2^31-1]", test_divround_i32_c, std::numeric_limits<int32_t>::max() - (1 << 16), (1ull << 16) + 1ull);
+  add_dividend_job<int32_t>(pool, "divround<int32_t> dividends [-2^31, -2^31+2^16]", test_divround_i32_cpp, std::numeric_limits<int32_t>::lowest(), (1ull << 16) + 1ull);
+  add_dividend_job<int32_t>(pool, "divround<int32_t> dividends [-2^16, 2^16]", test_divround_i32_cpp, -(1 << 16), (1ull << 17) + 1ull);
+  add_dividend_job<int32_t>(pool, "divround<int32_t> dividends [2^31-2^16-1, 2^31-1]", test_divround_i32_cpp, std::numeric_limits<int32_t>::max() - (1 << 16), (1ull << 16) + 1ull);
+  add_dividend_job<uint32_t>(pool, "divround_u32 dividends [0, 2^17]", test_divround_u32_c, std::numeric_limits<uint32_t>::lowest(), (1ull << 17) + 1ull);
+  add_dividend_job<uint32_t>(pool, "divround_u32 dividends [2^32-2^17-1, 2^32-1]", test_divround_u32_c, std::numeric_limits<uint32_t>::max() - (1u << 17), (1ull << 17) + 1ull);
+  add_dividend_job<uint32_t>(pool, "divround<uint32_t> dividends [0, 2^17]", test_divround_u32_cpp, std::numeric_limits<uint32_t>::lowest(), (1ull << 17) + 1ull);
+  add_dividend_job<uint32_t>(pool, "divround<uint32_t> dividends [2^32-2^17-1, 2^32-1]", test_divround_u32_cpp, std::numeric_limits<uint32_t>::max() - (1u << 17), (1ull << 17) + 1ull);
+  add_dividend_job<int64_t>(pool, "divround_i64 dividends [-2^63, -2^63+2^20]", test_divround_i64_c, std::numeric_limits<int64_t>::lowest(), (1ull << 20) + 1ull);
+  add_dividend_job<int64_t>(pool, "divround_i64 dividends [-2^20, 2^20]", test_divround_i64_c, -(1ll << 20), (1ull << 21) + 1ull);
+  add_dividend_job<int64_t>(pool, "divround_i64 dividends [2^63-2^20-1, 2^63-1]", test_divround_i64_c, std::numeric_limits<int64_t>::max() - (1ll << 20), (1ull << 20) + 1ull);
+  add_dividend_job<int64_t>(pool, "divround<int64_t> dividends [-2^63, -2^63+2^20]", test_divround_i64_cpp, std::numeric_limits<int64_t>::lowest(), (1ull << 20) + 1ull);
+  add_dividend_job<int64_t>(pool, "divround<int64_t> dividends [-2^20, 2^20]", test_divround_i64_cpp, -(1ll << 20), (1ull << 21) + 1ull);
+  add_dividend_job<int64_t>(pool, "divround<int64_t> dividends [2^63-2^20-1, 2^63-1]", test_divround_i64_cpp, std::numeric_limits<int64_t>::max() - (1ll << 20), (1ull << 20) + 1ull);
+  add_dividend_job<uint64_t>(pool, "divround_u64 dividends [0, 2^21]", test_divround_u64_c, std::numeric_limits<uint64_t>::lowest(), (1ull << 21) + 1ull);
+  add_dividend_job<uint64_t>(pool, "divround_u64 dividends [2^64-2^21-1, 2^64-1]", test_divround_u64_c, std::numeric_limits<uint64_t>::max() - (1ull << 21), (1ull << 21) + 1ull);
+  add_dividend_job<uint64_t>(pool, "divround<uint64_t> dividends [0, 2^21]", test_divround_u64_cpp, std::numeric_limits<uint64_t>::lowest(), (1ull << 21) + 1ull);
+  add_dividend_job<uint64_t>(pool, "divround<uint64_t> dividends [2^64-2^21-1, 2^64-1]", test_divround_u64_cpp, std::numeric_limits<uint64_t>::max() - (1ull << 21), (1ull << 21) + 1ull);
+
+  /* The divround_array dividends: every 8-bit and 16-bit value and the 32-bit and 64-bit ranges above. */
+  std::vector<int8_t> array_dividends_i8;
+  append_range<int8_t>(array_dividends_i8, std::numeric_limits<int8_t>::lowest(), std::numeric_limits<int8_t>::max());
+  std::vector<uint8_t> array_dividends_u8;
+  append_range<uint8_t>(array_dividends_u8, std::numeric_limits<uint8_t>::lowest(), std::numeric_limits<uint8_t>::max());
+  std::vector<int16_t> array_dividends_i16;
+  append_range<int16_t>(array_dividends_i16, std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::max());
+  std::vector<uint16_t> array_dividends_u16;
+  append_range<uint16_t>(array_dividends_u16, std::numeric_limits<uint16_t>::lowest(), std::numeric_limits<uint16_t>::max());
+  std::vector<int32_t> array_dividends_i32;
+  append_range<int32_t>(array_dividends_i32, std::numeric_limits<int32_t>::lowest(), std::numeric_limits<int32_t>::lowest() + (1 << 16));
+  append_range<int32_t>(array_dividends_i32, -(1 << 16), 1 << 16);
+  append_range<int32_t>(array_dividends_i32, std::numeric_limits<int32_t>::max() - (1 << 16), std::numeric_limits<int32_t>::max());
+  std::vector<uint32_t> array_dividends_u32;
+  append_range<uint32_t>(array_dividends_u32, 0u, 1u << 17);
+  append_range<uint32_t>(array_dividends_u32, std::numeric_limits<uint32_t>::max() - (1u << 17), std::numeric_limits<uint32_t>::max());
+  std::vector<int64_t> array_dividends_i64;
+  append_range<int64_t>(array_dividends_i64, std::numeric_limits<int64_t>::lowest(), std::numeric_limits<int64_t>::lowest() + (1ll << 20));
+  append_range<int64_t>(array_dividends_i64, -(1ll << 20), 1ll << 20);
+  append_range<int64_t>(array_dividends_i64, std::numeric_limits<int64_t>::max() - (1ll << 20), std::numeric_limits<int64_t>::max());
+  std::vector<uint64_t> array_dividends_u64;
+  append_range<uint64_t>(array_dividends_u64, 0ull, 1ull << 21);
+  append_range<uint64_t>(array_dividends_u64, std::numeric_limits<uint64_t>::max() - (1ull << 21), std::numeric_limits<uint64_t>::max());
+
+  const std::vector<int8_t> array_divisors_i8 = divround_array_test_divisors<int8_t>();
+  const std::vector<uint8_t> array_divisors_u8 = divround_array_test_divisors<uint8_t>();
+  const std::vector<int16_t> array_divisors_i16 = divround_array_test_divisors<int16_t>();
+  const std::vector<uint16_t> array_divisors_u16 = divround_array_test_divisors<uint16_t>();
+  const std::vector<int32_t> array_divisors_i32 = divround_array_test_divisors<int32_t>();
+  const std::vector<uint32_t> array_divisors_u32 = divround_array_test_divisors<uint32_t>();
+  const std::vector<int64_t> array_divisors_i64 = divround_array_test_divisors<int64_t>();
+  const std::vector<uint64_t> array_divisors_u64 = divround_array_test_divisors<uint64_t>();
+
+  add_divround_array_job<int8_t>(pool, "divround_array<int8_t>", "int8_t", array_dividends_i8, array_divisors_i8);
+  add_divround_array_job<uint8_t>(pool, "divround_array<uint8_t>", "uint8_t", array_dividends_u8, array_divisors_u8);
+  add_divround_array_job<int16_t>(pool, "divround_array<int16_t>", "int16_t", array_dividends_i16, array_divisors_i16);
+  add_divround_array_job<uint16_t>(pool, "divround_array<uint16_t>", "uint16_t", array_dividends_u16, array_divisors_u16);
+  add_divround_array_job<int32_t>(pool, "divround_array<int32_t>", "int32_t", array_dividends_i32, array_divisors_i32);
+  add_divround_array_job<uint32_t>(pool, "divround_array<uint32_t>", "uint32_t", array_dividends_u32, array_divisors_u32);
+  add_divround_array_job<int64_t>(pool, "divround_array<int64_t>", "int64_t", array_dividends_i64, array_divisors_i64);
+  add_divround_array_job<uint64_t>(pool, "divround_array<uint64_t>", "uint64_t", array_dividends_u64, array_divisors_u64);
+
+  pool.run();
 
   std::printf("If there are no errors above, the tests were successful.\n\n");
   return 0;
@@ -0,0 +1,328 @@
+/**
+ * test_divround_narrow.cpp
+ * Tests
+ *   narrow divround_narrow_X(const wide dividend, const narrow divisor);
+ * and
+ *   type divround_narrow<typename type>(const wide_type dividend, const type divisor);
+ * against a saturated exact reference. X is a type abbreviation.
+ *
+ * divround_narrow_i8 and divround_narrow_u8 are tested for every dividend
+ * and every divisor, including 0. Their reference is the double precision
+ * ROUND() of the quotient, which is exact for these widths, clamped to the
+ * narrow type.
+ *
+ * The 32 / 16 and 64 / 32 functions are tested on every pair of the
+ * special_values from test_values.hpp for the wide and the narrow type,
+ * and on dividends placed within one divisor of each point where the
+ * rounded quotient leaves the narrow type, where rounding decides whether
+ * the result saturates. The 32 / 16
+ * reference is the double precision ROUND(), and the 64 / 32 reference is
+ * reference_divround<type> from intmath_reference.hpp on the wide type,
+ * both clamped to the narrow type.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "divround_narrow.hpp"
+#include "intmath_reference.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "divround_narrow.h"
+#ifdef __cplusplus
+  }
+#endif
+
+const size_t random_values_per_type = 4096u;
+const size_t boundary_divisors_per_pair = 200000u;
+
+uint64_t error_count = 0u;
+
+/**
+ * Binds each narrow type to its C function and to a reference that
+ * computes the exact rounded quotient in a wider type.
+ */
+template <typename type> struct narrow_pair;
+
+template <> struct narrow_pair<int8_t> {
+  typedef int16_t wide;
+  static int8_t c_function(const int16_t dividend, const int8_t divisor) { return divround_narrow_i8(dividend, divisor); }
+};
+
+template <> struct narrow_pair<uint8_t> {
+  typedef uint16_t wide;
+  static uint8_t c_function(const uint16_t dividend, const uint8_t divisor) { return divround_narrow_u8(dividend, divisor); }
+};
+
+template <> struct narrow_pair<int16_t> {
+  typedef int32_t wide;
+  static int16_t c_function(const int32_t dividend, const int16_t divisor) { return divround_narrow_i16(dividend, divisor); }
+};
+
+template <> struct narrow_pair<uint16_t> {
+  typedef uint32_t wide;
+  static uint16_t c_function(const uint32_t dividend, const uint16_t divisor) { return divround_narrow_u16(dividend, divisor); }
+};
+
+template <> struct narrow_pair<int32_t> {
+  typedef int64_t wide;
+  static int32_t c_function(const int64_t dividend, const int32_t divisor) { return divround_narrow_i32(dividend, divisor); }
+};
+
+template <> struct narrow_pair<uint32_t> {
+  typedef uint64_t wide;
+  static uint32_t c_function(const uint64_t dividend, const uint32_t divisor) { return divround_narrow_u32(dividend, divisor); }
+};
+
+/**
+ * Clamps an exact quotient given as a magnitude and sign to the range of type.
+ */
+template <typename type> type clamp_quotient(const uint64_t magnitude, const bool negative) {
+  if (negative) {
+    if (magnitude >= reference_magnitude<type>(std::numeric_limits<type>::lowest())) return std::numeric_limits<type>::lowest();
+    return static_cast<type>(0ull - magnitude);
+  }
+  if (magnitude >= static_cast<uint64_t>(std::numeric_limits<type>::max())) return std::numeric_limits<type>::max();
+  return static_cast<type>(magnitude);
+}
+
+/**
+ * Reference for pairs whose dividends are exact in a double. A 0 divisor
+ * is treated as 1.
+ */
+template <typename type> type reference_double(const typename narrow_pair<type>::wide dividend, const type divisor) {
+  const double quotient = std::round(static_cast<double>(dividend) / static_cast<double>(divisor == static_cast<type>(0) ? static_cast<type>(1) : divisor));
+  return clamp_quotient<type>(static_cast<uint64_t>(std::fabs(quotient)), quotient < 0.0);
+}
+
+/**
+ * Reference for the 64 / 32 pairs. reference_divround<wide> is exact
+ * except for the most negative dividend divided by -1, whose quotient
+ * does not fit in the wide type either.
+ */
+template <typename type> type reference_wide(const typename narrow_pair<type>::wide dividend, const type divisor) {
+  typedef typename narrow_pair<type>::wide wide;
+  const wide wide_divisor = (divisor == static_cast<type>(0)) ? static_cast<wide>(1) : static_cast<wide>(divisor);
+  if (std::numeric_limits<wide>::is_signed && dividend == std::numeric_limits<wide>::lowest() && wide_divisor == static_cast<wide>(-1)) {
+    return std::numeric_limits<type>::max();
+  }
+  const wide quotient = reference_divround<wide>(dividend, wide_divisor);
+  return clamp_quotient<type>(reference_magnitude<wide>(quotient), quotient < static_cast<wide>(0));
+}
+
+/**
+ * Checks the C and C++ versions on one dividend and divisor.
+ */
+template <typename type> void test_one(const char *type_name, const typename narrow_pair<type>::wide dividend, const type divisor, const type expected) {
+  const type c_result = narrow_pair<type>::c_function(dividend, divisor);
+  const type cpp_result = divround_narrow<type>(dividend, divisor);
+  typedef typename narrow_pair<type>::wide wide;
+  if (c_result != expected) {
+    report_error<wide>(error_count, type_name, "divround_narrow_X", {dividend, static_cast<wide>(divisor)}, static_cast<wide>(c_result), static_cast<wide>(expected));
+  }
+  if (cpp_result != expected) {
+    report_error<wide>(error_count, type_name, "divround_narrow", {dividend, static_cast<wide>(divisor)}, static_cast<wide>(cpp_result), static_cast<wide>(expected));
+  }
+}
+
+/**
+ * Tests every dividend and divisor of a 16 / 8 pair.
+ */
+template <typename type> void test_exhaustive(const char *type_name) {
+  typedef typename narrow_pair<type>::wide wide;
+  std::printf("Testing divround_narrow<%s> for every dividend and divisor\n", type_name);
+  const std::vector<type> divisors = all_values<type>();
+  for (const wide dividend : all_values<wide>()) {
+    for (const type divisor : divisors) test_one<type>(type_name, dividend, divisor, reference_double<type>(dividend, divisor));
+  }
+}
+
+/**
+ * Tests every pair of special values, then dividends within one divisor of
+ * +-(limit + 1/2) * divisor, where the rounded quotient crosses out of
+ * the narrow type.
+ */
+template <typename type> void test_random(const char *type_name, type (*reference)(const typename narrow_pair<type>::wide, const type), std::mt19937_64 &rng) {
+  typedef typename narrow_pair<type>::wide wide;
+  std::printf("Testing divround_narrow<%s> on special and boundary arguments\n", type_name);
+
+  const std::vector<wide> dividends = special_values<wide>(random_values_per_type, rng, true);
+  const std::vector<type> divisors = special_values<type>(random_values_per_type, rng, true);
+  for (const wide dividend : dividends) {
+    for (const type divisor : divisors) test_one<type>(type_name, dividend, divisor, reference(dividend, divisor));
+  }
+
+  for (type divisor : special_values<type>(boundary_divisors_per_pair, rng, false)) {
+    if (divisor == static_cast<type>(0)) divisor = static_cast<type>(1);
+    const uint64_t abs_divisor = reference_magnitude<type>(divisor);
+    const uint64_t limits[] = {static_cast<uint64_t>(std::numeric_limits<type>::max()), reference_magnitude<type>(std::numeric_limits<type>::lowest())};
+    for (const uint64_t limit : limits) {
+      if (limit == 0u) continue;
+      /* The magnitudes (limit * abs_divisor + abs_divisor / 2) +- 2 all fit in the wide type's magnitude range. */
+      const uint64_t center = limit * abs_divisor + abs_divisor / 2u;
+      for (uint64_t offset = 0u; offset <= 4u; offset++) {
+        const uint64_t magnitude = center + offset - 2u;
+        const wide positive = static_cast<wide>(magnitude);
+        if (reference_magnitude<wide>(positive) == magnitude) test_one<type>(type_name, positive, divisor, reference(positive, divisor));
+        if (std::numeric_limits<wide>::is_signed) {
+          const wide negative = static_cast<wide>(0ull - magnitude);
+          if (reference_magnitude<wide>(negative) == magnitude) test_one<type>(type_name, negative, divisor, reference(negative, divisor));
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  std::mt19937_64 rng(0xD17A2207ull);
+
+  test_exhaustive<int8_t>("int8_t");
+  test_exhaustive<uint8_t>("uint8_t");
+  test_random<int16_t>("int16_t", reference_double<int16_t>, rng);
+  test_random<uint16_t>("uint16_t", reference_double<uint16_t>, rng);
+  test_random<int32_t>("int32_t", reference_wide<int32_t>, rng);
+  test_random<uint32_t>("uint32_t", reference_wide<uint32_t>, rng);
+
+  std::printf("\nTests complete. %" PRIu64 " errors.\n", error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
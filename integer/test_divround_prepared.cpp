@@ -0,0 +1,286 @@
+/**
+ * test_divround_prepared.cpp
+ * Unit tests for the prepared divisor functions
+ *     divround_divisor_X divround_prepare_X(const type divisor);
+ *     type divround_prepared_X(const type dividend, const divround_divisor_X *divisor);
+ *     void divround_prepared_batch_X(const type *dividend, type *result, const size_t length, const divround_divisor_X *divisor);
+ * and the class template
+ *     divround_divisor<typename type>
+ * where X is a type abbreviation.
+ *
+ * Every result is compared against divround<type>(dividend, divisor) in
+ * divround.hpp, which is itself tested by test_divround.cpp. This includes
+ * the special cases of a 0 divisor and of the most negative number
+ * divided by -1.
+ *
+ * Full coverage is provided on the dividend and divisor inputs for the
+ * int8_t, uint8_t, int16_t, and uint16_t types. For the 16-bit types,
+ * every pair is checked through the batch forms, and the scalar forms are
+ * checked for every dividend against every 17th divisor.
+ *
+ * The 32-bit and 64-bit types are tested with divisors near 0, near every
+ * power of two, near the extremes of each type, and pseudorandom divisors,
+ * each against special and pseudorandom dividends.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "divround.hpp"
+#include "divround_prepared.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "divround_prepared.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Overloads that forward to the C functions so that the generic check
+ * routines below can call them.
+ */
+divround_divisor_i8  c_prepare(const int8_t   divisor) { return divround_prepare_i8(divisor); }
+divround_divisor_i16 c_prepare(const int16_t  divisor) { return divround_prepare_i16(divisor); }
+divround_divisor_i32 c_prepare(const int32_t  divisor) { return divround_prepare_i32(divisor); }
+divround_divisor_i64 c_prepare(const int64_t  divisor) { return divround_prepare_i64(divisor); }
+divround_divisor_u8  c_prepare(const uint8_t  divisor) { return divround_prepare_u8(divisor); }
+divround_divisor_u16 c_prepare(const uint16_t divisor) { return divround_prepare_u16(divisor); }
+divround_divisor_u32 c_prepare(const uint32_t divisor) { return divround_prepare_u32(divisor); }
+divround_divisor_u64 c_prepare(const uint64_t divisor) { return divround_prepare_u64(divisor); }
+
+int8_t   c_prepared(const int8_t   dividend, const divround_divisor_i8  *divisor) { return divround_prepared_i8(dividend, divisor); }
+int16_t  c_prepared(const int16_t  dividend, const divround_divisor_i16 *divisor) { return divround_prepared_i16(dividend, divisor); }
+int32_t  c_prepared(const int32_t  dividend, const divround_divisor_i32 *divisor) { return divround_prepared_i32(dividend, divisor); }
+int64_t  c_prepared(const int64_t  dividend, const divround_divisor_i64 *divisor) { return divround_prepared_i64(dividend, divisor); }
+uint8_t  c_prepared(const uint8_t  dividend, const divround_divisor_u8  *divisor) { return divround_prepared_u8(dividend, divisor); }
+uint16_t c_prepared(const uint16_t dividend, const divround_divisor_u16 *divisor) { return divround_prepared_u16(dividend, divisor); }
+uint32_t c_prepared(const uint32_t dividend, const divround_divisor_u32 *divisor) { return divround_prepared_u32(dividend, divisor); }
+uint64_t c_prepared(const uint64_t dividend, const divround_divisor_u64 *divisor) { return divround_prepared_u64(dividend, divisor); }
+
+void c_prepared_batch(const int8_t   *dividend, int8_t   *result, const size_t length, const divround_divisor_i8  *divisor) { divround_prepared_batch_i8(dividend, result, length, divisor); }
+void c_prepared_batch(const int16_t  *dividend, int16_t  *result, const size_t length, const divround_divisor_i16 *divisor) { divround_prepared_batch_i16(dividend, result, length, divisor); }
+void c_prepared_batch(const int32_t  *dividend, int32_t  *result, const size_t length, const divround_divisor_i32 *divisor) { divround_prepared_batch_i32(dividend, result, length, divisor); }
+void c_prepared_batch(const int64_t  *dividend, int64_t  *result, const size_t length, const divround_divisor_i64 *divisor) { divround_prepared_batch_i64(dividend, result, length, divisor); }
+void c_prepared_batch(const uint8_t  *dividend, uint8_t  *result, const size_t length, const divround_divisor_u8  *divisor) { divround_prepared_batch_u8(dividend, result, length, divisor); }
+void c_prepared_batch(const uint16_t *dividend, uint16_t *result, const size_t length, const divround_divisor_u16 *divisor) { divround_prepared_batch_u16(dividend, result, length, divisor); }
+void c_prepared_batch(const uint32_t *dividend, uint32_t *result, const size_t length, const divround_divisor_u32 *divisor) { divround_prepared_batch_u32(dividend, result, length, divisor); }
+void c_prepared_batch(const uint64_t *dividend, uint64_t *result, const size_t length, const divround_divisor_u64 *divisor) { divround_prepared_batch_u64(dividend, result, length, divisor); }
+
+/**
+ * Total number of mismatches found. Only the first few mismatches
+ * are printed.
+ */
+uint64_t error_count = 0u;
+
+/**
+ * Checks every form against divround<type> for one divisor and every
+ * element of dividends. The scalar forms are skipped if check_scalar
+ * is false.
+ */
+template <typename type> void check_divisor(const char *type_name, const std::vector<type> &dividends, const type divisor, const bool check_scalar) {
+  const size_t length = dividends.size();
+  std::vector<type> expected(length);
+  for (size_t j = 0u; j < length; j++) expected[j] = divround<type>(dividends[j], divisor);
+
+  const divround_divisor<type> cpp_divisor(divisor);
+  if (cpp_divisor.divisor() != divisor) report_error<type>(error_count, type_name, "divround_divisor::divisor", {static_cast<type>(0), divisor}, cpp_divisor.divisor(), divisor);
+  const auto c_divisor = c_prepare(divisor);
+
+  std::vector<type> result(length);
+  c_prepared_batch(dividends.data(), result.data(), length, &c_divisor);
+  for (size_t j = 0u; j < length; j++) {
+    if (result[j] != expected[j]) report_error<type>(error_count, type_name, "divround_prepared_batch", {dividends[j], divisor}, result[j], expected[j]);
+  }
+
+  result = dividends;
+  cpp_divisor.apply_batch(result.data(), length);
+  for (size_t j = 0u; j < length; j++) {
+    if (result[j] != expected[j]) report_error<type>(error_count, type_name, "divround_divisor::apply_batch", {dividends[j], divisor}, result[j], expected[j]);
+  }
+
+  if (check_scalar) {
+    for (size_t j = 0u; j < length; j++) {
+      type c_result = c_prepared(dividends[j], &c_divisor);
+      if (c_result != expected[j]) report_error<type>(error_count, type_name, "divround_prepared", {dividends[j], divisor}, c_result, expected[j]);
+      type cpp_result = cpp_divisor(dividends[j]);
+      if (cpp_result != expected[j]) report_error<type>(error_count, type_name, "divround_divisor::apply", {dividends[j], divisor}, cpp_result, expected[j]);
+    }
+  }
+}
+
+/**
+ * Every dividend against every divisor.
+ */
+template <typename type> void test_exhaustive(const char *type_name, const uint32_t scalar_stride) {
+  std::printf("testing divround_prepared<%s> and divround_divisor<%s>\n", type_name, type_name);
+  const std::vector<type> values = all_values<type>();
+  for (size_t j = 0u; j < values.size(); j++) check_divisor<type>(type_name, values, values[j], (j % scalar_stride) == 0u);
+}
+
+/**
+ * Special and pseudorandom dividends against special and pseudorandom divisors.
+ */
+template <typename type> void test_sampled(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("testing divround_prepared<%s> and divround_divisor<%s>\n", type_name, type_name);
+  const std::vector<type> divisors = special_values<type>(4096u, rng, true);
+  const std::vector<type> dividends = special_values<type>(16384u, rng, true);
+  for (type divisor : divisors) check_divisor<type>(type_name, dividends, divisor, true);
+}
+
+int main() {
+  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
+  std::mt19937_64 rng(0xD17D0D17ull);
+
+  test_exhaustive<int8_t>("int8_t", 1u);
+  test_exhaustive<uint8_t>("uint8_t", 1u);
+  test_exhaustive<int16_t>("int16_t", 17u);
+  test_exhaustive<uint16_t>("uint16_t", 17u);
+  test_sampled<int32_t>("int32_t", rng);
+  test_sampled<uint32_t>("uint32_t", rng);
+  test_sampled<int64_t>("int64_t", rng);
+  test_sampled<uint64_t>("uint64_t", rng);
+
+  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
+  std::printf("%" PRIu64 " errors. Tests took %" PRIu64 " ms\n", error_count, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
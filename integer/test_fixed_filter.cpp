@@ -0,0 +1,517 @@
+/**
+ * test_fixed_filter.cpp
+ * Tests
+ *   void fir_filter<typename type>(const type *input, type *output, const size_t length, const type *taps, const size_t tap_count, const uint8_t shift);
+ *   void biquad_filter<typename type>(biquad *biquads, const size_t channels, const type *input, type *output, const size_t frames);
+ * and the C functions behind them for int16_t and int32_t against a
+ * reference that forms each wrapped accumulator sum directly and rounds it
+ * with reference_shiftround from intmath_reference.hpp. These run on the
+ * scalar and AVX2 code paths through for_each_code_path, and the outputs
+ * are checked with check_guarded_array, both from test_values.hpp.
+ *
+ * The FIR tests cover tap counts from 0 to 64 and every length from 0 to
+ * 70 plus longer blocks, with taps either small enough that the
+ * accumulator cannot overflow or drawn from the whole type, so that
+ * saturation and wrapping are also exercised. Output may alias input, and
+ * the input elements just past the outputs must then be left alone.
+ *
+ * The biquad tests use 1 to 13 interleaved channels, each with its own
+ * coefficients and shift, and check that filtering a stream in two blocks
+ * gives the same outputs and final state as filtering it in one.
+ *
+ * Then fixed_filter_quantize from fixed_filter_design.hpp is checked:
+ * its values must be the rounded coefficients at its shift, no smaller
+ * shift may meet max_error, and a quantized FIR must stay within
+ * worst_error + 1/2 of the exact real filter.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <random>
+#include "fixed_filter.hpp"
+#include "fixed_filter_design.hpp"
+#include "intmath_reference.hpp"
+#include "test_values.hpp"
+
+const size_t fir_max_length = 70u;
+const size_t fir_long_lengths[] = {127u, 128u, 129u, 1000u};
+const size_t fir_tap_counts[] = {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 15u, 16u, 17u, 31u, 64u};
+const size_t biquad_max_channels = 13u;
+const size_t biquad_trials = 200u;
+
+/* Number of pseudorandom values added to special_values for each type. */
+const size_t random_values_per_type = 256u;
+
+uint64_t error_count = 0u;
+
+/**
+ * The accumulator of each filter type, its unsigned form for wrapping
+ * sums, and the largest valid shift.
+ */
+template <typename type> struct filter_test_traits;
+
+template <> struct filter_test_traits<int16_t> {
+  typedef int32_t accumulator;
+  typedef uint32_t uaccumulator;
+  static const uint8_t max_shift = 30u;
+  static void c_fir(const int16_t *input, int16_t *output, const size_t length, const int16_t *taps, const size_t tap_count, const uint8_t shift) {
+    fir_filter_i16(input, output, length, taps, tap_count, shift);
+  }
+};
+
+template <> struct filter_test_traits<int32_t> {
+  typedef int64_t accumulator;
+  typedef uint64_t uaccumulator;
+  static const uint8_t max_shift = 62u;
+  static void c_fir(const int32_t *input, int32_t *output, const size_t length, const int32_t *taps, const size_t tap_count, const uint8_t shift) {
+    fir_filter_i32(input, output, length, taps, tap_count, shift);
+  }
+};
+
+/* Returns ROUND(sum / 2^shift) saturated to type. */
+template <typename type> type reference_output(const typename filter_test_traits<type>::uaccumulator sum, const uint8_t shift) {
+  typedef typename filter_test_traits<type>::accumulator accumulator;
+  const accumulator rounded = reference_shiftround<accumulator>(static_cast<accumulator>(sum), shift);
+  if (rounded > static_cast<accumulator>(std::numeric_limits<type>::max())) return std::numeric_limits<type>::max();
+  if (rounded < static_cast<accumulator>(std::numeric_limits<type>::lowest())) return std::numeric_limits<type>::lowest();
+  return static_cast<type>(rounded);
+}
+
+/**
+ * Returns a random element of values, which come from special_values, with
+ * its magnitude capped below limit when limit is not 0.
+ */
+template <typename type> type draw_value(const std::vector<type> &values, std::mt19937_64 &rng, const int64_t limit) {
+  int64_t value = static_cast<int64_t>(values[rng() % values.size()]);
+  if (limit != 0) value %= limit;
+  return static_cast<type>(value);
+}
+
+template <typename type> void reference_fir(const type *input, type *output, const size_t length, const type *taps, const size_t tap_count, const uint8_t shift) {
+  typedef typename filter_test_traits<type>::uaccumulator uaccumulator;
+  for (size_t j = 0u; j < length; j++) {
+    uaccumulator sum = 0u;
+    for (size_t k = 0u; k < tap_count; k++)
+      sum += static_cast<uaccumulator>(static_cast<int64_t>(taps[k]) * static_cast<int64_t>(input[j + tap_count - 1u - k]));
+    output[j] = (shift > filter_test_traits<type>::max_shift) ? static_cast<type>(0) : reference_output<type>(sum, shift);
+  }
+}
+
+/**
+ * Checks output[0..length] against expected[0..length], the last element
+ * being the guard. size and detail describe the call in the error message.
+ */
+template <typename type> bool outputs_match(const char *description, const char *type_name, const std::vector<type> &output, const std::vector<type> &expected, const size_t length, const size_t size, const char *detail) {
+  for (size_t j = 0u; j <= length; j++) {
+    if (output[j] != expected[j]) {
+      error_count++;
+      std::printf("\nERROR: %s<%s>, %zu elements, %zu %s; element %zu: %" PRId64 ", expected %" PRId64 ".\n\n",
+                  description, type_name, length, size, detail, j, static_cast<int64_t>(output[j]), static_cast<int64_t>(expected[j]));
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Runs the template, the C function, and the in-place form on one block. */
+template <typename type> void test_fir_block(const char *type_name, const std::vector<type> &values, std::mt19937_64 &rng, const size_t length, const size_t tap_count, const bool small_taps) {
+  const int64_t tap_limit = small_taps ? (static_cast<int64_t>(std::numeric_limits<type>::max()) + 1) / static_cast<int64_t>(tap_count + 1u) : 0;
+  const uint8_t shift = static_cast<uint8_t>((rng() % 8u == 0u) ? rng() % 4u : rng() % (filter_test_traits<type>::max_shift + 1u));
+  std::vector<type> taps(tap_count);
+  std::vector<type> input(tap_count + length);
+  std::vector<type> expected(length);
+  char description[64];
+
+  for (type &tap : taps) tap = draw_value<type>(values, rng, tap_limit);
+  for (type &sample : input) sample = draw_value<type>(values, rng, 0);
+  reference_fir<type>(input.data(), expected.data(), length, taps.data(), tap_count, shift);
+
+  std::snprintf(description, sizeof(description), "fir_filter<%s>, %zu taps", type_name, tap_count);
+  if (!check_guarded_array(error_count, description, input, expected, [&](const type *in, type *output) {
+        fir_filter<type>(in, output, length, taps.data(), tap_count, shift);
+      })) return;
+
+  std::snprintf(description, sizeof(description), "fir_filter_X<%s>, %zu taps", type_name, tap_count);
+  if (!check_guarded_array(error_count, description, input, expected, [&](const type *in, type *output) {
+        filter_test_traits<type>::c_fir(in, output, length, taps.data(), tap_count, shift);
+      })) return;
+
+  /* In place, the tap_count - 1 samples after the outputs must be left alone. */
+  if (tap_count > 0u) {
+    std::vector<type> in_place(input.begin(), input.begin() + static_cast<ptrdiff_t>(tap_count - 1u + length));
+    in_place.push_back(guard_value<type>());
+    fir_filter<type>(in_place.data(), in_place.data(), length, taps.data(), tap_count, shift);
+    expected.insert(expected.end(), input.begin() + static_cast<ptrdiff_t>(length), input.begin() + static_cast<ptrdiff_t>(length + tap_count - 1u));
+    expected.push_back(guard_value<type>());
+    if (!outputs_match<type>("fir_filter in place", type_name, in_place, expected, length + tap_count - 1u, tap_count, "taps")) return;
+  }
+}
+
+template <typename type> void test_fir(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("Testing fir_filter<%s>\n", type_name);
+  const std::vector<type> values = special_values<type>(random_values_per_type, rng, false);
+  for (const size_t tap_count : fir_tap_counts) {
+    for (size_t length = 0u; length <= fir_max_length; length++) {
+      test_fir_block<type>(type_name, values, rng, length, tap_count, true);
+      test_fir_block<type>(type_name, values, rng, length, tap_count, false);
+    }
+    for (const size_t length : fir_long_lengths) {
+      test_fir_block<type>(type_name, values, rng, length, tap_count, true);
+      test_fir_block<type>(type_name, values, rng, length, tap_count, false);
+    }
+    if (error_count > 20u) return;
+  }
+
+  /* An invalid shift writes 0 to every output. */
+  const type taps[3] = {1, 2, 1};
+  const type input[10] = {5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
+  type output[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+  fir_filter<type>(input, output, 8u, taps, 3u, static_cast<uint8_t>(filter_test_traits<type>::max_shift + 1u));
+  for (size_t j = 0u; j < 8u; j++) {
+    if (output[j] != 0) {
+      error_count++;
+      std::printf("\nERROR: fir_filter<%s> with an invalid shift wrote %" PRId64 " to element %zu.\n\n", type_name, static_cast<int64_t>(output[j]), j);
+      return;
+    }
+  }
+}
+
+/* One channel of the reference biquad. */
+template <typename type> struct reference_biquad {
+  int64_t b0, b1, b2, a1, a2;
+  uint8_t shift;
+  int64_t x1, x2, y1, y2;
+
+  type filter(const type x0) {
+    typedef typename filter_test_traits<type>::uaccumulator uaccumulator;
+    const uaccumulator sum = static_cast<uaccumulator>(b0 * x0) + static_cast<uaccumulator>(b1 * x1) + static_cast<uaccumulator>(b2 * x2)
+                           - static_cast<uaccumulator>(a1 * y1) - static_cast<uaccumulator>(a2 * y2);
+    const type y0 = reference_output<type>(sum, shift);
+    x2 = x1;
+    x1 = x0;
+    y2 = y1;
+    y1 = y0;
+    return y0;
+  }
+};
+
+template <typename type> void test_biquad(const char *type_name, std::mt19937_64 &rng) {
+  typedef typename fixed_filter_biquad<type>::type biquad;
+  std::printf("Testing biquad_filter<%s>\n", type_name);
+  const std::vector<type> values = special_values<type>(random_values_per_type, rng, false);
+  char description[64];
+
+  for (size_t trial = 0u; trial < biquad_trials; trial++) {
+    const size_t channels = 1u + trial % biquad_max_channels;
+    const size_t frames = static_cast<size_t>(rng() % 300u);
+    const size_t split = (frames == 0u) ? 0u : static_cast<size_t>(rng() % (frames + 1u));
+    const bool small_coefficients = (trial % 2u) == 0u;
+    std::vector<biquad> whole(channels);
+    std::vector<reference_biquad<type>> references(channels);
+
+    for (size_t channel = 0u; channel < channels; channel++) {
+      const int64_t limit = small_coefficients ? (static_cast<int64_t>(std::numeric_limits<type>::max()) + 1) / 6 : 0;
+      const type b0 = draw_value<type>(values, rng, limit);
+      const type b1 = draw_value<type>(values, rng, limit);
+      const type b2 = draw_value<type>(values, rng, limit);
+      const type a1 = draw_value<type>(values, rng, limit);
+      const type a2 = draw_value<type>(values, rng, limit);
+      const uint8_t shift = static_cast<uint8_t>(rng() % (filter_test_traits<type>::max_shift + 1u));
+      whole[channel] = biquad_prepare<type>(b0, b1, b2, a1, a2, shift);
+      references[channel] = reference_biquad<type>{b0, b1, b2, a1, a2, shift, 0, 0, 0, 0};
+    }
+    std::vector<biquad> blocks = whole;
+
+    std::vector<type> input(frames * channels);
+    std::vector<type> expected(frames * channels);
+    for (type &sample : input) sample = draw_value<type>(values, rng, 0);
+    for (size_t f = 0u; f < frames; f++)
+      for (size_t channel = 0u; channel < channels; channel++)
+        expected[f * channels + channel] = references[channel].filter(input[f * channels + channel]);
+
+    /* Each offset filters the same frames, so every offset starts from the prepared state. */
+    std::snprintf(description, sizeof(description), "biquad_filter<%s>, %zu channels", type_name, channels);
+    std::vector<biquad> filtered = whole;
+    if (!check_guarded_array(error_count, description, input, expected, [&](const type *in, type *output) {
+          filtered = whole;
+          biquad_filter<type>(filtered.data(), channels, in, output, frames);
+        })) return;
+    whole = filtered;
+
+    /* Two blocks, the second in place. */
+    expected.push_back(guard_value<type>());
+    std::vector<type> in_place = input;
+    in_place.push_back(guard_value<type>());
+    biquad_filter<type>(blocks.data(), channels, in_place.data(), in_place.data(), split);
+    biquad_filter<type>(blocks.data(), channels, in_place.data() + split * channels, in_place.data() + split * channels, frames - split);
+    if (!outputs_match<type>("biquad_filter in two blocks", type_name, in_place, expected, frames * channels, channels, "channels")) return;
+
+    for (size_t channel = 0u; channel < channels; channel++) {
+      const reference_biquad<type> &reference = references[channel];
+      for (const biquad *state : {&whole[channel], &blocks[channel]}) {
+        if (state->x1 != reference.x1 || state->x2 != reference.x2 || state->y1 != reference.y1 || state->y2 != reference.y2) {
+          error_count++;
+          std::printf("\nERROR: biquad_filter<%s>, %zu channels, %zu frames; channel %zu ended with state {%" PRId64 ", %" PRId64 ", %" PRId64 ", %" PRId64 "}, expected {%" PRId64 ", %" PRId64 ", %" PRId64 ", %" PRId64 "}.\n\n",
+                      type_name, channels, frames, channel, static_cast<int64_t>(state->x1), static_cast<int64_t>(state->x2), static_cast<int64_t>(state->y1), static_cast<int64_t>(state->y2),
+                      reference.x1, reference.x2, reference.y1, reference.y2);
+          return;
+        }
+      }
+    }
+  }
+
+  /* A biquad prepared with an invalid shift outputs 0. */
+  biquad invalid = biquad_prepare<type>(1, 2, 1, 0, 0, static_cast<uint8_t>(filter_test_traits<type>::max_shift + 1u));
+  const type input[4] = {100, -100, 1000, 7};
+  type output[4] = {1, 1, 1, 1};
+  biquad_filter<type>(&invalid, 1u, input, output, 4u);
+  for (size_t j = 0u; j < 4u; j++) {
+    if (output[j] != 0) {
+      error_count++;
+      std::printf("\nERROR: biquad_filter<%s> prepared with an invalid shift output %" PRId64 " at frame %zu.\n\n", type_name, static_cast<int64_t>(output[j]), j);
+      return;
+    }
+  }
+}
+
+void report_quantize(const char *description) {
+  error_count++;
+  std::printf("\nERROR: fixed_filter_quantize: %s.\n\n", description);
+}
+
+/**
+ * Checks one quantization: values are the rounded coefficients, the error
+ * meets max_error, and shift - 1 would not.
+ */
+template <typename type> void check_quantization(const char *name, const std::vector<pow2_rational> &coefficients, const int64_t sample_min, const int64_t sample_max, const pow2_rational &max_error) {
+  const fixed_filter_coefficients<type> result = fixed_filter_quantize<type>(coefficients, pow2_int(sample_min), pow2_int(sample_max), max_error);
+  std::printf("  %s: shift %u, worst error %s\n", name, result.shift, pow2_rational_decimal(result.worst_error, 6u).c_str());
+  if (!result.found || result.values.size() != coefficients.size()) {
+    report_quantize(name);
+    return;
+  }
+  const pow2_rational magnitude(std::max(std::abs(sample_min), std::abs(sample_max)));
+  int nonzero = 0;
+  for (const pow2_rational &coefficient : coefficients)
+    if (coefficient != 0) nonzero++;
+  const pow2_rational share = max_error / nonzero;
+
+  for (int shift = result.shift; shift >= result.shift - 1 && shift >= 1; shift--) {
+    bool meets = true;
+    for (size_t j = 0u; j < coefficients.size(); j++) {
+      const pow2_rational scaled = coefficients[j] * pow2_rational(pow2_int(1) << shift);
+      /* Round half away from zero. */
+      const pow2_rational shifted = (scaled < 0) ? pow2_rational(scaled - pow2_rational(1, 2)) : pow2_rational(scaled + pow2_rational(1, 2));
+      const pow2_int value = numerator(shifted) / denominator(shifted);
+      const pow2_rational difference = pow2_rational(value, pow2_int(1) << shift) - coefficients[j];
+      if (magnitude * ((difference < 0) ? pow2_rational(-difference) : difference) >= share) meets = false;
+      if (shift == result.shift && value != pow2_int(result.values[j])) {
+        report_quantize(name);
+        std::printf("  value %zu is %" PRId64 "\n", j, static_cast<int64_t>(result.values[j]));
+        return;
+      }
+    }
+    if (shift == result.shift && (!meets || result.worst_error >= max_error)) report_quantize(name);
+    if (shift < result.shift && meets) report_quantize(name);
+  }
+}
+
+void test_quantize(std::mt19937_64 &rng) {
+  std::printf("Testing fixed_filter_quantize\n");
+  pow2_rational value;
+  std::vector<pow2_rational> lowpass;
+  for (const char *text : {"0.1", "0.2", "0.4", "0.2", "0.1"}) {
+    pow2_rational_parse_number(text, value);
+    lowpass.push_back(value);
+  }
+  std::vector<pow2_rational> biquad;
+  for (const char *text : {"0.0674552738890719", "0.1349105477781438", "0.0674552738890719", "-1.1429805025399011", "0.4128015980961886"}) {
+    pow2_rational_parse_number(text, value);
+    biquad.push_back(value);
+  }
+
+  check_quantization<int16_t>("12-bit lowpass FIR in int16_t", lowpass, -2048, 2047, pow2_rational(1, 2));
+  check_quantization<int32_t>("16-bit lowpass FIR in int32_t", lowpass, -32768, 32767, pow2_rational(1, 2));
+  check_quantization<int32_t>("16-bit biquad in int32_t", biquad, -32768, 32767, pow2_rational(1, 2));
+  check_quantization<int16_t>("12-bit biquad in int16_t", biquad, -2048, 2047, pow2_rational(4));
+  check_quantization<int16_t>("zero and exact coefficients", {pow2_rational(0), pow2_rational(1, 2), pow2_rational(-3, 4)}, -32768, 32767, pow2_rational(1, 2));
+
+  /* 1.9 needs 16 bits of fraction for full scale int16_t samples, which do not fit with its integer part. */
+  if (fixed_filter_quantize<int16_t>({pow2_rational(19, 10)}, pow2_int(-32768), pow2_int(32767)).found) report_quantize("1.9 for full scale int16_t was found");
+  if (fixed_filter_quantize<int16_t>({pow2_rational(1, 10)}, pow2_int(-40000), pow2_int(32767)).found) report_quantize("a sample range outside int16_t was accepted");
+  if (!fixed_filter_quantize<int16_t>(std::vector<pow2_rational>(8u, pow2_rational(1, 10)), pow2_int(-32768), pow2_int(32767), pow2_rational(8)).accumulator_fits)
+    report_quantize("accumulator_fits is false for 8 taps of 0.1");
+
+  /* The quantized FIR must track the exact filter to within worst_error + 1/2. */
+  const fixed_filter_coefficients<int16_t> quantized = fixed_filter_quantize<int16_t>(lowpass, pow2_int(-2048), pow2_int(2047));
+  const double bound = quantized.worst_error.convert_to<double>() + 0.5 + 1.0e-9;
+  std::uniform_int_distribution<int> sample_distribution(-2048, 2047);
+  std::vector<int16_t> input(lowpass.size() - 1u + 1000u);
+  std::vector<int16_t> output(1000u);
+  for (int16_t &sample : input) sample = static_cast<int16_t>(sample_distribution(rng));
+  fir_filter<int16_t>(input.data(), output.data(), output.size(), quantized.values.data(), quantized.values.size(), quantized.shift);
+  for (size_t j = 0u; j < output.size(); j++) {
+    double exact = 0.0;
+    for (size_t k = 0u; k < lowpass.size(); k++) exact += lowpass[k].convert_to<double>() * input[j + lowpass.size() - 1u - k];
+    if (std::fabs(output[j] - exact) > bound) {
+      error_count++;
+      std::printf("\nERROR: quantized lowpass output %zu is %i, exact %f, allowed error %f.\n\n", j, output[j], exact, bound);
+      return;
+    }
+  }
+}
+
+int main() {
+  std::mt19937_64 rng(0xF1173Bu);
+
+  for_each_code_path(CPU_FEATURE_AVX2, [&]() {
+    test_fir<int16_t>("int16_t", rng);
+    test_fir<int32_t>("int32_t", rng);
+    test_biquad<int16_t>("int16_t", rng);
+    test_biquad<int32_t>("int32_t", rng);
+  });
+
+  std::printf("\n");
+  test_quantize(rng);
+
+  std::printf("\nTests complete. %" PRIu64 " errors.\n", error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,619 @@
+/**
+ * test_fixed_point.cpp
+ * Unit tests for the class template
+ *     fixed<uint8_t int_bits, uint8_t frac_bits, typename storage, typename overflow, typename rounding>
+ * and the templated functions
+ *     result fixed_cast<typename result>(const fixed<...> value);
+ *     result fixed_mul<typename result>(const fixed<...> a, const fixed<...> b);
+ *     result fixed_div<typename result>(const fixed<...> a, const fixed<...> b);
+ * in fixed_point.hpp.
+ *
+ * Every result is compared against an exact value formed from the raw
+ * inputs with the helpers in intmath_reference.hpp: the product or
+ * shifted value is formed at 128-bit width, rounded as the rounding policy
+ * requires, and then either narrowed to its low bits (fixed_wrap) or
+ * clamped to the result storage range (fixed_saturate). Each format
+ * combination is checked with both overflow policies and every rounding
+ * policy, except that 64-bit products only round half away from zero.
+ *
+ * Full coverage of the raw inputs is provided for 8-bit storage and for
+ * fixed_cast from 16-bit storage. The wider storage types are tested
+ * with special and pseudorandom raw values, many of which have their low
+ * bits cleared so that exact results and ties are common.
+ *
+ * Quotient overflow (the lowest signed value divided by -1) behaves as in
+ * divround and is not compared. from_double is checked against std::round
+ * for pseudorandom doubles of every magnitude up to past the range of
+ * each format.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "fixed_point.hpp"
+#include "intmath_reference.hpp"
+
+/* Formats from thermistor_interpolator and other typical uses. */
+typedef fixed<9, 7, int16_t> q9_7;
+typedef fixed<1, 15, int16_t> q1_15;
+typedef fixed<17, 15, int32_t, fixed_saturate> q17_15_sat;
+
+/* Constant expressions, checked at compile time. */
+static_assert(q9_7::from_double(25.5).raw() == 3264, "from_double is not a constant expression or is wrong.");
+static_assert(q9_7::from_double(-0.5 / 128.0).raw() == -1, "from_double must round half away from zero.");
+static_assert(q9_7::from_double(0.49999999999999994 / 128.0).raw() == 0, "from_double must not round 0.49999999999999994 up.");
+static_assert(q9_7::from_double(1.0e6).raw() == 32767 && q9_7::from_double(-1.0e6).raw() == -32768, "from_double must saturate.");
+static_assert(fixed<0, 8, uint8_t>::from_double(-3.0).raw() == 0u, "from_double must saturate unsigned formats at 0.");
+static_assert(fixed<1, 63, int64_t>::from_double(1.0).raw() == std::numeric_limits<int64_t>::max(), "from_double must saturate at 2^63.");
+static_assert(q9_7::from_raw(3264).to_double() == 25.5, "to_double is not a constant expression or is wrong.");
+static_assert(q9_7::from_raw(-5) < q9_7::from_raw(3) && q9_7::from_raw(3) == fixed<9, 7, int16_t, fixed_saturate>::from_raw(3), "comparisons are not constant expressions or are wrong.");
+
+/**
+ * Total number of comparisons and of mismatches found. Only the first
+ * few mismatches are printed.
+ */
+uint64_t test_count = 0u;
+uint64_t error_count = 0u;
+const uint64_t max_printed_errors = 16u;
+
+template <typename type> const char *storage_name(void) {
+  return std::numeric_limits<type>::is_signed
+         ? (sizeof(type) == 1u ? "int8_t" : sizeof(type) == 2u ? "int16_t" : sizeof(type) == 4u ? "int32_t" : "int64_t")
+         : (sizeof(type) == 1u ? "uint8_t" : sizeof(type) == 2u ? "uint16_t" : sizeof(type) == 4u ? "uint32_t" : "uint64_t");
+}
+
+/* Writes "Qi.f storage" into text. */
+template <typename format> const char *format_name(char (&text)[32]) {
+  std::snprintf(text, sizeof(text), "Q%u.%u %s", static_cast<unsigned>(format::integer_bits), static_cast<unsigned>(format::fraction_bits), storage_name<typename format::storage_type>());
+  return text;
+}
+
+/**
+ * Counts one comparison of result against expected and prints the first
+ * few mismatches with the raw inputs and the policies of the result.
+ */
+template <typename result> void check(const char *operation, const int64_t a, const int64_t b, const result value, const typename result::storage_type expected) {
+  test_count++;
+  if (value.raw() == expected) return;
+  error_count++;
+  if (error_count <= max_printed_errors) {
+    char text[32];
+    std::printf("\nERROR: %s into %s, %s, %s with raw inputs %" PRIi64 ", %" PRIi64 ": raw result %" PRIi64 ", expected %" PRIi64 "\n\n", operation, format_name<result>(text),
+                result::overflow_type::name(), result::rounding_type::name(), a, b, static_cast<int64_t>(value.raw()), static_cast<int64_t>(expected));
+  }
+}
+
+/* format with the given overflow and rounding policies. */
+template <typename format, typename overflow, typename rounding> struct with_policies {
+  typedef fixed<format::integer_bits, format::fraction_bits, typename format::storage_type, overflow, rounding> type;
+};
+
+/********************************************************************************
+ ********                       exact references                         ********
+ ********************************************************************************/
+
+/* An exact result as a 128-bit magnitude and a sign. */
+struct exact_value {
+  reference_u128 mag;
+  bool negative;
+};
+
+template <typename type> exact_value exact_from(const type value) {
+  exact_value exact;
+  exact.mag.hi = 0ull;
+  exact.mag.lo = reference_magnitude<type>(value);
+  exact.negative = value < static_cast<type>(0);
+  return exact;
+}
+
+/* Narrows an exact value to its low bits. */
+template <typename result_storage> result_storage exact_narrow(const exact_value exact, fixed_wrap) {
+  return reference_apply_sign<result_storage>(exact.mag.lo, exact.negative);
+}
+
+/* Clamps an exact value to the range of result_storage. */
+template <typename result_storage> result_storage exact_narrow(const exact_value exact, fixed_saturate) {
+  if (exact.negative) {
+    if (exact.mag.hi != 0ull || exact.mag.lo > reference_magnitude<result_storage>(std::numeric_limits<result_storage>::lowest())) return std::numeric_limits<result_storage>::lowest();
+  }
+  else if (exact.mag.hi != 0ull || exact.mag.lo > static_cast<uint64_t>(std::numeric_limits<result_storage>::max())) {
+    return std::numeric_limits<result_storage>::max();
+  }
+  return reference_apply_sign<result_storage>(exact.mag.lo, exact.negative);
+}
+
+/* exact * 2^shift for shift on [0, 63]. */
+exact_value exact_shift_left(exact_value exact, const int shift) {
+  if (shift > 0) {
+    exact.mag.hi = (exact.mag.hi << shift) | (exact.mag.lo >> (64 - shift));
+    exact.mag.lo <<= shift;
+  }
+  return exact;
+}
+
+/* The exact value of raw in the format of result, rounded and narrowed as result requires. */
+template <typename result, typename storage> typename result::storage_type expected_cast(const storage raw, const int frac_bits) {
+  exact_value exact = exact_from<storage>(raw);
+  const int shift = frac_bits - static_cast<int>(result::fraction_bits);
+  if (shift > 0) exact.mag = reference_shift_u128(exact.mag, static_cast<uint8_t>(shift), exact.negative, typename result::rounding_type());
+  else exact = exact_shift_left(exact, -shift);
+  return exact_narrow<typename result::storage_type>(exact, typename result::overflow_type());
+}
+
+template <typename result, typename storage> typename result::storage_type expected_mul(const storage a, const storage b, const int shift) {
+  exact_value exact;
+  exact.mag = reference_mul_u64(reference_magnitude<storage>(a), reference_magnitude<storage>(b));
+  exact.negative = (a < static_cast<storage>(0)) != (b < static_cast<storage>(0));
+  exact.mag = reference_shift_u128(exact.mag, static_cast<uint8_t>(shift), exact.negative, typename result::rounding_type());
+  return exact_narrow<typename result::storage_type>(exact, typename result::overflow_type());
+}
+
+/* (a * 2^shift) / b when shift >= 0 and a / (b * 2^-shift) otherwise. The shifted magnitudes fit in 64 bits for every format tested. */
+template <typename result, typename storage> typename result::storage_type expected_div(const storage a, const storage b, const int shift) {
+  const uint64_t dividend = reference_magnitude<storage>(a) << (shift > 0 ? shift : 0);
+  const uint64_t divisor = reference_magnitude<storage>(b) << (shift < 0 ? -shift : 0);
+  exact_value exact;
+  exact.negative = (a < static_cast<storage>(0)) != (b < static_cast<storage>(0));
+  exact.mag.hi = 0ull;
+  exact.mag.lo = dividend / divisor;
+  const uint64_t remainder = dividend - exact.mag.lo * divisor;
+  const int versus_half = (remainder < divisor - remainder) ? -1 : (remainder == divisor - remainder ? 0 : 1);
+  if (reference_rounds_up(versus_half, remainder != 0ull, exact.negative, (exact.mag.lo & 1ull) != 0ull, typename result::rounding_type())) exact.mag.lo++;
+  return exact_narrow<typename result::storage_type>(exact, typename result::overflow_type());
+}
+
+/* a + b or a - b formed exactly from the 65-bit magnitudes. */
+template <typename result, typename storage> typename result::storage_type expected_add(const storage a, const storage b, const bool subtract) {
+  const exact_value x = exact_from<storage>(a);
+  exact_value y = exact_from<storage>(b);
+  if (subtract) y.negative = !y.negative && y.mag.lo != 0ull;
+  exact_value sum;
+  sum.mag.hi = 0ull;
+  if (x.negative == y.negative) {
+    sum.mag.lo = x.mag.lo + y.mag.lo;
+    sum.mag.hi = (sum.mag.lo < x.mag.lo) ? 1ull : 0ull;
+    sum.negative = x.negative;
+  }
+  else if (x.mag.lo >= y.mag.lo) {
+    sum.mag.lo = x.mag.lo - y.mag.lo;
+    sum.negative = x.negative && sum.mag.lo != 0ull;
+  }
+  else {
+    sum.mag.lo = y.mag.lo - x.mag.lo;
+    sum.negative = y.negative;
+  }
+  return exact_narrow<typename result::storage_type>(sum, typename result::overflow_type());
+}
+
+/********************************************************************************
+ ********                         raw inputs                             ********
+ ********************************************************************************/
+
+/**
+ * Every value for 8-bit storage. Otherwise the values near 0 and the
+ * limits, followed by pseudorandom values, half of them with a random
+ * number of low bits cleared.
+ */
+template <typename storage> std::vector<storage> raw_inputs(const size_t random_count, std::mt19937_64 &rng) {
+  std::vector<storage> values;
+  if (sizeof(storage) == 1u) {
+    for (int j = std::numeric_limits<storage>::lowest(); j <= std::numeric_limits<storage>::max(); j++) values.push_back(static_cast<storage>(j));
+    return values;
+  }
+  for (int j = -64; j <= 64; j++) {
+    values.push_back(static_cast<storage>(j));
+    values.push_back(static_cast<storage>(std::numeric_limits<storage>::max() - static_cast<storage>(j + 64)));
+    values.push_back(static_cast<storage>(std::numeric_limits<storage>::lowest() + static_cast<storage>(j + 64)));
+  }
+  std::uniform_int_distribution<uint64_t> bits;
+  std::uniform_int_distribution<int> cleared(0, 8 * static_cast<int>(sizeof(storage)) - 1);
+  for (size_t j = 0u; j < random_count; j++) {
+    uint64_t value = bits(rng);
+    if ((j & 1u) != 0u) value &= ~0ull << cleared(rng);
+    values.push_back(static_cast<storage>(value));
+  }
+  return values;
+}
+
+/* Pairs of raw inputs: every pair for 8-bit storage, pseudorandom pairs otherwise. */
+template <typename storage> std::vector<std::pair<storage, storage> > raw_pairs(std::mt19937_64 &rng) {
+  const std::vector<storage> values = raw_inputs<storage>(1024u, rng);
+  std::vector<std::pair<storage, storage> > pairs;
+  if (sizeof(storage) == 1u) {
+    for (storage a : values) for (storage b : values) pairs.push_back(std::make_pair(a, b));
+    return pairs;
+  }
+  std::uniform_int_distribution<size_t> pick(0u, values.size() - 1u);
+  for (size_t j = 0u; j < (1u << 18); j++) pairs.push_back(std::make_pair(values[pick(rng)], values[pick(rng)]));
+  return pairs;
+}
+
+/********************************************************************************
+ ********                           tests                                ********
+ ********************************************************************************/
+
+template <typename source, typename result> void test_cast_policy(const std::vector<typename source::storage_type> &values) {
+  for (typename source::storage_type raw : values) {
+    check("fixed_cast", raw, 0, fixed_cast<result>(source::from_raw(raw)), expected_cast<result>(raw, source::fraction_bits));
+  }
+}
+
+template <typename source, typename result, typename overflow> void test_cast_rounding(const std::vector<typename source::storage_type> &values) {
+  test_cast_policy<source, typename with_policies<result, overflow, round_half_away>::type>(values);
+  test_cast_policy<source, typename with_policies<result, overflow, round_half_even>::type>(values);
+  test_cast_policy<source, typename with_policies<result, overflow, round_floor>::type>(values);
+  test_cast_policy<source, typename with_policies<result, overflow, round_trunc>::type>(values);
+}
+
+/* fixed_cast from source to result, every raw source value for 8-bit and 16-bit storage. */
+template <typename source, typename result> void test_cast(std::mt19937_64 &rng) {
+  typedef typename source::storage_type storage;
+  std::vector<storage> values;
+  if (sizeof(storage) <= 2u) {
+    for (int64_t j = std::numeric_limits<storage>::lowest(); j <= static_cast<int64_t>(std::numeric_limits<storage>::max()); j++) values.push_back(static_cast<storage>(j));
+  }
+  else {
+    values = raw_inputs<storage>(1u << 16, rng);
+  }
+  test_cast_rounding<source, result, fixed_wrap>(values);
+  test_cast_rounding<source, result, fixed_saturate>(values);
+}
+
+template <typename a_format, typename b_format, typename result> void test_mul_policy(const std::vector<std::pair<typename a_format::storage_type, typename a_format::storage_type> > &pairs) {
+  const int shift = a_format::fraction_bits + b_format::fraction_bits - result::fraction_bits;
+  for (const auto &pair : pairs) {
+    check("fixed_mul", pair.first, pair.second, fixed_mul<result>(a_format::from_raw(pair.first), b_format::from_raw(pair.second)), expected_mul<result>(pair.first, pair.second, shift));
+  }
+}
+
+/* Only round_half_away is defined for 64-bit products. */
+template <typename a_format, typename b_format, typename result, typename overflow> void test_mul_rounding(const std::vector<std::pair<typename a_format::storage_type, typename a_format::storage_type> > &pairs, std::true_type /* 64-bit */) {
+  test_mul_policy<a_format, b_format, typename with_policies<result, overflow, round_half_away>::type>(pairs);
+}
+
+template <typename a_format, typename b_format, typename result, typename overflow> void test_mul_rounding(const std::vector<std::pair<typename a_format::storage_type, typename a_format::storage_type> > &pairs, std::false_type /* 64-bit */) {
+  test_mul_policy<a_format, b_format, typename with_policies<result, overflow, round_half_away>::type>(pairs);
+  test_mul_policy<a_format, b_format, typename with_policies<result, overflow, round_half_even>::type>(pairs);
+  test_mul_policy<a_format, b_format, typename with_policies<result, overflow, round_floor>::type>(pairs);
+  test_mul_policy<a_format, b_format, typename with_policies<result, overflow, round_trunc>::type>(pairs);
+}
+
+template <typename a_format, typename b_format, typename result> void test_mul(std::mt19937_64 &rng) {
+  typedef typename a_format::storage_type storage;
+  const std::vector<std::pair<storage, storage> > pairs = raw_pairs<storage>(rng);
+  test_mul_rounding<a_format, b_format, result, fixed_wrap>(pairs, std::integral_constant<bool, (sizeof(storage) == 8u)>());
+  test_mul_rounding<a_format, b_format, result, fixed_saturate>(pairs, std::integral_constant<bool, (sizeof(storage) == 8u)>());
+}
+
+template <typename a_format, typename b_format, typename result> void test_div_policy(const std::vector<std::pair<typename a_format::storage_type, typename a_format::storage_type> > &pairs) {
+  typedef typename a_format::storage_type storage;
+  const int shift = result::fraction_bits + b_format::fraction_bits - a_format::fraction_bits;
+  for (const auto &pair : pairs) {
+    if (pair.second == static_cast<storage>(0)) continue;
+    if (std::numeric_limits<storage>::is_signed && pair.first == std::numeric_limits<storage>::lowest() && pair.second == static_cast<storage>(-1)) continue;
+    check("fixed_div", pair.first, pair.second, fixed_div<result>(a_format::from_raw(pair.first), b_format::from_raw(pair.second)), expected_div<result>(pair.first, pair.second, shift));
+  }
+}
+
+template <typename a_format, typename b_format, typename result, typename overflow> void test_div_rounding(const std::vector<std::pair<typename a_format::storage_type, typename a_format::storage_type> > &pairs) {
+  test_div_policy<a_format, b_format, typename with_policies<result, overflow, round_half_away>::type>(pairs);
+  test_div_policy<a_format, b_format, typename with_policies<result, overflow, round_half_even>::type>(pairs);
+  test_div_policy<a_format, b_format, typename with_policies<result, overflow, round_floor>::type>(pairs);
+  test_div_policy<a_format, b_format, typename with_policies<result, overflow, round_trunc>::type>(pairs);
+}
+
+template <typename a_format, typename b_format, typename result> void test_div(std::mt19937_64 &rng) {
+  typedef typename a_format::storage_type storage;
+  const std::vector<std::pair<storage, storage> > pairs = raw_pairs<storage>(rng);
+  test_div_rounding<a_format, b_format, result, fixed_wrap>(pairs);
+  test_div_rounding<a_format, b_format, result, fixed_saturate>(pairs);
+}
+
+/* +, -, unary -, and the comparisons for both overflow policies. */
+template <typename format> void test_add(std::mt19937_64 &rng) {
+  typedef typename format::storage_type storage;
+  typedef typename with_policies<format, fixed_wrap, round_half_away>::type wrap;
+  typedef typename with_policies<format, fixed_saturate, round_half_away>::type saturate;
+  const std::vector<std::pair<storage, storage> > pairs = raw_pairs<storage>(rng);
+  for (const auto &pair : pairs) {
+    const wrap a = wrap::from_raw(pair.first);
+    const wrap b = wrap::from_raw(pair.second);
+    const saturate a_sat = saturate::from_raw(pair.first);
+    const saturate b_sat = saturate::from_raw(pair.second);
+    check("+", pair.first, pair.second, a + b, expected_add<wrap>(pair.first, pair.second, false));
+    check("-", pair.first, pair.second, a - b, expected_add<wrap>(pair.first, pair.second, true));
+    check("+", pair.first, pair.second, a_sat + b_sat, expected_add<saturate>(pair.first, pair.second, false));
+    check("-", pair.first, pair.second, a_sat - b_sat, expected_add<saturate>(pair.first, pair.second, true));
+    wrap sum = a;
+    sum += b;
+    check("+=", pair.first, pair.second, sum, (a + b).raw());
+
+    test_count++;
+    if ((a < b) != (pair.first < pair.second) || (a == b_sat) != (pair.first == pair.second) || (a >= b) != (pair.first >= pair.second)) {
+      error_count++;
+      if (error_count <= max_printed_errors) std::printf("\nERROR: comparison of raw values %" PRIi64 " and %" PRIi64 "\n\n", static_cast<int64_t>(pair.first), static_cast<int64_t>(pair.second));
+    }
+  }
+}
+
+template <typename format> void test_negate(std::mt19937_64 &rng) {
+  typedef typename format::storage_type storage;
+  typedef typename with_policies<format, fixed_wrap, round_half_away>::type wrap;
+  typedef typename with_policies<format, fixed_saturate, round_half_away>::type saturate;
+  for (storage raw : raw_inputs<storage>(1u << 12, rng)) {
+    check("unary -", raw, 0, -wrap::from_raw(raw), expected_add<wrap>(static_cast<storage>(0), raw, true));
+    check("unary -", raw, 0, -saturate::from_raw(raw), expected_add<saturate>(static_cast<storage>(0), raw, true));
+  }
+}
+
+/**
+ * from_double against std::round on pseudorandom doubles whose magnitude
+ * ranges from 2^-frac_bits / 4 to past the range of the format, and to_int
+ * and from_int against fixed_cast to and from the integer format.
+ */
+template <typename format> void test_conversions(std::mt19937_64 &rng) {
+  typedef typename format::storage_type storage;
+  typedef fixed<8u * sizeof(storage), 0u, storage> integer_format;
+  std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+  std::uniform_int_distribution<int> exponent(-2 - static_cast<int>(format::fraction_bits), static_cast<int>(format::integer_bits) + 2);
+  const double scale = std::ldexp(1.0, format::fraction_bits);
+  for (size_t j = 0u; j < (1u << 16); j++) {
+    const double value = std::ldexp(mantissa(rng), exponent(rng));
+    const double scaled = (j % 4u == 0u) ? std::trunc(value * scale) + (value < 0.0 ? -0.5 : 0.5) : value * scale;
+    const double rounded = std::round(scaled);
+    storage expected;
+    if (rounded >= std::ldexp(1.0, std::numeric_limits<storage>::digits)) expected = std::numeric_limits<storage>::max();
+    else if (rounded <= static_cast<double>(std::numeric_limits<storage>::lowest())) expected = std::numeric_limits<storage>::lowest();
+    else expected = static_cast<storage>(rounded);
+    const format converted = format::from_double(scaled / scale);
+    check("from_double", static_cast<int64_t>(j), 0, converted, expected);
+
+    test_count++;
+    if (converted.to_double() != static_cast<double>(converted.raw()) / scale) {
+      error_count++;
+      if (error_count <= max_printed_errors) std::printf("\nERROR: to_double of raw value %" PRIi64 "\n\n", static_cast<int64_t>(converted.raw()));
+    }
+
+    check("to_int", converted.raw(), 0, integer_format::from_raw(converted.to_int()), fixed_cast<integer_format>(converted).raw());
+    check("from_int", converted.raw(), 0, format::from_int(converted.raw()), fixed_cast<format>(integer_format::from_raw(converted.raw())).raw());
+  }
+}
+
+/* fixed * b and fixed / b return the format of the left operand, and *= and /= store into it. */
+void test_operators(void) {
+  const q9_7 temperature = q9_7::from_double(25.3);
+  const q1_15 gain = q1_15::from_double(0.7071);
+  q9_7 scaled = temperature;
+  scaled *= gain;
+  check("*", temperature.raw(), gain.raw(), temperature * gain, fixed_mul<q9_7>(temperature, gain).raw());
+  check("*=", temperature.raw(), gain.raw(), scaled, fixed_mul<q9_7>(temperature, gain).raw());
+  check("*", temperature.raw(), gain.raw(), temperature * gain, static_cast<int16_t>(multshiftround<int32_t, 15>(temperature.raw(), gain.raw())));
+  const q9_7 half = q9_7::from_double(-0.5);
+  q9_7 quotient = temperature;
+  quotient /= half;
+  check("/", temperature.raw(), half.raw(), temperature / half, fixed_div<q9_7>(temperature, half).raw());
+  check("/=", temperature.raw(), half.raw(), quotient, static_cast<int16_t>(-2 * temperature.raw()));
+  const q17_15_sat wide_temperature = fixed_cast<q17_15_sat>(temperature);
+  check("fixed_cast", temperature.raw(), 0, fixed_cast<q9_7>(wide_temperature), temperature.raw());
+}
+
+int main() {
+  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
+  std::mt19937_64 rng(0xF1BED901A7ull);
+
+  test_cast<fixed<1, 7, int8_t>, fixed<4, 4, int8_t> >(rng);
+  test_cast<fixed<4, 4, int8_t>, fixed<1, 7, int8_t> >(rng);
+  test_cast<fixed<4, 4, int8_t>, fixed<9, 7, int16_t> >(rng);
+  test_cast<fixed<0, 8, uint8_t>, fixed<8, 0, uint8_t> >(rng);
+  test_cast<fixed<4, 4, uint8_t>, fixed<12, 20, uint32_t> >(rng);
+  test_cast<fixed<9, 7, int16_t>, fixed<4, 4, int8_t> >(rng);
+  test_cast<fixed<1, 15, int16_t>, fixed<16, 0, int16_t> >(rng);
+  test_cast<fixed<0, 16, uint16_t>, fixed<16, 0, uint16_t> >(rng);
+  test_cast<fixed<9, 7, int16_t>, fixed<1, 63, int64_t> >(rng);
+  test_cast<fixed<17, 15, int32_t>, fixed<9, 7, int16_t> >(rng);
+  test_cast<fixed<1, 31, int32_t>, fixed<32, 0, int32_t> >(rng);
+  test_cast<fixed<32, 32, int64_t>, fixed<17, 15, int32_t> >(rng);
+  test_cast<fixed<32, 32, int64_t>, fixed<48, 16, int64_t> >(rng);
+  test_cast<fixed<48, 16, int64_t>, fixed<32, 32, int64_t> >(rng);
+  test_cast<fixed<32, 32, uint64_t>, fixed<8, 24, uint32_t> >(rng);
+
+  test_mul<fixed<1, 7, int8_t>, fixed<1, 7, int8_t>, fixed<1, 7, int8_t> >(rng);
+  test_mul<fixed<4, 4, int8_t>, fixed<1, 7, int8_t>, fixed<4, 4, int8_t> >(rng);
+  test_mul<fixed<4, 4, int8_t>, fixed<4, 4, int8_t>, fixed<8, 0, int8_t> >(rng);
+  test_mul<fixed<8, 0, int8_t>, fixed<8, 0, int8_t>, fixed<8, 0, int8_t> >(rng);
+  test_mul<fixed<1, 7, int8_t>, fixed<1, 7, int8_t>, fixed<2, 14, int16_t> >(rng);
+  test_mul<fixed<0, 8, uint8_t>, fixed<4, 4, uint8_t>, fixed<4, 4, uint8_t> >(rng);
+  test_mul<fixed<0, 8, uint8_t>, fixed<0, 8, uint8_t>, fixed<0, 16, uint16_t> >(rng);
+  test_mul<fixed<9, 7, int16_t>, fixed<1, 15, int16_t>, fixed<9, 7, int16_t> >(rng);
+  test_mul<fixed<9, 7, int16_t>, fixed<9, 7, int16_t>, fixed<9, 7, int16_t> >(rng);
+  test_mul<fixed<9, 7, int16_t>, fixed<1, 15, int16_t>, fixed<4, 4, int8_t> >(rng);
+  test_mul<fixed<0, 16, uint16_t>, fixed<8, 8, uint16_t>, fixed<8, 8, uint16_t> >(rng);
+  test_mul<fixed<17, 15, int32_t>, fixed<1, 31, int32_t>, fixed<17, 15, int32_t> >(rng);
+  test_mul<fixed<16, 16, uint32_t>, fixed<16, 16, uint32_t>, fixed<16, 16, uint32_t> >(rng);
+  test_mul<fixed<32, 32, int64_t>, fixed<32, 32, int64_t>, fixed<32, 32, int64_t> >(rng);
+  test_mul<fixed<32, 32, int64_t>, fixed<1, 63, int64_t>, fixed<17, 15, int32_t> >(rng);
+  test_mul<fixed<64, 0, int64_t>, fixed<64, 0, int64_t>, fixed<64, 0, int64_t> >(rng);
+  test_mul<fixed<32, 32, uint64_t>, fixed<0, 64, uint64_t>, fixed<32, 32, uint64_t> >(rng);
+
+  test_div<fixed<4, 4, int8_t>, fixed<4, 4, int8_t>, fixed<4, 4, int8_t> >(rng);
+  test_div<fixed<4, 4, int8_t>, fixed<1, 7, int8_t>, fixed<8, 0, int8_t> >(rng);
+  test_div<fixed<1, 7, int8_t>, fixed<8, 0, int8_t>, fixed<4, 4, int8_t> >(rng);
+  test_div<fixed<8, 0, int8_t>, fixed<8, 0, int8_t>, fixed<8, 0, int8_t> >(rng);
+  test_div<fixed<1, 7, int8_t>, fixed<1, 7, int8_t>, fixed<9, 7, int16_t> >(rng);
+  test_div<fixed<4, 4, uint8_t>, fixed<0, 8, uint8_t>, fixed<4, 4, uint8_t> >(rng);
+  test_div<fixed<9, 7, int16_t>, fixed<9, 7, int16_t>, fixed<9, 7, int16_t> >(rng);
+  test_div<fixed<9, 7, int16_t>, fixed<1, 15, int16_t>, fixed<9, 7, int16_t> >(rng);
+  test_div<fixed<8, 8, uint16_t>, fixed<8, 8, uint16_t>, fixed<0, 16, uint16_t> >(rng);
+  test_div<fixed<17, 15, int32_t>, fixed<17, 15, int32_t>, fixed<17, 15, int32_t> >(rng);
+  test_div<fixed<1, 31, int32_t>, fixed<32, 0, int32_t>, fixed<1, 31, int32_t> >(rng);
+  test_div<fixed<16, 16, uint32_t>, fixed<16, 16, uint32_t>, fixed<16, 16, uint32_t> >(rng);
+  test_div<fixed<32, 32, int64_t>, fixed<64, 0, int64_t>, fixed<32, 32, int64_t> >(rng);
+  test_div<fixed<32, 32, int64_t>, fixed<48, 16, int64_t>, fixed<48, 16, int64_t> >(rng);
+  test_div<fixed<32, 32, uint64_t>, fixed<64, 0, uint64_t>, fixed<32, 32, uint64_t> >(rng);
+
+  test_add<fixed<4, 4, int8_t> >(rng);
+  test_add<fixed<4, 4, uint8_t> >(rng);
+  test_add<fixed<9, 7, int16_t> >(rng);
+  test_add<fixed<8, 8, uint16_t> >(rng);
+  test_add<fixed<17, 15, int32_t> >(rng);
+  test_add<fixed<16, 16, uint32_t> >(rng);
+  test_add<fixed<32, 32, int64_t> >(rng);
+  test_add<fixed<32, 32, uint64_t> >(rng);
+
+  test_negate<fixed<4, 4, int8_t> >(rng);
+  test_negate<fixed<9, 7, int16_t> >(rng);
+  test_negate<fixed<17, 15, int32_t> >(rng);
+  test_negate<fixed<32, 32, int64_t> >(rng);
+
+  test_conversions<fixed<4, 4, int8_t> >(rng);
+  test_conversions<fixed<4, 4, uint8_t> >(rng);
+  test_conversions<fixed<9, 7, int16_t> >(rng);
+  test_conversions<fixed<8, 8, uint16_t> >(rng);
+  test_conversions<fixed<17, 15, int32_t> >(rng);
+  test_conversions<fixed<16, 16, uint32_t> >(rng);
+  test_conversions<fixed<32, 32, int64_t> >(rng);
+  test_conversions<fixed<40, 24, uint64_t> >(rng);
+
+  test_operators();
+
+  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
+  std::printf("%" PRIu64 " tests complete. %" PRIu64 " errors. Tests took %" PRIu64 " ms\n", test_count, error_count, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,406 @@
+/**
+ * test_horner_polynomial.cpp
+ * Tests the class template horner_polynomial<typename type> from
+ * horner_polynomial.hpp and the generator
+ *     horner_design<type> horner_quantize<typename type>(const std::vector<pow2_rational> &coefficients, const pow2_int &x_min, const pow2_int &x_max);
+ * from horner_polynomial_design.hpp for int8_t, int16_t, int32_t, and
+ * int64_t.
+ *
+ * Polynomials of degree 0 to 8 are drawn with random real coefficients of
+ * widely varying magnitude and random ranges of x, and quantized. For each
+ * x on the range (every x when there are at most 2048, otherwise 2048 of
+ * them including both ends), evaluate() must equal Horner's scheme carried
+ * out in exact integers with half away from zero rounding, no stage or
+ * product of that scheme may overflow type, evaluate_batch() must equal
+ * evaluate(), and the result must lie within worst_error of the exact
+ * real polynomial.
+ *
+ * Then the invalid degree and shift cases, the cases in which
+ * horner_quantize must fail, and a cubic calibration curve for a 12-bit
+ * ADC are checked.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <random>
+#include "horner_polynomial.hpp"
+#include "horner_polynomial_design.hpp"
+
+const unsigned random_trials = 100u;
+const uint64_t max_points = 2048u;
+
+uint64_t error_count = 0u;
+
+/* ROUND(value / 2^shift), rounding half away from zero. */
+pow2_int exact_shiftround(const pow2_int &value, const unsigned shift) {
+  if (shift == 0u) return value;
+  const pow2_int magnitude = abs(value);
+  const pow2_int rounded = (magnitude + (pow2_int(1) << (shift - 1u))) >> shift;
+  return (value < 0) ? pow2_int(-rounded) : rounded;
+}
+
+/**
+ * Evaluates design at x by Horner's scheme in exact integers. Sets
+ * overflow if a stage or product leaves the range of type.
+ */
+template <typename type> pow2_int exact_horner(const horner_design<type> &design, const pow2_int &x, bool &overflow) {
+  const pow2_int lowest(std::numeric_limits<type>::min());
+  const pow2_int highest(std::numeric_limits<type>::max());
+  pow2_int acc(static_cast<int64_t>(design.coefficients.back()));
+  for (size_t k = design.shifts.size(); k-- > 0u;) {
+    const pow2_int product = x * acc;
+    if (product < lowest || product > highest) overflow = true;
+    acc = exact_shiftround(product, design.shifts[k]) + static_cast<int64_t>(design.coefficients[k]);
+    if (acc < lowest || acc > highest) overflow = true;
+  }
+  return exact_shiftround(acc, design.output_shift);
+}
+
+/* The real polynomial at x. */
+pow2_rational exact_polynomial(const std::vector<pow2_rational> &coefficients, const pow2_int &x) {
+  pow2_rational value(0);
+  for (size_t k = coefficients.size(); k-- > 0u;) value = value * x + coefficients[k];
+  return value;
+}
+
+void print_design(const char *type_name, const std::vector<pow2_rational> &coefficients, const pow2_int &x_min, const pow2_int &x_max) {
+  std::printf("  %s degree %u on [%s, %s]\n", type_name, static_cast<unsigned>(coefficients.size() - 1u), x_min.str().c_str(), x_max.str().c_str());
+  for (size_t k = 0u; k < coefficients.size(); k++)
+    std::printf("    c[%u] = %s\n", static_cast<unsigned>(k), pow2_rational_decimal(coefficients[k], 17u).c_str());
+}
+
+/**
+ * Quantizes coefficients for type over [x_min, x_max] and checks the
+ * result at every x, or at max_points of them. Returns the largest error
+ * observed.
+ */
+template <typename type> pow2_rational check_design(const char *type_name, const std::vector<pow2_rational> &coefficients, const pow2_int &x_min, const pow2_int &x_max, std::mt19937_64 &rng) {
+  const horner_design<type> design = horner_quantize<type>(coefficients, x_min, x_max);
+  pow2_rational observed(0);
+  if (!design.found) return observed;
+
+  const horner_polynomial<type> polynomial = design.polynomial();
+  const pow2_int span = x_max - x_min;
+  std::vector<type> x;
+  if (span < max_points) {
+    for (pow2_int value = x_min; value <= x_max; value++) x.push_back(static_cast<type>(static_cast<int64_t>(value)));
+  }
+  else {
+    std::uniform_int_distribution<uint64_t> distribution;
+    x.push_back(static_cast<type>(static_cast<int64_t>(x_min)));
+    x.push_back(static_cast<type>(static_cast<int64_t>(x_max)));
+    while (x.size() < max_points) x.push_back(static_cast<type>(static_cast<int64_t>(x_min + pow2_int(distribution(rng)) % (span + 1))));
+  }
+
+  std::vector<type> batch(x.size());
+  polynomial.evaluate_batch(x.data(), batch.data(), x.size());
+  std::vector<type> in_place(x);
+  polynomial.evaluate_batch(in_place.data(), in_place.size());
+
+  for (size_t j = 0u; j < x.size(); j++) {
+    bool overflow = false;
+    const pow2_int expected = exact_horner(design, pow2_int(static_cast<int64_t>(x[j])), overflow);
+    const type result = polynomial.evaluate(x[j]);
+    const pow2_rational difference = pow2_rational(pow2_int(static_cast<int64_t>(result))) - exact_polynomial(coefficients, pow2_int(static_cast<int64_t>(x[j])));
+    const pow2_rational error = (difference < 0) ? pow2_rational(-difference) : difference;
+    if (error > observed) observed = error;
+
+    if (overflow || pow2_int(static_cast<int64_t>(result)) != expected || batch[j] != result || in_place[j] != result || error > design.worst_error) {
+      error_count++;
+      std::printf("\nERROR: horner_polynomial<%s> at x = %" PRIi64 ": evaluate %" PRIi64 ", exact Horner %s%s, batch %" PRIi64 ", in place %" PRIi64 ", error %s, bound %s.\n", type_name, static_cast<int64_t>(x[j]), static_cast<int64_t>(result), expected.str().c_str(), overflow ? " (overflows)" : "", static_cast<int64_t>(batch[j]), static_cast<int64_t>(in_place[j]), pow2_rational_decimal(error, 6u).c_str(), pow2_rational_decimal(design.worst_error, 6u).c_str());
+      print_design(type_name, coefficients, x_min, x_max);
+      return observed;
+    }
+  }
+  return observed;
+}
+
+/* Random polynomials with coefficients of widely varying magnitude. */
+template <typename type> void test_random(const char *type_name, std::mt19937_64 &rng) {
+  const int bits = std::numeric_limits<type>::digits;
+  std::uniform_int_distribution<unsigned> degree_distribution(0u, horner_polynomial<type>::max_degree);
+  std::uniform_int_distribution<int> range_bits_distribution(1, bits + 1);
+  std::uniform_int_distribution<int> exponent_distribution(-24, 0);
+  std::uniform_real_distribution<double> unit_distribution(-1.0, 1.0);
+  std::uniform_int_distribution<uint64_t> distribution;
+  unsigned found = 0u;
+  double worst_ratio = 0.0;
+
+  for (unsigned trial = 0u; trial < random_trials; trial++) {
+    const unsigned degree = degree_distribution(rng);
+    const int range_bits = range_bits_distribution(rng);
+    const int64_t range_limit = static_cast<int64_t>((uint64_t(1) << (range_bits - 1)) - 1u);
+    int64_t a = static_cast<int64_t>(distribution(rng) % (2u * static_cast<uint64_t>(range_limit) + 1u)) - range_limit;
+    int64_t b = static_cast<int64_t>(distribution(rng) % (2u * static_cast<uint64_t>(range_limit) + 1u)) - range_limit;
+    if (a > b) std::swap(a, b);
+    if (distribution(rng) % 4u == 0u) a = (a < 0) ? 0 : a;
+    const pow2_int x_min(a);
+    const pow2_int x_max((b < a) ? a : b);
+    const double max_x = std::max(1.0, std::max(std::fabs(static_cast<double>(a)), std::fabs(static_cast<double>(b))));
+
+    /* Each term stays below about 2^(bits - 3) / (degree + 1), scaled down by up to 2^-24. */
+    std::vector<pow2_rational> coefficients;
+    for (unsigned k = 0u; k <= degree; k++) {
+      const double scale = std::ldexp(1.0, bits - 3 + exponent_distribution(rng)) / (degree + 1u) / std::pow(max_x, static_cast<double>(k));
+      coefficients.push_back(pow2_rational(unit_distribution(rng) * scale));
+    }
+
+    const horner_design<type> design = horner_quantize<type>(coefficients, x_min, x_max);
+    if (!design.found) continue;
+    found++;
+    const pow2_rational observed = check_design<type>(type_name, coefficients, x_min, x_max, rng);
+    if (design.worst_error == 0) continue;
+    const double ratio = static_cast<double>(observed / design.worst_error);
+    if (ratio > worst_ratio) worst_ratio = ratio;
+  }
+
+  std::printf("%-8s %u of %u random polynomials quantized; largest observed error / bound = %.3f\n", type_name, found, random_trials, worst_ratio);
+  if (found < random_trials / 2u) {
+    error_count++;
+    std::printf("\nERROR: horner_quantize<%s> found too few of the random polynomials.\n\n", type_name);
+  }
+}
+
+void report(const char *description) {
+  error_count++;
+  std::printf("\nERROR: %s.\n\n", description);
+}
+
+void test_invalid(void) {
+  const int32_t coefficients[10] = {5, 3, 2, 1, 1, 1, 1, 1, 1, 1};
+  const uint8_t shifts[9] = {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u};
+  const uint8_t bad_shifts[2] = {4u, 31u};
+
+  const horner_polynomial<int32_t> zero;
+  if (zero(1234) != 0 || zero.degree() != 0u) report("default horner_polynomial<int32_t> is not the constant 0");
+
+  const horner_polynomial<int32_t> too_high(9u, coefficients, shifts, 0u);
+  if (too_high(3) != 0 || too_high.degree() != 0u) report("horner_polynomial<int32_t> of degree 9 is not the constant 0");
+
+  const horner_polynomial<int32_t> bad_shift(2u, coefficients, bad_shifts, 0u);
+  if (bad_shift(3) != 0) report("horner_polynomial<int32_t> with shift 31 is not the constant 0");
+
+  const horner_polynomial<int32_t> bad_output(2u, coefficients, shifts, 31u);
+  if (bad_output(3) != 0) report("horner_polynomial<int32_t> with output shift 31 is not the constant 0");
+
+  /* 5 + 3x + 2x^2 with no shifts, and ROUND((5 + 3x + 2x^2) / 4). */
+  const uint8_t no_shifts[2] = {0u, 0u};
+  const horner_polynomial<int32_t> plain(2u, coefficients, no_shifts, 0u);
+  const horner_polynomial<int32_t> quarter(2u, coefficients, no_shifts, 2u);
+  for (int32_t x = -100; x <= 100; x++) {
+    const int32_t value = 5 + 3 * x + 2 * x * x;
+    if (plain(x) != value) report("horner_polynomial<int32_t> 5 + 3x + 2x^2 is wrong");
+    if (quarter(x) != (value + 2) / 4) report("horner_polynomial<int32_t> ROUND((5 + 3x + 2x^2) / 4) is wrong");
+  }
+
+  /* Horner stages with shifts: ROUND(ROUND(x * 2 / 2^2) + 3) for the degree 1 polynomial 3 + x / 2. */
+  const int16_t linear[2] = {3, 2};
+  const uint8_t linear_shift[1] = {2u};
+  const horner_polynomial<int16_t> half_x(1u, linear, linear_shift, 0u);
+  if (half_x(5) != 6 || half_x(-5) != 0 || half_x(-7) != -1 || half_x(4) != 5) report("horner_polynomial<int16_t> 3 + ROUND(x / 2) is wrong");
+}
+
+void test_failures(void) {
+  const std::vector<pow2_rational> empty;
+  if (horner_quantize<int32_t>(empty, 0, 10).found) report("horner_quantize found coefficients for an empty polynomial");
+
+  const std::vector<pow2_rational> nine(10, pow2_rational(1, 1000000));
+  if (horner_quantize<int32_t>(nine, 0, 10).found) report("horner_quantize found coefficients for a degree 9 polynomial");
+
+  const std::vector<pow2_rational> linear = {pow2_rational(1), pow2_rational(1, 2)};
+  if (horner_quantize<int16_t>(linear, 0, 40000).found) report("horner_quantize<int16_t> accepted x_max = 40000");
+  if (horner_quantize<int16_t>(linear, -40000, 0).found) report("horner_quantize<int16_t> accepted x_min = -40000");
+  if (horner_quantize<int16_t>(linear, 10, 0).found) report("horner_quantize<int16_t> accepted x_max < x_min");
+  if (!horner_quantize<int16_t>(linear, 5, 5).found) report("horner_quantize<int16_t> rejected a range of one value");
+
+  /* 40000 does not fit int16_t, and 200x^2 overflows it at x = 20 even though 200x does not. */
+  const std::vector<pow2_rational> large_constant = {pow2_rational(40000)};
+  if (horner_quantize<int16_t>(large_constant, 0, 1).found) report("horner_quantize<int16_t> accepted the constant 40000");
+  const std::vector<pow2_rational> square = {pow2_rational(0), pow2_rational(0), pow2_rational(200)};
+  if (horner_quantize<int16_t>(square, 0, 20).found) report("horner_quantize<int16_t> accepted 200x^2 on [0, 20]");
+
+  /* Exactly representable polynomials are exact. */
+  const std::vector<pow2_rational> exact = {pow2_rational(-7), pow2_rational(3, 4), pow2_rational(1, 16)};
+  const horner_design<int32_t> exact_design = horner_quantize<int32_t>(exact, -1000, 1000);
+  if (!exact_design.found) report("horner_quantize<int32_t> did not find -7 + 3x/4 + x^2/16");
+  const horner_polynomial<int32_t> exact_polynomial_int = exact_design.polynomial();
+  const std::vector<pow2_rational> constant = {pow2_rational(3)};
+  const horner_design<int8_t> constant_design = horner_quantize<int8_t>(constant, 0, 10);
+  if (!constant_design.found || constant_design.worst_error != 0 || constant_design.polynomial()(7) != 3) report("horner_quantize<int8_t> did not find the constant 3 exactly");
+  for (int32_t x = -1000; x <= 1000; x += 4)
+    if (exact_polynomial_int(x) != -7 + 3 * x / 4 + x * x / 16) report("horner_polynomial<int32_t> -7 + 3x/4 + x^2/16 is not exact at multiples of 4");
+}
+
+/**
+ * A cubic that maps 12-bit ADC counts to hundredths of a degree Celsius,
+ * as a thermistor calibration might.
+ */
+void test_calibration(std::mt19937_64 &rng) {
+  const std::vector<pow2_rational> celsius = {pow2_rational(-4012.5), pow2_rational(4.71875), pow2_rational(-1.3701e-3), pow2_rational(2.2105e-7)};
+  const horner_design<int32_t> design = horner_quantize<int32_t>(celsius, 0, 4095);
+  if (!design.found) {
+    report("horner_quantize<int32_t> did not find the calibration cubic");
+    return;
+  }
+  std::printf("\ncalibration cubic on [0, 4095] in int32_t:\n");
+  for (size_t k = 0u; k < design.coefficients.size(); k++) {
+    std::printf("  coefficient %u = %11" PRIi32 ", fraction bits %2d", static_cast<unsigned>(k), design.coefficients[k], design.fraction_bits[k]);
+    if (k < design.shifts.size()) std::printf(", shift %2u", design.shifts[k]);
+    std::printf("\n");
+  }
+  const pow2_rational observed = check_design<int32_t>("int32_t", celsius, 0, 4095, rng);
+  std::printf("  output shift %u, error bound %s, largest observed error %s\n", design.output_shift, pow2_rational_decimal(design.worst_error, 6u).c_str(), pow2_rational_decimal(observed, 6u).c_str());
+  if (design.worst_error >= 1) report("horner_quantize<int32_t> bound for the calibration cubic is 1 or more");
+}
+
+int main() {
+  std::mt19937_64 rng(0x4D0E7ull);
+
+  test_random<int8_t>("int8_t", rng);
+  test_random<int16_t>("int16_t", rng);
+  test_random<int32_t>("int32_t", rng);
+  test_random<int64_t>("int64_t", rng);
+  test_invalid();
+  test_failures();
+  test_calibration(rng);
+
+  std::printf("\nTests complete. %" PRIu64 " errors.\n", error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,443 @@
+/**
+ * test_intmath_diagnostics.cpp
+ * Tests the DIAGNOSE_INTMATH event recorder in intmath_diagnostics.c:
+ *   void intmath_thread_counters(intmath_counters *counters);
+ *   void intmath_reset_thread_counters(void);
+ *   void intmath_process_counters(intmath_counters *counters);
+ *   void intmath_reset_process_counters(void);
+ *   size_t intmath_ring_snapshot(intmath_event_record *records, const size_t max_records);
+ *   void intmath_reset_ring(void);
+ * together with the checks compiled into the C kernels and the C++
+ * templates when DIAGNOSE_INTMATH is defined.
+ *
+ * The tests check that
+ * - each kind of invalid argument is counted under the right event and
+ *   recorded in the ring buffer with the right function name and
+ *   arguments, while the kernel still returns its usual result,
+ * - valid arguments record nothing,
+ * - per-thread counters only see the calling thread's events while the
+ *   process counters see all of them,
+ * - the ring buffer holds the newest INTMATH_RING_LENGTH events and never
+ *   returns a torn entry while several threads record concurrently, and
+ * - the reset functions clear what they should and nothing else.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <thread>
+#include "multshiftround_run.hpp"
+#include "multshiftround_comp.hpp"
+#include "divround.hpp"
+#include "divround_comp.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "intmath_diagnostics.h"
+    #include "multshiftround_run.h"
+    #include "shiftround_run.h"
+    #include "divround.h"
+    #include "divround_prepared.h"
+    #include "multshiftround_wide.h"
+#ifdef __cplusplus
+  }
+#endif
+
+#ifndef DIAGNOSE_INTMATH
+  #error "test_intmath_diagnostics.cpp must be compiled with DIAGNOSE_INTMATH defined."
+#endif
+
+const size_t stress_threads = 4u;
+const uint64_t stress_events_per_thread = 20000u;
+
+uint64_t error_count = 0u;
+uint64_t test_count = 0u;
+
+void check(const bool passed, const char *description) {
+  test_count++;
+  if (!passed) {
+    error_count++;
+    std::printf("ERROR: %s\n", description);
+  }
+}
+
+/**
+ * Checks that the process counters and this thread's counters both equal expected.
+ */
+void check_counters(const uint64_t expected[INTMATH_EVENT_KINDS], const char *description) {
+  intmath_counters thread_counters;
+  intmath_counters process_counters;
+  intmath_thread_counters(&thread_counters);
+  intmath_process_counters(&process_counters);
+  for (size_t j = 0u; j < static_cast<size_t>(INTMATH_EVENT_KINDS); j++) {
+    test_count++;
+    if (thread_counters.events[j] != expected[j] || process_counters.events[j] != expected[j]) {
+      error_count++;
+      std::printf("ERROR: %s: %s count is %" PRIu64 " (thread) and %" PRIu64 " (process), expected %" PRIu64 ".\n",
+             description, intmath_event_name(static_cast<intmath_event>(j)), thread_counters.events[j], process_counters.events[j], expected[j]);
+    }
+  }
+}
+
+void reset_all(void) {
+  intmath_reset_thread_counters();
+  intmath_reset_process_counters();
+  intmath_reset_ring();
+}
+
+struct expected_record {
+  intmath_event event;
+  const char *function;
+  uint64_t args[3];
+};
+
+/**
+ * Checks that the ring buffer holds exactly the records in expected, in order.
+ */
+void check_ring(const std::vector<expected_record> &expected, const char *description) {
+  std::vector<intmath_event_record> records(INTMATH_RING_LENGTH + 1u);
+  const size_t count = intmath_ring_snapshot(records.data(), records.size());
+  test_count++;
+  if (count != expected.size()) {
+    error_count++;
+    std::printf("ERROR: %s: ring buffer holds %zu records, expected %zu.\n", description, count, expected.size());
+    return;
+  }
+
+  for (size_t j = 0u; j < count; j++) {
+    test_count++;
+    const intmath_event_record &record = records[j];
+    if (record.event != expected[j].event || std::strcmp(record.function, expected[j].function) != 0 ||
+        record.args[0] != expected[j].args[0] || record.args[1] != expected[j].args[1] || record.args[2] != expected[j].args[2] ||
+        (j > 0u && record.sequence != records[j - 1u].sequence + 1u)) {
+      error_count++;
+      std::printf("ERROR: %s: record %zu is %s in %s(%" PRIu64 ", %" PRIu64 ", %" PRIu64 "), expected %s in %s(%" PRIu64 ", %" PRIu64 ", %" PRIu64 ").\n",
+             description, j, intmath_event_name(record.event), record.function, record.args[0], record.args[1], record.args[2],
+             intmath_event_name(expected[j].event), expected[j].function, expected[j].args[0], expected[j].args[1], expected[j].args[2]);
+    }
+  }
+}
+
+uint64_t as_u64(const int64_t value) {
+  return static_cast<uint64_t>(value);
+}
+
+/**
+ * One call per event kind through the C kernels.
+ */
+void test_c_kernels(void) {
+  reset_all();
+  uint64_t expected[INTMATH_EVENT_KINDS] = {0u};
+  std::vector<expected_record> ring;
+
+  check(multshiftround_i16(3, 5, 2) == 4, "multshiftround_i16(3, 5, 2) with valid arguments");
+  check(divround_i32(7, 2) == 4, "divround_i32(7, 2) with valid arguments");
+  check_counters(expected, "valid arguments");
+  check_ring(ring, "valid arguments");
+
+  check(shiftround_i32(-100, 31u) == 0, "shiftround_i32(-100, 31) must return 0");
+  expected[INTMATH_EVENT_INVALID_SHIFT]++;
+  ring.push_back({INTMATH_EVENT_INVALID_SHIFT, "shiftround_i32", {as_u64(-100), 31u, 0u}});
+
+  check(multshiftround_u8(30u, 9u, 8u) == 0u, "multshiftround_u8(30, 9, 8) must return 0");
+  expected[INTMATH_EVENT_INVALID_SHIFT]++;
+  expected[INTMATH_EVENT_PRODUCT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_INVALID_SHIFT, "multshiftround_u8", {30u, 9u, 8u}});
+  ring.push_back({INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_u8", {30u, 9u, 8u}});
+
+  (void)multshiftround_i64(-(INT64_C(1) << 40), INT64_C(1) << 30, 3u);
+  expected[INTMATH_EVENT_PRODUCT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround_i64", {as_u64(-(INT64_C(1) << 40)), UINT64_C(1) << 30, 3u}});
+
+  (void)divround_u16(12u, 0u);
+  expected[INTMATH_EVENT_ZERO_DIVISOR]++;
+  ring.push_back({INTMATH_EVENT_ZERO_DIVISOR, "divround_u16", {12u, 0u, 0u}});
+
+  (void)divround_i8(INT8_MIN, -1);
+  expected[INTMATH_EVENT_QUOTIENT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_i8", {as_u64(INT8_MIN), as_u64(-1), 0u}});
+
+  const divround_divisor_i32 minus_one = divround_prepare_i32(-1);
+  (void)divround_prepared_i32(INT32_MIN, &minus_one);
+  expected[INTMATH_EVENT_QUOTIENT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround_prepared_i32", {as_u64(INT32_MIN), as_u64(-1), 0u}});
+
+  (void)multshiftround_wide_u64(UINT64_MAX, UINT64_MAX, 1u);
+  expected[INTMATH_EVENT_RESULT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_RESULT_OVERFLOW, "multshiftround_wide_u64", {UINT64_MAX, UINT64_MAX, 1u}});
+
+  check_counters(expected, "C kernels");
+  check_ring(ring, "C kernels");
+}
+
+/**
+ * The C++ templates record through the same counters.
+ */
+void test_cpp_templates(void) {
+  reset_all();
+  uint64_t expected[INTMATH_EVENT_KINDS] = {0u};
+  std::vector<expected_record> ring;
+
+  check(multshiftround<int32_t>(5, 7, 40u) == 0, "multshiftround<int32_t>(5, 7, 40) must return 0");
+  expected[INTMATH_EVENT_INVALID_SHIFT]++;
+  ring.push_back({INTMATH_EVENT_INVALID_SHIFT, "multshiftround<int32_t>", {5u, 7u, 40u}});
+
+  (void)multshiftround<int16_t, 3>(-300, 300);
+  expected[INTMATH_EVENT_PRODUCT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_PRODUCT_OVERFLOW, "multshiftround<int16_t, 3>", {as_u64(-300), 300u, 0u}});
+
+  (void)divround<uint64_t>(1u, 0u);
+  expected[INTMATH_EVENT_ZERO_DIVISOR]++;
+  ring.push_back({INTMATH_EVENT_ZERO_DIVISOR, "divround<uint64_t>", {1u, 0u, 0u}});
+
+  (void)divround<int16_t, -1>(std::numeric_limits<int16_t>::min());
+  expected[INTMATH_EVENT_QUOTIENT_OVERFLOW]++;
+  ring.push_back({INTMATH_EVENT_QUOTIENT_OVERFLOW, "divround<type, -1>", {as_u64(std::numeric_limits<int16_t>::min()), 0u, 0u}});
+
+  check_counters(expected, "C++ templates");
+  check_ring(ring, "C++ templates");
+}
+
+/**
+ * Events recorded on another thread reach the process counters only.
+ */
+void test_thread_isolation(void) {
+  reset_all();
+  (void)shiftround_u8(1u, 9u);
+
+  uint64_t worker_invalid_shifts = 0u;
+  std::thread worker([&worker_invalid_shifts]() {
+    intmath_counters counters;
+    intmath_thread_counters(&counters);
+    check(counters.events[INTMATH_EVENT_INVALID_SHIFT] == 0u, "a new thread must start with zero counters");
+    for (uint8_t j = 0u; j < 10u; j++) (void)shiftround_u8(1u, static_cast<uint8_t>(8u + j));
+    intmath_thread_counters(&counters);
+    worker_invalid_shifts = counters.events[INTMATH_EVENT_INVALID_SHIFT];
+  });
+  worker.join();
+
+  intmath_counters thread_counters;
+  intmath_counters process_counters;
+  intmath_thread_counters(&thread_counters);
+  intmath_process_counters(&process_counters);
+  check(worker_invalid_shifts == 10u, "worker thread counters must count only the worker's events");
+  check(thread_counters.events[INTMATH_EVENT_INVALID_SHIFT] == 1u, "main thread counters must not see the worker's events");
+  check(process_counters.events[INTMATH_EVENT_INVALID_SHIFT] == 11u, "process counters must count every thread's events");
+
+  intmath_reset_thread_counters();
+  intmath_thread_counters(&thread_counters);
+  intmath_process_counters(&process_counters);
+  check(thread_counters.events[INTMATH_EVENT_INVALID_SHIFT] == 0u, "intmath_reset_thread_counters must clear this thread's counters");
+  check(process_counters.events[INTMATH_EVENT_INVALID_SHIFT] == 11u, "intmath_reset_thread_counters must not clear the process counters");
+
+  intmath_reset_process_counters();
+  intmath_process_counters(&process_counters);
+  check(process_counters.events[INTMATH_EVENT_INVALID_SHIFT] == 0u, "intmath_reset_process_counters must clear the process counters");
+}
+
+/**
+ * Several threads record invalid shifts concurrently while the main thread
+ * takes snapshots. Every record must be internally consistent: thread t
+ * calls shiftround_i64(t * 2^32 + j, 63 + t), so args[1] identifies the
+ * thread that wrote args[0].
+ */
+void check_stress_records(const intmath_event_record *records, const size_t count, const char *description) {
+  for (size_t j = 0u; j < count; j++) {
+    const intmath_event_record &record = records[j];
+    const uint64_t thread = record.args[0] >> 32;
+    const bool consistent = record.event == INTMATH_EVENT_INVALID_SHIFT && std::strcmp(record.function, "shiftround_i64") == 0 &&
+                            thread < stress_threads && record.args[1] == 63u + thread &&
+                            (record.args[0] & 0xFFFFFFFFu) < stress_events_per_thread && record.args[2] == 0u &&
+                            (j == 0u || record.sequence > records[j - 1u].sequence);
+    test_count++;
+    if (!consistent) {
+      error_count++;
+      std::printf("ERROR: %s: inconsistent record %zu, sequence %" PRIu64 ", %s(%" PRIu64 ", %" PRIu64 ", %" PRIu64 ").\n",
+             description, j, record.sequence, record.function, record.args[0], record.args[1], record.args[2]);
+    }
+  }
+}
+
+void test_ring_stress(void) {
+  reset_all();
+  std::vector<std::thread> workers;
+  for (size_t t = 0u; t < stress_threads; t++) {
+    workers.emplace_back([t]() {
+      for (uint64_t j = 0u; j < stress_events_per_thread; j++) {
+        (void)shiftround_i64(static_cast<int64_t>((static_cast<uint64_t>(t) << 32) + j), static_cast<uint8_t>(63u + t));
+      }
+    });
+  }
+
+  std::vector<intmath_event_record> records(INTMATH_RING_LENGTH);
+  for (size_t snapshot = 0u; snapshot < 200u; snapshot++) {
+    const size_t count = intmath_ring_snapshot(records.data(), records.size());
+    check_stress_records(records.data(), count, "concurrent snapshot");
+  }
+  for (std::thread &worker : workers) worker.join();
+
+  const uint64_t total = stress_threads * stress_events_per_thread;
+  intmath_counters counters;
+  intmath_process_counters(&counters);
+  check(counters.events[INTMATH_EVENT_INVALID_SHIFT] == total, "process counters must not lose concurrent events");
+
+  const size_t count = intmath_ring_snapshot(records.data(), records.size());
+  check(count == INTMATH_RING_LENGTH, "a full ring buffer must return INTMATH_RING_LENGTH records");
+  check_stress_records(records.data(), count, "final snapshot");
+  check(count > 0u && records[count - 1u].sequence - records[0].sequence == count - 1u, "a quiescent ring buffer must return consecutive sequence numbers");
+
+  const size_t few = intmath_ring_snapshot(records.data(), 3u);
+  check(few == 3u && records[2].sequence == records[0].sequence + 2u, "a limited snapshot must return the newest records");
+
+  intmath_reset_ring();
+  check(intmath_ring_snapshot(records.data(), records.size()) == 0u, "intmath_reset_ring must hide earlier records");
+  (void)shiftround_i64(0, 63u);
+  check(intmath_ring_snapshot(records.data(), records.size()) == 1u, "records after intmath_reset_ring must be returned");
+}
+
+int main(void) {
+  test_c_kernels();
+  test_cpp_templates();
+  test_thread_isolation();
+  test_ring_stress();
+
+  std::printf("\n%" PRIu64 " tests complete. %" PRIu64 " errors.\n", test_count, error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
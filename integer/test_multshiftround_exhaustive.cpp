@@ -0,0 +1,433 @@
+/**
+ * test_multshiftround_exhaustive.cpp
+ * Tests the following functions for every combination of num, mul, and
+ * valid shift:
+ * multshiftround_i8, multshiftround<int8_t>, multshiftround_i8_{1..6},
+ * multshiftround<int8_t, {1..6}>,
+ * multshiftround_u8, multshiftround<uint8_t>, multshiftround_u8_{1..7},
+ * multshiftround<uint8_t, {1..7}>,
+ * multshiftround_i16, multshiftround<int16_t>, multshiftround_i16_{1..14},
+ * multshiftround<int16_t, {1..14}>,
+ * multshiftround_u16, multshiftround<uint16_t>, multshiftround_u16_{1..15},
+ * and multshiftround<uint16_t, {1..15}>.
+ * That is 2^16 (num, mul) pairs per shift for the 8-bit types and 2^32
+ * (num, mul) pairs per shift for the 16-bit types.
+ *
+ * The run tests in test_multshiftround_shiftround_run.cpp hold mul fixed,
+ * and the comp tests in test_multshiftround_shiftround_comp.cpp sample
+ * mul, so this is the only test that covers every (num, mul, shift)
+ * combination of the 8-bit and 16-bit routines together.
+ *
+ * For a given shift and mul, the expected results for every num are
+ * computed by branch free loops over contiguous arrays in the next wider
+ * integer type, which the compiler vectorizes. Each routine under test
+ * then fills a result array for every num, and a second vectorized loop
+ * compares it to the expected array. Only a failing comparison falls
+ * back to a scalar loop to print the ERROR lines. The work is split into
+ * one pool job per type and shift, with chunks of mul values, on the
+ * work-stealing pool in test_pool.hpp.
+ *
+ * Only a small fraction of the (num, mul) pairs have a product that fits
+ * in the type. The rest are outside the contract of multshiftround
+ * (DEBUG_INTMATH reports them as errors), but every routine still forms
+ * the product modulo 2^N and rounds that, so they are checked against the
+ * rounded wrapped product. This keeps the run, comp, C, and C++ routines
+ * in agreement everywhere. For uint16_t, the product of two values above
+ * 46340 overflows int after integer promotion, so that part of the check
+ * relies on the compiler wrapping signed multiplication, as gcc and MSVC
+ * do on x86. The test must be linked against the non-debug objects and
+ * built without DEBUG_INTMATH.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "run_masks_type.h"
+#include "multshiftround_run.hpp"
+#include "multshiftround_comp.hpp"
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "multshiftround_run.h"
+    #include "multshiftround_comp.h"
+#ifdef __cplusplus
+  }
+#endif
+#include "test_pool.hpp"
+
+#ifdef DEBUG_INTMATH
+  #error "test_multshiftround_exhaustive.cpp deliberately passes overflowing products; build it without DEBUG_INTMATH."
+#endif
+
+std::mutex print_mutex;
+std::atomic<uint64_t> nInRange(0ull);
+std::atomic<uint64_t> nWrapped(0ull);
+
+/* The number of distinct values of type: 2^8 or 2^16 here. */
+template <typename type> constexpr size_t num_count(void) {
+  return static_cast<size_t>(1) << (std::numeric_limits<type>::digits + (std::numeric_limits<type>::is_signed ? 1 : 0));
+}
+
+/* Item i of a sweep over every value of type, starting from the lowest. */
+template <typename type> type value_at(const uint64_t i) {
+  return static_cast<type>(static_cast<uint64_t>(std::numeric_limits<type>::lowest()) + i);
+}
+
+/**
+ * Fills result[] with multshiftround<type, shift>(nums[i], mul) for every
+ * num of type. The compile time shift is the reason this is a template
+ * rather than a loop over a function pointer.
+ */
+template <typename type, uint8_t shift> void fill_comp_cpp(const type mul, const type *nums, type *result) {
+  for (size_t i = 0; i < num_count<type>(); i++) result[i] = multshiftround<type, shift>(nums[i], mul);
+}
+
+/**
+ * Fills expected[] with ROUND((nums[i] * mul) / 2^shift), rounding halves
+ * away from zero as multshiftround does. Where nums[i] * mul overflows
+ * type, the product is first wrapped to type, since that is the product
+ * the routines round. Every product of two 8-bit or 16-bit signed values
+ * fits in int32_t, and the loop has no branches, so it vectorizes.
+ * Returns the number of products that fit in type.
+ */
+template <typename type> uint32_t compute_expected(const type *nums, const type mul, const uint8_t shift, type *expected, std::true_type /* is_signed */) {
+  const int32_t wide_mul = static_cast<int32_t>(mul);
+  const int32_t half = (shift == 0u) ? 0 : (static_cast<int32_t>(1) << (shift - 1u));
+  uint32_t nInRange = 0u;
+  for (size_t i = 0; i < num_count<type>(); i++) {
+    const int32_t exact = static_cast<int32_t>(nums[i]) * wide_mul;
+    const int32_t prod = static_cast<int32_t>(static_cast<type>(exact));
+    const int32_t negative = prod >> 31;
+    const int32_t magnitude = (prod ^ negative) - negative;
+    const int32_t rounded = (magnitude + half) >> shift;
+    expected[i] = static_cast<type>((rounded ^ negative) - negative);
+    nInRange += static_cast<uint32_t>(prod == exact);
+  }
+  return nInRange;
+}
+
+/**
+ * The unsigned version of compute_expected. Every product of two 8-bit or
+ * 16-bit unsigned values fits in uint32_t, and the wrapped product plus
+ * half cannot overflow it.
+ */
+template <typename type> uint32_t compute_expected(const type *nums, const type mul, const uint8_t shift, type *expected, std::false_type /* is_signed */) {
+  const uint32_t wide_mul = static_cast<uint32_t>(mul);
+  const uint32_t half = (shift == 0u) ? 0u : (static_cast<uint32_t>(1) << (shift - 1u));
+  uint32_t nInRange = 0u;
+  for (size_t i = 0; i < num_count<type>(); i++) {
+    const uint32_t exact = static_cast<uint32_t>(nums[i]) * wide_mul;
+    const uint32_t prod = static_cast<uint32_t>(static_cast<type>(exact));
+    expected[i] = static_cast<type>((prod + half) >> shift);
+    nInRange += static_cast<uint32_t>(prod == exact);
+  }
+  return nInRange;
+}
+
+/**
+ * Returns true if result[] matches expected[] everywhere. Written as an
+ * OR reduction with no early exit so it vectorizes.
+ */
+template <typename type> bool results_match(const type *result, const type *expected) {
+  typedef typename std::make_unsigned<type>::type utype;
+  utype difference = 0u;
+  for (size_t i = 0; i < num_count<type>(); i++)
+    difference |= static_cast<utype>(result[i] ^ expected[i]);
+  return difference == 0u;
+}
+
+/* Prints an ERROR line for every mismatch. Only called on failure. */
+template <typename type> void report_mismatches(const char *routine, const type *nums, const type mul, const uint8_t shift, const type *result, const type *expected) {
+  std::lock_guard<std::mutex> print_lock(print_mutex);
+  for (size_t i = 0; i < num_count<type>(); i++) {
+    if (result[i] == expected[i]) continue;
+    const long exact = static_cast<long>(nums[i]) * static_cast<long>(mul);
+    const long prod = static_cast<long>(static_cast<type>(exact));
+    if (prod == exact)
+      std::printf("\nERROR: ROUND((%li * %li) / 2^%u) = %li, but %s returns %li\n\n", static_cast<long>(nums[i]), static_cast<long>(mul), shift, static_cast<long>(expected[i]), routine, static_cast<long>(result[i]));
+    else
+      std::printf("\nERROR: %li * %li wraps to %li, and ROUND(%li / 2^%u) = %li, but %s returns %li\n\n", static_cast<long>(nums[i]), static_cast<long>(mul), prod, prod, shift, static_cast<long>(expected[i]), routine, static_cast<long>(result[i]));
+  }
+}
+
+/**
+ * The routines under test for one type. comp_c[shift] and comp_cpp[shift]
+ * are the compile time shift routines for shift 1 through max_shift;
+ * index 0 is unused since the comp routines do not accept shift = 0.
+ */
+template <typename type> struct exhaustive_case {
+  const char *c_suffix;
+  const char *cpp_type;
+  uint8_t max_shift;
+  type (*run_c)(const type, const type, const uint8_t);
+  type (*const *comp_c)(const type, const type);
+  void (*const *comp_cpp)(const type, const type *, type *);
+};
+
+static int8_t (*const comp_c_i8[])(const int8_t, const int8_t) = {
+  nullptr, multshiftround_i8_1, multshiftround_i8_2, multshiftround_i8_3,
+  multshiftround_i8_4, multshiftround_i8_5, multshiftround_i8_6
+};
+static void (*const comp_cpp_i8[])(const int8_t, const int8_t *, int8_t *) = {
+  nullptr, fill_comp_cpp<int8_t, 1>, fill_comp_cpp<int8_t, 2>, fill_comp_cpp<int8_t, 3>,
+  fill_comp_cpp<int8_t, 4>, fill_comp_cpp<int8_t, 5>, fill_comp_cpp<int8_t, 6>
+};
+
+static uint8_t (*const comp_c_u8[])(const uint8_t, const uint8_t) = {
+  nullptr, multshiftround_u8_1, multshiftround_u8_2, multshiftround_u8_3,
+  multshiftround_u8_4, multshiftround_u8_5, multshiftround_u8_6, multshiftround_u8_7
+};
+static void (*const comp_cpp_u8[])(const uint8_t, const uint8_t *, uint8_t *) = {
+  nullptr, fill_comp_cpp<uint8_t, 1>, fill_comp_cpp<uint8_t, 2>, fill_comp_cpp<uint8_t, 3>,
+  fill_comp_cpp<uint8_t, 4>, fill_comp_cpp<uint8_t, 5>, fill_comp_cpp<uint8_t, 6>, fill_comp_cpp<uint8_t, 7>
+};
+
+static int16_t (*const comp_c_i16[])(const int16_t, const int16_t) = {
+  nullptr, multshiftround_i16_1, multshiftround_i16_2, multshiftround_i16_3,
+  multshiftround_i16_4, multshiftround_i16_5, multshiftround_i16_6, multshiftround_i16_7,
+  multshiftround_i16_8, multshiftround_i16_9, multshiftround_i16_10, multshiftround_i16_11,
+  multshiftround_i16_12, multshiftround_i16_13, multshiftround_i16_14
+};
+static void (*const comp_cpp_i16[])(const int16_t, const int16_t *, int16_t *) = {
+  nullptr, fill_comp_cpp<int16_t, 1>, fill_comp_cpp<int16_t, 2>, fill_comp_cpp<int16_t, 3>,
+  fill_comp_cpp<int16_t, 4>, fill_comp_cpp<int16_t, 5>, fill_comp_cpp<int16_t, 6>, fill_comp_cpp<int16_t, 7>,
+  fill_comp_cpp<int16_t, 8>, fill_comp_cpp<int16_t, 9>, fill_comp_cpp<int16_t, 10>, fill_comp_cpp<int16_t, 11>,
+  fill_comp_cpp<int16_t, 12>, fill_comp_cpp<int16_t, 13>, fill_comp_cpp<int16_t, 14>
+};
+
+static uint16_t (*const comp_c_u16[])(const uint16_t, const uint16_t) = {
+  nullptr, multshiftround_u16_1, multshiftround_u16_2, multshiftround_u16_3,
+  multshiftround_u16_4, multshiftround_u16_5, multshiftround_u16_6, multshiftround_u16_7,
+  multshiftround_u16_8, multshiftround_u16_9, multshiftround_u16_10, multshiftround_u16_11,
+  multshiftround_u16_12, multshiftround_u16_13, multshiftround_u16_14, multshiftround_u16_15
+};
+static void (*const comp_cpp_u16[])(const uint16_t, const uint16_t *, uint16_t *) = {
+  nullptr, fill_comp_cpp<uint16_t, 1>, fill_comp_cpp<uint16_t, 2>, fill_comp_cpp<uint16_t, 3>,
+  fill_comp_cpp<uint16_t, 4>, fill_comp_cpp<uint16_t, 5>, fill_comp_cpp<uint16_t, 6>, fill_comp_cpp<uint16_t, 7>,
+  fill_comp_cpp<uint16_t, 8>, fill_comp_cpp<uint16_t, 9>, fill_comp_cpp<uint16_t, 10>, fill_comp_cpp<uint16_t, 11>,
+  fill_comp_cpp<uint16_t, 12>, fill_comp_cpp<uint16_t, 13>, fill_comp_cpp<uint16_t, 14>, fill_comp_cpp<uint16_t, 15>
+};
+static const exhaustive_case<int8_t> case_i8 = { "i8", "int8_t", 6u, multshiftround_i8, comp_c_i8, comp_cpp_i8 };
+static const exhaustive_case<uint8_t> case_u8 = { "u8", "uint8_t", 7u, multshiftround_u8, comp_c_u8, comp_cpp_u8 };
+static const exhaustive_case<int16_t> case_i16 = { "i16", "int16_t", 14u, multshiftround_i16, comp_c_i16, comp_cpp_i16 };
+static const exhaustive_case<uint16_t> case_u16 = { "u16", "uint16_t", 15u, multshiftround_u16, comp_c_u16, comp_cpp_u16 };
+
+/**
+ * Tests every num of type against the mul values with indices
+ * [first, last) of a sweep from the lowest value of type, for one shift,
+ * on all four routines (run and comp, C and C++). The comp routines are
+ * skipped for shift = 0.
+ */
+template <typename type> void test_muls(const exhaustive_case<type> &tc, const uint8_t shift, const uint64_t first, const uint64_t last) {
+  std::vector<type> nums(num_count<type>());
+  std::vector<type> expected(num_count<type>());
+  std::vector<type> result(num_count<type>());
+  for (size_t i = 0; i < num_count<type>(); i++) nums[i] = value_at<type>(i);
+
+  char routine[64];
+  uint64_t in_range = 0ull;
+  for (uint64_t iMul = first; iMul < last; iMul++) {
+    const type mul = value_at<type>(iMul);
+    in_range += compute_expected<type>(nums.data(), mul, shift, expected.data(), std::is_signed<type>());
+
+    for (size_t i = 0; i < num_count<type>(); i++) result[i] = tc.run_c(nums[i], mul, shift);
+    if (!results_match<type>(result.data(), expected.data())) {
+      std::snprintf(routine, sizeof(routine), "multshiftround_%s", tc.c_suffix);
+      report_mismatches<type>(routine, nums.data(), mul, shift, result.data(), expected.data());
+    }
+
+    for (size_t i = 0; i < num_count<type>(); i++) result[i] = multshiftround<type>(nums[i], mul, shift);
+    if (!results_match<type>(result.data(), expected.data())) {
+      std::snprintf(routine, sizeof(routine), "multshiftround<%s>", tc.cpp_type);
+      report_mismatches<type>(routine, nums.data(), mul, shift, result.data(), expected.data());
+    }
+
+    if (shift == 0u) continue;
+
+    type (*const comp_c)(const type, const type) = tc.comp_c[shift];
+    for (size_t i = 0; i < num_count<type>(); i++) result[i] = comp_c(nums[i], mul);
+    if (!results_match<type>(result.data(), expected.data())) {
+      std::snprintf(routine, sizeof(routine), "multshiftround_%s_%u", tc.c_suffix, shift);
+      report_mismatches<type>(routine, nums.data(), mul, shift, result.data(), expected.data());
+    }
+
+    tc.comp_cpp[shift](mul, nums.data(), result.data());
+    if (!results_match<type>(result.data(), expected.data())) {
+      std::snprintf(routine, sizeof(routine), "multshiftround<%s, %u>", tc.cpp_type, shift);
+      report_mismatches<type>(routine, nums.data(), mul, shift, result.data(), expected.data());
+    }
+  }
+
+  nInRange += in_range;
+  nWrapped += (last - first) * static_cast<uint64_t>(num_count<type>()) - in_range;
+}
+
+/**
+ * Queues one job per valid shift of type. Each job sweeps every mul
+ * value, mul_chunk values per chunk.
+ */
+template <typename type> void add_case_jobs(test_pool &pool, const exhaustive_case<type> &tc, const uint64_t mul_chunk) {
+  for (uint8_t shift = 0u; shift <= tc.max_shift; shift++) {
+    char name[96];
+    std::snprintf(name, sizeof(name), "multshiftround_%s and multshiftround<%s> shift %u", tc.c_suffix, tc.cpp_type, shift);
+    const exhaustive_case<type> *ptc = &tc;
+    pool.add_job(name, static_cast<uint64_t>(num_count<type>()), mul_chunk, [ptc, shift](uint64_t first, uint64_t last) {
+      test_muls<type>(*ptc, shift, first, last);
+    });
+  }
+}
+
+int main() {
+  test_pool pool(print_mutex);
+  std::printf("\nTesting every (num, mul, shift) combination of the 8-bit and 16-bit\nmultshiftround routines with %u threads.\n\n", pool.threads());
+
+  add_case_jobs<int8_t>(pool, case_i8, 16ull);
+  add_case_jobs<uint8_t>(pool, case_u8, 16ull);
+  add_case_jobs<int16_t>(pool, case_i16, 64ull);
+  add_case_jobs<uint16_t>(pool, case_u16, 64ull);
+  pool.run();
+
+  std::printf("\nChecked %" PRIu64 " (num, mul, shift) combinations whose product fits in the type\n", nInRange.load());
+  std::printf("and %" PRIu64 " combinations whose product wraps.\n\n", nWrapped.load());
+
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,419 @@
+/**
+ * test_multshiftround_sat.cpp
+ * Tests
+ *   out_type multshiftround_sat_X_Y(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ *   void multshiftround_sat_batch_X_Y(const in_type *num, out_type *result, const size_t length, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ *   out_type multshiftround_sat<typename in_type, typename out_type>(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ *   out_type multshiftround_sat<typename in_type, typename out_type, uint8_t shift>(const in_type num, const in_type mul, const out_type lower_bound, const out_type upper_bound);
+ *   void multshiftround_sat_batch<typename in_type, typename out_type>(const in_type *num, out_type *result, const size_t length, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound);
+ * for every supported pair of in_type and out_type, including the pairs of
+ * opposite signedness, against an exact reference computed with
+ * boost::multiprecision::cpp_int.
+ *
+ * For every valid shift, num covers every value of the 8-bit in_types and
+ * the special_values from test_values.hpp (values near 0, the powers of
+ * two, and the type limits, plus random values) of the wider ones. mul
+ * covers the same values, or every mul_stride-th of them for the wider
+ * in_types. Each result is saturated to the full range of out_type, to a
+ * narrow range around zero, to a negative range for signed out_types, and
+ * to a random range.
+ * Every call of the batch forms covers all num values for one mul. Invalid
+ * shift arguments must return or store 0.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "multshiftround_sat.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "multshiftround_sat.h"
+#ifdef __cplusplus
+  }
+#endif
+
+typedef boost::multiprecision::cpp_int big_int;
+
+const size_t random_values = 24u;
+const size_t compile_time_values = 16u;
+
+/**
+ * For in_types wider than 8 bits, mul takes every mul_stride-th num value,
+ * which keeps the number of (num, mul) pairs close to that of the 8-bit
+ * types.
+ */
+const size_t mul_stride = 5u;
+
+uint64_t error_count = 0u;
+uint64_t test_count = 0u;
+
+/**
+ * c_sat<in_type, out_type> maps a pair of types onto the C functions.
+ */
+template <typename in_type, typename out_type> struct c_sat;
+
+#define C_SAT(in_type, out_type, X, Y)                                                                                   \
+  template <> struct c_sat<in_type, out_type> {                                                                          \
+    static out_type apply(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) { \
+      return multshiftround_sat_##X##_##Y(num, mul, shift, lower_bound, upper_bound);                                    \
+    }                                                                                                                    \
+    static void batch(const in_type *num, out_type *result, const size_t length, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) { \
+      multshiftround_sat_batch_##X##_##Y(num, result, length, mul, shift, lower_bound, upper_bound);                      \
+    }                                                                                                                    \
+    static const char *name(void) { return "multshiftround_sat_" #X "_" #Y; }                                           \
+  };
+
+C_SAT(int8_t, int8_t, i8, i8)
+C_SAT(int16_t, int8_t, i16, i8)
+C_SAT(int16_t, int16_t, i16, i16)
+C_SAT(int32_t, int8_t, i32, i8)
+C_SAT(int32_t, int16_t, i32, i16)
+C_SAT(int32_t, int32_t, i32, i32)
+C_SAT(int64_t, int8_t, i64, i8)
+C_SAT(int64_t, int16_t, i64, i16)
+C_SAT(int64_t, int32_t, i64, i32)
+C_SAT(int64_t, int64_t, i64, i64)
+C_SAT(uint8_t, uint8_t, u8, u8)
+C_SAT(uint16_t, uint8_t, u16, u8)
+C_SAT(uint16_t, uint16_t, u16, u16)
+C_SAT(uint32_t, uint8_t, u32, u8)
+C_SAT(uint32_t, uint16_t, u32, u16)
+C_SAT(uint32_t, uint32_t, u32, u32)
+C_SAT(uint64_t, uint8_t, u64, u8)
+C_SAT(uint64_t, uint16_t, u64, u16)
+C_SAT(uint64_t, uint32_t, u64, u32)
+C_SAT(uint64_t, uint64_t, u64, u64)
+C_SAT(int8_t, uint8_t, i8, u8)
+C_SAT(int16_t, uint8_t, i16, u8)
+C_SAT(int16_t, uint16_t, i16, u16)
+C_SAT(int32_t, uint8_t, i32, u8)
+C_SAT(int32_t, uint16_t, i32, u16)
+C_SAT(int32_t, uint32_t, i32, u32)
+C_SAT(int64_t, uint8_t, i64, u8)
+C_SAT(int64_t, uint16_t, i64, u16)
+C_SAT(int64_t, uint32_t, i64, u32)
+C_SAT(int64_t, uint64_t, i64, u64)
+C_SAT(uint8_t, int8_t, u8, i8)
+C_SAT(uint16_t, int8_t, u16, i8)
+C_SAT(uint16_t, int16_t, u16, i16)
+C_SAT(uint32_t, int8_t, u32, i8)
+C_SAT(uint32_t, int16_t, u32, i16)
+C_SAT(uint32_t, int32_t, u32, i32)
+C_SAT(uint64_t, int8_t, u64, i8)
+C_SAT(uint64_t, int16_t, u64, i16)
+C_SAT(uint64_t, int32_t, u64, i32)
+C_SAT(uint64_t, int64_t, u64, i64)
+
+/**
+ * Returns ROUND((num * mul) / 2^shift), rounding half away from zero,
+ * saturated to [lower_bound, upper_bound].
+ */
+template <typename in_type, typename out_type> out_type reference(const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound) {
+  const big_int prod = big_int(num) * big_int(mul);
+  big_int magnitude = abs(prod);
+  if (shift > 0u) magnitude = (magnitude + (big_int(1) << (shift - 1u))) >> shift;
+  big_int rounded = (prod < 0) ? big_int(-magnitude) : magnitude;
+  if (rounded < big_int(lower_bound)) rounded = big_int(lower_bound);
+  if (rounded > big_int(upper_bound)) rounded = big_int(upper_bound);
+  return rounded.template convert_to<out_type>();
+}
+
+/**
+ * Prints a mismatch, unless max_printed_errors mismatches have already been
+ * printed, and counts it in error_count.
+ */
+template <typename in_type, typename out_type> void report(const char *form, const in_type num, const in_type mul, const uint8_t shift, const out_type lower_bound, const out_type upper_bound, const out_type result, const out_type expected) {
+  if (error_count < max_printed_errors) {
+    std::printf("\nERROR: %s(", form);
+    print_value<in_type>(num);
+    std::printf(", ");
+    print_value<in_type>(mul);
+    std::printf(", %u, ", shift);
+    print_value<out_type>(lower_bound);
+    std::printf(", ");
+    print_value<out_type>(upper_bound);
+    std::printf(") returned ");
+    print_value<out_type>(result);
+    std::printf(", expected ");
+    print_value<out_type>(expected);
+    std::printf("\n\n");
+  }
+  error_count++;
+}
+
+/**
+ * Returns the (lower_bound, upper_bound) pairs tested for out_type.
+ */
+template <typename out_type> std::vector<std::pair<out_type, out_type>> bound_pairs(std::mt19937_64 &rng) {
+  std::vector<std::pair<out_type, out_type>> bounds;
+  bounds.push_back(std::make_pair(std::numeric_limits<out_type>::min(), std::numeric_limits<out_type>::max()));
+  if (std::numeric_limits<out_type>::is_signed) {
+    bounds.push_back(std::make_pair(static_cast<out_type>(-5), static_cast<out_type>(5)));
+    bounds.push_back(std::make_pair(static_cast<out_type>(-10), static_cast<out_type>(-3)));
+  }
+  else bounds.push_back(std::make_pair(static_cast<out_type>(3), static_cast<out_type>(10)));
+  const std::vector<out_type> random_bounds = special_values<out_type>(2u, rng, false);
+  out_type first = random_bounds[random_bounds.size() - 2u];
+  out_type second = random_bounds.back();
+  if (second < first) std::swap(first, second);
+  bounds.push_back(std::make_pair(first, second));
+  return bounds;
+}
+
+/**
+ * Compile time shift forms, one instantiation per shift. Each is checked
+ * against the runtime template, which is checked against the reference.
+ */
+template <typename in_type, typename out_type, uint8_t shift> void check_compile_time_shift(const std::vector<in_type> &values, const out_type lower_bound, const out_type upper_bound) {
+  for (in_type num : values) {
+    for (in_type mul : values) {
+      const out_type expected = reference<in_type, out_type>(num, mul, shift, lower_bound, upper_bound);
+      const out_type result = multshiftround_sat<in_type, out_type, shift>(num, mul, lower_bound, upper_bound);
+      test_count++;
+      if (result != expected) report("multshiftround_sat<in_type, out_type, shift>", num, mul, shift, lower_bound, upper_bound, result, expected);
+    }
+  }
+}
+
+template <typename in_type, typename out_type, size_t... shifts> void check_compile_time(const std::vector<in_type> &values, const out_type lower_bound, const out_type upper_bound, std::index_sequence<shifts...>) {
+  const int expand[] = {0, (check_compile_time_shift<in_type, out_type, static_cast<uint8_t>(shifts)>(values, lower_bound, upper_bound), 0)...};
+  (void)expand;
+}
+
+/**
+ * Tests one pair of types at every valid shift plus a few invalid ones.
+ */
+template <typename in_type, typename out_type> void test_pair(std::mt19937_64 &rng) {
+  typedef multshiftround_sat_traits<in_type> traits;
+  std::printf("Testing %s, multshiftround_sat<%s, %s>, and their batch forms\n", c_sat<in_type, out_type>::name(), traits::name(), multshiftround_sat_traits<out_type>::name());
+
+  const bool every_value = std::numeric_limits<in_type>::digits <= 8;
+  const std::vector<in_type> values = every_value ? all_values<in_type>() : special_values<in_type>(random_values, rng, true);
+  std::vector<in_type> muls;
+  for (size_t j = 0u; j < values.size(); j += every_value ? 1u : mul_stride) muls.push_back(values[j]);
+  const std::vector<std::pair<out_type, out_type>> bounds = bound_pairs<out_type>(rng);
+  std::vector<out_type> c_batch(values.size());
+  std::vector<out_type> cpp_batch(values.size());
+
+  for (unsigned int shift_index = 0u; shift_index <= traits::max_shift + 2u; shift_index++) {
+    const uint8_t shift = static_cast<uint8_t>(shift_index);
+    const bool valid = shift <= traits::max_shift;
+    for (const std::pair<out_type, out_type> &bound : bounds) {
+      for (in_type mul : muls) {
+        c_sat<in_type, out_type>::batch(values.data(), c_batch.data(), values.size(), mul, shift, bound.first, bound.second);
+        multshiftround_sat_batch<in_type, out_type>(values.data(), cpp_batch.data(), values.size(), mul, shift, bound.first, bound.second);
+        for (size_t j = 0u; j < values.size(); j++) {
+          const in_type num = values[j];
+          const out_type expected = valid ? reference<in_type, out_type>(num, mul, shift, bound.first, bound.second) : static_cast<out_type>(0);
+          const out_type c_result = c_sat<in_type, out_type>::apply(num, mul, shift, bound.first, bound.second);
+          const out_type cpp_result = multshiftround_sat<in_type, out_type>(num, mul, shift, bound.first, bound.second);
+          test_count += 4u;
+          if (c_result != expected) report(c_sat<in_type, out_type>::name(), num, mul, shift, bound.first, bound.second, c_result, expected);
+          if (cpp_result != expected) report("multshiftround_sat<in_type, out_type>", num, mul, shift, bound.first, bound.second, cpp_result, expected);
+          if (c_batch[j] != expected) report("multshiftround_sat_batch_X_Y", num, mul, shift, bound.first, bound.second, c_batch[j], expected);
+          if (cpp_batch[j] != expected) report("multshiftround_sat_batch<in_type, out_type>", num, mul, shift, bound.first, bound.second, cpp_batch[j], expected);
+        }
+      }
+    }
+  }
+
+  /* The compile time forms are checked on a spread of the special values, ending at the type limits. */
+  const std::vector<in_type> specials = special_values<in_type>(0u, rng, false);
+  std::vector<in_type> few;
+  for (size_t j = 0u; j < specials.size(); j += specials.size() / compile_time_values + 1u) few.push_back(specials[j]);
+  few.push_back(specials[specials.size() - 2u]);
+  few.push_back(specials.back());
+  for (const std::pair<out_type, out_type> &bound : bounds) {
+    check_compile_time<in_type, out_type>(few, bound.first, bound.second, std::make_index_sequence<traits::max_shift + 1u>());
+  }
+}
+
+int main(void) {
+  std::mt19937_64 rng(20260916u);
+
+  test_pair<int8_t, int8_t>(rng);
+  test_pair<int16_t, int8_t>(rng);
+  test_pair<int16_t, int16_t>(rng);
+  test_pair<int32_t, int8_t>(rng);
+  test_pair<int32_t, int16_t>(rng);
+  test_pair<int32_t, int32_t>(rng);
+  test_pair<int64_t, int8_t>(rng);
+  test_pair<int64_t, int16_t>(rng);
+  test_pair<int64_t, int32_t>(rng);
+  test_pair<int64_t, int64_t>(rng);
+  test_pair<uint8_t, uint8_t>(rng);
+  test_pair<uint16_t, uint8_t>(rng);
+  test_pair<uint16_t, uint16_t>(rng);
+  test_pair<uint32_t, uint8_t>(rng);
+  test_pair<uint32_t, uint16_t>(rng);
+  test_pair<uint32_t, uint32_t>(rng);
+  test_pair<uint64_t, uint8_t>(rng);
+  test_pair<uint64_t, uint16_t>(rng);
+  test_pair<uint64_t, uint32_t>(rng);
+  test_pair<uint64_t, uint64_t>(rng);
+  test_pair<int8_t, uint8_t>(rng);
+  test_pair<int16_t, uint8_t>(rng);
+  test_pair<int16_t, uint16_t>(rng);
+  test_pair<int32_t, uint8_t>(rng);
+  test_pair<int32_t, uint16_t>(rng);
+  test_pair<int32_t, uint32_t>(rng);
+  test_pair<int64_t, uint8_t>(rng);
+  test_pair<int64_t, uint16_t>(rng);
+  test_pair<int64_t, uint32_t>(rng);
+  test_pair<int64_t, uint64_t>(rng);
+  test_pair<uint8_t, int8_t>(rng);
+  test_pair<uint16_t, int8_t>(rng);
+  test_pair<uint16_t, int16_t>(rng);
+  test_pair<uint32_t, int8_t>(rng);
+  test_pair<uint32_t, int16_t>(rng);
+  test_pair<uint32_t, int32_t>(rng);
+  test_pair<uint64_t, int8_t>(rng);
+  test_pair<uint64_t, int16_t>(rng);
+  test_pair<uint64_t, int32_t>(rng);
+  test_pair<uint64_t, int64_t>(rng);
+
+  std::printf("\n%" PRIu64 " tests complete. %" PRIu64 " errors.\n", test_count, error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,328 @@
+/**
+ * test_multshiftround_scaler.cpp
+ * Unit tests for the prepared scaler functions
+ *     multshiftround_scaler_X multshiftround_prepare_X(const type mul, const uint8_t shift);
+ *     type multshiftround_prepared_X(const type num, const multshiftround_scaler_X *scaler);
+ *     void multshiftround_prepared_batch_X(const type *num, type *result, const size_t length, const multshiftround_scaler_X *scaler);
+ * and the class template
+ *     multshiftround_scaler<typename type>
+ * where X is a type abbreviation.
+ *
+ * Every result is compared against multshiftround<type>(num, mul, shift)
+ * in multshiftround_run.hpp, which is itself tested by
+ * test_multshiftround_shiftround_run.cpp. Every shift from 0 to two past
+ * the largest valid shift is checked, so invalid shifts are covered too.
+ *
+ * Full coverage is provided on the num and mul inputs for the int8_t and
+ * uint8_t types. For the 16-bit types, every num is checked against
+ * special and pseudorandom muls through the batch forms, and the scalar
+ * forms are checked for every 17th mul.
+ *
+ * The 32-bit and 64-bit types are tested with special and pseudorandom
+ * num and mul values. multshiftround<type> overflows signed arithmetic
+ * when num * mul does not fit in type, so for the signed 32-bit and 64-bit
+ * types only pairs whose product fits are compared.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "multshiftround_run.hpp"
+#include "multshiftround_scaler.hpp"
+#include "wide_product.h"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "multshiftround_scaler.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Overloads that forward to the C functions so that the generic check
+ * routines below can call them.
+ */
+multshiftround_scaler_i8  c_prepare(const int8_t   mul, const uint8_t shift) { return multshiftround_prepare_i8(mul, shift); }
+multshiftround_scaler_i16 c_prepare(const int16_t  mul, const uint8_t shift) { return multshiftround_prepare_i16(mul, shift); }
+multshiftround_scaler_i32 c_prepare(const int32_t  mul, const uint8_t shift) { return multshiftround_prepare_i32(mul, shift); }
+multshiftround_scaler_i64 c_prepare(const int64_t  mul, const uint8_t shift) { return multshiftround_prepare_i64(mul, shift); }
+multshiftround_scaler_u8  c_prepare(const uint8_t  mul, const uint8_t shift) { return multshiftround_prepare_u8(mul, shift); }
+multshiftround_scaler_u16 c_prepare(const uint16_t mul, const uint8_t shift) { return multshiftround_prepare_u16(mul, shift); }
+multshiftround_scaler_u32 c_prepare(const uint32_t mul, const uint8_t shift) { return multshiftround_prepare_u32(mul, shift); }
+multshiftround_scaler_u64 c_prepare(const uint64_t mul, const uint8_t shift) { return multshiftround_prepare_u64(mul, shift); }
+
+int8_t   c_prepared(const int8_t   num, const multshiftround_scaler_i8  *scaler) { return multshiftround_prepared_i8(num, scaler); }
+int16_t  c_prepared(const int16_t  num, const multshiftround_scaler_i16 *scaler) { return multshiftround_prepared_i16(num, scaler); }
+int32_t  c_prepared(const int32_t  num, const multshiftround_scaler_i32 *scaler) { return multshiftround_prepared_i32(num, scaler); }
+int64_t  c_prepared(const int64_t  num, const multshiftround_scaler_i64 *scaler) { return multshiftround_prepared_i64(num, scaler); }
+uint8_t  c_prepared(const uint8_t  num, const multshiftround_scaler_u8  *scaler) { return multshiftround_prepared_u8(num, scaler); }
+uint16_t c_prepared(const uint16_t num, const multshiftround_scaler_u16 *scaler) { return multshiftround_prepared_u16(num, scaler); }
+uint32_t c_prepared(const uint32_t num, const multshiftround_scaler_u32 *scaler) { return multshiftround_prepared_u32(num, scaler); }
+uint64_t c_prepared(const uint64_t num, const multshiftround_scaler_u64 *scaler) { return multshiftround_prepared_u64(num, scaler); }
+
+void c_prepared_batch(const int8_t   *num, int8_t   *result, const size_t length, const multshiftround_scaler_i8  *scaler) { multshiftround_prepared_batch_i8(num, result, length, scaler); }
+void c_prepared_batch(const int16_t  *num, int16_t  *result, const size_t length, const multshiftround_scaler_i16 *scaler) { multshiftround_prepared_batch_i16(num, result, length, scaler); }
+void c_prepared_batch(const int32_t  *num, int32_t  *result, const size_t length, const multshiftround_scaler_i32 *scaler) { multshiftround_prepared_batch_i32(num, result, length, scaler); }
+void c_prepared_batch(const int64_t  *num, int64_t  *result, const size_t length, const multshiftround_scaler_i64 *scaler) { multshiftround_prepared_batch_i64(num, result, length, scaler); }
+void c_prepared_batch(const uint8_t  *num, uint8_t  *result, const size_t length, const multshiftround_scaler_u8  *scaler) { multshiftround_prepared_batch_u8(num, result, length, scaler); }
+void c_prepared_batch(const uint16_t *num, uint16_t *result, const size_t length, const multshiftround_scaler_u16 *scaler) { multshiftround_prepared_batch_u16(num, result, length, scaler); }
+void c_prepared_batch(const uint32_t *num, uint32_t *result, const size_t length, const multshiftround_scaler_u32 *scaler) { multshiftround_prepared_batch_u32(num, result, length, scaler); }
+void c_prepared_batch(const uint64_t *num, uint64_t *result, const size_t length, const multshiftround_scaler_u64 *scaler) { multshiftround_prepared_batch_u64(num, result, length, scaler); }
+
+/**
+ * Returns true if num * mul fits in type, i.e. if multshiftround<type>
+ * is defined for these arguments. Unsigned products wrap without
+ * undefined behavior and the 8-bit and 16-bit signed products are
+ * computed in int, so only the signed 32-bit and 64-bit types can fail.
+ */
+bool product_defined(const int8_t, const int8_t) { return true; }
+bool product_defined(const int16_t, const int16_t) { return true; }
+bool product_defined(const int32_t num, const int32_t mul) {
+  const int64_t product = static_cast<int64_t>(num) * mul;
+  return product <= std::numeric_limits<int32_t>::max() && product >= std::numeric_limits<int32_t>::min();
+}
+bool product_defined(const int64_t num, const int64_t mul) { return !wide_mul_overflows_i64(num, mul); }
+bool product_defined(const uint8_t, const uint8_t) { return true; }
+bool product_defined(const uint16_t, const uint16_t) { return true; }
+bool product_defined(const uint32_t, const uint32_t) { return true; }
+bool product_defined(const uint64_t, const uint64_t) { return true; }
+
+/**
+ * Total number of comparisons and of mismatches found. Only the first
+ * few mismatches are printed.
+ */
+uint64_t test_count = 0u;
+uint64_t error_count = 0u;
+
+/**
+ * Checks every form against multshiftround<type> for one mul, every shift
+ * from 0 to two past the largest valid shift, and every element of nums
+ * whose product with mul is defined. The scalar forms are skipped if
+ * check_scalar is false.
+ */
+template <typename type> void check_mul(const char *type_name, const std::vector<type> &all_nums, const type mul, const bool check_scalar) {
+  std::vector<type> nums;
+  for (type num : all_nums) {
+    if (product_defined(num, mul)) nums.push_back(num);
+  }
+  const size_t length = nums.size();
+  std::vector<type> expected(length);
+  std::vector<type> result(length);
+
+  for (uint8_t shift = 0u; shift <= multshiftround_scaler_traits<type>::max_shift + 2u; shift++) {
+    for (size_t j = 0u; j < length; j++) expected[j] = multshiftround<type>(nums[j], mul, shift);
+
+    const multshiftround_scaler<type> cpp_scaler(mul, shift);
+    if (cpp_scaler.mul() != mul) report_error<type>(error_count, type_name, "multshiftround_scaler::mul", {static_cast<type>(0), mul, static_cast<type>(shift)}, cpp_scaler.mul(), mul);
+    if (cpp_scaler.shift() != shift) report_error<type>(error_count, type_name, "multshiftround_scaler::shift", {static_cast<type>(0), mul, static_cast<type>(shift)}, static_cast<type>(cpp_scaler.shift()), static_cast<type>(shift));
+    const auto c_scaler = c_prepare(mul, shift);
+
+    c_prepared_batch(nums.data(), result.data(), length, &c_scaler);
+    for (size_t j = 0u; j < length; j++) {
+      if (result[j] != expected[j]) report_error<type>(error_count, type_name, "multshiftround_prepared_batch", {nums[j], mul, static_cast<type>(shift)}, result[j], expected[j]);
+    }
+
+    result = nums;
+    cpp_scaler.apply_batch(result.data(), length);
+    for (size_t j = 0u; j < length; j++) {
+      if (result[j] != expected[j]) report_error<type>(error_count, type_name, "multshiftround_scaler::apply_batch", {nums[j], mul, static_cast<type>(shift)}, result[j], expected[j]);
+    }
+    test_count += 2u * length;
+
+    if (check_scalar) {
+      for (size_t j = 0u; j < length; j++) {
+        type c_result = c_prepared(nums[j], &c_scaler);
+        if (c_result != expected[j]) report_error<type>(error_count, type_name, "multshiftround_prepared", {nums[j], mul, static_cast<type>(shift)}, c_result, expected[j]);
+        type cpp_result = cpp_scaler(nums[j]);
+        if (cpp_result != expected[j]) report_error<type>(error_count, type_name, "multshiftround_scaler::apply", {nums[j], mul, static_cast<type>(shift)}, cpp_result, expected[j]);
+      }
+      test_count += 2u * length;
+    }
+  }
+}
+
+/**
+ * Every num against every mul.
+ */
+template <typename type> void test_exhaustive(const char *type_name) {
+  std::printf("testing multshiftround_prepared<%s> and multshiftround_scaler<%s>\n", type_name, type_name);
+  const std::vector<type> values = all_values<type>();
+  for (type mul : values) check_mul<type>(type_name, values, mul, true);
+}
+
+/**
+ * Every num against special and pseudorandom muls.
+ */
+template <typename type> void test_all_nums(const char *type_name, const uint32_t scalar_stride, std::mt19937_64 &rng) {
+  std::printf("testing multshiftround_prepared<%s> and multshiftround_scaler<%s>\n", type_name, type_name);
+  const std::vector<type> nums = all_values<type>();
+  const std::vector<type> muls = special_values<type>(256u, rng, false);
+  for (size_t j = 0u; j < muls.size(); j++) check_mul<type>(type_name, nums, muls[j], (j % scalar_stride) == 0u);
+}
+
+/**
+ * Special and pseudorandom nums against special and pseudorandom muls.
+ */
+template <typename type> void test_sampled(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("testing multshiftround_prepared<%s> and multshiftround_scaler<%s>\n", type_name, type_name);
+  const std::vector<type> muls = special_values<type>(512u, rng, false);
+  const std::vector<type> nums = special_values<type>(4096u, rng, false);
+  for (type mul : muls) check_mul<type>(type_name, nums, mul, true);
+}
+
+int main() {
+  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
+  std::mt19937_64 rng(0x5CA1E45CA1E4ull);
+
+  test_exhaustive<int8_t>("int8_t");
+  test_exhaustive<uint8_t>("uint8_t");
+  test_all_nums<int16_t>("int16_t", 17u, rng);
+  test_all_nums<uint16_t>("uint16_t", 17u, rng);
+  test_sampled<int32_t>("int32_t", rng);
+  test_sampled<uint32_t>("uint32_t", rng);
+  test_sampled<int64_t>("int64_t", rng);
+  test_sampled<uint64_t>("uint64_t", rng);
+
+  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
+  std::printf("%" PRIu64 " tests complete. %" PRIu64 " errors. Tests took %" PRIu64 " ms\n", test_count, error_count, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
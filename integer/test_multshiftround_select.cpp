@@ -0,0 +1,294 @@
+/**
+ * test_multshiftround_select.cpp
+ * Unit tests for the class template
+ *     multshiftround_select<range_min, range_max, frac_num, frac_den, err_num, err_den, rounding>
+ * in multshiftround_select.hpp.
+ *
+ * For each specification, the selected shift, mul, and type are compared
+ * against a plain run time search in 64-bit integer arithmetic: the
+ * smallest shift whose mul meets the error bound at the end of the range
+ * with the larger magnitude, and the narrowest type whose limits hold
+ * range_min, range_max, mul, and both end point products. The
+ * specifications are kept small enough that this search cannot overflow.
+ *
+ * apply(num) is then compared against reference_multshiftround for every
+ * num on the range, or for the end points and a stride through the range
+ * when it is wide, and the rounded result is checked to lie within
+ * err_num / err_den plus the rounding error (1/2 for round_half_away, 1
+ * otherwise) of num * frac_num / frac_den.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <chrono>
+#include <type_traits>
+#include "multshiftround_select.hpp"
+#include "intmath_reference.hpp"
+
+/* The example in multshiftround_select.hpp, checked at compile time. */
+typedef multshiftround_select<0, 4095, 3300, 4095> adc_millivolts;
+static_assert(adc_millivolts::shift == 12u && adc_millivolts::mul == 3301u, "multshiftround_select<0, 4095, 3300, 4095> selected the wrong mul / 2^shift.");
+static_assert(std::is_same<adc_millivolts::type, uint32_t>::value, "multshiftround_select<0, 4095, 3300, 4095> selected the wrong type.");
+static_assert(adc_millivolts::apply(4095u) == 3300u && adc_millivolts::apply(2047u) == 1650u, "multshiftround_select::apply is not a constant expression or is wrong.");
+static_assert(std::is_same<multshiftround_select<0, 200, 1, 2>::type, uint8_t>::value && multshiftround_select<0, 200, 1, 2>::mul == 1u, "an exact fraction must select shift 1.");
+static_assert(std::is_same<multshiftround_select<-100, 100, 1, 3>::type, int16_t>::value, "a negative range_min must select a signed type.");
+
+uint64_t test_count = 0u;
+uint64_t error_count = 0u;
+const uint64_t max_printed_errors = 16u;
+
+template <typename type> const char *type_name(void) {
+  return std::numeric_limits<type>::is_signed
+         ? (sizeof(type) == 1u ? "int8_t" : sizeof(type) == 2u ? "int16_t" : sizeof(type) == 4u ? "int32_t" : "int64_t")
+         : (sizeof(type) == 1u ? "uint8_t" : sizeof(type) == 2u ? "uint16_t" : sizeof(type) == 4u ? "uint32_t" : "uint64_t");
+}
+
+template <typename spec> void check(const char *what, const int64_t num, const int64_t value, const int64_t expected) {
+  test_count++;
+  if (value == expected) return;
+  error_count++;
+  if (error_count <= max_printed_errors)
+    std::printf("\nERROR: multshiftround_select<..., %s> (shift %u, mul %" PRIu64 ", %s), %s for num = %" PRIi64 ": %" PRIi64 ", expected %" PRIi64 "\n\n",
+                spec::rounding_type::name(), static_cast<unsigned>(spec::shift), static_cast<uint64_t>(spec::mul), type_name<typename spec::type>(), what, num, value, expected);
+}
+
+/**
+ * A specification together with its rounding policy, since
+ * multshiftround_select does not export it.
+ */
+template <int64_t range_min_, int64_t range_max_, uint64_t frac_num_, uint64_t frac_den_, uint64_t err_num_, uint64_t err_den_, typename rounding>
+struct test_spec : multshiftround_select<range_min_, range_max_, frac_num_, frac_den_, err_num_, err_den_, rounding> {
+  typedef rounding rounding_type;
+  static const int64_t range_min = range_min_;
+  static const int64_t range_max = range_max_;
+  static const int64_t frac_num = static_cast<int64_t>(frac_num_);
+  static const int64_t frac_den = static_cast<int64_t>(frac_den_);
+  static const int64_t err_num = static_cast<int64_t>(err_num_);
+  static const int64_t err_den = static_cast<int64_t>(err_den_);
+};
+
+int64_t magnitude(const int64_t value) { return value < 0 ? -value : value; }
+
+/* ROUND(frac_num * 2^shift / frac_den), rounding half up. */
+template <typename spec> int64_t search_mul(const unsigned shift) {
+  return (2 * spec::frac_num * (static_cast<int64_t>(1) << shift) + spec::frac_den) / (2 * spec::frac_den);
+}
+
+/* True if the end point products fit in type. */
+template <typename type, typename spec> bool search_fits(const int64_t mul, const unsigned shift) {
+  const int64_t lowest = static_cast<int64_t>(std::numeric_limits<type>::lowest());
+  const uint64_t highest = static_cast<uint64_t>(std::numeric_limits<type>::max());
+  return shift < static_cast<unsigned>(std::numeric_limits<type>::digits) &&
+         spec::range_min >= lowest && spec::range_min * mul >= lowest &&
+         static_cast<uint64_t>(mul) <= highest &&
+         (spec::range_max <= 0 || (static_cast<uint64_t>(spec::range_max) <= highest && static_cast<uint64_t>(spec::range_max * mul) <= highest));
+}
+
+template <typename spec> void test_selection(void) {
+  typedef typename spec::type type;
+  const int64_t max_magnitude = magnitude(spec::range_min) > magnitude(spec::range_max) ? magnitude(spec::range_min) : magnitude(spec::range_max);
+
+  unsigned shift = 1u;
+  for (; shift < 63u; shift++) {
+    const int64_t mul = search_mul<spec>(shift);
+    if (max_magnitude * magnitude(mul * spec::frac_den - spec::frac_num * (static_cast<int64_t>(1) << shift)) * spec::err_den <
+        spec::err_num * (static_cast<int64_t>(1) << shift) * spec::frac_den) break;
+  }
+  const int64_t mul = search_mul<spec>(shift);
+  check<spec>("shift", 0, spec::shift, shift);
+  check<spec>("mul", 0, static_cast<int64_t>(spec::mul), mul);
+
+  const bool is_signed = spec::range_min < 0;
+  const unsigned width = (is_signed ? search_fits<int8_t, spec>(mul, shift) : search_fits<uint8_t, spec>(mul, shift)) ? 8u
+                       : (is_signed ? search_fits<int16_t, spec>(mul, shift) : search_fits<uint16_t, spec>(mul, shift)) ? 16u
+                       : (is_signed ? search_fits<int32_t, spec>(mul, shift) : search_fits<uint32_t, spec>(mul, shift)) ? 32u : 64u;
+  check<spec>("type width", 0, static_cast<int64_t>(8u * sizeof(type)), width);
+  check<spec>("type signedness", 0, std::numeric_limits<type>::is_signed, is_signed);
+}
+
+template <typename spec> void test_apply_one(const int64_t num) {
+  typedef typename spec::type type;
+  typedef typename spec::rounding_type rounding;
+  const int64_t value = static_cast<int64_t>(spec::apply(static_cast<type>(num)));
+  check<spec>("apply", num, value, static_cast<int64_t>(reference_multshiftround<type>(static_cast<type>(num), spec::mul, spec::shift, rounding())));
+
+  /**
+   * |value - num * frac_num / frac_den| < err_num / err_den + rounding error
+   * <=> |value * frac_den - num * frac_num| * err_den * 2 < (err_num * 2 + err_den * r) * frac_den,
+   * where r is 1 for round_half_away and 2 otherwise.
+   */
+  const int64_t rounding_error = std::is_same<rounding, round_half_away>::value ? 1 : 2;
+  const bool within = magnitude(value * spec::frac_den - num * spec::frac_num) * spec::err_den * 2 <
+                      (spec::err_num * 2 + spec::err_den * rounding_error) * spec::frac_den;
+  check<spec>("error bound", num, within, 1);
+}
+
+template <typename spec> void test_apply(void) {
+  const int64_t span = spec::range_max - spec::range_min;
+  const int64_t stride = (span < (static_cast<int64_t>(1) << 22)) ? 1 : span / (static_cast<int64_t>(1) << 20) | 1;
+  for (int64_t num = spec::range_min; num <= spec::range_max - stride; num += stride) test_apply_one<spec>(num);
+  test_apply_one<spec>(spec::range_max);
+  if (spec::range_min < 0 && spec::range_max > 0) test_apply_one<spec>(0);
+}
+
+template <typename spec> void test_spec_all(void) {
+  test_selection<spec>();
+  test_apply<spec>();
+}
+
+int main() {
+  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
+
+  test_spec_all<test_spec<0, 4095, 3300, 4095, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<0, 200, 1, 2, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<0, 255, 7, 10, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<-128, 127, 1, 3, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<-100, 100, 1, 3, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<-2048, 2047, 5, 9, 1, 4, round_half_away> >();
+  test_spec_all<test_spec<-30000, 30000, 22, 7, 1, 100, round_half_away> >();
+  test_spec_all<test_spec<0, 65535, 100, 65535, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<0, 1000000, 314159, 100000, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<-1000, 1000, 2, 3, 1, 2, round_floor> >();
+  test_spec_all<test_spec<-1000, 1000, 2, 3, 1, 2, round_half_even> >();
+  test_spec_all<test_spec<0, 50000, 3, 7, 1, 8, round_trunc> >();
+  test_spec_all<test_spec<-134217728, 134217727, 1000003, 999983, 1, 2, round_half_away> >();
+  test_spec_all<test_spec<0, 400000000, 5, 3, 1, 2, round_half_away> >();
+
+  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
+  std::printf("%" PRIu64 " tests complete. %" PRIu64 " errors. Tests took %" PRIu64 " ms\n", test_count, error_count, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
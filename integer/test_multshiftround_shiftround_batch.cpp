@@ -0,0 +1,425 @@
+/**
+ * test_multshiftround_shiftround_batch.cpp
+ * Unit tests for the array (batch) functions
+ *     void shiftround_batch_X(const type *num, type *result, const size_t length, const uint8_t shift);
+ *     void multshiftround_batch_X(const type *num, type *result, const size_t length, const type mul, const uint8_t shift);
+ * and the pointer, in-place, and iterator range forms of
+ *     shiftround_batch<typename type>(...)
+ *     multshiftround_batch<typename type>(...)
+ * where X is a type abbreviation.
+ *
+ * Every batch result is compared against the scalar shiftround<type> and
+ * multshiftround<type> functions in shiftround_run.hpp and
+ * multshiftround_run.hpp, which are themselves tested exhaustively
+ * by test_multshiftround_shiftround_run.cpp.
+ *
+ * Every test runs on each code path through for_each_code_path in
+ * test_values.hpp.
+ *
+ * Full coverage is provided on the num, mul, and shift inputs for the
+ * int8_t and uint8_t types. Full coverage is provided on the num and
+ * shift inputs for the int16_t and uint16_t types with a spread of mul
+ * values. The 32-bit and 64-bit types are tested at every shift value with
+ * pseudorandom num and mul values that include the extremes of each type.
+ *
+ * Every type is also tested with short arrays through check_guarded_array
+ * so that misalignment and the scalar tail after the last full vector are
+ * exercised, with invalid shift values, and with num == result.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <list>
+#include <random>
+#include <chrono>
+#include "multshiftround_run.hpp"
+#include "shiftround_run.hpp"
+#include "multshiftround_shiftround_batch.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "multshiftround_shiftround_batch.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Overloads that forward to the C batch functions so that the generic
+ * check routine below can call them.
+ */
+void c_shiftround_batch(const int8_t   *num, int8_t   *result, const size_t length, const uint8_t shift) { shiftround_batch_i8 (num, result, length, shift); }
+void c_shiftround_batch(const int16_t  *num, int16_t  *result, const size_t length, const uint8_t shift) { shiftround_batch_i16(num, result, length, shift); }
+void c_shiftround_batch(const int32_t  *num, int32_t  *result, const size_t length, const uint8_t shift) { shiftround_batch_i32(num, result, length, shift); }
+void c_shiftround_batch(const int64_t  *num, int64_t  *result, const size_t length, const uint8_t shift) { shiftround_batch_i64(num, result, length, shift); }
+void c_shiftround_batch(const uint8_t  *num, uint8_t  *result, const size_t length, const uint8_t shift) { shiftround_batch_u8 (num, result, length, shift); }
+void c_shiftround_batch(const uint16_t *num, uint16_t *result, const size_t length, const uint8_t shift) { shiftround_batch_u16(num, result, length, shift); }
+void c_shiftround_batch(const uint32_t *num, uint32_t *result, const size_t length, const uint8_t shift) { shiftround_batch_u32(num, result, length, shift); }
+void c_shiftround_batch(const uint64_t *num, uint64_t *result, const size_t length, const uint8_t shift) { shiftround_batch_u64(num, result, length, shift); }
+
+void c_multshiftround_batch(const int8_t   *num, int8_t   *result, const size_t length, const int8_t   mul, const uint8_t shift) { multshiftround_batch_i8 (num, result, length, mul, shift); }
+void c_multshiftround_batch(const int16_t  *num, int16_t  *result, const size_t length, const int16_t  mul, const uint8_t shift) { multshiftround_batch_i16(num, result, length, mul, shift); }
+void c_multshiftround_batch(const int32_t  *num, int32_t  *result, const size_t length, const int32_t  mul, const uint8_t shift) { multshiftround_batch_i32(num, result, length, mul, shift); }
+void c_multshiftround_batch(const int64_t  *num, int64_t  *result, const size_t length, const int64_t  mul, const uint8_t shift) { multshiftround_batch_i64(num, result, length, mul, shift); }
+void c_multshiftround_batch(const uint8_t  *num, uint8_t  *result, const size_t length, const uint8_t  mul, const uint8_t shift) { multshiftround_batch_u8 (num, result, length, mul, shift); }
+void c_multshiftround_batch(const uint16_t *num, uint16_t *result, const size_t length, const uint16_t mul, const uint8_t shift) { multshiftround_batch_u16(num, result, length, mul, shift); }
+void c_multshiftround_batch(const uint32_t *num, uint32_t *result, const size_t length, const uint32_t mul, const uint8_t shift) { multshiftround_batch_u32(num, result, length, mul, shift); }
+void c_multshiftround_batch(const uint64_t *num, uint64_t *result, const size_t length, const uint64_t mul, const uint8_t shift) { multshiftround_batch_u64(num, result, length, mul, shift); }
+
+/**
+ * Total number of mismatches found. Only the first max_printed_errors
+ * mismatches are printed.
+ */
+uint64_t error_count = 0u;
+
+/**
+ * Compares result[j] against expected[j] for j on [0, length - 1].
+ * form names the function and form under test for the error message.
+ */
+template <typename type> void compare_results(const char *type_name, const char *form, const type *num, const type *result, const type *expected, const size_t length, const type mul, const uint8_t shift) {
+  for (size_t j = 0u; j < length; j++) {
+    if (result[j] != expected[j]) {
+      if (error_count < max_printed_errors) {
+        std::printf("\nERROR: %s, type %s, num %" PRIi64 ", mul %" PRIi64 ", shift %u, index %zu: result %" PRIi64 ", expected %" PRIi64 "\n\n",
+                    form, type_name, static_cast<int64_t>(num[j]), static_cast<int64_t>(mul), shift, j, static_cast<int64_t>(result[j]), static_cast<int64_t>(expected[j]));
+      }
+      error_count++;
+    }
+  }
+}
+
+/**
+ * Runs every form of shiftround_batch<type> on num and checks the results
+ * against the scalar shiftround<type>.
+ */
+template <typename type> void check_shiftround_batch(const char *type_name, const std::vector<type> &num, const uint8_t shift) {
+  const size_t length = num.size();
+  std::vector<type> expected(length);
+  for (size_t j = 0u; j < length; j++) expected[j] = shiftround<type>(num[j], shift);
+
+  std::vector<type> result(length, static_cast<type>(0x5A));
+  c_shiftround_batch(num.data(), result.data(), length, shift);
+  compare_results<type>(type_name, "shiftround_batch C form", num.data(), result.data(), expected.data(), length, static_cast<type>(1), shift);
+
+  result.assign(length, static_cast<type>(0x5A));
+  shiftround_batch<type>(num.data(), result.data(), length, shift);
+  compare_results<type>(type_name, "shiftround_batch pointer form", num.data(), result.data(), expected.data(), length, static_cast<type>(1), shift);
+
+  result = num;
+  shiftround_batch<type>(result.data(), length, shift);
+  compare_results<type>(type_name, "shiftround_batch in-place form", num.data(), result.data(), expected.data(), length, static_cast<type>(1), shift);
+
+  std::list<type> num_list(num.begin(), num.end());
+  result.assign(length, static_cast<type>(0x5A));
+  typename std::vector<type>::iterator result_end = shiftround_batch<type>(num_list.begin(), num_list.end(), result.begin(), shift);
+  if (result_end != result.end()) {
+    std::printf("\nERROR: iterator form shiftround_batch<%s> shift %u returned the wrong output iterator\n\n", type_name, shift);
+    error_count++;
+  }
+  compare_results<type>(type_name, "shiftround_batch iterator form", num.data(), result.data(), expected.data(), length, static_cast<type>(1), shift);
+
+  shiftround_batch<type>(num_list.begin(), num_list.end(), shift);
+  result.assign(num_list.begin(), num_list.end());
+  compare_results<type>(type_name, "shiftround_batch in-place iterator form", num.data(), result.data(), expected.data(), length, static_cast<type>(1), shift);
+}
+
+/**
+ * Runs every form of multshiftround_batch<type> on num and checks the
+ * results against the scalar multshiftround<type>.
+ */
+template <typename type> void check_multshiftround_batch(const char *type_name, const std::vector<type> &num, const type mul, const uint8_t shift) {
+  const size_t length = num.size();
+  std::vector<type> expected(length);
+  for (size_t j = 0u; j < length; j++) expected[j] = multshiftround<type>(num[j], mul, shift);
+
+  std::vector<type> result(length, static_cast<type>(0x5A));
+  c_multshiftround_batch(num.data(), result.data(), length, mul, shift);
+  compare_results<type>(type_name, "multshiftround_batch C form", num.data(), result.data(), expected.data(), length, mul, shift);
+
+  result.assign(length, static_cast<type>(0x5A));
+  multshiftround_batch<type>(num.data(), result.data(), length, mul, shift);
+  compare_results<type>(type_name, "multshiftround_batch pointer form", num.data(), result.data(), expected.data(), length, mul, shift);
+
+  result = num;
+  multshiftround_batch<type>(result.data(), length, mul, shift);
+  compare_results<type>(type_name, "multshiftround_batch in-place form", num.data(), result.data(), expected.data(), length, mul, shift);
+
+  std::list<type> num_list(num.begin(), num.end());
+  result.assign(length, static_cast<type>(0x5A));
+  typename std::vector<type>::iterator result_end = multshiftround_batch<type>(num_list.begin(), num_list.end(), result.begin(), mul, shift);
+  if (result_end != result.end()) {
+    std::printf("\nERROR: iterator form multshiftround_batch<%s> shift %u returned the wrong output iterator\n\n", type_name, shift);
+    error_count++;
+  }
+  compare_results<type>(type_name, "multshiftround_batch iterator form", num.data(), result.data(), expected.data(), length, mul, shift);
+
+  multshiftround_batch<type>(num_list.begin(), num_list.end(), mul, shift);
+  result.assign(num_list.begin(), num_list.end());
+  compare_results<type>(type_name, "multshiftround_batch in-place iterator form", num.data(), result.data(), expected.data(), length, mul, shift);
+}
+
+/**
+ * Runs the C pointer forms on the first length elements of num for every
+ * length on [0, 71] with check_guarded_array. This exercises misaligned
+ * loads and stores and every possible scalar tail length, and checks that
+ * elements outside the array are left untouched.
+ */
+template <typename type> void check_tails(const char *type_name, const std::vector<type> &num, const type mul, const uint8_t shift) {
+  char description[96];
+  for (size_t length = 0u; length < 72u; length++) {
+    const std::vector<type> input(num.begin(), num.begin() + length);
+    std::vector<type> expected(length);
+
+    for (size_t j = 0u; j < length; j++) expected[j] = shiftround<type>(input[j], shift);
+    std::snprintf(description, sizeof(description), "shiftround_batch tail, type %s, shift %u", type_name, shift);
+    check_guarded_array(error_count, description, input, expected, [&](const type *in, type *result) {
+      c_shiftround_batch(in, result, length, shift);
+    });
+
+    for (size_t j = 0u; j < length; j++) expected[j] = multshiftround<type>(input[j], mul, shift);
+    std::snprintf(description, sizeof(description), "multshiftround_batch tail, type %s, mul %" PRIi64 ", shift %u", type_name, static_cast<int64_t>(mul), shift);
+    check_guarded_array(error_count, description, input, expected, [&](const type *in, type *result) {
+      c_multshiftround_batch(in, result, length, mul, shift);
+    });
+  }
+}
+
+/**
+ * Checks that an invalid shift argument produces all zeros, like the
+ * scalar functions.
+ */
+template <typename type> void check_invalid_shift(const char *type_name, const std::vector<type> &num, const uint8_t shift) {
+  const size_t length = num.size();
+  std::vector<type> expected(length, static_cast<type>(0));
+  std::vector<type> result(length, static_cast<type>(0x5A));
+  shiftround_batch<type>(num.data(), result.data(), length, shift);
+  compare_results<type>(type_name, "shiftround_batch invalid shift", num.data(), result.data(), expected.data(), length, static_cast<type>(1), shift);
+  result.assign(length, static_cast<type>(0x5A));
+  multshiftround_batch<type>(num.data(), result.data(), length, static_cast<type>(3), shift);
+  compare_results<type>(type_name, "multshiftround_batch invalid shift", num.data(), result.data(), expected.data(), length, static_cast<type>(3), shift);
+}
+
+/**
+ * Returns length pseudorandom values of type, with the lowest, max, and
+ * values near zero placed at the start of the array.
+ */
+template <typename type> std::vector<type> random_values(const size_t length, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<type> distribution(std::numeric_limits<type>::lowest(), std::numeric_limits<type>::max());
+  std::vector<type> values;
+  values.push_back(std::numeric_limits<type>::lowest());
+  values.push_back(std::numeric_limits<type>::max());
+  values.push_back(static_cast<type>(std::numeric_limits<type>::lowest() + 1));
+  values.push_back(static_cast<type>(std::numeric_limits<type>::max() - 1));
+  for (int64_t j = -3; j <= 3; j++) values.push_back(static_cast<type>(j));
+  while (values.size() < length) values.push_back(distribution(rng));
+  return values;
+}
+
+/**
+ * Returns the largest valid shift for type.
+ */
+template <typename type> uint8_t max_shift(void) {
+  return static_cast<uint8_t>(std::numeric_limits<type>::digits - 1);
+}
+
+/**
+ * Every num, every mul, and every shift.
+ */
+template <typename type> void test_8bit(const char *type_name) {
+  std::printf("testing shiftround_batch<%s> and multshiftround_batch<%s>\n", type_name, type_name);
+  const std::vector<type> num = all_values<type>();
+  for (uint8_t shift = 0u; shift <= max_shift<type>(); shift++) {
+    check_shiftround_batch<type>(type_name, num, shift);
+    for (type mul : num) check_multshiftround_batch<type>(type_name, num, mul, shift);
+    check_tails<type>(type_name, num, std::numeric_limits<type>::max(), shift);
+  }
+  check_invalid_shift<type>(type_name, num, static_cast<uint8_t>(max_shift<type>() + 1u));
+  check_invalid_shift<type>(type_name, num, 255u);
+}
+
+/**
+ * Every num and every shift with a spread of mul values.
+ */
+template <typename type> void test_16bit(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("testing shiftround_batch<%s> and multshiftround_batch<%s>\n", type_name, type_name);
+  const std::vector<type> num = all_values<type>();
+  const std::vector<type> muls = random_values<type>(24u, rng);
+  for (uint8_t shift = 0u; shift <= max_shift<type>(); shift++) {
+    check_shiftround_batch<type>(type_name, num, shift);
+    for (type mul : muls) check_multshiftround_batch<type>(type_name, num, mul, shift);
+    check_tails<type>(type_name, num, muls.back(), shift);
+  }
+  check_invalid_shift<type>(type_name, num, static_cast<uint8_t>(max_shift<type>() + 1u));
+}
+
+/**
+ * Pseudorandom num and mul at every shift.
+ */
+template <typename type> void test_wide(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("testing shiftround_batch<%s> and multshiftround_batch<%s>\n", type_name, type_name);
+  const std::vector<type> num = random_values<type>(65536u + 13u, rng);
+  const std::vector<type> muls = random_values<type>(24u, rng);
+  for (uint8_t shift = 0u; shift <= max_shift<type>(); shift++) {
+    check_shiftround_batch<type>(type_name, num, shift);
+    for (type mul : muls) check_multshiftround_batch<type>(type_name, num, mul, shift);
+    check_tails<type>(type_name, num, muls.back(), shift);
+  }
+  check_invalid_shift<type>(type_name, num, static_cast<uint8_t>(max_shift<type>() + 1u));
+}
+
+int main() {
+  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
+
+  for_each_code_path(CPU_FEATURE_ALL, [&]() {
+    std::mt19937_64 rng(0x5EED5EEDull);
+    test_8bit<int8_t>("int8_t");
+    test_8bit<uint8_t>("uint8_t");
+    test_16bit<int16_t>("int16_t", rng);
+    test_16bit<uint16_t>("uint16_t", rng);
+    test_wide<int32_t>("int32_t", rng);
+    test_wide<uint32_t>("uint32_t", rng);
+    test_wide<int64_t>("int64_t", rng);
+    test_wide<uint64_t>("uint64_t", rng);
+  });
+
+  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
+  std::printf("%" PRIu64 " errors. Tests took %" PRIu64 " ms\n", error_count, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -51,6 +51,24 @@
 
 typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<80, boost::multiprecision::backends::digit_base_2, void, boost::int16_t, -16382, 16383>, boost::multiprecision::et_off> cpp_bin_float_80;
 
+/**
+ * shiftround<type, shift> and multshiftround<type, shift> are constexpr,
+ * even with DEBUG_INTMATH defined as it is for this test. These checks
+ * and the table below are evaluated at compile time.
+ */
+static_assert(shiftround<int8_t, 1>(-3) == -2, "shiftround<int8_t, 1>(-3) must be -2 at compile time");
+static_assert(shiftround<int8_t, 6>(-32) == -1, "shiftround<int8_t, 6>(-32) must be -1 at compile time");
+static_assert(shiftround<int16_t, 2>(-6) == -2, "shiftround<int16_t, 2>(-6) must be -2 at compile time");
+static_assert(shiftround<uint16_t, 15>(49152u) == 2u, "shiftround<uint16_t, 15>(49152) must be 2 at compile time");
+static_assert(shiftround<int64_t, 62>(std::numeric_limits<int64_t>::lowest()) == -2ll, "shiftround<int64_t, 62>(INT64_MIN) must be -2 at compile time");
+static_assert(shiftround<uint64_t, 63>(std::numeric_limits<uint64_t>::max()) == 2ull, "shiftround<uint64_t, 63>(UINT64_MAX) must be 2 at compile time");
+static_assert(multshiftround<int32_t, 10>(-3, 512) == -2, "multshiftround<int32_t, 10>(-3, 512) must be -2 at compile time");
+static_assert(multshiftround<uint8_t, 4>(15, 17) == 16u, "multshiftround<uint8_t, 4>(15, 17) must be 16 at compile time");
+static_assert(multshiftround<int64_t, 40>(-3037000499ll, 3037000499ll) == -8388608ll, "multshiftround<int64_t, 40>(-3037000499, 3037000499) must be -8388608 at compile time");
+
+constexpr int16_t halves_i16[] = { multshiftround<int16_t, 1>(-3, 1), multshiftround<int16_t, 1>(-1, 1), multshiftround<int16_t, 1>(1, 1), multshiftround<int16_t, 1>(3, 1) };
+static_assert(halves_i16[0] == -2 && halves_i16[1] == -1 && halves_i16[2] == 1 && halves_i16[3] == 2, "compile time table of multshiftround<int16_t, 1>");
+
 /**
  * Setting the mul argument of multshiftround to 1 for various types.
  * This is for testing the shift and round portions of multshiftround.
@@ -12,12 +12,15 @@
  * int8_t, int16_t, int32_t, uint8_t, uint16_t, and uint32_t types.
  *
  * The coverage of the num input for 64-bit types is only partial in
- * order to acheive a reasonable test time, especially since the
- * extended precision floating point calculations required to test the
- * 64-bit routines are slow.
- * The num input tested with an increment of 2^35-1 across the
- * range of each 64-bit type for about 536,870,912 tests at every shift
- * value.
+ * order to acheive a reasonable test time.
+ * The num input tested with an increment of 2^30-1 across the
+ * range of each 64-bit type for about 17,179,869,184 tests at every shift
+ * value. The 64-bit results are checked against the exact integer
+ * reference functions in intmath_reference.hpp.
+ *
+ * The multithreaded 32-bit and 64-bit tests run as chunked jobs on the
+ * work-stealing pool in test_pool.hpp, which prints progress while they
+ * run and a per-job timing summary at the end.
  * 
  * Written in 2019 by Ben Tesch.
  * Originally distributed at https://github.com/slugrustle/numerical_routines
@@ -34,10 +37,7 @@
 #include <limits>
 #include <vector>
 #include <utility>
-#include <thread>
-#include <chrono>
 #include <mutex>
-#include <atomic>
 #include "multshiftround_run.hpp"
 #include "shiftround_run.hpp"
 
@@ -51,10 +51,8 @@
   }
 #endif
 
-#include <boost/multiprecision/cpp_bin_float.hpp>
-#include <boost/math/special_functions/round.hpp>
-
-typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<80, boost::multiprecision::backends::digit_base_2, void, boost::int16_t, -16382, 16383>, boost::multiprecision::et_off> cpp_bin_float_80;
+#include "intmath_reference.hpp"
+#include "test_pool.hpp"
 
 /**
  * Setting the mul argument of multshiftround to 1 for various types.
@@ -70,7 +68,6 @@ const double   dbl_mul_i16 = static_cast<double>(mul_i16);
 const int32_t  mul_i32 = 1;
 const double   dbl_mul_i32 = static_cast<double>(mul_i32);
 const int64_t  mul_i64 = 1ll;
-const cpp_bin_float_80 ldbl_mul_i64(mul_i64);
 const uint8_t  mul_u8 = 1u;
 const double   dbl_mul_u8 = static_cast<double>(mul_u8);
 const uint16_t mul_u16 = 1u;
@@ -78,17 +75,13 @@ const double   dbl_mul_u16 = static_cast<double>(mul_u16);
 const uint32_t mul_u32 = 1u;
 const double   dbl_mul_u32 = static_cast<double>(mul_u32);
 const uint64_t mul_u64 = 1ull;
-const cpp_bin_float_80 ldbl_mul_u64(mul_u64);
 
 /**
- * There is one atomic bool for each thread, set to true upon
- * thread initiation and set to false as the last computation 
- * in the thread.
- * This helps decide when to join a thread and replace it with
- * a new thread.
- * Plain C array because atomics don't have move or copy constructors.
+ * The 64-bit tests sweep num across the whole range of each type in
+ * steps of num_step_64, for num_steps_64 values of num.
  */
-std::atomic<bool> *thread_running;
+const uint64_t num_step_64 = (1ull << 30) - 1ull;
+const uint64_t num_steps_64 = std::numeric_limits<uint64_t>::max() / num_step_64 + 1ull;
 
 /**
  * Mutex for stdout when running multithreaded.
@@ -96,625 +89,337 @@ std::atomic<bool> *thread_running;
 std::mutex print_mutex;
 
 /**
- * Test c++ style runtime int32_t multshiftround for num on [-2147483648, 2147483647].
+ * Test c++ style runtime int32_t multshiftround for num = -2147483648 + index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 30.
  */
-void test_multshiftround_i32_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround<int32_t>(num, mul, %u)\n", shift);
-  }
-  
-  if (shift > 30u)
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("ERROR: multshiftround<int32_t>(num, mul, ?""?): invalid shift value %u\n", shift);
-  }
-  else
+void test_multshiftround_i32_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
+  double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
+  for (uint64_t index = first; index < last; index++)
   {
-    double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-    int32_t num = std::numeric_limits<int32_t>::lowest();
+    int32_t num = static_cast<int32_t>(static_cast<int64_t>(std::numeric_limits<int32_t>::lowest()) + static_cast<int64_t>(index));
     double dbl_num = static_cast<double>(num);
-    while (true)
-    {
-      int32_t ms_res = multshiftround<int32_t>(num, mul_i32, shift);
-      int32_t dbl_res = static_cast<int32_t>(std::round(dbl_num * dbl_mul_i32 * dbl_inv_twoexp));
-      if (ms_res != dbl_res) {
-        std::lock_guard<std::mutex> print_lock(print_mutex);
-        std::printf("ERROR: multshiftround<int32_t>(num, mul, %u): ms_res %i, dbl_res %i, dbl %.16f, num %i, mul %i\n", shift, ms_res, dbl_res, dbl_num * dbl_mul_i32 * dbl_inv_twoexp, num, mul_i32);
-      } 
-      if (num == std::numeric_limits<int32_t>::max()) break;
-      num++;
-      dbl_num += 1.0;
+    int32_t ms_res = multshiftround<int32_t>(num, mul_i32, shift);
+    int32_t dbl_res = static_cast<int32_t>(std::round(dbl_num * dbl_mul_i32 * dbl_inv_twoexp));
+    if (ms_res != dbl_res) {
+      std::lock_guard<std::mutex> print_lock(print_mutex);
+      std::printf("ERROR: multshiftround<int32_t>(num, mul, %u): ms_res %i, dbl_res %i, dbl %.16f, num %i, mul %i\n", shift, ms_res, dbl_res, dbl_num * dbl_mul_i32 * dbl_inv_twoexp, num, mul_i32);
     }
   }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround<int32_t>(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
-  }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime int32_t multshiftround for num on [-2147483648, 2147483647].
+ * Test c style runtime int32_t multshiftround for num = -2147483648 + index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 30.
  */
-void test_multshiftround_i32_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround_i32(num, mul, %u)\n", shift);
-  }
-
-  if (shift > 30u)
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("ERROR: multshiftround_i32(num, mul, ?""?): invalid shift value %u\n", shift);
-  }
-  else
+void test_multshiftround_i32_run_c(uint8_t shift, uint64_t first, uint64_t last) {
+  double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
+  for (uint64_t index = first; index < last; index++)
   {
-    double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-    int32_t num = std::numeric_limits<int32_t>::lowest();
+    int32_t num = static_cast<int32_t>(static_cast<int64_t>(std::numeric_limits<int32_t>::lowest()) + static_cast<int64_t>(index));
     double dbl_num = static_cast<double>(num);
-    while (true)
-    {
-      int32_t ms_res = multshiftround_i32(num, mul_i32, shift);
-      int32_t dbl_res = static_cast<int32_t>(std::round(dbl_num * dbl_mul_i32 * dbl_inv_twoexp));
-      if (ms_res != dbl_res) {
-        std::lock_guard<std::mutex> print_lock(print_mutex);
-        std::printf("ERROR: multshiftround_i32(num, mul, %i): ms_res %i, dbl_res %i, dbl %.16f, num %i, mul %i\n", shift, ms_res, dbl_res, dbl_num * dbl_mul_i32 * dbl_inv_twoexp, num, mul_i32);
-      }
-      if (num == std::numeric_limits<int32_t>::max()) break;
-      num++;
-      dbl_num += 1.0;
+    int32_t ms_res = multshiftround_i32(num, mul_i32, shift);
+    int32_t dbl_res = static_cast<int32_t>(std::round(dbl_num * dbl_mul_i32 * dbl_inv_twoexp));
+    if (ms_res != dbl_res) {
+      std::lock_guard<std::mutex> print_lock(print_mutex);
+      std::printf("ERROR: multshiftround_i32(num, mul, %i): ms_res %i, dbl_res %i, dbl %.16f, num %i, mul %i\n", shift, ms_res, dbl_res, dbl_num * dbl_mul_i32 * dbl_inv_twoexp, num, mul_i32);
     }
   }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround_i32(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
-  }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime int32_t shiftround for num on [-2147483648, 2147483647].
+ * Test c++ style runtime int32_t shiftround for num = -2147483648 + index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 30.
  */
-void test_shiftround_i32_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround<int32_t>(num, %u)\n", shift);
-  }
-
+void test_shiftround_i32_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
   double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-  int32_t num = std::numeric_limits<int32_t>::lowest();
-  double dbl_num = static_cast<double>(num);
-  while (true)
+  for (uint64_t index = first; index < last; index++)
   {
+    int32_t num = static_cast<int32_t>(static_cast<int64_t>(std::numeric_limits<int32_t>::lowest()) + static_cast<int64_t>(index));
+    double dbl_num = static_cast<double>(num);
     int32_t s_res = shiftround<int32_t>(num, shift);
     int32_t dbl_res = static_cast<int32_t>(std::round(dbl_num * dbl_inv_twoexp));
     if (s_res != dbl_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
       std::printf("ERROR: shiftround<int32_t>(num, %u): s_res %i, dbl_res %i, dbl %.16f, num %i\n", shift, s_res, dbl_res, dbl_num * dbl_inv_twoexp, num);
     }
-    if (num == std::numeric_limits<int32_t>::max()) break;
-    num++;
-    dbl_num += 1.0;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround<int32_t>(mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime int32_t shiftround for num on [-2147483648, 2147483647].
+ * Test c style runtime int32_t shiftround for num = -2147483648 + index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 30.
  */
-void test_shiftround_i32_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround_i32(num, %u)\n", shift);
-  }
-
+void test_shiftround_i32_run_c(uint8_t shift, uint64_t first, uint64_t last) {
   double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-  int32_t num = std::numeric_limits<int32_t>::lowest();
-  double dbl_num = static_cast<double>(num);
-  while (true)
+  for (uint64_t index = first; index < last; index++)
   {
+    int32_t num = static_cast<int32_t>(static_cast<int64_t>(std::numeric_limits<int32_t>::lowest()) + static_cast<int64_t>(index));
+    double dbl_num = static_cast<double>(num);
     int32_t s_res = shiftround_i32(num, shift);
     int32_t dbl_res = static_cast<int32_t>(std::round(dbl_num * dbl_inv_twoexp));
     if (s_res != dbl_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
       std::printf("ERROR: shiftround_i32(num, %u): s_res %i, dbl_res %i, dbl %.16f, num %i\n", shift, s_res, dbl_res, dbl_num * dbl_inv_twoexp, num);
     }
-    if (num == std::numeric_limits<int32_t>::max()) break;
-    num++;
-    dbl_num += 1.0;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround_i32(mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime uint32_t multshiftround for num on [0, 4294967295].
+ * Test c++ style runtime uint32_t multshiftround for num = index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 31.
  */
-void test_multshiftround_u32_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround<uint32_t>(num, mul, %u)\n", shift);
-  }
-
+void test_multshiftround_u32_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
   double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-  uint32_t num = std::numeric_limits<uint32_t>::lowest();
-  double dbl_num = static_cast<double>(num);
-  while (true)
+  for (uint64_t index = first; index < last; index++)
   {
+    uint32_t num = static_cast<uint32_t>(index);
+    double dbl_num = static_cast<double>(num);
     uint32_t ms_res = multshiftround<uint32_t>(num, mul_u32, shift);
     uint32_t dbl_res = static_cast<uint32_t>(std::round(dbl_num * dbl_mul_u32 * dbl_inv_twoexp));
     if (ms_res != dbl_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
       std::printf("ERROR: multshiftround<uint32_t>(num, mul, %u): ms_res %u, dbl_res %u, dbl %.16f, num %u, mul %u\n", shift, ms_res, dbl_res, dbl_num * dbl_mul_u32 * dbl_inv_twoexp, num, mul_u32);
     }
-    if (num == std::numeric_limits<uint32_t>::max()) break;
-    num++;
-    dbl_num += 1.0;
   }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround<uint32_t>(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
-  }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime uint32_t multshiftround for num on [0, 4294967295].
+ * Test c style runtime uint32_t multshiftround for num = index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 31.
  */
-void test_multshiftround_u32_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround_u32(num, mul, %u)\n", shift);
-  }
-
+void test_multshiftround_u32_run_c(uint8_t shift, uint64_t first, uint64_t last) {
   double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-  uint32_t num = std::numeric_limits<uint32_t>::lowest();
-  double dbl_num = static_cast<double>(num);
-  while (true)
+  for (uint64_t index = first; index < last; index++)
   {
+    uint32_t num = static_cast<uint32_t>(index);
+    double dbl_num = static_cast<double>(num);
     uint32_t ms_res = multshiftround_u32(num, mul_u32, shift);
     uint32_t dbl_res = static_cast<uint32_t>(std::round(dbl_num * dbl_mul_u32 * dbl_inv_twoexp));
     if (ms_res != dbl_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
       std::printf("ERROR: multshiftround_u32(num, mul, %u): ms_res %u, dbl_res %u, dbl %.16f, num %u, mul %u\n", shift, ms_res, dbl_res, dbl_num * dbl_mul_u32 * dbl_inv_twoexp, num, mul_u32);
     }
-    if (num == std::numeric_limits<uint32_t>::max()) break;
-    num++;
-    dbl_num += 1.0;
   }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround_u32(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
-  }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime uint32_t shiftround for num on [0, 4294967295].
+ * Test c++ style runtime uint32_t shiftround for num = index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 31.
  */
-void test_shiftround_u32_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround<uint32_t>(num, %u)\n", shift);
-  }
-    
+void test_shiftround_u32_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
   double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-  uint32_t num = std::numeric_limits<uint32_t>::lowest();
-  double dbl_num = static_cast<double>(num);
-  while (true)
+  for (uint64_t index = first; index < last; index++)
   {
+    uint32_t num = static_cast<uint32_t>(index);
+    double dbl_num = static_cast<double>(num);
     uint32_t s_res = shiftround<uint32_t>(num, shift);
     uint32_t dbl_res = static_cast<uint32_t>(std::round(dbl_num * dbl_inv_twoexp));
     if (s_res != dbl_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
       std::printf("ERROR: shiftround<uint32_t>(num, %u): s_res %u, dbl_res %u, dbl %.16f, num %u\n", shift, s_res, dbl_res, dbl_num * dbl_inv_twoexp, num);
     }
-    if (num == std::numeric_limits<uint32_t>::max()) break;
-    num++;
-    dbl_num += 1.0;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround<uint32_t>(num, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime uint32_t shiftround for num on [0, 4294967295].
+ * Test c style runtime uint32_t shiftround for num = index
+ * with index on [first, last). index on [0, 4294967296) covers every num.
  * shift should range from 0 to 31.
  */
-void test_shiftround_u32_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround_u32(num, %u)\n", shift);
-  }
-
+void test_shiftround_u32_run_c(uint8_t shift, uint64_t first, uint64_t last) {
   double dbl_inv_twoexp = 1.0 / static_cast<double>(1ull << shift);
-  uint32_t num = std::numeric_limits<uint32_t>::lowest();
-  double dbl_num = static_cast<double>(num);
-  while (true)
+  for (uint64_t index = first; index < last; index++)
   {
+    uint32_t num = static_cast<uint32_t>(index);
+    double dbl_num = static_cast<double>(num);
     uint32_t s_res = shiftround_u32(num, shift);
     uint32_t dbl_res = static_cast<uint32_t>(std::round(dbl_num * dbl_inv_twoexp));
     if (s_res != dbl_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
       std::printf("ERROR: shiftround_u32(num, %u): s_res %u, dbl_res %u, dbl %.16f, num %u\n", shift, s_res, dbl_res, dbl_num * dbl_inv_twoexp, num);
     }
-    if (num == std::numeric_limits<uint32_t>::max()) break;
-    num++;
-    dbl_num += 1.0;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround_u32(num, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime int64_t multshiftround for num on
- * [-9223372036854775808, 9223372036854775807]
- * in steps of 34359738367 for approximately 536,870,912 tests.
+ * Test c++ style runtime int64_t multshiftround for
+ * num = -9223372036854775808 + index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of int64_t in steps of num_step_64.
  * shift should range from 0 to 62.
  */
-void test_multshiftround_i64_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround<int64_t>(num, mul, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  int64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  int64_t num = std::numeric_limits<int64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_multshiftround_i64_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    int64_t num = static_cast<int64_t>(static_cast<uint64_t>(std::numeric_limits<int64_t>::lowest()) + index * num_step_64);
     int64_t ms_res = multshiftround<int64_t>(num, mul_i64, shift);
-    int64_t dbl_res = boost::math::round(ldbl_num * ldbl_mul_i64 * ldbl_inv_twoexp).convert_to<int64_t>();
-    if (ms_res != dbl_res) {
+    int64_t ref_res = reference_multshiftround<int64_t>(num, mul_i64, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: multshiftround<int64_t>(num, mul, %u): ms_res %" PRIi64 ", dbl_res %" PRIi64 ", dbl %.16f, num %" PRIi64 ", mul %" PRIi64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_mul_i64 * ldbl_inv_twoexp).convert_to<double>(), num, mul_i64);
+      std::printf("ERROR: multshiftround<int64_t>(num, mul, %u): ms_res %" PRIi64 ", ref_res %" PRIi64 ", num %" PRIi64 ", mul %" PRIi64 "\n", shift, ms_res, ref_res, num, mul_i64);
     }
-    if (num > 0ll && std::numeric_limits<int64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
   }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround<int64_t>(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
-  }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime int64_t multshiftround for num on
- * [-9223372036854775808, 9223372036854775807]
- * in steps of 34359738367 for approximately 536,870,912 tests.
+ * Test c style runtime int64_t multshiftround for
+ * num = -9223372036854775808 + index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of int64_t in steps of num_step_64.
  * shift should range from 0 to 62.
  */
-void test_multshiftround_i64_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround_i64(num, mul, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  int64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  int64_t num = std::numeric_limits<int64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_multshiftround_i64_run_c(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    int64_t num = static_cast<int64_t>(static_cast<uint64_t>(std::numeric_limits<int64_t>::lowest()) + index * num_step_64);
     int64_t ms_res = multshiftround_i64(num, mul_i64, shift);
-    int64_t dbl_res = boost::math::round(ldbl_num * ldbl_mul_i64 * ldbl_inv_twoexp).convert_to<int64_t>();
-    if (ms_res != dbl_res) {
+    int64_t ref_res = reference_multshiftround<int64_t>(num, mul_i64, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: multshiftround_i64(num, mul, %u): ms_res %" PRIi64 ", dbl_res %" PRIi64 ", dbl %.16f, num %" PRIi64 ", mul %" PRIi64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_mul_i64 * ldbl_inv_twoexp).convert_to<double>(), num, mul_i64);
+      std::printf("ERROR: multshiftround_i64(num, mul, %u): ms_res %" PRIi64 ", ref_res %" PRIi64 ", num %" PRIi64 ", mul %" PRIi64 "\n", shift, ms_res, ref_res, num, mul_i64);
     }
-    if (num > 0ll && std::numeric_limits<int64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround_i64(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime int64_t shiftround for num on
- * [-9223372036854775808, 9223372036854775807]
- * in steps of 34359738367 for approximately 536,870,912 tests.
+ * Test c++ style runtime int64_t shiftround for
+ * num = -9223372036854775808 + index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of int64_t in steps of num_step_64.
  * shift should range from 0 to 62.
  */
-void test_shiftround_i64_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround<int64_t>(num, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  int64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  int64_t num = std::numeric_limits<int64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_shiftround_i64_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    int64_t num = static_cast<int64_t>(static_cast<uint64_t>(std::numeric_limits<int64_t>::lowest()) + index * num_step_64);
     int64_t ms_res = shiftround<int64_t>(num, shift);
-    int64_t dbl_res = boost::math::round(ldbl_num * ldbl_inv_twoexp).convert_to<int64_t>();
-    if (ms_res != dbl_res) {
+    int64_t ref_res = reference_shiftround<int64_t>(num, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: shiftround<int64_t>(num, %u): ms_res %" PRIi64 ", dbl_res %" PRIi64 ", dbl %.16f, num %" PRIi64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_inv_twoexp).convert_to<double>(), num);
+      std::printf("ERROR: shiftround<int64_t>(num, %u): ms_res %" PRIi64 ", ref_res %" PRIi64 ", num %" PRIi64 "\n", shift, ms_res, ref_res, num);
     }
-    if (num > 0ll && std::numeric_limits<int64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround<int64_t>(num, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime int64_t shiftround for num on
- * [-9223372036854775808, 9223372036854775807]
- * in steps of 34359738367 for approximately 536,870,912 tests.
+ * Test c style runtime int64_t shiftround for
+ * num = -9223372036854775808 + index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of int64_t in steps of num_step_64.
  * shift should range from 0 to 62.
  */
-void test_shiftround_i64_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround<int64_t>(num, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  int64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  int64_t num = std::numeric_limits<int64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_shiftround_i64_run_c(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    int64_t num = static_cast<int64_t>(static_cast<uint64_t>(std::numeric_limits<int64_t>::lowest()) + index * num_step_64);
     int64_t ms_res = shiftround_i64(num, shift);
-    int64_t dbl_res = boost::math::round(ldbl_num * ldbl_inv_twoexp).convert_to<int64_t>();
-    if (ms_res != dbl_res) {
+    int64_t ref_res = reference_shiftround<int64_t>(num, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: shiftround_i64(num, %i): ms_res %" PRIi64 ", dbl_res %" PRIi64 ", dbl %.16f, num %" PRIi64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_inv_twoexp).convert_to<double>(), num);
+      std::printf("ERROR: shiftround_i64(num, %i): ms_res %" PRIi64 ", ref_res %" PRIi64 ", num %" PRIi64 "\n", shift, ms_res, ref_res, num);
     }
-    if (num > 0ll && std::numeric_limits<int64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
   }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround_i64(num, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
-  }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime uint64_t multshiftround for num on
- * [0, 18446744073709551615] in steps of 34359738367 for
- * approximately 536,870,912 tests.
+ * Test c++ style runtime uint64_t multshiftround for
+ * num = index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of uint64_t in steps of num_step_64.
  * shift should range from 0 to 63.
  */
-void test_multshiftround_u64_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround<uint64_t>(num, mul, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  uint64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  uint64_t num = std::numeric_limits<uint64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_multshiftround_u64_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    uint64_t num = index * num_step_64;
     uint64_t ms_res = multshiftround<uint64_t>(num, mul_u64, shift);
-    uint64_t dbl_res = boost::math::round(ldbl_num * ldbl_mul_u64 * ldbl_inv_twoexp).convert_to<uint64_t>();
-    if (ms_res != dbl_res) {
+    uint64_t ref_res = reference_multshiftround<uint64_t>(num, mul_u64, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: multshiftround<uint64_t>(num, mul, %u): ms_res %" PRIu64 ", dbl_res %" PRIu64 ", dbl %.16f, num %" PRIu64 ", mul %" PRIu64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_mul_u64 * ldbl_inv_twoexp).convert_to<double>(), num, mul_u64);
+      std::printf("ERROR: multshiftround<uint64_t>(num, mul, %u): ms_res %" PRIu64 ", ref_res %" PRIu64 ", num %" PRIu64 ", mul %" PRIu64 "\n", shift, ms_res, ref_res, num, mul_u64);
     }
-    if (std::numeric_limits<uint64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround<uint64_t>(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime uint64_t multshiftround for num on
- * [0, 18446744073709551615] in steps of 34359738367 for
- * approximately 536,870,912 tests.
+ * Test c style runtime uint64_t multshiftround for
+ * num = index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of uint64_t in steps of num_step_64.
  * shift should range from 0 to 63.
  */
-void test_multshiftround_u64_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing multshiftround_u64(num, mul, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  uint64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  uint64_t num = std::numeric_limits<uint64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_multshiftround_u64_run_c(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    uint64_t num = index * num_step_64;
     uint64_t ms_res = multshiftround_u64(num, mul_u64, shift);
-    uint64_t dbl_res = boost::math::round(ldbl_num * ldbl_mul_u64 * ldbl_inv_twoexp).convert_to<uint64_t>();
-    if (ms_res != dbl_res) {
+    uint64_t ref_res = reference_multshiftround<uint64_t>(num, mul_u64, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: multshiftround_u64(num, mul, %u): ms_res %" PRIu64 ", dbl_res %" PRIu64 ", dbl %.16f, num %" PRIu64 ", mul %" PRIu64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_mul_u64 * ldbl_inv_twoexp).convert_to<double>(), num, mul_u64);
+      std::printf("ERROR: multshiftround_u64(num, mul, %u): ms_res %" PRIu64 ", ref_res %" PRIu64 ", num %" PRIu64 ", mul %" PRIu64 "\n", shift, ms_res, ref_res, num, mul_u64);
     }
-    if (std::numeric_limits<uint64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  multshiftround_u64(num, mul, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c++ style runtime uint64_t shiftround for num on
- * [0, 18446744073709551615] in steps of 34359738367 for
- * approximately 536,870,912 tests.
+ * Test c++ style runtime uint64_t shiftround for
+ * num = index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of uint64_t in steps of num_step_64.
  * shift should range from 0 to 63.
  */
-void test_shiftround_u64_run_cpp(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround<uint64_t>(num, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  uint64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  uint64_t num = std::numeric_limits<uint64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_shiftround_u64_run_cpp(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    uint64_t num = index * num_step_64;
     uint64_t ms_res = shiftround<uint64_t>(num, shift);
-    uint64_t dbl_res = boost::math::round(ldbl_num * ldbl_inv_twoexp).convert_to<uint64_t>();
-    if (ms_res != dbl_res) {
+    uint64_t ref_res = reference_shiftround<uint64_t>(num, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: shiftround<uint64_t>(num, %u): ms_res %" PRIu64 ", dbl_res %" PRIu64 ", dbl %.16f, num %" PRIu64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_inv_twoexp).convert_to<double>(), num);
+      std::printf("ERROR: shiftround<uint64_t>(num, %u): ms_res %" PRIu64 ", ref_res %" PRIu64 ", num %" PRIu64 "\n", shift, ms_res, ref_res, num);
     }
-    if (std::numeric_limits<uint64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
-  }
-
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround<uint64_t>(num, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
   }
-
-  thread_running[thread_index].store(false);
 }
 
 /**
- * Test c style runtime uint64_t shiftround for num on
- * [0, 18446744073709551615] in steps of 34359738367 for
- * approximately 536,870,912 tests.
+ * Test c style runtime uint64_t shiftround for
+ * num = index * num_step_64
+ * with index on [first, last). index on [0, num_steps_64) covers the
+ * whole range of uint64_t in steps of num_step_64.
  * shift should range from 0 to 63.
  */
-void test_shiftround_u64_run_c(uint8_t shift, size_t thread_index) {
-  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("testing shiftround_u64(num, %u)\n", shift);
-  }
-
-  cpp_bin_float_80 ldbl_inv_twoexp = cpp_bin_float_80(1.0) / cpp_bin_float_80(1ull << shift);
-  uint64_t increment = (1ll << 35) - 1ll;
-  cpp_bin_float_80 ldbl_increment(increment);
-  uint64_t num = std::numeric_limits<uint64_t>::lowest();
-  cpp_bin_float_80 ldbl_num(num);
-  while (true)
+void test_shiftround_u64_run_c(uint8_t shift, uint64_t first, uint64_t last) {
+  for (uint64_t index = first; index < last; index++)
   {
+    uint64_t num = index * num_step_64;
     uint64_t ms_res = shiftround_u64(num, shift);
-    uint64_t dbl_res = boost::math::round(ldbl_num * ldbl_inv_twoexp).convert_to<uint64_t>();
-    if (ms_res != dbl_res) {
+    uint64_t ref_res = reference_shiftround<uint64_t>(num, shift);
+    if (ms_res != ref_res) {
       std::lock_guard<std::mutex> print_lock(print_mutex);
-      std::printf("ERROR: shiftround_u64(num, %u): ms_res %" PRIu64 ", dbl_res %" PRIu64 ", dbl %.16f, num %" PRIu64 "\n", shift, ms_res, dbl_res, (ldbl_num * ldbl_inv_twoexp).convert_to<double>(), num);
+      std::printf("ERROR: shiftround_u64(num, %u): ms_res %" PRIu64 ", ref_res %" PRIu64 ", num %" PRIu64 "\n", shift, ms_res, ref_res, num);
     }
-    if (std::numeric_limits<uint64_t>::max() - num < increment) break;
-    num += increment;
-    ldbl_num += ldbl_increment;
   }
+}
 
-  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
-  {
-    std::lock_guard<std::mutex> print_lock(print_mutex);
-    std::printf("  shiftround_u64(num, %u) took %" PRIu64 " ms\n", shift, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+/**
+ * Adds one pool job per shift value on [0, max_shift] for a test function
+ * taking (shift, first, last). name is a printf format for the job name
+ * with a %u for the shift value. Every job is split into chunks of
+ * 2^24 tests, which take well under a second each.
+ */
+void add_shift_jobs(test_pool &pool, const char *name, void (*test)(uint8_t, uint64_t, uint64_t), const unsigned max_shift, const uint64_t count) {
+  for (unsigned shift = 0u; shift <= max_shift; shift++) {
+    char job_name[64];
+    std::snprintf(job_name, sizeof(job_name), name, shift);
+    pool.add_job(job_name, count, 1ull << 24, [test, shift](uint64_t first, uint64_t last) { test(static_cast<uint8_t>(shift), first, last); });
   }
-
-  thread_running[thread_index].store(false);
 }
 
 int main()
@@ -869,6 +574,21 @@ int main()
     if (msr_u64 != result) std::printf("\nERROR: multshiftround<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u) returned %" PRIu64 ". expected %" PRIu64 ".\n\n", num, mul, shift, msr_u64, result);
   }
   
+  /**
+   * The rounding bit must be taken from the product rather than from num.
+   * With num = 1 and mul = 2^(shift-1), only the product has it set.
+   */
+  for (uint8_t shift = 1u; shift <= 63u; shift++) {
+    uint64_t num = 1ull;
+    uint64_t mul = 1ull << (shift - 1u);
+
+    msr_u64 = multshiftround_u64(num, mul, shift);
+    if (msr_u64 != 1ull) std::printf("\nERROR: multshiftround_u64(%" PRIu64 ", %" PRIu64 ", %u) returned %" PRIu64 ". expected 1.\n\n", num, mul, shift, msr_u64);
+
+    msr_u64 = multshiftround<uint64_t>(num, mul, shift);
+    if (msr_u64 != 1ull) std::printf("\nERROR: multshiftround<uint64_t>(%" PRIu64 ", %" PRIu64 ", %u) returned %" PRIu64 ". expected 1.\n\n", num, mul, shift, msr_u64);
+  }
+  
   std::printf("Multiplication tests finished.\n\n");
   
   std::printf("Running quick tests of rounding operation in multshiftround and shiftround routines.\n");
@@ -1574,133 +1294,30 @@ int main()
   std::printf("\n");
 
   /**
-   * vTests stores the list of tests to run multithreaded.
-   * The first pair element function pointer should point to one of the 
-   * test_...(uint8_t shift, size_t thread_index) functions.
-   * The second pair element uint8_t is the shift argument value to use
-   * when running the test.
-   */
-  std::vector<std::pair<void (*)(uint8_t, size_t), uint8_t> > vTests;
-
-  /**
-   * Queue all the tests that will be run multithreaded.
-   */
-  for (uint8_t shift = 0u; shift <= 63u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_u64_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 63u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_u64_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 63u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_u64_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 63u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_u64_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 62u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_i64_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 62u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_i64_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 62u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_i64_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 62u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_i64_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 31u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_u32_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 31u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_u32_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 31u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_u32_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 31u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_u32_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 30u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_i32_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 30u; shift++)
-    vTests.push_back(std::make_pair(test_shiftround_i32_run_c, shift));
-
-  for (uint8_t shift = 0u; shift <= 30u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_i32_run_cpp, shift));
-
-  for (uint8_t shift = 0u; shift <= 30u; shift++)
-    vTests.push_back(std::make_pair(test_multshiftround_i32_run_c, shift));
-
-  /**
-   * Use one thread if only one hardware thread is available. Otherwise, use
-   * one less than the number of available hardware threads.
-   */
-  uint32_t nThreads = std::thread::hardware_concurrency();
-  if (nThreads <= 2u) nThreads = 1u;
-  else nThreads--;
-
-  std::printf("Starting multithreaded tests with %u threads.\n\n", nThreads);
-
-  /**
-   * Allocate and initialize the atomic bools for checking
-   * when threads are done running tests.
-   */
-  thread_running = new std::atomic<bool>[nThreads];
-  for (uint32_t jThread = 0u; jThread < nThreads; jThread++) {
-    thread_running[jThread].store(false);
-  }
-
-  /**
-   * Start all threads running with some test.
-   */
-  std::vector<std::thread> vThreads;
-  for (uint32_t jThread = 0u; jThread < nThreads && !vTests.empty(); jThread++) {
-    thread_running[jThread].store(true);
-    vThreads.push_back(std::move(std::thread(vTests.back().first, vTests.back().second, jThread)));
-    vTests.pop_back();
-  }
-
-  while (!vTests.empty()) {
-    /**
-     * Replace finished threads with new ones until there are no more
-     * tests to run.
-     */
-    for (size_t jThread = 0ull; jThread < vThreads.size() && !vTests.empty(); jThread++) {
-      if (!thread_running[jThread].load() && vThreads.at(jThread).joinable()) {
-        vThreads.at(jThread).join();
-        thread_running[jThread].store(true);
-        vThreads.at(jThread) = std::move(std::thread(vTests.back().first, vTests.back().second, jThread));
-        vTests.pop_back();
-      }
-    }
-    /**
-     * Sleep so as not to spam the CPU.
-     */
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-  }
-
-  /**
-   * Wait until all threads are finished.
+   * Queue every multithreaded test as one pool job per function and
+   * shift value, then run them all on every hardware thread.
    */
-  bool any_joinable = true;
-  while (any_joinable) {
-    any_joinable = false;
-    for (size_t jThread = 0ull; jThread < vThreads.size(); jThread++) {
-      if (vThreads.at(jThread).joinable()) {
-        any_joinable = true;
-        if (!thread_running[jThread].load())
-          vThreads.at(jThread).join();
-      }
-    }
-    /**
-     * Sleep so as not to spam the CPU.
-     */
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-  }
-
-  delete[] thread_running;
+  test_pool pool(print_mutex);
+  std::printf("Starting multithreaded tests with %u threads.\n\n", pool.threads());
+
+  add_shift_jobs(pool, "shiftround<uint64_t>(num, %u)", test_shiftround_u64_run_cpp, 63u, num_steps_64);
+  add_shift_jobs(pool, "shiftround_u64(num, %u)", test_shiftround_u64_run_c, 63u, num_steps_64);
+  add_shift_jobs(pool, "multshiftround<uint64_t>(num, mul, %u)", test_multshiftround_u64_run_cpp, 63u, num_steps_64);
+  add_shift_jobs(pool, "multshiftround_u64(num, mul, %u)", test_multshiftround_u64_run_c, 63u, num_steps_64);
+  add_shift_jobs(pool, "shiftround<int64_t>(num, %u)", test_shiftround_i64_run_cpp, 62u, num_steps_64);
+  add_shift_jobs(pool, "shiftround_i64(num, %u)", test_shiftround_i64_run_c, 62u, num_steps_64);
+  add_shift_jobs(pool, "multshiftround<int64_t>(num, mul, %u)", test_multshiftround_i64_run_cpp, 62u, num_steps_64);
+  add_shift_jobs(pool, "multshiftround_i64(num, mul, %u)", test_multshiftround_i64_run_c, 62u, num_steps_64);
+  add_shift_jobs(pool, "shiftround<uint32_t>(num, %u)", test_shiftround_u32_run_cpp, 31u, 1ull << 32);
+  add_shift_jobs(pool, "shiftround_u32(num, %u)", test_shiftround_u32_run_c, 31u, 1ull << 32);
+  add_shift_jobs(pool, "multshiftround<uint32_t>(num, mul, %u)", test_multshiftround_u32_run_cpp, 31u, 1ull << 32);
+  add_shift_jobs(pool, "multshiftround_u32(num, mul, %u)", test_multshiftround_u32_run_c, 31u, 1ull << 32);
+  add_shift_jobs(pool, "shiftround<int32_t>(num, %u)", test_shiftround_i32_run_cpp, 30u, 1ull << 32);
+  add_shift_jobs(pool, "shiftround_i32(num, %u)", test_shiftround_i32_run_c, 30u, 1ull << 32);
+  add_shift_jobs(pool, "multshiftround<int32_t>(num, mul, %u)", test_multshiftround_i32_run_cpp, 30u, 1ull << 32);
+  add_shift_jobs(pool, "multshiftround_i32(num, mul, %u)", test_multshiftround_i32_run_c, 30u, 1ull << 32);
+
+  pool.run();
 
   std::printf("\nFinished running multithreaded code.\n\n");
   std::printf("\n");
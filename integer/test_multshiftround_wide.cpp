@@ -0,0 +1,298 @@
+/**
+ * test_multshiftround_wide.cpp
+ * Tests
+ *   int64_t multshiftround_wide_i64(const int64_t num, const int64_t mul, const uint8_t shift);
+ *   uint64_t multshiftround_wide_u64(const uint64_t num, const uint64_t mul, const uint8_t shift);
+ *   type multshiftround_wide<typename type>(const type num, const type mul, const uint8_t shift);
+ *   type multshiftround_wide<typename type, uint8_t shift>(const type num, const type mul);
+ * for int64_t and uint64_t against an exact reference computed with
+ * boost::multiprecision::cpp_int.
+ *
+ * For every valid shift, the tests cover num from the special_values in
+ * test_values.hpp (values near 0, the powers of two, and the type limits,
+ * plus random values of random bit length) against every mul_stride-th of
+ * the same values, and products that land exactly on a rounding tie.
+ * Only products whose rounded result fits in 64 bits are compared,
+ * because the result is unspecified otherwise. Invalid runtime shift
+ * arguments must return 0.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <utility>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "multshiftround_wide.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "multshiftround_wide.h"
+#ifdef __cplusplus
+  }
+#endif
+
+typedef boost::multiprecision::cpp_int big_int;
+
+const size_t random_values = 64u;
+
+/* mul takes every mul_stride-th of the num values. */
+const size_t mul_stride = 8u;
+
+uint64_t error_count = 0u;
+uint64_t test_count = 0u;
+
+/**
+ * Stores ROUND((num * mul) / 2^shift), rounding half away from zero, in
+ * *result and returns true if it fits in type.
+ */
+template <typename type> bool reference(const type num, const type mul, const uint8_t shift, type *result) {
+  const big_int prod = big_int(num) * big_int(mul);
+  big_int magnitude = abs(prod);
+  if (shift > 0u) magnitude = (magnitude + (big_int(1) << (shift - 1u))) >> shift;
+  const big_int rounded = (prod < 0) ? big_int(-magnitude) : magnitude;
+  if (rounded < big_int(std::numeric_limits<type>::min()) || rounded > big_int(std::numeric_limits<type>::max())) return false;
+  *result = rounded.template convert_to<type>();
+  return true;
+}
+
+/**
+ * Compares the C function and the runtime template for one input.
+ */
+template <typename type> void check_runtime(const char *type_name, const type num, const type mul, const uint8_t shift) {
+  type expected;
+  if (!reference<type>(num, mul, shift, &expected)) return;
+
+  type c_result;
+  if (std::numeric_limits<type>::is_signed) c_result = static_cast<type>(multshiftround_wide_i64(static_cast<int64_t>(num), static_cast<int64_t>(mul), shift));
+  else c_result = static_cast<type>(multshiftround_wide_u64(static_cast<uint64_t>(num), static_cast<uint64_t>(mul), shift));
+  const type cpp_result = multshiftround_wide<type>(num, mul, shift);
+  test_count++;
+
+  if (c_result != expected) report_error<type>(error_count, type_name, "multshiftround_wide_X", {num, mul, static_cast<type>(shift)}, c_result, expected);
+  if (cpp_result != expected) report_error<type>(error_count, type_name, "multshiftround_wide", {num, mul, static_cast<type>(shift)}, cpp_result, expected);
+}
+
+/**
+ * Returns every special value of type as num against every mul_stride-th
+ * of them as mul.
+ */
+template <typename type> std::vector<std::pair<type, type>> value_pairs(std::mt19937_64 &rng) {
+  const std::vector<type> values = special_values<type>(random_values, rng, true);
+  std::vector<std::pair<type, type>> pairs;
+  for (type num : values) {
+    for (size_t j = 0u; j < values.size(); j += mul_stride) pairs.push_back(std::make_pair(num, values[j]));
+  }
+  return pairs;
+}
+
+/**
+ * Tests one type at every valid runtime shift.
+ */
+template <typename type> void test_runtime(const char *type_name, const uint8_t max_shift, std::mt19937_64 &rng) {
+  std::printf("Testing multshiftround_wide<%s>(num, mul, shift) and the C function\n", type_name);
+  const std::vector<std::pair<type, type>> pairs = value_pairs<type>(rng);
+
+  for (unsigned int shift = 0u; shift <= max_shift; shift++) {
+    for (const std::pair<type, type> &pair : pairs) check_runtime<type>(type_name, pair.first, pair.second, static_cast<uint8_t>(shift));
+
+    /* Exact ties: num * mul = (2k + 1) * 2^(shift - 1). */
+    if (shift > 0u && shift <= 64u) {
+      const type half = static_cast<type>(static_cast<type>(1) << ((shift - 1u) % 63u));
+      for (int k = 0; k < 8; k++) {
+        const type odd = static_cast<type>(2 * k + 1);
+        if (shift - 1u <= 62u) {
+          check_runtime<type>(type_name, odd, half, static_cast<uint8_t>(shift));
+          if (std::numeric_limits<type>::is_signed) check_runtime<type>(type_name, static_cast<type>(-odd), half, static_cast<uint8_t>(shift));
+        }
+      }
+    }
+  }
+
+  for (unsigned int shift = max_shift + 1u; shift <= 255u; shift++) {
+    test_count++;
+    if (multshiftround_wide<type>(static_cast<type>(12345), static_cast<type>(6789), static_cast<uint8_t>(shift)) != 0) {
+      error_count++;
+      std::printf("\nERROR: multshiftround_wide<%s>(12345, 6789, %u) did not return 0 for an invalid shift.\n\n", type_name, shift);
+    }
+  }
+}
+
+/**
+ * Compares the compile time form for one shift against the runtime form,
+ * which test_runtime has already checked against the reference.
+ */
+template <typename type, uint8_t shift> void check_comp(const char *type_name, const std::vector<std::pair<type, type>> &pairs) {
+  char template_arguments[32];
+  std::snprintf(template_arguments, sizeof(template_arguments), "%s, %u", type_name, shift);
+  for (const std::pair<type, type> &pair : pairs) {
+    const type expected = multshiftround_wide<type>(pair.first, pair.second, shift);
+    const type result = multshiftround_wide<type, shift>(pair.first, pair.second);
+    test_count++;
+    if (result != expected) report_error<type>(error_count, template_arguments, "multshiftround_wide", {pair.first, pair.second}, result, expected);
+  }
+}
+
+template <typename type, int... shifts> void test_comp(const char *type_name, std::integer_sequence<int, shifts...>, std::mt19937_64 &rng) {
+  std::printf("Testing multshiftround_wide<%s, shift>(num, mul)\n", type_name);
+  const std::vector<std::pair<type, type>> pairs = value_pairs<type>(rng);
+  const int expand[] = {0, (check_comp<type, static_cast<uint8_t>(shifts)>(type_name, pairs), 0)...};
+  (void)expand;
+}
+
+int main() {
+  std::mt19937_64 rng(0x3D1Du);
+
+  test_runtime<int64_t>("int64_t", 126u, rng);
+  test_runtime<uint64_t>("uint64_t", 127u, rng);
+  test_comp<int64_t>("int64_t", std::make_integer_sequence<int, 127>(), rng);
+  test_comp<uint64_t>("uint64_t", std::make_integer_sequence<int, 128>(), rng);
+
+  /* A Q0.64 scale factor whose product with num overflows 64 bits. */
+  const uint64_t scaled = multshiftround_wide<uint64_t, 64>(1000000000000ull, 0xB504F333F9DE6484ull);
+  test_count++;
+  if (scaled != 707106781187ull) {
+    error_count++;
+    std::printf("\nERROR: multshiftround_wide<uint64_t, 64>(1000000000000, sqrt(0.5) in Q0.64) = %" PRIu64 ", expected 707106781187.\n\n", scaled);
+  }
+
+  std::printf("\n%" PRIu64 " tests complete. %" PRIu64 " errors.\n", test_count, error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,365 @@
+/**
+ * test_optimal_pow2_rational.cpp
+ * Unit tests for the search and parsing functions in
+ * optimal_pow2_rational.hpp.
+ *
+ * pow2_rational_parse_number is checked against a table of accepted and
+ * rejected strings.
+ *
+ * pow2_rational_search is checked two ways. For a set of specifications
+ * with integer ranges and ratio fractions, mul, shift, and the narrowest
+ * type must equal those that multshiftround_select.hpp computes at compile
+ * time with its own fixed width arithmetic. For pseudorandom
+ * specifications, the result is checked against the criterion as
+ * optimal_pow2_rational.cpp used to state it: the errors at both ends of
+ * the range are formed separately, every smaller shift must fail, the
+ * found shift must pass, worst_error must be the larger end point error,
+ * and each product class and the narrowest type are recomputed from the
+ * limits in std::numeric_limits.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <random>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include "optimal_pow2_rational.hpp"
+#include "multshiftround_select.hpp"
+
+uint64_t test_count = 0u;
+uint64_t error_count = 0u;
+const uint64_t max_printed_errors = 16u;
+
+void check(const bool passed, const std::string &what) {
+  test_count++;
+  if (passed) return;
+  error_count++;
+  if (error_count <= max_printed_errors) std::printf("\nERROR: %s\n\n", what.c_str());
+}
+
+std::string describe(const pow2_rational_spec &spec) {
+  std::string text("[" + spec.range_min.str() + ", " + spec.range_max.str() + "] * ");
+  text += numerator(spec.fraction).str() + "/" + denominator(spec.fraction).str() + " to within ";
+  text += numerator(spec.max_error).str() + "/" + denominator(spec.max_error).str();
+  return text;
+}
+
+/********************************************************************************
+ ********                            parsing                             ********
+ ********************************************************************************/
+
+void check_parse(const char *text, const bool accepted, const int64_t num = 0, const int64_t den = 1) {
+  pow2_rational value;
+  const bool parsed = pow2_rational_parse_number(text, value);
+  check(parsed == accepted && (!parsed || value == pow2_rational(num, den)), std::string("pow2_rational_parse_number(\"") + text + "\")");
+}
+
+void test_parse(void) {
+  check_parse("0", true, 0);
+  check_parse("4095", true, 4095);
+  check_parse("-32768", true, -32768);
+  check_parse("+7", true, 7);
+  check_parse("0.1", true, 1, 10);
+  check_parse(".5", true, 1, 2);
+  check_parse("5.", true, 5);
+  check_parse("-0.125", true, -1, 8);
+  check_parse("1.5e-3", true, 3, 2000);
+  check_parse("1E3", true, 1000);
+  check_parse("2.5e+2", true, 250);
+  check_parse("3300/4095", true, 3300, 4095);
+  check_parse("1/0.3", true, 10, 3);
+  check_parse("-1/-2", true, 1, 2);
+  check_parse("", false);
+  check_parse(".", false);
+  check_parse("-", false);
+  check_parse("abc", false);
+  check_parse("1e", false);
+  check_parse("1e12345", false);
+  check_parse(" 1", false);
+  check_parse("1 ", false);
+  check_parse("1/0", false);
+  check_parse("1/", false);
+  check_parse("1/2/3", false);
+  check_parse("0x10", false);
+
+  pow2_int value;
+  check(pow2_rational_parse_integer("1e3", value) && value == 1000, "pow2_rational_parse_integer(\"1e3\")");
+  check(!pow2_rational_parse_integer("2.5", value), "pow2_rational_parse_integer(\"2.5\")");
+  check(pow2_rational_parse_integer("18446744073709551615", value) && value == pow2_int_type_max(POW2_UINT64), "pow2_rational_parse_integer(\"18446744073709551615\")");
+
+  pow2_rational_spec spec(0, 10, pow2_rational(1, 3));
+  check(pow2_rational_check(spec) == NULL, "pow2_rational_check accepted spec");
+  spec.range_min = 11;
+  check(pow2_rational_check(spec) != NULL, "pow2_rational_check range_max < range_min");
+  spec.range_min = pow2_int_type_lowest(POW2_INT64) - 1;
+  check(pow2_rational_check(spec) != NULL, "pow2_rational_check range_min < -2^63");
+  spec.range_min = 0;
+  spec.fraction = -1;
+  check(pow2_rational_check(spec) != NULL, "pow2_rational_check negative fraction");
+}
+
+/********************************************************************************
+ ********              agreement with multshiftround_select              ********
+ ********************************************************************************/
+
+template <typename type> pow2_int_type int_type_of(void) {
+  return static_cast<pow2_int_type>((sizeof(type) == 1u ? 0 : sizeof(type) == 2u ? 2 : sizeof(type) == 4u ? 4 : 6) + (std::is_signed<type>::value ? 0 : 1));
+}
+
+template <int64_t range_min, int64_t range_max, uint64_t frac_num, uint64_t frac_den, uint64_t err_num, uint64_t err_den> void check_select(void) {
+  typedef multshiftround_select<range_min, range_max, frac_num, frac_den, err_num, err_den> select;
+  const pow2_rational_spec spec(range_min, range_max, pow2_rational(pow2_int(frac_num), pow2_int(frac_den)), pow2_rational(pow2_int(err_num), pow2_int(err_den)));
+  const pow2_rational_result result = pow2_rational_search(spec);
+  check(result.found && result.shift == select::shift && result.mul == static_cast<uint64_t>(select::mul) && result.narrowest == int_type_of<typename select::type>(),
+        "pow2_rational_search disagrees with multshiftround_select for " + describe(spec));
+}
+
+void test_select(void) {
+  check_select<0, 4095, 3300, 4095, 1, 2>();
+  check_select<0, 200, 1, 2, 1, 2>();
+  check_select<0, 255, 7, 10, 1, 2>();
+  check_select<-128, 127, 1, 3, 1, 2>();
+  check_select<-100, 100, 1, 3, 1, 2>();
+  check_select<-2048, 2047, 5, 9, 1, 4>();
+  check_select<-30000, 30000, 22, 7, 1, 100>();
+  check_select<0, 65535, 100, 65535, 1, 2>();
+  check_select<0, 1000000, 314159, 100000, 1, 2>();
+  check_select<-134217728, 134217727, 1000003, 999983, 1, 2>();
+  check_select<0, 400000000, 5, 3, 1, 2>();
+  check_select<-9223372036854775807 - 1, 9223372036854775807, 1, 1099511627776, 1, 2>();
+  check_select<0, 9223372036854775807, 1, 4, 1, 2>();
+  check_select<-40000, 0, 1000, 1001, 1, 2>();
+}
+
+/********************************************************************************
+ ********                   pseudorandom specifications                  ********
+ ********************************************************************************/
+
+/* |num * mul / 2^shift - num * fraction|, as optimal_pow2_rational.cpp stated it. */
+pow2_rational end_point_error(const pow2_int &num, const pow2_int &mul, const uint8_t shift, const pow2_rational &fraction) {
+  const pow2_rational error = pow2_rational(num * mul, pow2_int(1) << shift) - pow2_rational(num) * fraction;
+  return (error < 0) ? pow2_rational(-error) : error;
+}
+
+/* ROUND(fraction * 2^shift) by comparing against the candidates floor and floor + 1. */
+pow2_int nearest_mul(const pow2_rational &fraction, const uint8_t shift) {
+  const pow2_rational scaled = fraction * pow2_rational(pow2_int(1) << shift);
+  const pow2_int below = numerator(scaled) / denominator(scaled);
+  return (scaled - pow2_rational(below) >= pow2_rational(1, 2)) ? pow2_int(below + 1) : below;
+}
+
+template <typename type> bool fits(const pow2_int &value) {
+  return value >= pow2_int(std::numeric_limits<type>::lowest()) && value <= pow2_int(std::numeric_limits<type>::max());
+}
+
+template <typename type> void check_type(const pow2_rational_spec &spec, const pow2_rational_result &result, pow2_int_type &narrowest) {
+  const pow2_int_type index = int_type_of<type>();
+  const bool underflows = result.min_product < pow2_int(std::numeric_limits<type>::lowest());
+  const bool overflows = result.max_product > pow2_int(std::numeric_limits<type>::max());
+  const pow2_product_class expected = underflows ? (overflows ? POW2_PRODUCT_UNDERFLOWS_AND_OVERFLOWS : POW2_PRODUCT_UNDERFLOWS) : (overflows ? POW2_PRODUCT_OVERFLOWS : POW2_PRODUCT_FITS);
+  check(result.product_class[index] == expected, std::string("product class for ") + pow2_int_type_name(index) + " of " + describe(spec));
+
+  if (narrowest == POW2_INT_TYPES && std::is_signed<type>::value == (spec.range_min < 0) && fits<type>(result.min_product) && fits<type>(result.max_product) &&
+      fits<type>(spec.range_min) && fits<type>(spec.range_max) && fits<type>(result.mul) && result.shift < std::numeric_limits<type>::digits)
+    narrowest = index;
+}
+
+void check_random(const pow2_rational_spec &spec) {
+  const pow2_rational_result result = pow2_rational_search(spec);
+
+  uint8_t shift = 1u;
+  for (; shift <= 63u; shift++) {
+    const pow2_int mul = nearest_mul(spec.fraction, shift);
+    if (end_point_error(spec.range_min, mul, shift, spec.fraction) < spec.max_error && end_point_error(spec.range_max, mul, shift, spec.fraction) < spec.max_error) break;
+  }
+  check(result.found == (shift <= 63u), "found for " + describe(spec));
+  if (!result.found || shift > 63u) return;
+
+  const pow2_int mul = nearest_mul(spec.fraction, shift);
+  const pow2_rational min_error = end_point_error(spec.range_min, mul, shift, spec.fraction);
+  const pow2_rational max_error = end_point_error(spec.range_max, mul, shift, spec.fraction);
+  check(result.shift == shift && result.mul == mul, "shift and mul for " + describe(spec));
+  check(result.approximation == pow2_rational(mul, pow2_int(1) << shift), "approximation for " + describe(spec));
+  check(result.worst_error == ((min_error > max_error) ? min_error : max_error), "worst_error for " + describe(spec));
+  check(result.min_product == spec.range_min * mul && result.max_product == spec.range_max * mul, "products for " + describe(spec));
+
+  pow2_int_type narrowest = POW2_INT_TYPES;
+  check_type<int8_t>(spec, result, narrowest);
+  check_type<uint8_t>(spec, result, narrowest);
+  check_type<int16_t>(spec, result, narrowest);
+  check_type<uint16_t>(spec, result, narrowest);
+  check_type<int32_t>(spec, result, narrowest);
+  check_type<uint32_t>(spec, result, narrowest);
+  check_type<int64_t>(spec, result, narrowest);
+  check_type<uint64_t>(spec, result, narrowest);
+  check(result.narrowest == narrowest, "narrowest type for " + describe(spec));
+}
+
+void test_random(std::mt19937_64 &rng) {
+  for (unsigned j = 0u; j < 4000u; j++) {
+    /* Ranges from a few values up to the full 64-bit span, signed and unsigned. */
+    const unsigned bits = 1u + static_cast<unsigned>(rng() % 63u);
+    const int64_t limit = static_cast<int64_t>((bits == 63u) ? std::numeric_limits<int64_t>::max() : ((1ll << bits) - 1));
+    int64_t a = static_cast<int64_t>(rng() % static_cast<uint64_t>(limit)) - ((j % 2u) ? limit / 2 : 0);
+    int64_t b = static_cast<int64_t>(rng() % static_cast<uint64_t>(limit)) - ((j % 4u) == 1u ? limit / 2 : 0);
+    if (b < a) std::swap(a, b);
+
+    /* Fractions as ratios, short decimals, and exact power-of-two values. */
+    pow2_rational fraction;
+    if (j % 3u == 0u) fraction = pow2_rational(pow2_int(rng() % 1000000u), pow2_int(1u + rng() % 1000000u));
+    else if (j % 3u == 1u) fraction = pow2_rational(pow2_int(rng() % 100000000u), pow2_int(100000000u));
+    else fraction = pow2_rational(pow2_int(rng() % 4096u), pow2_int(1) << (rng() % 20u));
+
+    const pow2_rational max_error = (j % 5u == 0u) ? pow2_rational(1, 1 + static_cast<int>(rng() % 64u)) : pow2_rational(1, 2);
+    check_random(pow2_rational_spec(a, b, fraction, max_error));
+  }
+}
+
+int main() {
+  std::chrono::high_resolution_clock::time_point test_start = std::chrono::high_resolution_clock::now();
+  std::mt19937_64 rng(0x0F2A7105ull);
+
+  test_parse();
+  test_select();
+  test_random(rng);
+
+  std::chrono::high_resolution_clock::time_point test_end = std::chrono::high_resolution_clock::now();
+  std::printf("%" PRIu64 " tests complete. %" PRIu64 " errors. Tests took %" PRIu64 " ms\n", test_count, error_count, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(test_end-test_start).count()));
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,353 @@
+/**
+ * test_pool.hpp
+ * A work-stealing thread pool for the exhaustive test drivers.
+ *
+ * Each test is added as a job: a name, a count of items, a chunk size,
+ * and a body
+ *     void body(uint64_t first, uint64_t last);
+ * that tests items [first, last) of the job. What an item is (a num
+ * value, a dividend, a step of a strided sweep) is up to the body.
+ *
+ * run() splits every job into chunks of at most chunk items and deals
+ * the chunks of all jobs round-robin into one queue per worker thread.
+ * A worker takes chunks from the back of its own queue and, when that
+ * is empty, steals from the front of the other queues. No work is added
+ * once run() starts, so a worker that finds every queue empty is done;
+ * there are no sleeps or polling loops anywhere.
+ *
+ * While the jobs run, a progress line with an ETA is printed at most once
+ * every progress_interval_s seconds. The ETA assumes that chunks take
+ * similar time, so pick each job's chunk size with that in mind. After
+ * all jobs finish, a summary gives each job's wall time (first chunk
+ * start to last chunk end) and busy time (sum of its chunk times).
+ *
+ * The test bodies report their own errors. All printing done by the pool
+ * holds the print_mutex given to the constructor, which should be the
+ * same mutex the bodies use.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef TEST_POOL_HPP_
+#define TEST_POOL_HPP_
+
+#include <cinttypes>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class test_pool {
+public:
+  /**
+   * nThreads == 0 uses every available hardware thread. The calling
+   * thread only waits in run(), so it does not need a core of its own.
+   */
+  explicit test_pool(std::mutex &print_mutex, unsigned nThreads = 0u, unsigned progress_interval_s = 10u)
+    : print_mutex_(print_mutex), nThreads_(nThreads), progress_interval_ns_(static_cast<int64_t>(progress_interval_s) * 1000000000ll) {
+    if (nThreads_ == 0u) nThreads_ = std::thread::hardware_concurrency();
+    if (nThreads_ == 0u) nThreads_ = 1u;
+  }
+
+  unsigned threads() const { return nThreads_; }
+
+  /**
+   * Queues a job of count items split into chunks of at most chunk items.
+   * Jobs with count == 0 are ignored.
+   */
+  void add_job(const std::string &name, const uint64_t count, const uint64_t chunk, std::function<void(uint64_t, uint64_t)> body) {
+    if (count == 0ull) return;
+    std::unique_ptr<job> new_job(new job);
+    new_job->name = name;
+    new_job->count = count;
+    new_job->chunk = (chunk == 0ull) ? 1ull : chunk;
+    new_job->nChunks = (count - 1ull) / new_job->chunk + 1ull;
+    new_job->body = std::move(body);
+    jobs_.push_back(std::move(new_job));
+  }
+
+  /**
+   * Runs every queued job to completion, prints the per-job summary,
+   * and clears the job list.
+   */
+  void run() {
+    queues_.reset(new worker_queue[nThreads_]);
+    uint64_t nChunks = 0ull;
+    for (size_t jJob = 0u; jJob < jobs_.size(); jJob++) {
+      job &this_job = *jobs_[jJob];
+      for (uint64_t first = 0ull; first < this_job.count; first += this_job.chunk) {
+        uint64_t last = (this_job.count - first > this_job.chunk) ? first + this_job.chunk : this_job.count;
+        queues_[nChunks % nThreads_].chunks.push_back(chunk_range{jJob, first, last});
+        nChunks++;
+      }
+    }
+    nChunks_ = nChunks;
+    chunks_done_.store(0ull);
+    last_progress_ns_.store(0ll);
+
+    {
+      std::lock_guard<std::mutex> print_lock(print_mutex_);
+      std::printf("Running %zu jobs in %" PRIu64 " chunks on %u threads.\n\n", jobs_.size(), nChunks, nThreads_);
+    }
+
+    start_ = std::chrono::steady_clock::now();
+    std::vector<std::thread> vThreads;
+    for (unsigned jThread = 0u; jThread < nThreads_; jThread++) {
+      vThreads.push_back(std::thread(&test_pool::worker, this, jThread));
+    }
+    for (size_t jThread = 0u; jThread < vThreads.size(); jThread++) {
+      vThreads[jThread].join();
+    }
+    int64_t total_ns = elapsed_ns();
+
+    {
+      std::lock_guard<std::mutex> print_lock(print_mutex_);
+      std::printf("\nJob timing (wall ms, busy ms):\n");
+      for (size_t jJob = 0u; jJob < jobs_.size(); jJob++) {
+        const job &this_job = *jobs_[jJob];
+        std::printf("  %s: %" PRIi64 " ms, %" PRIi64 " ms\n", this_job.name.c_str(),
+                    (this_job.last_end_ns.load() - this_job.first_start_ns.load()) / 1000000, this_job.busy_ns.load() / 1000000);
+      }
+      std::printf("All %zu jobs took %" PRIi64 " ms on %u threads.\n\n", jobs_.size(), total_ns / 1000000, nThreads_);
+    }
+
+    jobs_.clear();
+    queues_.reset();
+  }
+
+private:
+  struct job {
+    std::string name;
+    uint64_t count;
+    uint64_t chunk;
+    uint64_t nChunks;
+    std::function<void(uint64_t, uint64_t)> body;
+    std::atomic<int64_t> busy_ns{0ll};
+    std::atomic<int64_t> first_start_ns{INT64_MAX};
+    std::atomic<int64_t> last_end_ns{0ll};
+  };
+
+  struct chunk_range {
+    size_t job_index;
+    uint64_t first;
+    uint64_t last;
+  };
+
+  struct worker_queue {
+    std::mutex mutex;
+    std::deque<chunk_range> chunks;
+  };
+
+  int64_t elapsed_ns() const {
+    return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+  }
+
+  /**
+   * Takes a chunk from the back of queue jThread, or else steals one from
+   * the front of another queue. Returns false when every queue is empty.
+   */
+  bool take_chunk(const unsigned jThread, chunk_range &taken) {
+    {
+      worker_queue &own = queues_[jThread];
+      std::lock_guard<std::mutex> queue_lock(own.mutex);
+      if (!own.chunks.empty()) {
+        taken = own.chunks.back();
+        own.chunks.pop_back();
+        return true;
+      }
+    }
+    for (unsigned offset = 1u; offset < nThreads_; offset++) {
+      worker_queue &victim = queues_[(jThread + offset) % nThreads_];
+      std::lock_guard<std::mutex> queue_lock(victim.mutex);
+      if (!victim.chunks.empty()) {
+        taken = victim.chunks.front();
+        victim.chunks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void worker(const unsigned jThread) {
+    chunk_range taken;
+    while (take_chunk(jThread, taken)) {
+      job &this_job = *jobs_[taken.job_index];
+      int64_t chunk_start = elapsed_ns();
+      int64_t earliest = this_job.first_start_ns.load();
+      while (chunk_start < earliest && !this_job.first_start_ns.compare_exchange_weak(earliest, chunk_start)) {}
+
+      this_job.body(taken.first, taken.last);
+
+      int64_t chunk_end = elapsed_ns();
+      this_job.busy_ns.fetch_add(chunk_end - chunk_start);
+      int64_t latest = this_job.last_end_ns.load();
+      while (chunk_end > latest && !this_job.last_end_ns.compare_exchange_weak(latest, chunk_end)) {}
+      report_progress(chunks_done_.fetch_add(1ull) + 1ull, chunk_end);
+    }
+  }
+
+  /**
+   * Prints the progress line if progress_interval_s has passed since the
+   * last one. Only the thread that wins the exchange prints.
+   */
+  void report_progress(const uint64_t done, const int64_t now_ns) {
+    int64_t last = last_progress_ns_.load();
+    if (now_ns - last < progress_interval_ns_ || done == nChunks_) return;
+    if (!last_progress_ns_.compare_exchange_strong(last, now_ns)) return;
+    double fraction = static_cast<double>(done) / static_cast<double>(nChunks_);
+    double eta_s = 1.0e-9 * static_cast<double>(now_ns) * (1.0 - fraction) / fraction;
+    std::lock_guard<std::mutex> print_lock(print_mutex_);
+    std::printf("progress: %5.1f%% (%" PRIu64 " of %" PRIu64 " chunks), %.0f s elapsed, ETA %.0f s\n",
+                100.0 * fraction, done, nChunks_, 1.0e-9 * static_cast<double>(now_ns), eta_s);
+    std::fflush(stdout);
+  }
+
+  std::mutex &print_mutex_;
+  unsigned nThreads_;
+  int64_t progress_interval_ns_;
+  std::vector<std::unique_ptr<job> > jobs_;
+  std::unique_ptr<worker_queue[]> queues_;
+  uint64_t nChunks_ = 0ull;
+  std::atomic<uint64_t> chunks_done_{0ull};
+  std::atomic<int64_t> last_progress_ns_{0ll};
+  std::chrono::steady_clock::time_point start_;
+};
+
+#endif /* #ifndef TEST_POOL_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,460 @@
+/**
+ * test_rounding_policy.cpp
+ * Tests the rounding policies of rounding_policy.hpp and rounding_policy.h:
+ * shiftround_X_P, multshiftround_X_P, and divround_X_P in C, and
+ * shiftround<type, rounding>, multshiftround<type, rounding>,
+ * divround<type, rounding>, shiftround<type, shift, rounding>,
+ * multshiftround<type, shift, rounding>, and
+ * divround<type, divisor, rounding> in C++, for every type and for
+ * round_half_away, round_half_even, round_floor, and round_trunc.
+ * round_half_away is checked through the original routines, which the
+ * C++ overloads forward to.
+ *
+ * Every result is checked against the exact policy aware reference
+ * functions in intmath_reference.hpp. The 8-bit and 16-bit shiftround
+ * routines, the 8-bit multshiftround and divround routines, and the 8-bit
+ * and 16-bit compile time divisor routines are checked for every argument.
+ * The 16-bit divround routines are checked for every dividend against a
+ * few hundred divisors. Everything else is sampled, with about half of the
+ * samples built to land exactly on, or next to, a tie between two
+ * results, since ties are where the policies differ. Samples come from a
+ * hash of their index, so every run checks the same arguments.
+ *
+ * The 8-bit multshiftround checks include products that overflow the
+ * type, which every routine rounds after wrapping the product, as in
+ * test_multshiftround_exhaustive.cpp. The test must therefore be linked
+ * against the non-debug objects and built without DEBUG_INTMATH.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "run_masks_type.h"
+#include "rounding_policy.hpp"
+#include "shiftround_run.hpp"
+#include "shiftround_comp.hpp"
+#include "multshiftround_run.hpp"
+#include "multshiftround_comp.hpp"
+#include "divround.hpp"
+#include "divround_comp.hpp"
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "shiftround_run.h"
+    #include "multshiftround_run.h"
+    #include "divround.h"
+    #include "rounding_policy.h"
+#ifdef __cplusplus
+  }
+#endif
+#include "intmath_reference.hpp"
+#include "test_pool.hpp"
+
+#ifdef DEBUG_INTMATH
+  #error "test_rounding_policy.cpp deliberately passes overflowing products; build it without DEBUG_INTMATH."
+#endif
+
+std::mutex print_mutex;
+std::atomic<uint64_t> nChecks(0ull);
+std::atomic<uint64_t> nErrors(0ull);
+
+const uint64_t nSamples = 1ull << 20;
+
+/********************************************************************************
+ ********                          test helpers                          ********
+ ********************************************************************************/
+
+/**
+ * The C routines for one type and policy. round_half_away has no suffix,
+ * so these are the original routines.
+ */
+template <typename type, typename rounding> struct c_routines;
+
+#define C_ROUTINES(type, X, rounding, suffix)                                                                           \
+  template <> struct c_routines<type, rounding> {                                                                       \
+    static type shift(const type num, const uint8_t s) { return shiftround_##X##suffix(num, s); }                       \
+    static type mult(const type num, const type mul, const uint8_t s) { return multshiftround_##X##suffix(num, mul, s); } \
+    static type div(const type dividend, const type divisor) { return divround_##X##suffix(dividend, divisor); }        \
+    static const char *suffix_text(void) { return #X #suffix; }                                                         \
+  };
+
+#define C_ROUTINES_ALL(type, X)                  \
+  C_ROUTINES(type, X, round_half_away, )         \
+  C_ROUTINES(type, X, round_half_even, _even)    \
+  C_ROUTINES(type, X, round_floor, _floor)       \
+  C_ROUTINES(type, X, round_trunc, _trunc)
+
+C_ROUTINES_ALL(int8_t, i8)
+C_ROUTINES_ALL(uint8_t, u8)
+C_ROUTINES_ALL(int16_t, i16)
+C_ROUTINES_ALL(uint16_t, u16)
+C_ROUTINES_ALL(int32_t, i32)
+C_ROUTINES_ALL(uint32_t, u32)
+C_ROUTINES_ALL(int64_t, i64)
+C_ROUTINES_ALL(uint64_t, u64)
+
+/* The largest valid shift for type: digits - 1. */
+template <typename type> constexpr uint8_t max_shift(void) {
+  return static_cast<uint8_t>(std::numeric_limits<type>::digits - 1);
+}
+
+/**
+ * Tables of the compile time shift routines, indexed by shift. Index 0 is
+ * unused since those routines do not accept shift = 0.
+ */
+template <typename type, typename rounding, uint8_t shift> type comp_shift(const type num) {
+  return shiftround<type, shift, rounding>(num);
+}
+
+template <typename type, typename rounding, uint8_t shift> type comp_mult(const type num, const type mul) {
+  return multshiftround<type, shift, rounding>(num, mul);
+}
+
+template <typename type, typename rounding, uint8_t... shifts> std::vector<type (*)(const type)> comp_shift_table(std::integer_sequence<uint8_t, shifts...>) {
+  return { nullptr, comp_shift<type, rounding, static_cast<uint8_t>(shifts + 1u)>... };
+}
+
+template <typename type, typename rounding, uint8_t... shifts> std::vector<type (*)(const type, const type)> comp_mult_table(std::integer_sequence<uint8_t, shifts...>) {
+  return { nullptr, comp_mult<type, rounding, static_cast<uint8_t>(shifts + 1u)>... };
+}
+
+/* The divisors given to divround<type, divisor, rounding>. Negative values wrap for unsigned types. */
+#define COMP_DIVISORS 1, -1, 2, -2, 3, -3, 5, 7, -7, 10, -10, 100, -100, 127, -128
+
+template <typename type, typename rounding, int64_t divisor> type comp_div(const type dividend) {
+  return divround<type, static_cast<type>(divisor), rounding>(dividend);
+}
+
+template <typename type, typename rounding, int64_t... divisors> std::vector<std::pair<type, type (*)(const type)>> comp_div_table(void) {
+  return { std::make_pair(static_cast<type>(divisors), comp_div<type, rounding, divisors>)... };
+}
+
+/* The splitmix64 finalizer, used to derive sample arguments from their index. */
+uint64_t mix(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+/* The low bits of bits, for bits on [0, 64]. */
+uint64_t low_bits(const uint64_t value, const unsigned bits) {
+  return (bits >= 64u) ? value : (value & ((1ull << bits) - 1ull));
+}
+
+/* Item i of a sweep over every value of type, starting from the lowest. */
+template <typename type> type value_at(const uint64_t i) {
+  return static_cast<type>(static_cast<uint64_t>(std::numeric_limits<type>::lowest()) + i);
+}
+
+/* The number of distinct values of type. Only used for the 8-bit and 16-bit types. */
+template <typename type> constexpr uint64_t value_count(void) {
+  return static_cast<uint64_t>(std::numeric_limits<typename std::make_unsigned<type>::type>::max()) + 1ull;
+}
+
+/**
+ * Applies a random sign to a magnitude below 2^digits. Unsigned types
+ * keep the magnitude.
+ */
+template <typename type> type with_sign(const uint64_t magnitude, const bool negative) {
+  if (std::is_signed<type>::value && negative) return static_cast<type>(0ull - magnitude);
+  return static_cast<type>(magnitude);
+}
+
+/**
+ * A sample num for num / 2^shift. By hash, the discarded bits are exactly
+ * half, half plus or minus one, zero, or random.
+ */
+template <typename type> type sample_shift_num(const uint64_t hash, const uint8_t shift) {
+  const uint64_t bits = static_cast<uint64_t>(static_cast<typename std::make_unsigned<type>::type>(mix(hash)));
+  if (shift == 0u) return static_cast<type>(bits);
+  const uint64_t mask = (1ull << shift) - 1ull;
+  const uint64_t half = 1ull << (shift - 1u);
+  uint64_t low = bits & mask;
+  switch (hash & 7u) {
+    case 0u: case 1u: low = half; break;
+    case 2u: low = (half + 1ull) & mask; break;
+    case 3u: low = (half - 1ull) & mask; break;
+    case 4u: low = 0ull; break;
+    default: break;
+  }
+  return static_cast<type>((bits & ~mask) | low);
+}
+
+/**
+ * A sample (num, mul) whose product fits in type: the magnitudes together
+ * have at most digits significant bits.
+ */
+template <typename type> void sample_product(const uint64_t hash, type &num, type &mul) {
+  const unsigned digits = static_cast<unsigned>(std::numeric_limits<type>::digits);
+  const uint64_t r = mix(hash);
+  const unsigned num_bits = static_cast<unsigned>(r % (digits + 1u));
+  const unsigned mul_bits = static_cast<unsigned>((r >> 8) % (digits - num_bits + 1u));
+  num = with_sign<type>(low_bits(mix(r), num_bits), ((r >> 16) & 1u) != 0u);
+  mul = with_sign<type>(low_bits(mix(r + 1u), mul_bits), ((r >> 17) & 1u) != 0u);
+}
+
+/**
+ * A sample (dividend, divisor) with a nonzero divisor and no quotient
+ * overflow. dividend is built as quotient * divisor + remainder, and by
+ * hash the remainder is exactly half the divisor, next to half, zero, or
+ * random.
+ */
+template <typename type> void sample_division(const uint64_t hash, type &dividend, type &divisor) {
+  const unsigned digits = static_cast<unsigned>(std::numeric_limits<type>::digits);
+  const uint64_t r = mix(hash);
+  const unsigned divisor_bits = 1u + static_cast<unsigned>(r % (digits - 1u));
+  uint64_t divisor_mag = low_bits(mix(r), divisor_bits);
+  if (divisor_mag == 0ull) divisor_mag = 1ull;
+  const uint64_t quotient_mag = low_bits(mix(r + 1u), digits - divisor_bits - 1u);
+  uint64_t remainder_mag = mix(r + 2u) % divisor_mag;
+  switch ((r >> 8) & 7u) {
+    case 0u: case 1u: remainder_mag = divisor_mag / 2u; break;
+    case 2u: remainder_mag = (divisor_mag / 2u + 1u) % divisor_mag; break;
+    case 3u: remainder_mag = (divisor_mag / 2u == 0u) ? 0u : divisor_mag / 2u - 1u; break;
+    case 4u: remainder_mag = 0ull; break;
+    default: break;
+  }
+  dividend = with_sign<type>(quotient_mag * divisor_mag + remainder_mag, ((r >> 16) & 1u) != 0u);
+  divisor = with_sign<type>(divisor_mag, ((r >> 17) & 1u) != 0u);
+}
+
+/* value as decimal text. */
+template <typename type> std::string text(const type value) {
+  if (std::is_signed<type>::value) return std::to_string(static_cast<long long>(value));
+  return std::to_string(static_cast<unsigned long long>(value));
+}
+
+/**
+ * Returns true if result matches expected. Otherwise prints an ERROR line
+ * naming the routine and its arguments and returns false.
+ */
+template <typename type> bool check(const type result, const type expected, const std::string &routine, const std::string &arguments) {
+  if (result == expected) return true;
+  nErrors++;
+  std::lock_guard<std::mutex> print_lock(print_mutex);
+  std::printf("\nERROR: %s(%s) returns %s but should return %s\n\n", routine.c_str(), arguments.c_str(), text(result).c_str(), text(expected).c_str());
+  return false;
+}
+
+/********************************************************************************
+ ********                           shiftround                           ********
+ ********************************************************************************/
+
+/**
+ * Checks num / 2^shift for every valid shift and one invalid shift, which
+ * must return 0, in the C, run, and comp routines.
+ */
+template <typename type, typename rounding> void check_shift(const type num, const uint8_t shift, const std::vector<type (*)(const type)> &comp, const char *cpp_name) {
+  const type expected = (shift > max_shift<type>()) ? static_cast<type>(0) : reference_shiftround<type>(num, shift, rounding());
+  const std::string arguments = text(num) + ", " + std::to_string(shift);
+  check(c_routines<type, rounding>::shift(num, shift), expected, std::string("shiftround_") + c_routines<type, rounding>::suffix_text(), arguments) &&
+  check(shiftround<type, rounding>(num, shift), expected, std::string("shiftround<") + cpp_name + ", " + rounding::name() + ">", arguments);
+  if (shift >= 1u && shift <= max_shift<type>())
+    check(comp[shift](num), expected, std::string("shiftround<") + cpp_name + ", " + std::to_string(shift) + ", " + rounding::name() + ">", text(num));
+}
+
+template <typename type, typename rounding> void add_shift_jobs(test_pool &pool, const char *cpp_name) {
+  const std::vector<type (*)(const type)> comp = comp_shift_table<type, rounding>(std::make_integer_sequence<uint8_t, max_shift<type>()>());
+  const std::string name = std::string("shiftround ") + cpp_name + " " + rounding::name();
+
+  if (sizeof(type) <= 2u) {
+    pool.add_job(name, value_count<type>(), 1024ull, [comp, cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++)
+        for (uint8_t shift = 0u; shift <= max_shift<type>() + 1u; shift++) check_shift<type, rounding>(value_at<type>(i), shift, comp, cpp_name);
+      nChecks += (last - first) * (max_shift<type>() + 2u);
+    });
+  } else {
+    pool.add_job(name, nSamples, 4096ull, [comp, cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++) {
+        const uint8_t shift = static_cast<uint8_t>(i % (max_shift<type>() + 2u));
+        check_shift<type, rounding>(sample_shift_num<type>(i, shift), shift, comp, cpp_name);
+      }
+      nChecks += last - first;
+    });
+  }
+}
+
+/********************************************************************************
+ ********                         multshiftround                         ********
+ ********************************************************************************/
+
+/**
+ * Checks (num * mul) / 2^shift in the C, run, and comp routines. A
+ * product that overflows type is checked as wrapped to type.
+ */
+template <typename type, typename rounding> void check_mult(const type num, const type mul, const uint8_t shift, const std::vector<type (*)(const type, const type)> &comp, const char *cpp_name) {
+  type expected = static_cast<type>(0);
+  if (shift <= max_shift<type>()) {
+    if (sizeof(type) == 1u) expected = reference_shiftround<type>(static_cast<type>(num * mul), shift, rounding());
+    else expected = reference_multshiftround<type>(num, mul, shift, rounding());
+  }
+  const std::string arguments = text(num) + ", " + text(mul) + ", " + std::to_string(shift);
+  check(c_routines<type, rounding>::mult(num, mul, shift), expected, std::string("multshiftround_") + c_routines<type, rounding>::suffix_text(), arguments) &&
+  check(multshiftround<type, rounding>(num, mul, shift), expected, std::string("multshiftround<") + cpp_name + ", " + rounding::name() + ">", arguments);
+  if (shift >= 1u && shift <= max_shift<type>())
+    check(comp[shift](num, mul), expected, std::string("multshiftround<") + cpp_name + ", " + std::to_string(shift) + ", " + rounding::name() + ">", text(num) + ", " + text(mul));
+}
+
+template <typename type, typename rounding> void add_mult_jobs(test_pool &pool, const char *cpp_name) {
+  const std::vector<type (*)(const type, const type)> comp = comp_mult_table<type, rounding>(std::make_integer_sequence<uint8_t, max_shift<type>()>());
+  const std::string name = std::string("multshiftround ") + cpp_name + " " + rounding::name();
+
+  if (sizeof(type) == 1u) {
+    pool.add_job(name, value_count<type>() * value_count<type>(), 1024ull, [comp, cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++)
+        for (uint8_t shift = 0u; shift <= max_shift<type>() + 1u; shift++)
+          check_mult<type, rounding>(value_at<type>(i >> 8), value_at<type>(i & 0xFFu), shift, comp, cpp_name);
+      nChecks += (last - first) * (max_shift<type>() + 2u);
+    });
+  } else {
+    pool.add_job(name, nSamples, 4096ull, [comp, cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++) {
+        type num, mul;
+        sample_product<type>(i, num, mul);
+        check_mult<type, rounding>(num, mul, static_cast<uint8_t>(i % (max_shift<type>() + 2u)), comp, cpp_name);
+      }
+      nChecks += last - first;
+    });
+  }
+}
+
+/********************************************************************************
+ ********                            divround                            ********
+ ********************************************************************************/
+
+/**
+ * Checks dividend / divisor in the C and run routines. A 0 divisor must
+ * return dividend, and the most negative value divided by -1 must return
+ * the most positive value.
+ */
+template <typename type, typename rounding> void check_div(const type dividend, const type divisor, const char *cpp_name) {
+  type expected;
+  if (divisor == static_cast<type>(0)) expected = dividend;
+  else if (std::is_signed<type>::value && dividend == std::numeric_limits<type>::lowest() && divisor == static_cast<type>(-1)) expected = std::numeric_limits<type>::max();
+  else expected = reference_divround<type>(dividend, divisor, rounding());
+  const std::string arguments = text(dividend) + ", " + text(divisor);
+  check(c_routines<type, rounding>::div(dividend, divisor), expected, std::string("divround_") + c_routines<type, rounding>::suffix_text(), arguments) &&
+  check(divround<type, rounding>(dividend, divisor), expected, std::string("divround<") + cpp_name + ", " + rounding::name() + ">", arguments);
+}
+
+/* Checks dividend against every compile time divisor. */
+template <typename type, typename rounding> void check_comp_div(const type dividend, const std::vector<std::pair<type, type (*)(const type)>> &comp, const char *cpp_name) {
+  for (const std::pair<type, type (*)(const type)> &entry : comp) {
+    type expected;
+    if (std::is_signed<type>::value && dividend == std::numeric_limits<type>::lowest() && entry.first == static_cast<type>(-1)) expected = std::numeric_limits<type>::max();
+    else expected = reference_divround<type>(dividend, entry.first, rounding());
+    check(entry.second(dividend), expected, std::string("divround<") + cpp_name + ", " + text(entry.first) + ", " + rounding::name() + ">", text(dividend));
+  }
+}
+
+/* Every divisor of magnitude up to 300, the extremes of type, and a spread in between. */
+template <typename type> std::vector<type> divisors_16(void) {
+  std::vector<type> divisors;
+  for (int32_t d = -300; d <= 300; d++) divisors.push_back(static_cast<type>(d));
+  for (uint64_t i = 0u; i < 100u; i++) divisors.push_back(static_cast<type>(mix(i)));
+  divisors.push_back(std::numeric_limits<type>::lowest());
+  divisors.push_back(std::numeric_limits<type>::max());
+  return divisors;
+}
+
+template <typename type, typename rounding> void add_div_jobs(test_pool &pool, const char *cpp_name) {
+  const std::vector<std::pair<type, type (*)(const type)>> comp = comp_div_table<type, rounding, COMP_DIVISORS>();
+  const std::string name = std::string("divround ") + cpp_name + " " + rounding::name();
+
+  if (sizeof(type) == 1u) {
+    pool.add_job(name, value_count<type>() * value_count<type>(), 1024ull, [cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++) check_div<type, rounding>(value_at<type>(i >> 8), value_at<type>(i & 0xFFu), cpp_name);
+      nChecks += last - first;
+    });
+  } else if (sizeof(type) == 2u) {
+    const std::vector<type> divisors = divisors_16<type>();
+    pool.add_job(name, value_count<type>(), 256ull, [divisors, cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++)
+        for (type divisor : divisors) check_div<type, rounding>(value_at<type>(i), divisor, cpp_name);
+      nChecks += (last - first) * divisors.size();
+    });
+  } else {
+    pool.add_job(name, nSamples, 4096ull, [cpp_name](uint64_t first, uint64_t last) {
+      for (uint64_t i = first; i < last; i++) {
+        type dividend, divisor;
+        sample_division<type>(i, dividend, divisor);
+        check_div<type, rounding>(dividend, divisor, cpp_name);
+      }
+      check_div<type, rounding>(std::numeric_limits<type>::lowest(), static_cast<type>(-1), cpp_name);
+      check_div<type, rounding>(std::numeric_limits<type>::max(), static_cast<type>(0), cpp_name);
+      nChecks += last - first + 2u;
+    });
+  }
+
+  const uint64_t comp_count = (sizeof(type) <= 2u) ? value_count<type>() : nSamples / 16u;
+  pool.add_job(name + " comp", comp_count, 1024ull, [comp, cpp_name](uint64_t first, uint64_t last) {
+    for (uint64_t i = first; i < last; i++) check_comp_div<type, rounding>((sizeof(type) <= 2u) ? value_at<type>(i) : static_cast<type>(mix(i)), comp, cpp_name);
+    nChecks += (last - first) * comp.size();
+  });
+}
+
+/* Every routine of one type under every policy. */
+template <typename type> void add_type_jobs(test_pool &pool, const char *cpp_name) {
+  add_shift_jobs<type, round_half_away>(pool, cpp_name);
+  add_shift_jobs<type, round_half_even>(pool, cpp_name);
+  add_shift_jobs<type, round_floor>(pool, cpp_name);
+  add_shift_jobs<type, round_trunc>(pool, cpp_name);
+  add_mult_jobs<type, round_half_away>(pool, cpp_name);
+  add_mult_jobs<type, round_half_even>(pool, cpp_name);
+  add_mult_jobs<type, round_floor>(pool, cpp_name);
+  add_mult_jobs<type, round_trunc>(pool, cpp_name);
+  add_div_jobs<type, round_half_away>(pool, cpp_name);
+  add_div_jobs<type, round_half_even>(pool, cpp_name);
+  add_div_jobs<type, round_floor>(pool, cpp_name);
+  add_div_jobs<type, round_trunc>(pool, cpp_name);
+}
+
+/* A few constant expression results, including ties in both directions. */
+static_assert(shiftround<int8_t, 1, round_half_even>(5) == 2, "");
+static_assert(shiftround<int8_t, 1, round_half_even>(7) == 4, "");
+static_assert(shiftround<int8_t, 1, round_half_even>(-5) == -2, "");
+static_assert(shiftround<int16_t, 2, round_floor>(-5) == -2, "");
+static_assert(shiftround<int16_t, 2, round_trunc>(-5) == -1, "");
+static_assert(shiftround<uint32_t, 3, round_half_even>(20u) == 2u, "");
+static_assert(multshiftround<int32_t, 4, round_half_even>(-3, 8) == -2, "");
+static_assert(multshiftround<int64_t, 40, round_trunc>(-3037000499ll, 3037000499ll) == -8388607ll, "");
+static_assert(rounding_policy_divide<int16_t>(-7, 2, round_half_even()) == -4, "");
+static_assert(rounding_policy_divide<int16_t>(-7, 2, round_floor()) == -4, "");
+static_assert(rounding_policy_divide<int16_t>(7, -2, round_floor()) == -4, "");
+static_assert(rounding_policy_divide<uint8_t>(250u, 100u, round_half_even()) == 2u, "");
+
+int main() {
+  test_pool pool(print_mutex);
+  std::printf("\nTesting the round_half_even, round_floor, and round_trunc policies of\nshiftround, multshiftround, and divround against exact references with %u threads.\n\n", pool.threads());
+
+  add_type_jobs<int8_t>(pool, "int8_t");
+  add_type_jobs<uint8_t>(pool, "uint8_t");
+  add_type_jobs<int16_t>(pool, "int16_t");
+  add_type_jobs<uint16_t>(pool, "uint16_t");
+  add_type_jobs<int32_t>(pool, "int32_t");
+  add_type_jobs<uint32_t>(pool, "uint32_t");
+  add_type_jobs<int64_t>(pool, "int64_t");
+  add_type_jobs<uint64_t>(pool, "uint64_t");
+  pool.run();
+
+  std::printf("\nRan %" PRIu64 " checks with %" PRIu64 " errors.\n\n", nChecks.load(), nErrors.load());
+
+  return 0;
+}
@@ -0,0 +1,474 @@
+/**
+ * test_saturate_arith.cpp
+ * Tests all versions of
+ *   type saturate_add_X(const type a, const type b);
+ *   type saturate_sub_X(const type a, const type b);
+ *   type saturate_mul_X(const type a, const type b);
+ *   type saturate_neg_X(const type a);
+ *   type saturate_abs_X(const type a);
+ * and the matching templates in saturate_arith.hpp against a reference
+ * that detects overflow by comparing against the type limits before
+ * operating. X is a type abbreviation.
+ *
+ * The 8-bit functions are tested on every pair of operands. The wider
+ * functions are tested on every pair drawn from a list of edge values
+ * (0, +-1, the type limits and their neighbours, and values around the
+ * square root of the limits) plus random pairs.
+ *
+ * Then all versions of
+ *   void saturate_add_values_X(type *values, const type *operands, const size_t length);
+ *   void saturate_sub_values_X(type *values, const type *operands, const size_t length);
+ *   void saturate_neg_values_X(type *values, const size_t length);
+ *   void saturate_abs_values_X(type *values, const size_t length);
+ * and the matching templates in saturate_arith_values.hpp are tested
+ * against the scalar templates applied to each element. These run on the
+ * scalar, SSE2, AVX2, and AVX-512 code paths through for_each_code_path,
+ * and every array length from 0 to 300 is tested with
+ * check_guarded_array, both from test_values.hpp.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <array>
+#include <random>
+#include <algorithm>
+#include "saturate_arith.hpp"
+#include "saturate_arith_values.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "saturate_arith.h"
+#ifdef __cplusplus
+  }
+#endif
+
+const size_t random_pairs_per_type = 1000000u;
+const size_t max_test_length = 300u;
+
+uint64_t error_count = 0u;
+
+/**
+ * Reference implementations. Overflow is detected by comparing against
+ * the type limits before the operation, so nothing here shares code with
+ * saturate_arith.c.
+ */
+template <typename type> type reference_add(const type a, const type b) {
+  if (b > static_cast<type>(0) && a > std::numeric_limits<type>::max() - b) return std::numeric_limits<type>::max();
+  if (b < static_cast<type>(0) && a < std::numeric_limits<type>::min() - b) return std::numeric_limits<type>::min();
+  return static_cast<type>(a + b);
+}
+
+template <typename type> type reference_sub(const type a, const type b) {
+  if (b < static_cast<type>(0) && a > std::numeric_limits<type>::max() + b) return std::numeric_limits<type>::max();
+  if (b > static_cast<type>(0) && a < std::numeric_limits<type>::min() + b) return std::numeric_limits<type>::min();
+  return static_cast<type>(a - b);
+}
+
+template <typename type> uint64_t reference_magnitude(const type a) {
+  if (a < static_cast<type>(0)) return 0ull - static_cast<uint64_t>(static_cast<int64_t>(a));
+  return static_cast<uint64_t>(a);
+}
+
+template <typename type> type reference_mul(const type a, const type b) {
+  if (a == static_cast<type>(0) || b == static_cast<type>(0)) return static_cast<type>(0);
+  const bool negative = (a < static_cast<type>(0)) != (b < static_cast<type>(0));
+  const uint64_t limit = negative ? reference_magnitude<type>(std::numeric_limits<type>::min())
+                                  : static_cast<uint64_t>(std::numeric_limits<type>::max());
+  const uint64_t magnitude_a = reference_magnitude<type>(a);
+  const uint64_t magnitude_b = reference_magnitude<type>(b);
+  if (magnitude_a > limit / magnitude_b) return negative ? std::numeric_limits<type>::min() : std::numeric_limits<type>::max();
+  const uint64_t magnitude = magnitude_a * magnitude_b;
+  if (negative) return static_cast<type>(static_cast<int64_t>(0ull - magnitude));
+  return static_cast<type>(magnitude);
+}
+
+template <typename type> type reference_neg(const type a) {
+  return reference_sub<type>(static_cast<type>(0), a);
+}
+
+template <typename type> type reference_abs(const type a) {
+  if (a < static_cast<type>(0)) return reference_neg<type>(a);
+  return a;
+}
+
+/**
+ * Binds each type to its C functions so that the C and C++ versions
+ * are checked by the same test loops.
+ */
+template <typename type> struct c_functions;
+
+#define C_FUNCTIONS(type, abbreviation) \
+  template <> struct c_functions<type> { \
+    static type add(const type a, const type b) { return saturate_add_##abbreviation(a, b); } \
+    static type sub(const type a, const type b) { return saturate_sub_##abbreviation(a, b); } \
+    static type mul(const type a, const type b) { return saturate_mul_##abbreviation(a, b); } \
+    static type neg(const type a) { return saturate_neg_##abbreviation(a); } \
+    static type abs(const type a) { return saturate_abs_##abbreviation(a); } \
+    static void add_values(type *values, const type *operands, const size_t length) { saturate_add_values_##abbreviation(values, operands, length); } \
+    static void sub_values(type *values, const type *operands, const size_t length) { saturate_sub_values_##abbreviation(values, operands, length); } \
+    static void neg_values(type *values, const size_t length) { saturate_neg_values_##abbreviation(values, length); } \
+    static void abs_values(type *values, const size_t length) { saturate_abs_values_##abbreviation(values, length); } \
+  };
+
+C_FUNCTIONS(int8_t, i8)
+C_FUNCTIONS(uint8_t, u8)
+C_FUNCTIONS(int16_t, i16)
+C_FUNCTIONS(uint16_t, u16)
+C_FUNCTIONS(int32_t, i32)
+C_FUNCTIONS(uint32_t, u32)
+C_FUNCTIONS(int64_t, i64)
+C_FUNCTIONS(uint64_t, u64)
+
+#undef C_FUNCTIONS
+
+template <typename type> void report_pair(const char *function_name, const char *type_name, const type a, const type b, const type result, const type expected) {
+  error_count++;
+  if (std::numeric_limits<type>::is_signed) {
+    std::printf("\nERROR: %s<%s>(%" PRId64 ", %" PRId64 ") gave %" PRId64 ", expected %" PRId64 ".\n\n", function_name, type_name,
+                static_cast<int64_t>(a), static_cast<int64_t>(b), static_cast<int64_t>(result), static_cast<int64_t>(expected));
+  } else {
+    std::printf("\nERROR: %s<%s>(%" PRIu64 ", %" PRIu64 ") gave %" PRIu64 ", expected %" PRIu64 ".\n\n", function_name, type_name,
+                static_cast<uint64_t>(a), static_cast<uint64_t>(b), static_cast<uint64_t>(result), static_cast<uint64_t>(expected));
+  }
+}
+
+/**
+ * Checks both the C and C++ versions of every scalar function on a, b.
+ * Stops checking after 20 errors so a broken function does not flood
+ * the output.
+ */
+template <typename type> void test_pair(const char *type_name, const type a, const type b) {
+  if (error_count > 20u) return;
+  type expected = reference_add<type>(a, b);
+  if (c_functions<type>::add(a, b) != expected) report_pair<type>("saturate_add_X", type_name, a, b, c_functions<type>::add(a, b), expected);
+  if (saturate_add<type>(a, b) != expected) report_pair<type>("saturate_add", type_name, a, b, saturate_add<type>(a, b), expected);
+
+  expected = reference_sub<type>(a, b);
+  if (c_functions<type>::sub(a, b) != expected) report_pair<type>("saturate_sub_X", type_name, a, b, c_functions<type>::sub(a, b), expected);
+  if (saturate_sub<type>(a, b) != expected) report_pair<type>("saturate_sub", type_name, a, b, saturate_sub<type>(a, b), expected);
+
+  expected = reference_mul<type>(a, b);
+  if (c_functions<type>::mul(a, b) != expected) report_pair<type>("saturate_mul_X", type_name, a, b, c_functions<type>::mul(a, b), expected);
+  if (saturate_mul<type>(a, b) != expected) report_pair<type>("saturate_mul", type_name, a, b, saturate_mul<type>(a, b), expected);
+
+  expected = reference_neg<type>(a);
+  if (c_functions<type>::neg(a) != expected) report_pair<type>("saturate_neg_X", type_name, a, a, c_functions<type>::neg(a), expected);
+  if (saturate_neg<type>(a) != expected) report_pair<type>("saturate_neg", type_name, a, a, saturate_neg<type>(a), expected);
+
+  expected = reference_abs<type>(a);
+  if (c_functions<type>::abs(a) != expected) report_pair<type>("saturate_abs_X", type_name, a, a, c_functions<type>::abs(a), expected);
+  if (saturate_abs<type>(a) != expected) report_pair<type>("saturate_abs", type_name, a, a, saturate_abs<type>(a), expected);
+}
+
+template <typename type> void test_exhaustive(const char *type_name) {
+  std::printf("Testing saturate_*<%s> on every pair of operands\n", type_name);
+  const int64_t type_min = static_cast<int64_t>(std::numeric_limits<type>::min());
+  const int64_t type_max = static_cast<int64_t>(std::numeric_limits<type>::max());
+  for (int64_t a = type_min; a <= type_max; a++) {
+    for (int64_t b = type_min; b <= type_max; b++) {
+      test_pair<type>(type_name, static_cast<type>(a), static_cast<type>(b));
+    }
+  }
+}
+
+template <typename type> void test_edges_and_random(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("Testing saturate_*<%s> on edge and random operands\n", type_name);
+  const type type_min = std::numeric_limits<type>::min();
+  const type type_max = std::numeric_limits<type>::max();
+  /* 2^(bits/2), so that products of edges land on both sides of the limits. */
+  const type root = static_cast<type>(static_cast<uint64_t>(1u) << (std::numeric_limits<type>::digits / 2));
+
+  std::vector<type> edges = {static_cast<type>(0), static_cast<type>(1), static_cast<type>(2),
+                             type_min, static_cast<type>(type_min + 1), static_cast<type>(type_min + 2),
+                             type_max, static_cast<type>(type_max - 1), static_cast<type>(type_max - 2),
+                             static_cast<type>(type_max / 2), static_cast<type>(type_max / 2 + 1),
+                             static_cast<type>(root - 1), root, static_cast<type>(root + 1)};
+  if (std::numeric_limits<type>::is_signed) {
+    const std::vector<type> negated = edges;
+    for (const type value : negated) edges.push_back(static_cast<type>(0u - static_cast<uint64_t>(value)));
+  }
+
+  for (const type a : edges) {
+    for (const type b : edges) test_pair<type>(type_name, a, b);
+  }
+
+  std::uniform_int_distribution<uint64_t> distribution;
+  for (size_t k = 0u; k < random_pairs_per_type; k++) {
+    /* Shift the operands right by a random amount so that small magnitudes occur. */
+    const uint64_t bits_a = distribution(rng);
+    const uint64_t bits_b = distribution(rng);
+    const type a = static_cast<type>(static_cast<type>(bits_a) >> (bits_a >> 58) % std::numeric_limits<type>::digits);
+    const type b = static_cast<type>(static_cast<type>(bits_b) >> (bits_b >> 58) % std::numeric_limits<type>::digits);
+    test_pair<type>(type_name, a, b);
+  }
+}
+
+/**
+ * Runs each array function on every length and compares the result
+ * against the scalar template applied element by element.
+ */
+template <typename type> void test_values(const char *type_name, std::mt19937_64 &rng) {
+  std::printf("Testing saturate_*_values<%s>\n", type_name);
+  std::uniform_int_distribution<uint64_t> distribution;
+  char description[64];
+
+  for (size_t length = 0u; length <= max_test_length; length++) {
+    std::vector<type> input(length);
+    std::vector<type> operands(length);
+    for (type &value : input) value = static_cast<type>(distribution(rng));
+    for (type &value : operands) value = static_cast<type>(distribution(rng));
+    /* Make sure the type limits and the zero operand appear. */
+    if (length > 0u) input[0] = std::numeric_limits<type>::min();
+    if (length > 1u) input[length - 1u] = std::numeric_limits<type>::max();
+    if (length > 2u) operands[length / 2u] = static_cast<type>(0);
+
+    for (size_t op = 0u; op < 8u; op++) {
+      const char *function_name = "";
+      std::vector<type> expected(length);
+      for (size_t j = 0u; j < length; j++) {
+        switch (op % 4u) {
+          case 0u: expected[j] = saturate_add<type>(input[j], operands[j]); break;
+          case 1u: expected[j] = saturate_sub<type>(input[j], operands[j]); break;
+          case 2u: expected[j] = saturate_neg<type>(input[j]); break;
+          default: expected[j] = saturate_abs<type>(input[j]); break;
+        }
+      }
+
+      switch (op) {
+        case 0u: function_name = "saturate_add_values"; break;
+        case 1u: function_name = "saturate_sub_values"; break;
+        case 2u: function_name = "saturate_neg_values"; break;
+        case 3u: function_name = "saturate_abs_values"; break;
+        case 4u: function_name = "saturate_add_values_X"; break;
+        case 5u: function_name = "saturate_sub_values_X"; break;
+        case 6u: function_name = "saturate_neg_values_X"; break;
+        default: function_name = "saturate_abs_values_X"; break;
+      }
+      std::snprintf(description, sizeof(description), "%s<%s>", function_name, type_name);
+
+      if (!check_guarded_array(error_count, description, input, expected, [&](const type *in, type *values) {
+            std::copy(in, in + length, values);
+            switch (op) {
+              case 0u: saturate_add_values<type>(values, operands.data(), length); break;
+              case 1u: saturate_sub_values<type>(values, operands.data(), length); break;
+              case 2u: saturate_neg_values<type>(values, length); break;
+              case 3u: saturate_abs_values<type>(values, length); break;
+              case 4u: c_functions<type>::add_values(values, operands.data(), length); break;
+              case 5u: c_functions<type>::sub_values(values, operands.data(), length); break;
+              case 6u: c_functions<type>::neg_values(values, length); break;
+              default: c_functions<type>::abs_values(values, length); break;
+            }
+          })) return;
+    }
+  }
+}
+
+/**
+ * Checks the container forms and that values and operands may be the
+ * same array.
+ */
+void test_interfaces(void) {
+  std::printf("Testing the container forms and aliased operands\n");
+
+  std::vector<int16_t> frame = {30000, -30000, 100, -100};
+  const std::array<int16_t, 4> step = {{10000, -10000, 5, -5}};
+  saturate_add_values<int16_t>(frame, step);
+  if (frame[0] != INT16_MAX || frame[1] != INT16_MIN || frame[2] != 105 || frame[3] != -105) {
+    error_count++;
+    std::printf("\nERROR: saturate_add_values<int16_t>(std::vector, std::array) gave {%i, %i, %i, %i}.\n\n", frame[0], frame[1], frame[2], frame[3]);
+  }
+
+  std::array<uint8_t, 3> levels = {{10u, 200u, 255u}};
+  saturate_sub_values<uint8_t>(levels, std::vector<uint8_t>{20u, 100u, 0u});
+  if (levels[0] != 0u || levels[1] != 100u || levels[2] != 255u) {
+    error_count++;
+    std::printf("\nERROR: saturate_sub_values<uint8_t>(std::array, std::vector) gave {%u, %u, %u}.\n\n", levels[0], levels[1], levels[2]);
+  }
+
+  std::vector<int8_t> signs = {INT8_MIN, -1, 0, INT8_MAX};
+  saturate_neg_values<int8_t>(signs);
+  if (signs[0] != INT8_MAX || signs[1] != 1 || signs[2] != 0 || signs[3] != -INT8_MAX) {
+    error_count++;
+    std::printf("\nERROR: saturate_neg_values<int8_t>(std::vector) gave {%i, %i, %i, %i}.\n\n", signs[0], signs[1], signs[2], signs[3]);
+  }
+
+  std::vector<int64_t> magnitudes = {INT64_MIN, -7, 7};
+  saturate_abs_values<int64_t>(magnitudes);
+  if (magnitudes[0] != INT64_MAX || magnitudes[1] != 7 || magnitudes[2] != 7) {
+    error_count++;
+    std::printf("\nERROR: saturate_abs_values<int64_t>(std::vector) gave {%" PRId64 ", %" PRId64 ", %" PRId64 "}.\n\n", magnitudes[0], magnitudes[1], magnitudes[2]);
+  }
+
+  int32_t doubled[3] = {INT32_MAX / 2 + 1, -3, INT32_MIN / 2 - 1};
+  saturate_add_values_i32(doubled, doubled, 3u);
+  if (doubled[0] != INT32_MAX || doubled[1] != -6 || doubled[2] != INT32_MIN) {
+    error_count++;
+    std::printf("\nERROR: saturate_add_values_i32(values, values, 3) gave {%i, %i, %i}.\n\n", doubled[0], doubled[1], doubled[2]);
+  }
+}
+
+int main() {
+  std::mt19937_64 rng(0x5A7A817u);
+
+  test_exhaustive<int8_t>("int8_t");
+  test_exhaustive<uint8_t>("uint8_t");
+  test_edges_and_random<int16_t>("int16_t", rng);
+  test_edges_and_random<uint16_t>("uint16_t", rng);
+  test_edges_and_random<int32_t>("int32_t", rng);
+  test_edges_and_random<uint32_t>("uint32_t", rng);
+  test_edges_and_random<int64_t>("int64_t", rng);
+  test_edges_and_random<uint64_t>("uint64_t", rng);
+
+  for_each_code_path(CPU_FEATURE_SSE2 | CPU_FEATURE_AVX2 | CPU_FEATURE_AVX512, [&]() {
+    test_values<int8_t>("int8_t", rng);
+    test_values<uint8_t>("uint8_t", rng);
+    test_values<int16_t>("int16_t", rng);
+    test_values<uint16_t>("uint16_t", rng);
+    test_values<int32_t>("int32_t", rng);
+    test_values<uint32_t>("uint32_t", rng);
+    test_values<int64_t>("int64_t", rng);
+    test_values<uint64_t>("uint64_t", rng);
+    test_interfaces();
+  });
+
+  std::printf("\nTests complete. %" PRIu64 " errors.\n", error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,287 @@
+/**
+ * test_saturate_values.cpp
+ * Tests all versions of
+ *   void saturate_values_X(type *values, const size_t length, const type lower_bound, const type upper_bound);
+ * and
+ *   void saturate_values<typename type>(type *values, const size_t length, const type lower_bound, const type upper_bound);
+ *   void saturate_values<typename type>(Contiguous &values, const type lower_bound, const type upper_bound);
+ * against
+ *   void saturate_value<typename type>(type &value, const type lower_bound, const type upper_bound);
+ * applied to each element. X is a type abbreviation.
+ *
+ * Every test runs on each code path through for_each_code_path, and
+ * every array length from 0 to 300 is tested with check_guarded_array,
+ * both from test_values.hpp, so that all vector tail lengths and
+ * misalignments occur. Bounds include random ordered pairs, the full type
+ * range, single value ranges at both type limits, and the inverted case
+ * lower_bound > upper_bound.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <array>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include "saturate_value.hpp"
+#include "saturate_values.hpp"
+#include "test_values.hpp"
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "saturate_value.h"
+#ifdef __cplusplus
+  }
+#endif
+
+const size_t max_test_length = 300u;
+const size_t random_bounds_per_type = 24u;
+
+uint64_t error_count = 0u;
+
+/**
+ * Runs saturate_values<type> over every length for one pair of bounds and
+ * compares the result to saturate_value<type>.
+ */
+template <typename type> void test_bounds(const char *type_name, const type lower_bound, const type upper_bound, std::mt19937_64 &rng) {
+  std::uniform_int_distribution<uint64_t> distribution;
+  char description[128];
+  std::snprintf(description, sizeof(description), "saturate_values<%s> with bounds %" PRId64 ", %" PRId64,
+                type_name, static_cast<int64_t>(lower_bound), static_cast<int64_t>(upper_bound));
+
+  for (size_t length = 0u; length <= max_test_length; length++) {
+    std::vector<type> input(length);
+    for (type &value : input) value = static_cast<type>(distribution(rng));
+    /* Make sure both bounds appear in the input. */
+    if (length > 0u) input[0] = lower_bound;
+    if (length > 1u) input[length - 1u] = upper_bound;
+
+    std::vector<type> expected(input);
+    for (type &value : expected) saturate_value<type>(value, lower_bound, upper_bound);
+    if (!check_guarded_array(error_count, description, input, expected, [&](const type *in, type *values) {
+          std::copy(in, in + length, values);
+          saturate_values<type>(values, length, lower_bound, upper_bound);
+        })) return;
+  }
+}
+
+/**
+ * Tests one type with special and random bounds.
+ */
+template <typename type> void test_type(const char *type_name, std::mt19937_64 &rng) {
+  const type type_min = std::numeric_limits<type>::min();
+  const type type_max = std::numeric_limits<type>::max();
+  std::uniform_int_distribution<uint64_t> distribution;
+
+  std::printf("Testing saturate_values<%s>\n", type_name);
+  test_bounds<type>(type_name, type_min, type_max, rng);
+  test_bounds<type>(type_name, type_min, type_min, rng);
+  test_bounds<type>(type_name, type_max, type_max, rng);
+  test_bounds<type>(type_name, static_cast<type>(type_min + 1), static_cast<type>(type_max - 1), rng);
+  test_bounds<type>(type_name, static_cast<type>(0), static_cast<type>(0), rng);
+  test_bounds<type>(type_name, type_max, type_min, rng);
+  for (size_t k = 0u; k < random_bounds_per_type; k++) {
+    type lower_bound = static_cast<type>(distribution(rng));
+    type upper_bound = static_cast<type>(distribution(rng));
+    if (lower_bound > upper_bound) std::swap(lower_bound, upper_bound);
+    test_bounds<type>(type_name, lower_bound, upper_bound, rng);
+  }
+}
+
+/**
+ * Spot checks the C functions and the contiguous container form.
+ */
+void test_interfaces(void) {
+  std::printf("Testing saturate_values_X and the container form\n");
+
+  int8_t values_i8[3] = {-100, 5, 100};
+  saturate_values_i8(values_i8, 3u, -10, 10);
+  if (values_i8[0] != -10 || values_i8[1] != 5 || values_i8[2] != 10) {
+    error_count++;
+    std::printf("\nERROR: saturate_values_i8({-100, 5, 100}, 3, -10, 10) gave {%i, %i, %i}, expected {-10, 5, 10}.\n\n", values_i8[0], values_i8[1], values_i8[2]);
+  }
+
+  uint16_t values_u16[3] = {0u, 500u, 60000u};
+  saturate_values_u16(values_u16, 3u, 100u, 1000u);
+  if (values_u16[0] != 100u || values_u16[1] != 500u || values_u16[2] != 1000u) {
+    error_count++;
+    std::printf("\nERROR: saturate_values_u16({0, 500, 60000}, 3, 100, 1000) gave {%u, %u, %u}, expected {100, 500, 1000}.\n\n", values_u16[0], values_u16[1], values_u16[2]);
+  }
+
+  uint64_t values_u64[3] = {1u, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull};
+  saturate_values_u64(values_u64, 3u, 2u, 0x8000000000000001ull);
+  if (values_u64[0] != 2u || values_u64[1] != 0x8000000000000000ull || values_u64[2] != 0x8000000000000001ull) {
+    error_count++;
+    std::printf("\nERROR: saturate_values_u64 on values straddling 2^63 gave {%" PRIu64 ", %" PRIu64 ", %" PRIu64 "}.\n\n", values_u64[0], values_u64[1], values_u64[2]);
+  }
+
+  std::vector<int32_t> frame = {-70000, -5, 0, 5, 70000};
+  saturate_values<int32_t>(frame, -32768, 32767);
+  if (frame[0] != -32768 || frame[1] != -5 || frame[2] != 0 || frame[3] != 5 || frame[4] != 32767) {
+    error_count++;
+    std::printf("\nERROR: saturate_values<int32_t>(std::vector, -32768, 32767) gave {%i, %i, %i, %i, %i}.\n\n", frame[0], frame[1], frame[2], frame[3], frame[4]);
+  }
+
+  std::array<int64_t, 4> block = {{INT64_MIN, -1, 1, INT64_MAX}};
+  saturate_values<int64_t>(block, -1, 1);
+  if (block[0] != -1 || block[1] != -1 || block[2] != 1 || block[3] != 1) {
+    error_count++;
+    std::printf("\nERROR: saturate_values<int64_t>(std::array, -1, 1) gave {%" PRId64 ", %" PRId64 ", %" PRId64 ", %" PRId64 "}.\n\n", block[0], block[1], block[2], block[3]);
+  }
+}
+
+int main() {
+  std::mt19937_64 rng(0x5A7u);
+
+  for_each_code_path(CPU_FEATURE_ALL, [&]() {
+    test_type<int8_t>("int8_t", rng);
+    test_type<uint8_t>("uint8_t", rng);
+    test_type<int16_t>("int16_t", rng);
+    test_type<uint16_t>("uint16_t", rng);
+    test_type<int32_t>("int32_t", rng);
+    test_type<uint32_t>("uint32_t", rng);
+    test_type<int64_t>("int64_t", rng);
+    test_type<uint64_t>("uint64_t", rng);
+    test_interfaces();
+  });
+
+  std::printf("\nTests complete. %" PRIu64 " errors.\n", error_count);
+  return 0;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
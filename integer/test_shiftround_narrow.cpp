@@ -0,0 +1,333 @@
+/**
+ * test_shiftround_narrow.cpp
+ * Tests all versions of
+ *   void shiftround_narrow_sat_X_Y(const from_type *num, const size_t length, const uint8_t shift, to_type *result);
+ * and
+ *   void shiftround_narrow_sat<typename from_type, typename to_type>(const from_type *num, const size_t length, const uint8_t shift, to_type *result);
+ * against
+ *   from_type shiftround<typename from_type>(const from_type num, const uint8_t shift);
+ * from shiftround_run.hpp followed by
+ *   void saturate_value<typename from_type>(from_type &value, const from_type lower_bound, const from_type upper_bound);
+ * on the range of to_type. X and Y are type abbreviations.
+ *
+ * Every test runs on each code path through for_each_code_path, and
+ * every valid shift is tested at every array length from 0 to 140 with
+ * check_guarded_array, both from test_values.hpp, so that all vector tail
+ * lengths and misalignments occur. Inputs mix the type limits, exact rounding ties
+ * at both signs, values just inside and outside the saturation limits,
+ * and random values. The elements just past each result are checked to
+ * make sure they are never written, and invalid shifts are checked to
+ * write 0 to every result.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+#include <vector>
+#include <random>
+#include <type_traits>
+#include "shiftround_run.hpp"
+#include "saturate_value.hpp"
+#include "shiftround_narrow.hpp"
+#include "test_values.hpp"
+
+const size_t max_test_length = 140u;
+
+uint64_t error_count = 0u;
+
+/**
+ * Returns an input that exercises shift: a type limit, a rounding tie, a
+ * value next to a saturation limit of to_type, or a random value.
+ */
+template <typename from_type, typename to_type> from_type test_input(const uint8_t shift, std::mt19937_64 &rng) {
+  typedef typename std::conditional<std::numeric_limits<from_type>::is_signed, int64_t, uint64_t>::type wide_type;
+  const from_type from_min = std::numeric_limits<from_type>::min();
+  const from_type from_max = std::numeric_limits<from_type>::max();
+  const wide_type step = static_cast<wide_type>(1) << shift;
+  const wide_type half = step >> 1;
+  std::uniform_int_distribution<uint64_t> distribution;
+  const uint64_t choice = distribution(rng);
+  const wide_type small = static_cast<wide_type>((choice >> 8) % ((shift < 56u) ? 64u : 2u));
+  /* Whether to_type limits times 2^shift fit in wide_type without overflow. */
+  const bool limits_fit = std::numeric_limits<to_type>::digits + shift + 2 < std::numeric_limits<wide_type>::digits;
+  wide_type value = 0;
+
+  switch (choice % 8u) {
+    case 0u:
+      return ((choice >> 8) & 1u) ? from_min : from_max;
+    case 1u:
+      /* A tie or a neighbor of a tie near zero. */
+      value = small * step + half + static_cast<wide_type>((choice >> 16) % 3u) - 1;
+      if (std::numeric_limits<from_type>::is_signed && ((choice >> 20) & 1u)) value = -value;
+      break;
+    case 2u:
+    case 3u:
+      if (!limits_fit) return static_cast<from_type>(distribution(rng));
+      /* Within a few steps of the upper saturation limit. */
+      value = static_cast<wide_type>(std::numeric_limits<to_type>::max()) * step + (small - 32) * (step > 4 ? step / 4 : 1);
+      break;
+    case 4u:
+      if (!limits_fit) return static_cast<from_type>(distribution(rng));
+      /* Within a few steps of the lower saturation limit. */
+      value = static_cast<wide_type>(std::numeric_limits<to_type>::min()) * step + (small - 32) * (step > 4 ? step / 4 : 1);
+      break;
+    default:
+      return static_cast<from_type>(distribution(rng));
+  }
+
+  /* Keep the near-limit values inside from_type instead of wrapping. */
+  if (std::numeric_limits<from_type>::is_signed) {
+    if (static_cast<int64_t>(value) < static_cast<int64_t>(from_min) || (value > 0 && static_cast<uint64_t>(value) > static_cast<uint64_t>(from_max))) return static_cast<from_type>(distribution(rng));
+  }
+  else if (value > static_cast<wide_type>(from_max)) {
+    return static_cast<from_type>(distribution(rng));
+  }
+  return static_cast<from_type>(value);
+}
+
+/**
+ * Returns shiftround<from_type>(num, shift) saturated to to_type. The
+ * lower limit of an unsigned from_type is 0 whatever to_type is.
+ */
+template <typename from_type, typename to_type> to_type expected_result(const from_type num, const uint8_t shift) {
+  const from_type lower = std::numeric_limits<from_type>::is_signed ? static_cast<from_type>(std::numeric_limits<to_type>::min()) : static_cast<from_type>(0);
+  from_type rounded = shiftround<from_type>(num, shift);
+  saturate_value<from_type>(rounded, lower, static_cast<from_type>(std::numeric_limits<to_type>::max()));
+  return static_cast<to_type>(rounded);
+}
+
+/**
+ * Runs shiftround_narrow_sat<from_type, to_type> over every valid shift
+ * and length and compares the results to expected_result.
+ */
+template <typename from_type, typename to_type> void test_pair(const char *from_name, const char *to_name, std::mt19937_64 &rng) {
+  const uint8_t max_shift = static_cast<uint8_t>(std::numeric_limits<from_type>::digits - 1);
+  char description[96];
+
+  std::printf("Testing shiftround_narrow_sat<%s, %s>\n", from_name, to_name);
+
+  for (uint8_t shift = 0u; shift <= max_shift; shift++) {
+    std::snprintf(description, sizeof(description), "shiftround_narrow_sat<%s, %s> shift %u", from_name, to_name, shift);
+    for (size_t length = 0u; length <= max_test_length; length++) {
+      std::vector<from_type> input(length);
+      std::vector<to_type> expected(length);
+      for (size_t j = 0u; j < length; j++) {
+        input[j] = test_input<from_type, to_type>(shift, rng);
+        expected[j] = expected_result<from_type, to_type>(input[j], shift);
+      }
+      if (!check_guarded_array(error_count, description, input, expected, [&](const from_type *num, to_type *result) {
+            shiftround_narrow_sat<from_type, to_type>(num, length, shift, result);
+          })) return;
+    }
+  }
+
+  /* Invalid shifts write 0 to every result. */
+  std::vector<from_type> input(max_test_length);
+  for (from_type &value : input) value = test_input<from_type, to_type>(max_shift, rng);
+  const std::vector<to_type> zeros(max_test_length, static_cast<to_type>(0));
+  for (unsigned shift = max_shift + 1u; shift <= 255u; shift += 37u) {
+    std::snprintf(description, sizeof(description), "shiftround_narrow_sat<%s, %s> invalid shift %u", from_name, to_name, shift);
+    if (!check_guarded_array(error_count, description, input, zeros, [&](const from_type *num, to_type *result) {
+          shiftround_narrow_sat<from_type, to_type>(num, max_test_length, static_cast<uint8_t>(shift), result);
+        })) return;
+  }
+}
+
+/**
+ * Spot checks the C functions.
+ */
+void test_interfaces(void) {
+  std::printf("Testing shiftround_narrow_sat_X_Y\n");
+
+  const int16_t num_i16[5] = {-32768, -6, -5, 5, 32767};
+  int8_t result_i8[5];
+  shiftround_narrow_sat_i16_i8(num_i16, 5u, 1u, result_i8);
+  if (result_i8[0] != -128 || result_i8[1] != -3 || result_i8[2] != -3 || result_i8[3] != 3 || result_i8[4] != 127) {
+    error_count++;
+    std::printf("\nERROR: shiftround_narrow_sat_i16_i8({-32768, -6, -5, 5, 32767}, 5, 1) gave {%i, %i, %i, %i, %i}, expected {-128, -3, -3, 3, 127}.\n\n",
+                result_i8[0], result_i8[1], result_i8[2], result_i8[3], result_i8[4]);
+  }
+
+  const int32_t num_i32[4] = {-100000, -2, 131070, 131074};
+  uint16_t result_u16[4];
+  shiftround_narrow_sat_i32_u16(num_i32, 4u, 1u, result_u16);
+  if (result_u16[0] != 0u || result_u16[1] != 0u || result_u16[2] != 65535u || result_u16[3] != 65535u) {
+    error_count++;
+    std::printf("\nERROR: shiftround_narrow_sat_i32_u16({-100000, -2, 131070, 131074}, 4, 1) gave {%u, %u, %u, %u}, expected {0, 0, 65535, 65535}.\n\n",
+                result_u16[0], result_u16[1], result_u16[2], result_u16[3]);
+  }
+
+  const uint32_t num_u32[4] = {65533u, 65534u, 65535u, 0xFFFFFFFFu};
+  int16_t result_i16[4];
+  shiftround_narrow_sat_u32_i16(num_u32, 4u, 1u, result_i16);
+  if (result_i16[0] != 32767 || result_i16[1] != 32767 || result_i16[2] != 32767 || result_i16[3] != 32767) {
+    error_count++;
+    std::printf("\nERROR: shiftround_narrow_sat_u32_i16({65533, 65534, 65535, 0xFFFFFFFF}, 4, 1) gave {%i, %i, %i, %i}, expected 32767 throughout.\n\n",
+                result_i16[0], result_i16[1], result_i16[2], result_i16[3]);
+  }
+
+  const uint64_t num_u64[3] = {0x1FFFFFFFDull, 0x1FFFFFFFEull, 0xFFFFFFFFFFFFFFFFull};
+  uint32_t result_u32[3];
+  shiftround_narrow_sat_u64_u32(num_u64, 3u, 1u, result_u32);
+  if (result_u32[0] != 0xFFFFFFFFu || result_u32[1] != 0xFFFFFFFFu || result_u32[2] != 0xFFFFFFFFu) {
+    error_count++;
+    std::printf("\nERROR: shiftround_narrow_sat_u64_u32 near 2^33 gave {%" PRIu32 ", %" PRIu32 ", %" PRIu32 "}, expected 0xFFFFFFFF throughout.\n\n",
+                result_u32[0], result_u32[1], result_u32[2]);
+  }
+}
+
+int main() {
+  std::mt19937_64 rng(0x5124u);
+
+  for_each_code_path(CPU_FEATURE_ALL, [&]() {
+    test_pair<int16_t, int8_t>("int16_t", "int8_t", rng);
+    test_pair<int16_t, uint8_t>("int16_t", "uint8_t", rng);
+    test_pair<uint16_t, uint8_t>("uint16_t", "uint8_t", rng);
+    test_pair<uint16_t, int8_t>("uint16_t", "int8_t", rng);
+    test_pair<int32_t, int16_t>("int32_t", "int16_t", rng);
+    test_pair<int32_t, uint16_t>("int32_t", "uint16_t", rng);
+    test_pair<uint32_t, uint16_t>("uint32_t", "uint16_t", rng);
+    test_pair<uint32_t, int16_t>("uint32_t", "int16_t", rng);
+    test_pair<int64_t, int32_t>("int64_t", "int32_t", rng);
+    test_pair<int64_t, uint32_t>("int64_t", "uint32_t", rng);
+    test_pair<uint64_t, uint32_t>("uint64_t", "uint32_t", rng);
+    test_pair<uint64_t, int32_t>("uint64_t", "int32_t", rng);
+    test_interfaces();
+  });
+
+  std::printf("\n%" PRIu64 " errors.\n", error_count);
+  return (error_count == 0u) ? 0 : 1;
+}
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
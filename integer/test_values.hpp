@@ -0,0 +1,353 @@
+/**
+ * test_values.hpp
+ * Input generators and a mismatch printer shared by the test drivers.
+ *
+ * all_values<type>() returns every value of an 8-bit or 16-bit type, for
+ * the tests that sweep whole types. special_values<type>(count, rng, ...)
+ * returns the values that most often expose rounding and overflow bugs,
+ * followed by pseudorandom values, for the tests that sample the 32-bit
+ * and 64-bit types. report_error<type>(...) prints one mismatch as signed
+ * or unsigned decimals according to type.
+ *
+ * for_each_code_path(kernel_features, run_tests) runs a test once for each
+ * of the scalar, SSE2, SSE4.1, AVX2, and AVX-512 code paths of the array
+ * functions, and check_guarded_array(...) checks one array call at every
+ * start offset, including that nothing outside the array is written.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef TEST_VALUES_HPP_
+#define TEST_VALUES_HPP_
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <vector>
+
+#ifdef __cplusplus
+  extern "C"
+  {
+#endif
+    #include "cpu_features.h"
+#ifdef __cplusplus
+  }
+#endif
+
+/**
+ * Returns every value of an 8-bit or 16-bit type in ascending order.
+ */
+template <typename type> std::vector<type> all_values(void) {
+  std::vector<type> values;
+  type value = std::numeric_limits<type>::lowest();
+  while (true) {
+    values.push_back(value);
+    if (value == std::numeric_limits<type>::max()) break;
+    value++;
+  }
+  return values;
+}
+
+/**
+ * Returns values near 0, near every power of two and its negative, and
+ * near the extremes of type, followed by count pseudorandom values. With
+ * near_fractions, values just above max / 2 and max / 3 are added before
+ * the pseudorandom values.
+ */
+template <typename type> std::vector<type> special_values(const size_t count, std::mt19937_64 &rng, const bool near_fractions) {
+  std::vector<type> values;
+  for (int64_t j = -4; j <= 4; j++) values.push_back(static_cast<type>(j));
+  for (int bit = 1; bit < std::numeric_limits<type>::digits + (std::numeric_limits<type>::is_signed ? 1 : 0); bit++) {
+    const type pow2 = static_cast<type>(static_cast<uint64_t>(1) << bit);
+    for (int64_t j = -1; j <= 1; j++) {
+      values.push_back(static_cast<type>(pow2 + static_cast<type>(j)));
+      if (std::numeric_limits<type>::is_signed) values.push_back(static_cast<type>(static_cast<type>(0) - pow2 + static_cast<type>(j)));
+    }
+  }
+  for (int64_t j = 0; j <= 2; j++) {
+    values.push_back(static_cast<type>(std::numeric_limits<type>::lowest() + static_cast<type>(j)));
+    values.push_back(static_cast<type>(std::numeric_limits<type>::max() - static_cast<type>(j)));
+    if (near_fractions) {
+      values.push_back(static_cast<type>(std::numeric_limits<type>::max() / 2 + static_cast<type>(j)));
+      values.push_back(static_cast<type>(std::numeric_limits<type>::max() / 3 + static_cast<type>(j)));
+    }
+  }
+  std::uniform_int_distribution<uint64_t> distribution;
+  for (size_t j = 0u; j < count; j++) {
+    /* Vary the magnitude so that small values are as common as large ones. */
+    const int bits = static_cast<int>(distribution(rng) % static_cast<uint64_t>(std::numeric_limits<type>::digits)) + 1;
+    const uint64_t raw = distribution(rng);
+    const uint64_t masked = (bits >= 64) ? raw : (raw & ((static_cast<uint64_t>(1) << bits) - 1u));
+    type value = static_cast<type>(masked);
+    if (std::numeric_limits<type>::is_signed && (raw >> 63)) value = static_cast<type>(static_cast<type>(0) - value);
+    values.push_back(value);
+  }
+  return values;
+}
+
+/**
+ * Only the first max_printed_errors mismatches found by a test are printed.
+ */
+const uint64_t max_printed_errors = 16u;
+
+/**
+ * Prints value as a signed or unsigned decimal according to type.
+ */
+template <typename type> void print_value(const type value) {
+  if (std::numeric_limits<type>::is_signed) std::printf("%" PRIi64, static_cast<int64_t>(value));
+  else std::printf("%" PRIu64, static_cast<uint64_t>(value));
+}
+
+/**
+ * Prints a mismatch between the result of form<type_name>(arguments) and
+ * the expected result, unless max_printed_errors mismatches have already
+ * been printed, and then increments error_count.
+ */
+template <typename type> void report_error(uint64_t &error_count, const char *type_name, const char *form, std::initializer_list<type> arguments, const type result, const type expected) {
+  if (error_count < max_printed_errors) {
+    std::printf("\nERROR: %s<%s>(", form, type_name);
+    bool first = true;
+    for (type argument : arguments) {
+      if (!first) std::printf(", ");
+      print_value<type>(argument);
+      first = false;
+    }
+    std::printf("): result ");
+    print_value<type>(result);
+    std::printf(", expected ");
+    print_value<type>(expected);
+    std::printf("\n\n");
+  }
+  error_count++;
+}
+
+/**
+ * Runs run_tests() once for each of the scalar, SSE2, SSE4.1, AVX2, and
+ * AVX-512 code paths, with cpu_features_limit() set so that the dispatched
+ * array functions take that path. Only the vector paths named in
+ * kernel_features are run, since the others would repeat a narrower path.
+ * Paths the processor lacks are reported as skipped. The limit is lifted
+ * again afterward.
+ */
+template <typename function_type> void for_each_code_path(const uint32_t kernel_features, function_type run_tests) {
+  struct code_path {
+    const char *name;
+    uint32_t required;
+    uint32_t mask;
+  };
+  const code_path code_paths[] = {
+    {"scalar", 0u, 0u},
+    {"SSE2", CPU_FEATURE_SSE2, CPU_FEATURE_SSE2},
+    {"SSE4.1", CPU_FEATURE_SSE4_1, CPU_FEATURE_SSE2 | CPU_FEATURE_SSE4_1},
+    {"AVX2", CPU_FEATURE_AVX2, CPU_FEATURE_SSE2 | CPU_FEATURE_SSE4_1 | CPU_FEATURE_AVX2},
+    {"AVX-512", CPU_FEATURE_AVX512, CPU_FEATURE_ALL}
+  };
+  const uint32_t supported = cpu_features();
+
+  for (const code_path &path : code_paths) {
+    if ((kernel_features & path.required) != path.required) continue;
+    if ((supported & path.required) != path.required) {
+      std::printf("Skipping %s code path: not supported by this processor\n", path.name);
+      continue;
+    }
+
+    cpu_features_limit(path.mask);
+    std::printf("\n%s code path\n", path.name);
+    run_tests();
+  }
+  cpu_features_limit(CPU_FEATURE_ALL);
+}
+
+/**
+ * The array checked by check_guarded_array starts at each offset on
+ * [0, max_guard_offset) and is followed by guard_elements guard elements.
+ */
+const size_t max_guard_offset = 8u;
+const size_t guard_elements = 4u;
+
+/**
+ * Returns the value placed around each checked array to detect out of
+ * bounds writes: every byte is 0xA5.
+ */
+template <typename type> type guard_value(void) {
+  type guard;
+  std::memset(&guard, 0xA5, sizeof(type));
+  return guard;
+}
+
+/**
+ * Checks an array function that reads input and writes expected.size()
+ * results. For every start offset, input is copied to that offset of an
+ * otherwise empty buffer, and run(input_pointer, result_pointer) is called
+ * with result_pointer at the same offset of a buffer of guard values. For
+ * an in-place function, run copies the input to the result first. Every
+ * result must match expected, and every guard value around it must be
+ * left alone. The first mismatch is printed with description and
+ * counted in error_count, and false is returned.
+ */
+template <typename in_type, typename out_type, typename function_type> bool check_guarded_array(uint64_t &error_count, const char *description, const std::vector<in_type> &input, const std::vector<out_type> &expected, function_type run) {
+  const size_t length = expected.size();
+  const out_type guard = guard_value<out_type>();
+  std::vector<in_type> input_buffer(max_guard_offset + input.size());
+  std::vector<out_type> result_buffer(max_guard_offset + length + guard_elements);
+
+  for (size_t offset = 0u; offset < max_guard_offset; offset++) {
+    for (size_t j = 0u; j < input.size(); j++) input_buffer[offset + j] = input[j];
+    for (out_type &value : result_buffer) value = guard;
+    run(static_cast<const in_type *>(input_buffer.data() + offset), result_buffer.data() + offset);
+
+    for (size_t j = 0u; j < offset + length + guard_elements; j++) {
+      const bool inside = (j >= offset && j < offset + length);
+      const out_type wanted = inside ? expected[j - offset] : guard;
+      if (result_buffer[j] != wanted) {
+        if (error_count < max_printed_errors) {
+          std::printf("\nERROR: %s, %zu elements at offset %zu; ", description, length, offset);
+          if (inside) std::printf("element %zu: result ", j - offset);
+          else std::printf("guard %s the array overwritten with ", (j < offset) ? "before" : "after");
+          print_value<out_type>(result_buffer[j]);
+          std::printf(", expected ");
+          print_value<out_type>(wanted);
+          std::printf("\n\n");
+        }
+        error_count++;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+#endif /* #ifndef TEST_VALUES_HPP_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/
@@ -0,0 +1,342 @@
+/**
+ * wide_product.h
+ * Defines helper functions for 128-bit products and quotients of 64-bit
+ * integers:
+ *     uint64_t wide_mul_u64(const uint64_t a, const uint64_t b, uint64_t *hi);
+ *     uint64_t wide_mul_i64(const int64_t a, const int64_t b, int64_t *hi);
+ *     uint64_t wide_mulhi_u64(const uint64_t a, const uint64_t b);
+ *     uint64_t wide_div_u128_u64(const uint64_t hi, const uint64_t lo, const uint64_t divisor, uint64_t *remainder);
+ *     uint64_t wide_shiftround_u128(const uint64_t hi, const uint64_t lo, const uint8_t shift, uint64_t *result_hi);
+ *     uint64_t wide_shiftround_i128(const int64_t hi, const uint64_t lo, const uint8_t shift, int64_t *result_hi);
+ *     int wide_mul_overflows_u64(const uint64_t a, const uint64_t b);
+ *     int wide_mul_overflows_i64(const int64_t a, const int64_t b);
+ *
+ * The 128-bit values are split into a high 64-bit half and a low 64-bit
+ * half. The functions use unsigned __int128 when the compiler provides it
+ * (gcc and clang on 64-bit targets), the __umulh intrinsic for products
+ * under 64-bit MSVC, and portable 32-bit arithmetic otherwise.
+ *
+ * All functions are static inline so that this header can be included
+ * from both C and C++ translation units without a separate .c file.
+ *
+ * Written in 2026 by numerical_routines contributors.
+ * Originally distributed at https://github.com/slugrustle/numerical_routines
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ * The text of the CC0 Public Domain Dedication should be reproduced at the
+ * end of this file. If not, see http://creativecommons.org/publicdomain/zero/1.0/
+ */
+#ifndef WIDE_PRODUCT_H_
+#define WIDE_PRODUCT_H_
+
+#include "inttypes.h"
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+  #define WIDE_PRODUCT_INLINE static __inline
+#else
+  #define WIDE_PRODUCT_INLINE static inline
+#endif
+
+#if defined(__SIZEOF_INT128__)
+  #define WIDE_PRODUCT_INT128
+#elif defined(_MSC_VER) && defined(_M_X64)
+  #include "intrin.h"
+  #define WIDE_PRODUCT_UMULH
+#endif
+
+/**
+ * Returns the low 64 bits of the 128-bit product a * b and stores the
+ * high 64 bits in *hi.
+ */
+WIDE_PRODUCT_INLINE uint64_t wide_mul_u64(const uint64_t a, const uint64_t b, uint64_t *hi) {
+  #if defined(WIDE_PRODUCT_INT128)
+    unsigned __int128 prod = (unsigned __int128)a * (unsigned __int128)b;
+    *hi = (uint64_t)(prod >> 64);
+    return (uint64_t)prod;
+  #elif defined(WIDE_PRODUCT_UMULH)
+    *hi = __umulh(a, b);
+    return a * b;
+  #else
+    uint64_t a_lo = a & 0xFFFFFFFFull;
+    uint64_t a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFFull;
+    uint64_t b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi;
+    uint64_t hi_hi = a_hi * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFull) + lo_hi;
+    *hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    return (cross << 32) | (lo_lo & 0xFFFFFFFFull);
+  #endif
+}
+
+/**
+ * Returns the low 64 bits of the 128-bit two's complement product a * b
+ * and stores the high 64 bits in *hi.
+ */
+WIDE_PRODUCT_INLINE uint64_t wide_mul_i64(const int64_t a, const int64_t b, int64_t *hi) {
+  uint64_t uhi;
+  uint64_t lo = wide_mul_u64((uint64_t)a, (uint64_t)b, &uhi);
+  if (a < 0ll) uhi -= (uint64_t)b;
+  if (b < 0ll) uhi -= (uint64_t)a;
+  *hi = (int64_t)uhi;
+  return lo;
+}
+
+/* Returns nonzero if the product a * b does not fit in uint64_t. */
+WIDE_PRODUCT_INLINE int wide_mul_overflows_u64(const uint64_t a, const uint64_t b) {
+  uint64_t hi;
+  (void)wide_mul_u64(a, b, &hi);
+  return hi != 0ull;
+}
+
+/* Returns nonzero if the product a * b does not fit in int64_t. */
+WIDE_PRODUCT_INLINE int wide_mul_overflows_i64(const int64_t a, const int64_t b) {
+  int64_t hi;
+  uint64_t lo = wide_mul_i64(a, b, &hi);
+  return hi != ((int64_t)lo >> 63);
+}
+
+/* Returns the high 64 bits of the 128-bit product a * b. */
+WIDE_PRODUCT_INLINE uint64_t wide_mulhi_u64(const uint64_t a, const uint64_t b) {
+  uint64_t hi;
+  (void)wide_mul_u64(a, b, &hi);
+  return hi;
+}
+
+/**
+ * Returns the 64-bit quotient of the 128-bit number (hi * 2^64 + lo)
+ * divided by divisor and stores the remainder in *remainder.
+ * hi must be less than divisor so that the quotient fits in 64 bits.
+ */
+WIDE_PRODUCT_INLINE uint64_t wide_div_u128_u64(const uint64_t hi, const uint64_t lo, const uint64_t divisor, uint64_t *remainder) {
+  #if defined(WIDE_PRODUCT_INT128)
+    unsigned __int128 dividend = ((unsigned __int128)hi << 64) | (unsigned __int128)lo;
+    *remainder = (uint64_t)(dividend % divisor);
+    return (uint64_t)(dividend / divisor);
+  #else
+    /* Restoring binary long division, one quotient bit per iteration. */
+    uint64_t rem = hi;
+    uint64_t quotient = 0ull;
+    int bit;
+    for (bit = 63; bit >= 0; bit--) {
+      uint64_t carry = rem >> 63;
+      rem = (rem << 1) | ((lo >> bit) & 1ull);
+      quotient <<= 1;
+      if (carry || rem >= divisor) {
+        rem -= divisor;
+        quotient |= 1ull;
+      }
+    }
+    *remainder = rem;
+    return quotient;
+  #endif
+}
+
+/**
+ * Returns the low 64 bits of ROUND((hi * 2^64 + lo) / 2^shift) and stores
+ * the high 64 bits in *result_hi. Ties round up, which is away from zero
+ * for this unsigned 128-bit value. shift must be on the range [0,127].
+ */
+WIDE_PRODUCT_INLINE uint64_t wide_shiftround_u128(const uint64_t hi, const uint64_t lo, const uint8_t shift, uint64_t *result_hi) {
+  uint64_t quotient_lo;
+  uint64_t quotient_hi;
+  uint64_t round_bit;
+
+  if (shift == 0u) {
+    *result_hi = hi;
+    return lo;
+  }
+
+  if (shift < 64u) {
+    quotient_lo = (lo >> shift) | (hi << (64u - shift));
+    quotient_hi = hi >> shift;
+    round_bit = (lo >> (shift - 1u)) & 1ull;
+  } else {
+    quotient_lo = hi >> (shift - 64u);
+    quotient_hi = 0ull;
+    round_bit = (shift == 64u) ? (lo >> 63) : ((hi >> (shift - 65u)) & 1ull);
+  }
+
+  quotient_lo += round_bit;
+  quotient_hi += (quotient_lo < round_bit);
+  *result_hi = quotient_hi;
+  return quotient_lo;
+}
+
+/**
+ * Returns the low 64 bits of ROUND((hi * 2^64 + lo) / 2^shift) for the
+ * two's complement 128-bit value with signed high half hi, and stores the
+ * high 64 bits in *result_hi. Ties round away from zero. shift must be on
+ * the range [0,127].
+ */
+WIDE_PRODUCT_INLINE uint64_t wide_shiftround_i128(const int64_t hi, const uint64_t lo, const uint8_t shift, int64_t *result_hi) {
+  const uint64_t unsigned_hi = (uint64_t)hi;
+  uint64_t quotient_lo;
+  uint64_t quotient_hi;
+  uint64_t round_bit;
+  uint64_t below_round_bit;
+
+  if (shift == 0u) {
+    *result_hi = hi;
+    return lo;
+  }
+
+  if (shift < 64u) {
+    quotient_lo = (lo >> shift) | (unsigned_hi << (64u - shift));
+    quotient_hi = (uint64_t)(hi >> shift);
+    round_bit = (lo >> (shift - 1u)) & 1ull;
+    below_round_bit = lo & ((1ull << (shift - 1u)) - 1ull);
+  } else if (shift == 64u) {
+    quotient_lo = unsigned_hi;
+    quotient_hi = (uint64_t)(hi >> 63);
+    round_bit = lo >> 63;
+    below_round_bit = lo & 0x7FFFFFFFFFFFFFFFull;
+  } else {
+    quotient_lo = (uint64_t)(hi >> (shift - 64u));
+    quotient_hi = (uint64_t)(hi >> 63);
+    round_bit = (unsigned_hi >> (shift - 65u)) & 1ull;
+    below_round_bit = lo | (unsigned_hi & ((1ull << (shift - 65u)) - 1ull));
+  }
+
+  /**
+   * The arithmetic shift rounds toward negative infinity. A set round bit
+   * means the discarded fraction is at least one half. Round up unless the
+   * value is negative and the fraction is exactly one half.
+   */
+  if (round_bit && (hi >= 0ll || below_round_bit != 0ull)) {
+    quotient_lo++;
+    quotient_hi += (quotient_lo == 0ull);
+  }
+  *result_hi = (int64_t)quotient_hi;
+  return quotient_lo;
+}
+
+#endif /* #ifndef WIDE_PRODUCT_H_ */
+
+/*
+Creative Commons Legal Code
+
+CC0 1.0 Universal
+
+    CREATIVE COMMONS CORPORATION IS NOT A LAW FIRM AND DOES NOT PROVIDE
+    LEGAL SERVICES. DISTRIBUTION OF THIS DOCUMENT DOES NOT CREATE AN
+    ATTORNEY-CLIENT RELATIONSHIP. CREATIVE COMMONS PROVIDES THIS
+    INFORMATION ON AN "AS-IS" BASIS. CREATIVE COMMONS MAKES NO WARRANTIES
+    REGARDING THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS
+    PROVIDED HEREUNDER, AND DISCLAIMS LIABILITY FOR DAMAGES RESULTING FROM
+    THE USE OF THIS DOCUMENT OR THE INFORMATION OR WORKS PROVIDED
+    HEREUNDER.
+
+Statement of Purpose
+
+The laws of most jurisdictions throughout the world automatically confer
+exclusive Copyright and Related Rights (defined below) upon the creator
+and subsequent owner(s) (each and all, an "owner") of an original work of
+authorship and/or a database (each, a "Work").
+
+Certain owners wish to permanently relinquish those rights to a Work for
+the purpose of contributing to a commons of creative, cultural and
+scientific works ("Commons") that the public can reliably and without fear
+of later claims of infringement build upon, modify, incorporate in other
+works, reuse and redistribute as freely as possible in any form whatsoever
+and for any purposes, including without limitation commercial purposes.
+These owners may contribute to the Commons to promote the ideal of a free
+culture and the further production of creative, cultural and scientific
+works, or to gain reputation or greater distribution for their Work in
+part through the use and efforts of others.
+
+For these and/or other purposes and motivations, and without any
+expectation of additional consideration or compensation, the person
+associating CC0 with a Work (the "Affirmer"), to the extent that he or she
+is an owner of Copyright and Related Rights in the Work, voluntarily
+elects to apply CC0 to the Work and publicly distribute the Work under its
+terms, with knowledge of his or her Copyright and Related Rights in the
+Work and the meaning and intended legal effect of CC0 on those rights.
+
+1. Copyright and Related Rights. A Work made available under CC0 may be
+protected by copyright and related or neighboring rights ("Copyright and
+Related Rights"). Copyright and Related Rights include, but are not
+limited to, the following:
+
+  i. the right to reproduce, adapt, distribute, perform, display,
+     communicate, and translate a Work;
+ ii. moral rights retained by the original author(s) and/or performer(s);
+iii. publicity and privacy rights pertaining to a person's image or
+     likeness depicted in a Work;
+ iv. rights protecting against unfair competition in regards to a Work,
+     subject to the limitations in paragraph 4(a), below;
+  v. rights protecting the extraction, dissemination, use and reuse of data
+     in a Work;
+ vi. database rights (such as those arising under Directive 96/9/EC of the
+     European Parliament and of the Council of 11 March 1996 on the legal
+     protection of databases, and under any national implementation
+     thereof, including any amended or successor version of such
+     directive); and
+vii. other similar, equivalent or corresponding rights throughout the
+     world based on applicable law or treaty, and any national
+     implementations thereof.
+
+2. Waiver. To the greatest extent permitted by, but not in contravention
+of, applicable law, Affirmer hereby overtly, fully, permanently,
+irrevocably and unconditionally waives, abandons, and surrenders all of
+Affirmer's Copyright and Related Rights and associated claims and causes
+of action, whether now known or unknown (including existing as well as
+future claims and causes of action), in the Work (i) in all territories
+worldwide, (ii) for the maximum duration provided by applicable law or
+treaty (including future time extensions), (iii) in any current or future
+medium and for any number of copies, and (iv) for any purpose whatsoever,
+including without limitation commercial, advertising or promotional
+purposes (the "Waiver"). Affirmer makes the Waiver for the benefit of each
+member of the public at large and to the detriment of Affirmer's heirs and
+successors, fully intending that such Waiver shall not be subject to
+revocation, rescission, cancellation, termination, or any other legal or
+equitable action to disrupt the quiet enjoyment of the Work by the public
+as contemplated by Affirmer's express Statement of Purpose.
+
+3. Public License Fallback. Should any part of the Waiver for any reason
+be judged legally invalid or ineffective under applicable law, then the
+Waiver shall be preserved to the maximum extent permitted taking into
+account Affirmer's express Statement of Purpose. In addition, to the
+extent the Waiver is so judged Affirmer hereby grants to each affected
+person a royalty-free, non transferable, non sublicensable, non exclusive,
+irrevocable and unconditional license to exercise Affirmer's Copyright and
+Related Rights in the Work (i) in all territories worldwide, (ii) for the
+maximum duration provided by applicable law or treaty (including future
+time extensions), (iii) in any current or future medium and for any number
+of copies, and (iv) for any purpose whatsoever, including without
+limitation commercial, advertising or promotional purposes (the
+"License"). The License shall be deemed effective as of the date CC0 was
+applied by Affirmer to the Work. Should any part of the License for any
+reason be judged legally invalid or ineffective under applicable law, such
+partial invalidity or ineffectiveness shall not invalidate the remainder
+of the License, and in such case Affirmer hereby affirms that he or she
+will not (i) exercise any of his or her remaining Copyright and Related
+Rights in the Work or (ii) assert any associated claims and causes of
+action with respect to the Work, in either case contrary to Affirmer's
+express Statement of Purpose.
+
+4. Limitations and Disclaimers.
+
+ a. No trademark or patent rights held by Affirmer are waived, abandoned,
+    surrendered, licensed or otherwise affected by this document.
+ b. Affirmer offers the Work as-is and makes no representations or
+    warranties of any kind concerning the Work, express, implied,
+    statutory or otherwise, including without limitation warranties of
+    title, merchantability, fitness for a particular purpose, non
+    infringement, or the absence of latent or other defects, accuracy, or
+    the present or absence of errors, whether or not discoverable, all to
+    the greatest extent permissible under applicable law.
+ c. Affirmer disclaims responsibility for clearing rights of other persons
+    that may apply to the Work or any use thereof, including without
+    limitation any person's Copyright and Related Rights in the Work.
+    Further, Affirmer disclaims responsibility for obtaining any necessary
+    consents, permissions or other rights required for any use of the
+    Work.
+ d. Affirmer understands and acknowledges that Creative Commons is not a
+    party to this document and has no duty or obligation with respect to
+    this CC0 or use of the Work.
+*/